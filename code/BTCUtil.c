@@ -3,6 +3,7 @@
 #include "../libraries/rmd160/rmd160.h"
 #include "../libraries/secp256k1/include/secp256k1.h"
 #include "../libraries/secp256k1/include/secp256k1_ecdh.h"
+#include "../libraries/secp256k1/include/secp256k1_batch.h"
 #include "../libraries/aes/aes.h"
 #include "../libraries/segwit_addr/segwit_addr.h"
 #include "../libraries/mnemonic/mnemonic.h"
@@ -362,6 +363,20 @@ Data hash256(Data data)
     return DTPop(sha256(sha256(DTPush(data))));
 }
 
+void hash256Bytes(const void *bytes, size_t length, uint8_t result[32])
+{
+    SHA256_CTX ctx;
+
+    sha256_init(&ctx);
+    sha256_update(&ctx, bytes, length);
+    sha256_final(&ctx, result);
+
+    sha256_init(&ctx);
+    sha256_update(&ctx, result, SHA256_BLOCK_SIZE);
+    sha256_final(&ctx, result);
+    secure_wipe((uint8_t *)&ctx, sizeof(ctx));
+}
+
 Data hmacSha256(Data key, Data data)
 {
     uint8_t result[CC_SHA256_DIGEST_LENGTH];
@@ -534,6 +549,29 @@ int bloomFilterCheckElement(Data bloomFilter, Data element)
     return 1;
 }
 
+float bloomFilterFalsePositiveRate(Data bloomFilter)
+{
+    if(bloomFilter.length < 9)
+        return 1;
+
+    const uint8_t *ptr = (uint8_t*)bloomFilter.bytes;
+    const uint8_t *end = ptr + bloomFilter.length;
+
+    uint64_t filterSize = readVarInt(&ptr, end);
+
+    if(!filterSize || filterSize + 8 > end - ptr)
+        return 1;
+
+    uint64_t bitsSet = 0;
+
+    for(uint64_t i = 0; i < filterSize; i++)
+        bitsSet += __builtin_popcount(ptr[i]);
+
+    uint32_t hashCount = *(uint32_t*)(ptr + filterSize);
+
+    return (float)pow((double)bitsSet / (filterSize * 8), hashCount);
+}
+
 Data PBKDF2(const char *sentence, const char *passphrase)
 {
     uint8_t result[64];
@@ -990,6 +1028,108 @@ Data ckd(Data hdWallet, uint32_t index)
     return childKeyDerivation(hdWallet, index);
 }
 
+Datas ckdBatch(Data hdWallet, uint32_t startIndex, uint32_t count)
+{
+    BTCUTILAssert(hdWallet.length == 82);
+
+    DataTrackPush();
+
+    Datas result = DatasNew();
+
+    if(hdWallet.length != 82)
+        return DTPopDatas(result);
+
+    Data oldKey = keyFromHdWallet(hdWallet);
+    Data oldChainCode = chainCodeFromHdWallet(hdWallet);
+    Data fingerprint = hash160(pubKeyFromHdWallet(hdWallet));
+
+    int isPrivate = uint8read(oldKey) == 0;
+
+    // For public parents 'oldKey' is already the serialized pub key, private parents only need it once
+    Data oldKeyTrim = DataCopyDataPart(oldKey, 1, 32);
+    Data hmacKey = isPrivate ? pubKey(oldKeyTrim) : oldKey;
+
+    Data hashes = DataNew(64 * count);
+    Data tweaks = DataZero(32 * count); // Zeros for skipped hardened indices, whose results go unused
+
+    for(uint32_t i = 0; i < count; i++) {
+
+        uint32_t index = startIndex + i;
+
+        // Hardened public derivation fails in 'childKeyDerivation' below
+        if(index >= 0x80000000 && !isPrivate)
+            continue;
+
+        Data indexData = DataFlipEndianCopy(uint32D(index));
+
+        Data hash = hmacSha512(oldChainCode, DataAddCopy(index >= 0x80000000 ? oldKey : hmacKey, indexData));
+
+        memcpy((uint8_t*)hashes.bytes + 64 * i, hash.bytes, 64);
+        memcpy((uint8_t*)tweaks.bytes + 32 * i, hash.bytes, 32);
+    }
+
+    Data pubKeys = DataNew(sizeof(secp256k1_pubkey) * count);
+    Data valid = DataNew(count);
+
+    secp256k1_pubkey *pubKeyObjs = (secp256k1_pubkey*)pubKeys.bytes;
+    uint8_t *validPtr = (uint8_t*)valid.bytes;
+
+    if(!isPrivate) {
+
+        Data parsedPubKey = publicKeyParse(oldKey);
+
+        if(parsedPubKey.length != sizeof(secp256k1_pubkey))
+            return DTPopDatas(result);
+
+        // Every child is parent + I_L * G, normalized together with a single field inversion
+        if(!secp256k1_ec_pubkey_tweak_add_batch(secpCtx, pubKeyObjs, validPtr, (void*)parsedPubKey.bytes, (const unsigned char*)tweaks.bytes, count))
+            return DTPopDatas(result);
+    }
+
+    for(uint32_t i = 0; i < count; i++) {
+
+        uint32_t index = startIndex + i;
+        const uint8_t *hash = (uint8_t*)hashes.bytes + 64 * i;
+
+        Data newKey;
+
+        if(index >= 0x80000000 && !isPrivate)
+            newKey = DataNull();
+        else if(isPrivate)
+            newKey = DataAddCopy(uint8D(0), addToPrivKey(DataCopy((void*)hash, 32), oldKeyTrim));
+        else if(validPtr[i])
+            newKey = publicKeyCompress(DataCopy((void*)&pubKeyObjs[i], sizeof(secp256k1_pubkey)));
+        else
+            newKey = DataNull();
+
+        // Invalid keys fall back to the skip-to-next-index rule of 'childKeyDerivation'
+        if(newKey.length != 33) {
+
+            result = DatasAddRef(result, childKeyDerivation(hdWallet, index));
+            continue;
+        }
+
+        Data child = DataCopyData(hdWallet);
+
+        uint8_t *ptr = (uint8_t*)child.bytes;
+
+        (*(uint8_t*)(ptr + 4))++;
+
+        memcpy(ptr + 4 + 1, fingerprint.bytes, 4);
+        memcpy(ptr + 4 + 1 + 4, DataFlipEndianCopy(uint32D(index)).bytes, 4);
+        memcpy(ptr + 4 + 1 + 4 + 4, hash + 32, 32);
+        memcpy(ptr + 4 + 1 + 4 + 4 + 32, newKey.bytes, 33);
+
+        Data checksum = hash256(DataCopyDataPart(child, 0, 78));
+
+        memcpy(ptr + 4 + 1 + 4 + 4 + 32 + 33, checksum.bytes, 4);
+
+        result = DatasAddRef(result, child);
+    }
+
+    return DTPopDatas(result);
+}
+
 Data implode(Datas items)
 {
     DataTrackPush();
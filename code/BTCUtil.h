@@ -38,6 +38,7 @@ Data sha512(Data data);
 Data ripemd160(Data data);
 Data hash160(Data data);
 Data hash256(Data data);
+void hash256Bytes(const void *bytes, size_t length, uint8_t result[32]); // Writes to 'result', allocates nothing
 
 Data hmacSha256(Data key, Data data);
 Data hmacSha512(Data key, Data data);
@@ -58,6 +59,9 @@ Data bloomFilter(int estimatedElements, float falsePositiveRate, int flag);
 int bloomFilterAddElement(Data bloomFilter, Data element);
 int bloomFilterCheckElement(Data bloomFilter, Data element);
 
+// Chance an element not in 'bloomFilter' matches, estimated from how many bits are set. 1 if invalid.
+float bloomFilterFalsePositiveRate(Data bloomFilter);
+
 Data PBKDF2(const char *sentence, const char *passphrase);
 
 int hdWalletVerify(Data hdWallet);
@@ -91,6 +95,10 @@ Data childKeyDerivation(Data hdWallet, uint32_t index);
 // Shorthand for childKeyDerivation.
 Data ckd(Data hdWallet, uint32_t index);
 
+// The children 'startIndex' through 'startIndex + count - 1', the same as calling childKeyDerivation on each.
+// Faster for public parents: the pub keys are normalized in one batch and the fingerprint is computed once.
+Datas ckdBatch(Data hdWallet, uint32_t startIndex, uint32_t count);
+
 Data implode(Datas items);
 
 String base58Encode(Data data);
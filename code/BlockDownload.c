@@ -0,0 +1,147 @@
+#include "BlockDownload.h"
+#include <string.h>
+
+#define WINDOWS(download) ((BlockDownloadWindow*)(download)->windows.bytes)
+#define WINDOW_COUNT(download) ((int)((download)->windows.length / sizeof(BlockDownloadWindow)))
+
+BlockDownload BlockDownloadNew(int32_t windowSize)
+{
+    BlockDownload result = { 0 };
+
+    result.windowSize = windowSize > 0 ? windowSize : 1;
+
+    // Allocated up front, appending to a null Data would track the result
+    result.windows = DataNewUntracked(sizeof(BlockDownloadWindow));
+    result.windows.length = 0;
+
+    return result;
+}
+
+void BlockDownloadFree(BlockDownload *download)
+{
+    DataFree(download->windows);
+
+    *download = (BlockDownload) { 0 };
+}
+
+void BlockDownloadReset(BlockDownload *download, int32_t completedHeight)
+{
+    download->completedHeight = completedHeight;
+    download->windows.length = 0;
+}
+
+void BlockDownloadSetTarget(BlockDownload *download, int32_t targetHeight)
+{
+    download->targetHeight = targetHeight;
+}
+
+BlockDownloadWindow *BlockDownloadWindowOf(BlockDownload *download, void *owner)
+{
+    if(!owner)
+        return NULL;
+
+    for(int i = 0; i < WINDOW_COUNT(download); i++)
+        if(WINDOWS(download)[i].owner == owner)
+            return &WINDOWS(download)[i];
+
+    return NULL;
+}
+
+BlockDownloadWindow *BlockDownloadAssign(BlockDownload *download, void *owner, int64_t now)
+{
+    if(!owner || BlockDownloadWindowOf(download, owner))
+        return NULL;
+
+    // Lower windows hold back 'completedHeight' so released ones go out first
+    for(int i = 0; i < WINDOW_COUNT(download); i++) {
+
+        BlockDownloadWindow *window = &WINDOWS(download)[i];
+
+        if(!window->owner && window->progressHeight < window->lastHeight) {
+
+            window->owner = owner;
+            window->lastActivity = now;
+
+            return window;
+        }
+    }
+
+    int32_t firstHeight = download->completedHeight + 1;
+
+    if(WINDOW_COUNT(download))
+        firstHeight = WINDOWS(download)[WINDOW_COUNT(download) - 1].lastHeight + 1;
+
+    if(firstHeight > download->targetHeight)
+        return NULL;
+
+    BlockDownloadWindow window = { firstHeight, firstHeight + download->windowSize - 1, firstHeight - 1, owner, now };
+
+    if(window.lastHeight > download->targetHeight)
+        window.lastHeight = download->targetHeight;
+
+    download->windows = DataAppend(download->windows, DataRaw(window));
+
+    return &WINDOWS(download)[WINDOW_COUNT(download) - 1];
+}
+
+int BlockDownloadProgress(BlockDownload *download, void *owner, int32_t height, int64_t now)
+{
+    BlockDownloadWindow *window = BlockDownloadWindowOf(download, owner);
+
+    if(!window || height <= window->progressHeight || height > window->lastHeight)
+        return 0;
+
+    window->progressHeight = height;
+    window->lastActivity = now;
+
+    if(height == window->lastHeight)
+        window->owner = NULL;
+
+    int32_t oldHeight = download->completedHeight;
+
+    // Finished windows come off the front, a partly finished one still counts up to its progress
+    int finished = 0;
+
+    while(finished < WINDOW_COUNT(download)) {
+
+        BlockDownloadWindow *first = &WINDOWS(download)[finished];
+
+        if(first->progressHeight > download->completedHeight)
+            download->completedHeight = first->progressHeight;
+
+        if(first->progressHeight < first->lastHeight)
+            break;
+
+        finished++;
+    }
+
+    if(finished) {
+
+        memmove(download->windows.bytes, WINDOWS(download) + finished, (WINDOW_COUNT(download) - finished) * sizeof(BlockDownloadWindow));
+
+        download->windows.length -= finished * sizeof(BlockDownloadWindow);
+    }
+
+    return download->completedHeight != oldHeight;
+}
+
+void BlockDownloadRelease(BlockDownload *download, void *owner)
+{
+    BlockDownloadWindow *window = BlockDownloadWindowOf(download, owner);
+
+    if(window)
+        window->owner = NULL;
+}
+
+void *BlockDownloadStalledOwner(BlockDownload *download, int64_t now)
+{
+    for(int i = 0; i < WINDOW_COUNT(download); i++) {
+
+        BlockDownloadWindow *window = &WINDOWS(download)[i];
+
+        if(window->owner && now - window->lastActivity >= BLOCK_DOWNLOAD_STALL_SECONDS)
+            return window->owner;
+    }
+
+    return NULL;
+}
@@ -0,0 +1,60 @@
+#ifndef BLOCKDOWNLOAD_H
+#define BLOCKDOWNLOAD_H
+
+#include "Data.h"
+
+// Splits the filtered block download above 'completedHeight' into windows of consecutive heights so
+// several peers can each fetch one at once. Peers finish out of order, 'completedHeight' only moves
+// over heights that are done with nothing missing below them. Owners are opaque (Node pointers).
+// Not thread safe, NodeManager uses it with 'nodesMutex' held.
+
+#define BLOCK_DOWNLOAD_STALL_SECONDS 30
+
+typedef struct BlockDownloadWindow {
+
+    int32_t firstHeight;
+    int32_t lastHeight;
+    int32_t progressHeight; // Every height through here is done. 'firstHeight' - 1 before any are.
+
+    void *owner; // NULL while waiting for a peer
+    int64_t lastActivity; // When it was assigned or last made progress
+
+} BlockDownloadWindow;
+
+typedef struct BlockDownload {
+
+    int32_t completedHeight;
+    int32_t targetHeight;
+    int32_t windowSize;
+
+    Data windows; // BlockDownloadWindow array, ascending and contiguous from 'completedHeight' + 1
+
+} BlockDownload;
+
+// BlockDownloads are created Untracked.
+BlockDownload BlockDownloadNew(int32_t windowSize);
+void BlockDownloadFree(BlockDownload *download);
+
+// Drops every window. Peers still sending blocks for them are ignored from here on.
+void BlockDownloadReset(BlockDownload *download, int32_t completedHeight);
+
+// Windows are never made past 'targetHeight', ones already made are kept.
+void BlockDownloadSetTarget(BlockDownload *download, int32_t targetHeight);
+
+// Gives 'owner' the lowest window nobody has, making a new one if needed. Returns NULL if 'owner'
+// already has one or every height up to the target is taken.
+BlockDownloadWindow *BlockDownloadAssign(BlockDownload *download, void *owner, int64_t now);
+
+BlockDownloadWindow *BlockDownloadWindowOf(BlockDownload *download, void *owner); // NULL if it has none
+
+// 'owner' is done with every height in its window through 'height'. Finishing the window frees 'owner'
+// for another. Returns 1 if 'completedHeight' moved.
+int BlockDownloadProgress(BlockDownload *download, void *owner, int32_t height, int64_t now);
+
+// The unfinished part of the owner's window goes back to waiting for a peer.
+void BlockDownloadRelease(BlockDownload *download, void *owner);
+
+// An owner whose window hasn't progressed in BLOCK_DOWNLOAD_STALL_SECONDS, NULL if none.
+void *BlockDownloadStalledOwner(BlockDownload *download, int64_t now);
+
+#endif
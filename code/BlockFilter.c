@@ -0,0 +1,309 @@
+#include "BlockFilter.h"
+#include "BTCUtil.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ROTL(x, b) (uint64_t)(((x) << (b)) | ((x) >> (64 - (b))))
+
+#define SIPROUND do { \
+    v0 += v1; v1 = ROTL(v1, 13); v1 ^= v0; v0 = ROTL(v0, 32); \
+    v2 += v3; v3 = ROTL(v3, 16); v3 ^= v2; \
+    v0 += v3; v3 = ROTL(v3, 21); v3 ^= v0; \
+    v2 += v1; v1 = ROTL(v1, 17); v1 ^= v2; v2 = ROTL(v2, 32); \
+} while(0)
+
+static uint64_t readLittle64(const uint8_t *bytes)
+{
+    uint64_t result = 0;
+
+    for(int i = 7; i >= 0; i--)
+        result = (result << 8) | bytes[i];
+
+    return result;
+}
+
+// SipHash-2-4
+static uint64_t siphash(uint64_t k0, uint64_t k1, const uint8_t *bytes, uint32_t length)
+{
+    uint64_t v0 = 0x736f6d6570736575ULL ^ k0;
+    uint64_t v1 = 0x646f72616e646f6dULL ^ k1;
+    uint64_t v2 = 0x6c7967656e657261ULL ^ k0;
+    uint64_t v3 = 0x7465646279746573ULL ^ k1;
+
+    uint32_t i = 0;
+
+    for(; i + 8 <= length; i += 8) {
+
+        uint64_t m = readLittle64(bytes + i);
+
+        v3 ^= m;
+        SIPROUND;
+        SIPROUND;
+        v0 ^= m;
+    }
+
+    uint64_t last = (uint64_t)length << 56;
+
+    for(uint32_t j = 0; i + j < length; j++)
+        last |= (uint64_t)bytes[i + j] << (8 * j);
+
+    v3 ^= last;
+    SIPROUND;
+    SIPROUND;
+    v0 ^= last;
+
+    v2 ^= 0xff;
+    SIPROUND;
+    SIPROUND;
+    SIPROUND;
+    SIPROUND;
+
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+// High 64 bits of a * b, without relying on 128 bit integers
+static uint64_t multiplyHigh(uint64_t a, uint64_t b)
+{
+    uint64_t aLow = (uint32_t)a, aHigh = a >> 32;
+    uint64_t bLow = (uint32_t)b, bHigh = b >> 32;
+
+    uint64_t lowLow = aLow * bLow;
+    uint64_t lowHigh = aLow * bHigh;
+    uint64_t highLow = aHigh * bLow;
+
+    uint64_t middle = (lowLow >> 32) + (uint32_t)lowHigh + (uint32_t)highLow;
+
+    return aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+}
+
+static int compareValues(const void *left, const void *right)
+{
+    uint64_t a = *(const uint64_t*)left;
+    uint64_t b = *(const uint64_t*)right;
+
+    return a < b ? -1 : a > b;
+}
+
+// The elements hashed into [0, 'range') and sorted
+static Data hashedValues(Data blockHash, Datas elements, uint64_t range)
+{
+    uint64_t k0 = readLittle64((uint8_t*)blockHash.bytes);
+    uint64_t k1 = readLittle64((uint8_t*)blockHash.bytes + 8);
+
+    Data result = DataNew(elements.count * sizeof(uint64_t));
+    uint64_t *values = (uint64_t*)result.bytes;
+
+    for(int i = 0; i < elements.count; i++)
+        values[i] = multiplyHigh(siphash(k0, k1, (uint8_t*)elements.ptr[i].bytes, elements.ptr[i].length), range);
+
+    qsort(values, elements.count, sizeof(uint64_t), compareValues);
+
+    return result;
+}
+
+typedef struct BitReader {
+
+    const uint8_t *ptr;
+    const uint8_t *end;
+
+    uint64_t buffer; // Unread bits from the top down, zeros below them
+    int bits;
+
+} BitReader;
+
+static void refill(BitReader *reader)
+{
+    while(reader->bits <= 56 && reader->ptr < reader->end) {
+
+        reader->buffer |= (uint64_t)*reader->ptr++ << (56 - reader->bits);
+        reader->bits += 8;
+    }
+}
+
+// Returns 0 if the data runs out. The unary quotient is counted a word at a time.
+static int readGolombRice(BitReader *reader, uint64_t *value)
+{
+    uint64_t quotient = 0;
+
+    for(;;) {
+
+        refill(reader);
+
+        if(!reader->bits)
+            return 0;
+
+        // Bits below the unread ones are zero, so this stops at 'bits'
+        int ones = ~reader->buffer ? __builtin_clzll(~reader->buffer) : 64;
+
+        quotient += ones;
+        reader->buffer = ones < 64 ? reader->buffer << ones : 0;
+        reader->bits -= ones;
+
+        if(reader->bits) {
+
+            reader->buffer <<= 1;
+            reader->bits--;
+            break;
+        }
+    }
+
+    refill(reader);
+
+    if(reader->bits < BLOCK_FILTER_P)
+        return 0;
+
+    uint64_t remainder = reader->buffer >> (64 - BLOCK_FILTER_P);
+
+    reader->buffer <<= BLOCK_FILTER_P;
+    reader->bits -= BLOCK_FILTER_P;
+
+    *value = (quotient << BLOCK_FILTER_P) + remainder;
+
+    return 1;
+}
+
+// Returns 0 if the element count runs past 'end'
+static int readElementCount(const uint8_t **ptr, const uint8_t *end, uint64_t *count)
+{
+    if(*ptr >= end)
+        return 0;
+
+    int size = **ptr < 253 ? 1 : **ptr == 253 ? 3 : **ptr == 254 ? 5 : 9;
+
+    if(end - *ptr < size)
+        return 0;
+
+    *count = readVarInt(ptr, end);
+
+    return 1;
+}
+
+typedef struct BitWriter {
+
+    Data data;
+    uint8_t current;
+    int bits;
+
+} BitWriter;
+
+static void writeBits(BitWriter *writer, uint64_t value, int count)
+{
+    for(int i = count - 1; i >= 0; i--) {
+
+        writer->current = (uint8_t)((writer->current << 1) | ((value >> i) & 1));
+
+        if(++writer->bits == 8) {
+
+            writer->data = DataAppend(writer->data, DataRef((char*)&writer->current, 1));
+            writer->current = 0;
+            writer->bits = 0;
+        }
+    }
+}
+
+Data BlockFilterBuild(Data blockHash, Datas elements)
+{
+    Datas unique = DatasNew();
+
+    FORDATAIN(element, elements)
+        if(element->length && !DatasHasMatchingData(unique, *element))
+            unique = DatasAddRef(unique, *element);
+
+    uint64_t range = (uint64_t)unique.count * BLOCK_FILTER_M;
+
+    Data values = hashedValues(blockHash, unique, range);
+
+    BitWriter writer = { .data = varIntD(unique.count) };
+
+    uint64_t last = 0;
+
+    for(int i = 0; i < unique.count; i++) {
+
+        uint64_t delta = ((uint64_t*)values.bytes)[i] - last;
+
+        last = ((uint64_t*)values.bytes)[i];
+
+        for(uint64_t quotient = delta >> BLOCK_FILTER_P; quotient; quotient--)
+            writeBits(&writer, 1, 1);
+
+        writeBits(&writer, 0, 1);
+        writeBits(&writer, delta, BLOCK_FILTER_P);
+    }
+
+    if(writer.bits)
+        writeBits(&writer, 0, 8 - writer.bits);
+
+    return writer.data;
+}
+
+int BlockFilterMatchAny(Data filter, Data blockHash, Datas elements)
+{
+    const uint8_t *ptr = (uint8_t*)filter.bytes;
+    const uint8_t *end = ptr + filter.length;
+
+    uint64_t count;
+
+    if(!readElementCount(&ptr, end, &count))
+        return 1;
+
+    if(!count || !elements.count)
+        return 0;
+
+    if(count > UINT32_MAX)
+        return 1;
+
+    Data queries = hashedValues(blockHash, elements, count * BLOCK_FILTER_M);
+    uint64_t *query = (uint64_t*)queries.bytes;
+    uint64_t *queryEnd = query + elements.count;
+
+    BitReader reader = { .ptr = ptr, .end = end };
+
+    uint64_t value = 0;
+
+    for(uint64_t i = 0; i < count; i++) {
+
+        uint64_t delta;
+
+        if(!readGolombRice(&reader, &delta))
+            return 1;
+
+        value += delta;
+
+        while(*query < value)
+            if(++query == queryEnd)
+                return 0;
+
+        if(*query == value)
+            return 1;
+    }
+
+    return 0;
+}
+
+int64_t BlockFilterElementCount(Data filter)
+{
+    const uint8_t *ptr = (uint8_t*)filter.bytes;
+    const uint8_t *end = ptr + filter.length;
+
+    uint64_t count;
+
+    if(!readElementCount(&ptr, end, &count) || count > UINT32_MAX)
+        return -1;
+
+    BitReader reader = { .ptr = ptr, .end = end };
+
+    for(uint64_t i = 0; i < count; i++) {
+
+        uint64_t delta;
+
+        if(!readGolombRice(&reader, &delta))
+            return -1;
+    }
+
+    return (int64_t)count;
+}
+
+Data BlockFilterHeader(Data filter, Data previousHeader)
+{
+    return hash256(DataAddCopy(hash256(filter), previousHeader));
+}
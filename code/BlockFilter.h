@@ -0,0 +1,27 @@
+#ifndef BLOCKFILTER_H
+#define BLOCKFILTER_H
+
+#include "Data.h"
+
+// BIP158 compact block filters. A filter is a Golomb-Rice coded set of the block's output scripts and
+// the scripts its inputs spend, hashed with a key from the block hash. Matching decodes the set once
+// and walks it alongside the sorted query hashes.
+
+#define BLOCK_FILTER_BASIC 0
+#define BLOCK_FILTER_P 19
+#define BLOCK_FILTER_M 784931
+
+// Filter of the distinct, non-empty 'elements'. 'blockHash' is 32 bytes in internal byte order.
+Data BlockFilterBuild(Data blockHash, Datas elements);
+
+// 1 if any of 'elements' is probably in 'filter' (false positives are about 1 in 784931 per element).
+// Malformed filters match everything, so the block gets checked rather than skipped.
+int BlockFilterMatchAny(Data filter, Data blockHash, Datas elements);
+
+// Number of elements in 'filter', -1 if malformed
+int64_t BlockFilterElementCount(Data filter);
+
+// The filter header committing to 'filter' and every filter below it, as carried by cfheaders
+Data BlockFilterHeader(Data filter, Data previousHeader);
+
+#endif
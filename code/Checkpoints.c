@@ -0,0 +1,70 @@
+#include "Checkpoints.h"
+#include "checkpoint_snapshot.h"
+#include "testnet_checkpoint_snapshot.h"
+#include <string.h>
+
+#define CHECKPOINTS_MAGIC "BSCP"
+#define CHECKPOINTS_PREAMBLE_SIZE 24
+#define CHECKPOINTS_HEADER_SIZE 80
+
+int CheckpointSnapshotParse(Data data, CheckpointSnapshot *result)
+{
+    if(data.length < CHECKPOINTS_PREAMBLE_SIZE || memcmp(data.bytes, CHECKPOINTS_MAGIC, 4))
+        return 0;
+
+    uint32_t *preamble = (uint32_t*)(data.bytes + 4);
+
+    if(preamble[0] != CHECKPOINTS_VERSION)
+        return 0;
+
+    uint64_t checkpointsLength = (uint64_t)preamble[2] * sizeof(Checkpoint);
+    uint64_t trustedLength = (uint64_t)preamble[4] * CHECKPOINTS_HEADER_SIZE;
+
+    if(CHECKPOINTS_PREAMBLE_SIZE + checkpointsLength + trustedLength != data.length)
+        return 0;
+
+    *result = (CheckpointSnapshot) { 0 };
+
+    result->testnet = preamble[1] ? 1 : 0;
+    result->checkpoints = DataRef(data.bytes + CHECKPOINTS_PREAMBLE_SIZE, (unsigned int)checkpointsLength);
+    result->trustedFirstHeight = (int32_t)preamble[3];
+    result->trustedHeaders = DataRef(data.bytes + CHECKPOINTS_PREAMBLE_SIZE + checkpointsLength, (unsigned int)trustedLength);
+
+    if(result->trustedHeaders.length && result->trustedFirstHeight < 0)
+        return 0;
+
+    Checkpoint *checkpoints = (Checkpoint*)result->checkpoints.bytes;
+
+    for(uint32_t i = 0; i < preamble[2]; i++)
+        if(checkpoints[i].height < 0 || (i && checkpoints[i].height <= checkpoints[i - 1].height))
+            return 0;
+
+    return 1;
+}
+
+Data CheckpointSnapshotEncode(CheckpointSnapshot *snapshot)
+{
+    uint32_t preamble[5] = {
+        CHECKPOINTS_VERSION,
+        snapshot->testnet ? 1 : 0,
+        snapshot->checkpoints.length / sizeof(Checkpoint),
+        (uint32_t)snapshot->trustedFirstHeight,
+        snapshot->trustedHeaders.length / CHECKPOINTS_HEADER_SIZE,
+    };
+
+    Data result = DataCopy(CHECKPOINTS_MAGIC, 4);
+
+    result = DataAppend(result, DataRaw(preamble));
+    result = DataAppend(result, DataRef(snapshot->checkpoints.bytes, preamble[2] * sizeof(Checkpoint)));
+    result = DataAppend(result, DataRef(snapshot->trustedHeaders.bytes, preamble[4] * CHECKPOINTS_HEADER_SIZE));
+
+    return result;
+}
+
+Data CheckpointSnapshotBundled(int testnet)
+{
+    if(testnet)
+        return DataRef((void*)initialTestnetCheckpoints, sizeof(initialTestnetCheckpoints));
+
+    return DataRef((void*)initialCheckpoints, sizeof(initialCheckpoints));
+}
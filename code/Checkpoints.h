@@ -0,0 +1,45 @@
+#ifndef CHECKPOINTS_H
+#define CHECKPOINTS_H
+
+#include "Data.h"
+
+// Binary snapshot of known block headers, loaded into a fresh database in place of syncing them.
+// Little endian layout:
+//   "BSCP", uint32 version, uint32 testnet, uint32 checkpoint count, int32 trusted first height, uint32 trusted count
+//   Checkpoint records ascending by height
+//   Trusted headers, 80 bytes each at consecutive heights from the trusted first height
+// Checkpoints are sparse and only carry what the header index needs. The trusted headers are a
+// contiguous run of full headers (usually ending near the snapshot's tip) so header sync can start
+// at the end of it instead of at the checkpoint before the wallet's creation date.
+
+#define CHECKPOINTS_VERSION 1
+
+typedef struct Checkpoint {
+
+    int32_t height;
+    uint8_t hash[32];
+    uint8_t merkleRoot[32];
+    uint32_t time;
+    uint32_t bits; // 0 if unknown, filled in from the checkpoint's own header before syncing past it
+
+} Checkpoint;
+
+typedef struct CheckpointSnapshot {
+
+    int testnet;
+
+    Data checkpoints; // Checkpoint array
+    int32_t trustedFirstHeight;
+    Data trustedHeaders; // 80 byte headers
+
+} CheckpointSnapshot;
+
+// Returns 0 if 'data' is malformed. The result refers into 'data', nothing is copied.
+int CheckpointSnapshotParse(Data data, CheckpointSnapshot *result);
+
+Data CheckpointSnapshotEncode(CheckpointSnapshot *snapshot);
+
+// The snapshot compiled in from checkpoint_snapshot.h or testnet_checkpoint_snapshot.h. Refers to static memory.
+Data CheckpointSnapshotBundled(int testnet);
+
+#endif
@@ -3,6 +3,8 @@
 #include <string.h>
 #include <ctype.h>
 #include <stdio.h>
+#include <pthread.h>
+#include "../libraries/murmur3/murmur3.h"
 
 #ifndef MIN
 #define MIN(a,b) (((a)<(b))?(a):(b))
@@ -31,8 +33,9 @@ static void *reallocf(void *ptr, size_t size)
 #endif
 
 static Data DatasMemory(Datas datas);
-static Datas DatasAddRefFlexible(Datas datas, Data data, int tracked, int isTrackingMemoryItself);
+static Datas DatasAddRefFlexible(Datas datas, Data data, int tracked);
 static void DatasFreeFlexible(Datas datas, int includingTracked);
+Data DataFreeFlexible(Data data, int untrack);
 static void DataDebugTrackingAdd(Data data);
 static void DataDebugTrackingRemove(Data data);
 
@@ -41,14 +44,261 @@ static int debugTrackerSize = 0;
 
 static volatile int allocatedCount = 0;
 
+#define DATA_ARENA_DEFAULT_SIZE (64 * 1024)
+#define DATA_ARENA_MIN_SIZE 1024
+#define DATA_ARENA_ALIGN(length) (((size_t)MAX((length), 1) + 15) & ~(size_t)15)
+
+typedef struct DataArenaChunk {
+    struct DataArenaChunk *next;
+    size_t size;
+    size_t used;
+    size_t padding; // Keeps 'bytes' 16 byte aligned
+    char bytes[];
+} DataArenaChunk;
+
+// An open addressing (linear probe) set of Data keyed by their 'bytes' pointer.
+// 'capacity' is zero or a power of 2 and is kept at least double 'count'.
+typedef struct TrackStack {
+    Data *slots;
+    uint32_t capacity;
+    uint32_t count;
+
+    // Only used by arena stacks (arenaChunkSize != 0). Newest chunk first.
+    DataArenaChunk *arena;
+    size_t arenaChunkSize;
+} TrackStack;
+
 static __thread struct {
-    Datas *datas;
+    TrackStack *stacks;
     int count;
-} trackStacks = { 0, 0 };
+    int capacity;
+    int arenaCount;
+} trackStacks = { 0, 0, 0, 0 };
+
+// Size of the block backing 'data'. Data that didn't come from here (DataRef etc) reports its length.
+static unsigned int DataCapacity(Data data)
+{
+    return data.capacity ? data.capacity : data.length;
+}
+
+// Geometric growth (1.5x, 16 byte multiples) so repeated appends are amortized O(1).
+static unsigned int DataGrowCapacity(unsigned int capacity, unsigned int length)
+{
+    uint64_t grown = ((uint64_t)MAX(length, capacity + capacity / 2) + 15) & ~(uint64_t)15;
+
+    return (unsigned int)MIN(grown, UINT32_MAX);
+}
+
+// Small Data (hashes, ints, varints...) comes from per-thread free lists of 16, 32, 48 and 64 byte blocks.
+// Pool blocks are ordinary malloc blocks of exactly 'DATA_POOL_CLASS_SIZE(length)' bytes, so realloc &
+// free on them stay valid and a block may be released on a different thread than it was made on.
+#define DATA_POOL_CLASS_COUNT 4
+#define DATA_POOL_MAX_LENGTH (16 * DATA_POOL_CLASS_COUNT)
+#define DATA_POOL_MAX_DEPTH 512
+#define DATA_POOL_CLASS(length) ((MAX((length), 1) - 1) / 16)
+#define DATA_POOL_CLASS_SIZE(length) ((DATA_POOL_CLASS(length) + 1) * 16)
+
+typedef struct DataPoolBlock {
+    struct DataPoolBlock *next;
+} DataPoolBlock;
+
+static __thread struct {
+    DataPoolBlock *blocks[DATA_POOL_CLASS_COUNT];
+    int counts[DATA_POOL_CLASS_COUNT];
+    int registered;
+} dataPool = { { 0 }, { 0 }, 0 };
+
+static pthread_key_t dataPoolKey;
+static pthread_once_t dataPoolKeyOnce = PTHREAD_ONCE_INIT;
+
+static void DataPoolDrain(void *unused)
+{
+    for(int i = 0; i < DATA_POOL_CLASS_COUNT; i++) {
+
+        while(dataPool.blocks[i]) {
+
+            DataPoolBlock *block = dataPool.blocks[i];
+
+            dataPool.blocks[i] = block->next;
+
+            free(block);
+        }
+
+        dataPool.counts[i] = 0;
+    }
+}
+
+static void DataPoolKeyCreate()
+{
+    pthread_key_create(&dataPoolKey, DataPoolDrain);
+}
+
+static char *DataPoolAlloc(unsigned int length)
+{
+    int index = DATA_POOL_CLASS(length);
+    DataPoolBlock *block = dataPool.blocks[index];
+
+    if(!block)
+        return malloc(DATA_POOL_CLASS_SIZE(length));
+
+    dataPool.blocks[index] = block->next;
+    dataPool.counts[index]--;
+
+    return (char*)block;
+}
+
+// 'length' must not be more than the size the block was allocated with.
+static void DataPoolFree(char *bytes, unsigned int length)
+{
+    int index = DATA_POOL_CLASS(length);
+
+    if(!bytes || length > DATA_POOL_MAX_LENGTH || dataPool.counts[index] >= DATA_POOL_MAX_DEPTH) {
+
+        free(bytes);
+        return;
+    }
+
+    // Drain this thread's pool when it exits
+    if(!dataPool.registered) {
+
+        pthread_once(&dataPoolKeyOnce, DataPoolKeyCreate);
+        pthread_setspecific(dataPoolKey, &dataPool);
+
+        dataPool.registered = 1;
+    }
+
+    DataPoolBlock *block = (DataPoolBlock*)bytes;
+
+    block->next = dataPool.blocks[index];
+
+    dataPool.blocks[index] = block;
+    dataPool.counts[index]++;
+}
+
+// Moves 'data' to a 'capacity' byte block, between pool classes or in / out of the pool. Both sizes must be non zero.
+static char *DataPoolRealloc(Data data, unsigned int capacity)
+{
+    unsigned int oldCapacity = DataCapacity(data);
+
+    if(oldCapacity > DATA_POOL_MAX_LENGTH && capacity > DATA_POOL_MAX_LENGTH)
+        return reallocf(data.bytes, capacity);
+
+    if(oldCapacity <= DATA_POOL_MAX_LENGTH && capacity <= DATA_POOL_MAX_LENGTH && DATA_POOL_CLASS(oldCapacity) == DATA_POOL_CLASS(capacity))
+        return data.bytes;
+
+    // Growing out of the pool -- pool blocks are plain malloc blocks so realloc may extend in place
+    if(capacity > DATA_POOL_MAX_LENGTH)
+        return reallocf(data.bytes, capacity);
+
+    char *bytes = DataPoolAlloc(capacity);
+
+    if(bytes)
+        memcpy(bytes, data.bytes, MIN(data.length, capacity));
+
+    DataPoolFree(data.bytes, oldCapacity);
+
+    return bytes;
+}
+
+// Returns the index of the track stack whose arena holds 'bytes' or -1 if it isn't arena memory.
+static int DataArenaIndex(const void *bytes)
+{
+    if(!trackStacks.arenaCount || !bytes)
+        return -1;
+
+    for(int i = trackStacks.count - 1; i >= 0; i--)
+        for(DataArenaChunk *chunk = trackStacks.stacks[i].arena; chunk; chunk = chunk->next)
+            if((const char*)bytes >= chunk->bytes && (const char*)bytes < chunk->bytes + chunk->size)
+                return i;
+
+    return -1;
+}
+
+static char *DataArenaAlloc(TrackStack *stack, unsigned int length)
+{
+    size_t needed = DATA_ARENA_ALIGN(length);
+    DataArenaChunk *chunk = stack->arena;
+
+    if(!chunk || chunk->size - chunk->used < needed) {
+
+        size_t size = MAX(chunk ? chunk->size * 2 : stack->arenaChunkSize, needed);
+
+        chunk = malloc(sizeof(DataArenaChunk) + size);
+
+        if(!chunk)
+            abort();
+
+        DATA_LOG("arena-malloc(%d) = %p\n", (int)size, chunk);
+
+        chunk->next = stack->arena;
+        chunk->size = size;
+        chunk->used = 0;
+
+        stack->arena = chunk;
+    }
+
+    char *bytes = chunk->bytes + chunk->used;
+
+    chunk->used += needed;
+
+    return bytes;
+}
+
+// The most recent allocation in an arena is resized in place when it fits, otherwise it is copied.
+static char *DataArenaRealloc(TrackStack *stack, Data data, unsigned int length)
+{
+    DataArenaChunk *chunk = stack->arena;
+
+    size_t oldSize = DATA_ARENA_ALIGN(DataCapacity(data));
+    size_t newSize = DATA_ARENA_ALIGN(length);
+
+    if(data.bytes + oldSize == chunk->bytes + chunk->used && chunk->used - oldSize + newSize <= chunk->size) {
+
+        chunk->used = chunk->used - oldSize + newSize;
+
+        return data.bytes;
+    }
+
+    char *bytes = DataArenaAlloc(stack, length);
+
+    memcpy(bytes, data.bytes, MIN(data.length, length));
+
+    return bytes;
+}
+
+// Arena stacks hand out arena memory, all others (and 'stack' NULL) use the small pool or malloc.
+// The usable size of the returned block is stored in 'capacity'.
+static char *DataAllocBytes(TrackStack *stack, unsigned int length, uint32_t *capacity)
+{
+    if(stack && stack->arenaChunkSize) {
+
+        *capacity = (uint32_t)DATA_ARENA_ALIGN(length);
+        return DataArenaAlloc(stack, length);
+    }
+
+    if(length <= DATA_POOL_MAX_LENGTH) {
+
+        *capacity = DATA_POOL_CLASS_SIZE(length);
+        return DataPoolAlloc(length);
+    }
+
+    *capacity = length;
+    return malloc(length);
+}
+
+static TrackStack *DataAllocStack(int tracked)
+{
+    if(!tracked || !trackStacks.count)
+        return NULL;
+
+    return &trackStacks.stacks[trackStacks.count - 1];
+}
 
 static Data DataNewFlexible(unsigned int length, int tracked)
 {
-    Data data = { malloc(length), length};
+    Data data = { NULL, length, 0 };
+
+    data.bytes = DataAllocBytes(DataAllocStack(tracked), length, &data.capacity);
 
     DATA_LOG("malloc(%d) = %p\n", length, data.bytes);
 
@@ -87,7 +337,7 @@ Data DataZero(unsigned int length)
 
 Data DataNull()
 {
-    Data data = { NULL, 0 };
+    Data data = { NULL, 0, 0 };
 
     return data;
 }
@@ -215,7 +465,7 @@ Data DataRef(void *bytesPtr, unsigned int length)
 {
     char *bytes = bytesPtr;
 
-    return (Data){ bytes, length };
+    return (Data){ bytes, length, 0 };
 }
 
 Data DataTrimFront(Data data, unsigned int removalCount)
@@ -254,53 +504,96 @@ Data DataDelete(Data data, unsigned int start, unsigned int length)
     return DataShrink(data, length);
 }
 
-static Data DataResizeFlexible(Data data, unsigned int length, int tracked, int isTrackingMemoryItself)
+// Moves 'data' to a block of at least 'capacity' bytes, truncating 'length' if needed. 0 releases the block.
+static Data DataSetCapacity(Data data, unsigned int capacity, int tracked)
 {
-    if(data.length == length)
-        return data;
-
     Data oldData = data;
 
-    if(!length) {
+    int arenaIndex = DataArenaIndex(data.bytes);
+
+    if(!capacity) {
+
+        if(arenaIndex < 0)
+            DataPoolFree(data.bytes, DataCapacity(data));
+
+        data = DataNull();
+    }
+    else if(arenaIndex >= 0) {
+
+        data.bytes = DataArenaRealloc(&trackStacks.stacks[arenaIndex], data, capacity);
+        data.capacity = (uint32_t)DATA_ARENA_ALIGN(capacity);
+    }
+    else if(!data.bytes) {
 
-        free(data.bytes);
-        data.bytes = NULL;
+        data.bytes = DataAllocBytes(DataAllocStack(tracked), capacity, &data.capacity);
     }
     else {
 
-        data.bytes = reallocf(data.bytes, length);
+        data.bytes = DataPoolRealloc(data, capacity);
+        data.capacity = capacity <= DATA_POOL_MAX_LENGTH ? DATA_POOL_CLASS_SIZE(capacity) : capacity;
     }
 
+    data.length = MIN(data.length, data.capacity);
+
     DataDebugTrackingRemove(oldData);
 
     if(data.bytes)
         DataDebugTrackingAdd(data);
 
-    DATA_LOG("reallocf(%p, %d, tracked: %d) = %p\n", oldData.bytes, length, tracked, data.bytes);
+    DATA_LOG("reallocf(%p, %d, tracked: %d) = %p\n", oldData.bytes, capacity, tracked, data.bytes);
 
     if(!oldData.bytes && data.bytes)
         __sync_add_and_fetch(&allocatedCount, 1);
 
-    // Debug aide -- set memory to 666666 when added view resize.
-    if(length > data.length)
-        memset(data.bytes + data.length, 0x66, length - data.length);
-
-    data.length = length;
+    if(oldData.bytes && !data.bytes)
+        __sync_sub_and_fetch(&allocatedCount, 1);
 
-    if(trackStacks.count > 0 && oldData.bytes != data.bytes) {
+    // Track entries are refreshed even when the block didn't move so DataTrackPop frees with the right size
+    if(trackStacks.count > 0) {
 
         if(tracked && !oldData.bytes)
             return DataTrack(data);
-        else if(!isTrackingMemoryItself && DataIsTracked(oldData))
+        else if(oldData.bytes && DataIsTracked(oldData))
             return DataReplaceTrack(oldData, data);
     }
 
     return data;
 }
 
+static Data DataResizeFlexible(Data data, unsigned int length, int tracked)
+{
+    if(data.length == length)
+        return data;
+
+    unsigned int capacity = data.bytes ? DataCapacity(data) : 0;
+
+    if(!length)
+        data = DataSetCapacity(data, 0, tracked);
+    else if(length > capacity)
+        data = DataSetCapacity(data, data.bytes ? DataGrowCapacity(capacity, length) : length, tracked);
+    else if(length < data.length && length < capacity / 4 && capacity > DATA_POOL_MAX_LENGTH)
+        data = DataSetCapacity(data, length, tracked);
+
+    // Debug aide -- set memory to 666666 when added view resize.
+    if(length > data.length)
+        memset(data.bytes + data.length, 0x66, length - data.length);
+
+    data.length = length;
+
+    return data;
+}
+
+Data DataReserve(Data data, unsigned int capacity)
+{
+    if(data.bytes && capacity <= DataCapacity(data))
+        return data;
+
+    return DataSetCapacity(data, MAX(capacity, data.length), 1);
+}
+
 Data DataResize(Data data, unsigned int length)
 {
-    return DataResizeFlexible(data, length, 1, 0);
+    return DataResizeFlexible(data, length, 1);
 }
 
 Data DataGrow(Data data, unsigned int addedLength)
@@ -441,38 +734,144 @@ void DataDebugTrackingEnd()
     debugTrackerSize = 0;
 }
 
-static Datas currentTrackStack()
+static TrackStack *currentTrackStack()
 {
     if(!trackStacks.count)
         abort();
 
-    return trackStacks.datas[trackStacks.count - 1];
+    return &trackStacks.stacks[trackStacks.count - 1];
+}
+
+static uint32_t TrackStackHash(const void *bytes, uint32_t mask)
+{
+    return (uint32_t)(((uint64_t)(uintptr_t)bytes * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+}
+
+static Data *TrackStackFind(TrackStack *stack, const void *bytes)
+{
+    if(!stack->count || !bytes)
+        return NULL;
+
+    uint32_t mask = stack->capacity - 1;
+
+    for(uint32_t i = TrackStackHash(bytes, mask);; i = (i + 1) & mask) {
+
+        if(stack->slots[i].bytes == bytes)
+            return &stack->slots[i];
+
+        if(!stack->slots[i].bytes)
+            return NULL;
+    }
+}
+
+static void TrackStackInsert(TrackStack *stack, Data data)
+{
+    uint32_t mask = stack->capacity - 1;
+    uint32_t i = TrackStackHash(data.bytes, mask);
+
+    while(stack->slots[i].bytes) {
+
+        if(stack->slots[i].bytes == data.bytes)
+            abort(); // Data is already tracked
+
+        i = (i + 1) & mask;
+    }
+
+    stack->slots[i] = data;
+    stack->count++;
 }
 
-static void setCurrentTrackStack(Datas datas)
+static void TrackStackAdd(TrackStack *stack, Data data)
 {
-    trackStacks.datas[trackStacks.count - 1] = datas;
+    if((stack->count + 1) * 2 > stack->capacity) {
+
+        TrackStack grown = { NULL, stack->capacity ? stack->capacity * 2 : 16, 0, NULL, 0 };
+
+        grown.slots = calloc(grown.capacity, sizeof(Data));
+
+        if(!grown.slots)
+            abort();
+
+        for(uint32_t i = 0; i < stack->capacity; i++)
+            if(stack->slots[i].bytes)
+                TrackStackInsert(&grown, stack->slots[i]);
+
+        DATA_LOG("TrackStack-grow(%p, %d) = %p\n", stack->slots, grown.capacity, grown.slots);
+
+        free(stack->slots);
+
+        stack->slots = grown.slots;
+        stack->capacity = grown.capacity;
+        stack->count = grown.count;
+    }
+
+    TrackStackInsert(stack, data);
+}
+
+// Returns 1 if 'bytes' was found & removed. Uses backward shift deletion so no tombstones are needed.
+static int TrackStackRemove(TrackStack *stack, const void *bytes)
+{
+    Data *slot = TrackStackFind(stack, bytes);
+
+    if(!slot)
+        return 0;
+
+    uint32_t mask = stack->capacity - 1;
+    uint32_t hole = (uint32_t)(slot - stack->slots);
+
+    for(uint32_t i = (hole + 1) & mask; stack->slots[i].bytes; i = (i + 1) & mask) {
+
+        uint32_t home = TrackStackHash(stack->slots[i].bytes, mask);
+
+        if(((i - home) & mask) >= ((i - hole) & mask)) {
+
+            stack->slots[hole] = stack->slots[i];
+            hole = i;
+        }
+    }
+
+    stack->slots[hole] = DataNull();
+    stack->count--;
+
+    return 1;
 }
 
 void DataTrackPush()
 {
-    trackStacks.count++;
+    if(trackStacks.count == trackStacks.capacity) {
 
-    void *oldPtr = trackStacks.datas;
+        void *oldPtr = trackStacks.stacks;
 
-    trackStacks.datas = reallocf(trackStacks.datas, sizeof(Datas) * trackStacks.count);
+        trackStacks.capacity = trackStacks.capacity ? trackStacks.capacity * 2 : 4;
+        trackStacks.stacks = reallocf(trackStacks.stacks, sizeof(TrackStack) * trackStacks.capacity);
 
-    DataDebugTrackingRemove(DataRef(oldPtr, 0));
-    DataDebugTrackingAdd(DataRef(trackStacks.datas, sizeof(Datas) * trackStacks.count));
+        if(!trackStacks.stacks)
+            abort();
 
-    DATA_LOG("trackStacks-reallocf(%p, %d) = %p\n", oldPtr, (int)(sizeof(Datas) * trackStacks.count), trackStacks.datas);
+        DataDebugTrackingRemove(DataRef(oldPtr, 0));
+        DataDebugTrackingAdd(DataRef(trackStacks.stacks, sizeof(TrackStack) * trackStacks.capacity));
 
-    if(!oldPtr && trackStacks.datas)
-        __sync_add_and_fetch(&allocatedCount, 1);
+        DATA_LOG("trackStacks-reallocf(%p, %d) = %p\n", oldPtr, (int)(sizeof(TrackStack) * trackStacks.capacity), trackStacks.stacks);
+
+        if(!oldPtr)
+            __sync_add_and_fetch(&allocatedCount, 1);
+
+        for(int i = trackStacks.count; i < trackStacks.capacity; i++)
+            trackStacks.stacks[i] = (TrackStack){ NULL, 0, 0, NULL, 0 };
+    }
+
+    trackStacks.count++;
+
+    DATA_LOG("DataTrackPush(%d)\n", trackStacks.count);
+}
+
+void DataTrackPushArena(unsigned int sizeHint)
+{
+    DataTrackPush();
 
-    setCurrentTrackStack(DatasNew());
+    currentTrackStack()->arenaChunkSize = sizeHint ? MAX(sizeHint, DATA_ARENA_MIN_SIZE) : DATA_ARENA_DEFAULT_SIZE;
 
-    DATA_LOG("DataTrackPush(%p)\n", currentTrackStack().ptr);
+    trackStacks.arenaCount++;
 }
 
 Data DataTrack(Data data)
@@ -482,10 +881,7 @@ Data DataTrack(Data data)
 
     if(trackStacks.count > 0) {
 
-        if(DatasHasData(currentTrackStack(), data))
-            abort();
-
-        setCurrentTrackStack(DatasAddRefFlexible(currentTrackStack(), data, 0, 1));
+        TrackStackAdd(currentTrackStack(), data);
 
         DATA_LOG("DataTrack(%p)\n", data.bytes);
     }
@@ -498,22 +894,18 @@ int DataIsTracked(Data data)
     if(trackStacks.count < 1)
         return 0;
 
-    return DatasHasData(currentTrackStack(), data);
+    return TrackStackFind(currentTrackStack(), data.bytes) != NULL;
 }
 
 Data DataReplaceTrack(Data oldData, Data newData)
 {
     DATA_LOG("DataReplaceTrack(%p, %p)\n", oldData.bytes, newData.bytes);
 
-    if(!DatasHasData(currentTrackStack(), oldData))
+    if(!TrackStackRemove(currentTrackStack(), oldData.bytes))
         abort();
 
-    Datas datas = DatasReplaceData(currentTrackStack(), oldData, newData);
-
-    if(!DatasHasData(currentTrackStack(), newData))
-        abort();
-
-    setCurrentTrackStack(datas);
+    if(newData.bytes)
+        TrackStackAdd(currentTrackStack(), newData);
 
     return newData;
 }
@@ -530,8 +922,12 @@ void DatasPrintAll(Datas datas)
 
 Data DataUntrack(Data data)
 {
+    // Arena memory can't outlive its scope. Use DataTranscend or DTPop instead.
+    if(DataArenaIndex(data.bytes) >= 0)
+        abort();
+
     if(trackStacks.count > 0)
-        setCurrentTrackStack(DatasRemoveTake(currentTrackStack(), data));
+        TrackStackRemove(currentTrackStack(), data.bytes);
 
     return data;
 }
@@ -547,17 +943,31 @@ Data DataTranscend(Data data)
         return data;
 
     if(trackStacks.count > 0)
-        setCurrentTrackStack(DatasRemoveTake(currentTrackStack(), data));
+        TrackStackRemove(currentTrackStack(), data.bytes);
+
+    // Arena memory goes away with its scope so survivors are copied out to the senior scope
+    if(trackStacks.count > 0 && DataArenaIndex(data.bytes) == trackStacks.count - 1) {
+
+        TrackStack *senior = trackStacks.count > 1 ? &trackStacks.stacks[trackStacks.count - 2] : NULL;
+
+        Data copy = { NULL, data.length, 0 };
+
+        copy.bytes = DataAllocBytes(senior, data.length, &copy.capacity);
+
+        memcpy(copy.bytes, data.bytes, data.length);
 
-    if(trackStacks.count > 1) {
+        __sync_add_and_fetch(&allocatedCount, 1);
 
-        Datas datas = trackStacks.datas[trackStacks.count - 2];
+        DataDebugTrackingAdd(copy);
 
-        datas = DatasAddRefFlexible(datas, data, 0, 0);
+        DataFreeFlexible(data, 0);
 
-        trackStacks.datas[trackStacks.count - 2] = datas;
+        data = copy;
     }
 
+    if(trackStacks.count > 1)
+        TrackStackAdd(&trackStacks.stacks[trackStacks.count - 2], data);
+
     return data;
 }
 
@@ -566,37 +976,63 @@ void DataTrackPop()
     if(trackStacks.count < 1)
         abort(); // More data track pops than pushes.
 
-    DATA_LOG("DataTrackPop(%p)\n", currentTrackStack().ptr);
+    TrackStack *stack = currentTrackStack();
 
-    DatasFreeFlexible(currentTrackStack(), 1);
+    DATA_LOG("DataTrackPop(%d, %d items)\n", trackStacks.count, stack->count);
 
-    trackStacks.count--;
+    for(uint32_t i = 0; i < stack->capacity && stack->count; i++) {
 
-    if(!trackStacks.datas)
-        abort();
+        if(stack->slots[i].bytes) {
 
-    if(trackStacks.count == 0) {
+            DataFreeFlexible(stack->slots[i], 0);
 
-        __sync_sub_and_fetch(&allocatedCount, 1);
+            stack->slots[i] = DataNull();
+            stack->count--;
+        }
+    }
+
+    if(stack->arenaChunkSize) {
 
-        DATA_LOG("DataTrack-free(%p)\n", trackStacks.datas);
+        while(stack->arena) {
 
-        free(trackStacks.datas);
+            DataArenaChunk *next = stack->arena->next;
 
-        DataDebugTrackingRemove(DataRef(trackStacks.datas, 0));
+            DATA_LOG("arena-free(%p)\n", stack->arena);
 
-        trackStacks.datas = NULL;
+            free(stack->arena);
+
+            stack->arena = next;
+        }
+
+        stack->arenaChunkSize = 0;
+        trackStacks.arenaCount--;
     }
-    else {
 
-        void *oldPtr = trackStacks.datas;
+    // Small tables are kept around to be reused by the next push at this depth
+    if(stack->capacity > 4096) {
 
-        trackStacks.datas = reallocf(trackStacks.datas, sizeof(Datas) * trackStacks.count);
+        free(stack->slots);
 
-        DataDebugTrackingRemove(DataRef(oldPtr, 0));
-        DataDebugTrackingAdd(DataRef(oldPtr, sizeof(Datas) * trackStacks.count));
+        *stack = (TrackStack){ NULL, 0, 0, NULL, 0 };
+    }
+
+    trackStacks.count--;
+
+    if(trackStacks.count == 0) {
+
+        __sync_sub_and_fetch(&allocatedCount, 1);
 
-        DATA_LOG("DataTrack-reallocf(%p, %d) = %p\n", oldPtr, (int)(sizeof(Datas) * trackStacks.count), trackStacks.datas);
+        DATA_LOG("DataTrack-free(%p)\n", trackStacks.stacks);
+
+        for(int i = 0; i < trackStacks.capacity; i++)
+            free(trackStacks.stacks[i].slots);
+
+        free(trackStacks.stacks);
+
+        DataDebugTrackingRemove(DataRef(trackStacks.stacks, 0));
+
+        trackStacks.stacks = NULL;
+        trackStacks.capacity = 0;
     }
 }
 
@@ -605,7 +1041,7 @@ int DataTrackCount()
     if(trackStacks.count < 1)
         return 0;
 
-    return currentTrackStack().count;
+    return currentTrackStack()->count;
 }
 
 Data DTPush(Data data)
@@ -617,29 +1053,19 @@ Data DTPush(Data data)
 
 Data DTPop(Data data)
 {
-    DataUntrack(data);
+    data = DataTranscend(data);
 
     DataTrackPop();
 
-    DataTrack(data);
-
     return data;
 }
 
 Datas DTPopDatas(Datas datas)
 {
-    for(int i = 0; i < datas.count; i++)
-        DataUntrack(datas.ptr[i]);
-
-    DataUntrack(DatasMemory(datas));
+    datas = DatasTranscend(datas);
 
     DataTrackPop();
 
-    DataTrack(DatasMemory(datas));
-
-    for(int i = 0; i < datas.count; i++)
-        DataTrack(datas.ptr[i]);
-
     return datas;
 }
 
@@ -659,18 +1085,8 @@ Data DTPopNull()
 
 Data DataFreeFlexible(Data data, int untrack)
 {
-    if(trackStacks.count > 0)
-        if(DatasHasData(currentTrackStack(), data) > 1)
-            abort();
-
-    if(untrack) {
-        
-        DataUntrack(data);
-
-        if(trackStacks.count > 0)
-            if(DatasHasData(currentTrackStack(), data))
-                abort();
-    }
+    if(untrack && trackStacks.count > 0)
+        TrackStackRemove(currentTrackStack(), data.bytes);
 
     if(data.bytes)
         __sync_sub_and_fetch(&allocatedCount, 1);
@@ -679,7 +1095,9 @@ Data DataFreeFlexible(Data data, int untrack)
 
     memset(data.bytes, 0x55, data.length);
 
-    free(data.bytes);
+    // Arena memory is released all at once by DataTrackPop
+    if(DataArenaIndex(data.bytes) < 0)
+        DataPoolFree(data.bytes, DataCapacity(data));
 
     DataDebugTrackingRemove(data);
 
@@ -696,16 +1114,40 @@ Data DataFree(Data data)
 
 static Data DatasMemory(Datas datas)
 {
-    return (Data){ (void*)datas.ptr, datas.count * sizeof(Data) };
+    return (Data){ (void*)datas.ptr, datas.count * sizeof(Data), datas.capacity * sizeof(Data) };
+}
+
+static Datas DatasSetMemory(Datas datas, Data memory)
+{
+    datas.ptr = (void*)memory.bytes;
+    datas.capacity = memory.capacity / sizeof(Data);
+
+    return datas;
+}
+
+static Datas DatasResizeFlexible(Datas datas, uint32_t count, int tracked)
+{
+    datas = DatasSetMemory(datas, DataResizeFlexible(DatasMemory(datas), sizeof(Data) * count, tracked));
+    datas.count = count;
+
+    return datas;
 }
 
 Datas DatasNew()
 {
-    Datas datas = { NULL, 0 };
+    Datas datas = { NULL, 0, 0 };
 
     return datas;
 }
 
+Datas DatasReserve(Datas datas, unsigned int capacity)
+{
+    if(datas.ptr && capacity <= datas.capacity)
+        return datas;
+
+    return DatasSetMemory(datas, DataReserve(DatasMemory(datas), sizeof(Data) * capacity));
+}
+
 Datas DatasNull()
 {
     return DatasOneCopy(DataNull());
@@ -753,7 +1195,7 @@ Datas DatasTrack(Datas datas)
 {
     if(!datas.count) {
 
-        datas.ptr = (void*)DataResizeFlexible(DatasMemory(datas), 0, 0, 0).bytes;
+        datas.ptr = (void*)DataResizeFlexible(DatasMemory(datas), 0, 0).bytes;
     }
     else {
 
@@ -770,7 +1212,7 @@ Datas DatasUntrack(Datas datas)
 {
     if(!datas.count) {
 
-        datas.ptr = (void*)DataResizeFlexible(DatasMemory(datas), 0, 0, 0).bytes;
+        datas.ptr = (void*)DataResizeFlexible(DatasMemory(datas), 0, 0).bytes;
     }
     else {
 
@@ -869,15 +1311,12 @@ Datas DatasAddCopy(Datas datas, Data data)
     return DatasAddRef(datas, DataCopyData(data));
 }
 
-static Datas DatasAddRefFlexible(Datas datas, Data data, int tracked, int isTrackingMemoryItself)
+static Datas DatasAddRefFlexible(Datas datas, Data data, int tracked)
 {
     if(!tracked && DatasHasData(datas, data))
         abort();
 
-    int newCount = datas.count + 1;
-
-    datas.ptr = (void*)DataResizeFlexible(DatasMemory(datas), sizeof(Data) * newCount, tracked, isTrackingMemoryItself).bytes;
-    datas.count = newCount;
+    datas = DatasResizeFlexible(datas, datas.count + 1, tracked);
 
     datas.ptr[datas.count - 1] = data;
 
@@ -886,7 +1325,7 @@ static Datas DatasAddRefFlexible(Datas datas, Data data, int tracked, int isTrac
 
 Datas DatasAddRef(Datas datas, Data data)
 {
-    return DatasAddRefFlexible(datas, data, 1, 0);
+    return DatasAddRefFlexible(datas, data, 1);
 }
 
 Datas DatasAddCopyIndex(Datas datas, Data data, int index)
@@ -898,7 +1337,7 @@ static Datas DatasAddRefIndexFlexible(Datas datas, Data data, int index, int tra
 {
     int oldCount = datas.count;
 
-    datas = DatasAddRefFlexible(datas, DataNull(), tracked, 0);
+    datas = DatasAddRefFlexible(datas, DataNull(), tracked);
 
     DATA_LOG("memmove(%p, %p, %d)\n", datas.ptr + index + 1, datas.ptr + index, (int)(sizeof(Data) * (oldCount - index)));
 
@@ -921,7 +1360,7 @@ Datas DatasAddCopyFront(Datas datas, Data data)
 
 Datas DatasAddRefFront(Datas datas, Data data)
 {
-    datas = DatasAddRefFlexible(datas, DataNull(), 1, 0);
+    datas = DatasAddRefFlexible(datas, DataNull(), 1);
 
     memmove(datas.ptr + 1, datas.ptr, sizeof(Data) * (datas.count - 1));
 
@@ -978,12 +1417,8 @@ Datas DatasRemoveTake(Datas datas, Data data)
     if(removedCount > 1)
         abort();
 
-    if(removedCount) {
-
-        datas.count = datas.count - removedCount;
-
-        datas.ptr = (void*)DataResize(DatasMemory(datas), sizeof(Data) * datas.count).bytes;
-    }
+    if(removedCount)
+        datas = DatasResizeFlexible(datas, datas.count - removedCount, 1);
 
     return datas;
 }
@@ -1013,8 +1448,7 @@ Datas DatasRemoveIndexTake(Datas datas, int i)
 
     memmove(datas.ptr + i, datas.ptr + i + 1, sizeof(Data) * (datas.count - i - 1));
 
-    datas.count = datas.count - 1;
-    datas.ptr = (void*)DataResize(DatasMemory(datas), sizeof(Data) * datas.count).bytes;
+    datas = DatasResizeFlexible(datas, datas.count - 1, 1);
 
     return datas;
 }
@@ -1044,64 +1478,66 @@ Datas DatasTranscend(Datas datas)
     for(int i = 0; i < datas.count; i++)
         datas.ptr[i] = DataTranscend(datas.ptr[i]);
 
-    DataTranscend(DatasMemory(datas));
+    datas = DatasSetMemory(datas, DataTranscend(DatasMemory(datas)));
 
     return datas;
 }
 
-static __thread int (*dataCompareCallback)(Data dataA, Data dataB) = NULL;
-static __thread const void *dataCompareLastTouchedPtr = NULL;
-static __thread int dataCompareLastResult = 0;
+DATAS_SORTED_DEFINE(DatasGeneric, DataCompareFunc, context(*a, *b))
+DATAS_SORTED_DEFINE(DatasHash, int, memcmp(a->bytes, b->bytes, 32))
+DATAS_SORTED_DEFINE(DatasInt, int, (*(int32_t*)a->bytes > *(int32_t*)b->bytes) - (*(int32_t*)a->bytes < *(int32_t*)b->bytes))
+DATAS_SORTED_DEFINE(DictionaryKeys, DataCompareFunc, context(((DictionaryElement*)a->bytes)->key, ((DictionaryElement*)b->bytes)->key))
 
-static int compareDatas(const void *a, const void *b)
+Datas DatasSort(Datas datas, int (*compare)(Data dataA, Data dataB))
 {
-    dataCompareLastTouchedPtr = b;
-
-    int result = dataCompareCallback(*(Data*)a, *(Data*)b);
-
-    dataCompareLastResult = result;
-
-    return result;
+    return DatasGenericSort(datas, compare ?: DataCompare);
 }
 
-Datas DatasSort(Datas datas, int (*compare)(Data dataA, Data dataB))
+int DatasSearchIndex(Datas datas, Data key, int (*compare)(Data dataA, Data dataB))
 {
-    if(dataCompareCallback)
-        abort();
-
-    dataCompareCallback = compare ?: DataCompare;
+    return DatasGenericIndex(datas, &key, compare ?: DataCompare);
+}
 
-    qsort(datas.ptr, datas.count, sizeof(Data), compareDatas);
+int DatasSearchInsertIndex(Datas datas, Data key, int (*compare)(Data dataA, Data dataB))
+{
+    return DatasGenericLowerBound(datas, &key, compare ?: DataCompare);
+}
 
-    dataCompareCallback = NULL;
+Data DatasSearch(Datas datas, Data key, int (*compare)(Data dataA, Data dataB))
+{
+    int index = DatasSearchIndex(datas, key, compare);
 
-    return datas;
+    return index < 0 ? DataNull() : datas.ptr[index];
 }
 
-Data *DatasSearchFlexible(Datas datas, Data key, int (*compare)(Data dataA, Data dataB))
+int DatasSearchCheck(Datas datas, Data key, int (*compare)(Data dataA, Data dataB))
 {
-    if(dataCompareCallback)
-        abort();
-
-    dataCompareCallback = compare ?: DataCompare;
+    return DatasSearchIndex(datas, key, compare) >= 0;
+}
 
-    Data *value = bsearch(&key, datas.ptr, datas.count, sizeof(Data), compareDatas);
+Datas DatasSortHashes(Datas datas)
+{
+    return DatasHashSort(datas, 0);
+}
 
-    dataCompareCallback = NULL;
+int DatasSearchHashIndex(Datas datas, Data hash)
+{
+    if(hash.length != 32)
+        return -1;
 
-    return value;
+    return DatasHashIndex(datas, &hash, 0);
 }
 
-Data DatasSearch(Datas datas, Data key, int (*compare)(Data dataA, Data dataB))
+Datas DatasSortInts(Datas datas)
 {
-    Data *ptr = DatasSearchFlexible(datas, key, compare);
-
-    return ptr ? *ptr : DataNull();
+    return DatasIntSort(datas, 0);
 }
 
-int DatasSearchCheck(Datas datas, Data key, int (*compare)(Data dataA, Data dataB))
+int DatasSearchIntIndex(Datas datas, int32_t value)
 {
-    return DatasSearchFlexible(datas, key, compare) != NULL;
+    Data key = DataRaw(value);
+
+    return DatasIntIndex(datas, &key, 0);
 }
 
 Data DatasFirst(Datas datas)
@@ -1262,7 +1698,177 @@ Datas DatasFree(Datas datas)
 
 Dictionary DictionaryNew(int (*compare)(Data dataA, Data dataB))
 {
-    Dictionary dict = { compare ?: DataCompare, DatasNew() };
+    Dictionary dict = { compare ?: DataCompare, DatasNew(), DataNull() };
+
+    return dict;
+}
+
+Dictionary DictionaryNewHashed()
+{
+    Dictionary dict = { NULL, DatasNew(), DataNull() };
+
+    return dict;
+}
+
+#define DICTIONARY_HASH_SEED 0x5ec0ffee
+
+// 'index' is the keysAndValues index + 1 so that 0 marks an empty slot
+typedef struct DictionaryHashSlot {
+    uint32_t index;
+    uint32_t hash;
+} DictionaryHashSlot;
+
+static uint32_t DictionaryHashKey(Data key)
+{
+    uint32_t hash = 0;
+
+    MurmurHash3_x86_32(key.bytes, (int)key.length, DICTIONARY_HASH_SEED, &hash);
+
+    return hash;
+}
+
+static uint32_t DictionaryHashCapacity(Dictionary dict)
+{
+    return dict.hashIndex.length / sizeof(DictionaryHashSlot);
+}
+
+// Returns the keysAndValues index of 'key' or -1. 'slotOut' gets the key's slot or the empty slot it belongs in.
+static int DictionaryHashedFind(Dictionary dict, Data key, uint32_t hash, uint32_t *slotOut)
+{
+    uint32_t mask = DictionaryHashCapacity(dict) - 1;
+    DictionaryHashSlot *slots = (DictionaryHashSlot*)dict.hashIndex.bytes;
+
+    if(!slots)
+        return -1;
+
+    for(uint32_t i = hash & mask;; i = (i + 1) & mask) {
+
+        if(!slots[i].index) {
+
+            *slotOut = i;
+            return -1;
+        }
+
+        if(slots[i].hash == hash) {
+
+            DictionaryElement *element = (DictionaryElement*)dict.keysAndValues.ptr[slots[i].index - 1].bytes;
+
+            if(DataEqual(element->key, key)) {
+
+                *slotOut = i;
+                return slots[i].index - 1;
+            }
+        }
+    }
+}
+
+static Dictionary DictionaryHashedRebuild(Dictionary dict, uint32_t capacity, int tracked)
+{
+    dict.hashIndex = DataResizeFlexible(dict.hashIndex, capacity * sizeof(DictionaryHashSlot), tracked);
+
+    memset(dict.hashIndex.bytes, 0, dict.hashIndex.length);
+
+    DictionaryHashSlot *slots = (DictionaryHashSlot*)dict.hashIndex.bytes;
+
+    for(uint32_t i = 0; i < dict.keysAndValues.count; i++) {
+
+        uint32_t hash = DictionaryHashKey(((DictionaryElement*)dict.keysAndValues.ptr[i].bytes)->key);
+        uint32_t slot = hash & (capacity - 1);
+
+        while(slots[slot].index)
+            slot = (slot + 1) & (capacity - 1);
+
+        slots[slot] = (DictionaryHashSlot){ i + 1, hash };
+    }
+
+    return dict;
+}
+
+static Dictionary DictionaryHashedAddRef(Dictionary dict, Data key, Data value, int tracked)
+{
+    DictionaryElement element = { key, value };
+
+    uint32_t hash = DictionaryHashKey(key);
+    uint32_t slot = 0;
+
+    int index = DictionaryHashedFind(dict, key, hash, &slot);
+
+    if(index >= 0) {
+
+        *(DictionaryElement*)dict.keysAndValues.ptr[index].bytes = element;
+
+        return dict;
+    }
+
+    uint32_t count = dict.keysAndValues.count;
+
+    if((count + 1) * 2 > DictionaryHashCapacity(dict)) {
+
+        dict = DictionaryHashedRebuild(dict, MAX(DictionaryHashCapacity(dict) * 2, 16), tracked);
+
+        DictionaryHashedFind(dict, key, hash, &slot);
+    }
+
+    Data elementData = DataCopy((void*)&element, sizeof(element));
+
+    if(!tracked)
+        DataUntrack(elementData);
+
+    dict.keysAndValues = DatasResizeFlexible(dict.keysAndValues, count + 1, tracked);
+    dict.keysAndValues.ptr[count] = elementData;
+
+    ((DictionaryHashSlot*)dict.hashIndex.bytes)[slot] = (DictionaryHashSlot){ count + 1, hash };
+
+    return dict;
+}
+
+// Swaps the last element into the removed spot so removal is O(1). Slots are removed by backward shifting.
+static Dictionary DictionaryHashedRemove(Dictionary dict, Data key)
+{
+    uint32_t slot = 0;
+
+    int index = DictionaryHashedFind(dict, key, DictionaryHashKey(key), &slot);
+
+    if(index < 0)
+        return dict;
+
+    DictionaryHashSlot *slots = (DictionaryHashSlot*)dict.hashIndex.bytes;
+    uint32_t mask = DictionaryHashCapacity(dict) - 1;
+
+    for(uint32_t i = (slot + 1) & mask; slots[i].index; i = (i + 1) & mask) {
+
+        if(((i - (slots[i].hash & mask)) & mask) >= ((i - slot) & mask)) {
+
+            slots[slot] = slots[i];
+            slot = i;
+        }
+    }
+
+    slots[slot] = (DictionaryHashSlot){ 0, 0 };
+
+    Data elementData = dict.keysAndValues.ptr[index];
+    uint32_t last = dict.keysAndValues.count - 1;
+
+    if(index != last) {
+
+        DictionaryElement *moved = (DictionaryElement*)dict.keysAndValues.ptr[last].bytes;
+
+        uint32_t movedSlot = 0;
+
+        DictionaryHashedFind(dict, moved->key, DictionaryHashKey(moved->key), &movedSlot);
+
+        slots[movedSlot].index = index + 1;
+
+        dict.keysAndValues.ptr[index] = dict.keysAndValues.ptr[last];
+    }
+
+    dict.keysAndValues = DatasRemoveIndexTake(dict.keysAndValues, last);
+
+    DictionaryElement *element = (DictionaryElement*)elementData.bytes;
+
+    DataFree(element->key);
+    DataFree(element->value);
+    DataFree(elementData);
 
     return dict;
 }
@@ -1313,37 +1919,24 @@ Dictionary DictionaryAddCopy(Dictionary dict, Data key, Data value)
     return DictionaryAddRef(dict, DataCopyData(key), DataCopyData(value));
 }
 
-static __thread Dictionary *curDict = NULL;
-
-static int compareKeys(Data a, Data b)
-{
-    DictionaryElement *d1 = (DictionaryElement*)a.bytes;
-    DictionaryElement *d2 = (DictionaryElement*)b.bytes;
-
-    return curDict->compare(d1->key, d2->key);
-}
-
 Dictionary DictionaryRemove(Dictionary dict, Data key)
 {
-    DictionaryElement element = { key, DataNull() };
-
-    if(curDict)
-        abort();
+    if(!dict.compare)
+        return DictionaryHashedRemove(dict, key);
 
-    curDict = &dict;
-
-    Data result = DatasSearch(dict.keysAndValues, DataRef((void*)&element, sizeof(element)), compareKeys);
+    DictionaryElement element = { key, DataNull() };
+    Data elementKey = DataRaw(element);
 
-    curDict = NULL;
+    int index = DictionaryKeysIndex(dict.keysAndValues, &elementKey, dict.compare);
 
-    if(result.bytes) {
+    if(index >= 0) {
 
-        DictionaryElement *element = (DictionaryElement*)result.bytes;
+        DictionaryElement *element = (DictionaryElement*)dict.keysAndValues.ptr[index].bytes;
 
         DataFree(element->key);
         DataFree(element->value);
 
-        dict.keysAndValues = DatasRemove(dict.keysAndValues, result);
+        dict.keysAndValues = DatasRemoveIndex(dict.keysAndValues, index);
     }
 
     return dict;
@@ -1351,37 +1944,31 @@ Dictionary DictionaryRemove(Dictionary dict, Data key)
 
 static Dictionary DictionaryAddRefFlexible(Dictionary dict, Data key, Data value, int tracked)
 {
+    if(!dict.compare)
+        return DictionaryHashedAddRef(dict, key, value, tracked);
+
     DictionaryElement element = { key, value };
+    Data elementKey = DataRaw(element);
 
-    if(curDict)
-        abort();
+    int index = DictionaryKeysLowerBound(dict.keysAndValues, &elementKey, dict.compare);
 
-    curDict = &dict;
-    dataCompareLastTouchedPtr = NULL;
+    int replacing = index < dict.keysAndValues.count && !DictionaryKeysCompare(&dict.keysAndValues.ptr[index], &elementKey, dict.compare);
 
-    Data result = DatasSearch(dict.keysAndValues, DataRef((void*)&element, sizeof(element)), compareKeys);
+    Data elementData = DataCopy((void*)&element, sizeof(element));
 
-    int index = 0;
+    if(!tracked)
+        DataUntrack(elementData);
 
-    if(dataCompareLastTouchedPtr) {
+    if(replacing) {
 
-        index = (int)((Data*)dataCompareLastTouchedPtr - dict.keysAndValues.ptr);
+        DataFree(dict.keysAndValues.ptr[index]);
 
-        if(dataCompareLastResult > 0)
-            index++;
+        dict.keysAndValues.ptr[index] = elementData;
     }
+    else {
 
-    curDict = NULL;
-
-    if(result.bytes)
-        dict.keysAndValues = DatasRemove(dict.keysAndValues, result);
-
-    Data elementData = DataCopy((void*)&element, sizeof(element));
-
-    if(!tracked)
-        DataUntrack(elementData);
-
-    dict.keysAndValues = DatasAddRefIndexFlexible(dict.keysAndValues, elementData, index, tracked);
+        dict.keysAndValues = DatasAddRefIndexFlexible(dict.keysAndValues, elementData, index, tracked);
+    }
 
     return dict;
 }
@@ -1398,21 +1985,27 @@ Dictionary DictionaryAddRefUntracked(Dictionary dict, Data key, Data value)
 
 Data *DictionaryGetValueFlexible(Dictionary dict, Data key)
 {
-    DictionaryElement element = { key, DataNull() };
+    if(!dict.compare) {
 
-    if(curDict)
-        abort();
+        uint32_t slot = 0;
 
-    curDict = &dict;
+        int index = DictionaryHashedFind(dict, key, DictionaryHashKey(key), &slot);
 
-    Data result = DatasSearch(dict.keysAndValues, DataRef((void*)&element, sizeof(element)), compareKeys);
+        if(index < 0)
+            return NULL;
 
-    curDict = NULL;
+        return &((DictionaryElement*)dict.keysAndValues.ptr[index].bytes)->value;
+    }
 
-    if(!result.bytes)
+    DictionaryElement element = { key, DataNull() };
+    Data elementKey = DataRaw(element);
+
+    int index = DictionaryKeysIndex(dict.keysAndValues, &elementKey, dict.compare);
+
+    if(index < 0)
         return NULL;
 
-    return &((DictionaryElement*)result.bytes)->value;
+    return &((DictionaryElement*)dict.keysAndValues.ptr[index].bytes)->value;
 }
 
 Data DictionaryGetValue(Dictionary dict, Data key)
@@ -1482,7 +2075,7 @@ Dictionary DictionaryDeserialize(Data data)
 
 Dictionary DictionaryCopy(Dictionary dict)
 {
-    Dictionary result = DictionaryNew(dict.compare);
+    Dictionary result = dict.compare ? DictionaryNew(dict.compare) : DictionaryNewHashed();
 
     for(int i = 0; i < DictCount(dict); i++) {
 
@@ -1505,6 +2098,7 @@ Dictionary DictionaryTrack(Dictionary dict)
     }
 
     DatasTrack(dict.keysAndValues);
+    DataTrack(dict.hashIndex);
 
     return dict;
 }
@@ -1520,6 +2114,7 @@ Dictionary DictionaryUntrack(Dictionary dict)
     }
 
     DatasUntrack(dict.keysAndValues);
+    DataUntrack(dict.hashIndex);
 
     return dict;
 }
@@ -1529,6 +2124,11 @@ Dict DictNew()
     return DictionaryNew(NULL);
 }
 
+Dict DictNewHashed()
+{
+    return DictionaryNewHashed();
+}
+
 Dict DictNull()
 {
     return DictOne(DataNull(), DataNull());
@@ -1657,6 +2257,13 @@ Dict *DictRemoveIndex(Dict *dict, int index)
 {
     DictionaryElement *element = (DictionaryElement*)dict->keysAndValues.ptr[index].bytes;
 
+    if(!dict->compare) {
+
+        *dict = DictionaryHashedRemove(*dict, element->key);
+
+        return dict;
+    }
+
     DataFree(element->key);
     DataFree(element->value);
 
@@ -1757,6 +2364,7 @@ void DictionaryFree(Dictionary dict)
     }
 
     DatasFree(dict.keysAndValues);
+    DataFree(dict.hashIndex);
 }
 
 static String StringMutateEnsureNullByte(String string)
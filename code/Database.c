@@ -10,8 +10,7 @@
 #include "BTCUtil.h"
 #include "BasicStorage.h"
 #include "SqlStructure.h"
-#include "blocks.h"
-#include "testnet_blocks.h"
+#include "Checkpoints.h"
 #include "Notifications.h"
 #include <string.h>
 #include <sqlite3.h>
@@ -41,11 +40,11 @@ const char *databaseRootPath = "/tmp";
 // Time past this gets ignored
 #define MAX_DELTA_WEIGHT (24 * 60 * 60)
 
-#define HASH_CACHE_TRIMSIZE 5000
-#define HASH_CACHE_SIZE 15000
+// Applied to both connections. NORMAL sync is durable across app crashes in WAL mode and only fsyncs at checkpoints.
+#define DATABASE_PRAGMAS "pragma synchronous=NORMAL; pragma mmap_size=268435456; pragma cache_size=-8192; pragma temp_store=MEMORY;"
 
-//#define HASH_CACHE_TRIMSIZE 5
-//#define HASH_CACHE_SIZE 15
+// Milliseconds a connection waits on a lock held by the other before giving up
+#define DATABASE_BUSY_TIMEOUT 5000
 
 const char *nodeListIndexKey = "nodeListIndexKey";
 const char *nodeListIpKey = "nodeListIpKey";
@@ -57,9 +56,39 @@ const char *nodeListManualNodeKey = "nodeListManualNodeKey";
 const char *nodeListMasterNodeKey = "nodeListMasterNodeKey";
 const char *DatabaseNewTxNotification = "DatabaseNewTxNotification";
 const char *DatabaseNewBlockNotification = "DatabaseNewBlockNotification";
+const char *DatabaseReorgNotification = "DatabaseReorgNotification";
 const char *DatabaseNodeListChangedNotification = "DatabaseNodeListChangedNotification";
 
 static void insertStartingBlocks(Database *self);
+static int insertSnapshot(Database *self, CheckpointSnapshot *snapshot, DatabaseHeaderStorage storage);
+static void loadHeaderIndex(Database *self);
+static void importBlocksIntoHeaderStore(Database *self);
+
+typedef struct BlockRow {
+
+    int32_t height;
+    Data hash;
+    uint32_t hashPrefix;
+    Data merkleRoot;
+    uint32_t time;
+    Data header;
+    uint32_t bits;
+    Data prevHash;
+    int side; // Competes with the main chain, goes to 'sideHeaders' instead of the header storage
+
+} BlockRow;
+
+// A header off the main chain, kept so its branch can be switched to if it overtakes the main chain
+typedef struct SideHeader {
+
+    uint8_t header[80]; // Headers that left sqlite storage only have the prev hash, merkle root, time and bits
+    uint8_t hash[32];
+    int32_t height;
+
+} SideHeader;
+
+#define SIDE_HEADERS(self) ((SideHeader*)(self)->sideHeaders.bytes)
+#define SIDE_HEADER_COUNT(self) ((int)((self)->sideHeaders.length / sizeof(SideHeader)))
 
 static String dbPath()
 {
@@ -73,6 +102,16 @@ static String dbPath()
     return path;
 }
 
+static String headerStorePath()
+{
+    String docs = getDatabaseDirectory();
+
+    if(DataGetInt(bsLoad("testnet")))
+        return StringF("%s/testnet_headers.dat", docs.bytes);
+
+    return StringF("%s/headers.dat", docs.bytes);
+}
+
 static void DatabaseExecuteHelper(Dict dict)
 {
     Database *db = DataGetPtr(DictGetS(dict, "db"));
@@ -93,46 +132,169 @@ void DatabaseExecute(Database *db, void (*onWorkThread)(Database *db, Dict dict)
     WorkQueueAdd(WorkQueueThreadNamedStackSize("Database Thread", 262144), DatabaseExecuteHelper, dict);
 }
 
-int DatabaseResetAllBlocks(Database *self)
+// Every fixed query is prepared once and kept on the Database. Selects that don't need to see an
+// open write transaction run on 'readDatabase' so other threads aren't queued behind the writer.
+typedef enum {
+
+    StatementInsertBlock,
+    StatementBlocksAbove,
+    StatementDeleteBlocksAbove,
+    StatementMerkleRootOf,
+    StatementSetBlockBits,
+    StatementDeleteBlocks,
+    StatementDeleteTransactions,
+    StatementTransactionsAtHeight,
+    StatementAllBlocks,
+    StatementNodeList,
+    StatementNodeCount,
+    StatementInsertNode,
+    StatementDeleteNode,
+    StatementDeleteNodeByIp,
+    StatementSetRejectCode,
+    StatementSetFee,
+    StatementInsertTransaction,
+    StatementConfirmTransaction,
+    StatementDeleteTransaction,
+    StatementTransactionForHash,
+    StatementTransactionsWithPrefix,
+    StatementTransactionTime,
+    StatementAllTransactions,
+    StatementTransactionsToPublish,
+    StatementUnconfirmTransactions,
+
+    StatementCount
+
+} Statement;
+
+static const struct {
+
+    const char *sql;
+    int reader;
+
+} statementInfo[StatementCount] = {
+
+    [StatementInsertBlock] = { "insert into `blocks` (`height`, `hash`, `hashPrefix`, `merkleRoot`, `time`, `bits`) values (?, ?, ?, ?, ?, ?)", 0 },
+    [StatementBlocksAbove] = { "select `height`, `hash`, `time`, `merkleRoot`, `bits` from `blocks` where `height`>? order by `height`", 0 },
+    [StatementDeleteBlocksAbove] = { "delete from `blocks` where `height`>?", 0 },
+    [StatementMerkleRootOf] = { "select `merkleRoot` from `blocks` where `height`=?", 1 },
+    [StatementSetBlockBits] = { "update `blocks` set `bits`=? where `height`=? and `hashPrefix`=? and `hash`=?", 0 },
+    [StatementDeleteBlocks] = { "delete from `blocks`", 0 },
+    [StatementDeleteTransactions] = { "delete from `transactions`", 0 },
+    [StatementTransactionsAtHeight] = { "select `transaction`, `fee`, `rejectCode`, `time` from `transactions` where `height`=?", 1 },
+    [StatementAllBlocks] = { "select `height`, `hash`, `time`, `merkleRoot`, `bits` from `blocks` order by `height`", 1 },
+    [StatementNodeList] = { "select `id`, `ip`, `port`, `services`, `date`, `testnet`, `manual`, `master` from `nodes` where testnet=? order by `manual` desc, `date` desc", 1 },
+    [StatementNodeCount] = { "select count(*) from `nodes` where testnet=?", 1 },
+    [StatementInsertNode] = { "insert into `nodes` ( `ip`, `port`, `services`, `date`, `testnet`, `manual`, `master` ) values (?, ?, ?, ?, ?, ?, ?)", 0 },
+    [StatementDeleteNode] = { "delete from `nodes` where `id`=? limit 1", 0 },
+    [StatementDeleteNodeByIp] = { "delete from `nodes` where `ip`=?", 0 },
+    [StatementSetRejectCode] = { "update `transactions` set `rejectCode`=? where `hashPrefix`=? and `hash`=? limit 1", 0 },
+    [StatementSetFee] = { "update `transactions` set `fee`=? where `hashPrefix`=? and `hash`=? limit 1", 0 },
+    [StatementInsertTransaction] = { "insert into `transactions` (`height`, `hash`, `hashPrefix`, `transaction`) values (?, ?, ?, ?)", 0 },
+    [StatementConfirmTransaction] = { "update `transactions` set `height`=?, `time` = MIN(`transactions`.`time`, ?) where `hashPrefix`=? and `hash`=? limit 1", 0 },
+    [StatementDeleteTransaction] = { "delete from `transactions` where `hashPrefix`=? and `hash`=? limit 1", 0 },
+    [StatementTransactionForHash] = { "select `transaction` from `transactions` where `hashPrefix`=? and `hash`=? limit 1", 1 },
+    [StatementTransactionsWithPrefix] = { "select `hash`, `height` from `transactions` where `hashPrefix`=?", 1 },
+    [StatementTransactionTime] = { "select `time` from `transactions` where `hashPrefix`=? and `hash`=?", 1 },
+    [StatementAllTransactions] = { "select `transaction` from `transactions`", 1 },
+    [StatementTransactionsToPublish] = { "select `transaction` from `transactions` where height<1 and time>strftime('%s', 'now')-60*60*24*3", 1 },
+    [StatementUnconfirmTransactions] = { "update `transactions` set `height`=-1 where `height`>=? and `height`<=?", 0 },
+};
+
+// Returns the cached statement for 'index', reset and ready to bind. Hand it back with 'statementDone'.
+// If another thread has it checked out, a one-off copy is prepared rather than waiting.
+static sqlite3_stmt *statement(Database *self, Statement index)
 {
+    if(StatementCount > DATABASE_MAX_STATEMENTS)
+        abort();
+
+    sqlite3 *db = statementInfo[index].reader && self->readDatabase ? self->readDatabase : self->database;
+
     sqlite3_stmt *stmt = NULL;
 
-    int result = sqlite3_prepare_v2(self->database, "delete from `blocks`", -1, &stmt, NULL);
+    if(pthread_mutex_trylock(&self->statementLocks[index]) != 0) {
 
-    if(result != SQLITE_OK) {
+        if(sqlite3_prepare_v2(db, statementInfo[index].sql, -1, &stmt, NULL) != SQLITE_OK) {
 
-        sqlite3_finalize(stmt);
-        return 0;
+            sqlite3_finalize(stmt);
+            return NULL;
+        }
+
+        return stmt;
     }
 
-    result = sqlite3_step(stmt);
+    if(!self->statements[index] && sqlite3_prepare_v3(db, statementInfo[index].sql, -1, SQLITE_PREPARE_PERSISTENT, &stmt, NULL) == SQLITE_OK)
+        self->statements[index] = stmt;
 
-    if(result != SQLITE_DONE) {
+    if(!self->statements[index]) {
 
         sqlite3_finalize(stmt);
-        return 0;
+        pthread_mutex_unlock(&self->statementLocks[index]);
+        return NULL;
     }
 
-    stmt = NULL;
+    return self->statements[index];
+}
 
-    result = sqlite3_prepare_v2(self->database, "delete from `transactions`", -1, &stmt, NULL);
+static void statementDone(Database *self, sqlite3_stmt *stmt)
+{
+    for(int i = 0; i < StatementCount; i++) {
 
-    if(result != SQLITE_OK) {
+        if(self->statements[i] == stmt) {
 
-        sqlite3_finalize(stmt);
-        return 0;
+            sqlite3_reset(stmt);
+            sqlite3_clear_bindings(stmt);
+
+            pthread_mutex_unlock(&self->statementLocks[i]);
+            return;
+        }
     }
 
-    result = sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+}
+
+int DatabaseResetAllBlocks(Database *self)
+{
+    sqlite3_stmt *stmt = statement(self, StatementDeleteBlocks);
+
+    if(!stmt)
+        return 0;
+
+    int result = sqlite3_step(stmt);
 
     if(result != SQLITE_DONE) {
 
-        sqlite3_finalize(stmt);
+        statementDone(self, stmt);
         return 0;
     }
 
+    statementDone(self, stmt);
+
+    stmt = statement(self, StatementDeleteTransactions);
+
+    if(!stmt)
+        return 0;
+
+    result = sqlite3_step(stmt);
+
+    statementDone(self, stmt);
+
+    if(result != SQLITE_DONE)
+        return 0;
+
+    if(self->headerStorage == DatabaseHeaderStorageFlatFile && !HeaderStoreRemoveAll(&self->headerStore))
+        return 0;
+
+    HeaderIndexRemoveAll(&self->headerIndex);
+
+    self->sideHeaders.length = 0;
+
     insertStartingBlocks(self);
 
+    if(self->headerStorage == DatabaseHeaderStorageFlatFile)
+        importBlocksIntoHeaderStore(self);
+
+    loadHeaderIndex(self);
+
     return 1;
 }
 
@@ -148,31 +310,82 @@ void resetToOriginal(Database *self)
         fclose(file);
 }
 
+// The bundled snapshot goes into the blocks table. A header store is filled from there on open.
 static void insertStartingBlocks(Database *self)
 {
-    char *error = NULL;
+    CheckpointSnapshot snapshot;
 
-    const char *blocksSql = initialBlocksSql;
+    if(!CheckpointSnapshotParse(CheckpointSnapshotBundled(DataGetInt(bsLoad("testnet"))), &snapshot)) {
 
-    if(DataGetInt(bsLoad("testnet")))
-        blocksSql = initialTestnetBlocksSql;
+        printf("insert blocks error: bundled checkpoints are malformed\n");
+        return;
+    }
 
-    sqlite3_exec(self->database, blocksSql, NULL, NULL, &error);
+    insertSnapshot(self, &snapshot, DatabaseHeaderStorageSqlite);
+}
+
+static void loadHeaderIndexRecord(void *ptr, int32_t height, Data hash, Data header)
+{
+    Database *self = ptr;
+    uint32_t time = *(uint32_t*)(header.bytes + 68);
+    uint32_t bits = *(uint32_t*)(header.bytes + 72);
+
+    if(time)
+        HeaderIndexSet(&self->headerIndex, height, hash, time, bits);
+}
+
+// Reads every block row into 'headerIndex', which then answers all height and hash lookups
+static void loadHeaderIndex(Database *self)
+{
+    HeaderIndexRemoveAll(&self->headerIndex);
+
+    if(self->headerStorage == DatabaseHeaderStorageFlatFile) {
+
+        HeaderStoreEnumerate(&self->headerStore, loadHeaderIndexRecord, self);
+        return;
+    }
 
-    if(error) {
+    sqlite3_stmt *stmt = statement(self, StatementAllBlocks);
 
-        printf("insert blocks error: %s\n", error);
-        sqlite3_free(error);
+    if(!stmt)
+        return;
+
+    while(sqlite3_step(stmt) == SQLITE_ROW) {
+
+        int32_t height = sqlite3_column_int(stmt, 0);
+        uint32_t time = (uint32_t)sqlite3_column_int64(stmt, 2);
+
+        if(height < 0 || !time || sqlite3_column_bytes(stmt, 1) != 32)
+            continue;
+
+        Data hash = DataCopy(sqlite3_column_blob(stmt, 1), 32);
+
+        HeaderIndexSet(&self->headerIndex, height, hash, time, (uint32_t)sqlite3_column_int64(stmt, 4));
+
+        DataFree(hash);
     }
+
+    statementDone(self, stmt);
 }
 
 Database DatabaseNew()
+{
+    return DatabaseNewWithHeaderStorage(DatabaseHeaderStorageSqlite);
+}
+
+Database DatabaseNewWithHeaderStorage(DatabaseHeaderStorage headerStorage)
 {
     Database result = {0};
     Database *self = &result;
 
+    self->headerStorage = headerStorage;
+
     self->workQueue = WorkQueueNew();
-    self->blockHeightCache = DictUntrack(DictNew());
+    self->headerIndex = HeaderIndexNew();
+
+    // Allocated up front, appending to a null Data would track the result
+    self->sideHeaders = DataNewUntracked(sizeof(SideHeader));
+    self->sideHeaders.length = 0;
 
     String path = dbPath();
 
@@ -196,6 +409,15 @@ Database DatabaseNew()
 
     sqlite_result = sqlite3_open_v2(path.bytes, (struct sqlite3 **)&self->database, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, NULL);
 
+    // WAL lets 'readDatabase' read while a write transaction is open. The journal mode sticks to the file.
+    sqlite3_exec(self->database, "pragma journal_mode=WAL", NULL, NULL, NULL);
+    sqlite3_exec(self->database, DATABASE_PRAGMAS, NULL, NULL, NULL);
+    sqlite3_busy_timeout(self->database, DATABASE_BUSY_TIMEOUT);
+
+    for(int i = 0; i < DATABASE_MAX_STATEMENTS; i++)
+        if(pthread_mutex_init(&self->statementLocks[i], NULL) != 0)
+            abort();
+
     if(firstTime) {
 
         char *error = NULL;
@@ -207,12 +429,79 @@ Database DatabaseNew()
 
         insertStartingBlocks(self);
     }
+    else {
+
+        // Databases made before 'bits' was stored. Fails harmlessly once the column is there.
+        sqlite3_exec(self->database, "alter table `blocks` add column `bits` unsigned integer not null default 0", NULL, NULL, NULL);
+    }
+
+    if(sqlite3_open_v2(path.bytes, (struct sqlite3 **)&self->readDatabase, SQLITE_OPEN_READONLY | SQLITE_OPEN_FULLMUTEX, NULL) == SQLITE_OK) {
+
+        sqlite3_exec(self->readDatabase, DATABASE_PRAGMAS, NULL, NULL, NULL);
+        sqlite3_busy_timeout(self->readDatabase, DATABASE_BUSY_TIMEOUT);
+    }
+    else {
+
+        sqlite3_close(self->readDatabase);
+        self->readDatabase = NULL;
+    }
+
+    if(self->headerStorage == DatabaseHeaderStorageFlatFile) {
+
+        self->headerStore = HeaderStoreOpen(headerStorePath().bytes);
+
+        if(!HeaderStoreIsOpen(&self->headerStore)) {
+
+            printf("Unable to open header store at %s, using sqlite\n", headerStorePath().bytes);
+            self->headerStorage = DatabaseHeaderStorageSqlite;
+        }
+        else if(!HeaderStoreHeightCount(&self->headerStore)) {
+
+            importBlocksIntoHeaderStore(self);
+        }
+    }
 
-//    prefillBlockHeightCache(self);
+    loadHeaderIndex(self);
 
     return result;
 }
 
+void DatabaseFree(Database *self)
+{
+    for(int i = 0; i < DATABASE_MAX_STATEMENTS; i++) {
+
+        sqlite3_finalize(self->statements[i]);
+        pthread_mutex_destroy(&self->statementLocks[i]);
+    }
+
+    memset(self->statements, 0, sizeof(self->statements));
+
+    sqlite3_close(self->readDatabase);
+    self->readDatabase = NULL;
+
+    sqlite3_close(self->database);
+    self->database = NULL;
+
+    HeaderIndexFree(&self->headerIndex);
+
+    self->sideHeaders = DataFree(self->sideHeaders);
+
+    if(self->headerStorage == DatabaseHeaderStorageFlatFile)
+        HeaderStoreClose(&self->headerStore);
+
+    DataTrackPush();
+
+    FORIN(Dict, dict, self->nodeListCache)
+        DictTrack(*dict);
+
+    DatasTrack(self->nodeListCache);
+    self->nodeListCache = DatasNew();
+
+    DataTrackPop();
+
+    WorkQueueFree(self->workQueue);
+}
+
 int analyze(Database *self)
 {
     sqlite3_stmt *stmt = NULL;
@@ -237,456 +526,887 @@ int analyze(Database *self)
     return 1;
 }
 
-void trimBlockHeightCacheIfNeeded(Database *self)
+// Returns 1 if 'row' was stored
+static int insertBlockRow(Database *self, BlockRow *row)
+{
+    sqlite3_stmt *stmt = statement(self, StatementInsertBlock);
+
+    if(!stmt)
+        return 0;
+
+    sqlite3_bind_int(stmt, 1, row->height);
+    sqlite3_bind_blob(stmt, 2, row->hash.bytes, (int)row->hash.length, NULL);
+    sqlite3_bind_int(stmt, 3, row->hashPrefix);
+    sqlite3_bind_blob(stmt, 4, row->merkleRoot.bytes, (int)row->merkleRoot.length, NULL);
+    sqlite3_bind_int64(stmt, 5, row->time);
+    sqlite3_bind_int64(stmt, 6, row->bits);
+
+    int result = sqlite3_step(stmt);
+
+    statementDone(self, stmt);
+
+    if(result == SQLITE_DONE)
+        return 1;
+
+    printf("add merkle error: %s\n", sqlite3_errmsg(self->database));
+
+    return 0;
+}
+
+// Writes each run of consecutive heights to the header store with one write. Rows that fail to write
+// get their height set to -1. Returns the number stored.
+static int storeBlockRows(Database *self, BlockRow *rows, int count)
 {
-    while(DictCount(self->blockHeightCache) >= HASH_CACHE_SIZE) {
+    int storedCount = 0;
+
+    for(int start = 0; start < count; ) {
+
+        if(rows[start].height < 0) {
+
+            start++;
+            continue;
+        }
+
+        int end = start + 1;
+
+        while(end < count && rows[end].height == rows[end - 1].height + 1)
+            end++;
+
+        Data headers = DataNew(0);
+        Data hashes = DataNew(0);
+
+        for(int i = start; i < end; i++) {
+
+            headers = DataAppend(headers, rows[i].header);
+            hashes = DataAppend(hashes, rows[i].hash);
+        }
 
-        DictRemoveIndex(&self->blockHeightCache, DictCount(self->blockHeightCache) - 1);
+        if(HeaderStoreWrite(&self->headerStore, rows[start].height, headers, hashes)) {
+
+            storedCount += end - start;
+        }
+        else {
+
+            printf("header store write failed at height %d\n", rows[start].height);
+
+            for(int i = start; i < end; i++)
+                rows[i].height = -1;
+        }
+
+        start = end;
     }
+
+    return storedCount;
 }
 
-static pthread_mutex_t blockHeightCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+// Copies the rows of the blocks table (the starting checkpoints, or a chain synced before the header
+// store was in use) into the header store. Checkpoint rows only carry their merkle root and time, so
+// their records are partial headers that are never hashed, only read back by height.
+static void importBlocksIntoHeaderStore(Database *self)
+{
+    DataTrackPush();
 
-int DatabaseAddBlock(Database *self, MerkleBlock *block)
+    sqlite3_stmt *stmt = statement(self, StatementAllBlocks);
+
+    if(!stmt) {
+
+        DataTrackPop();
+        return;
+    }
+
+    Data rows = DataNew(0);
+
+    while(sqlite3_step(stmt) == SQLITE_ROW) {
+
+        BlockRow row = { sqlite3_column_int(stmt, 0) };
+
+        row.hash = DataCopy(sqlite3_column_blob(stmt, 1), sqlite3_column_bytes(stmt, 1));
+        row.time = (uint32_t)sqlite3_column_int64(stmt, 2);
+        row.merkleRoot = DataCopy(sqlite3_column_blob(stmt, 3), sqlite3_column_bytes(stmt, 3));
+        row.header = DataZero(80);
+        row.bits = (uint32_t)sqlite3_column_int64(stmt, 4);
+
+        if(row.height < 0 || !row.time || row.hash.length != 32 || row.merkleRoot.length != 32)
+            continue;
+
+        memcpy(row.header.bytes + 36, row.merkleRoot.bytes, 32);
+        memcpy(row.header.bytes + 68, &row.time, sizeof(row.time));
+        memcpy(row.header.bytes + 72, &row.bits, sizeof(row.bits));
+
+        rows = DataAppend(rows, DataRaw(row));
+    }
+
+    statementDone(self, stmt);
+
+    storeBlockRows(self, (BlockRow*)rows.bytes, rows.length / sizeof(BlockRow));
+
+    DataTrackPop();
+}
+
+static pthread_mutex_t addBlocksMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Fills in the bits of the header at 'height' from 'block', which must hash to the one stored there. Checkpoints
+// come without bits, and the hash they name vouches for the header's. Call with 'addBlocksMutex' held.
+static int fillBlockBits(Database *self, int32_t height, MerkleBlock *block)
 {
-    if(!MerkleBlockValid(block))
+    if(HeaderIndexBitsOf(&self->headerIndex, height))
         return 0;
 
-    int32_t prevHeight = DatabaseHeightOf(self, blockPrevHash(block));
+    DataTrackPush();
+
+    Data hash = blockHash(block);
+    uint32_t bits = blockBits(block);
+
+    if(!MerkleBlockCheckProofOfWork(block))
+        return DTPopi(0);
+
+    if(self->headerStorage == DatabaseHeaderStorageFlatFile) {
+
+        if(!HeaderStoreWrite(&self->headerStore, height, DataCopyDataPart(block->data, 0, 80), hash))
+            return DTPopi(0);
+    }
+    else {
+
+        sqlite3_stmt *stmt = statement(self, StatementSetBlockBits);
+
+        if(!stmt)
+            return DTPopi(0);
+
+        sqlite3_bind_int64(stmt, 1, bits);
+        sqlite3_bind_int(stmt, 2, height);
+        sqlite3_bind_int(stmt, 3, *(uint32_t*)hash.bytes);
+        sqlite3_bind_blob(stmt, 4, hash.bytes, (int)hash.length, NULL);
+
+        int result = sqlite3_step(stmt);
+
+        statementDone(self, stmt);
 
-    if(prevHeight < 0) {
+        if(result != SQLITE_DONE) {
 
-        printf("Can't find prevHash of merkBlock to discover height.\n");
-        prevHeight = DatabaseHeightOf(self, blockPrevHash(block));
+            printf("set bits error: %s\n", sqlite3_errmsg(self->database));
+            return DTPopi(0);
+        }
+    }
+
+    HeaderIndexSet(&self->headerIndex, height, hash, HeaderIndexTimeOf(&self->headerIndex, height), bits);
+
+    return DTPopi(1);
+}
+
+// Side headers this far below the main chain's tip are dropped
+#define DATABASE_SIDE_HEADER_DEPTH 2016
+
+// Checks 'bits' follows the header before it. Unknown 'prevBits' (a checkpoint whose own header hasn't
+// arrived) vouch for nothing and fail. Without the time the retarget period started, a retarget is only
+// held to the 4x limit of 'prevBits'.
+// Testnet's 20 minute rule allows minimum difficulty headers anywhere so only proof of work is checked there.
+static int blockBitsFollow(int testnet, int32_t height, uint32_t bits, uint32_t prevBits, uint32_t firstTime, uint32_t prevTime)
+{
+    if(testnet)
+        return 1;
+
+    if(!prevBits)
         return 0;
+
+    if(height % BLOCK_RETARGET_INTERVAL)
+        return bits == prevBits;
+
+    if(firstTime && prevTime)
+        return bits == blockRetargetBits(prevBits, firstTime, prevTime);
+
+    uint32_t hardest = blockRetargetBits(prevBits, 0, BLOCK_TARGET_TIMESPAN / 4);
+    uint32_t easiest = blockRetargetBits(prevBits, 0, BLOCK_TARGET_TIMESPAN * 4);
+
+    return blockBitsCompare(bits, hardest) >= 0 && blockBitsCompare(bits, easiest) <= 0;
+}
+
+// Time of the header at 'height' from the batch so far or else 'headerIndex'
+static uint32_t batchTimeOf(Database *self, Data rows, int32_t height)
+{
+    for(BlockRow *row = (BlockRow*)(rows.bytes + rows.length) - 1; row >= (BlockRow*)rows.bytes; row--)
+        if(row->height == height)
+            return row->time;
+
+    return HeaderIndexTimeOf(&self->headerIndex, height);
+}
+
+static BlockRow *batchRowOf(Data rows, Data hash)
+{
+    for(BlockRow *row = (BlockRow*)(rows.bytes + rows.length) - 1; row >= (BlockRow*)rows.bytes; row--)
+        if(DataEqual(row->hash, hash))
+            return row;
+
+    return NULL;
+}
+
+static SideHeader *sideHeaderOf(Database *self, Data hash)
+{
+    if(hash.length != 32)
+        return NULL;
+
+    for(int i = 0; i < SIDE_HEADER_COUNT(self); i++)
+        if(!memcmp(SIDE_HEADERS(self)[i].hash, hash.bytes, 32))
+            return &SIDE_HEADERS(self)[i];
+
+    return NULL;
+}
+
+static void removeSideHeader(Database *self, SideHeader *side)
+{
+    SideHeader *end = SIDE_HEADERS(self) + SIDE_HEADER_COUNT(self);
+
+    memmove(side, side + 1, (size_t)(end - side - 1) * sizeof(SideHeader));
+
+    self->sideHeaders.length -= sizeof(SideHeader);
+}
+
+static void removeSideHeadersAtOrBelow(Database *self, int32_t height)
+{
+    int count = 0;
+
+    for(int i = 0; i < SIDE_HEADER_COUNT(self); i++)
+        if(SIDE_HEADERS(self)[i].height > height)
+            SIDE_HEADERS(self)[count++] = SIDE_HEADERS(self)[i];
+
+    self->sideHeaders.length = count * (uint32_t)sizeof(SideHeader);
+}
+
+// Walks from 'tip' back to the main chain, collecting the branch tip first into 'branch'. 'work' is
+// the main chain's work at the fork plus the branch's. Returns the fork height, -1 if the branch doesn't connect.
+static int32_t sideBranch(Database *self, SideHeader *tip, Data *branch, ChainWork *work)
+{
+    *branch = DataNew(0);
+    *work = (ChainWork) { 0 };
+
+    for(SideHeader *side = tip; side; ) {
+
+        *branch = DataAppend(*branch, DataRaw(*side));
+        *work = ChainWorkAdd(*work, blockWork(*(uint32_t*)(side->header + 72)));
+
+        Data prevHash = DataRef(side->header + 4, 32);
+        int32_t height = HeaderIndexHeightOf(&self->headerIndex, prevHash);
+
+        if(height >= 0) {
+
+            *work = ChainWorkAdd(HeaderIndexChainWork(&self->headerIndex, height), *work);
+
+            return height;
+        }
+
+        side = sideHeaderOf(self, prevHash);
     }
 
-    int32_t height = prevHeight + 1;
-    Data hash = blockHash(block);
-    uint32_t hashPrefix = *(uint32_t*)hash.bytes;
+    return -1;
+}
 
-    sqlite3_stmt *stmt = NULL;
+// The main chain above 'height' as side headers, so it can be switched back to
+static Data mainChainAbove(Database *self, int32_t height)
+{
+    Data result = DataNew(0);
 
-    for(int i = 0; i < 2; i++) {
+    if(self->headerStorage == DatabaseHeaderStorageFlatFile) {
 
-        String query = StringF("%s into `blocks` (`height`, `hash`, `hashPrefix`, `merkleRoot`, `time`) values (?, ?, ?, ?, ?)", i ? "replace" : "insert");
+        for(int32_t h = height + 1; h <= HeaderIndexHighestHeight(&self->headerIndex); h++) {
 
-        int result = sqlite3_prepare_v2(self->database, query.bytes, -1, &stmt, NULL);
+            Data header = HeaderStoreHeader(&self->headerStore, h);
+            Data hash = HeaderStoreHash(&self->headerStore, h);
 
-        if(result != SQLITE_OK)
-            break;
+            if(header.length != 80 || hash.length != 32)
+                continue;
 
-        sqlite3_bind_int(stmt, 1, height);
-        sqlite3_bind_blob(stmt, 2, hash.bytes, (int)hash.length, NULL);
-        sqlite3_bind_int(stmt, 3, hashPrefix);
-        sqlite3_bind_blob(stmt, 4, merkleRoot(block).bytes, (int) merkleRoot(block).length, NULL);
-        sqlite3_bind_int64(stmt, 5, blockTimestamp(block));
+            SideHeader side = { .height = h };
+
+            memcpy(side.header, header.bytes, 80);
+            memcpy(side.hash, hash.bytes, 32);
+
+            result = DataAppend(result, DataRaw(side));
+        }
+
+        return result;
+    }
+
+    sqlite3_stmt *stmt = statement(self, StatementBlocksAbove);
+
+    if(!stmt)
+        return result;
+
+    sqlite3_bind_int(stmt, 1, height);
+
+    while(sqlite3_step(stmt) == SQLITE_ROW) {
+
+        SideHeader side = { .height = sqlite3_column_int(stmt, 0) };
+
+        uint32_t time = (uint32_t)sqlite3_column_int64(stmt, 2);
+        uint32_t bits = (uint32_t)sqlite3_column_int64(stmt, 4);
+        Data prevHash = HeaderIndexHashOf(&self->headerIndex, side.height - 1);
+
+        if(sqlite3_column_bytes(stmt, 1) != 32 || sqlite3_column_bytes(stmt, 3) != 32 || prevHash.length != 32)
+            continue;
+
+        memcpy(side.header + 4, prevHash.bytes, 32);
+        memcpy(side.header + 36, sqlite3_column_blob(stmt, 3), 32);
+        memcpy(side.header + 68, &time, sizeof(time));
+        memcpy(side.header + 72, &bits, sizeof(bits));
+        memcpy(side.hash, sqlite3_column_blob(stmt, 1), 32);
+
+        result = DataAppend(result, DataRaw(side));
+    }
+
+    statementDone(self, stmt);
+
+    return result;
+}
+
+// Makes 'branch' (tip first, from 'sideBranch') the main chain above 'forkHeight'. Only the diverging
+// suffix is rewritten and the headers it replaces become side headers. Returns 1 on success.
+static int switchToBranch(Database *self, int32_t forkHeight, Data branch)
+{
+    SideHeader *sides = (SideHeader*)branch.bytes;
+    int count = branch.length / sizeof(SideHeader);
+
+    Data displaced = mainChainAbove(self, forkHeight);
+    Data rows = DataNew(0);
+
+    for(int i = count - 1; i >= 0; i--) {
+
+        SideHeader *side = &sides[i];
+
+        BlockRow row = { side->height, DataCopy(side->hash, 32), 0, DataCopy(side->header + 36, 32), *(uint32_t*)(side->header + 68), DataCopy(side->header, 80), *(uint32_t*)(side->header + 72) };
+
+        row.hashPrefix = *(uint32_t*)row.hash.bytes;
+
+        rows = DataAppend(rows, DataRaw(row));
+    }
+
+    if(self->headerStorage == DatabaseHeaderStorageFlatFile) {
+
+        // Written before truncating so the old tip is never left without a replacement
+        if(storeBlockRows(self, (BlockRow*)rows.bytes, count) != count || !HeaderStoreTruncate(&self->headerStore, sides[0].height + 1)) {
+
+            printf("header store reorg failed above height %d\n", forkHeight);
+
+            loadHeaderIndex(self);
+
+            return 0;
+        }
+    }
+    else {
+
+        int result = sqlite3_exec(self->database, "begin", NULL, NULL, NULL) == SQLITE_OK;
+
+        sqlite3_stmt *stmt = result ? statement(self, StatementDeleteBlocksAbove) : NULL;
+
+        if(stmt) {
+
+            sqlite3_bind_int(stmt, 1, forkHeight);
+
+            result = sqlite3_step(stmt) == SQLITE_DONE;
+
+            statementDone(self, stmt);
+        }
+
+        for(BlockRow *row = (BlockRow*)rows.bytes; result && row < (BlockRow*)(rows.bytes + rows.length); row++)
+            result = insertBlockRow(self, row);
+
+        if(!stmt || !result || sqlite3_exec(self->database, "commit", NULL, NULL, NULL) != SQLITE_OK) {
+
+            printf("reorg error above height %d: %s\n", forkHeight, sqlite3_errmsg(self->database));
+
+            sqlite3_exec(self->database, "rollback", NULL, NULL, NULL);
+
+            return 0;
+        }
+    }
+
+    HeaderIndexRemoveAbove(&self->headerIndex, forkHeight);
+
+    for(BlockRow *row = (BlockRow*)rows.bytes; row < (BlockRow*)(rows.bytes + rows.length); row++)
+        HeaderIndexSet(&self->headerIndex, row->height, row->hash, row->time, row->bits);
+
+    for(int i = 0; i < count; i++) {
+
+        SideHeader *side = sideHeaderOf(self, DataRef(sides[i].hash, 32));
+
+        if(side)
+            removeSideHeader(self, side);
+    }
+
+    self->sideHeaders = DataAppend(self->sideHeaders, displaced);
+
+    return 1;
+}
+
+int DatabaseAddBlocks(Database *self, Datas headers)
+{
+    DataTrackPush();
+
+    Data rows = DataNew(0);
+
+    rows = DataReserve(rows, headers.count * (unsigned int)sizeof(BlockRow));
+
+    int testnet = DataGetInt(bsLoad("testnet"));
+
+    // Parents can be side headers, which only change under the lock
+    pthread_mutex_lock(&addBlocksMutex);
+
+    // Heights come from the previous header in the batch when it links, which is nearly always.
+    // Otherwise the parent is looked up elsewhere in the batch, then in the database and the side headers.
+    // Proof of work and retargeting are checked for the whole batch before anything is written.
+    for(int i = 0; i < headers.count; i++) {
+
+        if(headers.ptr[i].length < 80)
+            continue;
+
+        MerkleBlock block = MerkleBlockNew(DataCopyData(headers.ptr[i]));
+
+        // A zero timestamp can never pass median time past, and marks empty heights in 'headerIndex'
+        if(!MerkleBlockValid(&block) || !blockTimestamp(&block))
+            continue;
+
+        Data hash = blockHash(&block);
+
+        int32_t knownHeight = HeaderIndexHeightOf(&self->headerIndex, hash);
+
+        if(knownHeight >= 0 && fillBlockBits(self, knownHeight, &block))
+            printf("Filled in the bits of checkpoint %d from its header.\n", knownHeight);
+
+        if(knownHeight >= 0 || sideHeaderOf(self, hash) || batchRowOf(rows, hash))
+            continue;
+
+        Data prevHash = blockPrevHash(&block);
+
+        BlockRow *found = batchRowOf(rows, prevHash);
+        SideHeader *side = found ? NULL : sideHeaderOf(self, prevHash);
+
+        int32_t prevHeight = found ? found->height : side ? side->height : DatabaseHeightOf(self, prevHash);
+
+        if(prevHeight < 0) {
+
+            printf("Can't find prevHash of merkBlock to discover height.\n");
+            continue;
+        }
+
+        BlockRow row = { prevHeight + 1, hash, 0, merkleRoot(&block), blockTimestamp(&block), DataCopyDataPart(block.data, 0, 80), blockBits(&block), prevHash };
+
+        row.hashPrefix = *(uint32_t*)row.hash.bytes;
 
-        result = sqlite3_step(stmt);
+        // Children of side headers are side headers, as is anything competing for a taken height
+        row.side = (found && found->side) || side || HeaderIndexTimeOf(&self->headerIndex, row.height);
 
-        if(result == SQLITE_DONE) {
+        uint32_t prevBits = found ? found->bits : side ? *(uint32_t*)(side->header + 72) : HeaderIndexBitsOf(&self->headerIndex, prevHeight);
+        uint32_t prevTime = found ? found->time : side ? *(uint32_t*)(side->header + 68) : HeaderIndexTimeOf(&self->headerIndex, prevHeight);
+        uint32_t firstTime = 0;
 
-            pthread_mutex_lock(&blockHeightCacheMutex);
+        // Not the peer's fault, so the batch isn't failed. 'requestHeadersWorkerMain' asks for the missing header.
+        if(!testnet && !prevBits) {
 
-            Data num = DictGet(self->blockHeightCache, DataInt(hashPrefix));
+            printf("No bits known for height %d, skipping header at %d until that header arrives.\n", prevHeight, row.height);
+            continue;
+        }
 
-            trimBlockHeightCacheIfNeeded(self);
+        if(row.height % BLOCK_RETARGET_INTERVAL == 0 && row.height >= BLOCK_RETARGET_INTERVAL)
+            firstTime = batchTimeOf(self, rows, row.height - BLOCK_RETARGET_INTERVAL);
 
-            // The code area below as revealed as CPU intensive during block downloading,
-            // therefore it has been optimized and may take more effort to read.
+        if(!MerkleBlockCheckProofOfWork(&block) || !blockBitsFollow(testnet, row.height, row.bits, prevBits, firstTime, prevTime)) {
 
-            if(num.length) {
+            printf("Header at height %d fails proof of work or retargeting, rejecting all %d headers.\n", row.height, headers.count);
 
-                Data key = DataNewUntracked(sizeof(hashPrefix));
-                Data value = DataNewUntracked(sizeof(height));
+            pthread_mutex_unlock(&addBlocksMutex);
 
-                *(int32_t*)key.bytes = hashPrefix;
-                *(int32_t*)value.bytes = -1;
+            return DTPopi(-1);
+        }
 
-                self->blockHeightCache = DictionaryAddRefUntracked(self->blockHeightCache, key, value);
-            }
-            else {
+        rows = DataAppend(rows, DataRaw(row));
+    }
 
-                Data key = DataNewUntracked(sizeof(hashPrefix));
-                Data value = DataNewUntracked(sizeof(height));
+    int addCount = 0;
 
-                *(int32_t*)key.bytes = hashPrefix;
-                *(int32_t*)value.bytes = height;
+    int32_t highestHeight = -1;
 
-                self->blockHeightCache = DictionaryAddRefUntracked(self->blockHeightCache, key, value);
-            }
+    Data mainRows = DataNew(0);
 
-            pthread_mutex_unlock(&blockHeightCacheMutex);
+    for(BlockRow *row = (BlockRow*)rows.bytes; row < (BlockRow*)(rows.bytes + rows.length); row++) {
 
-            NotificationsFire(DatabaseNewBlockNotification, DictNew());
+        if(!row->side) {
 
-            sqlite3_finalize(stmt);
-            return 1;
+            mainRows = DataAppend(mainRows, DataRaw(*row));
+            continue;
         }
 
-        if(i || result != SQLITE_CONSTRAINT)
-            break;
+        SideHeader side = { .height = row->height };
 
-        sqlite3_finalize(stmt);
-        stmt = NULL;
+        memcpy(side.header, row->header.bytes, 80);
+        memcpy(side.hash, row->hash.bytes, 32);
 
-        result = sqlite3_prepare_v2(self->database, "select `hash` from `blocks` where `height`=?", -1, &stmt, NULL);
+        self->sideHeaders = DataAppend(self->sideHeaders, DataRaw(side));
 
-        if(result != SQLITE_OK)
-            break;
+        addCount++;
+        highestHeight = MAX(highestHeight, row->height);
+    }
 
-        sqlite3_bind_int(stmt, 1, height);
+    if(self->headerStorage == DatabaseHeaderStorageFlatFile) {
 
-        result = sqlite3_step(stmt);
+        addCount += storeBlockRows(self, (BlockRow*)mainRows.bytes, mainRows.length / sizeof(BlockRow));
 
-        if(result != SQLITE_ROW)
-            break;
+        for(BlockRow *row = (BlockRow*)mainRows.bytes; row < (BlockRow*)(mainRows.bytes + mainRows.length); row++)
+            highestHeight = MAX(highestHeight, row->height);
+    }
+    else {
 
-        Data existingHash = DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0));
+        int mainCount = 0;
 
-        // if existing hash is smaller than we keep existing hash
-        int cmpResult = DataCompare(DataFlipEndianCopy(hash), DataFlipEndianCopy(existingHash));
+        // One transaction means one journal sync for the whole batch instead of one per header
+        int transaction = mainRows.length && sqlite3_exec(self->database, "begin", NULL, NULL, NULL) == SQLITE_OK;
 
-        if(cmpResult == 0) {
+        for(BlockRow *row = (BlockRow*)mainRows.bytes; row < (BlockRow*)(mainRows.bytes + mainRows.length); row++) {
 
-            // Getting here means there was no change.
+            if(!insertBlockRow(self, row)) {
 
-            sqlite3_finalize(stmt);
-            return 0;
+                row->height = -1;
+                continue;
+            }
+
+            mainCount++;
+            highestHeight = MAX(highestHeight, row->height);
         }
 
-        if(cmpResult > 0) {
+        if(transaction && sqlite3_exec(self->database, "commit", NULL, NULL, NULL) != SQLITE_OK) {
 
-            sqlite3_finalize(stmt);
-            return 0;
+            printf("add blocks commit error: %s\n", sqlite3_errmsg(self->database));
+
+            sqlite3_exec(self->database, "rollback", NULL, NULL, NULL);
+
+            mainCount = 0;
         }
 
-        sqlite3_finalize(stmt);
-        stmt = NULL;
+        addCount += mainCount;
     }
 
-    sqlite3_finalize(stmt);
+    if(addCount)
+        for(BlockRow *row = (BlockRow*)mainRows.bytes; row < (BlockRow*)(mainRows.bytes + mainRows.length); row++)
+            if(row->height >= 0)
+                HeaderIndexSet(&self->headerIndex, row->height, row->hash, row->time, row->bits);
 
-    const char *err = sqlite3_errmsg(self->database);
+    // Only a branch tip from this batch can have overtaken the main chain. The most work wins and ties keep the main chain.
+    int32_t oldHighestHeight = HeaderIndexHighestHeight(&self->headerIndex);
+    ChainWork bestWork = HeaderIndexChainWork(&self->headerIndex, oldHighestHeight);
+    Data bestBranch = DataNull();
+    int32_t forkHeight = -1;
 
-    printf("add merkle error: %s\n", err);
+    for(BlockRow *row = (BlockRow*)rows.bytes; row < (BlockRow*)(rows.bytes + rows.length); row++) {
 
-    return 0;
-}
+        if(!row->side || (row + 1 < (BlockRow*)(rows.bytes + rows.length) && DataEqual(row[1].prevHash, row->hash)))
+            continue;
 
-int numBlocks(Database *self)
-{
-    sqlite3_stmt *stmt = NULL;
+        Data branch;
+        ChainWork work;
 
-    int result = sqlite3_prepare_v2(self->database, "select count(*) from `blocks`", -1, &stmt, NULL);
+        int32_t height = sideBranch(self, sideHeaderOf(self, row->hash), &branch, &work);
 
-    if(result != SQLITE_OK) {
+        if(height >= 0 && ChainWorkCompare(work, bestWork) > 0) {
 
-        sqlite3_finalize(stmt);
-        return 0;
+            bestWork = work;
+            bestBranch = branch;
+            forkHeight = height;
+        }
     }
 
-    result = sqlite3_step(stmt);
-
-    if(result != SQLITE_ROW) {
+    int reorg = bestBranch.length && switchToBranch(self, forkHeight, bestBranch);
 
-        sqlite3_finalize(stmt);
-        return 0;
-    }
+    if(reorg)
+        highestHeight = HeaderIndexHighestHeight(&self->headerIndex);
 
-    int value = sqlite3_column_int(stmt, 0);
+    removeSideHeadersAtOrBelow(self, HeaderIndexHighestHeight(&self->headerIndex) - DATABASE_SIDE_HEADER_DEPTH);
 
-    sqlite3_finalize(stmt);
-    return value;
-}
+    pthread_mutex_unlock(&addBlocksMutex);
 
-Data nthBlockHash(Database *self, int n, int *height)
-{
-    sqlite3_stmt *stmt = NULL;
+    if(reorg) {
 
-    int result = sqlite3_prepare_v2(self->database, "select `hash`, `height` from `blocks` order by `height` desc limit ?,1", -1, &stmt, NULL);
+        Dict dict = DictOneS("forkHeight", DataInt(forkHeight));
 
-    if(result != SQLITE_OK) {
+        DictAddS(&dict, "firstHeight", DataInt(forkHeight + 1));
+        DictAddS(&dict, "lastHeight", DataInt(oldHighestHeight));
 
-        sqlite3_finalize(stmt);
-        return DataNull();
+        NotificationsFire(DatabaseReorgNotification, dict);
     }
 
-    sqlite3_bind_int(stmt, 1, n);
+    if(addCount) {
 
-    result = sqlite3_step(stmt);
+        Dict dict = DictOneS("count", DataInt(addCount));
 
-    if(result != SQLITE_ROW) {
+        DictAddS(&dict, "height", DataInt(highestHeight));
 
-        sqlite3_finalize(stmt);
-        return DataNull();
+        NotificationsFire(DatabaseNewBlockNotification, dict);
     }
 
-    if(height)
-        *height = sqlite3_column_int(stmt, 1);
-
-    Data ret = DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0));
-
-    sqlite3_finalize(stmt);
-
-    return ret;
+    return DTPopi(addCount);
 }
 
-Datas transactionsAtHeight(Database *self, int height)
+// Checkpoints inside the trusted range give way to its full headers
+static int snapshotRows(CheckpointSnapshot *snapshot, Data *rows)
 {
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select `transaction`, `fee`, `rejectCode`, `time` from `transactions` where `height`=?", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
+    Checkpoint *checkpoints = (Checkpoint*)snapshot->checkpoints.bytes;
+    int checkpointCount = snapshot->checkpoints.length / sizeof(Checkpoint);
+    int trustedCount = snapshot->trustedHeaders.length / 80;
 
-        sqlite3_finalize(stmt);
-        return DatasNew();
-    }
-
-    sqlite3_bind_int(stmt, 1, height);
-
-    Datas array = DatasNew();
+    Data prevHash = DataNull();
 
-    while(SQLITE_ROW == (result = sqlite3_step(stmt))) {
+    *rows = DataNew(0);
 
-        Dict dict = DictNew();
+    for(Checkpoint *checkpoint = checkpoints; checkpoint < checkpoints + checkpointCount; checkpoint++) {
 
-        DictAddS(&dict, "data", DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0)));
-        DictAddS(&dict, "fee", DataLong(sqlite3_column_int(stmt, 1)));
-        DictAddS(&dict, "rejectCode", DataInt(sqlite3_column_int(stmt, 2)));
-        DictAddS(&dict, "time", DataLong(sqlite3_column_int(stmt, 3)));
-    }
+        if(trustedCount && checkpoint->height >= snapshot->trustedFirstHeight && checkpoint->height < snapshot->trustedFirstHeight + trustedCount)
+            continue;
 
-    sqlite3_finalize(stmt);
+        if(!checkpoint->time)
+            continue;
 
-    if(result != SQLITE_DONE)
-        return DatasNew();
+        BlockRow row = { checkpoint->height, DataCopy(checkpoint->hash, 32), 0, DataCopy(checkpoint->merkleRoot, 32), checkpoint->time, DataZero(80), checkpoint->bits };
 
-    return array;
-}
+        row.hashPrefix = *(uint32_t*)row.hash.bytes;
 
-int hasBlock(Database *self, Data hash)
-{
-    if(hash.length != 32)
-        return 0;
+        memcpy(row.header.bytes + 36, checkpoint->merkleRoot, 32);
+        memcpy(row.header.bytes + 68, &row.time, sizeof(row.time));
+        memcpy(row.header.bytes + 72, &row.bits, sizeof(row.bits));
 
-    sqlite3_stmt *stmt = NULL;
+        if(checkpoint->height == snapshot->trustedFirstHeight - 1)
+            prevHash = row.hash;
 
-    int result = sqlite3_prepare_v2(self->database, "select `hash` from `blocks` where `hashPrefix`=?", -1, &stmt, NULL);
+        *rows = DataAppend(*rows, DataRaw(row));
+    }
 
-    if(result != SQLITE_OK) {
+    // Trusted means no proof of work checks, but the run must still be one chain
+    for(int i = 0; i < trustedCount; i++) {
 
-        sqlite3_finalize(stmt);
-        return 0;
-    }
+        MerkleBlock block = MerkleBlockNew(DataCopyDataPart(snapshot->trustedHeaders, i * 80, 80));
 
-    sqlite3_bind_int(stmt, 1, *(int32_t*)hash.bytes);
+        if(!blockTimestamp(&block) || (prevHash.length && !DataEqual(blockPrevHash(&block), prevHash)))
+            return 0;
 
-    while(SQLITE_ROW == sqlite3_step(stmt)) {
+        BlockRow row = { snapshot->trustedFirstHeight + i, blockHash(&block), 0, merkleRoot(&block), blockTimestamp(&block), block.data, blockBits(&block) };
 
-        Data data = DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0));
+        row.hashPrefix = *(uint32_t*)row.hash.bytes;
 
-        if(DataEqual(data, hash)) {
+        prevHash = row.hash;
 
-            sqlite3_finalize(stmt);
-            return 1;
-        }
+        *rows = DataAppend(*rows, DataRaw(row));
     }
 
-    sqlite3_finalize(stmt);
-    return 0;
+    return 1;
 }
 
-int32_t DatabaseHeightOf(Database *self, Data hash)
+// Adds the snapshot's headers at heights that are empty. Returns the number added, -1 if the snapshot is inconsistent.
+static int insertSnapshot(Database *self, CheckpointSnapshot *snapshot, DatabaseHeaderStorage storage)
 {
-    if(hash.length != 32)
-        return -1;
+    DataTrackPush();
 
-    int32_t hashPrefix = *(int32_t*)hash.bytes;
+    Data allRows;
 
-    pthread_mutex_lock(&blockHeightCacheMutex);
+    if(!snapshotRows(snapshot, &allRows))
+        return DTPopi(-1);
 
-    Data value = DataCopyData(DictGet(self->blockHeightCache, DataInt(hashPrefix)));
+    Data rows = DataNew(0);
 
-    pthread_mutex_unlock(&blockHeightCacheMutex);
+    for(BlockRow *row = (BlockRow*)allRows.bytes; row < (BlockRow*)(allRows.bytes + allRows.length); row++)
+        if(!HeaderIndexTimeOf(&self->headerIndex, row->height))
+            rows = DataAppend(rows, DataRaw(*row));
 
-    if(DataGetInt(value) > 0)
-        return DataGetInt(value);
-
-    sqlite3_stmt *stmt = NULL;
+    int addCount = 0;
 
-    int result = sqlite3_prepare_v2(self->database, "select `hash`, `height` from `blocks` where `hashPrefix`=?", -1, &stmt, NULL);
+    pthread_mutex_lock(&addBlocksMutex);
 
-    if(result != SQLITE_OK) {
+    if(storage == DatabaseHeaderStorageFlatFile) {
 
-        sqlite3_finalize(stmt);
-        return -1;
+        addCount = storeBlockRows(self, (BlockRow*)rows.bytes, rows.length / sizeof(BlockRow));
     }
+    else if(rows.length && sqlite3_exec(self->database, "begin", NULL, NULL, NULL) == SQLITE_OK) {
 
-    sqlite3_bind_int(stmt, 1, hashPrefix);
-
-    while(SQLITE_ROW == sqlite3_step(stmt)) {
+        for(BlockRow *row = (BlockRow*)rows.bytes; row < (BlockRow*)(rows.bytes + rows.length); row++) {
 
-        Data data = DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0));
-
-        if(DataEqual(data, hash)) {
+            if(insertBlockRow(self, row))
+                addCount++;
+            else
+                row->height = -1;
+        }
 
-            int height = sqlite3_column_int(stmt, 1);
+        if(sqlite3_exec(self->database, "commit", NULL, NULL, NULL) != SQLITE_OK) {
 
-            pthread_mutex_lock(&blockHeightCacheMutex);
+            printf("snapshot commit error: %s\n", sqlite3_errmsg(self->database));
 
-            Data num = DictGet(self->blockHeightCache, DataInt(hashPrefix));
+            sqlite3_exec(self->database, "rollback", NULL, NULL, NULL);
 
-            trimBlockHeightCacheIfNeeded(self);
+            addCount = 0;
+        }
+    }
 
-            // The code area below as revealed as CPU intensive during block downloading,
-            // therefore it has been optimized and may take more effort to read.
+    if(addCount)
+        for(BlockRow *row = (BlockRow*)rows.bytes; row < (BlockRow*)(rows.bytes + rows.length); row++)
+            if(row->height >= 0)
+                HeaderIndexSet(&self->headerIndex, row->height, row->hash, row->time, row->bits);
 
-            if(num.length) {
+    pthread_mutex_unlock(&addBlocksMutex);
 
-                Data key = DataNewUntracked(sizeof(hashPrefix));
-                Data value = DataNewUntracked(sizeof(height));
+    return DTPopi(addCount);
+}
 
-                *(int32_t*)key.bytes = hashPrefix;
-                *(int32_t*)value.bytes = -1;
+int DatabaseLoadSnapshot(Database *self, Data snapshotData)
+{
+    CheckpointSnapshot snapshot;
 
-                self->blockHeightCache = DictionaryAddRefUntracked(self->blockHeightCache, key, value);
-            }
-            else {
+    if(!CheckpointSnapshotParse(snapshotData, &snapshot) || snapshot.testnet != (DataGetInt(bsLoad("testnet")) ? 1 : 0))
+        return -1;
 
-                Data key = DataNewUntracked(sizeof(hashPrefix));
-                Data value = DataNewUntracked(sizeof(height));
+    int addCount = insertSnapshot(self, &snapshot, self->headerStorage);
 
-                *(int32_t*)key.bytes = hashPrefix;
-                *(int32_t*)value.bytes = height;
+    if(addCount > 0) {
 
-                self->blockHeightCache = DictionaryAddRefUntracked(self->blockHeightCache, key, value);
-            }
+        Dict dict = DictOneS("count", DataInt(addCount));
 
-            pthread_mutex_unlock(&blockHeightCacheMutex);
+        DictAddS(&dict, "height", DataInt(HeaderIndexHighestHeight(&self->headerIndex)));
 
-            sqlite3_finalize(stmt);
-            return height;
-        }
+        NotificationsFire(DatabaseNewBlockNotification, dict);
     }
 
-    if(DataEqual(hash, DatabaseFirstBlockHash(self))) {
+    return addCount;
+}
 
-        sqlite3_finalize(stmt);
+int DatabaseAddBlock(Database *self, MerkleBlock *block)
+{
+    if(!MerkleBlockValid(block))
         return 0;
-    }
 
-    sqlite3_finalize(stmt);
-    return -1;
+    return DatabaseAddBlocks(self, DatasAddRef(DatasNew(), block->data)) > 0;
 }
 
-int32_t DatabaseHighestHeight(Database *self)
+int DatabaseNumBlocks(Database *self)
 {
-    sqlite3_stmt *stmt = NULL;
+    return HeaderIndexCount(&self->headerIndex);
+}
 
-    int result = sqlite3_prepare_v2(self->database, "select max(`height`) from `blocks`", -1, &stmt, NULL);
+Data DatabaseNthBlockHash(Database *self, int n, int *height)
+{
+    int32_t h = HeaderIndexHighestHeight(&self->headerIndex);
 
-    if(result != SQLITE_OK) {
+    for(int i = 0; i < n && h >= 0; i++)
+        h = HeaderIndexHeightBelow(&self->headerIndex, h);
 
-        sqlite3_finalize(stmt);
-        return 0;
-    }
+    if(h < 0)
+        return DataNull();
 
-    result = sqlite3_step(stmt);
+    if(height)
+        *height = h;
 
-    if(result != SQLITE_ROW) {
+    return HeaderIndexHashOf(&self->headerIndex, h);
+}
 
-        sqlite3_finalize(stmt);
-        return 0;
-    }
+Datas transactionsAtHeight(Database *self, int height)
+{
+    sqlite3_stmt *stmt = statement(self, StatementTransactionsAtHeight);
 
-    int height = sqlite3_column_int(stmt, 0);
+    if(!stmt)
+        return DatasNew();
 
-    sqlite3_finalize(stmt);
-    return height;
-}
+    sqlite3_bind_int(stmt, 1, height);
 
-int32_t DatabaseHighestHeightOrLowestMissingAfter(Database *self, uint32_t timestamp)
-{
-    sqlite3_stmt *stmt = NULL;
+    Datas array = DatasNew();
 
-    int32_t height = DatabaseHighestBlockBeforeTime(self, timestamp);
+    int result;
 
-    int result = sqlite3_prepare_v2(self->database, "select `height` from `blocks` where `height`>? order by `height`", -1, &stmt, NULL);
+    while(SQLITE_ROW == (result = sqlite3_step(stmt))) {
 
-    if(result != SQLITE_OK) {
+        Dict dict = DictNew();
 
-        sqlite3_finalize(stmt);
-        return 0;
+        DictAddS(&dict, "data", DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0)));
+        DictAddS(&dict, "fee", DataLong(sqlite3_column_int(stmt, 1)));
+        DictAddS(&dict, "rejectCode", DataInt(sqlite3_column_int(stmt, 2)));
+        DictAddS(&dict, "time", DataLong(sqlite3_column_int(stmt, 3)));
     }
 
-    sqlite3_bind_int(stmt, 1, height);
-
-    for(int32_t i = height + 1; (result = sqlite3_step(stmt)) == SQLITE_ROW; i++) {
+    statementDone(self, stmt);
 
-        if(i != sqlite3_column_int(stmt, 0)) {
+    if(result != SQLITE_DONE)
+        return DatasNew();
 
-            sqlite3_finalize(stmt);
-            return i - 1;
-        }
-    }
+    return array;
+}
 
-    sqlite3_finalize(stmt);
-    return DatabaseHighestHeight(self);
+int DatabaseHasBlock(Database *self, Data hash)
+{
+    return DatabaseHeightOf(self, hash) >= 0;
 }
 
-uint32_t timeOfHeight(Database *self, int32_t height)
+int32_t DatabaseHeightOf(Database *self, Data hash)
 {
-    if(height < 1)
-        return 0;
+    if(hash.length != 32)
+        return -1;
 
-    sqlite3_stmt *stmt = NULL;
+    int32_t height = HeaderIndexHeightOf(&self->headerIndex, hash);
 
-    int result = sqlite3_prepare_v2(self->database, "select `time` from `blocks` where `height`=?", -1, &stmt, NULL);
+    if(height < 0 && DataEqual(hash, DatabaseFirstBlockHash(self)))
+        return 0;
 
-    if(result != SQLITE_OK) {
+    return height;
+}
 
-        sqlite3_finalize(stmt);
-        return 0;
-    }
+int32_t DatabaseHighestHeight(Database *self)
+{
+    return MAX(HeaderIndexHighestHeight(&self->headerIndex), 0);
+}
 
-    sqlite3_bind_int(stmt, 1, height);
+int32_t DatabaseHighestHeightOrLowestMissingAfter(Database *self, uint32_t timestamp)
+{
+    int32_t height = DatabaseHighestBlockBeforeTime(self, timestamp);
+    int32_t highest = DatabaseHighestHeight(self);
 
-    result = sqlite3_step(stmt);
+    for(int32_t i = height + 1; i <= highest; i++)
+        if(!HeaderIndexTimeOf(&self->headerIndex, i))
+            return i - 1;
+
+    return highest;
+}
 
-    uint32_t value = (uint32_t)sqlite3_column_int64(stmt, 0);
+uint32_t DatabaseTimeOfHeight(Database *self, int32_t height)
+{
+    if(height < 1)
+        return 0;
 
-    sqlite3_finalize(stmt);
-    return value;
+    return HeaderIndexTimeOf(&self->headerIndex, height);
 }
 
-Data DatabaseHashOf(Database *self, int32_t height)
+Data DatabaseMerkleRootOf(Database *self, int32_t height)
 {
-    sqlite3_stmt *stmt = NULL;
+    if(self->headerStorage == DatabaseHeaderStorageFlatFile) {
 
-    int result = sqlite3_prepare_v2(self->database, "select `hash` from `blocks` where `height`=?", -1, &stmt, NULL);
+        Data header = HeaderStoreHeader(&self->headerStore, height);
 
-    if(result != SQLITE_OK) {
+        return header.length ? DataCopyDataPart(header, 36, 32) : DataNull();
+    }
 
-        sqlite3_finalize(stmt);
+    sqlite3_stmt *stmt = statement(self, StatementMerkleRootOf);
+
+    if(!stmt)
         return DataNull();
-    }
 
     sqlite3_bind_int(stmt, 1, height);
 
-    result = sqlite3_step(stmt);
+    Data result = DataNull();
 
-    if(result != SQLITE_ROW) {
+    if(sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_bytes(stmt, 0) == 32)
+        result = DataCopy(sqlite3_column_blob(stmt, 0), 32);
 
-        sqlite3_finalize(stmt);
-        return DataNull();
-    }
+    statementDone(self, stmt);
 
-    Data data = DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0));
+    return result;
+}
 
-    sqlite3_finalize(stmt);
-    return data;
+Data DatabaseHashOf(Database *self, int32_t height)
+{
+    return HeaderIndexHashOf(&self->headerIndex, height);
+}
+
+uint32_t DatabaseBitsOf(Database *self, int32_t height)
+{
+    return HeaderIndexBitsOf(&self->headerIndex, height);
 }
 
 static pthread_mutex_t nodeListCacheMutex = PTHREAD_MUTEX_INITIALIZER;
@@ -708,20 +1428,17 @@ Datas/*Dict*/ DatabaseNodeList(Database *self, int testnet)
     if(cacheResult.count)
         return cacheResult;
 
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select `id`, `ip`, `port`, `services`, `date`, `testnet`, `manual`, `master` from `nodes` where testnet=? order by `manual` desc, `date` desc", -1, &stmt, NULL);
+    sqlite3_stmt *stmt = statement(self, StatementNodeList);
 
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return DatasNew();
-    }
 
     sqlite3_bind_int(stmt, 1, testnet ? 1 : 0);
 
     Datas array = DatasNew();
 
+    int result;
+
     while((result = sqlite3_step(stmt)) == SQLITE_ROW) {
 
         Data data = DataCopy(sqlite3_column_blob(stmt, 1), sqlite3_column_bytes(stmt, 1));
@@ -754,7 +1471,7 @@ Datas/*Dict*/ DatabaseNodeList(Database *self, int testnet)
 
     pthread_mutex_unlock(&nodeListCacheMutex);
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
 
     if(result != SQLITE_DONE)
         return DatasNull();
@@ -773,29 +1490,24 @@ int32_t DatabaseNodeListCount(Database *self, int testnet)
     if(count)
         return count;
 
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select count(*) from `nodes` where testnet=?", -1, &stmt, NULL);
+    sqlite3_stmt *stmt = statement(self, StatementNodeCount);
 
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return 0;
-    }
 
     sqlite3_bind_int(stmt, 1, testnet ? 1 : 0);
 
-    result = sqlite3_step(stmt);
+    int result = sqlite3_step(stmt);
 
     if(result != SQLITE_ROW) {
 
-        sqlite3_finalize(stmt);
+        statementDone(self, stmt);
         return 0;
     }
 
     int value = sqlite3_column_int(stmt, 0);
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
     return value;
 }
 
@@ -823,15 +1535,10 @@ Dict nodeForIp(Database *self, String ip, int testnet)
 
 int DatabaseAddNode(Database *self, Dict node)
 {
-    sqlite3_stmt *stmt = NULL;
+    sqlite3_stmt *stmt = statement(self, StatementInsertNode);
 
-    int result = sqlite3_prepare_v2(self->database, "insert into `nodes` ( `ip`, `port`, `services`, `date`, `testnet`, `manual`, `master` ) values (?, ?, ?, ?, ?, ?, ?)", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return 0;
-    }
 
     String ipData = DictGetS(node, nodeListIpKey);
 
@@ -845,11 +1552,11 @@ int DatabaseAddNode(Database *self, Dict node)
 
     pthread_mutex_lock(&nodeListCacheMutex);
 
-    result = sqlite3_step(stmt);
+    int result = sqlite3_step(stmt);
 
     int64_t insertId = sqlite3_last_insert_rowid(self->database);
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
 
     if(result == SQLITE_DONE) {
 
@@ -878,19 +1585,14 @@ int DatabaseAddNode(Database *self, Dict node)
 
 int DatabaseRemoveNode(Database *self, int32_t index)
 {
-    sqlite3_stmt *stmt = NULL;
+    sqlite3_stmt *stmt = statement(self, StatementDeleteNode);
 
-    int result = sqlite3_prepare_v2(self->database, "delete from `nodes` where `id`=? limit 1", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return 0;
-    }
 
     sqlite3_bind_int(stmt, 1, index);
 
-    result = sqlite3_step(stmt);
+    int result = sqlite3_step(stmt);
 
     pthread_mutex_lock(&nodeListCacheMutex);
 
@@ -911,25 +1613,20 @@ int DatabaseRemoveNode(Database *self, int32_t index)
 
     NotificationsFire(DatabaseNodeListChangedNotification, DictNew());
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
     return result == SQLITE_DONE;
 }
 
 int DatabaseRemoveNodeByIp(Database *self, String ip)
 {
-    sqlite3_stmt *stmt = NULL;
+    sqlite3_stmt *stmt = statement(self, StatementDeleteNodeByIp);
 
-    int result = sqlite3_prepare_v2(self->database, "delete from `nodes` where `ip`=?", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return 0;
-    }
 
     sqlite3_bind_blob(stmt, 1, ip.bytes, (uint32_t)strlen(ip.bytes), NULL);
 
-    result = sqlite3_step(stmt);
+    int result = sqlite3_step(stmt);
 
     pthread_mutex_lock(&nodeListCacheMutex);
 
@@ -948,63 +1645,18 @@ int DatabaseRemoveNodeByIp(Database *self, String ip)
 
     pthread_mutex_unlock(&nodeListCacheMutex);
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
     return result == SQLITE_DONE;
 }
 
 int32_t DatabaseNearestHeight(Database *self, int32_t height)
 {
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select max(`height`) from `blocks` where `height`<?", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    sqlite3_bind_int(stmt, 1, height);
-
-    result = sqlite3_step(stmt);
-
-    if(result != SQLITE_ROW) {
-
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    int lowerValue = sqlite3_column_int(stmt, 0);
-
-    sqlite3_finalize(stmt);
-    stmt = NULL;
+    int32_t lowerValue = MAX(HeaderIndexHeightBelow(&self->headerIndex, height), 0);
+    int32_t upperValue = HeaderIndexHeightAtOrAbove(&self->headerIndex, height);
 
-    result = sqlite3_prepare_v2(self->database, "select min(`height`) from `blocks` where `height`>=?", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    sqlite3_bind_int(stmt, 1, height);
-
-    result = sqlite3_step(stmt);
-
-    if(result != SQLITE_ROW) {
-
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    int upperValue = sqlite3_column_int(stmt, 0);
-
-    if(!upperValue)
+    if(upperValue < 0)
         return lowerValue;
 
-    sqlite3_finalize(stmt);
-    stmt = NULL;
-
     if(height - lowerValue < upperValue - height)
         return lowerValue;
 
@@ -1013,137 +1665,29 @@ int32_t DatabaseNearestHeight(Database *self, int32_t height)
 
 int32_t DatabaseHighestBlockBeforeTime(Database *self, uint32_t timestamp)
 {
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select max(`height`) from `blocks` where `time`<?", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    sqlite3_bind_int(stmt, 1, timestamp);
-
-    result = sqlite3_step(stmt);
-
-    if(result != SQLITE_ROW) {
-
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    int height = sqlite3_column_int(stmt, 0);
-
-    sqlite3_finalize(stmt);
-    return height;
+    return MAX(HeaderIndexHeightBeforeTime(&self->headerIndex, timestamp), 0);
 }
 
 int32_t DatabaseNearestHeightToTime(Database *self, uint32_t timestamp)
 {
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select max(`height`) from `blocks` where `time`<?", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    sqlite3_bind_int(stmt, 1, timestamp);
-
-    result = sqlite3_step(stmt);
-
-    if(result != SQLITE_ROW) {
-
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    int lowerValue = sqlite3_column_int(stmt, 0);
-
-    sqlite3_finalize(stmt);
-    stmt = NULL;
-
-    result = sqlite3_prepare_v2(self->database, "select min(`height`) from `blocks` where `time`>=?", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
+    int32_t lowerValue = HeaderIndexHeightBeforeTime(&self->headerIndex, timestamp);
+    int32_t upperValue = HeaderIndexHeightAtOrAbove(&self->headerIndex, lowerValue + 1);
 
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    sqlite3_bind_int(stmt, 1, timestamp);
-
-    result = sqlite3_step(stmt);
-
-    if(result != SQLITE_ROW) {
+    if(lowerValue < 0 || upperValue < 0)
+        return MAX(MAX(lowerValue, upperValue), 0);
 
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    int upperValue = sqlite3_column_int(stmt, 0);
+    uint32_t lowerTime = HeaderIndexTimeOf(&self->headerIndex, lowerValue);
+    uint32_t upperTime = HeaderIndexTimeOf(&self->headerIndex, upperValue);
 
-    if(!upperValue)
+    if(timestamp - lowerTime <= upperTime - timestamp)
         return lowerValue;
 
-    sqlite3_finalize(stmt);
-    stmt = NULL;
-
-    result = sqlite3_prepare_v2(self->database, "select `height` from `blocks` where `height` in (?, ?) order by abs(? - `time`) limit 1", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    sqlite3_bind_int(stmt, 1, lowerValue);
-    sqlite3_bind_int(stmt, 2, upperValue);
-    sqlite3_bind_int(stmt, 3, timestamp);
-
-    result = sqlite3_step(stmt);
-
-    if(result != SQLITE_ROW) {
-
-        sqlite3_finalize(stmt);
-        return 0;
-    }
-
-    int ret = sqlite3_column_int(stmt, 0);
-
-    sqlite3_finalize(stmt);
-    return ret;
+    return upperValue;
 }
 
 Datas DatabaseBlockHashesAbove(Database *self, int32_t height, int32_t limit)
 {
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select `hash` from `blocks` where `height`>? order by `height` asc limit ?", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
-        return DatasNew();
-    }
-
-    sqlite3_bind_int(stmt, 1, height);
-    sqlite3_bind_int(stmt, 2, limit);
-
-    Datas array = DatasNew();
-
-    while((result = sqlite3_step(stmt)) == SQLITE_ROW)
-        array = DatasAddCopy(array, DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0)));
-
-    sqlite3_finalize(stmt);
-
-    if(result != SQLITE_DONE)
-        return DatasNew();
-    
-    return array;
+    return HeaderIndexHashesAbove(&self->headerIndex, height, limit);
 }
 
 int32_t DatabaseConfirmations(Database *self, Data data)
@@ -1279,14 +1823,22 @@ Datas DatabaseTransactionsWithNoFee(Database *self, Datas hashes)
     for(int i = 0; i < hashes.count; i++)
         sqlite3_bind_blob(stmt, i + 1, hashes.ptr[i].bytes, (int)hashes.ptr[i].length, NULL);
 
+    Datas sortedHashes = DatasNew();
+
+    for(int i = 0; i < hashes.count; i++)
+        if(hashes.ptr[i].length == 32)
+            sortedHashes = DatasAddRef(sortedHashes, hashes.ptr[i]);
+
+    sortedHashes = DatasSortHashes(sortedHashes);
+
     Datas array = DatasNew();
 
     while((result = sqlite3_step(stmt)) == SQLITE_ROW) {
 
-        Data hash = DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0));
+        Data hash = DataRef((void*)sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0));
         Data data = DataCopy(sqlite3_column_blob(stmt, 1), sqlite3_column_bytes(stmt, 1));
 
-        if(DatasHasMatchingData(hashes, hash))
+        if(DatasSearchHashIndex(sortedHashes, hash) >= 0)
             array = DatasAddCopy(array, data);
     }
 
@@ -1296,46 +1848,36 @@ Datas DatabaseTransactionsWithNoFee(Database *self, Datas hashes)
 
 int DatabaseSetTransaction(Database *self, Data hash, int code)
 {
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "update `transactions` set `rejectCode`=? where `hashPrefix`=? and `hash`=? limit 1", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
+    sqlite3_stmt *stmt = statement(self, StatementSetRejectCode);
 
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return 0;
-    }
 
     sqlite3_bind_int64(stmt, 1, code);
     sqlite3_bind_int(stmt, 2, *(int32_t*)hash.bytes);
     sqlite3_bind_blob(stmt, 3, hash.bytes, (int)hash.length, NULL);
 
-    result = sqlite3_step(stmt);
+    int result = sqlite3_step(stmt);
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
 
     return result == SQLITE_DONE;
 }
 
 int DatabaseRecordTransactionFee(Database *self, Data hash, uint64_t fee)
 {
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "update `transactions` set `fee`=? where `hashPrefix`=? and `hash`=? limit 1", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
+    sqlite3_stmt *stmt = statement(self, StatementSetFee);
 
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return 0;
-    }
 
     sqlite3_bind_int64(stmt, 1, fee);
     sqlite3_bind_int(stmt, 2, *(int32_t*)hash.bytes);
     sqlite3_bind_blob(stmt, 3, hash.bytes, (int)hash.length, NULL);
 
-    result = sqlite3_step(stmt);
+    int result = sqlite3_step(stmt);
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
 
     return result == SQLITE_DONE;
 }
@@ -1344,15 +1886,10 @@ int DatabaseAddTransaction(Database *self, Data data, MerkleBlock *block)
 {
     int32_t height = DatabaseHeightOf(self, blockHash(block));
 
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "insert into `transactions` (`height`, `hash`, `hashPrefix`, `transaction`) values (?, ?, ?, ?)", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
+    sqlite3_stmt *stmt = statement(self, StatementInsertTransaction);
 
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return 0;
-    }
 
     Data hash = hash256(data);
 
@@ -1361,23 +1898,26 @@ int DatabaseAddTransaction(Database *self, Data data, MerkleBlock *block)
     sqlite3_bind_int(stmt, 3, *(int32_t*)hash.bytes);
     sqlite3_bind_blob(stmt, 4, data.bytes, (int)data.length, NULL);
 
-    result = sqlite3_step(stmt);
+    int result = sqlite3_step(stmt);
 
     if(result == SQLITE_CONSTRAINT && height > 0) {
 
-        sqlite3_finalize(stmt);
-        stmt = NULL;
-
-        result = sqlite3_prepare_v2(self->database, "update `transactions` set `height`=?, `time` = MIN(`transactions`.`time`, (select `time` from `blocks` where `height`=? limit 1)) where `hashPrefix`=? and `hash`=? limit 1", -1, &stmt, NULL);
+        statementDone(self, stmt);
 
-        if(result != SQLITE_OK) {
+        stmt = statement(self, StatementConfirmTransaction);
 
-            sqlite3_finalize(stmt);
+        if(!stmt)
             return 0;
-        }
+
+        uint32_t blockTime = DatabaseTimeOfHeight(self, height);
 
         sqlite3_bind_int(stmt, 1, height);
-        sqlite3_bind_int(stmt, 2, height);
+
+        if(blockTime)
+            sqlite3_bind_int64(stmt, 2, blockTime);
+        else
+            sqlite3_bind_null(stmt, 2);
+
         sqlite3_bind_int(stmt, 3, *(int32_t*)hash.bytes);
         sqlite3_bind_blob(stmt, 4, hash.bytes, (int)hash.length, NULL);
 
@@ -1386,13 +1926,13 @@ int DatabaseAddTransaction(Database *self, Data data, MerkleBlock *block)
 
     if(result != SQLITE_DONE) {
 
-        sqlite3_finalize(stmt);
+        statementDone(self, stmt);
         return 0;
     }
 
     NotificationsFire(DatabaseNewTxNotification, DictNew());
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
     return 1;
 }
 
@@ -1401,56 +1941,70 @@ int DatabaseDeleteTransaction(Database *self, Data hash)
     if(hash.length < 32)
         return 0;
 
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "delete from `transactions` where `hashPrefix`=? and `hash`=? limit 1", -1, &stmt, NULL);
+    sqlite3_stmt *stmt = statement(self, StatementDeleteTransaction);
 
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return 0;
-    }
 
     sqlite3_bind_int(stmt, 1, *(int32_t*)hash.bytes);
     sqlite3_bind_blob(stmt, 2, hash.bytes, (int)hash.length, NULL);
 
-    result = sqlite3_step(stmt);
+    int result = sqlite3_step(stmt);
 
     NotificationsFire(DatabaseNewTxNotification, DictNew());
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
     return result == SQLITE_DONE ? 1 : 0;
 }
 
+int DatabaseUnconfirmTransactions(Database *self, int32_t firstHeight, int32_t lastHeight)
+{
+    sqlite3_stmt *stmt = statement(self, StatementUnconfirmTransactions);
+
+    if(!stmt)
+        return 0;
+
+    sqlite3_bind_int(stmt, 1, firstHeight);
+    sqlite3_bind_int(stmt, 2, lastHeight);
+
+    int result = sqlite3_step(stmt);
+    int count = sqlite3_changes(self->database);
+
+    statementDone(self, stmt);
+
+    if(result != SQLITE_DONE)
+        return 0;
+
+    if(count)
+        NotificationsFire(DatabaseNewTxNotification, DictNew());
+
+    return count;
+}
+
 Data DatabaseTransactionForHash(Database *self, Data hash)
 {
     if(hash.length < 32)
         return DataNull();
 
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select `transaction` from `transactions` where `hashPrefix`=? and `hash`=? limit 1", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
+    sqlite3_stmt *stmt = statement(self, StatementTransactionForHash);
 
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return DataNull();
-    }
 
     sqlite3_bind_int(stmt, 1, *(int32_t*)hash.bytes);
     sqlite3_bind_blob(stmt, 2, hash.bytes, (int)hash.length, NULL);
 
-    result = sqlite3_step(stmt);
+    int result = sqlite3_step(stmt);
 
     if(result != SQLITE_ROW) {
 
-        sqlite3_finalize(stmt);
+        statementDone(self, stmt);
         return DataNull();
     }
 
     Data ret = DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0));
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
 
     return ret;
 }
@@ -1463,18 +2017,15 @@ int32_t DatabaseTransactionHeight(Database *self, Data hash)
     if(hash.length < 32)
         return -1;
 
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select `hash`, `height` from `transactions` where `hashPrefix`=?", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
+    sqlite3_stmt *stmt = statement(self, StatementTransactionsWithPrefix);
 
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return -1;
-    }
 
     sqlite3_bind_int(stmt, 1, *(int32_t*)hash.bytes);
 
+    int result;
+
     while((result = sqlite3_step(stmt)) == SQLITE_ROW) {
 
         Data candidateHash = DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0));
@@ -1482,12 +2033,12 @@ int32_t DatabaseTransactionHeight(Database *self, Data hash)
 
         if(DataEqual(hash, candidateHash)) {
 
-            sqlite3_finalize(stmt);
+            statementDone(self, stmt);
             return height;
         }
     }
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
     return -1;
 }
 
@@ -1496,30 +2047,25 @@ uint32_t DatabaseTransactionTime(Database *self, Data hash)
     if(hash.length < 32)
         return 0;
 
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select `time` from `transactions` where `hashPrefix`=? and `hash`=?", -1, &stmt, NULL);
+    sqlite3_stmt *stmt = statement(self, StatementTransactionTime);
 
-    if(result != SQLITE_OK) {
-
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return 0;
-    }
 
     sqlite3_bind_int(stmt, 1, *(int32_t*)hash.bytes);
     sqlite3_bind_blob(stmt, 2, hash.bytes, (int)hash.length, NULL);
 
-    result = sqlite3_step(stmt);
+    int result = sqlite3_step(stmt);
 
     if(result != SQLITE_ROW) {
 
-        sqlite3_finalize(stmt);
+        statementDone(self, stmt);
         return 0;
     }
 
     uint32_t ret = (uint32_t)sqlite3_column_int64(stmt, 0);
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
 
     return ret;
 }
@@ -1531,20 +2077,17 @@ Datas DatabaseAllTransactions(Database *self)
 
     Datas array = DatasNew();
 
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select `transaction` from `transactions`", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
+    sqlite3_stmt *stmt = statement(self, StatementAllTransactions);
 
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return DatasNew();
-    }
+
+    int result;
 
     while((result = sqlite3_step(stmt)) == SQLITE_ROW)
         array = DatasAddCopy(array, DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0)));
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
 
     if(result != SQLITE_DONE)
         return DatasNew();
@@ -1556,20 +2099,17 @@ Datas DatabaseTransactionsToPublish(Database *self)
 {
     Datas array = DatasNew();
 
-    sqlite3_stmt *stmt = NULL;
-
-    int result = sqlite3_prepare_v2(self->database, "select `transaction` from `transactions` where height<1 and time>strftime('%s', 'now')-60*60*24*3", -1, &stmt, NULL);
-
-    if(result != SQLITE_OK) {
+    sqlite3_stmt *stmt = statement(self, StatementTransactionsToPublish);
 
-        sqlite3_finalize(stmt);
+    if(!stmt)
         return DatasNew();
-    }
+
+    int result;
 
     while((result = sqlite3_step(stmt)) == SQLITE_ROW)
         array = DatasAddCopy(array, DataCopy(sqlite3_column_blob(stmt, 0), sqlite3_column_bytes(stmt, 0)));
 
-    sqlite3_finalize(stmt);
+    statementDone(self, stmt);
 
     if(result != SQLITE_DONE)
         return DatasNew();
@@ -1577,16 +2117,18 @@ Datas DatabaseTransactionsToPublish(Database *self)
     return array;
 }
 
-static Data blockZero;
-static Data blockZeroTestnet;
+// Static bytes so the first call leaves nothing allocated behind
+static uint8_t blockZero[32];
+static uint8_t blockZeroTestnet[32];
 
 static void firstBlockHash()
 {
-    blockZeroTestnet = DataFlipEndianCopy(fromHex("000000000933ea01ad0ee984209779baaec3ced90fa3f408719526f8d77f4943"));
-    blockZero = DataFlipEndianCopy(fromHex("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f"));
+    DataTrackPush();
+
+    memcpy(blockZeroTestnet, DataFlipEndianCopy(fromHex("000000000933ea01ad0ee984209779baaec3ced90fa3f408719526f8d77f4943")).bytes, 32);
+    memcpy(blockZero, DataFlipEndianCopy(fromHex("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f")).bytes, 32);
 
-    DataUntrack(blockZeroTestnet);
-    DataUntrack(blockZero);
+    DataTrackPop();
 }
 
 Data DatabaseFirstBlockHash(Database *self)
@@ -1597,8 +2139,8 @@ Data DatabaseFirstBlockHash(Database *self)
     
     if(DataGetInt(bsLoad("testnet"))) {
 
-        return blockZeroTestnet;
+        return DataRef(blockZeroTestnet, sizeof(blockZeroTestnet));
     }
 
-    return blockZero;
+    return DataRef(blockZero, sizeof(blockZero));
 }
@@ -4,6 +4,8 @@
 #include "Node.h"
 #include "MerkleBlock.h"
 #include "Data.h"
+#include "HeaderIndex.h"
+#include "HeaderStore.h"
 #include "WorkQueue.h"
 #include <pthread.h>
 
@@ -18,8 +20,18 @@ extern const char *nodeListMasterNodeKey;
 
 extern const char *DatabaseNewTxNotification;
 extern const char *DatabaseNewBlockNotification;
+extern const char *DatabaseReorgNotification; // "forkHeight", then "firstHeight" through "lastHeight" were disconnected
 extern const char *DatabaseNodeListChangedNotification;
 
+#define DATABASE_MAX_STATEMENTS 48
+
+typedef enum DatabaseHeaderStorage {
+
+    DatabaseHeaderStorageSqlite, // Rows in the 'blocks' table
+    DatabaseHeaderStorageFlatFile, // A HeaderStore (headers.dat) next to the database, transactions and nodes stay in sqlite
+
+} DatabaseHeaderStorage;
+
 typedef struct Database {
 
     pthread_t workThread;
@@ -27,8 +39,16 @@ typedef struct Database {
     WorkQueue workQueue;
 
     void *database;
-    Dictionary blockHeightCache;
+    void *readDatabase; // Second connection for lookups so they don't queue behind writes
+    HeaderIndex headerIndex; // Every block header's height, hash and time, mirrors the header storage
+
+    DatabaseHeaderStorage headerStorage;
+    HeaderStore headerStore; // Only open for DatabaseHeaderStorageFlatFile
+    Data sideHeaders; // Headers of competing branches, off the main chain
     Datas nodeListCache;
+
+    void *statements[DATABASE_MAX_STATEMENTS]; // Prepared on first use and reused
+    pthread_mutex_t statementLocks[DATABASE_MAX_STATEMENTS];
 } Database;
 
 typedef struct TransactionTimeDelta {
@@ -43,7 +63,9 @@ typedef struct TransactionTimeDelta {
 extern Database database;
 extern const char *databaseRootPath;
 
-Database DatabaseNew();
+Database DatabaseNew(); // Keeps headers in sqlite
+Database DatabaseNewWithHeaderStorage(DatabaseHeaderStorage headerStorage);
+void DatabaseFree(Database *db); // Finalizes cached statements and closes the database
 
 // Performs 'onWorkThread' on the work thread.
 void DatabaseExecute(Database *db, void (*onWorkThread)(Database *db, Dict dict), Dict dict);
@@ -53,9 +75,21 @@ int DatabaseResetAllBlocks(Database *db);
 
 int DatabaseAnalyze(Database *db);
 
-// If this is a duplicate, the smaller hash replaces the larger
 int DatabaseAddBlock(Database *db, MerkleBlock *block);
 
+// Adds a run of block headers (as from a 'headers' message) in one transaction. Returns the number added.
+// Fires a single DatabaseNewBlockNotification with "count" and "height" (the highest added) for the batch.
+// Returns -1 without adding anything if any header fails proof of work or difficulty retargeting.
+// Headers competing with the main chain are kept as side headers. When a branch has more chain work than
+// the main chain, the heights above the fork are rewritten with it and DatabaseReorgNotification fires.
+int DatabaseAddBlocks(Database *db, Datas headers);
+
+// Adds the headers of a checkpoint snapshot (see Checkpoints.h) at heights the database doesn't have yet.
+// A fresh database starts from the bundled snapshot. One with a trusted header range past the wallet's
+// creation date lets header sync start at the end of that range. Returns the number added, -1 if the
+// snapshot is malformed or for the other network.
+int DatabaseLoadSnapshot(Database *db, Data snapshot);
+
 int DatabaseNumBlocks(Database *db);
 Data DatabaseNthBlockHash(Database *db, int n, int *height);
 Datas DatabaseTransactionsAtHeight(Database *db, int height); // Array of dictionaries. Keys are: data, fee, rejectCode, time
@@ -64,11 +98,13 @@ int DatabaseHasBlock(Database *db, Data hash);
 
 int32_t DatabaseHeightOf(Database *db, Data hash); // Returns -1 if not found.
 Data DatabaseHashOf(Database *db, int32_t height);
+uint32_t DatabaseBitsOf(Database *db, int32_t height); // 0 if unknown, as for checkpoints until their header arrives
 
 int32_t DatabaseHighestHeight(Database *db);
 int32_t DatabaseHighestHeightOrLowestMissingAfter(Database *db, uint32_t timestamp);
 
 uint32_t DatabaseTimeOfHeight(Database *db, int32_t height);
+Data DatabaseMerkleRootOf(Database *db, int32_t height); // DataNull if not found
 
 int32_t DatabaseNearestHeight(Database *db, int32_t height);
 int32_t DatabaseHighestBlockBeforeTime(Database *db, uint32_t timestamp);
@@ -102,6 +138,7 @@ int DatabaseSetTransaction(Database *db, Data hash, int rejectCode);
 int DatabaseRecordTransactionFee(Database *db, Data transactionHash, uint64_t fee);
 int DatabaseAddTransaction(Database *db, Data data, MerkleBlock *block); // block can be NULL
 int DatabaseDeleteTransaction(Database *db, Data hash);
+int DatabaseUnconfirmTransactions(Database *db, int32_t firstHeight, int32_t lastHeight); // Returns the number unconfirmed
 
 // Note this the whole hash not just txid!!
 Data DatabaseTransactionForHash(Database *db, Data hash);
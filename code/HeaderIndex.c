@@ -0,0 +1,446 @@
+#include "HeaderIndex.h"
+#include <string.h>
+#include <stdlib.h>
+
+#define HEADER_INDEX_INITIAL_SLOTS 1024
+
+#define ENTRIES(index) ((HeaderIndexEntry*)(index)->entries.bytes)
+#define ENTRY_COUNT(index) ((int32_t)((index)->entries.length / sizeof(HeaderIndexEntry)))
+#define SLOTS(index) ((int32_t*)(index)->slots.bytes)
+#define SLOT_MASK(index) ((uint32_t)((index)->slots.length / sizeof(int32_t)) - 1)
+
+static Data emptySlots(uint32_t count)
+{
+    Data data = DataNewUntracked(count * sizeof(int32_t));
+
+    memset(data.bytes, 0xff, data.length);
+
+    return data;
+}
+
+HeaderIndex HeaderIndexNew()
+{
+    HeaderIndex result = { 0 };
+
+    result.entries = DataNewUntracked(sizeof(HeaderIndexEntry));
+    result.slots = emptySlots(HEADER_INDEX_INITIAL_SLOTS);
+    result.highestHeight = -1;
+
+    *ENTRIES(&result) = (HeaderIndexEntry){ .minTimeAbove = UINT32_MAX };
+
+    if(pthread_rwlock_init(&result.lock, NULL) != 0)
+        abort();
+
+    return result;
+}
+
+void HeaderIndexFree(HeaderIndex *index)
+{
+    DataFree(index->entries);
+    DataFree(index->slots);
+
+    pthread_rwlock_destroy(&index->lock);
+
+    *index = (HeaderIndex) { 0 };
+}
+
+void HeaderIndexRemoveAll(HeaderIndex *index)
+{
+    pthread_rwlock_wrlock(&index->lock);
+
+    DataFree(index->entries);
+    DataFree(index->slots);
+
+    index->entries = DataNewUntracked(sizeof(HeaderIndexEntry));
+    index->slots = emptySlots(HEADER_INDEX_INITIAL_SLOTS);
+    index->count = 0;
+    index->highestHeight = -1;
+
+    *ENTRIES(index) = (HeaderIndexEntry){ .minTimeAbove = UINT32_MAX };
+
+    pthread_rwlock_unlock(&index->lock);
+}
+
+// Block hashes are uniformly random up front (the zeros are at the end) so the first bytes hash well enough
+static uint32_t slotFor(HeaderIndex *index, const uint8_t *hash)
+{
+    uint64_t key;
+
+    memcpy(&key, hash, sizeof(key));
+
+    return (uint32_t)(key ^ (key >> 32)) & SLOT_MASK(index);
+}
+
+static void slotInsert(HeaderIndex *index, int32_t height)
+{
+    uint32_t mask = SLOT_MASK(index);
+    uint32_t i = slotFor(index, ENTRIES(index)[height].hash);
+
+    while(SLOTS(index)[i] != -1)
+        i = (i + 1) & mask;
+
+    SLOTS(index)[i] = height;
+}
+
+static int64_t slotFind(HeaderIndex *index, const uint8_t *hash)
+{
+    uint32_t mask = SLOT_MASK(index);
+
+    for(uint32_t i = slotFor(index, hash); SLOTS(index)[i] != -1; i = (i + 1) & mask)
+        if(!memcmp(ENTRIES(index)[SLOTS(index)[i]].hash, hash, 32))
+            return i;
+
+    return -1;
+}
+
+// Backward shift deletion keeps probe runs intact without tombstones
+static void slotRemove(HeaderIndex *index, int32_t height)
+{
+    uint32_t mask = SLOT_MASK(index);
+    uint32_t i = slotFor(index, ENTRIES(index)[height].hash);
+
+    while(SLOTS(index)[i] != height) {
+
+        if(SLOTS(index)[i] == -1)
+            return;
+
+        i = (i + 1) & mask;
+    }
+
+    for(uint32_t j = (i + 1) & mask; SLOTS(index)[j] != -1; j = (j + 1) & mask) {
+
+        uint32_t home = slotFor(index, ENTRIES(index)[SLOTS(index)[j]].hash);
+
+        // Move 'j' back into the hole unless its home lies cyclically in (i, j]
+        if(i <= j ? (home <= i || home > j) : (home <= i && home > j)) {
+
+            SLOTS(index)[i] = SLOTS(index)[j];
+            i = j;
+        }
+    }
+
+    SLOTS(index)[i] = -1;
+}
+
+static void growSlotsIfNeeded(HeaderIndex *index)
+{
+    uint32_t slotCount = SLOT_MASK(index) + 1;
+
+    if((uint32_t)(index->count + 1) * 2 <= slotCount)
+        return;
+
+    DataFree(index->slots);
+
+    index->slots = emptySlots(slotCount * 2);
+
+    for(int32_t height = 0; height < ENTRY_COUNT(index); height++)
+        if(ENTRIES(index)[height].time)
+            slotInsert(index, height);
+}
+
+static void growEntriesIfNeeded(HeaderIndex *index, int32_t height)
+{
+    int32_t oldCount = ENTRY_COUNT(index);
+
+    if(height < oldCount)
+        return;
+
+    index->entries = DataResize(index->entries, (unsigned int)(height + 1) * sizeof(HeaderIndexEntry));
+
+    ChainWork chainWork = ENTRIES(index)[oldCount - 1].chainWork;
+
+    for(int32_t i = oldCount; i <= height; i++)
+        ENTRIES(index)[i] = (HeaderIndexEntry){ .chainWork = chainWork, .minTimeAbove = UINT32_MAX };
+}
+
+// Recomputes 'minTimeAbove' from 'height' downwards, stopping once nothing changes
+static void updateMinTimes(HeaderIndex *index, int32_t height)
+{
+    HeaderIndexEntry *entries = ENTRIES(index);
+    int32_t entryCount = ENTRY_COUNT(index);
+
+    for(int32_t h = height; h >= 0; h--) {
+
+        uint32_t value = entries[h].time ? entries[h].time : UINT32_MAX;
+
+        if(h + 1 < entryCount && entries[h + 1].minTimeAbove < value)
+            value = entries[h + 1].minTimeAbove;
+
+        if(h != height && entries[h].minTimeAbove == value)
+            break;
+
+        entries[h].minTimeAbove = value;
+    }
+}
+
+static ChainWork entryWork(HeaderIndex *index, HeaderIndexEntry *entry)
+{
+    if(!entry->time)
+        return (ChainWork) { 0 };
+
+    if(entry->bits != index->lastWorkBits) {
+
+        index->lastWorkBits = entry->bits;
+        index->lastWork = blockWork(entry->bits);
+    }
+
+    return index->lastWork;
+}
+
+// Recomputes 'chainWork' from 'height' to the top. Only appends are common, for which this is one step.
+static void updateChainWork(HeaderIndex *index, int32_t height)
+{
+    HeaderIndexEntry *entries = ENTRIES(index);
+
+    for(int32_t h = height; h < ENTRY_COUNT(index); h++) {
+
+        ChainWork below = h ? entries[h - 1].chainWork : (ChainWork) { 0 };
+
+        entries[h].chainWork = ChainWorkAdd(below, entryWork(index, &entries[h]));
+    }
+}
+
+void HeaderIndexSet(HeaderIndex *index, int32_t height, Data hash, uint32_t time, uint32_t bits)
+{
+    if(height < 0 || hash.length != 32 || !time)
+        abort();
+
+    pthread_rwlock_wrlock(&index->lock);
+
+    growEntriesIfNeeded(index, height);
+
+    HeaderIndexEntry *entry = &ENTRIES(index)[height];
+
+    if(entry->time) {
+
+        slotRemove(index, height);
+        index->count--;
+
+        entry->time = 0;
+    }
+
+    growSlotsIfNeeded(index);
+
+    memcpy(entry->hash, hash.bytes, 32);
+    entry->time = time;
+    entry->bits = bits;
+
+    slotInsert(index, height);
+    index->count++;
+
+    if(height > index->highestHeight)
+        index->highestHeight = height;
+
+    updateMinTimes(index, height);
+    updateChainWork(index, height);
+
+    pthread_rwlock_unlock(&index->lock);
+}
+
+void HeaderIndexRemoveAbove(HeaderIndex *index, int32_t height)
+{
+    if(height < 0) {
+
+        HeaderIndexRemoveAll(index);
+        return;
+    }
+
+    pthread_rwlock_wrlock(&index->lock);
+
+    if(height + 1 < ENTRY_COUNT(index)) {
+
+        for(int32_t h = height + 1; h < ENTRY_COUNT(index); h++) {
+
+            if(ENTRIES(index)[h].time) {
+
+                slotRemove(index, h);
+                index->count--;
+            }
+        }
+
+        index->entries.length = (uint32_t)(height + 1) * sizeof(HeaderIndexEntry);
+
+        if(index->highestHeight > height) {
+
+            index->highestHeight = height;
+
+            while(index->highestHeight >= 0 && !ENTRIES(index)[index->highestHeight].time)
+                index->highestHeight--;
+        }
+
+        updateMinTimes(index, height);
+    }
+
+    pthread_rwlock_unlock(&index->lock);
+}
+
+int32_t HeaderIndexCount(HeaderIndex *index)
+{
+    pthread_rwlock_rdlock(&index->lock);
+
+    int32_t count = index->count;
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return count;
+}
+
+int32_t HeaderIndexHighestHeight(HeaderIndex *index)
+{
+    pthread_rwlock_rdlock(&index->lock);
+
+    int32_t height = index->highestHeight;
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return height;
+}
+
+int32_t HeaderIndexHeightOf(HeaderIndex *index, Data hash)
+{
+    if(hash.length != 32)
+        return -1;
+
+    pthread_rwlock_rdlock(&index->lock);
+
+    int64_t slot = slotFind(index, (uint8_t*)hash.bytes);
+
+    int32_t height = slot < 0 ? -1 : SLOTS(index)[slot];
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return height;
+}
+
+Data HeaderIndexHashOf(HeaderIndex *index, int32_t height)
+{
+    Data result = DataNull();
+
+    pthread_rwlock_rdlock(&index->lock);
+
+    if(height >= 0 && height < ENTRY_COUNT(index) && ENTRIES(index)[height].time)
+        result = DataCopy(ENTRIES(index)[height].hash, 32);
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return result;
+}
+
+uint32_t HeaderIndexTimeOf(HeaderIndex *index, int32_t height)
+{
+    uint32_t time = 0;
+
+    pthread_rwlock_rdlock(&index->lock);
+
+    if(height >= 0 && height < ENTRY_COUNT(index))
+        time = ENTRIES(index)[height].time;
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return time;
+}
+
+uint32_t HeaderIndexBitsOf(HeaderIndex *index, int32_t height)
+{
+    uint32_t bits = 0;
+
+    pthread_rwlock_rdlock(&index->lock);
+
+    if(height >= 0 && height < ENTRY_COUNT(index) && ENTRIES(index)[height].time)
+        bits = ENTRIES(index)[height].bits;
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return bits;
+}
+
+ChainWork HeaderIndexChainWork(HeaderIndex *index, int32_t height)
+{
+    ChainWork chainWork = { 0 };
+
+    pthread_rwlock_rdlock(&index->lock);
+
+    if(height >= ENTRY_COUNT(index))
+        height = ENTRY_COUNT(index) - 1;
+
+    if(height >= 0)
+        chainWork = ENTRIES(index)[height].chainWork;
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return chainWork;
+}
+
+int32_t HeaderIndexHeightBelow(HeaderIndex *index, int32_t height)
+{
+    pthread_rwlock_rdlock(&index->lock);
+
+    int32_t h = height - 1;
+
+    if(h > index->highestHeight)
+        h = index->highestHeight;
+
+    while(h >= 0 && !ENTRIES(index)[h].time)
+        h--;
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return h;
+}
+
+int32_t HeaderIndexHeightAtOrAbove(HeaderIndex *index, int32_t height)
+{
+    pthread_rwlock_rdlock(&index->lock);
+
+    int32_t h = height < 0 ? 0 : height;
+
+    while(h <= index->highestHeight && !ENTRIES(index)[h].time)
+        h++;
+
+    if(h > index->highestHeight)
+        h = -1;
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return h;
+}
+
+int32_t HeaderIndexHeightBeforeTime(HeaderIndex *index, uint32_t timestamp)
+{
+    pthread_rwlock_rdlock(&index->lock);
+
+    HeaderIndexEntry *entries = ENTRIES(index);
+
+    // 'minTimeAbove' never decreases with height. The answer is the last height where it is below 'timestamp'.
+    int32_t low = 0;
+    int32_t high = ENTRY_COUNT(index);
+
+    while(low < high) {
+
+        int32_t mid = low + (high - low) / 2;
+
+        if(entries[mid].minTimeAbove < timestamp)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return low - 1;
+}
+
+Datas HeaderIndexHashesAbove(HeaderIndex *index, int32_t height, int32_t limit)
+{
+    Datas result = DatasNew();
+
+    pthread_rwlock_rdlock(&index->lock);
+
+    for(int32_t h = height < 0 ? 0 : height + 1; h <= index->highestHeight && result.count < limit; h++)
+        if(ENTRIES(index)[h].time)
+            result = DatasAddRef(result, DataCopy(ENTRIES(index)[h].hash, 32));
+
+    pthread_rwlock_unlock(&index->lock);
+
+    return result;
+}
@@ -0,0 +1,64 @@
+#ifndef HEADERINDEX_H
+#define HEADERINDEX_H
+
+#include "Data.h"
+#include "MerkleBlock.h"
+#include <pthread.h>
+
+// Resident index of the block header chain: one entry per height plus a hash -> height map.
+// Heights may be sparse (checkpoints), missing heights read as absent. Safe to use from any thread.
+
+typedef struct HeaderIndexEntry {
+
+    uint8_t hash[32];
+    ChainWork chainWork; // Work of the headers at this height and below. Empty heights repeat the one below.
+    uint32_t time; // 0 means no header at this height
+    uint32_t minTimeAbove; // Smallest time at this height or above, lets time searches bisect
+    uint32_t bits; // 0 when unknown, as for checkpoints
+
+} HeaderIndexEntry;
+
+typedef struct HeaderIndex {
+
+    Data entries; // HeaderIndexEntry array indexed by height
+    Data slots; // int32_t heights, open addressing keyed on the hash. -1 is empty.
+
+    int32_t count;
+    int32_t highestHeight;
+
+    uint32_t lastWorkBits; // blockWork is a long division so the last result is kept
+    ChainWork lastWork;
+
+    pthread_rwlock_t lock;
+
+} HeaderIndex;
+
+// HeaderIndexes are created Untracked.
+HeaderIndex HeaderIndexNew();
+void HeaderIndexFree(HeaderIndex *index);
+
+void HeaderIndexRemoveAll(HeaderIndex *index);
+void HeaderIndexRemoveAbove(HeaderIndex *index, int32_t height); // Drops every entry above 'height'
+
+// Replaces whatever was at 'height'. 'hash' must be 32 bytes. Chain work above 'height' is recomputed.
+void HeaderIndexSet(HeaderIndex *index, int32_t height, Data hash, uint32_t time, uint32_t bits);
+
+int32_t HeaderIndexCount(HeaderIndex *index);
+int32_t HeaderIndexHighestHeight(HeaderIndex *index); // -1 if empty
+
+int32_t HeaderIndexHeightOf(HeaderIndex *index, Data hash); // -1 if not found
+Data HeaderIndexHashOf(HeaderIndex *index, int32_t height); // DataNull if absent
+uint32_t HeaderIndexTimeOf(HeaderIndex *index, int32_t height); // 0 if absent
+uint32_t HeaderIndexBitsOf(HeaderIndex *index, int32_t height); // 0 if absent or unknown
+ChainWork HeaderIndexChainWork(HeaderIndex *index, int32_t height); // Total work of the known headers up to 'height'
+
+int32_t HeaderIndexHeightBelow(HeaderIndex *index, int32_t height); // Highest present height < 'height', -1 if none
+int32_t HeaderIndexHeightAtOrAbove(HeaderIndex *index, int32_t height); // Lowest present height >= 'height', -1 if none
+
+// Highest height whose time is before 'timestamp', -1 if none. O(log n).
+int32_t HeaderIndexHeightBeforeTime(HeaderIndex *index, uint32_t timestamp);
+
+// Up to 'limit' hashes of the present heights above 'height', ascending.
+Datas HeaderIndexHashesAbove(HeaderIndex *index, int32_t height, int32_t limit);
+
+#endif
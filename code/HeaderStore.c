@@ -0,0 +1,279 @@
+#include "HeaderStore.h"
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifndef MIN
+#define MIN(a,b) (((a)<(b))?(a):(b))
+#endif
+
+#ifndef MAX
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#endif
+
+#define HEADER_STORE_HEADER_SIZE 80
+#define HEADER_STORE_HASH_SIZE 32
+
+// Maps are reserved ahead of the file so appends rarely remap. Pages past the end of the file are never touched.
+#define HEADER_STORE_MIN_MAP_LENGTH (16 * 1024 * 1024)
+
+static const uint8_t zeroHash[HEADER_STORE_HASH_SIZE] = { 0 };
+
+static uint64_t fileLength(int fd)
+{
+    struct stat info;
+
+    if(fstat(fd, &info) != 0)
+        return 0;
+
+    return (uint64_t)info.st_size;
+}
+
+// Must be called with the write lock held (or before the store is shared)
+static int remapIfNeeded(int fd, uint64_t length, void **map, uint64_t *mapLength)
+{
+    if(!length || (*map && length <= *mapLength))
+        return 1;
+
+    uint64_t newLength = MAX(*mapLength, HEADER_STORE_MIN_MAP_LENGTH);
+
+    while(newLength < length)
+        newLength *= 2;
+
+    if(*map)
+        munmap(*map, *mapLength);
+
+    *map = NULL;
+    *mapLength = 0;
+
+    void *result = mmap(NULL, newLength, PROT_READ, MAP_SHARED, fd, 0);
+
+    if(result == MAP_FAILED)
+        return 0;
+
+    *map = result;
+    *mapLength = newLength;
+
+    return 1;
+}
+
+HeaderStore HeaderStoreOpen(const char *path)
+{
+    HeaderStore result = { 0 };
+
+    result.headerFd = open(path, O_RDWR | O_CREAT, 0644);
+    result.hashFd = open(StringF("%s.idx", path).bytes, O_RDWR | O_CREAT, 0644);
+
+    if(result.headerFd < 0 || result.hashFd < 0) {
+
+        if(result.headerFd >= 0)
+            close(result.headerFd);
+
+        if(result.hashFd >= 0)
+            close(result.hashFd);
+
+        return (HeaderStore) { .headerFd = -1, .hashFd = -1 };
+    }
+
+    result.headerFileLength = fileLength(result.headerFd);
+    result.hashFileLength = fileLength(result.hashFd);
+
+    remapIfNeeded(result.headerFd, result.headerFileLength, &result.headerMap, &result.headerMapLength);
+    remapIfNeeded(result.hashFd, result.hashFileLength, &result.hashMap, &result.hashMapLength);
+
+    if(pthread_rwlock_init(&result.lock, NULL) != 0)
+        abort();
+
+    return result;
+}
+
+void HeaderStoreClose(HeaderStore *store)
+{
+    if(!HeaderStoreIsOpen(store))
+        return;
+
+    if(store->headerMap)
+        munmap(store->headerMap, store->headerMapLength);
+
+    if(store->hashMap)
+        munmap(store->hashMap, store->hashMapLength);
+
+    close(store->headerFd);
+    close(store->hashFd);
+
+    pthread_rwlock_destroy(&store->lock);
+
+    *store = (HeaderStore) { .headerFd = -1, .hashFd = -1 };
+}
+
+int HeaderStoreIsOpen(HeaderStore *store)
+{
+    return store->headerFd >= 0 && store->hashFd >= 0;
+}
+
+// Must be called with the lock held
+static int hasRecord(HeaderStore *store, int32_t height)
+{
+    if(height < 0)
+        return 0;
+
+    uint64_t hashOffset = (uint64_t)height * HEADER_STORE_HASH_SIZE;
+    uint64_t headerOffset = (uint64_t)height * HEADER_STORE_HEADER_SIZE;
+
+    if(hashOffset + HEADER_STORE_HASH_SIZE > store->hashFileLength || !store->hashMap)
+        return 0;
+
+    if(headerOffset + HEADER_STORE_HEADER_SIZE > store->headerFileLength || !store->headerMap)
+        return 0;
+
+    return memcmp((uint8_t*)store->hashMap + hashOffset, zeroHash, HEADER_STORE_HASH_SIZE) != 0;
+}
+
+int32_t HeaderStoreHeightCount(HeaderStore *store)
+{
+    pthread_rwlock_rdlock(&store->lock);
+
+    uint64_t count = MIN(store->hashFileLength / HEADER_STORE_HASH_SIZE, store->headerFileLength / HEADER_STORE_HEADER_SIZE);
+
+    pthread_rwlock_unlock(&store->lock);
+
+    return (int32_t)count;
+}
+
+Data HeaderStoreHeader(HeaderStore *store, int32_t height)
+{
+    Data result = DataNull();
+
+    pthread_rwlock_rdlock(&store->lock);
+
+    if(hasRecord(store, height))
+        result = DataCopy((uint8_t*)store->headerMap + (uint64_t)height * HEADER_STORE_HEADER_SIZE, HEADER_STORE_HEADER_SIZE);
+
+    pthread_rwlock_unlock(&store->lock);
+
+    return result;
+}
+
+Data HeaderStoreHash(HeaderStore *store, int32_t height)
+{
+    Data result = DataNull();
+
+    pthread_rwlock_rdlock(&store->lock);
+
+    if(hasRecord(store, height))
+        result = DataCopy((uint8_t*)store->hashMap + (uint64_t)height * HEADER_STORE_HASH_SIZE, HEADER_STORE_HASH_SIZE);
+
+    pthread_rwlock_unlock(&store->lock);
+
+    return result;
+}
+
+static int writeFully(int fd, const char *bytes, uint64_t length, uint64_t offset)
+{
+    while(length) {
+
+        ssize_t result = pwrite(fd, bytes, length, (off_t)offset);
+
+        if(result <= 0)
+            return 0;
+
+        bytes += result;
+        length -= (uint64_t)result;
+        offset += (uint64_t)result;
+    }
+
+    return 1;
+}
+
+int HeaderStoreWrite(HeaderStore *store, int32_t firstHeight, Data headers, Data hashes)
+{
+    if(firstHeight < 0 || headers.length % HEADER_STORE_HEADER_SIZE)
+        return 0;
+
+    uint64_t count = headers.length / HEADER_STORE_HEADER_SIZE;
+
+    if(hashes.length != count * HEADER_STORE_HASH_SIZE)
+        return 0;
+
+    if(!count)
+        return 1;
+
+    uint64_t headerOffset = (uint64_t)firstHeight * HEADER_STORE_HEADER_SIZE;
+    uint64_t hashOffset = (uint64_t)firstHeight * HEADER_STORE_HASH_SIZE;
+
+    pthread_rwlock_wrlock(&store->lock);
+
+    int result = writeFully(store->headerFd, headers.bytes, headers.length, headerOffset);
+
+    result = result && writeFully(store->hashFd, hashes.bytes, hashes.length, hashOffset);
+
+    if(result) {
+
+        store->headerFileLength = MAX(store->headerFileLength, headerOffset + headers.length);
+        store->hashFileLength = MAX(store->hashFileLength, hashOffset + hashes.length);
+    }
+    else {
+
+        store->headerFileLength = fileLength(store->headerFd);
+        store->hashFileLength = fileLength(store->hashFd);
+    }
+
+    if(!remapIfNeeded(store->headerFd, store->headerFileLength, &store->headerMap, &store->headerMapLength))
+        result = 0;
+
+    if(!remapIfNeeded(store->hashFd, store->hashFileLength, &store->hashMap, &store->hashMapLength))
+        result = 0;
+
+    pthread_rwlock_unlock(&store->lock);
+
+    return result;
+}
+
+void HeaderStoreEnumerate(HeaderStore *store, void (*callback)(void *ptr, int32_t height, Data hash, Data header), void *ptr)
+{
+    pthread_rwlock_rdlock(&store->lock);
+
+    int32_t count = (int32_t)MIN(store->hashFileLength / HEADER_STORE_HASH_SIZE, store->headerFileLength / HEADER_STORE_HEADER_SIZE);
+
+    for(int32_t height = 0; height < count; height++) {
+
+        if(!hasRecord(store, height))
+            continue;
+
+        Data hash = DataRef((uint8_t*)store->hashMap + (uint64_t)height * HEADER_STORE_HASH_SIZE, HEADER_STORE_HASH_SIZE);
+        Data header = DataRef((uint8_t*)store->headerMap + (uint64_t)height * HEADER_STORE_HEADER_SIZE, HEADER_STORE_HEADER_SIZE);
+
+        callback(ptr, height, hash, header);
+    }
+
+    pthread_rwlock_unlock(&store->lock);
+}
+
+int HeaderStoreRemoveAll(HeaderStore *store)
+{
+    return HeaderStoreTruncate(store, 0);
+}
+
+int HeaderStoreTruncate(HeaderStore *store, int32_t heightCount)
+{
+    if(heightCount < 0)
+        return 0;
+
+    pthread_rwlock_wrlock(&store->lock);
+
+    uint64_t headerLength = MIN(store->headerFileLength, (uint64_t)heightCount * HEADER_STORE_HEADER_SIZE);
+    uint64_t hashLength = MIN(store->hashFileLength, (uint64_t)heightCount * HEADER_STORE_HASH_SIZE);
+
+    // Hashes first so a torn truncate leaves records missing rather than wrong
+    int result = ftruncate(store->hashFd, (off_t)hashLength) == 0 && ftruncate(store->headerFd, (off_t)headerLength) == 0;
+
+    store->headerFileLength = fileLength(store->headerFd);
+    store->hashFileLength = fileLength(store->hashFd);
+
+    pthread_rwlock_unlock(&store->lock);
+
+    return result;
+}
@@ -0,0 +1,44 @@
+#ifndef HEADERSTORE_H
+#define HEADERSTORE_H
+
+#include "Data.h"
+#include <pthread.h>
+
+// Append-only flat file of block headers. Record 'height' is the 80 byte header at offset height * 80.
+// A sidecar file ('path' + ".idx") holds each record's 32 byte hash at height * 32, all zeros meaning no record.
+// Both are mapped read-only for lookups and only ever written with pwrite. Safe to use from any thread.
+
+typedef struct HeaderStore {
+
+    int headerFd, hashFd;
+
+    void *headerMap, *hashMap;
+    uint64_t headerMapLength, hashMapLength;
+    uint64_t headerFileLength, hashFileLength;
+
+    pthread_rwlock_t lock;
+
+} HeaderStore;
+
+// Returns a store with 'headerFd' of -1 if the files couldn't be opened.
+HeaderStore HeaderStoreOpen(const char *path);
+void HeaderStoreClose(HeaderStore *store);
+
+int HeaderStoreIsOpen(HeaderStore *store);
+
+int32_t HeaderStoreHeightCount(HeaderStore *store); // One past the highest record written
+
+Data HeaderStoreHeader(HeaderStore *store, int32_t height); // DataNull if there is no record
+Data HeaderStoreHash(HeaderStore *store, int32_t height); // DataNull if there is no record
+
+// Writes 'count' records starting at 'firstHeight'. 'headers' is count * 80 bytes and 'hashes' count * 32.
+// The headers are written before the hashes so a torn write leaves records missing rather than wrong.
+int HeaderStoreWrite(HeaderStore *store, int32_t firstHeight, Data headers, Data hashes);
+
+// Calls 'callback' for every record in height order. Must not call back into 'store'.
+void HeaderStoreEnumerate(HeaderStore *store, void (*callback)(void *ptr, int32_t height, Data hash, Data header), void *ptr);
+
+int HeaderStoreRemoveAll(HeaderStore *store);
+int HeaderStoreTruncate(HeaderStore *store, int32_t heightCount); // Drops every record at 'heightCount' and above
+
+#endif
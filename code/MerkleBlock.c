@@ -1,8 +1,19 @@
 #include "MerkleBlock.h"
 #include "BTCUtil.h"
+#include <string.h>
+
+#ifndef MIN
+#define MIN(a,b) (((a)<(b))?(a):(b))
+#endif
+
+#ifndef MAX
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#endif
 
 static int calculateTreeWidth(MerkleBlock *block, int height);
 
+uint32_t blockPowLimitBits = BLOCK_POW_LIMIT_BITS;
+
 MerkleBlock MerkleBlockNew(Data data)
 {
     MerkleBlock block = { 0 };
@@ -127,6 +138,200 @@ int hasMerkleData(MerkleBlock *block)
     return block->data.length > 84;
 }
 
+// Expands compact 'bits' into a little endian 256 bit target. Returns 0 for zero, negative or overflowing bits.
+static int bitsTarget(uint32_t bits, uint8_t target[32])
+{
+    int size = bits >> 24;
+    uint32_t word = bits & 0x007fffff;
+
+    memset(target, 0, 32);
+
+    if(!word || (bits & 0x00800000))
+        return 0;
+
+    if(size <= 3) {
+
+        word >>= 8 * (3 - size);
+        size = 3;
+    }
+
+    for(int i = 0; i < 3; i++, word >>= 8) {
+
+        int index = size - 3 + i;
+
+        if(index >= 32) {
+
+            if(word & 0xff)
+                return 0;
+
+            continue;
+        }
+
+        target[index] = word & 0xff;
+    }
+
+    return 1;
+}
+
+// Compares little endian 256 bit numbers
+static int compareTargets(const uint8_t *target1, const uint8_t *target2)
+{
+    for(int i = 31; i >= 0; i--)
+        if(target1[i] != target2[i])
+            return target1[i] < target2[i] ? -1 : 1;
+
+    return 0;
+}
+
+int blockBitsValid(uint32_t bits)
+{
+    uint8_t target[32], limit[32];
+
+    if(!bitsTarget(bits, target))
+        return 0;
+
+    bitsTarget(blockPowLimitBits, limit);
+
+    return compareTargets(target, limit) <= 0;
+}
+
+int blockBitsCompare(uint32_t bits1, uint32_t bits2)
+{
+    uint8_t target1[32], target2[32];
+
+    bitsTarget(bits1, target1);
+    bitsTarget(bits2, target2);
+
+    return compareTargets(target1, target2);
+}
+
+int MerkleBlockCheckProofOfWork(MerkleBlock *block)
+{
+    uint8_t target[32];
+
+    uint32_t bits = blockBits(block);
+    Data hash = blockHash(block);
+
+    if(hash.length != 32 || !blockBitsValid(bits) || !bitsTarget(bits, target))
+        return 0;
+
+    return compareTargets((uint8_t*)hash.bytes, target) <= 0;
+}
+
+// The new target is lastTarget * timespan / BLOCK_TARGET_TIMESPAN truncated to compact form. Only the
+// top 3 bytes survive that, so the product is kept two bytes deeper than the mantissa in 64 bits.
+uint32_t blockRetargetBits(uint32_t lastBits, uint32_t firstTime, uint32_t lastTime)
+{
+    int64_t timespan = (int64_t)lastTime - (int64_t)firstTime;
+
+    timespan = MAX(timespan, BLOCK_TARGET_TIMESPAN / 4);
+    timespan = MIN(timespan, BLOCK_TARGET_TIMESPAN * 4);
+
+    int size = lastBits >> 24;
+    uint64_t value = ((uint64_t)(lastBits & 0x007fffff) * (uint64_t)timespan << 16) / BLOCK_TARGET_TIMESPAN;
+
+    // The new target is 'value' * 256^'shift'
+    int shift = size - 5;
+
+    if(shift < 0) {
+
+        value >>= 8 * -shift;
+        shift = 0;
+    }
+
+    int valueBytes = 0;
+
+    for(uint64_t v = value; v; v >>= 8)
+        valueBytes++;
+
+    if(!valueBytes)
+        return 0;
+
+    int newSize = valueBytes + shift;
+    uint64_t word = valueBytes > 3 ? value >> 8 * (valueBytes - 3) : value << 8 * (3 - valueBytes);
+
+    if(word & 0x00800000) {
+
+        word >>= 8;
+        newSize++;
+    }
+
+    uint32_t result = (uint32_t)word | (uint32_t)newSize << 24;
+
+    if(newSize > 32 || blockBitsCompare(result, blockPowLimitBits) > 0)
+        return blockPowLimitBits;
+
+    return result;
+}
+
+ChainWork blockWork(uint32_t bits)
+{
+    ChainWork work = { 0 };
+
+    int size = bits >> 24;
+    uint32_t word = bits & 0x007fffff;
+
+    if(!blockBitsValid(bits))
+        return work;
+
+    if(size < 3)
+        word >>= 8 * (3 - size);
+
+    // Long division of 2^(256 - 8 * (size - 3)) by 'word', one bit at a time
+    int exponent = 256 - 8 * MAX(size - 3, 0);
+    uint64_t remainder = 0;
+
+    for(int i = 0; i <= exponent; i++) {
+
+        remainder = remainder << 1 | (i == 0);
+
+        if(work.high >> 63)
+            return (ChainWork) { UINT64_MAX, UINT64_MAX };
+
+        work.high = work.high << 1 | work.low >> 63;
+        work.low <<= 1;
+
+        if(remainder >= word) {
+
+            remainder -= word;
+            work.low |= 1;
+        }
+    }
+
+    return work;
+}
+
+ChainWork ChainWorkAdd(ChainWork work1, ChainWork work2)
+{
+    ChainWork result = { work1.high + work2.high, work1.low + work2.low };
+
+    if(result.low < work1.low)
+        result.high++;
+
+    return result;
+}
+
+ChainWork ChainWorkSubtract(ChainWork work1, ChainWork work2)
+{
+    ChainWork result = { work1.high - work2.high, work1.low - work2.low };
+
+    if(work1.low < work2.low)
+        result.high--;
+
+    return result;
+}
+
+int ChainWorkCompare(ChainWork work1, ChainWork work2)
+{
+    if(work1.high != work2.high)
+        return work1.high < work2.high ? -1 : 1;
+
+    if(work1.low != work2.low)
+        return work1.low < work2.low ? -1 : 1;
+
+    return 0;
+}
+
 Data allMerkleHashes(MerkleBlock *block)
 {
     if(block->data.length < 85)
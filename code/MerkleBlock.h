@@ -3,6 +3,19 @@
 
 #include "Data.h"
 
+#define BLOCK_RETARGET_INTERVAL 2016
+#define BLOCK_TARGET_TIMESPAN (14 * 24 * 60 * 60)
+#define BLOCK_POW_LIMIT_BITS 0x1d00ffff // Same for mainnet and testnet
+
+extern uint32_t blockPowLimitBits; // BLOCK_POW_LIMIT_BITS unless changed. Regtest style chains use 0x207fffff.
+
+// 128 bits of proof of work. Cumulative work is around 2^95 so this leaves plenty of room.
+typedef struct ChainWork {
+
+    uint64_t high, low;
+
+} ChainWork;
+
 typedef struct MerkleBlock {
 
     Data data;
@@ -28,6 +41,17 @@ uint32_t blockNonce(MerkleBlock *merkleBlock);
 
 int hasMerkleData(MerkleBlock *merkleBlock);
 
+int MerkleBlockCheckProofOfWork(MerkleBlock *merkleBlock); // Bits are within the pow limit and the hash meets them
+
+int blockBitsValid(uint32_t bits); // Positive, not overflowing and no easier than 'blockPowLimitBits'
+int blockBitsCompare(uint32_t bits1, uint32_t bits2); // Compares the targets, -1 if 'bits1' is harder
+uint32_t blockRetargetBits(uint32_t lastBits, uint32_t firstTime, uint32_t lastTime); // Bits following a BLOCK_RETARGET_INTERVAL
+
+ChainWork blockWork(uint32_t bits); // 2^256 / (target + 1), to within one. Zero for invalid bits.
+ChainWork ChainWorkAdd(ChainWork work1, ChainWork work2);
+ChainWork ChainWorkSubtract(ChainWork work1, ChainWork work2); // 'work2' must not exceed 'work1'
+int ChainWorkCompare(ChainWork work1, ChainWork work2);
+
 uint32_t MerkleBlockTransactionCount(MerkleBlock *merkleBlock);
 
 Data allMerkleHashes(MerkleBlock *merkleBlock); // The memory for each merkle hash is corrupted when 'data' is released
@@ -2,6 +2,7 @@
 #include "BTCUtil.h"
 #include "NodeConstants.h"
 #include "NodeManager.h"
+#include "WorkQueue.h"
 #include <sys/socket.h>
 #include <arpa/inet.h>
 #include <errno.h>
@@ -15,10 +16,15 @@
 #include <string.h>
 #include <sys/socket.h>
 #include <sys/select.h>
+#include <sys/ioctl.h>
 #include <netdb.h>
 #include <time.h>
 #include "Notifications.h"
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
 #ifdef __APPLE__
 #include <sys/_select.h>
 #endif
@@ -26,9 +32,6 @@
 #ifdef __ANDROID__
 #include <android/log.h>
 
-#define pthread_cancel(thread_id) pthread_kill(thread_id, SIGUSR1);
-#define pthread_setcancelstate(...)
-
 #define printf(...) __android_log_print(ANDROID_LOG_INFO, "Node", __VA_ARGS__)
 
 #endif
@@ -38,6 +41,10 @@ const char *NodeConnectionStatusChanged = "NodeConnectionStatusChanged";
 // By default we turn this off as it's a privacy leak.
 #define RESPOND_TO_GETTX_REQUESTS 0
 
+#ifndef MIN
+#define MIN(a,b) (((a)<(b))?(a):(b))
+#endif
+
 #define NodeLog(fmt, ...) printf(("Node[%s%s] " fmt "\n"), self->address.bytes, self->userAgent.bytes ?: "", ##__VA_ARGS__); \
     self->errors = DatasUntrack(DatasAddCopy(self->errors, StringF(fmt, ##__VA_ARGS__)))
 
@@ -75,6 +82,7 @@ Node NodeNew(String address)
     node.address = DataUntrackCopy(address);
 
     node.connection = -1;
+    node.eventFd = -1;
 
     return node;
 }
@@ -86,129 +94,291 @@ void NodeFree(Node *self)
     self->address = DataFree(self->address);
     self->userAgent = DataFree(self->userAgent);
     self->curBloomFilter = DataFree(self->curBloomFilter);
+    self->filterHeaders = DatasFree(self->filterHeaders);
+    self->filterHeadersStop = DataFree(self->filterHeadersStop);
     MerkleBlockFree(&self->lastMerkleBlock);
 }
 
-static int openConnection(const char *hostname, int port, int *socketRef, struct addrinfo **addrs)
+// Hostname lookups run on a small pool of resolver threads. The node and the resolver each hold a
+// reference so a node that gives up (or is freed) never waits on 'getaddrinfo'.
+typedef struct NodeResolve {
+
+    int refCount;
+    int done;
+    int error;
+
+    char *host;
+    uint16_t port;
+
+    struct addrinfo *addrs;
+    struct addrinfo *next; // The address to try after the current one
+
+} NodeResolve;
+
+static pthread_mutex_t resolveLock = PTHREAD_MUTEX_INITIALIZER;
+static int resolverIndex = 0;
+
+static void resolverName(char *name, size_t size, int index)
+{
+    snprintf(name, size, "Node Resolver %d", index);
+}
+
+static void resolveRelease(NodeResolve *resolve)
 {
-    int sd = -1, err;
+    pthread_mutex_lock(&resolveLock);
+
+    int refCount = --resolve->refCount;
+
+    pthread_mutex_unlock(&resolveLock);
+
+    if(refCount)
+        return;
+
+    if(resolve->addrs)
+        freeaddrinfo(resolve->addrs);
+
+    free(resolve->host);
+    free(resolve);
+}
+
+static void resolveWorker(Dict dict)
+{
+    NodeResolve *resolve = DataGetPtr(DictGetS(dict, "resolve"));
+
     struct addrinfo hints = {0};
-    char port_str[16] = {0};
+    struct addrinfo *addrs = NULL;
+    char port[16] = {0};
 
     hints.ai_family = AF_INET;
     hints.ai_socktype = SOCK_STREAM;
     hints.ai_protocol = IPPROTO_TCP;
 
-    sprintf(port_str, "%d", port);
+    sprintf(port, "%d", resolve->port);
 
-    err = getaddrinfo(hostname, port_str, &hints, addrs);
+    int err = getaddrinfo(resolve->host, port, &hints, &addrs);
 
-    if (err != 0) {
+    pthread_mutex_lock(&resolveLock);
 
-        //printf("%s: %s\n", hostname, gai_strerror(err));
-        return -1;
+    if(err == 0 && addrs) {
+
+        resolve->addrs = addrs;
+        resolve->next = addrs;
     }
+    else {
 
-    for(struct addrinfo *addr = *addrs; addr != NULL; addr = addr->ai_next) {
+        resolve->error = err ?: EAI_FAIL;
 
-        sd = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
-        *socketRef = sd;
-        if (sd == -1)
-        {
-            err = errno;
-            continue;
-        }
+        if(addrs)
+            freeaddrinfo(addrs);
+    }
 
-        if (connect(sd, addr->ai_addr, addr->ai_addrlen) == 0)
-            break;
+    resolve->done = 1;
 
-        err = errno;
+    pthread_mutex_unlock(&resolveLock);
 
-        *socketRef = 0;
-        close(sd);
-        sd = -1;
-    }
+    resolveRelease(resolve);
+}
 
-    if (sd == -1) {
+static void resolveStart(Node *self, const char *host, uint16_t port)
+{
+    NodeResolve *resolve = calloc(1, sizeof(NodeResolve));
 
-        printf("%s: %s\n", hostname, strerror(err));
-    }
+    if(!resolve)
+        abort();
 
-    if(sd != -1 && fcntl(sd, F_SETFL, O_NONBLOCK) < 0) {
+    resolve->refCount = 2;
+    resolve->host = strdup(host);
+    resolve->port = port;
 
-        printf("Unable to make socket non-blocking");
-    }
+    self->resolve = resolve;
 
-    return sd;
+    pthread_mutex_lock(&resolveLock);
+
+    int index = resolverIndex++ % NODE_RESOLVER_THREADS;
+
+    pthread_mutex_unlock(&resolveLock);
+
+    char name[32];
+
+    resolverName(name, sizeof(name), index);
+
+    WorkQueueAdd(WorkQueueThreadNamed(name), resolveWorker, DictOneS("resolve", DataPtr(resolve)));
 }
 
-typedef struct {
+void NodeResolversShutdown()
+{
+    pthread_mutex_lock(&resolveLock);
 
-    Node *node;
-    int socketRef;
-    struct addrinfo *addrs;
-    int attemptNumber;
-    char *address;
-    uint16_t port;
+    int count = MIN(resolverIndex, NODE_RESOLVER_THREADS);
 
-} ConnectionThreadParameters;
+    resolverIndex = 0;
 
-static void connectionThreadCleanup(void *ptr)
+    pthread_mutex_unlock(&resolveLock);
+
+    for(int i = 0; i < count; i++) {
+
+        char name[32];
+
+        resolverName(name, sizeof(name), i);
+
+        WorkQueueThreadWaitAndDestroy(name);
+    }
+}
+
+// Registers 'connection' with 'eventFd' or changes its events. Only touches epoll when the events change.
+static void eventsUpdate(Node *self)
 {
-    ConnectionThreadParameters *parms = (ConnectionThreadParameters *)ptr;
+#ifdef __linux__
+    if(self->eventFd < 0 || self->connection <= 0)
+        return;
 
-    if(parms->addrs)
-        freeaddrinfo(parms->addrs);
+    uint32_t mask = EPOLLIN | (NodeWantsWrite(self) ? EPOLLOUT : 0);
 
-    if(!parms->node->connected && parms->socketRef)
-        close(parms->socketRef);
+    if(mask == self->eventMask)
+        return;
 
-    free(parms->address);
-    free(ptr);
+    struct epoll_event event = { 0 };
 
-    DataTrackPop();
+    event.events = mask;
+    event.data.fd = self->connection;
+
+    // A socket closed behind our back already left the epoll set
+    if(!self->eventMask || (epoll_ctl(self->eventFd, EPOLL_CTL_MOD, self->connection, &event) != 0 && errno == ENOENT))
+        epoll_ctl(self->eventFd, EPOLL_CTL_ADD, self->connection, &event);
+
+    self->eventMask = mask;
+#endif
 }
 
-static void *connectionThread(void *ptr)
+// Call before closing 'connection', its number may be reused right away
+static void eventsRemove(Node *self)
 {
-    DataTrackPush();
+#ifdef __linux__
+    if(self->eventFd >= 0 && self->eventMask && self->connection > 0)
+        epoll_ctl(self->eventFd, EPOLL_CTL_DEL, self->connection, NULL);
+#endif
 
-    ConnectionThreadParameters *parms = (ConnectionThreadParameters *)ptr;
+    self->eventMask = 0;
+}
+
+void NodeSetEventFd(Node *self, int eventFd)
+{
+    eventsRemove(self);
 
-    pthread_cleanup_push(connectionThreadCleanup, ptr);
-    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+    self->eventFd = eventFd;
 
-    int result = openConnection(parms->address, parms->port, &parms->socketRef, &parms->addrs);
+    eventsUpdate(self);
+}
 
-    if(parms->attemptNumber == parms->node->connectAttemptCount) {
+void NodeUpdateEvents(Node *self)
+{
+    eventsUpdate(self);
+}
 
-        parms->node->connection = result;
-        parms->node->connected = 1;
+static void connectFinished(Node *self)
+{
+    if(self->addresses)
+        resolveRelease(self->addresses);
 
-        NotificationsFire(NodeConnectionStatusChanged, DictNew());
+    self->addresses = NULL;
+    self->connecting = 0;
+    self->connected = 1;
+
+    NotificationsFire(NodeConnectionStatusChanged, DictNew());
+}
+
+// Starts a non-blocking connect(). Completion is picked up by 'NodeProcessReady' once the socket is writable.
+static void connectStart(Node *self, const struct sockaddr *address, socklen_t addressLength)
+{
+    int sd = socket(address->sa_family, SOCK_STREAM, IPPROTO_TCP);
+
+    if(sd < 0) {
+
+        NodeLog("socket() failed: %s", strerror(errno));
+        return;
+    }
+
+    if(fcntl(sd, F_SETFL, O_NONBLOCK) < 0) {
+
+        NodeLog("Unable to make socket non-blocking");
+    }
+
+    self->connection = sd;
+
+    if(connect(sd, address, addressLength) == 0) {
+
+        connectFinished(self);
+    }
+    else if(errno == EINPROGRESS) {
+
+        self->connecting = 1;
+    }
+    else {
+
+        NodeLog("connect() failed: %s", strerror(errno));
+
+        close(sd);
+        self->connection = -1;
+    }
+
+    eventsUpdate(self);
+}
+
+// Connects to the lookup's addresses in turn until one gets going. The lookup is dropped once they're used up.
+static void connectNext(Node *self)
+{
+    while(self->addresses && self->addresses->next) {
+
+        struct addrinfo *address = self->addresses->next;
+
+        self->addresses->next = address->ai_next;
+
+        connectStart(self, address->ai_addr, address->ai_addrlen);
+
+        if(self->connection > 0)
+            return;
     }
 
-    pthread_cleanup_pop(1);
+    if(self->addresses)
+        resolveRelease(self->addresses);
 
-    return NULL;
+    self->addresses = NULL;
+}
+
+static void connectCancel(Node *self)
+{
+    if(self->resolve)
+        resolveRelease(self->resolve);
+
+    if(self->addresses)
+        resolveRelease(self->addresses);
+
+    self->resolve = NULL;
+    self->addresses = NULL;
+    self->connecting = 0;
 }
 
 static void NodeReset(Node *self)
 {
     self->inputBuffer = DataFree(self->inputBuffer);
+    self->inputOffset = 0;
+    self->inputLength = 0;
     self->outputBuffer = DataFree(self->outputBuffer);
     self->versionPacket = DataFree(self->versionPacket);
     self->errors = DatasFree(self->errors);
     self->rejectCodes = DatasFree(self->rejectCodes);
+
+    connectCancel(self);
 }
 
 void NodeConnect(Node *self)
 {
-    if(self->connectThread) {
+    // Abandon a connect() still in flight from an earlier attempt
+    if(self->connecting) {
 
-        pthread_cancel(self->connectThread);
-        pthread_join(self->connectThread, NULL);
-        self->connectThread = 0;
+        eventsRemove(self);
+        close(self->connection);
+        self->connection = -1;
     }
 
     NodeReset(self);
@@ -241,27 +411,23 @@ void NodeConnect(Node *self)
 
     self->connectAttemptCount = self->connectAttemptCount + 1;
 
-    ConnectionThreadParameters *parms = malloc(sizeof(ConnectionThreadParameters));
+    struct sockaddr_in literal = { 0 };
 
-    memset(parms, 0, sizeof(ConnectionThreadParameters));
+    literal.sin_family = AF_INET;
+    literal.sin_port = htons(port);
 
-    parms->node = self;
-    parms->socketRef = 0;
-    parms->addrs = NULL;
-    parms->attemptNumber = self->connectAttemptCount;
-    parms->address = address;
-    parms->port = port;
-
-    pthread_attr_t attr;
-    pthread_attr_init(&attr);
-    pthread_attr_setstacksize(&attr, 16384 * 2);
+    // Literal addresses (the common case from the node list) skip the resolver entirely
+    if(inet_pton(AF_INET, address, &literal.sin_addr) == 1)
+        connectStart(self, (struct sockaddr*)&literal, sizeof(literal));
+    else
+        resolveStart(self, address, port);
 
-    if(pthread_create(&self->connectThread, &attr, connectionThread, parms))
-        abort();
+    free(address);
 }
 
 void NodeClose(Node *self)
 {
+    eventsRemove(self);
     close(self->connection);
 
     self->connection = -1;
@@ -271,15 +437,6 @@ void NodeClose(Node *self)
 
     self->connectAttemptCount = self->connectAttemptCount + 1;
 
-    if(self->connectThread) {
-
-        pthread_cancel(self->connectThread);
-        pthread_join(self->connectThread, NULL);
-        self->connectThread = 0;
-    }
-
-    self->connectThread = 0;
-
     NodeReset(self);
 
     NotificationsFire(NodeConnectionStatusChanged, DictNew());
@@ -290,23 +447,50 @@ static void NodeProcessWrite(Node *self)
 
 }
 
+// Makes room for 'readSize' more bytes at 'inputLength'. Unparsed bytes slide to the front only once the
+// parsed prefix is at least as large as them, so the memmove cost is amortized O(1) per received byte.
+static void prepareInputBuffer(Node *self, uint32_t readSize)
+{
+    uint32_t unread = self->inputLength - self->inputOffset;
+
+    if(self->inputOffset && self->inputOffset >= unread) {
+
+        memmove(self->inputBuffer.bytes, self->inputBuffer.bytes + self->inputOffset, unread);
+
+        self->inputOffset = 0;
+        self->inputLength = unread;
+    }
+
+    if(self->inputBuffer.length - self->inputLength < readSize)
+        self->inputBuffer = DataUntrack(DataResize(self->inputBuffer, self->inputLength + readSize));
+}
+
 static void NodeProcessRead(Node *self)
 {
     DataTrackPush();
 
-    uint8_t buffer[SINGLE_READ_BUFFER];
+    int readSize = 0;
+
+    // Read whatever the kernel has queued (within limits) straight into the input buffer
+    if(ioctl(self->connection, FIONREAD, &readSize) < 0 || readSize < MIN_READ_BUFFER)
+        readSize = MIN_READ_BUFFER;
+
+    if(readSize > SINGLE_READ_BUFFER)
+        readSize = SINGLE_READ_BUFFER;
 
-    ssize_t result = recv(self->connection, buffer, sizeof(buffer), 0);
+    prepareInputBuffer(self, readSize);
+
+    ssize_t result = recv(self->connection, self->inputBuffer.bytes + self->inputLength, readSize, 0);
 
     if(result > 0) {
 
-        if(self->inputBuffer.length + result > MAX_ALLOWED_BUFFER_BACKLOG) {
+        if(self->inputLength - self->inputOffset + result > MAX_ALLOWED_BUFFER_BACKLOG) {
 
             NodeClose(self);
         }
         else {
 
-            self->inputBuffer = DataUntrack(DataAppend(self->inputBuffer, DataRef(buffer, (uint32_t)result)));
+            self->inputLength += (uint32_t)result;
 
             processInputBuffer(self);
         }
@@ -321,7 +505,10 @@ static void NodeProcessRead(Node *self)
         NotificationsFire(NodeConnectionStatusChanged, DictNew());
     }
 
-    if(result == -1) {
+    // Nothing to read after all, or a signal got there first. Neither is the peer's fault.
+    if(result == -1 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+
+        NodeLog("recv() failed: %s", strerror(errno));
 
         NodeClose(self);
 
@@ -335,20 +522,13 @@ void NodeProcessPackets(Node *self)
 {
     int sd = self->connection;
 
-    if(sd < 1)
-        return;
-
-    if(self->connectThread) {
+    // Still waiting on an address lookup
+    if(sd < 1) {
 
-        pthread_join(self->connectThread, NULL);
-        self->connectThread = 0;
+        NodeProcessReady(self, 0, 0, 0);
+        return;
     }
 
-    DataTrackPush();
-
-    if(self->inputBuffer.length)
-        processInputBuffer(self);
-
     fd_set read, write, except;
 
     FD_ZERO(&read);
@@ -363,30 +543,103 @@ void NodeProcessPackets(Node *self)
 
     int activity = select(sd + 1, &read, &write, &except, &waitTime);
 
-    switch(activity) {
-        case 0:
-            perror("select() shouldn't return 0");
+    if(activity == -1) {
 
-        case -1:
-            perror("select()");
-            NodeClose(self);
-            abort();
-            break;
+        perror("select()");
+        NodeClose(self);
+        abort();
+    }
 
-        default:
-            if(self->connection > 0 && FD_ISSET(self->connection, &read)) {
+    NodeProcessReady(self, FD_ISSET(sd, &read), FD_ISSET(sd, &write), FD_ISSET(sd, &except));
+}
 
-                NodeProcessRead(self);
-            }
-            if(self->connection > 0 && FD_ISSET(self->connection, &write)) {
+void NodeProcessReady(Node *self, int readable, int writable, int error)
+{
+    if(self->resolve) {
 
-                NodeProcessWrite(self);
-            }
-            if(self->connection > 0 && FD_ISSET(self->connection, &except)) {
+        NodeResolve *resolve = self->resolve;
 
-                NodeLog("socket select exception, dropping node connetion");
-                NodeClose(self);
+        pthread_mutex_lock(&resolveLock);
+
+        int done = resolve->done;
+
+        pthread_mutex_unlock(&resolveLock);
+
+        if(!done)
+            return;
+
+        self->resolve = NULL;
+
+        if(resolve->error) {
+
+            NodeLog("Address lookup failed: %s", gai_strerror(resolve->error));
+
+            resolveRelease(resolve);
+        }
+        else {
+
+            self->addresses = resolve;
+
+            connectNext(self);
+        }
+    }
+
+    if(self->connection < 1)
+        return;
+
+    if(self->connecting) {
+
+        if(!readable && !writable && !error)
+            return;
+
+        int result = 0;
+        socklen_t length = sizeof(result);
+
+        if(getsockopt(self->connection, SOL_SOCKET, SO_ERROR, &result, &length) < 0)
+            result = errno;
+
+        if(result == EINPROGRESS)
+            return;
+
+        if(result) {
+
+            NodeLog("connect() failed: %s", strerror(result));
+
+            // The lookup may have more addresses for the host
+            if(self->addresses && self->addresses->next) {
+
+                eventsRemove(self);
+                close(self->connection);
+
+                self->connection = -1;
+                self->connecting = 0;
+
+                connectNext(self);
+                return;
             }
+
+            NodeClose(self);
+            return;
+        }
+
+        connectFinished(self);
+    }
+
+    DataTrackPush();
+
+    if(self->inputLength > self->inputOffset)
+        processInputBuffer(self);
+
+    if(self->connection > 0 && readable)
+        NodeProcessRead(self);
+
+    if(self->connection > 0 && writable)
+        NodeProcessWrite(self);
+
+    if(self->connection > 0 && error) {
+
+        NodeLog("socket select exception, dropping node connetion");
+        NodeClose(self);
     }
 
     processVersionAndOutputBuffer(self);
@@ -394,39 +647,43 @@ void NodeProcessPackets(Node *self)
     DataTrackPop();
 }
 
-static void processInputBuffer(Node *self)
+int NodeWantsWrite(Node *self)
 {
-    DataTrackPush();
+    return self->connection > 0 && (self->connecting || self->versionPacket.length || self->outputBuffer.length);
+}
 
+int NodeIsConnecting(Node *self)
+{
+    return self->resolve || self->connecting;
+}
+
+int NodeHasUnprocessedInput(Node *self)
+{
+    return self->connection > 0 && self->inputLength > self->inputOffset;
+}
+
+static void processInputBuffer(Node *self)
+{
     (void)testMagic;
     (void)nameMagic;
 
     if(sizeof(PacketHeader) != 4 + 12 + 4 + 4)
         abort();
 
-    uint8_t *ptr = (void*)self->inputBuffer.bytes;
-    uint8_t *end = ptr + self->inputBuffer.length;
+    const uint8_t *magic = self->testnet ? test3Magic : mainMagic;
 
-    int count = 0;
-
-    while(ptr + sizeof(PacketHeader) <= end) {
+    char *bytes = self->inputBuffer.bytes;
 
-        DataTrackPush();
+    uint8_t *ptr = (uint8_t*)bytes + self->inputOffset;
+    uint8_t *end = (uint8_t*)bytes + self->inputLength;
 
-        if(++count > PACKETS_PER_PROCESS) {
+    int count = 0;
 
-            break;
-        }
+    while(ptr + sizeof(PacketHeader) <= end && count < PACKETS_PER_PROCESS) {
 
         PacketHeader *header = (PacketHeader*)ptr;
 
-        if(!self->testnet && 0 != memcmp(header->magic, mainMagic, 4)) {
-
-            ptr++;
-            continue;
-        }
-
-        if(self->testnet && 0 != memcmp(header->magic, test3Magic, 4)) {
+        if(0 != memcmp(header->magic, magic, 4)) {
 
             ptr++;
             continue;
@@ -435,36 +692,51 @@ static void processInputBuffer(Node *self)
         if(sizeof(PacketHeader) + header->length > (end - ptr))
             break;
 
+        count++;
+
         uint8_t *payload = ptr + sizeof(PacketHeader);
 
         ptr += sizeof(PacketHeader) + header->length;
 
-        Data payloadObj = DataRef(payload, header->length);
-
         char buf[sizeof(header->command) + 1];
         memset(buf, 0, sizeof(header->command) + 1);
         memcpy(buf, header->command, sizeof(header->command));
 
-        String command = StringNew(buf);
+        uint8_t hash[32];
 
-        Data hash = hash256(DataRef(payload, header->length));
+        hash256Bytes(payload, header->length, hash);
 
-        if(hash.length < 4 || 0 != memcmp(header->checksum, hash.bytes, 4)) {
+        if(0 != memcmp(header->checksum, hash, 4)) {
 
-            NodeLog("dropping %s packet with invalid checksum", command.bytes);
+            NodeLog("dropping %s packet with invalid checksum", buf);
             continue;
         }
 
-        received(self, command, payloadObj);
+        self->inputOffset = (uint32_t)(ptr - (uint8_t*)bytes);
+
+        DataTrackPush();
+
+        // Delegates get a slice of the input buffer -- see NodeDelegate's notice on copying
+        received(self, StringNew(buf), DataRef(payload, header->length));
 
         DataTrackPop();
+
+        // The node was closed (and its buffers freed) while handling the packet
+        if(self->inputBuffer.bytes != bytes)
+            return;
     }
 
-    unsigned long usedBytes = ptr - (uint8_t*)self->inputBuffer.bytes;
+    self->inputOffset = (uint32_t)(ptr - (uint8_t*)bytes);
 
-    self->inputBuffer = DataUntrack(DataDelete(self->inputBuffer, 0, (uint32_t)usedBytes));
+    if(self->inputOffset == self->inputLength) {
 
-    DataTrackPop();
+        self->inputOffset = 0;
+        self->inputLength = 0;
+
+        // Give back the memory from a large burst once it has all been parsed
+        if(self->inputBuffer.length > SINGLE_READ_BUFFER)
+            self->inputBuffer = DataUntrack(DataResize(self->inputBuffer, MIN_READ_BUFFER));
+    }
 }
 
 static int processVersionAndOutputBuffer(Node *self)
@@ -683,16 +955,17 @@ static void received(Node *self, String command, Data payload)
 
         CmdRequire(count <= 50000, "inv count higher than spec");
 
-        Datas types = DatasNew();
-        Datas hashes = DatasNew();
+        // Reserve no more than the payload can actually hold
+        Datas types = DatasReserve(DatasNew(), (uint32_t)MIN(count, (uint64_t)(end - ptr) / 36));
+        Datas hashes = DatasReserve(DatasNew(), types.capacity);
 
         for(int i = 0; i < count; i++) {
 
             uint32_t *type = CmdPtrIncrement(sizeof(*type));
             uint8_t *hash = CmdPtrIncrement(32);
 
-            types = DatasAddCopy(types, DataRaw(*type));
-            hashes = DatasAddCopy(hashes, DataRef(hash, 32));
+            types = DatasAddRef(types, DataRef(type, sizeof(*type)));
+            hashes = DatasAddRef(hashes, DataRef(hash, 32));
         }
 
         if(self->delegate.inventory)
@@ -704,7 +977,7 @@ static void received(Node *self, String command, Data payload)
 
         CmdRequire(count <= 2000, "received more than 2000 headers at once");
 
-        Datas result = DatasNew();
+        Datas result = DatasReserve(DatasNew(), (uint32_t)MIN(count, (uint64_t)(end - ptr) / 81));
 
         for(int i = 0; i < count; i++) {
 
@@ -715,7 +988,7 @@ static void received(Node *self, String command, Data payload)
 
             self->lastHeadersOrMerkleMessage = time(0);
 
-            result = DatasAddCopy(result, DataRef(header, (uint32_t)(ptr - header)));
+            result = DatasAddRef(result, DataRef(header, (uint32_t)(ptr - header)));
         }
 
         if(self->delegate.blockHeaders)
@@ -733,6 +1006,45 @@ static void received(Node *self, String command, Data payload)
         if(self->delegate.tx)
             self->delegate.tx(self, payload);
     }
+    else if(DataEqual(command, StringNew("block"))) {
+
+        CmdRequire(payload.length > 80, "block too small");
+
+        self->lastHeadersOrMerkleMessage = time(0);
+
+        if(self->delegate.block)
+            self->delegate.block(self, payload);
+    }
+    else if(DataEqual(command, StringNew("cfilter"))) {
+
+        uint8_t *filterType = CmdPtrIncrement(1);
+        uint8_t *blockHash = CmdPtrIncrement(32);
+        uint64_t length = readVarInt(&ptr, end);
+
+        CmdRequire(length <= (uint64_t)(end - ptr), "cfilter shorter than its length");
+
+        self->lastHeadersOrMerkleMessage = time(0);
+
+        if(self->delegate.compactFilter)
+            self->delegate.compactFilter(self, *filterType, DataRef(blockHash, 32), DataRef((void*)ptr, (uint32_t)length));
+    }
+    else if(DataEqual(command, StringNew("cfheaders"))) {
+
+        uint8_t *filterType = CmdPtrIncrement(1);
+        uint8_t *stopHash = CmdPtrIncrement(32);
+        uint8_t *previousHeader = CmdPtrIncrement(32);
+        uint64_t count = readVarInt(&ptr, end);
+
+        CmdRequire(count <= 2000 && count * 32 <= (uint64_t)(end - ptr), "cfheaders count doesn't fit");
+
+        Datas filterHashes = DatasReserve(DatasNew(), (uint32_t)count);
+
+        for(int i = 0; i < count; i++)
+            filterHashes = DatasAddRef(filterHashes, DataRef((void*)(ptr + i * 32), 32));
+
+        if(self->delegate.compactFilterHeaders)
+            self->delegate.compactFilterHeaders(self, *filterType, DataRef(stopHash, 32), DataRef(previousHeader, 32), filterHashes);
+    }
     else if(DataEqual(command, StringNew("reject"))) {
 
         String message = readString(&ptr, end);
@@ -819,6 +1131,14 @@ void NodeFilterLoad(Node *self, Data bloomFilter)
     self->curBloomFilter = DataUntrackCopy(bloomFilter);
 }
 
+void NodeFilterAdd(Node *self, Data element)
+{
+    nodeSend(self, "filteradd", DataAddCopy(varIntD(element.length), element));
+
+    if(self->curBloomFilter.bytes)
+        bloomFilterAddElement(self->curBloomFilter, element);
+}
+
 void NodeFilterClear(Node *self)
 {
     nodeSend(self, "filterclear", DataNull());
@@ -881,6 +1201,26 @@ void NodeGetData(Node *self, Datas inventoryVectors)
     nodeSend(self, "getdata", payload);
 }
 
+static Data compactFilterRequest(uint8_t filterType, uint32_t startHeight, Data stopHash)
+{
+    Data payload = DataCopy((char*)&filterType, 1);
+
+    payload = DataAppend(payload, uint32D(startHeight));
+    payload = DataAppend(payload, stopHash);
+
+    return payload;
+}
+
+void NodeGetCompactFilters(Node *self, uint8_t filterType, uint32_t startHeight, Data stopHash)
+{
+    nodeSend(self, "getcfilters", compactFilterRequest(filterType, startHeight, stopHash));
+}
+
+void NodeGetCompactFilterHeaders(Node *self, uint8_t filterType, uint32_t startHeight, Data stopHash)
+{
+    nodeSend(self, "getcfheaders", compactFilterRequest(filterType, startHeight, stopHash));
+}
+
 int NodeIsEqual(Node *nodeOne, Node *nodeTwo)
 {
     return DataEqual(nodeOne->address, nodeTwo->address);
@@ -13,6 +13,7 @@ static InventoryType InventoryTypeTx = 1;
 static InventoryType InventoryTypeBlock = 2;
 static InventoryType InventoryTypeFilteredBlock = 3;
 static InventoryType InventoryTypeCompactBlock = 4;
+static InventoryType InventoryTypeWitnessBlock = 0x40000002;
 
 typedef struct Node {
 
@@ -29,6 +30,9 @@ typedef struct Node {
         void (*blockHeaders)(struct Node *node, Datas headers);
         void (*inventory)(struct Node *node, Datas types, Datas hashes);
         void (*tx)(struct Node *node, Data tx);
+        void (*block)(struct Node *node, Data block);
+        void (*compactFilter)(struct Node *node, uint8_t filterType, Data blockHash, Data filter);
+        void (*compactFilterHeaders)(struct Node *node, uint8_t filterType, Data stopHash, Data previousHeader, Datas filterHashes);
         int (*message)(struct Node *node, String message, char rejectCode, String reason, Data data); // Return non-zero to have this issue added to rejectCodes.
 
         void *extraPtr;
@@ -43,6 +47,16 @@ typedef struct Node {
     int32_t lastDlHeight;
     int32_t lastDlSize;
 
+    int filterMatchCount; // Blocks requested for matching compact filters that haven't arrived yet
+    int32_t lastFilterHeight;
+
+    // The window's filter header chain from 'filterHeadersHeight' up. Each compact filter has to be the one it
+    // commits to. Until it arrives from 'filterHeadersNode', 'filterHeadersStop' is the window's last hash.
+    Datas filterHeaders;
+    int32_t filterHeadersHeight;
+    Data filterHeadersStop;
+    struct Node *filterHeadersNode;
+
     Datas errors;
     Datas rejectCodes;
 
@@ -68,14 +82,23 @@ typedef struct Node {
     /** internal properties **/
 
     int connection;
+    int eventFd; // epoll instance 'connection' is registered with while open, -1 for none
+    uint32_t eventMask; // Events 'connection' is registered for, 0 while it isn't
 
+    // Received bytes are read straight into 'inputBuffer' and parsed in place.
+    // [inputOffset, inputLength) holds bytes received but not yet parsed.
     Data inputBuffer;
+    uint32_t inputOffset;
+    uint32_t inputLength;
+
     Data outputBuffer;
 
     Data versionPacket;
 
     int connectAttemptCount;
-    pthread_t connectThread;
+    int connecting; // A non-blocking connect() is in flight on 'connection'
+    struct NodeResolve *resolve; // Hostname lookup pending on a resolver thread
+    struct NodeResolve *addresses; // A finished lookup whose remaining addresses are tried as connects fail
 
 } Node;
 
@@ -85,13 +108,28 @@ void NodeFree(Node *node);
 void NodeConnect(Node *node);
 void NodeClose(Node *node);
 
+// Hostname lookups share a few resolver threads. This waits on pending lookups and stops the threads.
+void NodeResolversShutdown(void);
+
 // Call this repeatidly to process packets & connection state for node.
 void NodeProcessPackets(Node *node);
 
+// For event loops that already know the socket's state. Same as 'NodeProcessPackets' minus the select().
+void NodeProcessReady(Node *node, int readable, int writable, int error);
+int NodeWantsWrite(Node *node); // Queued output is waiting on the socket
+
+// Registers each socket the node opens with the epoll instance 'eventFd' (-1 for none) until it closes.
+// Call 'NodeUpdateEvents' before waiting, it adds or drops write interest when 'NodeWantsWrite' changed.
+void NodeSetEventFd(Node *node, int eventFd);
+void NodeUpdateEvents(Node *node);
+int NodeHasUnprocessedInput(Node *node); // Packets are still buffered (PACKETS_PER_PROCESS was hit)
+int NodeIsConnecting(Node *node); // An address lookup or connect() started by 'NodeConnect' hasn't finished yet
+
 // This must be the first message
 void NodeSendVersion(Node *node, int relayFlag);
 
 void NodeFilterLoad(Node *node, Data bloomFilter);
+void NodeFilterAdd(Node *node, Data element); // Adds to the loaded filter, elements are at most 520 bytes
 void NodeFilterClear(Node *node);
 
 void NodeSendTx(Node *node, Data tx);
@@ -102,6 +140,10 @@ void NodeSendPing(Node *node);
 void NodeGetHeaders(Node *node, Datas knownBlockHashes, Data stopHash);
 void NodeGetData(Node *node, Datas inventoryVectors);
 
+// BIP157. At most 1000 filters or 2000 filter headers from 'startHeight' through the block 'stopHash'.
+void NodeGetCompactFilters(Node *node, uint8_t filterType, uint32_t startHeight, Data stopHash);
+void NodeGetCompactFilterHeaders(Node *node, uint8_t filterType, uint32_t startHeight, Data stopHash);
+
 // For nodes 'address' is compared.
 int NodeIsEqual(Node *nodeOne, Node *nodeTwo);
 
@@ -7,11 +7,17 @@
 #define MAX_ALLOWED_BUFFER_BACKLOG 10 * 1024 * 1024
 
 // The max number of bytes processed by a single call to 'NodeProcessPackets'
-// Too small and you'll never catch up with a fast connection, too large and you'll exhause the stack
-#define SINGLE_READ_BUFFER 1024 * 1024
+// Too small and you'll never catch up with a fast connection, too large and idle nodes hold on to memory
+#define SINGLE_READ_BUFFER (1024 * 1024)
+
+// Reads are sized to the bytes queued on the socket but never less than this
+#define MIN_READ_BUFFER (16 * 1024)
 
 #define PACKETS_PER_PROCESS 1000
 
+// Threads shared by all nodes for hostname lookups. Literal IP addresses don't use them.
+#define NODE_RESOLVER_THREADS 2
+
 #define NODE_VERSION 70001
 
 #define MAIN_MAGIC { 0xf9, 0xbe, 0xb4, 0xd9 }
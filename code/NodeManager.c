@@ -10,11 +10,20 @@
 #import "BTCUtil.h"
 #import "Database.h"
 #import "MerkleBlock.h"
+#include "BlockFilter.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
 #import "TransactionTracker.h"
 #include "Notifications.h"
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
 #ifdef __ANDROID__
 #include <android/log.h>
 #define printf(...) __android_log_print(ANDROID_LOG_INFO, "NodeManager", __VA_ARGS__)
@@ -24,6 +33,8 @@ const char *NodeManagerBlockchainSyncChange = "NodeManagerBlockchainSyncChange";
 
 NodeManager nodeManager = {0};
 
+static pthread_once_t reorgListenerOnce = PTHREAD_ONCE_INIT;
+
 #ifndef BTCUtilAssert
 #define BTCUtilAssert(...)
 #endif
@@ -40,10 +51,11 @@ NodeManager nodeManager = {0};
 #define SERVICE_NODE_GETUTXO 2
 #define SERVICE_NODE_BLOOM 4
 #define SERVICE_NODE_WITNESS 8
+#define SERVICE_NODE_COMPACT_FILTERS 64
 #define SERVICE_NODE_LIMITED 1024
 
-// Max value is 50000
-#define GET_DATA_BLOCK_COUNT 5000
+// Heights in each node's download window. Max value is 50000
+#define GET_DATA_BLOCK_COUNT 1000
 
 #define CONSECUTIVE_BADBLOCKS_RESET_LIMIT (2000 * 5 + 1)
 
@@ -61,13 +73,31 @@ NodeManager nodeManager = {0};
 #define ACTIVE_NODE_COUNT 8
 #define REQUIRED_SERVICES (SERVICE_NODE_BLOOM | SERVICE_NODE_WITNESS)
 
+// Resolver threads don't wake the run loop so it checks back this often while a lookup is pending
+#define RUN_LOOP_CONNECT_POLL_MILLISECONDS 100
+#define RUN_LOOP_MAX_EVENTS 64
+
+typedef struct WatchedFd {
+
+    int fd;
+    void (*callback)(int fd, void *ptr);
+    void *ptr;
+
+} WatchedFd;
+
+static void startQueuedConnects(NodeManager *self);
+
 static void requestTransactions(NodeManager *self);
 static void requestHeaders(NodeManager *self, Node *node);
+static void blockDownloaded(NodeManager *self, Node *node, int32_t height, int requestMore);
+static void addReorgListener();
 
 const char *TxProcessing = "TxProcessing";
 
 NodeManager NodeManagerNew(uint64_t walletCreationDate)
 {
+    pthread_once(&reorgListenerOnce, addReorgListener);
+
     NodeManager self = { 0 };
 
     pthread_mutexattr_t recursiveAttr;
@@ -88,6 +118,13 @@ NodeManager NodeManagerNew(uint64_t walletCreationDate)
     self.walletCreationDate = walletCreationDate;
     self.workQueue = WorkQueueNew();
     self.automaticallyPublishWaitingTransactions = 1;
+    self.maxConnectsInFlight = NODE_CONNECTS_IN_FLIGHT;
+    self.eventFd = -1;
+    self.wakePipe[0] = -1;
+    self.wakePipe[1] = -1;
+    self.watchedFds = DatasNew();
+    self.blockDownload = BlockDownloadNew(GET_DATA_BLOCK_COUNT);
+    self.filterScripts = DatasUntrack(DatasNew());
 
     return self;
 }
@@ -117,6 +154,25 @@ void NodeManagerFree(NodeManager *self)
 
     DatasFree(self->sendTxOnResults);
 
+    WorkQueueSetWakeFd(&self->workQueue, -1);
+
+    if(self->wakePipe[1] >= 0)
+        NotificationsSetWakeFd(-1);
+
+    if(self->eventFd >= 0)
+        close(self->eventFd);
+
+    if(self->wakePipe[0] >= 0) {
+
+        close(self->wakePipe[0]);
+        close(self->wakePipe[1]);
+    }
+
+    DatasFree(self->watchedFds);
+
+    BlockDownloadFree(&self->blockDownload);
+    DatasFree(self->filterScripts);
+
     WorkQueueFree(self->workQueue);
 }
 
@@ -255,6 +311,8 @@ void NodeManagerProcessNodes(NodeManager *self)
 {
     pthread_mutex_lock(&self->nodesMutex);
 
+    startQueuedConnects(self);
+
     FORIN(Node, node, self->nodes)
         NodeProcessPackets(node);
 
@@ -263,6 +321,210 @@ void NodeManagerProcessNodes(NodeManager *self)
     WorkQueueExecuteAll(&self->workQueue);
 }
 
+// Adds 'fd' to the epoll set for reading, or removes it
+static void runLoopRegister(NodeManager *self, int fd, int add)
+{
+#ifdef __linux__
+    if(self->eventFd < 0)
+        return;
+
+    struct epoll_event event = { 0 };
+
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+
+    epoll_ctl(self->eventFd, add ? EPOLL_CTL_ADD : EPOLL_CTL_DEL, fd, add ? &event : NULL);
+#endif
+}
+
+static void runLoopSetup(NodeManager *self)
+{
+    if(self->wakePipe[0] >= 0)
+        return;
+
+    if(pipe(self->wakePipe) != 0)
+        abort();
+
+    fcntl(self->wakePipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(self->wakePipe[1], F_SETFL, O_NONBLOCK);
+
+#ifdef __linux__
+    self->eventFd = epoll_create1(EPOLL_CLOEXEC);
+
+    if(self->eventFd < 0)
+        abort();
+#endif
+
+    // Peer sockets are registered by their nodes, see runLoopInterest
+    runLoopRegister(self, self->wakePipe[0], 1);
+
+    FORIN(WatchedFd, watched, self->watchedFds)
+        runLoopRegister(self, watched->fd, 1);
+
+    WorkQueueSetWakeFd(&self->workQueue, self->wakePipe[1]);
+    NotificationsSetWakeFd(self->wakePipe[1]);
+}
+
+// Builds a 'struct pollfd' array of everything the run loop should wait on. The wake pipe is always first.
+static Data runLoopInterest(NodeManager *self, int *timeout)
+{
+    struct pollfd wake = { self->wakePipe[0], POLLIN, 0 };
+
+    Data fds = DataCopyData(DataRaw(wake));
+
+    pthread_mutex_lock(&self->nodesMutex);
+
+    startQueuedConnects(self);
+
+    FORIN(Node, node, self->nodes) {
+
+        if(NodeHasUnprocessedInput(node))
+            *timeout = 0;
+
+        if(node->resolve && (*timeout < 0 || *timeout > RUN_LOOP_CONNECT_POLL_MILLISECONDS))
+            *timeout = RUN_LOOP_CONNECT_POLL_MILLISECONDS;
+
+        if(node->eventFd != self->eventFd)
+            NodeSetEventFd(node, self->eventFd);
+
+        NodeUpdateEvents(node);
+
+        if(node->connection > 0) {
+
+            struct pollfd item = { node->connection, POLLIN | (NodeWantsWrite(node) ? POLLOUT : 0), 0 };
+
+            fds = DataAppend(fds, DataRaw(item));
+        }
+    }
+
+    pthread_mutex_unlock(&self->nodesMutex);
+
+    FORIN(WatchedFd, watched, self->watchedFds) {
+
+        struct pollfd item = { watched->fd, POLLIN, 0 };
+
+        fds = DataAppend(fds, DataRaw(item));
+    }
+
+    return fds;
+}
+
+static struct pollfd *runLoopFind(Data fds, int fd)
+{
+    for(struct pollfd *item = (void*)fds.bytes; (char*)item < fds.bytes + fds.length; item++)
+        if(item->fd == fd)
+            return item;
+
+    return NULL;
+}
+
+// Fills in 'revents' of 'fds'. With epoll they're all registered already, peer sockets by their nodes
+// and the wake pipe and watched fds by runLoopSetup and NodeManagerWatchFd.
+static void runLoopWait(NodeManager *self, Data fds, int timeout)
+{
+#ifdef __linux__
+    struct epoll_event events[RUN_LOOP_MAX_EVENTS];
+
+    int eventCount = epoll_wait(self->eventFd, events, RUN_LOOP_MAX_EVENTS, timeout);
+
+    for(int i = 0; i < eventCount; i++) {
+
+        struct pollfd *item = runLoopFind(fds, events[i].data.fd);
+
+        if(!item)
+            continue;
+
+        item->revents |= (events[i].events & EPOLLIN) ? POLLIN : 0;
+        item->revents |= (events[i].events & EPOLLOUT) ? POLLOUT : 0;
+        item->revents |= (events[i].events & EPOLLHUP) ? POLLHUP : 0;
+        item->revents |= (events[i].events & EPOLLERR) ? POLLERR : 0;
+    }
+#else
+    poll((struct pollfd*)fds.bytes, fds.length / sizeof(struct pollfd), timeout);
+#endif
+}
+
+void NodeManagerRunLoop(NodeManager *self, int maxWaitMilliseconds)
+{
+    runLoopSetup(self);
+
+    DataTrackPush();
+
+    int timeout = maxWaitMilliseconds;
+
+    int64_t untilWork = WorkQueueMillisecondsUntilReady(&self->workQueue);
+
+    if(untilWork >= 0 && (timeout < 0 || untilWork < timeout))
+        timeout = (int)untilWork;
+
+    Data fds = runLoopInterest(self, &timeout);
+
+    runLoopWait(self, fds, timeout);
+
+    struct pollfd *wake = (void*)fds.bytes;
+
+    if(wake->revents & POLLIN) {
+
+        char buffer[64];
+
+        while(read(self->wakePipe[0], buffer, sizeof(buffer)) > 0)
+            ;
+    }
+
+    pthread_mutex_lock(&self->nodesMutex);
+
+    FORIN(Node, node, self->nodes) {
+
+        struct pollfd *item = node->connection > 0 ? runLoopFind(fds, node->connection) : NULL;
+        short revents = item ? item->revents : 0;
+
+        // Nodes without events still get a pass to join connection threads, flush output and parse leftovers
+        NodeProcessReady(node, revents & (POLLIN | POLLHUP), revents & POLLOUT, revents & (POLLERR | POLLNVAL));
+    }
+
+    pthread_mutex_unlock(&self->nodesMutex);
+
+    // Callbacks may (un)watch fds so they run off a copy
+    Datas watchedFds = DatasCopy(self->watchedFds);
+
+    FORIN(WatchedFd, watched, watchedFds) {
+
+        struct pollfd *item = runLoopFind(fds, watched->fd);
+
+        if(item && item->revents)
+            watched->callback(watched->fd, watched->ptr);
+    }
+
+    WorkQueueExecuteAll(&self->workQueue);
+
+    DataTrackPop();
+}
+
+void NodeManagerWatchFd(NodeManager *self, int fd, void (*callback)(int fd, void *ptr), void *ptr)
+{
+    WatchedFd watched = { fd, callback, ptr };
+
+    NodeManagerUnwatchFd(self, fd);
+
+    self->watchedFds = DatasUntrack(DatasAddCopy(self->watchedFds, DataRaw(watched)));
+
+    runLoopRegister(self, fd, 1);
+}
+
+void NodeManagerUnwatchFd(NodeManager *self, int fd)
+{
+    for(int i = 0; i < self->watchedFds.count; i++) {
+
+        if(((WatchedFd*)self->watchedFds.ptr[i].bytes)->fd == fd) {
+
+            self->watchedFds = DatasUntrack(DatasRemoveIndex(self->watchedFds, i));
+            i--;
+
+            runLoopRegister(self, fd, 0);
+        }
+    }
+}
+
 Datas *NodeManagerAllNodes(NodeManager *self)
 {
     return &self->nodes;
@@ -355,6 +617,8 @@ static void changeActiveNode(NodeManager *self)
         NodeClose(oldNode);
         oldNode->delegate = (struct NodeDelegate) {0};
 
+        BlockDownloadRelease(&self->blockDownload, oldNode);
+
         removeAddress(oldNode->address);
         // TODO: Go through workQueue dicts and remove all items that reference "oldnode"
         NodeFree(oldNode);
@@ -400,9 +664,13 @@ static void blockHeadersWorkMain(NodeManager *self, Dict dict)
     Data hash = DictGetS(dict, "hash");
     int addCount = DataGetInt(DictGetS(dict, "addCount"));
     int rejectCount = DataGetInt(DictGetS(dict, "rejectCount"));
+    int pipelined = DataGetInt(DictGetS(dict, "pipelined"));
 
     pthread_mutex_lock(&self->nodesMutex);
 
+    if(DataGetInt(DictGetS(dict, "queued")))
+        self->headerBatchesQueued--;
+
     if(!nodeStillValid(self, node)) {
 
         pthread_mutex_unlock(&self->nodesMutex);
@@ -411,6 +679,30 @@ static void blockHeadersWorkMain(NodeManager *self, Dict dict)
     
     node->lastHeadersOrMerkleMessage = time(0);
 
+    // Headers failing proof of work mean a bad peer rather than a bad database. Drop the peer
+    // instead of counting toward CONSECUTIVE_BADBLOCKS_RESET_LIMIT.
+    if(addCount < 0) {
+
+        printf("%s sent headers failing proof of work, disconnecting\n", NodeDescription(node).bytes);
+
+        if(node == self->activeNode) {
+
+            changeActiveNode(self);
+
+            if(self->activeNode)
+                requestHeaders(self, self->activeNode);
+        }
+        else {
+
+            NodeClose(node);
+            BlockDownloadRelease(&self->blockDownload, node);
+        }
+
+        pthread_mutex_unlock(&self->nodesMutex);
+
+        return;
+    }
+
     // This was a block annoncement -- no need to modify active node->
     if(headerCount == 1) {
 
@@ -422,7 +714,7 @@ static void blockHeadersWorkMain(NodeManager *self, Dict dict)
         return;
     }
 
-    if(headerCount != 2000 && addCount == headerCount) {
+    if(headerCount != HEADERS_BATCH_COUNT && addCount == headerCount) {
 
         printf("Blockchain headers are up to date!\n");
         self->rejectCount = 0;
@@ -454,7 +746,8 @@ static void blockHeadersWorkMain(NodeManager *self, Dict dict)
         changeActiveNode(self);
     }
 
-    if(wasActive)
+    // Pipelined batches already asked for what follows them. A node that was replaced above gets asked anew.
+    if(wasActive && (!pipelined || node != self->activeNode))
         requestHeaders(self, self->activeNode);
 
     pthread_mutex_unlock(&self->nodesMutex);
@@ -493,31 +786,10 @@ static void blockHeadersWork(Database *db, Dict dict)
 
     DictAddS(&dict, "hash", hash);
 
-    int addCount = 0;
-    int rejectCount = 0;
-
-    FORDATAIN(data, headers) {
-
-        DataTrackPush();
+    int addCount = DatabaseAddBlocks(&database, headers);
+    int rejectCount = addCount < 0 ? headers.count : headers.count - addCount;
 
-        BTCUtilAssert(data->length >= 80);
-
-        if(data->length < 80)
-            return;
-
-        MerkleBlock block = MerkleBlockNew(DataCopyData(*data));
-
-        if(DatabaseAddBlock(&database, &block))
-            addCount++;
-        else
-            rejectCount++;
-
-        MerkleBlockFree(&block);
-
-        DataTrackPop();
-    }
-
-    if(addCount)
+    if(addCount > 0)
         printf("Added %d blocks, new height: %d\n", addCount, DatabaseHighestHeight(&database));
 
     DictAddS(&dict, "addCount", DataInt(addCount));
@@ -537,20 +809,53 @@ void blockHeaders(Node *node, Datas headers)
         NotificationsFire(NodeManagerBlockchainSyncChange, DictNew());
     }
 
-    Dict dict = DictOneS("headers", DataDatas(headers));
+    // 'headers' point into the node's input buffer so they're copied before leaving this thread
+    Dict dict = DictOneS("headers", DataDatas(DatasCopy(headers)));
 
     DictAddS(&dict, "node", DataPtr(node));
     DictAddS(&dict, "self", DataPtr(self));
     DictAddS(&dict, "headerCount", DataInt(headers.count));
 
+    // Asks for the next batch straight away, located by this one's last header. Validation catches up
+    // on the database thread, which adds batches in the order they arrive.
+    if(node == self->activeNode && headers.count == HEADERS_BATCH_COUNT) {
+
+        DictAddS(&dict, "queued", DataInt(1));
+
+        if(++self->headerBatchesQueued < HEADERS_PIPELINE_DEPTH) {
+
+            Data lastHeader = DatasLast(headers);
+
+            Datas locator = DatasOneCopy(hash256(DataCopyDataPart(lastHeader, 0, 80)));
+
+            locator = DatasAddCopy(locator, DataCopyDataPart(DatasFirst(headers), 4, 32));
+
+            NodeGetHeaders(node, locator, DataNull());
+
+            DictAddS(&dict, "pipelined", DataInt(1));
+        }
+    }
+
     node->lastHeadersOrMerkleMessage = time(0);
 
     DatabaseExecute(&database, blockHeadersWork, dict);
 }
 
-static void requestTransactionsWorkerMain(NodeManager *self, Dict dict)
+// Call with 'nodesMutex' held. Another peer serving filters when there is one, so a single peer's filter
+// headers never vouch for its own filters.
+static Node *filterHeadersPeer(NodeManager *self, Node *node)
+{
+    FORIN(Node, other, self->nodes)
+        if(other != node && other->connected && (other->services & SERVICE_NODE_COMPACT_FILTERS))
+            return other;
+
+    return node;
+}
+
+static void requestWindowWorkerMain(NodeManager *self, Dict dict)
 {
     Node *node = DataGetPtr(DictGetS(dict, "node"));
+    int32_t lastHeight = DataGetInt(DictGetS(dict, "lastHeight"));
 
     Datas inventoryRequests = DataGetDatas(DictGetS(dict, "inventoryRequests"));
 
@@ -562,34 +867,150 @@ static void requestTransactionsWorkerMain(NodeManager *self, Dict dict)
         return;
     }
 
-    // This used to be on a background thread -- we moved it here to the main thread.
+    BlockDownloadWindow *window = BlockDownloadWindowOf(&self->blockDownload, node);
+
+    // The download was reset or the window went to another node while the hashes were looked up
+    if(!window || window->lastHeight != lastHeight) {
+
+        pthread_mutex_unlock(&self->nodesMutex);
+        return;
+    }
+
     node->lastDlSize = (int32_t)DataGetInt(DictGetS(dict, "itemCount"));
+    node->lastDlHeight = node->lastDlSize ? DatabaseHeightOf(&database, DictGetS(dict, "lastItem")) : lastHeight;
+
+    if(node->lastDlSize && self->compactFilters && (node->services & SERVICE_NODE_COMPACT_FILTERS)) {
 
-    node->lastDlHeight = DatabaseHeightOf(&database, DictGetS(dict, "lastItem"));
+        int32_t firstHeight = DataGetInt(DictGetS(dict, "firstHeight"));
 
-    NodeGetData(node, inventoryRequests);
+        node->lastHeadersOrMerkleMessage = time(0);
+        node->filterMatchCount = 0;
+        node->lastFilterHeight = window->progressHeight;
+
+        // The filters are asked for once their headers are in, see 'compactFilterHeaders'
+        DatasFree(node->filterHeaders);
+        DataFree(node->filterHeadersStop);
+
+        node->filterHeaders = DatasUntrack(DatasNew());
+        node->filterHeadersHeight = firstHeight - 1;
+        node->filterHeadersStop = DataUntrackCopy(DictGetS(dict, "lastItem"));
+        node->filterHeadersNode = filterHeadersPeer(self, node);
+
+        NodeGetCompactFilterHeaders(node->filterHeadersNode, BLOCK_FILTER_BASIC, firstHeight, node->filterHeadersStop);
+    }
+    else if(node->lastDlSize) {
+
+        node->lastHeadersOrMerkleMessage = time(0);
+
+        NodeGetData(node, inventoryRequests);
+    }
+    else {
+
+        blockDownloaded(self, node, lastHeight, 1);
+    }
 
     pthread_mutex_unlock(&self->nodesMutex);
 }
 
-static void requestTransactionsWorker(Database *database, Dict dict)
+static void requestWindowWorker(Database *database, Dict dict)
 {
     NodeManager *self = DataGetPtr(DictGetS(dict, "self"));
     Node *node = DataGetPtr(DictGetS(dict, "node"));
-    uint32_t walletCreationDate = (uint32_t)DataGetLong(DictGetS(dict, "walletCreationDate"));
+    int32_t firstHeight = DataGetInt(DictGetS(dict, "firstHeight"));
+    int32_t lastHeight = DataGetInt(DictGetS(dict, "lastHeight"));
 
-    pthread_mutex_lock(&self->nodesMutex);
+    Datas items = DatabaseBlockHashesAbove(database, firstHeight - 1, lastHeight - firstHeight + 1);
 
-    if(!nodeStillValid(self, node)) {
+    // Sparse heights (checkpoints) can pull in hashes past the window
+    while(items.count && DatabaseHeightOf(database, DatasLast(items)) > lastHeight)
+        items = DatasRemoveLast(items);
 
-        pthread_mutex_unlock(&self->nodesMutex);
+    DictAddS(&dict, "itemCount", DataInt(items.count));
+    DictAddS(&dict, "lastItem", DatasLast(items));
+
+    printf("Node[%s%s] Building bloom reqest for heights %d-%d of size %d [failures: %d/%d]\n", node->address.bytes, node->userAgent.bytes ?: "", firstHeight, lastHeight, (int)items.count, TTMismatchCount(&tracker), TTMatchCount(&tracker));
+
+    Datas inventoryRequests = DatasNew();
+
+    FORDATAIN(data, items)
+        inventoryRequests = DatasAddCopy(inventoryRequests, DataAppend(uint32D(InventoryTypeFilteredBlock), *data));
+
+    DictAddS(&dict, "inventoryRequests", DataDatas(inventoryRequests));
+
+    NodeManagerExecute(self, requestWindowWorkerMain, dict);
+}
+
+// Call with 'nodesMutex' held
+static void requestWindow(NodeManager *self, Node *node)
+{
+    BlockDownloadWindow *window = BlockDownloadAssign(&self->blockDownload, node, time(0));
+
+    if(!window)
         return;
-    }
 
-    int32_t start = DatabaseHighestBlockBeforeTime(database, walletCreationDate);
+    Dict dict = DictOneS("self", DataPtr(self));
+
+    DictAddS(&dict, "node", DataPtr(node));
+    DictAddS(&dict, "firstHeight", DataInt(window->progressHeight + 1));
+    DictAddS(&dict, "lastHeight", DataInt(window->lastHeight));
+
+    DatabaseExecute(&database, requestWindowWorker, dict);
+}
+
+// 'node' has every block and matching transaction of its window through 'height'. Progress is saved
+// each 100 heights and at the end of the window, where the node gets another if 'requestMore' is set.
+static void blockDownloaded(NodeManager *self, Node *node, int32_t height, int requestMore)
+{
+    BlockDownloadWindow *window = BlockDownloadWindowOf(&self->blockDownload, node);
+
+    if(!window)
+        return;
+
+    // Heights missing at the end of the window (sparse checkpoints) finish along with the last block
+    if(height == node->lastDlHeight)
+        height = window->lastHeight;
+
+    int finished = height == window->lastHeight;
+
+    if(!finished && height % 100)
+        return;
+
+    if(BlockDownloadProgress(&self->blockDownload, node, height, time(0)))
+        TTSetBloomFilterDlHeight(&tracker, self->blockDownload.completedHeight);
+
+    if(finished && requestMore)
+        requestTransactions(self);
+}
+
+void NodeManagerBlocksDisconnected(NodeManager *self, int32_t firstHeight, int32_t lastHeight)
+{
+    pthread_mutex_lock(&self->nodesMutex);
+
+    // Both under the lock, so a window finishing in between can't move the tracker back past the fork.
+    // Windows may hold blocks of the old branch.
+    TTBlocksDisconnected(&tracker, firstHeight, lastHeight);
+    BlockDownloadReset(&self->blockDownload, MIN(self->blockDownload.completedHeight, firstHeight - 1));
+
+    pthread_mutex_unlock(&self->nodesMutex);
+}
+
+static void reorgListener(Dict dict)
+{
+    NodeManagerBlocksDisconnected(&nodeManager, DataGetInt(DictGetS(dict, "firstHeight")), DataGetInt(DictGetS(dict, "lastHeight")));
+}
+
+static void addReorgListener()
+{
+    NotificationsAddListener(DatabaseReorgNotification, reorgListener);
+}
+
+static void requestTransactionsWorkerMain(NodeManager *self, Dict dict)
+{
+    int32_t start = DataGetInt(DictGetS(dict, "start"));
+    int32_t target = DataGetInt(DictGetS(dict, "target"));
+
+    pthread_mutex_lock(&self->nodesMutex);
 
-    start -= 144;
-    
     self->lowestSyncedHeight = start;
 
     if(TTBloomFilterDlHeight(&tracker) < start)
@@ -597,32 +1018,45 @@ static void requestTransactionsWorker(Database *database, Dict dict)
 
     start = MAX(start, TTBloomFilterDlHeight(&tracker));
 
-    Datas items = DatabaseBlockHashesAbove(database, start, GET_DATA_BLOCK_COUNT);
-
-    DictAddS(&dict, "itemCount", DataInt(items.count));
-    DictAddS(&dict, "lastItem", DatasLast(items));
+    // The download height moved on its own (bloom filter update, reorg or a reset)
+    if(start != self->blockDownload.completedHeight)
+        BlockDownloadReset(&self->blockDownload, start);
 
-    printf("Node[%s%s] Building bloom reqest from height %d of size %d [failures: %d/%d]\n", node->address.bytes, node->userAgent.bytes ?: "", DatabaseHeightOf(database, DatasFirst(items)), (int)items.count, TTMismatchCount(&tracker), TTMatchCount(&tracker));
+    BlockDownloadSetTarget(&self->blockDownload, target);
 
-    // Why isn't this on the main thread?
     TTResetFailureRate(&tracker);
 
-    Datas inventoryRequests = DatasNew();
-
-    FORDATAIN(data, items)
-        inventoryRequests = DatasAddCopy(inventoryRequests, DataAppend(uint32D(InventoryTypeFilteredBlock), *data));
+    if(self->compactFilters) {
 
-    DictAddS(&dict, "inventoryRequests", DataDatas(inventoryRequests));
+        DatasFree(self->filterScripts);
+        self->filterScripts = DatasUntrack(TTWalletScripts(&tracker));
+    }
 
-    NodeManagerExecute(self, requestTransactionsWorkerMain, dict);
+    FORIN(Node, node, self->nodes)
+        if(node->connected)
+            requestWindow(self, node);
 
     pthread_mutex_unlock(&self->nodesMutex);
 }
 
-static void requestTransactions(NodeManager *self)
+static void requestTransactionsWorker(Database *database, Dict dict)
 {
-    Node *node = self->activeNode;
+    NodeManager *self = DataGetPtr(DictGetS(dict, "self"));
+    uint32_t walletCreationDate = (uint32_t)DataGetLong(DictGetS(dict, "walletCreationDate"));
+
+    int32_t start = DatabaseHighestBlockBeforeTime(database, walletCreationDate);
+
+    start -= 144;
+
+    DictAddS(&dict, "start", DataInt(start));
+    DictAddS(&dict, "target", DataInt(DatabaseHighestHeight(database)));
 
+    NodeManagerExecute(self, requestTransactionsWorkerMain, dict);
+}
+
+// Hands a window of the filtered block download to every connected node without one
+static void requestTransactions(NodeManager *self)
+{
      if(TTBloomFilterDlHeight(&tracker) >= DatabaseHighestHeight(&database)) {
 
          pthread_mutex_lock(&self->nodesMutex);
@@ -649,11 +1083,11 @@ static void requestTransactions(NodeManager *self)
 
     Dict dict = DictNew();
 
-    DictAddS(&dict, "node", DataPtr(node));
     DictAddS(&dict, "self", DataPtr(self));
     DictAddS(&dict, "walletCreationDate", DataLong(self->walletCreationDate));
 
-    node->lastHeadersOrMerkleMessage = time(0);
+    if(self->activeNode)
+        self->activeNode->lastHeadersOrMerkleMessage = time(0);
 
     DatabaseExecute(&database, requestTransactionsWorker, dict);
 }
@@ -674,6 +1108,16 @@ static void requestHeadersWorkerMain(NodeManager *self, Dict dict)
         return;
     }
 
+    Data checkpointHash = DictGetS(dict, "checkpointHash");
+
+    // Peers answer in order, so its header is in before the headers that need its bits
+    if(checkpointHash.bytes) {
+
+        InventoryType type = node->curBloomFilter.bytes ? InventoryTypeFilteredBlock : InventoryTypeBlock;
+
+        NodeGetData(node, DatasOneCopy(DataAppend(uint32D(type), checkpointHash)));
+    }
+
     NodeGetHeaders(node, hashes, DataNull());
 
     pthread_mutex_unlock(&self->nodesMutex);
@@ -687,6 +1131,12 @@ static void requestHeadersWorker(Database *database, Dict dict)
 
     DictAddS(&dict, "hashes", DataDatas(hashes));
 
+    // Headers following a checkpoint are checked against its bits, which come from its own header
+    int32_t start = DatabaseHighestHeightOrLowestMissingAfter(database, (uint32_t)self->walletCreationDate);
+
+    if(!self->testnet && !DatabaseBitsOf(database, start))
+        DictAddS(&dict, "checkpointHash", DatabaseHashOf(database, start));
+
     NodeManagerExecute(self, requestHeadersWorkerMain, dict);
 }
 
@@ -718,22 +1168,111 @@ static void merkleBlock(struct Node *node, Data blockData)
     
     self->lastSyncedHeight = height;
 
-    if(node->lastDlHeight == height) {
+    // Blocks with matches are done once their transactions arrive, see 'txWorkerMain'
+    if(height >= 0 && matchingTxIdsIfValidRoot(&node->lastMerkleBlock).count == 0)
+        blockDownloaded(self, node, height, 1);
+}
 
-        TTSetBloomFilterDlHeight(&tracker, height);
+static void badFilterWorkMain(NodeManager *self, Dict dict)
+{
+    Node *node = DataGetPtr(DictGetS(dict, "node"));
 
-        if(matchingTxIdsIfValidRoot(&node->lastMerkleBlock).count == 0) {
+    pthread_mutex_lock(&self->nodesMutex);
 
-            requestTransactions(self);
-        }
+    if(!nodeStillValid(self, node)) {
+
+        pthread_mutex_unlock(&self->nodesMutex);
+        return;
     }
-    else if(height % 100 == 0) {
 
-        if(matchingTxIdsIfValidRoot(&node->lastMerkleBlock).count == 0) {
+    printf("%s sent a compact filter its filter headers don't commit to, disconnecting\n", NodeDescription(node).bytes);
 
-            TTSetBloomFilterDlHeight(&tracker, height);
-        }
+    BlockDownloadRelease(&self->blockDownload, node);
+
+    if(node == self->activeNode) {
+
+        changeActiveNode(self);
+
+        if(self->activeNode)
+            requestHeaders(self, self->activeNode);
+    }
+    else {
+
+        NodeClose(node);
     }
+
+    pthread_mutex_unlock(&self->nodesMutex);
+}
+
+// The headers of every window whose filters 'node' was asked to vouch for. Each header commits to its
+// filter's hash and the header before it, starting from 'previousHeader'. The window's filters follow.
+static void compactFilterHeaders(struct Node *node, uint8_t filterType, Data stopHash, Data previousHeader, Datas filterHashes)
+{
+    NodeManager *self = node->delegate.extraPtr;
+
+    if(filterType != BLOCK_FILTER_BASIC)
+        return;
+
+    FORIN(Node, waiting, self->nodes) {
+
+        if(waiting->filterHeadersNode != node || !DataEqual(waiting->filterHeadersStop, stopHash))
+            continue;
+
+        if(!BlockDownloadWindowOf(&self->blockDownload, waiting))
+            continue;
+
+        Datas headers = DatasOneCopy(previousHeader);
+
+        FORDATAIN(filterHash, filterHashes)
+            headers = DatasAddCopy(headers, hash256(DataAddCopy(*filterHash, DatasLast(headers))));
+
+        DatasFree(waiting->filterHeaders);
+
+        waiting->filterHeaders = DatasUntrack(headers);
+        waiting->filterHeadersNode = NULL;
+
+        NodeGetCompactFilters(waiting, BLOCK_FILTER_BASIC, waiting->filterHeadersHeight + 1, stopHash);
+    }
+}
+
+// A filter is in for every height of the window through 'lastFilterHeight'. Matching blocks are
+// requested as they're found and the window only moves once none are outstanding, see 'blockWorkerMain'.
+static void compactFilter(struct Node *node, uint8_t filterType, Data hash, Data filter)
+{
+    NodeManager *self = node->delegate.extraPtr;
+
+    if(filterType != BLOCK_FILTER_BASIC || !BlockDownloadWindowOf(&self->blockDownload, node))
+        return;
+
+    int32_t height = DatabaseHeightOf(&database, hash);
+
+    if(height <= node->lastFilterHeight || height > node->lastDlHeight)
+        return;
+
+    int32_t index = height - node->filterHeadersHeight;
+
+    // A filter leaving out wallet scripts would hide their transactions
+    if(index >= node->filterHeaders.count || !DataEqual(BlockFilterHeader(filter, node->filterHeaders.ptr[index - 1]), node->filterHeaders.ptr[index])) {
+
+        // Its later filters are ignored until it's dropped
+        node->lastFilterHeight = node->lastDlHeight;
+
+        NodeManagerExecute(self, badFilterWorkMain, DictOneS("node", DataPtr(node)));
+        return;
+    }
+
+    node->lastFilterHeight = height;
+    self->lastSyncedHeight = height;
+
+    if(BlockFilterMatchAny(filter, hash, self->filterScripts)) {
+
+        node->filterMatchCount++;
+
+        NodeGetData(node, DatasOneCopy(DataAppend(uint32D(InventoryTypeWitnessBlock), hash)));
+    }
+
+    if(!node->filterMatchCount)
+        blockDownloaded(self, node, height, 1);
 }
 
 static void updateTransactionFees(Dict unused)
@@ -785,17 +1324,8 @@ static void txWorkerMain(Dict dict)
 
     node->transactionsSinceLastMerkleBlock = node->transactionsSinceLastMerkleBlock + 1;
 
-    if(node->lastDlHeight == height) {
-
-        if(node->transactionsSinceLastMerkleBlock == matchingTxIdsIfValidRoot(&node->lastMerkleBlock).count) {
-
-            if(node->lastDlHeight == TTBloomFilterDlHeight(&tracker) + node->lastDlSize)
-                TTSetBloomFilterDlHeight(&tracker, node->lastDlHeight);
-
-            if(!TTFailureRateTooHigh(&tracker))
-                requestTransactions(self);
-        }
-    }
+    if(height >= 0 && node->transactionsSinceLastMerkleBlock == matchingTxIdsIfValidRoot(&node->lastMerkleBlock).count)
+        blockDownloaded(self, node, height, !TTFailureRateTooHigh(&tracker));
 
     pthread_mutex_unlock(&self->nodesMutex);
 }
@@ -879,19 +1409,131 @@ static void txWorker(Dict dict)
 
     DictAddS(&dict, "height", DataLong(height));
 
-    if(node->lastDlHeight == height) {
+    WorkQueueAdd(&self->workQueue, txWorkerMain, dict);
+
+    MerkleBlockFree(&block);
+
+    pthread_mutex_unlock(&self->nodesMutex);
+}
+
+static void blockWorkerMain(Dict dict)
+{
+    NodeManager *self = DataGetPtr(DictGetS(dict, "self"));
+    Node *node = DataGetPtr(DictGetS(dict, "node"));
+
+    pthread_mutex_lock(&self->nodesMutex);
+
+    if(nodeStillValid(self, node) && node->filterMatchCount > 0 && !--node->filterMatchCount)
+        blockDownloaded(self, node, node->lastFilterHeight, 1);
 
-        WorkQueueAdd(&self->workQueue, txWorkerMain, dict);
+    pthread_mutex_unlock(&self->nodesMutex);
+}
+
+// Root of the merkle tree over 'txids', the last hash pairing with itself on odd levels
+static Data merkleRootOfTxids(Datas txids)
+{
+    while(txids.count > 1) {
+
+        Datas level = DatasNew();
+
+        for(int i = 0; i < txids.count; i += 2)
+            level = DatasAddRef(level, hash256(DataAddCopy(txids.ptr[i], txids.ptr[MIN(i + 1, txids.count - 1)])));
+
+        txids = level;
     }
-    else if(height % 100 == 0) {
 
-        if(height > TTBloomFilterDlHeight(&tracker))
-            TTSetBloomFilterDlHeight(&tracker, height);
+    return DatasFirst(txids);
+}
+
+// Full block for a matching compact filter. Its wallet transactions go in like any others, 'blockData'
+// being the header alone.
+static void blockWorker(Dict dict)
+{
+    NodeManager *self = DataGetPtr(DictGetS(dict, "self"));
+    Data block = DictGetS(dict, "block");
+
+    const uint8_t *ptr = (uint8_t*)block.bytes + 80;
+    const uint8_t *end = (uint8_t*)block.bytes + block.length;
+
+    Data header = DataCopyDataPart(block, 0, 80);
+
+    uint64_t count = readVarInt(&ptr, end);
+
+    Datas txDatas = DatasNew();
+    Datas txids = DatasNew();
+
+    // Every transaction is at least 60 bytes, more can't fit and would be a bad block
+    if(count > (uint64_t)(end - ptr) / 60)
+        count = 0;
+
+    for(uint64_t i = 0; i < count && ptr < end; i++) {
+
+        const uint8_t *start = ptr;
+
+        Transaction trans = TransactionNewP(&ptr, end);
+
+        txDatas = DatasAddRef(txDatas, DataRef((void*)start, (unsigned int)(ptr - start)));
+        txids = DatasAddRef(txids, TransactionTxid(trans));
     }
 
-    MerkleBlockFree(&block);
+    if(!count || txids.count != count || ptr != end || !DataEqual(merkleRootOfTxids(txids), DataCopyDataPart(header, 36, 32))) {
 
-    pthread_mutex_unlock(&self->nodesMutex);
+        printf("Dropping block %s, it doesn't match its header\n", toHex(DataFlipEndianCopy(hash256(header))).bytes);
+
+        WorkQueueAdd(&self->workQueue, blockWorkerMain, dict);
+        return;
+    }
+
+    for(int i = 0; i < txDatas.count; i++) {
+
+        Transaction trans = TransactionNew(txDatas.ptr[i]);
+
+        if(!TTInterestingTransaction(&tracker, &trans) && !DatasHasMatchingData(TTMissingFundingTransactions(&tracker), txids.ptr[i]))
+            continue;
+
+        Data txData = DataCopyData(txDatas.ptr[i]);
+
+        int result = TTAddTransaction(&tracker, txData);
+
+        if(result == -1) {
+
+            Transaction *existingTrans = TTTransactionForTxid(&tracker, txids.ptr[i]);
+
+            txData = existingTrans ? DataCopyData(TransactionData(*existingTrans)) : DataNull();
+        }
+
+        if(result == 1 || result == -1) {
+
+            Dict txDict = DictNew();
+
+            DictAddS(&txDict, "txData", txData);
+            DictAddS(&txDict, "blockData", header);
+
+            DatabaseExecute(&database, txWorkerAddTransaction, txDict);
+        }
+    }
+
+    WorkQueueAdd(&self->workQueue, blockWorkerMain, dict);
+}
+
+static void block(struct Node *node, Data blockUnsafe)
+{
+    NodeManager *self = node->delegate.extraPtr;
+
+    // Could be a checkpoint asked for by 'requestHeadersWorkerMain', the database takes its bits
+    if(blockUnsafe.length >= 80)
+        DatabaseAddBlocks(&database, DatasOneCopy(DataCopyDataPart(blockUnsafe, 0, 80)));
+
+    if(!node->filterMatchCount || !BlockDownloadWindowOf(&self->blockDownload, node))
+        return;
+
+    Dict dict = DictNew();
+
+    DictAddS(&dict, "self", DataPtr(self));
+    DictAddS(&dict, "node", DataPtr(node));
+    DictAddS(&dict, "block", DataCopyData(blockUnsafe));
+
+    WorkQueueAdd(WorkQueueThreadNamed(TxProcessing), blockWorker, dict);
 }
 
 static void tx(struct Node *node, Data txUnsafe)
@@ -916,7 +1558,8 @@ static void tx(struct Node *node, Data txUnsafe)
         }
     }
 
-    if(node != self->activeNode)
+    // Besides the active node, only nodes downloading blocks for us send transactions we follow
+    if(node != self->activeNode && !BlockDownloadWindowOf(&self->blockDownload, node))
         return;
 
     printf("process tx[%s]\n", toHex(DataFlipEndianCopy(hash256(txUnsafe))).bytes);
@@ -1160,6 +1803,75 @@ static int message(struct Node *node, String message, char rejectCode, String re
 static void bloomFilterCheckup(Dict dict);
 static void nodeCheckup(Dict dict);
 
+// New nodes are queued (never dialed, so 'connectAttemptCount' is 0) and dialed here while fewer than
+// 'maxConnectsInFlight' lookups and connects are pending. Call with 'nodesMutex' held.
+static void startQueuedConnects(NodeManager *self)
+{
+    int inFlight = 0;
+
+    FORIN(Node, node, self->nodes)
+        if(NodeIsConnecting(node))
+            inFlight++;
+
+    FORIN(Node, node, self->nodes) {
+
+        if(inFlight >= self->maxConnectsInFlight)
+            break;
+
+        if(node->connectAttemptCount)
+            continue;
+
+        NodeConnect(node);
+        NodeSendVersion(node, 0);
+
+        if(self->bloomFilter.bytes)
+            NodeFilterLoad(node, self->bloomFilter);
+
+        if(NodeIsConnecting(node))
+            inFlight++;
+    }
+}
+
+// Call with 'nodesMutex' held
+static Node *addNode(NodeManager *self, String address, uint16_t port)
+{
+    Node node = NodeNew(address);
+
+    node.services = SERVICE_NODE_WITNESS;
+
+    node.testnet = self->testnet;
+
+    if(port)
+        node.port = port;
+
+    node.delegate.merkleBlock = merkleBlock;
+    node.delegate.blockHeaders = blockHeaders;
+    node.delegate.inventory = inventory;
+    node.delegate.tx = tx;
+    node.delegate.block = block;
+    node.delegate.compactFilter = compactFilter;
+    node.delegate.compactFilterHeaders = compactFilterHeaders;
+    node.delegate.message = message;
+    node.delegate.newAddress = newAddress;
+
+    node.delegate.extraPtr = self;
+
+    self->nodes = DatasUntrack(DatasAddCopy(self->nodes, DataRaw(node)));
+
+    return (Node*)DatasLast(self->nodes).bytes;
+}
+
+Node *NodeManagerAddNode(NodeManager *self, String address, uint16_t port)
+{
+    pthread_mutex_lock(&self->nodesMutex);
+
+    Node *node = addNode(self, address, port);
+
+    pthread_mutex_unlock(&self->nodesMutex);
+
+    return node;
+}
+
 void NodeManagerConnectNodes(NodeManager *self)
 {
     if(!self->bloomFilter.bytes) {
@@ -1197,37 +1909,11 @@ void NodeManagerConnectNodes(NodeManager *self)
         if(hasNode)
             continue;
 
-        Node node = NodeNew(DictGetS(dict, nodeListIpKey));
-
-        node.services = SERVICE_NODE_WITNESS;
-
-        node.testnet = self->testnet;
-
-        if(DataGetInt(DictGetS(dict, nodeListPortKey)))
-            node.port = DataGetInt(DictGetS(dict, nodeListPortKey));
-
-        node.delegate.merkleBlock = merkleBlock;
-        node.delegate.blockHeaders = blockHeaders;
-        node.delegate.inventory = inventory;
-        node.delegate.tx = tx;
-        node.delegate.message = message;
-        node.delegate.newAddress = newAddress;
-
-        node.delegate.extraPtr = self;
-
-        Data nodeData = DataCopyData(DataRaw(node));
-
-        self->nodes = DatasUntrack(DatasAddRef(self->nodes, nodeData));
-
-        Node *nodePtr = (Node*)nodeData.bytes;
-
-        NodeConnect(nodePtr);
-        NodeSendVersion(nodePtr, 0);
-
-        if(self->bloomFilter.bytes)
-            NodeFilterLoad(nodePtr, self->bloomFilter);
+        addNode(self, DictGetS(dict, nodeListIpKey), DataGetInt(DictGetS(dict, nodeListPortKey)));
     }
 
+    startQueuedConnects(self);
+
     pthread_mutex_unlock(&self->nodesMutex);
 
     WorkQueueRemoveByFunction(&self->workQueue, setActiveNodeIfNone);
@@ -1288,8 +1974,36 @@ static void nodeCheckup(Dict dict)
 
 //    printf("failure rate: %f (%d vs %d)\n", TransactionTracker.shared.failureRate, TransactionTracker.shared.mismatchCount, TransactionTracker.shared.matchCount);
 
-    if(self->bloomFilterNeedsUpdate)
-        TTSetBloomFilterDlHeight(&tracker, 0);
+    if(self->bloomFilterNeedsUpdate) {
+
+        Datas addedElements;
+        int32_t resumeHeight;
+
+        if(TTExtendBloomFilter(&tracker, &addedElements, &resumeHeight)) {
+
+            if(addedElements.count)
+                printf("Adding %d elements to the bloom filter\n", (int)addedElements.count);
+
+            FORIN(Node, node, self->nodes)
+                if(node->curBloomFilter.bytes)
+                    FORDATAIN(element, addedElements)
+                        NodeFilterAdd(node, *element);
+
+            DataTrack(self->bloomFilter);
+            self->bloomFilter = DataUntrack(TTBloomFilter(&tracker));
+
+            self->bloomFilterNeedsUpdate = 0;
+        }
+
+        // Blocks already downloaded without the new keys are fetched again from where they start to matter
+        if(resumeHeight < TTBloomFilterDlHeight(&tracker)) {
+
+            printf("Rescanning transactions from height %d\n", resumeHeight);
+
+            TTSetBloomFilterDlHeight(&tracker, resumeHeight);
+            BlockDownloadReset(&self->blockDownload, resumeHeight);
+        }
+    }
 
     if(self->bloomFilterNeedsUpdate || TTFailureRateTooHigh(&tracker)) {
 
@@ -1297,13 +2011,21 @@ static void nodeCheckup(Dict dict)
 
         printf("Update bloom filter\n");
 
-        NodeClose(self->activeNode);
-
         TTUpdateBloomFilter(&tracker);
 
         DataTrack(self->bloomFilter);
         self->bloomFilter = DataUntrack(TTBloomFilter(&tracker));
 
+        // Nodes already dialed swap to the rebuilt filter, the rest load it when they connect
+        FORIN(Node, node, self->nodes) {
+
+            if(node->curBloomFilter.bytes) {
+
+                NodeFilterClear(node);
+                NodeFilterLoad(node, self->bloomFilter);
+            }
+        }
+
         self->bloomFilterNeedsUpdate = 0;
     }
 
@@ -1326,6 +2048,17 @@ static void nodeCheckup(Dict dict)
         }
     }
 
+    // Nodes sitting on a download window are dropped below and the window goes to another
+    Node *stalled;
+
+    while((stalled = BlockDownloadStalledOwner(&self->blockDownload, time(0)))) {
+
+        printf("%s stalled downloading blocks, reassigning its window\n", NodeDescription(stalled).bytes);
+
+        BlockDownloadRelease(&self->blockDownload, stalled);
+        NodeClose(stalled);
+    }
+
     Datas masterList = masterNodeList(self);
 
     for(int i = 0; i < self->nodes.count; i++) {
@@ -1346,7 +2079,8 @@ static void nodeCheckup(Dict dict)
                 remove = 1;
         }
 
-        if(!node->connected) {
+        // Nodes still queued for a connection slot get until the next checkup
+        if(!node->connected && node->connectAttemptCount) {
 
             remove = 1;
         }
@@ -1388,6 +2122,8 @@ static void nodeCheckup(Dict dict)
             if(self->activeNode == node)
                 self->activeNode = NULL;
 
+            BlockDownloadRelease(&self->blockDownload, node);
+
             // TODO: Go through workQueue dicts and remove all items that reference "oldnode"
             NodeClose(node);
             NodeFree(node);
@@ -1435,6 +2171,10 @@ static void nodeCheckup(Dict dict)
     if(originalCount)
         NodeManagerConnectNodes(self);
 
+    // Brings newly connected nodes and released windows into the download
+    if(self->blockDownload.completedHeight < self->blockDownload.targetHeight)
+        requestTransactions(self);
+
     if(NodeManagerConnections(self) != ACTIVE_NODE_COUNT || self->activeConnectionsSinceCheckup != NodeManagerConnections(self))
         printf("Node checkup finished with %d active connections\n", NodeManagerConnections(self));
 
@@ -1466,6 +2206,8 @@ void NodeManagerDisconnectAll(NodeManager *self)
     // TODO: Go through workQueue dicts and remove all items that reference "oldnode"
     self->nodes = DatasRemoveAll(self->nodes);
 
+    BlockDownloadReset(&self->blockDownload, self->blockDownload.completedHeight);
+
     WorkQueueRemoveByFunction(&self->workQueue, setActiveNodeIfNone);
     WorkQueueRemoveByFunction(&self->workQueue, nodeCheckup);
     WorkQueueRemoveByFunction(&self->workQueue, bloomFilterCheckup);
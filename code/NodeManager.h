@@ -2,11 +2,20 @@
 #define NODEMANAGER_H
 
 #include "Node.h"
+#include "BlockDownload.h"
 #include "Transaction.h"
 #include "WorkQueue.h"
 
 #define NODE_CHECKUP_INTERVAL 15
 
+// Default for 'maxConnectsInFlight'
+#define NODE_CONNECTS_IN_FLIGHT 4
+
+// A full headers message means more follow. The next getheaders goes out before the batch reaches the
+// database while fewer than this many batches wait there.
+#define HEADERS_PIPELINE_DEPTH 4
+#define HEADERS_BATCH_COUNT 2000
+
 extern const char *NodeManagerBlockchainSyncChange;
 
 typedef enum {
@@ -27,6 +36,14 @@ typedef struct NodeManager {
     uint32_t lowestSyncedHeight;
     uint32_t lastSyncedHeight;
 
+    int maxConnectsInFlight; // Peer dials (address lookup + connect) allowed at once, the rest wait their turn
+
+    // Nodes serving BIP157 filters send those instead of filtered blocks. Only blocks whose filter matches a
+    // wallet script are downloaded, in full. Set before 'NodeManagerConnectNodes'.
+    // Each filter must match the filter headers of another peer serving them and the sender is dropped if it
+    // doesn't. With a single such peer it only vouches for itself, so two honest ones are needed.
+    int compactFilters;
+
     // Private
 
     uint64_t walletCreationDate;
@@ -38,15 +55,26 @@ typedef struct NodeManager {
     Node *activeNode;
     pthread_mutex_t nodesMutex;
 
+    BlockDownload blockDownload; // Filtered blocks come from every connected node, a window of heights each
+
+    Datas filterScripts; // Wallet scripts matched against compact filters, rebuilt for each download
+
     int activeConnectionsSinceCheckup;
     int rejectCount;
 
+    int headerBatchesQueued; // Full header batches from the active node not yet through the database
+
     int automaticallyPublishWaitingTransactions;
 
     Datas sendTxOnResults;
 
     WorkQueue workQueue;
 
+    // Event loop state, created by the first 'NodeManagerRunLoop'
+    int eventFd;
+    int wakePipe[2];
+    Datas watchedFds;
+
 } NodeManager;
 
 extern NodeManager nodeManager;
@@ -56,6 +84,16 @@ NodeManager NodeManagerNew(uint64_t walletCreationDate);
 // Call this repeatedly
 void NodeManagerProcessNodes(NodeManager *manager);
 
+// Event driven alternative to 'NodeManagerProcessNodes'. Blocks (up to 'maxWaitMilliseconds', -1 for no
+// limit) until a peer socket, watched fd, the work queue or a queued notification has something to do, then
+// handles it. Notifications are left for 'NotificationsProcess'. Uses epoll on Linux and poll() elsewhere.
+// Call this repeatedly.
+void NodeManagerRunLoop(NodeManager *manager, int maxWaitMilliseconds);
+
+// 'callback' runs from 'NodeManagerRunLoop' when 'fd' is readable (ie. a Webserver's 'serverSocket').
+void NodeManagerWatchFd(NodeManager *manager, int fd, void (*callback)(int fd, void *ptr), void *ptr);
+void NodeManagerUnwatchFd(NodeManager *manager, int fd);
+
 int NodeManagerConnections(NodeManager *manager);
 
 typedef void (*SendTxResult)(NodeManagerErrorType result, void *ptr);
@@ -65,12 +103,19 @@ Datas *NodeManagerAllNodes(NodeManager *manager);
 int NodeManagerIsActiveNode(NodeManager *manager, Node *node);
 void NodeManagerSendTx(NodeManager *manager, Transaction tx, SendTxResult onResult, void *ptr);
 void NodeManagerConnectNodes(NodeManager *manager);
+// A peer at 'address' ('port' 0 for the default) with the manager's delegates. Connects with the others on
+// the next 'NodeManagerProcessNodes' or 'NodeManagerRunLoop'.
+Node *NodeManagerAddNode(NodeManager *manager, String address, uint16_t port);
 void NodeManagerDisconnectAll(NodeManager *manager);
 void NodeManagerDidBecomeActive(NodeManager *manager);
 void NodeManagerUpdateTransactionFees(NodeManager *manager);
 
 void NodeManagerAppDidBecomeActive(NodeManager *manager);
 
+// Heights 'firstHeight' through 'lastHeight' were replaced by a reorg. Their transactions are unconfirmed
+// and their blocks downloaded again. Called for 'nodeManager' on DatabaseReorgNotification.
+void NodeManagerBlocksDisconnected(NodeManager *manager, int32_t firstHeight, int32_t lastHeight);
+
 // The Database work queue must be empty before you can free a NodeManager
 // This work queue must also be empty: WorkQueueThreadNamed("Bloom Filter Checkup")
 void NodeManagerFree(NodeManager *manager); // Waits on the completion and destruction of the "TxProcessing" worker queue thread
@@ -24,7 +24,7 @@ static void init()
     if(pthread_mutexattr_destroy(&recursiveAttr) != 0)
         abort();
     
-    note.funcs = DictUntrack(DictNew());
+    note.funcs = DictUntrack(DictNewHashed());
     note.workQueue = WorkQueueNew();
 }
 
@@ -62,6 +62,13 @@ void NotificationsAddListener(const char *name, WorkQueueFunc func)
     pthread_mutex_unlock(&note.mutex);
 }
 
+void NotificationsSetWakeFd(int fd)
+{
+    pthread_once(&note.once, init);
+
+    WorkQueueSetWakeFd(&note.workQueue, fd);
+}
+
 void NotificationsProcess()
 {
     NotificationsProcessReturningEventNames();
@@ -7,6 +7,9 @@ void NotificationsFire(const char *name, Dict dict);
 
 void NotificationsAddListener(const char *name, WorkQueueFunc func);
 
+// A byte is written to 'fd' whenever a listener is queued, so an event loop knows to call 'NotificationsProcess'. -1 for none.
+void NotificationsSetWakeFd(int fd);
+
 void NotificationsProcess();
 Datas NotificationsProcessReturningEventNames();
 
@@ -6,7 +6,8 @@ const char *initialSqlStructure =
     "`hash` char(32) not null,"
     "`hashPrefix` integer not null,"
     "`merkleRoot` char(32) not null,"
-    "`time` unsigned integer not null"
+    "`time` unsigned integer not null,"
+    "`bits` unsigned integer not null default 0"
 ");"
 ""
 "create index `blocksHashPrefix` on `blocks` (`hashPrefix`);"
@@ -86,11 +86,23 @@ void TransactionUntrack(Transaction *self)
 
 Transaction TransactionNew(Data data)
 {
-    Transaction inst = TransactionEmpty();
-
     const uint8_t *ptr = (void*)data.bytes;
     const uint8_t *end = ptr + data.length;
 
+    Transaction inst = TransactionNewP(&ptr, end);
+
+    if(ptr != end)
+        abort();
+
+    return inst;
+}
+
+Transaction TransactionNewP(const uint8_t **ptrPtr, const uint8_t *end)
+{
+    Transaction inst = TransactionEmpty();
+
+    const uint8_t *ptr = *ptrPtr;
+
     inst.version = uint32readP(&ptr, end);
 
     int hasWitness = (end - ptr > 1 && !ptr[0] && ptr[1]);
@@ -188,8 +200,7 @@ Transaction TransactionNew(Data data)
 
     inst.locktime = uint32readP(&ptr, end);
 
-    if(ptr != end)
-        abort();
+    *ptrPtr = ptr;
 
     return inst;
 }
@@ -206,6 +217,7 @@ Transaction TransactionCopy(Transaction transaction)
         inputNew->fundingOutput = inputOld->fundingOutput;
 
         inputNew->fundingOutput.script = DataCopyData(inputNew->fundingOutput.script);
+        inputNew->fundingOutput.scriptTokensPushDataSet = DictNew();
         inputNew->scriptTokensPushDataSet = DictNew();
     }
 
@@ -1481,30 +1493,32 @@ Data TransactionWitnessDigestFlexible(Transaction transaction, int index, uint64
 
     TransactionInput *activeInput = (TransactionInput*)transaction.inputs.ptr[index].bytes;
 
+    DataTrackPushArena(0);
+
     Data data = DataNew(0);
 
-    Data prevOuts = DataNew(0);
-    Data sequences = DataNew(0);
+    Data prevOuts = DataReserve(DataNew(0), 36 * transaction.inputs.count);
+    Data sequences = DataReserve(DataNew(0), 4 * transaction.inputs.count);
     Data outputs = DataNew(0);
 
     for(int i = 0; i < transaction.inputs.count; i++) {
 
         TransactionInput *input = (TransactionInput*)transaction.inputs.ptr[i].bytes;
 
-        prevOuts = DataAddCopy(prevOuts, input->previousTransactionHash);
-        prevOuts = DataAddCopy(prevOuts, uint32D(input->outputIndex));
+        prevOuts = DataAppend(prevOuts, input->previousTransactionHash);
+        prevOuts = DataAppend(prevOuts, uint32D(input->outputIndex));
     }
 
     for(int i = 0; i < transaction.inputs.count; i++) {
 
         TransactionInput *input = (TransactionInput*)transaction.inputs.ptr[i].bytes;
-        sequences = DataAddCopy(sequences, uint32D(input->sequence));
+        sequences = DataAppend(sequences, uint32D(input->sequence));
     }
 
     for(int i = 0; i < transaction.outputs.count; i++) {
 
         TransactionOutput *output = (TransactionOutput*)transaction.outputs.ptr[i].bytes;
-        outputs = DataAddCopy(outputs, TransactionOutputData(output));
+        outputs = DataAppend(outputs, TransactionOutputData(output));
     }
 
     data = DataAddCopy(data, uint32D(transaction.version));
@@ -1516,7 +1530,7 @@ Data TransactionWitnessDigestFlexible(Transaction transaction, int index, uint64
     data = DataAddCopy(data, uint32D(activeInput->outputIndex));
 
     if(!activeInput->scriptData.length)
-        return DataNull();
+        return DTPopNull();
 
     data = DataAddCopy(data, varIntD(activeInput->scriptData.length));
     data = DataAddCopy(data, activeInput->scriptData);
@@ -1529,7 +1543,7 @@ Data TransactionWitnessDigestFlexible(Transaction transaction, int index, uint64
 
     data = DataAddCopy(data, uint32D(0x00000001));
 
-    return data;
+    return DTPop(data);
 }
 
 Data TransactionTx(Transaction transaction)
@@ -19,6 +19,7 @@ typedef struct Transaction {
 
 Transaction TransactionEmpty();
 Transaction TransactionNew(Data data);
+Transaction TransactionNewP(const uint8_t **ptr, const uint8_t *end); // Advances 'ptr' past the transaction
 
 String TransactionDescription(Transaction tx);
 
@@ -137,7 +137,8 @@ static Datas allEvents(TA *self)
 
             int index = input->outputIndex;
 
-            if(index < otherTrans->outputs.count && scriptDataMatches(self, TransactionOutputAt(otherTrans, index)->script))
+            // Funding from outside the wallet isn't among 'transactions'
+            if(otherTrans && index < otherTrans->outputs.count && scriptDataMatches(self, TransactionOutputAt(otherTrans, index)->script))
                 selfFundedInputs++;
             else if(DictionaryDoesIntersect(self->keysAndHashes, TransactionInputGetScriptTokensPushDataSet(input)))
                 selfFundedInputs++;
@@ -220,9 +221,11 @@ Datas/*TAEvent*/ TAEvents(TA *self, TAEventType typeMask)
 
     Datas events = allEvents(self);
 
-    FORIN(TAEvent, event, events)
-        if(event->type & typeMask)
-            result = DatasAddCopy(result, DataRaw(*event));
+    // Grouped by transaction
+    FORIN(Datas, transactionEvents, events)
+        FORIN(TAEvent, event, *transactionEvents)
+            if(event->type & typeMask)
+                result = DatasAddCopy(result, DataRaw(*event));
 
     return result;
 }
@@ -13,7 +13,10 @@
 #include "Transaction.h"
 #include "BasicStorage.h"
 #include <pthread.h>
+#include <string.h>
 #include "Notifications.h"
+#include "WorkQueue.h"
+#include <unistd.h>
 
 const char *TransactionTrackerTransactionAdded = "TransactionTrackerTransactionAdded";
 
@@ -23,16 +26,285 @@ const char *TransactionTrackerTransactionAdded = "TransactionTrackerTransactionA
 #define BLOOM_MAX_FAILRATE 0.95
 #define BLOOM_MIN_COUNT 3000
 
+// Lookahead keys go into the loaded bloom filter with 'filteradd' until its false positive rate would
+// pass this, then the filter is rebuilt at its proper size
+#define BLOOM_INCREMENTAL_MAX_FAILRATE 0.000001
+
+// Bloom filter rebuilds derive lookahead keys this many indices to a job, spread across threads
+#define DERIVATION_JOB_SIZE 25
+#define DERIVATION_THREADS_MAX 8
+
+#ifndef MIN
+#define MIN(a,b) (((a)<(b))?(a):(b))
+#endif
+
+#ifndef MAX
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#endif
+
 int TransactionTrackerBloomaheadCount = HDWALLET_BLOOMAHEAD_COUNT_DEFAULT;
+int TransactionTrackerDerivationThreads = 0;
 
 TransactionTracker tracker = {0};
 
 static Dict TTKeysAndKeyHashesForWallet(TransactionTracker *self, Data hdwallet);
 static int TTAnyTransactionContainsOneOf(TransactionTracker *self, Dict keysAndHashes);
+static Dict loadedKeyTags(TransactionTracker *self);
+static void TTRestoreKeyTags(TransactionTracker *self);
+static int TTKeyTagsMissing(TransactionTracker *self);
 
 static pthread_mutex_t allTransactionsMutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t scriptAndHashCacheMutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t masterHdWalletCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t derivationCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static Data outpoint(Data txid, uint32_t outputIndex)
+{
+    return DataAddCopy(txid, uint32D(outputIndex));
+}
+
+static void indexSet(Dict *index, Data key, Transaction *transaction)
+{
+    *index = DictionaryRemove(*index, key);
+    *index = DictionaryAddRefUntracked(*index, DataUntrackCopy(key), DataUntrackCopy(DataPtr(transaction)));
+}
+
+static Transaction *indexGet(Dict index, Data key)
+{
+    return DataGetPtr(DictGet(index, key));
+}
+
+// Call with 'allTransactionsMutex' held
+static void indexAdd(TransactionTracker *self, Transaction *transaction, Data hash, Data txid)
+{
+    indexSet(&self->hashIndex, hash, transaction);
+    indexSet(&self->txidIndex, txid, transaction);
+
+    FORIN(TransactionInput, input, transaction->inputs)
+        indexSet(&self->spendingIndex, outpoint(input->previousTransactionHash, input->outputIndex), transaction);
+}
+
+// Call with 'allTransactionsMutex' held. Entries since taken by another transaction are left alone.
+// A txid or outpoint shared with another transaction (a malleated copy or a double spend) goes to it.
+static void indexRemove(TransactionTracker *self, Transaction *transaction, Data hash, Data txid)
+{
+    if(indexGet(self->hashIndex, hash) == transaction)
+        self->hashIndex = DictionaryRemove(self->hashIndex, hash);
+
+    if(indexGet(self->txidIndex, txid) == transaction) {
+
+        self->txidIndex = DictionaryRemove(self->txidIndex, txid);
+
+        for(int i = 0; i < self->allTransactionTxids.count; i++)
+            if(DataEqual(self->allTransactionTxids.ptr[i], txid) && (Transaction*)self->allTransactions.ptr[i].bytes != transaction)
+                indexSet(&self->txidIndex, txid, (Transaction*)self->allTransactions.ptr[i].bytes);
+    }
+
+    FORIN(TransactionInput, input, transaction->inputs) {
+
+        Data key = outpoint(input->previousTransactionHash, input->outputIndex);
+
+        if(indexGet(self->spendingIndex, key) != transaction)
+            continue;
+
+        self->spendingIndex = DictionaryRemove(self->spendingIndex, key);
+
+        FORIN(Transaction, other, self->allTransactions)
+            if(other != transaction)
+                FORIN(TransactionInput, otherInput, other->inputs)
+                    if(otherInput->outputIndex == input->outputIndex && DataEqual(otherInput->previousTransactionHash, input->previousTransactionHash))
+                        indexSet(&self->spendingIndex, key, other);
+    }
+}
+
+// Inputs own their funding output, sharing the script with the funding transaction would free it twice
+static void setFundingOutput(TransactionInput *input, TransactionOutput *output)
+{
+    input->fundingOutput = (TransactionOutput){ 0 };
+    input->fundingOutput.value = output->value;
+    input->fundingOutput.script = DataCopyData(output->script);
+}
+
+// Call with 'derivationCacheMutex' held
+static void cacheSet(Dict *cache, Data key, Data value)
+{
+    *cache = DictionaryRemove(*cache, key);
+    *cache = DictionaryAddRefUntracked(*cache, DataUntrackCopy(key), DataUntrackCopy(value));
+}
+
+// hdWallet() through 'derivationCache'. Every node along 'path' is kept, so walking the indices under
+// one parent costs a single child key derivation each.
+static Data TTDerive(TransactionTracker *self, Data hdWalletParam, const char *path)
+{
+    DataTrackPush();
+
+    Data result = DataCopyData(hdWalletParam);
+
+    Datas indicies = ckdIndicesFromPath(path);
+
+    for(int i = 0; i < indicies.count; i++) {
+
+        uint32_t index = *(uint32_t*)indicies.ptr[i].bytes;
+
+        Data key = DataAddCopy(result, uint32D(index));
+
+        pthread_mutex_lock(&derivationCacheMutex);
+
+        Data child = DataCopyData(DictGet(self->derivationCache, key));
+
+        pthread_mutex_unlock(&derivationCacheMutex);
+
+        if(!child.bytes) {
+
+            child = childKeyDerivation(result, index);
+
+            pthread_mutex_lock(&derivationCacheMutex);
+
+            cacheSet(&self->derivationCache, key, child);
+
+            pthread_mutex_unlock(&derivationCacheMutex);
+        }
+
+        result = child;
+    }
+
+    return DTPop(result);
+}
+
+// Fills 'derivationCache' with the children 'first' up to 'end' of 'hdWalletParam' using one ckdBatch,
+// so the TTDerive calls that follow are all cache hits.
+static void TTDeriveRange(TransactionTracker *self, Data hdWalletParam, int first, int end)
+{
+    if(first >= end || hdWalletParam.length != 82)
+        return;
+
+    DataTrackPush();
+
+    pthread_mutex_lock(&derivationCacheMutex);
+
+    int cached = 1;
+
+    for(int i = first; i < end && cached; i++)
+        cached = DictGet(self->derivationCache, DataAddCopy(hdWalletParam, uint32D(i))).bytes != NULL;
+
+    pthread_mutex_unlock(&derivationCacheMutex);
+
+    if(!cached) {
+
+        Datas children = ckdBatch(hdWalletParam, first, end - first);
+
+        pthread_mutex_lock(&derivationCacheMutex);
+
+        for(int i = 0; i < children.count; i++)
+            cacheSet(&self->derivationCache, DataAddCopy(hdWalletParam, uint32D(first + i)), children.ptr[i]);
+
+        pthread_mutex_unlock(&derivationCacheMutex);
+    }
+
+    DataTrackPop();
+}
+
+// Tags are DatasSerialize'd hd wallet chain, vault index and derivation, as in TTUnspentOutput
+static Data keyTag(Data hdWalletParam, int32_t vaultIndex, String derivation)
+{
+    return DatasSerialize(DatasThreeCopy(hdWalletParam, DataInt(vaultIndex), derivation));
+}
+
+static void addTaggedKeys(Dict *keys, Dict *tags, Dict items, Data tag)
+{
+    DictAddDict(keys, items);
+
+    FORINDICT(item, items)
+        DictAdd(tags, item->key, tag);
+}
+
+// Call with 'allTransactionsMutex' held
+static Data outputTag(TransactionTracker *self, TransactionOutput *output)
+{
+    Dict tags = loadedKeyTags(self);
+
+    FORINDICT(item, TransactionOutputGetScriptTokensPushDataSet(output)) {
+
+        Data tag = DictGet(tags, item->key);
+
+        if(tag.bytes)
+            return tag;
+    }
+
+    return DataNull();
+}
+
+// Call with 'allTransactionsMutex' held. Outputs not paying a wallet key are skipped.
+static void unspentAdd(TransactionTracker *self, Data txid, uint32_t outputIndex, TransactionOutput *output)
+{
+    Data tag = outputTag(self, output);
+
+    if(!tag.bytes)
+        return;
+
+    Data key = outpoint(txid, outputIndex);
+    Data value = DatasSerialize(DatasThreeCopy(DataLong((int64_t)output->value), output->script, tag));
+
+    self->unspentOutputs = DictionaryRemove(self->unspentOutputs, key);
+    self->unspentOutputs = DictionaryAddRefUntracked(self->unspentOutputs, DataUntrackCopy(key), DataUntrack(value));
+}
+
+// Call with 'allTransactionsMutex' held
+static void unspentRebuild(TransactionTracker *self)
+{
+    DictTrack(self->unspentOutputs);
+    self->unspentOutputs = DictUntrack(DictNewHashed());
+
+    for(int i = 0; i < self->allTransactions.count; i++) {
+
+        Transaction *transaction = (Transaction*)self->allTransactions.ptr[i].bytes;
+        Data txid = self->allTransactionTxids.ptr[i];
+
+        for(uint32_t j = 0; j < transaction->outputs.count; j++)
+            if(!DictHasKey(self->spendingIndex, outpoint(txid, j)))
+                unspentAdd(self, txid, j, (TransactionOutput*)transaction->outputs.ptr[j].bytes);
+    }
+
+    self->unspentOutputsValid = 1;
+}
+
+// Call with 'allTransactionsMutex' held, after 'indexAdd'
+static void unspentTransactionAdded(TransactionTracker *self, Transaction *transaction, Data txid)
+{
+    if(!self->unspentOutputsValid)
+        return;
+
+    FORIN(TransactionInput, input, transaction->inputs)
+        self->unspentOutputs = DictionaryRemove(self->unspentOutputs, outpoint(input->previousTransactionHash, input->outputIndex));
+
+    for(uint32_t i = 0; i < transaction->outputs.count; i++)
+        if(!DictHasKey(self->spendingIndex, outpoint(txid, i)))
+            unspentAdd(self, txid, i, (TransactionOutput*)transaction->outputs.ptr[i].bytes);
+}
+
+// Call with 'allTransactionsMutex' held, after 'indexRemove'. The outputs it spent come back unless
+// another transaction spends them too.
+static void unspentTransactionRemoved(TransactionTracker *self, Transaction *transaction, Data txid)
+{
+    if(!self->unspentOutputsValid)
+        return;
+
+    // A copy with the same txid still pays them
+    if(!DictHasKey(self->txidIndex, txid))
+        for(uint32_t i = 0; i < transaction->outputs.count; i++)
+            self->unspentOutputs = DictionaryRemove(self->unspentOutputs, outpoint(txid, i));
+
+    FORIN(TransactionInput, input, transaction->inputs) {
+
+        if(DictHasKey(self->spendingIndex, outpoint(input->previousTransactionHash, input->outputIndex)))
+            continue;
+
+        TransactionOutput *output = TransactionOutputOrNilAt(indexGet(self->txidIndex, input->previousTransactionHash), input->outputIndex);
+
+        if(output)
+            unspentAdd(self, input->previousTransactionHash, input->outputIndex, output);
+    }
+}
 
 TransactionTracker TTNew(int testnet)
 {
@@ -49,6 +321,16 @@ TransactionTracker TTNew(int testnet)
     self->allTransactionHashes = DatasUntrack(DatasNew());
     self->allTransactionTxids = DatasUntrack(DatasNew());
 
+    self->hashIndex = DictUntrack(DictNewHashed());
+    self->txidIndex = DictUntrack(DictNewHashed());
+    self->spendingIndex = DictUntrack(DictNewHashed());
+
+    self->keyTags = DictUntrack(DictNewHashed());
+    self->unspentOutputs = DictUntrack(DictNewHashed());
+
+    self->derivationCache = DictUntrack(DictNewHashed());
+    self->walletKeysCache = DictUntrack(DictNewHashed());
+
     self->scriptAndHashCache = DictUntrack(DictNew());
     self->masterHdWalletCache = DictUntrack(DictNew());
 
@@ -65,7 +347,10 @@ TransactionTracker TTNew(int testnet)
     DatasUntrack(self->allTransactionHashes);
     DatasUntrack(self->allTransactionTxids);
 
-    self->keysAndKeyHashes = DictUntrack(DictNew());
+    for(int i = 0; i < self->allTransactions.count; i++)
+        indexAdd(self, (Transaction*)self->allTransactions.ptr[i].bytes, self->allTransactionHashes.ptr[i], self->allTransactionTxids.ptr[i]);
+
+    self->keysAndKeyHashes = DictUntrack(DictNewHashed());
 
     FORIN(Transaction, transaction, self->allTransactions) {
         FORIN(TransactionInput, input, transaction->inputs) {
@@ -75,13 +360,15 @@ TransactionTracker TTNew(int testnet)
             TransactionOutput *output = TransactionOutputOrNilAt(tx, input->outputIndex);
 
             if(output)
-                input->fundingOutput = *output;
+                setFundingOutput(input, output);
         }
     }
 
     FORIN(Transaction, transaction, self->allTransactions)
         TransactionUntrack(transaction);
 
+    DataTrackPop();
+
     return *self;
 }
 
@@ -91,10 +378,18 @@ void TTTrack(TransactionTracker *self)
     DatasTrack(self->allTransactionHashes);
     DatasTrack(self->allTransactionTxids);
 
+    DictTrack(self->hashIndex);
+    DictTrack(self->txidIndex);
+    DictTrack(self->spendingIndex);
+
     DictTrack(self->keysAndKeyHashes);
+    DictTrack(self->keyTags);
+    DictTrack(self->unspentOutputs);
 
     DictTrack(self->scriptAndHashCache);
     DictTrack(self->masterHdWalletCache);
+    DictTrack(self->derivationCache);
+    DictTrack(self->walletKeysCache);
 
     FORIN(Transaction, transaction, self->allTransactions)
         TransactionTrack(transaction);
@@ -107,6 +402,7 @@ static const char *allHdWalletsKey = "allHdWalletsKey";
 static const char *vaultCountKey = "vaultCountKey";
 static const char *bloomFilterDlHeightKey = "bloomFilterDlHeightKey";
 static const char *keysAndKeyHashesKey = "keysAndKeyHashesKey";
+static const char *keyTagsKey = "keyTagsKey";
 
 static const char *testNetStr(TransactionTracker *self)
 {
@@ -190,12 +486,28 @@ void TTSetBloomFilterDlHeight(TransactionTracker *self, int32_t param)
     TTSave(self, bloomFilterDlHeightKey, DataInt(param));
 }
 
+void TTBlocksDisconnected(TransactionTracker *self, int32_t firstHeight, int32_t lastHeight)
+{
+    int count = DatabaseUnconfirmTransactions(&database, firstHeight, lastHeight);
+
+    if(TTBloomFilterDlHeight(self) >= firstHeight)
+        TTSetBloomFilterDlHeight(self, firstHeight - 1);
+
+    if(count)
+        printf("Reorg unconfirmed %d transaction(s) between heights %d and %d\n", count, firstHeight, lastHeight);
+}
+
 Dict TTKeysAndKeyHashes(TransactionTracker *self)
 {
     if(!DictCount(self->keysAndKeyHashes)) {
 
         DictTrack(self->keysAndKeyHashes);
-        self->keysAndKeyHashes = DictUntrack(DictDeserialize(TTLoad(self, keysAndKeyHashesKey)));
+
+        self->keysAndKeyHashes = DictNewHashed();
+
+        DictAddDict(&self->keysAndKeyHashes, DictDeserialize(TTLoad(self, keysAndKeyHashesKey)));
+
+        self->keysAndKeyHashes = DictUntrack(self->keysAndKeyHashes);
     }
     
     return self->keysAndKeyHashes;
@@ -209,6 +521,52 @@ void TTSetKeysAndKeyHashes(TransactionTracker *self, Dict param)
     TTSave(self, keysAndKeyHashesKey, DictSerialize(self->keysAndKeyHashes));
 }
 
+// Call with 'allTransactionsMutex' held. Storage is only read the first time, even if it held no tags.
+static Dict loadedKeyTags(TransactionTracker *self)
+{
+    if(!self->keyTagsLoaded) {
+
+        DictTrack(self->keyTags);
+
+        self->keyTags = DictNewHashed();
+
+        DictAddDict(&self->keyTags, DictDeserialize(TTLoad(self, keyTagsKey)));
+
+        self->keyTags = DictUntrack(self->keyTags);
+        self->keyTagsLoaded = 1;
+    }
+
+    return self->keyTags;
+}
+
+// A copy, as 'TTSetKeyTags' may replace them once the lock is released
+static Dict TTKeyTags(TransactionTracker *self)
+{
+    pthread_mutex_lock(&allTransactionsMutex);
+
+    Dict result = DictionaryCopy(loadedKeyTags(self));
+
+    pthread_mutex_unlock(&allTransactionsMutex);
+
+    return result;
+}
+
+// The UTXO set is rebuilt from these on its next use
+static void TTSetKeyTags(TransactionTracker *self, Dict param)
+{
+    pthread_mutex_lock(&allTransactionsMutex);
+
+    DictTrack(self->keyTags);
+    self->keyTags = DictUntrack(param);
+    self->keyTagsLoaded = 1;
+
+    self->unspentOutputsValid = 0;
+
+    pthread_mutex_unlock(&allTransactionsMutex);
+
+    TTSave(self, keyTagsKey, DictSerialize(param));
+}
+
 int TTLastUsedAddress(TransactionTracker *self, Data hdWalletParam)
 {
     int index = DatasMatchingDataIndex(TTAllHdWallets(self), hdWalletParam);
@@ -220,7 +578,7 @@ int TTLastUsedAddress(TransactionTracker *self, Data hdWalletParam)
 
     for(int i = 0; i < lastUsedAddress + HDWALLET_SCANAHEAD_COUNT; i++) {
 
-        Dict items = TTKeysAndKeyHashesForWallet(self, hdWallet(hdWalletParam, StringF("%d", i).bytes));
+        Dict items = TTKeysAndKeyHashesForWallet(self, TTDerive(self, hdWalletParam, StringF("%d", i).bytes));
 
         if(TTAnyTransactionContainsOneOf(self, items))
             lastUsedAddress = i;
@@ -260,7 +618,7 @@ int TTUnusedAddresses(TransactionTracker *self, Data hdWalletParam)
         if(i < 0)
             abort();
 
-        Dict items = TTKeysAndKeyHashesForWallet(self, hdWallet(hdWalletParam, StringF("%d", i).bytes));
+        Dict items = TTKeysAndKeyHashesForWallet(self, TTDerive(self, hdWalletParam, StringF("%d", i).bytes));
 
         if(TTAnyTransactionContainsOneOf(self, items))
             lastUsedAddress = i;
@@ -271,11 +629,33 @@ int TTUnusedAddresses(TransactionTracker *self, Data hdWalletParam)
 
 static Dict TTKeysAndKeyHashesForWallet(TransactionTracker *self, Data hdWalletParam)
 {
-    Data compressedPubKey = pubKeyFromHdWallet(hdWalletParam);
-    Data fullPubKey = pubKeyExpand(compressedPubKey);
+    pthread_mutex_lock(&derivationCacheMutex);
+
+    Datas keys = DatasDeserialize(DictGet(self->walletKeysCache, hdWalletParam));
+
+    pthread_mutex_unlock(&derivationCacheMutex);
+
+    if(keys.count != 4) {
+
+        Data compressedPubKey = pubKeyFromHdWallet(hdWalletParam);
+        Data fullPubKey = pubKeyExpand(compressedPubKey);
+
+        keys = DatasTwoCopy(compressedPubKey, fullPubKey);
+        keys = DatasAddCopy(keys, hash160(compressedPubKey));
+        keys = DatasAddCopy(keys, hash160(fullPubKey));
+
+        pthread_mutex_lock(&derivationCacheMutex);
+
+        cacheSet(&self->walletKeysCache, hdWalletParam, DatasSerialize(keys));
 
-    Data compressedHash = hash160(compressedPubKey);
-    Data fullHash = hash160(fullPubKey);
+        pthread_mutex_unlock(&derivationCacheMutex);
+    }
+
+    Data compressedPubKey = keys.ptr[0];
+    Data fullPubKey = keys.ptr[1];
+
+    Data compressedHash = keys.ptr[2];
+    Data fullHash = keys.ptr[3];
 
 //    NSLog(@"pubkey: %@, hash: %@", toHex:pubkey], toHex:hash160:pubkey]]);
 
@@ -292,45 +672,50 @@ static Dict TTKeysAndKeyHashesForWallet(TransactionTracker *self, Data hdWalletP
 Dict TTScriptAndHashFlexible(TransactionTracker *self, int vaultIndex, int derivation, int isChange, Data masterHdWallet, Datas hdWallets)
 {
     Data key = DatasSerialize(DatasThreeCopy(DataInt(vaultIndex), DataInt(derivation), DataInt(isChange)));
-    Dict result = { 0 };
 
+    // Kept serialized, the cache's Dict tracking doesn't reach into nested Dicts
     pthread_mutex_lock(&scriptAndHashCacheMutex);
 
-    result = DataGetDict(DictGet(self->scriptAndHashCache, key));
+    Data cached = DataCopyData(DictGet(self->scriptAndHashCache, key));
 
-    if(DictCount(result)) {
+    pthread_mutex_unlock(&scriptAndHashCacheMutex);
 
-        pthread_mutex_unlock(&scriptAndHashCacheMutex);
-        return DictionaryCopy(result);
-    }
+    if(cached.length)
+        return DictDeserialize(cached);
     
-    if(!masterHdWallet.length) {
-
-        pthread_mutex_unlock(&scriptAndHashCacheMutex);
+    if(!masterHdWallet.length)
         return DictNull();
-    }
 
-    masterHdWallet = hdWallet(masterHdWallet, StringF("%d/%d", isChange ? 1 : 0, derivation).bytes);
+    // Built without the lock so the derivation threads don't wait on each other's key derivations
+    masterHdWallet = TTDerive(self, masterHdWallet, StringF("%d/%d", isChange ? 1 : 0, derivation).bytes);
 
     hdWallets = DatasCopy(hdWallets);
 
     for(int i = 0; i < hdWallets.count; i++)
-        hdWallets = DatasReplaceIndexRef(hdWallets, i, hdWallet(hdWallets.ptr[i], StringF("%d/%d", isChange ? 1 : 0, derivation).bytes));
+        hdWallets = DatasReplaceIndexRef(hdWallets, i, TTDerive(self, hdWallets.ptr[i], StringF("%d/%d", isChange ? 1 : 0, derivation).bytes));
 
     Data script = vaultScript(pubKeyFromHdWallet(masterHdWallet), pubKeysFromHdWallets(hdWallets));
 
-    result = DictNew();
+    Dict result = DictNew();
 
     DictAdd(&result, script, DataNull());
     DictAdd(&result, sha256(script), script);
 
-    DictAdd(&self->scriptAndHashCache, key, DataDict(result));
+    pthread_mutex_lock(&scriptAndHashCacheMutex);
+
+    // Another thread may have built the same entry meanwhile, it stays
+    cached = DataCopyData(DictGet(self->scriptAndHashCache, key));
 
-    DictUntrack(self->scriptAndHashCache);
+    if(!cached.length) {
+
+        DictAdd(&self->scriptAndHashCache, key, DictSerialize(result));
+
+        DictUntrack(self->scriptAndHashCache);
+    }
 
     pthread_mutex_unlock(&scriptAndHashCacheMutex);
 
-    return result;
+    return cached.length ? DictDeserialize(cached) : result;
 }
 
 Dict TTScriptAndHash(TransactionTracker *self, int vaultIndex, int derivation, int isChange)
@@ -433,7 +818,7 @@ int TTHasTransctionHash(TransactionTracker *self, Data hash)
 {
     pthread_mutex_lock(&allTransactionsMutex);
 
-    int result = DatasHasMatchingData(self->allTransactionHashes, hash);
+    int result = DictHasKey(self->hashIndex, hash);
 
     pthread_mutex_unlock(&allTransactionsMutex);
 
@@ -465,11 +850,11 @@ TransactionAnalyzer TTAnalyzerFor(TransactionTracker *self, Data hdWalletRoot)
 {
     Dict items = DictNew();
 
-    Datas array = TTAllTransactionsFor(self, hdWallet(hdWalletRoot, "0"), &items);
+    Datas array = TTAllTransactionsFor(self, TTDerive(self, hdWalletRoot, "0"), &items);
 
     sortTransactions(&array);
 
-    Datas change = TTAllTransactionsFor(self, hdWallet(hdWalletRoot, "1"), &items);
+    Datas change = TTAllTransactionsFor(self, TTDerive(self, hdWalletRoot, "1"), &items);
 
     FORIN(Transaction, transaction, change) {
         if(!DatasSearchCheck(array, DataRaw(*transaction), txCompare)) {
@@ -493,6 +878,67 @@ TransactionAnalyzer TTAnalyzerForVault(TransactionTracker *self, int vaultIndex)
     return TANew(array, items);
 }
 
+// Vault outputs match on 'vaultIndex', the rest on being paid to one of 'hdWallets'
+static Datas unspentOutputsMatching(TransactionTracker *self, Datas hdWallets, int32_t vaultIndex)
+{
+    Datas result = DatasNew();
+
+    if(!self->unspentOutputsValid)
+        TTRestoreKeyTags(self);
+
+    pthread_mutex_lock(&allTransactionsMutex);
+
+    if(!self->unspentOutputsValid)
+        unspentRebuild(self);
+
+    FORINDICT(item, self->unspentOutputs) {
+
+        Datas value = DatasDeserialize(item->value);
+        Datas tag = DatasDeserialize(value.ptr[2]);
+
+        TTUnspentOutput output = { 0 };
+
+        output.vaultIndex = DataGetInt(tag.ptr[1]);
+        output.hdWallet = tag.ptr[0];
+
+        if(output.vaultIndex >= 0 ? output.vaultIndex != vaultIndex : !DatasHasMatchingData(hdWallets, output.hdWallet))
+            continue;
+
+        output.txid = DataCopyDataPart(item->key, 0, item->key.length - sizeof(uint32_t));
+        memcpy(&output.outputIndex, item->key.bytes + output.txid.length, sizeof(uint32_t));
+
+        output.value = (uint64_t)DataGetLong(value.ptr[0]);
+        output.script = value.ptr[1];
+        output.derivation = tag.ptr[2];
+
+        result = DatasAddCopy(result, DataRaw(output));
+    }
+
+    pthread_mutex_unlock(&allTransactionsMutex);
+
+    return result;
+}
+
+Datas/*TTUnspentOutput*/ TTUnspentOutputs(TransactionTracker *self, Data hdWalletRoot)
+{
+    return unspentOutputsMatching(self, DatasTwoCopy(TTDerive(self, hdWalletRoot, "0"), TTDerive(self, hdWalletRoot, "1")), -1);
+}
+
+Datas/*TTUnspentOutput*/ TTUnspentVaultOutputs(TransactionTracker *self, int vaultIndex)
+{
+    return unspentOutputsMatching(self, DatasNew(), vaultIndex);
+}
+
+uint64_t TTUnspentTotal(Datas/*TTUnspentOutput*/ unspentOutputs)
+{
+    uint64_t total = 0;
+
+    FORIN(TTUnspentOutput, output, unspentOutputs)
+        total += output->value;
+
+    return total;
+}
+
 Datas/*Transaction*/ TTAllTransactionsFor(TransactionTracker *self, Data hdWalletRoot, Dict *usedKeysAndHashes)
 {
     Datas array = DatasNew();
@@ -501,7 +947,7 @@ Datas/*Transaction*/ TTAllTransactionsFor(TransactionTracker *self, Data hdWalle
 
     for(int i = 0; i < lastUsedAddress + HDWALLET_SCANAHEAD_COUNT; i++) {
 
-        Data hdWalletTmp = hdWallet(hdWalletRoot, StringF("%d", i).bytes);
+        Data hdWalletTmp = TTDerive(self, hdWalletRoot, StringF("%d", i).bytes);
 
         Dict items = TTKeysAndKeyHashesForWallet(self, hdWalletTmp);
 
@@ -576,7 +1022,7 @@ Data TTUnusedWallet(TransactionTracker *self, Data hdWalletParam, unsigned int n
 
     for(i = 0; i < lastUsedAddress + HDWALLET_SCANAHEAD_COUNT; i++) {
 
-        Data hdWalletTmp = hdWallet(hdWalletParam, StringF("%d", i).bytes);
+        Data hdWalletTmp = TTDerive(self, hdWalletParam, StringF("%d", i).bytes);
 
         Dict items = TTKeysAndKeyHashesForWallet(self, hdWalletTmp);
 
@@ -609,10 +1055,10 @@ Data TTVaultScriptForDerivationPath(TransactionTracker *self, int vaultIndex, St
     Data masterHdWallet = publicHdWallet(DatasAt(KMVaultMasterHdWallets(&km), vaultIndex));
     Datas hdWallets = DatasDeserialize(DatasAt(KMVaultHdWallets(&km), vaultIndex));
 
-    masterHdWallet = hdWallet(masterHdWallet, path.bytes);
+    masterHdWallet = TTDerive(self, masterHdWallet, path.bytes);
 
     for(int i = 0; i < hdWallets.count; i++)
-        hdWallets = DatasReplaceIndexCopy(hdWallets, i, hdWallet(hdWallets.ptr[i], path.bytes));
+        hdWallets = DatasReplaceIndexCopy(hdWallets, i, TTDerive(self, hdWallets.ptr[i], path.bytes));
 
     return vaultScript(pubKeyFromHdWallet(masterHdWallet), pubKeysFromHdWallets(hdWallets));
 }
@@ -679,7 +1125,7 @@ String TTVaultUuid(TransactionTracker *self, int vaultIndex, Data forPubKey)
             Datas vaultHdWallet = DatasDeserialize(DatasAt(KMVaultHdWallets(&km), vaultIndex));
 
             FORDATAIN(hdWalletData, vaultHdWallet)
-                if(DataEqual(pubKeyFromHdWallet(hdWallet(*hdWalletData, path.bytes)), forPubKey))
+                if(DataEqual(pubKeyFromHdWallet(TTDerive(self, *hdWalletData, path.bytes)), forPubKey))
                     return KMUuidFromHDWallet(&km, *hdWalletData);
         }
     }
@@ -735,7 +1181,7 @@ Datas/*Data*/ TTAllActiveDerivations(TransactionTracker *self, Data hdWalletData
 
     for(int i = 0; i < lastUsedAddress + HDWALLET_SCANAHEAD_COUNT; i++) {
 
-        Data hdWalletTmp = hdWallet(hdWalletData, StringF("%d", i).bytes);
+        Data hdWalletTmp = TTDerive(self, hdWalletData, StringF("%d", i).bytes);
 
         Dict items = TTKeysAndKeyHashesForWallet(self, hdWalletTmp);
 
@@ -790,7 +1236,7 @@ Datas/*Data*/ TTAllVaultActiveDerivations(TransactionTracker *self, int vaultInd
 
                         Data masterHdWallet = DatasAt(KMVaultMasterHdWallets(&km), vaultIndex);
 
-                        item = hdWallet(masterHdWallet, StringF("%d/%d", change, i).bytes);
+                        item = TTDerive(self, masterHdWallet, StringF("%d/%d", change, i).bytes);
 
                         pthread_mutex_lock(&masterHdWalletCacheMutex);
 
@@ -825,12 +1271,7 @@ Transaction *TTTransactionForHash(TransactionTracker *self, Data hash)
 {
     pthread_mutex_lock(&allTransactionsMutex);
 
-    int index = DatasMatchingDataIndex(self->allTransactionHashes, hash);
-
-    Transaction *result = NULL;
-
-    if(index >= 0)
-        result = (Transaction *)self->allTransactions.ptr[index].bytes;
+    Transaction *result = indexGet(self->hashIndex, hash);
 
     pthread_mutex_unlock(&allTransactionsMutex);
 
@@ -841,18 +1282,40 @@ Transaction *TTTransactionForTxid(TransactionTracker *self, Data txid)
 {
     pthread_mutex_lock(&allTransactionsMutex);
 
-    int index = DatasMatchingDataIndex(self->allTransactionTxids, txid);
+    Transaction *result = indexGet(self->txidIndex, txid);
 
-    Transaction *result = NULL;
+    pthread_mutex_unlock(&allTransactionsMutex);
 
-    if(index >= 0)
-        result = (Transaction *)self->allTransactions.ptr[index].bytes;
+    return result;
+}
+
+Transaction *TTTransactionSpending(TransactionTracker *self, Data txid, uint32_t outputIndex)
+{
+    pthread_mutex_lock(&allTransactionsMutex);
+
+    Transaction *result = indexGet(self->spendingIndex, outpoint(txid, outputIndex));
 
     pthread_mutex_unlock(&allTransactionsMutex);
 
     return result;
 }
 
+// A transaction we have spends one of its outputs, the same test as TTMissingFundingTransactions
+static int isMissingFundingTransaction(TransactionTracker *self, Transaction *transaction)
+{
+    Data txid = TransactionTxid(*transaction);
+
+    for(uint32_t i = 0; i < transaction->outputs.count; i++) {
+
+        Transaction *spender = TTTransactionSpending(self, txid, i);
+
+        if(spender && TTInterestingTransaction(self, spender))
+            return 1;
+    }
+
+    return 0;
+}
+
 int TTAddTransaction(TransactionTracker *self, Data data)
 {
     Transaction transaction = TransactionNew(data);
@@ -862,14 +1325,14 @@ int TTAddTransaction(TransactionTracker *self, Data data)
         TransactionOutput *output = TransactionOutputOrNilAt(TTTransactionForTxid(self, input->previousTransactionHash), input->outputIndex);
 
         if(output)
-            input->fundingOutput = *output;
+            setFundingOutput(input, output);
     }
 
     int interesting = TTInterestingTransaction(self, &transaction);
 
     Data hash = hash256(data);
 
-    if(DatasHasMatchingData(TTMissingFundingTransactions(self), TransactionTxid(transaction)))
+    if(!interesting && isMissingFundingTransaction(self, &transaction))
         interesting = 1;
 
     if(!interesting) {
@@ -880,7 +1343,7 @@ int TTAddTransaction(TransactionTracker *self, Data data)
 
     pthread_mutex_lock(&allTransactionsMutex);
 
-    if(DatasHasMatchingData(self->allTransactionHashes, hash) || DatasHasMatchingData(self->allTransactionTxids, hash)) {
+    if(DictHasKey(self->hashIndex, hash) || DictHasKey(self->txidIndex, hash)) {
 
         pthread_mutex_unlock(&allTransactionsMutex);
         return -1;
@@ -890,9 +1353,35 @@ int TTAddTransaction(TransactionTracker *self, Data data)
 
     TransactionUntrack(&transaction);
 
+    Data txid = TransactionTxid(transaction);
+
     self->allTransactions = DatasUntrack(DatasAddCopy(self->allTransactions, DataRaw(transaction)));
     self->allTransactionHashes = DatasUntrack(DatasAddCopy(self->allTransactionHashes, hash));
-    self->allTransactionTxids = DatasUntrack(DatasAddCopy(self->allTransactionTxids, TransactionTxid(transaction)));
+    self->allTransactionTxids = DatasUntrack(DatasAddCopy(self->allTransactionTxids, txid));
+
+    Transaction *added = (Transaction*)DatasLast(self->allTransactions).bytes;
+
+    indexAdd(self, added, hash, txid);
+    unspentTransactionAdded(self, added, txid);
+
+    // Transactions that arrived before this one, their funding, get to see the outputs they spend
+    for(uint32_t i = 0; i < added->outputs.count; i++) {
+
+        Transaction *spender = indexGet(self->spendingIndex, outpoint(txid, i));
+
+        if(!spender)
+            continue;
+
+        FORIN(TransactionInput, input, spender->inputs) {
+
+            if(input->outputIndex != i || input->fundingOutput.script.bytes || !DataEqual(input->previousTransactionHash, txid))
+                continue;
+
+            setFundingOutput(input, (TransactionOutput*)added->outputs.ptr[i].bytes);
+
+            DataUntrack(input->fundingOutput.script);
+        }
+    }
 
     pthread_mutex_unlock(&allTransactionsMutex);
 
@@ -910,10 +1399,19 @@ int TTRemoveTransactionByHash(TransactionTracker *self, Data hash)
     
     pthread_mutex_lock(&allTransactionsMutex);
 
+    if(!DictHasKey(self->hashIndex, hash)) {
+
+        pthread_mutex_unlock(&allTransactionsMutex);
+        return 0;
+    }
+
     for(long i = 0; i < self->allTransactionHashes.count; i++) {
 
         if(DataEqual(self->allTransactionHashes.ptr[i], hash)) {
 
+            indexRemove(self, (Transaction*)self->allTransactions.ptr[i].bytes, hash, self->allTransactionTxids.ptr[i]);
+            unspentTransactionRemoved(self, (Transaction*)self->allTransactions.ptr[i].bytes, self->allTransactionTxids.ptr[i]);
+
             TransactionTrack((Transaction*)self->allTransactions.ptr[i].bytes);
 
             self->allTransactionTxids = DatasRemoveIndex(self->allTransactionTxids, (int32_t)i);
@@ -939,10 +1437,19 @@ int TTRemoveTransactionByTxid(TransactionTracker *self, Data txid)
 
     pthread_mutex_lock(&allTransactionsMutex);
 
+    if(!DictHasKey(self->txidIndex, txid)) {
+
+        pthread_mutex_unlock(&allTransactionsMutex);
+        return 0;
+    }
+
     for(long i = 0; i < self->allTransactionTxids.count; i++) {
 
         if(DataEqual(self->allTransactionTxids.ptr[i], txid)) {
 
+            indexRemove(self, (Transaction*)self->allTransactions.ptr[i].bytes, self->allTransactionHashes.ptr[i], txid);
+            unspentTransactionRemoved(self, (Transaction*)self->allTransactions.ptr[i].bytes, txid);
+
             TransactionTrack((Transaction*)self->allTransactions.ptr[i].bytes);
 
             self->allTransactionTxids = DatasRemoveIndex(self->allTransactionTxids, (int32_t)i);
@@ -972,7 +1479,7 @@ Datas/*Data*/ TTMissingFundingTransactions(TransactionTracker *self)
 
         FORIN(TransactionInput, input, transaction->inputs) {
 
-            if(!DatasHasMatchingData(self->allTransactionTxids, input->previousTransactionHash))
+            if(!DictHasKey(self->txidIndex, input->previousTransactionHash))
                 result = DatasAddCopy(result, input->previousTransactionHash);
         }
     }
@@ -1072,6 +1579,9 @@ int TTBloomFilterNeedsUpdate(TransactionTracker *self)
         if(TTUnusedAddresses(self, *hdWalletData) < HDWALLET_SCANAHEAD_COUNT)
             return 1;
 
+    if(TTKeyTagsMissing(self))
+        return 1;
+
 #if 0
     FORDATAIN(data, TTMissingFundingTransactions(self))
         if(!bloomFilterCheckElement(TTBloomFilter(self), *data))
@@ -1081,9 +1591,114 @@ int TTBloomFilterNeedsUpdate(TransactionTracker *self)
     return 0;
 }
 
-static Dict buildKeysAndKeyHashes(TransactionTracker *self)
+// Derives the keys (or vault scripts) at indices "first" up to "end" of one hd wallet chain or vault
+static void derivationJob(Dict job)
 {
+    TransactionTracker *self = DataGetPtr(DictGetS(job, "self"));
+    Data *result = DataGetPtr(DictGetS(job, "result"));
+
+    int i = DataGetInt(DictGetS(job, "vaultIndex"));
+    int first = DataGetInt(DictGetS(job, "first"));
+    int end = DataGetInt(DictGetS(job, "end"));
+
     Dict set = DictNew();
+    Dict tags = DictNew();
+
+    if(i < 0) {
+
+        TTDeriveRange(self, DictGetS(job, "hdWallet"), first, end);
+    }
+    else {
+
+        // The keys TTScriptAndHashFlexible puts in each vault script
+        Datas vaultHdWallets = DatasAddCopy(DatasDeserialize(DictGetS(job, "hdWallets")), DictGetS(job, "masterHdWallet"));
+
+        FORDATAIN(hdWalletData, vaultHdWallets) {
+
+            TTDeriveRange(self, TTDerive(self, *hdWalletData, "0"), first, end);
+            TTDeriveRange(self, TTDerive(self, *hdWalletData, "1"), first, end);
+        }
+    }
+
+    for(int j = first; j < end; j++) {
+
+        if(i < 0) {
+
+            Data hdWalletData = DictGetS(job, "hdWallet");
+            String path = StringF("%d", j);
+
+            addTaggedKeys(&set, &tags, TTKeysAndKeyHashesForWallet(self, TTDerive(self, hdWalletData, path.bytes)), keyTag(hdWalletData, -1, path));
+
+            continue;
+        }
+
+        Data masterHdWallet = DictGetS(job, "masterHdWallet");
+        Datas hdWallets = DatasDeserialize(DictGetS(job, "hdWallets"));
+
+        Data depositTag = keyTag(DataNull(), i, StringF("0/%d", j));
+        Data changeTag = keyTag(DataNull(), i, StringF("1/%d", j));
+
+        FORDATAIN(hdWalletData, DatasDeserialize(DatasAt(hdWallets, i))) {
+
+            addTaggedKeys(&set, &tags, TTKeysAndKeyHashesForWallet(self, TTDerive(self, *hdWalletData, StringF("0/%d", j).bytes)), depositTag);
+            addTaggedKeys(&set, &tags, TTKeysAndKeyHashesForWallet(self, TTDerive(self, *hdWalletData, StringF("1/%d", j).bytes)), changeTag);
+        }
+
+        addTaggedKeys(&set, &tags, TTScriptAndHashFlexible(self, i, j, 0, masterHdWallet, hdWallets), depositTag);
+        addTaggedKeys(&set, &tags, TTScriptAndHashFlexible(self, i, j, 1, masterHdWallet, hdWallets), changeTag);
+    }
+
+    *result = DataUntrack(DatasSerialize(DatasTwoCopy(DictSerialize(set), DictSerialize(tags))));
+}
+
+// Runs 'jobs' (DataDict's for derivationJob) spread over the derivation threads, one per core (or
+// TransactionTrackerDerivationThreads) up to DERIVATION_THREADS_MAX, and waits for them. Results are
+// serialized key and tag Dicts in job order.
+static Datas runDerivationJobs(TransactionTracker *self, Datas jobs)
+{
+    long threads = TransactionTrackerDerivationThreads ? TransactionTrackerDerivationThreads : sysconf(_SC_NPROCESSORS_ONLN);
+
+    threads = MAX(1, MIN(threads, DERIVATION_THREADS_MAX));
+    threads = MIN(threads, jobs.count);
+
+    Data results = DataNew(jobs.count * sizeof(Data));
+
+    for(int k = 0; k < jobs.count; k++) {
+
+        Dict job = DictionaryCopy(DataGetDictUntracked(jobs.ptr[k]));
+
+        DictAddS(&job, "self", DataPtr(self));
+        DictAddS(&job, "result", DataPtr((Data*)results.bytes + k));
+
+        if(threads > 1) {
+
+            WorkQueueAdd(WorkQueueThreadNamedStackSize(StringF("TT Derivation %d", (int)(k % threads)).bytes, 262144), derivationJob, job);
+        }
+        else {
+
+            DataTrackPush();
+            derivationJob(job);
+            DataTrackPop();
+        }
+    }
+
+    for(int k = 0; threads > 1 && k < threads; k++)
+        WorkQueueWaitUntilEmpty(WorkQueueThreadNamedStackSize(StringF("TT Derivation %d", k).bytes, 262144));
+
+    Datas result = DatasNew();
+
+    for(int k = 0; k < jobs.count; k++)
+        result = DatasAddRef(result, DataTrack(((Data*)results.bytes)[k]));
+
+    return result;
+}
+
+// 'tags' gets where each wallet key and hash came from
+static Dict buildKeysAndKeyHashes(TransactionTracker *self, Dict *tags)
+{
+    Dict set = DictNewHashed();
+
+    *tags = DictNewHashed();
 
     Datas allHdWallets = TTAllHdWallets(self);
     Datas/*Int*/ lookAheadCount = TTLookAheadCount(self);
@@ -1092,28 +1707,50 @@ static Dict buildKeysAndKeyHashes(TransactionTracker *self)
     Datas/*Data*/ allVaultMasterHdWallets = KMVaultMasterHdWallets(&km);
     Datas/*Datas*/ vaultHdWallets = KMVaultHdWallets(&km);
 
-    for(int i = 0; i < allHdWallets.count; i++)
-        for(int j = 0; j < DataGetInt(lookAheadCount.ptr[i]); j++)
-            DictAddDict(&set, TTKeysAndKeyHashesForWallet(self, hdWallet(allHdWallets.ptr[i], StringF("%d", j).bytes)));
+    Datas/*Dict*/ jobs = DatasNew();
 
-    for(int i = 0; i < TTVaultCount(self); i++) {
+    for(int i = 0; i < allHdWallets.count; i++) {
 
-        Data masterHdWallet = DatasAt(allVaultMasterHdWallets, i);
-        Datas hdWallets = DatasDeserialize(DatasAt(vaultHdWallets, i));
+        for(int j = 0; j < DataGetInt(lookAheadCount.ptr[i]); j += DERIVATION_JOB_SIZE) {
 
-        for(int j = 0; j < DataGetInt(vaultLookAheadCount.ptr[i]); j++) {
+            Dict job = DictNew();
 
-            FORDATAIN(hdWalletData, DatasDeserialize(DatasAt(hdWallets, i))) {
+            DictAddS(&job, "vaultIndex", DataInt(-1));
+            DictAddS(&job, "hdWallet", allHdWallets.ptr[i]);
+            DictAddS(&job, "first", DataInt(j));
+            DictAddS(&job, "end", DataInt(MIN(j + DERIVATION_JOB_SIZE, DataGetInt(lookAheadCount.ptr[i]))));
 
-                DictAddDict(&set, TTKeysAndKeyHashesForWallet(self, hdWallet(*hdWalletData, StringF("0/%d", j).bytes)));
-                DictAddDict(&set, TTKeysAndKeyHashesForWallet(self, hdWallet(*hdWalletData, StringF("1/%d", j).bytes)));
-            }
+            jobs = DatasAddCopy(jobs, DataDictStayTracked(job));
+        }
+    }
+
+    for(int i = 0; i < TTVaultCount(self); i++) {
+
+        for(int j = 0; j < DataGetInt(vaultLookAheadCount.ptr[i]); j += DERIVATION_JOB_SIZE) {
+
+            Dict job = DictNew();
+
+            DictAddS(&job, "vaultIndex", DataInt(i));
+            DictAddS(&job, "masterHdWallet", DatasAt(allVaultMasterHdWallets, i));
+            DictAddS(&job, "hdWallets", DatasAt(vaultHdWallets, i));
+            DictAddS(&job, "first", DataInt(j));
+            DictAddS(&job, "end", DataInt(MIN(j + DERIVATION_JOB_SIZE, DataGetInt(vaultLookAheadCount.ptr[i]))));
 
-            DictAddDict(&set, TTScriptAndHashFlexible(self, i, j, 0, masterHdWallet, hdWallets));
-            DictAddDict(&set, TTScriptAndHashFlexible(self, i, j, 1, masterHdWallet, hdWallets));
+            jobs = DatasAddCopy(jobs, DataDictStayTracked(job));
         }
     }
 
+    Datas results = runDerivationJobs(self, jobs);
+
+    // Merged in job order so the result is the same as deriving it all in one pass
+    FORDATAIN(result, results) {
+
+        Datas parts = DatasDeserialize(*result);
+
+        DictAddDict(&set, DictDeserialize(parts.ptr[0]));
+        DictAddDict(tags, DictDeserialize(parts.ptr[1]));
+    }
+
     Datas missing = TTMissingFundingTransactions(self);
 
     FORDATAIN(data, missing)
@@ -1166,6 +1803,17 @@ void TTUpdateBloomFilter(TransactionTracker *self)
 
     pthread_mutex_unlock(&masterHdWalletCacheMutex);
 
+    // Only the current wallets' nodes get cached again
+    pthread_mutex_lock(&derivationCacheMutex);
+
+    DictTrack(self->derivationCache);
+    self->derivationCache = DictUntrack(DictNewHashed());
+
+    DictTrack(self->walletKeysCache);
+    self->walletKeysCache = DictUntrack(DictNewHashed());
+
+    pthread_mutex_unlock(&derivationCacheMutex);
+
     Datas lookAheadArray = DatasNew();
 
     Datas allHdWallets = TTAllHdWallets(self);
@@ -1182,11 +1830,151 @@ void TTUpdateBloomFilter(TransactionTracker *self)
 
     TTSetVaultLookAheadCount(self, vaultLookAheadArray);
     
-    TTSetKeysAndKeyHashes(self, buildKeysAndKeyHashes(self));
+    Dict tags;
+
+    TTSetKeysAndKeyHashes(self, buildKeysAndKeyHashes(self, &tags));
+    TTSetKeyTags(self, tags);
 
     TTSetBloomFilter(self, bloomFilterArray(DictAllKeysRef(TTKeysAndKeyHashes(self)), BLOOM_FAILRATE, BLOOM_UPDATE_ALL));
 }
 
+// Wallets from before key tags were stored have wallet keys but no tags for them
+static int TTKeyTagsMissing(TransactionTracker *self)
+{
+    pthread_mutex_lock(&allTransactionsMutex);
+
+    int missing = !DictCount(loadedKeyTags(self));
+
+    pthread_mutex_unlock(&allTransactionsMutex);
+
+    return missing && (TTAllHdWallets(self).count || TTVaultCount(self)) && DictCount(TTKeysAndKeyHashes(self));
+}
+
+// Tags the keys of the current lookahead for wallets that never stored any, leaving the filter as is
+static void TTRestoreKeyTags(TransactionTracker *self)
+{
+    if(!TTKeyTagsMissing(self))
+        return;
+
+    Dict tags;
+
+    buildKeysAndKeyHashes(self, &tags);
+
+    TTSetKeyTags(self, tags);
+}
+
+// Lowest block height of a wallet transaction containing one of 'keysAndHashes', INT32_MAX if none are confirmed
+static int32_t TTEarliestHeightContainingOneOf(TransactionTracker *self, Dict keysAndHashes)
+{
+    Datas hashes = DatasNew();
+
+    pthread_mutex_lock(&allTransactionsMutex);
+
+    for(int i = 0; i < self->allTransactions.count; i++)
+        if(TTTransactionContainsOneOf(self, (Transaction*)self->allTransactions.ptr[i].bytes, keysAndHashes))
+            hashes = DatasAddCopy(hashes, self->allTransactionHashes.ptr[i]);
+
+    pthread_mutex_unlock(&allTransactionsMutex);
+
+    int32_t result = INT32_MAX;
+
+    FORDATAIN(hash, hashes) {
+
+        int32_t height = DatabaseTransactionHeight(&database, *hash);
+
+        if(height > 0 && height < result)
+            result = height;
+    }
+
+    return result;
+}
+
+int TTExtendBloomFilter(TransactionTracker *self, Datas *addedElements, int32_t *resumeHeight)
+{
+    *addedElements = DatasNew();
+    *resumeHeight = TTBloomFilterDlHeight(self);
+
+    Data filter = DataCopyData(TTBloomFilter(self));
+
+    Datas allHdWallets = TTAllHdWallets(self);
+    Datas lookAheadCount = TTLookAheadCount(self);
+
+    // New wallets get scanned from the start
+    if(!filter.length || KMVaultNames(&km).count != TTVaultCount(self) || !DatasEqual(allHdWallets, KMAllHdWalletPubRoots(&km)) || lookAheadCount.count != allHdWallets.count) {
+
+        *resumeHeight = 0;
+        return 0;
+    }
+
+    Dict keysAndKeyHashes = TTKeysAndKeyHashes(self);
+    Dict additions = DictNewHashed();
+    Dict tags = DictNewHashed();
+
+    for(int i = 0; i < allHdWallets.count; i++) {
+
+        int count = DataGetInt(lookAheadCount.ptr[i]);
+        int unused = TTUnusedAddresses(self, allHdWallets.ptr[i]);
+
+        if(unused >= HDWALLET_SCANAHEAD_COUNT)
+            continue;
+
+        // Keys past the old lookahead were only handed out once the ones near its end got used
+        Dict nearEnd = DictNew();
+
+        for(int j = count > HDWALLET_SCANAHEAD_COUNT ? count - HDWALLET_SCANAHEAD_COUNT : 0; j < count; j++)
+            DictAddDict(&nearEnd, TTKeysAndKeyHashesForWallet(self, TTDerive(self, allHdWallets.ptr[i], StringF("%d", j).bytes)));
+
+        int32_t height = TTEarliestHeightContainingOneOf(self, nearEnd);
+
+        if(height != INT32_MAX && height - 1 < *resumeHeight)
+            *resumeHeight = height - 1;
+
+        int newCount = count - unused + TransactionTrackerBloomaheadCount;
+
+        for(int j = count; j < newCount; j++) {
+
+            String path = StringF("%d", j);
+
+            addTaggedKeys(&additions, &tags, TTKeysAndKeyHashesForWallet(self, TTDerive(self, allHdWallets.ptr[i], path.bytes)), keyTag(allHdWallets.ptr[i], -1, path));
+        }
+
+        lookAheadCount.ptr[i] = DataInt(newCount);
+    }
+
+    FORDATAIN(txid, TTMissingFundingTransactions(self))
+        if(!DictHasKey(keysAndKeyHashes, *txid))
+            DictAdd(&additions, *txid, DataNull());
+
+    if(!DictCount(additions))
+        return 1;
+
+    FORINDICT(item, additions)
+        if(!bloomFilterAddElement(filter, item->key))
+            return 0;
+
+    if(bloomFilterFalsePositiveRate(filter) > BLOOM_INCREMENTAL_MAX_FAILRATE)
+        return 0;
+
+    FORINDICT(item, additions)
+        *addedElements = DatasAddRef(*addedElements, item->key);
+
+    DictAddDict(&additions, keysAndKeyHashes);
+
+    TTSetLookAheadCount(self, lookAheadCount);
+    TTSetKeysAndKeyHashes(self, additions);
+    TTSetBloomFilter(self, filter);
+
+    // Missing funding txids aren't wallet keys, only new keys change what the UTXO set holds
+    if(DictCount(tags)) {
+
+        DictAddDict(&tags, TTKeyTags(self));
+
+        TTSetKeyTags(self, tags);
+    }
+
+    return 1;
+}
+
 void TTTempBloomFilterAdd(TransactionTracker *self, Data element)
 {
     Data bloomFilter = TTBloomFilter(self);
@@ -1196,6 +1984,33 @@ void TTTempBloomFilterAdd(TransactionTracker *self, Data element)
     TTSetBloomFilter(self, bloomFilter);
 }
 
+Datas TTWalletScripts(TransactionTracker *self)
+{
+    Datas result = DatasNew();
+
+    FORDATAIN(key, DictAllKeysRef(TTKeysAndKeyHashes(self))) {
+
+        if(key->length == 20) {
+
+            result = DatasAddCopy(result, DataAddCopy(DataAddCopy(fromHex("76a914"), *key), fromHex("88ac")));
+            result = DatasAddCopy(result, DataAddCopy(fromHex("0014"), *key));
+            result = DatasAddCopy(result, DataAddCopy(DataAddCopy(fromHex("a914"), *key), fromHex("87")));
+        }
+        else if(key->length == 32) {
+
+            result = DatasAddCopy(result, DataAddCopy(fromHex("0020"), *key));
+        }
+        else if(key->length == 33 || key->length == 65) {
+
+            uint8_t length = key->length;
+
+            result = DatasAddCopy(result, DataAddCopy(DataAddCopy(DataCopy((char*)&length, 1), *key), fromHex("ac")));
+        }
+    }
+
+    return result;
+}
+
 Data TTPubKeyOrScriptForKnownHash(TransactionTracker *self, Data hash)
 {
     Dict dict = TTKeysAndKeyHashes(self);
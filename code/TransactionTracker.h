@@ -15,6 +15,21 @@
 
 extern const char *TransactionTrackerTransactionAdded;
 extern int TransactionTrackerBloomaheadCount; // If setting this, set before TransactionTracker creation.
+extern int TransactionTrackerDerivationThreads; // Threads deriving the bloom filter keys, 0 for one per core. 1 derives inline.
+
+typedef struct TTUnspentOutput {
+
+    Data txid;
+    uint32_t outputIndex;
+
+    uint64_t value;
+    Data script;
+
+    Data hdWallet; // The KMAllHdWalletPubRoots chain paid, DataNull for vault outputs
+    int32_t vaultIndex; // -1 for hd wallet outputs
+    String derivation; // Below 'hdWallet' ("7") or the vault ("1/7")
+
+} TTUnspentOutput;
 
 // Uses KMAllHdWalletPubRoots to generate n (probably 100) lookahead
 typedef struct TransactionTracker {
@@ -27,16 +42,31 @@ typedef struct TransactionTracker {
 
     /** Private **/
 
-    // Optimization potential: sort these arrays by the same criteria or make an index
     Datas/*Transaction*/ allTransactions;
     Datas/*Data*/ allTransactionHashes;
     Datas/*Data*/ allTransactionTxids;
 
+    // Hashed indexes of the arrays above. Values are DataPtr(Transaction*) into 'allTransactions', each
+    // transaction has its own allocation so they stay put as the arrays change.
+    Dict/*Data:DataPtr*/ hashIndex;
+    Dict/*Data:DataPtr*/ txidIndex;
+    Dict/*Data:DataPtr*/ spendingIndex; // Outpoint (txid + uint32 output index) to the transaction spending it
+
     Dict/*Data:DataNull*/ keysAndKeyHashes; // Stored in Dict keys for search speed
+    Dict/*Data:Data*/ keyTags; // The same keys and hashes to where they were derived, see TTUnspentOutput
+    int keyTagsLoaded; // 'keyTags' holds what was stored, which may be nothing
+
+    // Outpoint to the wallet outputs no known transaction spends. Kept current by adds and removes,
+    // rebuilt on next use after the wallet keys change.
+    Dict/*Data:Data*/ unspentOutputs;
+    int unspentOutputsValid;
 
     Dict scriptAndHashCache;
     Dict masterHdWalletCache;
 
+    Dict/*Data:Data*/ derivationCache; // Parent hd wallet + uint32 index to the child hd wallet
+    Dict/*Data:Data*/ walletKeysCache; // Hd wallet to its serialized pubkeys and their hash160s
+
     int matchCount;
     int mismatchCount;
 
@@ -63,12 +93,24 @@ int TTHasTransctionHash(TransactionTracker *self, Data hash);
 int32_t TTBloomFilterDlHeight(TransactionTracker *self);
 void TTSetBloomFilterDlHeight(TransactionTracker *self, int32_t param);
 
+// Unconfirms the transactions at 'firstHeight' through 'lastHeight' and moves the download height back
+// so the replacement blocks get fetched. NodeManager calls it on 'tracker' for every DatabaseReorgNotification.
+void TTBlocksDisconnected(TransactionTracker *self, int32_t firstHeight, int32_t lastHeight);
+
 Transaction *TTTransactionForHash(TransactionTracker *self, Data hash);
 Transaction *TTTransactionForTxid(TransactionTracker *self, Data txid);
+Transaction *TTTransactionSpending(TransactionTracker *self, Data txid, uint32_t outputIndex); // NULL if unspent or unknown
 
 TransactionAnalyzer TTAnalyzerFor(TransactionTracker *self, Data hdWalletRoot);
 TransactionAnalyzer TTAnalyzerForVault(TransactionTracker *self, int vaultIndex);
 
+// Read from the live UTXO set, no history is analyzed. 'hdWalletRoot' is as in TTAnalyzerFor, outputs
+// paying its receive ("0") and change ("1") chains are included.
+Datas/*TTUnspentOutput*/ TTUnspentOutputs(TransactionTracker *self, Data hdWalletRoot);
+Datas/*TTUnspentOutput*/ TTUnspentVaultOutputs(TransactionTracker *self, int vaultIndex);
+
+uint64_t TTUnspentTotal(Datas/*TTUnspentOutput*/ unspentOutputs);
+
 Datas/*Transaction*/ TTAllTransactionsFor(TransactionTracker *self, Data hdWalletRoot, Dict *usedKeysAndHashes);
 Datas/*Transaction*/ TTAllTransactionsForVault(TransactionTracker *self, int vaultIndex, Dict *usedKeysAndHashes);
 
@@ -125,10 +167,19 @@ int TTMismatchCount(TransactionTracker *self);
 
 int TTBloomFilterNeedsUpdate(TransactionTracker *self);
 void TTUpdateBloomFilter(TransactionTracker *self);
+// Grows the lookahead of wallets running low on unused keys and adds only the new keys to the bloom
+// filter, in place. 'addedElements' gets them for 'filteradd'. 'resumeHeight' is the download height to
+// rescan from, the block below the first wallet transaction that ran a lookahead low (0 if the wallets
+// changed). Returns 0, changing nothing, if the filter needs a full 'TTUpdateBloomFilter' instead: the
+// wallets changed or the new keys would fill it past its false positive target.
+int TTExtendBloomFilter(TransactionTracker *self, Datas *addedElements, int32_t *resumeHeight);
 void TTTempBloomFilterAdd(TransactionTracker *self, Data element);
 
 Data TTPubKeyOrScriptForKnownHash(TransactionTracker *self, Data hash);
 
 Dict TTKeysAndKeyHashes(TransactionTracker *self);
 
+// Output scripts paying the keys and hashes above (p2pkh, p2wpkh, p2sh, p2wsh & p2pk), for matching compact block filters
+Datas TTWalletScripts(TransactionTracker *self);
+
 #endif
@@ -4,6 +4,7 @@
 #include <time.h>
 #include <sys/time.h>
 #include <errno.h>
+#include <unistd.h>
 
 #ifndef MIN
 #define MIN(a,b) (((a)<(b))?(a):(b))
@@ -51,7 +52,7 @@ static pthread_mutex_t threadQueuesLock = PTHREAD_MUTEX_INITIALIZER;
 
 static void threadProcessingInit()
 {
-    threadQueues = DictUntrack(DictNew());
+    threadQueues = DictUntrack(DictNewHashed());
 }
 
 WorkQueue *WorkQueueThreadNamedStackSize(const char *name, int stackSize)
@@ -123,7 +124,7 @@ void WorkQueueThreadWaitAndDestroy(const char *name)
     if(!DictCount(threadQueues)) {
 
         DictionaryFree(threadQueues);
-        threadQueues = DictUntrack(DictNew()); // Empty Dicts don't allocate any memory.
+        threadQueues = DictUntrack(DictNewHashed()); // Empty Dicts don't allocate any memory.
     }
 
     if(pthread_mutex_unlock(&threadQueuesLock) != 0)
@@ -151,6 +152,7 @@ WorkQueue WorkQueueNew()
         abort();
 
     self.waitingToDestroy = 0;
+    self.wakeFd = -1;
 
     return self;
 }
@@ -193,10 +195,22 @@ void WorkQueueAddDelayed(WorkQueue *self, void (*function)(Dict dict), Dict dict
 
     self->queue = DatasUntrack(DatasAddCopy(self->queue, DataRaw(item)));
 
+    int wakeFd = self->wakeFd;
+
     UNLOCK(queueLock);
 
     if(pthread_cond_broadcast(&self->waitCondition) != 0)
         abort();
+
+    // A full pipe already has a wake up pending so the result is ignored
+    if(wakeFd >= 0) {
+
+        char byte = 0;
+
+        ssize_t result = write(wakeFd, &byte, 1);
+
+        (void)result;
+    }
 }
 
 void WorkQueueRemove(WorkQueue *self, int (*removalTest)(void *ptr, WorkQueueFunc func, Dict dict), void *ptr)
@@ -369,3 +383,38 @@ void WorkQueueWaitUntilNotEmpty(WorkQueue *self)
 
     UNLOCK(executionLock);
 }
+
+int64_t WorkQueueMillisecondsUntilReady(WorkQueue *self)
+{
+    LOCK(queueLock);
+
+    uint64_t lowestExecuteTime = UINT64_MAX;
+
+    for(int i = 0; i < self->queue.count; i++) {
+
+        WorkQueueItem *item = (WorkQueueItem*)DatasIndex(self->queue, i).bytes;
+
+        lowestExecuteTime = MIN(lowestExecuteTime, item->executeTimeMilliseconds);
+    }
+
+    UNLOCK(queueLock);
+
+    if(lowestExecuteTime == UINT64_MAX)
+        return -1;
+
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+
+    uint64_t milliseconds = tv.tv_sec * 1000 + tv.tv_usec / 1000;
+
+    return lowestExecuteTime <= milliseconds ? 0 : (int64_t)(lowestExecuteTime - milliseconds);
+}
+
+void WorkQueueSetWakeFd(WorkQueue *self, int fd)
+{
+    LOCK(queueLock);
+
+    self->wakeFd = fd;
+
+    UNLOCK(queueLock);
+}
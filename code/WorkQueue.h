@@ -12,6 +12,8 @@ typedef struct WorkQueue {
 
     int waitingToDestroy;
 
+    int wakeFd;
+
 } WorkQueue;
 
 // For each unique value of "name", a new thread and work queue is created.
@@ -44,4 +46,10 @@ void WorkQueueWaitUntilEmpty(WorkQueue *queue);
 // Not empty means things with 0 executeTime or executeTime in the past
 void WorkQueueWaitUntilNotEmpty(WorkQueue *queue);
 
+// Milliseconds until the next item is ready to execute, 0 if one is ready now and -1 if the queue is empty
+int64_t WorkQueueMillisecondsUntilReady(WorkQueue *queue);
+
+// A byte is written to 'fd' whenever work is added so event loops polling it wake up. -1 (the default) disables.
+void WorkQueueSetWakeFd(WorkQueue *queue, int fd);
+
 #endif
@@ -1,371 +0,0 @@
-static const char *initialBlocksSql =
-"BEGIN TRANSACTION;"
-""
-"INSERT INTO blocks VALUES(2015,X'6397bb6abd4fc521c0d3f6071b5650389f0b4551bc40b4e6b067306900000000',1790678883,X'0c113df1185e162ee92d031fe21d1400ff7d705a3e9b9c860eea855313cd8ca2',1233061996);"
-"INSERT INTO blocks VALUES(4030,X'0d9c8c96715756b619116cc2160937fb26c655a2f8e28e3a0aff59c000000000',-1769169907,X'3ff68d5507102f5660d829ac4f1da2e6e2d4b1a06120a322cc06d3ccdb4b85bb',1234465035);"
-"INSERT INTO blocks VALUES(6045,X'a8e0cb8ab99b57cb33bec7b42828a329b6a834e3400e69ef6efda4d600000000',-1966350168,X'fe8d4646680ea3512229bbdd3fb8fccc444c64f975506fc4944deb59a8cb60b5',1235963338);"
-"INSERT INTO blocks VALUES(8060,X'f6ef68f711a40a2c9acc8670c1844649ae5d9be64554a2b350e496bc00000000',-144117770,X'276b6570796fb739ae11b78385b069968046b6d84b541514c2ec3b5b740844e1',1237505984);"
-"INSERT INTO blocks VALUES(10075,X'96d4710a3d7b04b010def9beaf79878d76e881e6626008483e68f57700000000',175232150,X'bbac1098bc8f1f93f34f378955bd8bea38521cd57fb44a07fbd5ac42d515a73d',1239051721);"
-"INSERT INTO blocks VALUES(12090,X'be6e3912ec73873b38f34e01908f073594c99046ab4dcda1c56b8e1e00000000',305753790,X'e3a45f7f961137df7ee6c8c7b874b55125cda33ea54c0a41a6f99a9fd49dd9a1',1240594601);"
-"INSERT INTO blocks VALUES(14105,X'ff018ad65f7768b95350ab2ed034bdc6b70f144ca98a6b21c368774100000000',-695598593,X'ec000fb0c01ce45338dd2a29ab0e145015843f89aa7e5e4bffb8ed908deb4b0d',1242094150);"
-"INSERT INTO blocks VALUES(16120,X'0481d24aa9312288dd964efc24ce16c03b22782535edd45a9f60d99b00000000',1255309572,X'c8ecc6d0df24cadced78e1b08dd65b21866c5e2d6d183a6a35b29eb910763999',1243728663);"
-"INSERT INTO blocks VALUES(18135,X'c0e8b388b09593ada5726ff3b3ab918a1f66ddfbf20319753f372b4200000000',-2001475392,X'3b303d0cb9cb1a7223e2066e54737a5779b3ecf26113a4bc3eb3eacbb86ef223',1246042883);"
-"INSERT INTO blocks VALUES(20150,X'254962b2eb68098fc2d5b9add0948e92bef8e4bd66bab373e733e41700000000',-1302181595,X'8b891c57fd0973953330cf55179459525aa1d013b4cff101e777542b9dfd3cf8',1248474672);"
-"INSERT INTO blocks VALUES(22165,X'794727c6f8da0133687a5bd0df64f8c2194d9063f898310816f39cc000000000',-970504327,X'2d25e34ad117567371573b96165b35dac1500c1fba9a3191503f848579e540cd',1252052432);"
-"INSERT INTO blocks VALUES(24180,X'428c4c7beb02d9ea352263335d83bdef5e2fbcf78b060ceda954b9d900000000',2068614210,X'851452c17ce169e950b77af8ccd057f4b531c6c6a8876a05c69e45614c14e0b0',1254441182);"
-"INSERT INTO blocks VALUES(26195,X'ce04ccd487d93c9d9e609b28117f475ba6a54abf2d9ee609abbf901200000000',-724826930,X'f335ec05050702d1721fdc42972384547800334827898f2f600b07f46cb4d3b7',1256967378);"
-"INSERT INTO blocks VALUES(28210,X'edbc046c7fd0b51b8aa9da72c370115a19c342b954800ab5e315fabe00000000',1812249837,X'8fdef34145f3804ad265229ffd0c234432f6892ceb4659036c82aa8bd0c71ed6',1259340947);"
-"INSERT INTO blocks VALUES(30225,X'b290065795a8d65725f8ce2338b7861c89b0662216f9f6030fd359a700000000',1460048050,X'8c7450e46749d0de9238e0b57defd44cd30be2cf066f0b38e944ada94bde16bb',1261119344);"
-"INSERT INTO blocks VALUES(32240,X'93b776e9830e4a14012b5aab661b644f0b2e3607cdc7a0072200caa400000000',-378095725,X'ab514d9ea8b285e35d30a77f20d7828ed79fbdfc1efc3df4a7b0108432970f7d',1262143636);"
-"INSERT INTO blocks VALUES(34255,X'b184cdaa6f01134b05a3fedf8ef03e7d689367b7dfdb0d294c4d243200000000',-1429371727,X'93b06c4ff787358c3ad2f359a935c0ec2a36cb660ac71cbb34e3167d86a803a8',1263241534);"
-"INSERT INTO blocks VALUES(36270,X'3a31c5e084edc92d1f53c86c5bbb65aa7a0b97eb915d767817fda60d00000000',-523947718,X'4bb9bceb78d16dcb5af9d7e4bfac06276572ce67771a0ec0dd9f1ad2f8342000',1264418840);"
-"INSERT INTO blocks VALUES(38285,X'378bd27304c840ca1e00d52ff2f1955114ebff43ab8242d8ce43f37300000000',1943178039,X'ddc87806405e6a332aad763ef28a7208746b79042a0e6cf77212fd07c50a03b5',1265314344);"
-"INSERT INTO blocks VALUES(40300,X'4202eed4ce81482af6f45afd0634cdf5a4a799bfa1fe382c7d34202900000000',-722599358,X'be7e1ccd137521ab15aafd73254fd3af89d543cb24dcf4a5cf6c3451669fc2b0',1266181218);"
-"INSERT INTO blocks VALUES(42315,X'03392fd688a9595cd15e5790a990b303946c9f20f1968bf17c67245200000000',-701548285,X'76cad961b384f3cf859e580a9c053b76a100409dad126f9c412854eae3efe79a',1266987916);"
-"INSERT INTO blocks VALUES(44330,X'90e6d741fbd3667787813f0ada326c0e85193fa5293b431098865a3000000000',1104668304,X'e957774ecc4ce6460953f9804ede8dca2d3decb61b29d9cf527a7966a270f6c7',1268000157);"
-"INSERT INTO blocks VALUES(46345,X'4a59cd5a6f047415d927bf655087f32ddcb72ea1c5d948dfafe0792000000000',1523407178,X'1634031817ad620749e895f958f89188c5eaa04ebfc6983a03ae3f726a41a35d',1269204050);"
-"INSERT INTO blocks VALUES(48360,X'658031ac574336be1a645bfd8731d190455a32fa6f5e1cf37e2cc91600000000',-1406042011,X'de3b581d8e7c7588a262b58e1abcbd320db394382eaf49d91ad4496a47442940',1270110817);"
-"INSERT INTO blocks VALUES(50375,X'8eacb180dd601a0ad3eb70f59d5413e3d826a6ab00b2d45da41b0d2600000000',-2135839602,X'e8b6156bffa264f8612d59c9a7aace06b1c493c0917b113e86dfef0993c8f896',1271052546);"
-"INSERT INTO blocks VALUES(52390,X'af13d91ebc17571f066bcdbb3e7a05c11b4defb7aeb6cd41bcfc191500000000',517542831,X'2f3de29a07f5c6b8f2e185c7ae0e028dc0336cafa54fa10ef78e35e22099ea7b',1271879624);"
-"INSERT INTO blocks VALUES(54405,X'45ef1444e9aced980f1ef1f14f79aa41eca5d9cc4b386f12c66f860500000000',1142222661,X'3bc802af5756a63e1d9c614f2aa6fab08f0578dd65a8e4dcbd5296a122d6e6ed',1272953869);"
-"INSERT INTO blocks VALUES(56420,X'746588519179a7a38eb5a05f7cd7471e1e57f7a114d2cf662c95ae0a00000000',1367893364,X'2c63fedd220e251889f5690d09828b965b4cd3e26b0be6f6ac62b51e7061fc26',1274260933);"
-"INSERT INTO blocks VALUES(58435,X'22796a1b16ad19f53cfe6af2cbb03a69933560de9cabf9f979324b1300000000',459962658,X'1415702db80560e25b3f43363415ee947d5ab2be523e2742ed8c71f621f586aa',1275130960);"
-"INSERT INTO blocks VALUES(60450,X'4024e6cb1de1b686689092e748109ab9deff2855e21f15980ce9b50e00000000',-874109888,X'59737b055ed9834e85555bf7bccccfd02e0708265c8336a96faba858e1bd0e57',1276283907);"
-"INSERT INTO blocks VALUES(62465,X'3452ad4d657cb3b0345b2acc4780d736ca79ddc245efd6476b77520a00000000',1303204404,X'0ba2abc6dfea3ea945ef910fe27569d380e4b4611cdbad507367a581a93a934b',1277371271);"
-"INSERT INTO blocks VALUES(64480,X'04347130a608176bc1abcaa8adcbd23ecf078050742575fac37adc0c00000000',812725252,X'75f45da0c5805c899652295d8b0aefea5c36c28802fc8f88d34330b3129d95c2',1278362632);"
-"INSERT INTO blocks VALUES(66495,X'ebbaa876d740f87f2bf00b1ed768723a80ef3a786fe15142073ea00300000000',1990769387,X'18901e22dcf4ef929cbdf920257cb04a4bcb3ba00aeca35457e8335035dedae0',1279005714);"
-"INSERT INTO blocks VALUES(68510,X'eb954e28f359085e3be40560a8143b4e6a0d781a233ac680b3c20b0100000000',676238827,X'f43415f2a2e827cd7424a2e64e766b43802c9cb379c61861a3ae7ea27087f47a',1279293944);"
-"INSERT INTO blocks VALUES(70525,X'dd2ef206a946617dc81e25a7285674a68a4fa6af62c7b99e1a0a1e0000000000',116535005,X'a268d8c843a3ca0472153b63f70609e8b5846746a5f9c2468867050a95696889',1280175706);"
-"INSERT INTO blocks VALUES(72540,X'7814ecec3022db183dd126f992932dc6de986dc07aa573c285db740000000000',-320072584,X'f0799712de52a06e4548f2e814464b5aa1d2552f9aba80f8610f1576d0fc913c',1281026320);"
-"INSERT INTO blocks VALUES(74555,X'24253905bdc01508bf66838a9781a5d6305651ada68562502423090000000000',87631140,X'02e6c8ee30ba8d0a764b39cfc4f2273b9796c576ffd9a91b97c295e266c11f8b',1281861942);"
-"INSERT INTO blocks VALUES(76570,X'4d6639d42dacae4a710f15e0504d5e07c8ca77b9594237f4bd2e630000000000',-734435763,X'd88fec06c68e42f90729a1986838030a090d255928166629ebca409ed8f0f8bc',1282849944);"
-"INSERT INTO blocks VALUES(78585,X'4d60f00b1b607ee7fc53f5351af2e25e3e0857464e8a84ade2ab150000000000',200302669,X'e41962c7312dd1c886fd5d1dfbba96bc07fc27c4814b5991cbb39c27c26e0a84',1283899542);"
-"INSERT INTO blocks VALUES(80600,X'02a138346de8108d8b9be740805007881439bf9a0f12d5c55b38540000000000',876126466,X'51bb9c370a733dc7de88e91112a222931de7a0b17ba89513fe535f87124d0bc6',1284847491);"
-"INSERT INTO blocks VALUES(82615,X'b3e6ac799ac6e7c007a6e7128cae82eca3d27eb2d5d6cb022f2b350000000000',2041374387,X'14397b1a180bbc4f64c57d6d44ee3027b75a42881a73676db66fd6e16e3f9972',1285687291);"
-"INSERT INTO blocks VALUES(84630,X'29c6b8c945c75321658eb8c07d11b2cc1ca2efa8d10d79c4ecc7200000000000',-910637527,X'a0cc0f88d4e2d8b6b78731c290f47dca4952233802db407052b67bf07d0a8dd9',1286840216);"
-"INSERT INTO blocks VALUES(86645,X'6adbf4fb8c2b15c7c7522dad3f4d79304d74465fc2f71fb95e0b100000000000',-67839126,X'dc709c3cdb0c3bc91e2c0a4d76f7dcf02d1a50891e92a991f68a75279bf5eabc',1287620647);"
-"INSERT INTO blocks VALUES(88660,X'cc7c12a84bc53f7610b3657f720834eeff21878c2da636d0313e060000000000',-1475183412,X'173240129c33adda7b75526d159fa9b2b247986294ab14e79650acbe880a8253',1288460798);"
-"INSERT INTO blocks VALUES(90675,X'd44f43f783c277fe2dcabcaccedfbe3fd04283392fe6a245445e0f0000000000',-146583596,X'766495ce067727ae1c06c2932f92477e1f638b4d594b3d12281963e8ce517276',1289288428);"
-"INSERT INTO blocks VALUES(92690,X'30aff651f52cbc5648e6e698cfd5522024fc053eb7e4fa14874f0e0000000000',1375121200,X'4fbea5222854338a39bc69511416e2f6920818fddbf3452722556b27beba7525',1290091655);"
-"INSERT INTO blocks VALUES(94705,X'37cd407d57f3ab9b1804acb315c72bc2e7b7ace78bfa2755333c000000000000',2101398839,X'fd0d4b55cbe1ebfcf019d8cd453dc22be893e34daaea5282064d1e44abedae6f',1291119781);"
-"INSERT INTO blocks VALUES(96720,X'd5733524c1132fa9f0b5ae46d1015a172916303c290edccf35ba070000000000',607482837,X'9544a797a16f74d09f59f04ea7216313e1b217bff95709520da9f619fd3b8c0d',1291912761);"
-"INSERT INTO blocks VALUES(98735,X'b5567690af43521ffaf4a1e4333c22f0ee28a6b088cdea8a61b8020000000000',-1871292747,X'4b929e467559674e554330eaa9559fc9441ae938c10c199930c96b8306b6b6b9',1292936995);"
-"INSERT INTO blocks VALUES(100750,X'9517e8d8efc1c72bece73dc3c2c061d73c2c712ba1f70731490d010000000000',-655878251,X'b1eb124c08ee21583a7eab07e1515e4398ff513e66cf41bacc4af7df2a805087',1294002936);"
-"INSERT INTO blocks VALUES(102765,X'3ab370e8f863f9e4cdedc40373e1366246b5c9e989fc73438d53000000000000',-395267270,X'419eb02944d1d6c3e381d1773a506728dc2e389ffe8f6e62cd84e58233e1ea7f',1295072691);"
-"INSERT INTO blocks VALUES(104780,X'd8e4b1aac136d0849b1228994fd206686e1aac9b41e9048b57e3010000000000',-1431182120,X'179d75ed108ef5102e5157273597512f965cb487cd75d3d7dd9774c35f570314',1296092555);"
-"INSERT INTO blocks VALUES(106795,X'5cc288bc7c5dbedc8f947a8a897268861a9961f08c09a6c64b09020000000000',-1131888036,X'235c3bee8ab34a2b78927b9dead67f46fe6caac38a116de56f4ec8c07d3eb866',1297117793);"
-"INSERT INTO blocks VALUES(108810,X'a65a0d644c0106c605996aa2bce07f40aadeadfc963593d14c16010000000000',1678596774,X'7274536456140f5b2e963046f8d4a101b652943beebcc823b9c242786e15f096',1297986280);"
-"INSERT INTO blocks VALUES(110825,X'05e37c60db106e344b17fc78b369e1233da9caf9e0a8c414fa04000000000000',1618797317,X'f2217eef59cf096161d88cbe943e279df32e461cf7d742e881d4e09a265dc092',1298786323);"
-"INSERT INTO blocks VALUES(112840,X'46ef8989aac86fc7d4fb793c028535573089aa9223b3d372ca3a000000000000',-1987449018,X'cd0988a5c2906884be8bba1014e1b412f1ec97b04e18e4dd7dd848cea4ac1caf',1299654458);"
-"INSERT INTO blocks VALUES(114855,X'ba86698838bb811dde04b2989a37b7d5ce85606cd9ef8c0f9506000000000000',-2006350150,X'0cd278189e1db99019f30bbd62d71001a65dbc6d172da7eabfb7cd1038a64500',1300982102);"
-"INSERT INTO blocks VALUES(116870,X'3488a8eb60fa2d839205afbfac671147e1fe4dcb7cdfb7362fdd000000000000',-341276620,X'ce0a642e4e36ae2ef7227fb6a6cdba02be17fe9cc70b1c6e7692b3d454057be4',1302012201);"
-"INSERT INTO blocks VALUES(118885,X'01ce7ff75ec1de5d59b1080f57a555a9514376bf492654d62375000000000000',-142619135,X'4e519dbba57b472c0dcb53f6d684b5becd739f44e63aeb62f4047cc1d1795f44',1303077083);"
-"INSERT INTO blocks VALUES(120900,X'ab1ebda23b90b48ab6a21100bebda31974569656faf7a7e0fe12000000000000',-1564664149,X'cb5cc7267e25c181dd06ceb5225f6d013ad6397456675008806bb046c96f3931',1304103133);"
-"INSERT INTO blocks VALUES(122915,X'39d50b1cc6e482434110b829792c617e17e3b309c6881d5f7030000000000000',470537529,X'5c679b402e2e5e719dac436e804b2b5a0202411dc083eb51f8ff4e8a58ebc08b',1304954849);"
-"INSERT INTO blocks VALUES(124930,X'd434bdcec7c7da7b1daf9f6106ca7e00d28caa0b8a4019754646000000000000',-826460972,X'5cc99b94875cebd54f135fafc4f7caf93c270cc3c0b8cc8ba17704964a1e9d1f',1305738319);"
-"INSERT INTO blocks VALUES(126945,X'0f742b06fc570ff5e6227be9deeb347a0374dbb82ca43976ec18000000000000',103511055,X'b497645f0fcd08f0a0c9c9ac35225c8ca71d856e90640dec7776894251d0e693',1306417195);"
-"INSERT INTO blocks VALUES(128960,X'6715a45522910951f8229a4ec111d33041d55cdb0f7e1c465a08000000000000',1436816743,X'70d06ff352cf76221c8ddac8e9dce87b166de731fee4ede8ca020f8e77d69dc4',1307343077);"
-"INSERT INTO blocks VALUES(130975,X'4aa1bc802c23e668805e4a66b06239912901782955ad11169700000000000000',-2135121590,X'7b6618d84392ac2cabafb11a6b5e2e351dabe24bff5ae566e13e46bf0df3a6e0',1308128120);"
-"INSERT INTO blocks VALUES(132990,X'0de9d50f2cf21b7ef1a7788995c82f6ce9382a0cb5d07c35e204000000000000',265677069,X'1aad2bb7a163dfc1abfad718c8d95876b6245153b751efdec85c665fa63af812',1308889952);"
-"INSERT INTO blocks VALUES(135005,X'7974fa4cd8bf25e06c43cef793b03c842f3e25f9cedbe1456b01000000000000',1291482233,X'1b352eba8d9590012e98e4dd83f23030c757d92029127eca9cb4ed8daea26afb',1309946345);"
-"INSERT INTO blocks VALUES(137020,X'e9f83db55ec1b708b97c7507b098c20fa6ac0f4e7f673633c909000000000000',-1254229783,X'f0cf69bb9bd8b1b67bd161d578fb102ad3469ff355978c9f065a31a53158232e',1311062942);"
-"INSERT INTO blocks VALUES(139035,X'ec33926887a259b0c564d9b7399c07fff116c2be9b89ed81dc03000000000000',1754412012,X'94a9dbfc7a0e1bf7f2042fb1cd236fa0e88e098da9dafa584a6a7ec56a321f9e',1312156711);"
-"INSERT INTO blocks VALUES(141050,X'73c0c0448a6bd61d5c217336564f7f8caf98a4abf77485456004000000000000',1153482867,X'5bed869ad14f7921e2fa7b003bdd999798f5b0eaeac09cdb40b47078b5eef5d5',1313400118);"
-"INSERT INTO blocks VALUES(143065,X'81e5b77b355fb9c59fca433be47fb26b852c8c282059cc32f100000000000000',2075649409,X'bd34e91da9b4320481b189980a357a1dc94c745b1e95ed3821f4c6b147558095',1314637290);"
-"INSERT INTO blocks VALUES(145080,X'bbe8db5590bf0acb068eb83921e5ad2b209d02d1e48203eb5906000000000000',1440475323,X'977132ae9c3547c29a4602e284f453e117390d28d85503873361b6ec87491d8b',1315866592);"
-"INSERT INTO blocks VALUES(147095,X'58430da5110ed55e19a6eb29edcd19d85cd4ec53c9c532f7fd01000000000000',-1525857448,X'1701003563a1bf590da0f2d85a32cf545391a71f4ea6c666a9226b1b7b49ff9f',1317117206);"
-"INSERT INTO blocks VALUES(149110,X'df390f22f7de395c66d4e4b6b4c49619fced8e97d493d4738b07000000000000',571423199,X'4e7bdb59c597ac15e62d784d8823ef3cb5e3a640d8d04df10fdfbe2b8d900026',1318504012);"
-"INSERT INTO blocks VALUES(151125,X'cc09b77ae87431dec678b0dcd3a1471d8c2aacf7159c47a7c702000000000000',2058815948,X'264a167763dc5a7e556a9ac73481ce87dc507aea38323ca6eb71ecacf6ce224a',1319977876);"
-"INSERT INTO blocks VALUES(153140,X'1499d0a6f5f7d863d03e5cb39036bc8d08767a7c94b7cf402900000000000000',-1496278764,X'ffb42ea56052257873ccd259d17d36625bd3286d0afa1c86fc675102b4af033c',1321211906);"
-"INSERT INTO blocks VALUES(155155,X'414410fb103c54b15228368f54b703a42507f3298cf68dfe1609000000000000',-82820031,X'd44ea8d9fb561f63bab22ab2e0af67f80a674bc0cd6be26a3d15de86576778e6',1322525711);"
-"INSERT INTO blocks VALUES(157170,X'bf3484e159f57cad7c46db5af32de71792bb7b4f92293e507605000000000000',-511429441,X'57de1b67689d219820a42e54493211c43b9bf9e120b8658a50775ed745c31a0b',1323667313);"
-"INSERT INTO blocks VALUES(159185,X'3fd9246bff1284c54060273647c04ecaccea1f51e260113e6b05000000000000',1797577023,X'64a4ec46d31158d9f02d773930c540704e853e671259e7fa7b559c562f45b5e7',1324882005);"
-"INSERT INTO blocks VALUES(161200,X'293623fe85a4da11daa03a33b8db49b1fc29a9de7c51af975809000000000000',-31246807,X'c64770a3392eaf1753e4cd36e357f6e6f96605412abf5554baf18c780f50c653',1326006419);"
-"INSERT INTO blocks VALUES(163215,X'bc55ab4c95eba36190acfc776f81b023c37511d09f4e1c854d05000000000000',1286297020,X'94ec71a4da72337fbdb6053a659f307efd28869f5b920eb3a6b89bd1f2f7877e',1327154963);"
-"INSERT INTO blocks VALUES(165230,X'3138235193cc9db4c5cda2ab5f6395f98fc46005f4347e43ed02000000000000',1361262641,X'a5f5a4c8254b870646d9cde37363aec37157c159a43617e0fcb1210af84d8e0d',1328309450);"
-"INSERT INTO blocks VALUES(167245,X'1b9a9c42ba91d201752f3b124989caebc111ef0c82f5aede8f09000000000000',1117559323,X'7caf2a5f74962b3919ebf2a6dd2560dde4edcd4e9cba8c70bb5b075e3eb7dc52',1329518665);"
-"INSERT INTO blocks VALUES(169260,X'9d36041ed638cac28c0af49c418d979f4ae54d2d2cb1d62b1e07000000000000',503592605,X'f2d35debb32617a56411ebd03234b19c5d0a64e6dab03f70a025d374e351b39d',1330627589);"
-"INSERT INTO blocks VALUES(171275,X'b529263f667a0c67afb08ccfc1a4a8e0047edc9d6118f781a603000000000000',1059465653,X'd51a6b7e6c05df802b598a4ecafb43c492f413b32655755e11b200f88e7b615f',1331832443);"
-"INSERT INTO blocks VALUES(173290,X'f0e2bc9cbb84e02bf5498ec3da73cd32fbaa206c8e2e2e6b7d01000000000000',-1665342736,X'8b5ebc1a9d3a14730960ab7eea13cd936439120e8f758e6b31214a3dda4e41cc',1332949924);"
-"INSERT INTO blocks VALUES(175305,X'ea4e8998641aa8e1713868292eccd6f535b5d3016ca978d19309000000000000',-1735831830,X'84dfb9595ba762c68f77ed1fe7510fdb040bf173404e68147578bdba1583c2b2',1334194488);"
-"INSERT INTO blocks VALUES(177320,X'2de61cbed16cfa55b854a0d415989f73576c696f1cdf7ce44406000000000000',-1105402323,X'bcf3ee86a2c49b9b1e2c718b25e019491e44556edcca553fa8c293ed30569fdd',1335455070);"
-"INSERT INTO blocks VALUES(179335,X'dfb39b154b6f776d3e0b2f94ed1b06a4293b71a6dfce5b50c302000000000000',362525663,X'5005ce1589398e53badf6c267ef50e5c7d19efa0aae5b3ab221a1a6d7c680a41',1336523613);"
-"INSERT INTO blocks VALUES(181350,X'ede79b0bc01dce7fde4f9013b1256bd7353d0ccd8cf311fd9600000000000000',194766829,X'1b818242ff018fdfb8e6974cd05463fda706a1f8b5b4aa7ab14b8e5060743618',1337822507);"
-"INSERT INTO blocks VALUES(183365,X'2e7175a32e0bed51c73a55dc4a9170bed8ab10645ad22e5c3902000000000000',-1552584402,X'c2821de36c6c9c411b968fa1c2601d9ae8b4d237e358f875c61131569bfed5ff',1339040326);"
-"INSERT INTO blocks VALUES(185380,X'cd869574fb249a0babba9938e1a1dbb22fe67dbafb9f4253f902000000000000',1955956429,X'794db60629890a9677ab44587ac66788b9ae554fc2627c5e681a519a546f000f',1340157787);"
-"INSERT INTO blocks VALUES(187395,X'78475f3bd32e3e893fd5f73fb234b5eb8dc24d66fbb763be7e00000000000000',996099960,X'61a50c30773e2d0380c73681b0d1a47a0292945c727968f75ae5214a2c99bbb2',1341349189);"
-"INSERT INTO blocks VALUES(189410,X'3e4f4e67f425893d1633b6f57e8f950363555b6be8e828ebc305000000000000',1733185342,X'f54d63e998255410f89c123e8119896911b3be1b895472adc3fe1742bd9ef79d',1342488812);"
-"INSERT INTO blocks VALUES(191425,X'eace5fb7a7cb7b1bc05fc8ded7d60e2f2215ceb47f01fbca0101000000000000',-1218457878,X'6963b7f24a1100b9a32b3420e048b60237740a647e5abc7c28d4cb11891f9a17',1343603819);"
-"INSERT INTO blocks VALUES(193440,X'707c77514eef0cc2e65d77a8a6f428409a2bafe50a91f7c62904000000000000',1366785136,X'5723eb430303bafeea782ad5c94367c43ec91a38f59e0479a6ff37842836a7c2',1344720833);"
-"INSERT INTO blocks VALUES(195455,X'd81e914deb0b58afff2ddf9cb04e31477f665a28ab266e1c1007000000000000',1301356248,X'50d0c8402c8a9373567bd46467e196b366c16c3f180117514cb6974ef8121b00',1345798541);"
-"INSERT INTO blocks VALUES(197470,X'f538e58d398e8179ab1589c3581da2b2c5c8a4af624bf3de5e01000000000000',-1914357515,X'cf21862f82f8d1dcaff0a69628539425ddb12c06a8115d4fc15d3f3763eb6e87',1346909178);"
-"INSERT INTO blocks VALUES(199485,X'0a960fe823d4dac00f61272c9a7db59b44222b4e9ce8b6083002000000000000',-401631734,X'f70dd26b76f2d46e8018df2afeee5a1dd9edf0afe79691cb0e18683af17bd614',1348032078);"
-"INSERT INTO blocks VALUES(201500,X'c0e2b949e91e3bf613b5d467570e4c679ac70456145385857203000000000000',1236918976,X'7e50b58a35ad3cec0081932951acf43e591b4eb28e02f95c036990c4713df465',1349171107);"
-"INSERT INTO blocks VALUES(203515,X'ecf6749142dec28de18bfa13874bbe0454b98db7a6dc79f16700000000000000',-1854605588,X'aa816e436f0dfa892632e94f5297b022debb6e47e99f40d2ece3bbe8c5a8946d',1350372029);"
-"INSERT INTO blocks VALUES(205530,X'ecd022405896ddff478ea729d31785b4330d0eb0c380af227e03000000000000',1076023532,X'3244f3f77726c8995bd1c5feea049f8f07de557307fd3dfaa1d662adf081751d',1351499643);"
-"INSERT INTO blocks VALUES(207545,X'30c5551c7a893281b26a6cc254bf4a1d143b824eccc5131d1504000000000000',475383088,X'48b4c332ed1d1b96c98611797f1dec8724178cf3344e8c66443c44d1bda480a6',1352673522);"
-"INSERT INTO blocks VALUES(209560,X'c7ca9927d6cedc178aff86144385328926a47bc2c83c60682903000000000000',664390343,X'aef9ec5fb526685637dfc88b1d225ad0f441e5219da12fa6532a70d7e4395afd',1353876005);"
-"INSERT INTO blocks VALUES(211575,X'b4873b1fad5958772f100b672c1630107aea4b1b8d9f4c376604000000000000',523995060,X'1225628a855ebaba631d87face5bf5dcabdf556ed4e0a37febda221f8afa7824',1355099039);"
-"INSERT INTO blocks VALUES(213590,X'7e401658f0130150a733a5908f839e2dde0f6bcfdf5fedfe6503000000000000',1477853310,X'f684ce3f01825dc4ba8dea7221a754871d5b85e4b7a3befca22f8f56e3933cc6',1356463701);"
-"INSERT INTO blocks VALUES(215605,X'd53b81389adb5aa06f635dfcebfd1eeb10533b545e1605a53f04000000000000',947993557,X'6e1cedcfa0218901e7911bf6ef99be3720c6c531278e3998a30d3ef245c03a03',1357582487);"
-"INSERT INTO blocks VALUES(217620,X'3b5254684d13f80ae85ae0148e10754ba85adc6dec53362ba002000000000000',1750356539,X'99c2bf4fc03dc5c4dea5790bf991c9c8295b2b416d916fa69010c446ea7ce95d',1358894534);"
-"INSERT INTO blocks VALUES(219635,X'16646fc9493419904c07d6de75b38beb0560bacb4a39ce40f500000000000000',-915446762,X'032a898a740c347db2bc3e0a15813395af23302ae12a31615f6a6f29b3299794',1360010125);"
-"INSERT INTO blocks VALUES(221650,X'cd1383726b44e380565531b4c9e91ef1ecd0afa69dc877c48c01000000000000',1921192909,X'c5fde5862055732dc9e959e1c93ebef2ab1d303667a69b4c60686465a7d31c71',1361094735);"
-"INSERT INTO blocks VALUES(223665,X'7c242788c9078e6ff71a5e4232ca25f2641a32680eae2bb88f04000000000000',-2010700676,X'bc77e126599b56d4dca9aaf33ad28bb3ed5dc9665f65f9c76cdbea6a92fbafa5',1362096744);"
-"INSERT INTO blocks VALUES(225680,X'7a5b285d6a7a1278c8c54b460747786537b3dfb8d3ac310dc802000000000000',1562925946,X'8be1733d9b38a998efdf2d367990e4963db74a4a215e37aa205a80172fab9ba9',1363198558);"
-"INSERT INTO blocks VALUES(227695,X'0bc2ce5a4a2f3b432d68343fc7d50a23954fb6940ca403386302000000000000',1523499531,X'7fb22c0b4b2ecf29e992e90db95d963f87355637c6d20956f459a2be870e5839',1364084033);"
-"INSERT INTO blocks VALUES(229710,X'e7db74eed6123ccc022a8275057a611aaa3399a5fe17a49e3b02000000000000',-294331417,X'3a6df86749baedb25fc36a8e575ce5250122c029e8e303c597558ada8207d495',1365116568);"
-"INSERT INTO blocks VALUES(231725,X'1abc5253fa00448ed2c82b31acd30d1d66a9b262f340e5d47200000000000000',1397931034,X'080cc758de1573e58206570a9aaaaae7cd768000c888c903ef2447d37e0f786d',1366159714);"
-"INSERT INTO blocks VALUES(233740,X'5d735d0eb4e56b19ff7c65ced0ea1c574d025b0d730be16e2400000000000000',241005405,X'1ab047fd53735c76b893052222b12f07506dc97fab26184eba1d660d38b0661a',1367240016);"
-"INSERT INTO blocks VALUES(235755,X'ac06c63a7516c5d2f0b2772d26a95e6afee4434e8e826ba48f01000000000000',986056364,X'a662eddec337755436418c9167feff954b448776e0cbfa191287d1be2b1fc1a5',1368328171);"
-"INSERT INTO blocks VALUES(237770,X'3a6dbd04f29d83e7a564f587672bdd913588fc4bf93d2c28f500000000000000',79523130,X'60e2ded6adff41f839e4fcd95c848f0a13e2d1d5d24d986c73383abc549bea20',1369440485);"
-"INSERT INTO blocks VALUES(239785,X'82d104e321c27af5dd07a0efc2ec6d20c907ff5598c887b76a00000000000000',-486223486,X'1e375571a285b5ac6b30895decce2c5bb2bc0201626965a4fc2ab1b7e1a06d79',1370388421);"
-"INSERT INTO blocks VALUES(241800,X'b8aae07d9dac611f8ba1d187f69e4129c6d91dc3ac42e0f23800000000000000',2111875768,X'2b835cd524efbcb1fda12c863e197f5782838d08f53dc2b99220256e0607fe47',1371362272);"
-"INSERT INTO blocks VALUES(243815,X'b2fd340f2d22bbf845b64514dcfdf5844b7e9a0f09985e345100000000000000',255131058,X'f0a8dd7c20b47498133e2ae5b1584c96bf49f7a4f230ee2f20d1fad9bf85aaa2',1372447628);"
-"INSERT INTO blocks VALUES(245830,X'73db2d3db375015e4ca1a62a34bd3d014fbe1adb615aa4676600000000000000',1026415475,X'0a90343beff77b8060d8c8b5ecb8590f452ac59db82d86c0e1890a5e880664b8',1373449665);"
-"INSERT INTO blocks VALUES(247845,X'cd2f0a03302290f42017a059563a815770c8a95b77d818d08800000000000000',50999245,X'd1fe24f06d1b47790bfa3492d71fcea80091c38a39ba0b34ad13ec57308c105b',1374456866);"
-"INSERT INTO blocks VALUES(249860,X'18a269d56eacc711a0b47fd85585e93c3ea4888cfa661f846800000000000000',-714497512,X'1cb1730f9bdfc799a98983784b4f6e89daaa80635020f3e0b2fa177bc1fa8e84',1375471069);"
-"INSERT INTO blocks VALUES(251875,X'68516a2ae60ca5667a546dcaf30c13fac6b4115f78081db26600000000000000',711610728,X'1dafb797abad6ac1b237ef29e87db25290ef1677a4687b2c7b72942d8abb4bf8',1376364770);"
-"INSERT INTO blocks VALUES(253890,X'e907a2d8952be139c5ff428cd1b68fb860e966fb90a3c35c4100000000000000',-660469783,X'5b00fea5b457c247ac72a7a0b160c17add0e08e8dd9ddb4ccc4928dd59fb8769',1377297767);"
-"INSERT INTO blocks VALUES(255905,X'52e190c30af525fe0b1f5f040822d2dd4c11b22c3610f7ba1700000000000000',-1013915310,X'c8c1fce62e3171b88784f81e31865982ce5f5fd1b88e9d06c4f89516c41b2334',1378217868);"
-"INSERT INTO blocks VALUES(257920,X'48361fd1fff7b2dd84f25c64254650ca5690b31488c733162900000000000000',-786483640,X'3283658af1a261c50dfba61bb5ef9e802cb11223f701e7ff96d2974fc4ef36a1',1379153220);"
-"INSERT INTO blocks VALUES(259935,X'8b266cce25be819f6ad38afed060a12daffdabf65c3a21b60800000000000000',-831773045,X'3f9385584e032b5a039bb6c99772920f6a4fbacc66f255d09671d9466585654c',1380068023);"
-"INSERT INTO blocks VALUES(261950,X'5e84b84398029da92aa50b22bdadcdcaaaed4fe811e05d511300000000000000',1136165982,X'a6aba0d83dfc4191c241eb0e435d3622422e1339247fdf43f334aa4f607e0d89',1381011948);"
-"INSERT INTO blocks VALUES(263965,X'eef4e673f986ed586881bd36ec27b294a34860af33c396530600000000000000',1944515822,X'fbff912b2a7bb1a1777c886dcb27daf30e63227a9a28563fc67f0aaeb6e2fbe8',1381880570);"
-"INSERT INTO blocks VALUES(265980,X'751842812aa881c78d57fb9b7123aeb6fe56f61c51fbdbc70500000000000000',-2126374795,X'6cf1dc4194db16c9217ea34db9adc74ee9f62fe435187b45c3270d7a0c0bd641',1382708845);"
-"INSERT INTO blocks VALUES(267995,X'a6b3c3967ae7c13f726218ce427d4c409a1659a8cc9f9b050200000000000000',-1765559386,X'abf42a35f8173ce394245a263ee13eae6e73cf1d634157a10f79f0ee269556d4',1383613696);"
-"INSERT INTO blocks VALUES(270010,X'7dfe6c7cd21ceb33fc945bb248c176efb795707ac799cd690000000000000000',2087517821,X'0d0d5eaa881aaf97217728bc5cf4372a5201ced0ada05b909d5ce819524016ae',1384642597);"
-"INSERT INTO blocks VALUES(272025,X'1469039de5d3b428b33ea6d7a126e41ff8a7de4a69b0ef9b0400000000000000',-1660720876,X'480f40a7fe27125c8262640f54c8503b4948a8f07b67efa7684e6bc88a35e86f',1385679790);"
-"INSERT INTO blocks VALUES(274040,X'cbc81b6407ffdb262b88581e8381e50daef7634cbc7411f60200000000000000',1679542475,X'e72b6979363bfa0e73674ac1962786c81de6110d23622764c784856d60f02fe0',1386630939);"
-"INSERT INTO blocks VALUES(276055,X'55b4bddb3d0ee2f11ddbdc3e95b3b871ba70a2b4b08232dd0000000000000000',-608324523,X'75bac7e140778bf6307f6cdaae8079e28622c85de39b9e87bb15bfab4ad11bfe',1387542825);"
-"INSERT INTO blocks VALUES(278070,X'0f48d8bd96265d263b38db640e50a2e98d3cd5acb49a61610300000000000000',-1109899249,X'a6ee39cfe36c48447a4046e674d5af4702e7a1291afc9f6962cc96980f7eb35e',1388564554);"
-"INSERT INTO blocks VALUES(280085,X'f47254bab0f48fa4816b22672e5ebdf65fd514052491f2010300000000000000',-1168870668,X'68633747ae15f17fa0f216525831b43bc079c5ab2319dfdf1cb23ffc88dbe931',1389527780);"
-"INSERT INTO blocks VALUES(282100,X'd501500911bc193d8e7b21431fb2d468ecca5e9f501a73570000000000000000',156238293,X'f0f0a422805842acc61eadfbe439f74278bfe422f660dfd1f9092d402e56f01e',1390509094);"
-"INSERT INTO blocks VALUES(284115,X'3230f313c574cda16c63382e5ef0ecc7bb510c76c9d194740100000000000000',334704690,X'd08bc3e8859fc5fb116874da1e0c2d0b471cc072916aa1ec02e7de20289960f4',1391515140);"
-"INSERT INTO blocks VALUES(286130,X'421494bb80762ff45548e65c56ecae1c51e292424ca84c370000000000000000',-1147923390,X'2263b2d207a023b42d4167df36a44c93f0301eb9b88d35876a15cf2bd2f823ea',1392533217);"
-"INSERT INTO blocks VALUES(288145,X'1c9bd6699453b6a53c5e7ad9490df7d72cb60e69898c77260100000000000000',1775672092,X'334e46fa721a8668d84992b6239b140fc1dc38fc939117215f49ec07474f0be1',1393525464);"
-"INSERT INTO blocks VALUES(290160,X'fc5be7988ec08c340a23dab8005457a2d779e7ee0885050e0100000000000000',-1729668100,X'c8aca4e348ffb71583dc58baea7be1ee15e4ee1e8ad8eff2aef176ce4af54af4',1394609258);"
-"INSERT INTO blocks VALUES(292175,X'4abee77c4aebc767599c0bcd157d31171997021b4147a77a0000000000000000',2095562314,X'ae2566b16b90800647a3c32521017dad3ccb3819f044ec9c9a70f57c0341a780',1395641288);"
-"INSERT INTO blocks VALUES(294190,X'a734da075fb2dffa9cada137516aa465389cba4c765e06700000000000000000',131740839,X'b02424558a04875226bbcc5f215f35478fe5b7506585c4ef7666efb759c8855d',1396627804);"
-"INSERT INTO blocks VALUES(296205,X'ebe9e64039e239a5c40498e886b0498d6903a8d364df89200000000000000000',1088874987,X'e33d9d730e8c5d2c67276d68d9f3d0573406294ff998c09ebd067d4e03ad98b0',1397683152);"
-"INSERT INTO blocks VALUES(298220,X'6db947db1a0356375861c8d6e9f125b60cc0e1b564128c750000000000000000',-616056467,X'9dce354b222f45f7d5a9b26aeb76e2aea732afb00101bbf9c5840898b3215c8e',1398738993);"
-"INSERT INTO blocks VALUES(300235,X'ee1abe27abe96af1db915ea3d0c30b8a993a07c2771420760000000000000000',666770158,X'87092be30f89bad04c59fbe47be1e57fea53546364b3361fede42116cbf3edca',1399818353);"
-"INSERT INTO blocks VALUES(302250,X'568a8e4a49bbf00b25aebc36adb6c0f1d0807a1a27486a680000000000000000',1250855510,X'b73f4c4b3553d7a32182290a411aaef29795b875edc18d390002ba4aec6c0c03',1400856651);"
-"INSERT INTO blocks VALUES(304265,X'b0f8c72e56cf1e5e82f35df53b8523d63c53b8d0c04c764f0000000000000000',784857264,X'903ebb0da891a3ae3dd17833d79874ac5a0bba7b9c2dd2a4cb7f9c7fcb330138',1401920993);"
-"INSERT INTO blocks VALUES(306280,X'42ab2c7e7cd8bf8860340f5ab980beca03c516e3184ad6390000000000000000',2116856642,X'd142a12335634d1447371cf1741d68cf4b0f128b209d500dfcbce826b4c9e323',1402989583);"
-"INSERT INTO blocks VALUES(308295,X'd5bfb8a804a9dbe5518567dcb5e2ae9a65b6a32e19b85f350000000000000000',-1464287275,X'ac8fd510dded0e2a4daa9eb5c4e59cc195e2b01d2a183fa8b30ff3b94440bfea',1403961175);"
-"INSERT INTO blocks VALUES(310310,X'af05bcaa8eba7ffcbd59da393d7293d18305a7266b8c8a120000000000000000',-1430518353,X'2fee05bcfbf732d5a96cfb2d148f8269d2fd329eb6bfe33af73d30ec8bd01ac3',1405122883);"
-"INSERT INTO blocks VALUES(312325,X'76b14a38e2116604dccb1be44a14eee6449f7b30a0cb36190000000000000000',944419190,X'f03fdff1baec7e0c3ef008c2e842a36e93c61d119a6fc4e741b402ecd0a9304c',1406244930);"
-"INSERT INTO blocks VALUES(314340,X'3294a31146963a5d544c95b0a0b28fd9b182093e42cce61d0000000000000000',295932978,X'4db941e27ddc9690ce7dc9ed6b9a195636d425b86d45e7cbb05f12db88b318f0',1407389424);"
-"INSERT INTO blocks VALUES(316355,X'15d645570463ca862859fe671a172be742e3c5b5cd8a3e040000000000000000',1464194581,X'4fa284a8c6fcb462fb08d8c9d72028343ea4b3b8616efc13b5a80ff43847407e',1408407305);"
-"INSERT INTO blocks VALUES(318370,X'ff3bd71edd014b29211b05732324de9ba4d8d7cf843c61070000000000000000',517422079,X'697f1829aaa2c04ccc338eb775855536da220ed5334463d706446ea36422c0e4',1409454521);"
-"INSERT INTO blocks VALUES(320385,X'bbba43120446f4ff6af35ec043d0f106a31ac9514ce5060c0000000000000000',306428603,X'38625138b4b2583e5b70359700e4b6ca6d3e7c5c58bb6cab0ef986dada8f5fd4',1410563514);"
-"INSERT INTO blocks VALUES(322400,X'd9317c542aacd559dc7b7c07c54acda59200455f0140fc050000000000000000',1417425369,X'd40b802d915e9d3b4bfcfa39818bfecd99d7e47950d87bf5fa33b5fea1f08c73',1411600637);"
-"INSERT INTO blocks VALUES(324415,X'620e99125f8d44b4a91a60182d2958d5c2a9b23a8e6a1f180000000000000000',312020578,X'b256c5cd2ed0351df731721b409393c23a29488b4a48f0b974056059cb3331c5',1412776841);"
-"INSERT INTO blocks VALUES(326430,X'64275f0e55f4b70f3cd6b501c156490dbb1f114113b29a130000000000000000',241117028,X'faeb1306315f72cda82e9834453eaa7c05eb3ac794c634a9903bc592b8167bad',1413958613);"
-"INSERT INTO blocks VALUES(328445,X'e6e901242505ddcaf36b0ecd1dc2d85884d547599edb361c0000000000000000',604105190,X'd22ff93119992e6bd880fafe4435ca87d0795a554b3f26e0525e5664d4d76024',1415070375);"
-"INSERT INTO blocks VALUES(330460,X'9d1229caf7691000fff81cd9b027c5bc3697b345543cce0d0000000000000000',-903277923,X'de745afb3fe8fc2cc0385f40d9cbd498d794f062246b8bf1534d90d84bb0a40c',1416250422);"
-"INSERT INTO blocks VALUES(332475,X'4098409400dd9e9aca7ad4e883817559bc105970b90e430a0000000000000000',-1807706048,X'de2910e017b69aa93a1d6e6587e46dbccf0ed9060329698badac00fcaee8f412',1417464248);"
-"INSERT INTO blocks VALUES(334490,X'1157c1522699283843e135f02d5ac6fac28183690846f10d0000000000000000',1388402449,X'3f63c0560011ada1c4fe6daa5f2adb9a9640e9b5c9d280c25f7390feb4cf4d98',1418691350);"
-"INSERT INTO blocks VALUES(336505,X'5daeb9d363b3a110b945e30dd9c4c960389bc4b630e372120000000000000000',-742805923,X'286c84ba69843d1eaa780009a880a9811126abb10348657a72e6f4dcfe20a438',1419872025);"
-"INSERT INTO blocks VALUES(338520,X'ae757cc656544033e0283dc38d1e203e6a37db3f8afd4f130000000000000000',-964921938,X'0c0fe8a24083f0f7306f40d0c6fee8d81c9601d3760cdeca2c85c107e4e4e295',1420997252);"
-"INSERT INTO blocks VALUES(340535,X'19b34cda69251bcf55c8147dd5e472997dbcd8c3b9a14f080000000000000000',-632507623,X'8e4e2a8807b5cf79ca0bb6249f2dd4097dc48e89afd8290e82563d6dd8c06f64',1422268365);"
-"INSERT INTO blocks VALUES(342550,X'be1d5642974f7b6e7ee674320aee0ea8374f26546843af100000000000000000',1112939966,X'9052af2f3e0832ca5a4161fc2433bf3a22dbfa9e0e9ac3680bc6e17f206c7fd5',1423399012);"
-"INSERT INTO blocks VALUES(344565,X'7afa2ebeb04be5680f6e79a38f9ce003f519e432e4810f080000000000000000',-1104217478,X'6a9f8e170d86f2350e81ad1a660e8495a546bdc378c8d7f1e60c167fc5e7bff4',1424551527);"
-"INSERT INTO blocks VALUES(346580,X'aed35cf8d9befd34bfbbc0a35633aa26159e55e8aa2b3d0a0000000000000000',-128134226,X'b5218666480374f49df701986af878e9237c0b02e0d143cb4af39c4e9bdd049e',1425745731);"
-"INSERT INTO blocks VALUES(348595,X'b198c7771808227286c64b1c6798e35024b1ebc4a596d7010000000000000000',2009569457,X'9822f48bc8979f13ec7b1305329c200e8678cb8f903cdfc88900d6ad94c76945',1426962206);"
-"INSERT INTO blocks VALUES(350610,X'a3cbf7ea72c3d77b80558317fa3e9ff404086d4414e5a90b0000000000000000',-352859229,X'e815b6b8952adfb9e1941bb2c63badddb95ead0b377d740e5ba46877cfa25d90',1428109632);"
-"INSERT INTO blocks VALUES(352625,X'a3ae429ddbebf87109b2ba26f930a46e1d94cca87e9d060b0000000000000000',-1656574301,X'ce28b85148547545ffa13011bf644722f7d12e0a0e2748577655f4d0513ea773',1429360482);"
-"INSERT INTO blocks VALUES(354640,X'a30a4b71134a6220735ced2c0db9ca17c7dd07d3127a8d0f0000000000000000',1900743331,X'ab775fc8a57ad8e725ae56c7e00a1ecbf88c6e7726f58c18ce98af271d4377c7',1430569466);"
-"INSERT INTO blocks VALUES(356655,X'cd21f251df638a02f9b1d2305a4bee75b6db134f9ae085020000000000000000',1374822861,X'716ba5ad3e3144e0f795a0ed3f79810a2a31d7ee96d32cb38aa1e7321634c2d7',1431759797);"
-"INSERT INTO blocks VALUES(358670,X'c86e009c45009d6ad84c4b1600e4c931a76e54d637d1df030000000000000000',-1677693240,X'c378e2c3e612df031ee18052adcf0d50369769bceffe26b7405a9fb3a2d1ff0b',1432995062);"
-"INSERT INTO blocks VALUES(360685,X'063150566f327132442828305addd82a43c3e24da35ff5050000000000000000',1448096006,X'f9441807c38b42d5875c171f0fcc9663ca17972155757c0ee3bb4f299eeded93',1434164707);"
-"INSERT INTO blocks VALUES(362700,X'35d0f7955544990616a553e5ca0ba146c9269ecb7ac618160000000000000000',-1778921419,X'584ff2d8025bd91264083da4d355de6e7bc7e2fc3e09f42e27c9cb5c72e5798c',1435360309);"
-"INSERT INTO blocks VALUES(364715,X'171249d833adff42e2845da155809ba21ed8d2b34a3704160000000000000000',-666299881,X'195cdb266912eea38fb654a26607f2c2bb44b143afc4b5346def27eb9e2225a2',1436542238);"
-"INSERT INTO blocks VALUES(366730,X'9817790e4fab4701b57e2dca27ab47d5f57754a01c76800c0000000000000000',242816920,X'6c6831b264b62835950de5befff525dd428d769d226ea7b845f2d81452572751',1437733430);"
-"INSERT INTO blocks VALUES(368745,X'c030cdb9baf4a803836b35fa4199770fb68c55c2add1a6110000000000000000',-1177734976,X'16f70452f04d20efe7fae6077332b13370b07f9e94ab050c6824390ed456690d',1438917138);"
-"INSERT INTO blocks VALUES(370760,X'2c0d31b5411a17237a51fc7db5dd32916701ca165395140d0000000000000000',-1255076564,X'70bd134d237fbc9614d6cc74abf722e0858996cbfcdf8e5254a0427351465d77',1440107925);"
-"INSERT INTO blocks VALUES(372775,X'78017447cda0f9b717fb8b389cecfb3279d2f6c6454432020000000000000000',1198784888,X'726874982b4531faa9203cc88a7da903073222dd3976b7599d4d7d33a54e1829',1441253362);"
-"INSERT INTO blocks VALUES(374790,X'bc1238fd61ba9b923b45350c26dbfd63dac34eaa02c7f1010000000000000000',-46656836,X'63f0085735c5bc73ffe5b4988f3a5f0fc69f7998e730edc04cd3bec4c6486c5a',1442401964);"
-"INSERT INTO blocks VALUES(376805,X'399b87f3ffc30767b593c2e4539c5af57e8c163c5f2edf090000000000000000',-209216711,X'7b7ff93c0b3b2402d78dd0ba76b11dc274816fdc57c12f3fb4eb8a1bdbdc1a46',1443594176);"
-"INSERT INTO blocks VALUES(378820,X'cdc0777773a2d098a59e5375b2efa18da4785adaa032a3080000000000000000',2004336845,X'8e774a0dd229f0bb4e03bd74e0e9de2b31575d0e53f6c21a4b090ec6faba195a',1444803094);"
-"INSERT INTO blocks VALUES(380835,X'3a0c2d191dc75e3cef97b7a05e4b46e702b0d501e13dd30e0000000000000000',422382650,X'de2301acf29224246df71944dd9cda00050d5035f2afcd428bbc49ec14f6fc33',1445971201);"
-"INSERT INTO blocks VALUES(382850,X'4b044d6141811f55791458830489daceed43ece2a99623080000000000000000',1632437323,X'18025bfa96cbea46e64179c9c8ed446f2131323541487f4deff1c08a37d3dd4c',1447133473);"
-"INSERT INTO blocks VALUES(384865,X'de529252efa0d964d2ed8d58673ae5b98cbdf9bf3868a6000000000000000000',1385321182,X'c4ddc7775da52112a49bb014c7f76486145bf44443fc5d4fc1d76af8b44df5d0',1448228826);"
-"INSERT INTO blocks VALUES(386880,X'65fbde76f298aa19b95f77d9b5bccd3464aa3f3368a2e4070000000000000000',1994324837,X'e2f52d6e0ae167551bd732d06caa7d88b9db2be5f7b8d5949d25ea4dfd4cea73',1449344803);"
-"INSERT INTO blocks VALUES(388895,X'a612365245825204153c202af5f2644dcbe2f3a48e508c010000000000000000',1379275430,X'65b9567bd43e1eb8455dc212811e6b307668a5ef2d2c593ea6be2b58c1cae28a',1450367020);"
-"INSERT INTO blocks VALUES(390910,X'a1156187a89e25e1820e5f938a46416d5e059f3408c634020000000000000000',-2023680607,X'c06e5f0430ab9403b1155d533bc9b87c4e2bce80085b7482ce84fceb8d035617',1451450045);"
-"INSERT INTO blocks VALUES(392925,X'654da5037f21b80c3d9bc74420b2dd00bc0cab7432b008050000000000000000',61164901,X'f6b95f5fdb71e37329c0407357564777ac2e16a819fae923a8227d7b5b1ca498',1452570972);"
-"INSERT INTO blocks VALUES(394940,X'e0ed36271a8e48aa0f67f8398df906121421c834b5ac49030000000000000000',657911264,X'3dc0ffdcd9edca49cd53a38b95f2f8efee5a7c98405c0227775708035946fbc5',1453704713);"
-"INSERT INTO blocks VALUES(396955,X'fa0b9f51814b64fe9a74febadcebbceac644a6cb78f6c5020000000000000000',1369377786,X'102b6785916487107c53308ab4e01b0a453206aeb6fdb71d92be2382ca9b7f88',1454733218);"
-"INSERT INTO blocks VALUES(398970,X'131757ae7dc9ceeba650779265878124a45d0be1ab0fa0020000000000000000',-1370024173,X'28c9c49ab07935a448d6452d3fbe5a73790440b435a3b5be6c0c4ef73b949d5a',1455782586);"
-"INSERT INTO blocks VALUES(400985,X'd81ed2a2ecc75c4ebf26c407c4a00d22be897a6439ccc9050000000000000000',-1563287848,X'c9be7fa424ce7fab574a774503481895d3637a38a05ab456b36fbbfd3a689d84',1457021676);"
-"INSERT INTO blocks VALUES(403000,X'fd7549cc8df14854055e2f88ce2fa2810aafd9d820b8b3020000000000000000',-867600899,X'2e9d4674c65e8c58d247a3ee064fcbd5ecf8be0c780a845f8dc57108e162fbee',1458174001);"
-"INSERT INTO blocks VALUES(405015,X'def2ebd0de5f504c9e08a59492530e093e0f26a468efda010000000000000000',-789843234,X'0a18a6149e7f74b93e3729ddcacc22ba75dbb58ec9dcf2c72858dca0b7a184c6',1459357575);"
-"INSERT INTO blocks VALUES(407030,X'0cfec42fb7554e75656336e9aaa33d70fc8b258547b184030000000000000000',801439244,X'b677c9eb3f4db48d983c8d3cb5644f3e0eaa3f2f359802055ffd8f9ca79b88d7',1460513303);"
-"INSERT INTO blocks VALUES(409045,X'b9de51f3de44cbc3ea3784c2b7f7994a84ab5e42ef6762050000000000000000',-212738375,X'4f40c0861d28349df511b82ac6db54edcfc932e040329bfb87d04cd00bc91b64',1461701681);"
-"INSERT INTO blocks VALUES(411060,X'ad3cef71f89ee90bb0ca1ad456b90dc95f4322c483c7a0040000000000000000',1911504045,X'7422758df8c9604d9a19c1ea5f272533fbfcc39aeee938bc1f3696e867bfe563',1462829081);"
-"INSERT INTO blocks VALUES(413075,X'7659b31659c8cfd7b2812f2a72541c596739b56dd491c1010000000000000000',380852598,X'9adc5f41e83866950faa04d2e777f741260825c5d987f978494a5fce649780cb',1464002907);"
-"INSERT INTO blocks VALUES(415090,X'adff9720559b2b6ae5f0e6a83e88e5955f2f30ac61fc1b040000000000000000',546832301,X'0622f0c3d7bee2fd213f940271f2473f904d50653e057617d3e14603fb516268',1465229898);"
-"INSERT INTO blocks VALUES(417105,X'9eadc65b54e6e665d565a8456cd178e4bc2e1889df9441000000000000000000',1539747230,X'15d9f463e77072b4e633205fba167a504bd28cb16aacaf03d0a46525ad80e74f',1466374656);"
-"INSERT INTO blocks VALUES(419120,X'76ecb7f62dc490ad45e488a0b522cf496193f03cc8cb56020000000000000000',-155718538,X'922ba63064c31c18e7c098747697f5f7445c9ff5cce8547047aea9659e6e10de',1467556514);"
-"INSERT INTO blocks VALUES(421135,X'33adbe6b1a05cf6a7ebb5aba8a6aa51694a6e7e49056b6020000000000000000',1807658291,X'2476e0a1e585b4d3db777afd91fe57838752169eb697278521a37c70b953ea91',1468762558);"
-"INSERT INTO blocks VALUES(423150,X'18c940c56e1816b21da9efedca2c7c8347757c2ea4cfdf040000000000000000',-985609960,X'80109191babaeb9beb3681391586590937781c889702a0fa324d0dae525a3095',1470050495);"
-"INSERT INTO blocks VALUES(425165,X'e007fcc3dbafa6778ec2c5fb2955a1b2e549f1cf13d770000000000000000000',-1006893088,X'0f972b5ce5ffe262d3afc7cb46ac41c724b094f44f6080a4d2eb4e6b7550164b',1471176022);"
-"INSERT INTO blocks VALUES(427180,X'8468b1415754c6246fa6e02c96fcb4767b8c237f86f950040000000000000000',1102145668,X'9d0475b94845b3f893a4cab06d43c2450a461a93e9c33db783e4777fef4ac252',1472370694);"
-"INSERT INTO blocks VALUES(429195,X'2c4f23397cbf9314b9617fe5c2c92c90678096bdf8320f040000000000000000',958615340,X'e414f13c836feffa8fb55dde4bb3e2b533730f4dbcef091b6f9d9a7431d4b1ca',1473547022);"
-"INSERT INTO blocks VALUES(431210,X'fb17fa5ec86db6836b6efe6534ae3e6349878103c17609010000000000000000',1593448443,X'35eb53b6b388c15491cc133a70d08d6a37227cfd47ae910b3bc715dfc69e9cb0',1474702789);"
-"INSERT INTO blocks VALUES(433225,X'9b520d59b6914ef372e14204759638f0a2b5e518022e03010000000000000000',1494045339,X'eedffff9dd2b352e3b10e3d39ab8c04f63a7ebb02db461f49ce2ba0015cb0fd7',1475802284);"
-"INSERT INTO blocks VALUES(435240,X'64bf9f07c8474c4a84b50be10fecf7210376c44b280385020000000000000000',127909732,X'bc4aa8cbab49224d74ca5431d409f40d733b72d4797e6a844fe8051e33efdbec',1477048979);"
-"INSERT INTO blocks VALUES(437255,X'73a56d1951748edb00ba4b5872f7812c6b9fcbb2acd29b020000000000000000',426616179,X'69f9c3c456ac35a40f1739db3765473f8c3140c69036d0fba543ca45ee9c8250',1478215980);"
-"INSERT INTO blocks VALUES(439270,X'406b1b723d33067b90d6c8a6dec8c1cd9f0bae945571c2000000000000000000',1914399552,X'c6e3cac8fe1a0442bf4ae54c081888355d448a31de3f373a73981cca088600a5',1479334093);"
-"INSERT INTO blocks VALUES(441285,X'c3bf3a8dea15e337508e147de6698e504e4a20ebb9b980030000000000000000',-1925529661,X'de0f6f30fe227b1ca8b88c99161061182fb6de983e62bab81923e7409844a7bc',1480519168);"
-"INSERT INTO blocks VALUES(443300,X'57597d9e26c6b38d3422599e896df0c6ff4d04dee2a425010000000000000000',-1635952297,X'9dc3d05e8ffec59c6374fae4d91856f7a46599fce16eef3a3593e0a9be442d97',1481634080);"
-"INSERT INTO blocks VALUES(445315,X'fd6eeec0b50a678bdc601002c6f1d72dcd0ff0ef1e9472020000000000000000',-1058115843,X'0ff416fb6560b03463feb065bbb549cddc12542f3c4b4b3cda5521613fac04ab',1482834132);"
-"INSERT INTO blocks VALUES(447330,X'9c2d2389401d7507fc16e7aa03575d069dd6aa00432cf2010000000000000000',-1994183268,X'6024a1a0166bac09fc64541f107de5d6f272aa90bbe6d4cb90c920b800125f16',1483957287);"
-"INSERT INTO blocks VALUES(449345,X'20c2e0e03d090e28704603ef385c04591f54d3c682f7ec010000000000000000',-522141152,X'6d0a5a178e9d0906f627ab14d12734ef9952ca3b5a8e1806d60002eab81fe11b',1485017036);"
-"INSERT INTO blocks VALUES(451360,X'4daa98bed945aeac0dc612a834a7aff5b96a37a311d284000000000000000000',-1097291187,X'102baad647b100e14d9eb2de370e43055a52c2ad50014986c6790e0938a4f30f',1486126006);"
-"INSERT INTO blocks VALUES(453375,X'9127e6eccbd5008eea0a2787edfd7efe354e034f70fd99020000000000000000',-320460911,X'1f6f07f702f10ed6df76d15dfedb795663dcab5f04b4207248c960f45023e567',1487285785);"
-"INSERT INTO blocks VALUES(455390,X'd2aa10fae8a8c3208dedb28f816ae10513e3e7253819a1010000000000000000',-99570990,X'093c25ca1563b6086f025ccdbc927a7d43fe3eadbad6bcb1dedc2bcb05b51918',1488434679);"
-"INSERT INTO blocks VALUES(457405,X'8234eccd4da4156715c11078bd6fceca01c3a3b3a04bfb010000000000000000',-840158078,X'c9375fc75e00fc5ee447e0a0a78b406f564de8996a0e69d55920b8d87c01ed82',1489609562);"
-"INSERT INTO blocks VALUES(459420,X'001689f8b68897e960c13144c810475e83757cb0ab9a4a010000000000000000',-125233664,X'f7c07165800b5fda9aa83383cca1cd14a4515dca9644f1dc24ef028f5193014a',1490762014);"
-"INSERT INTO blocks VALUES(461435,X'f9eb1025a737c0ab68cc5ebf7e03ce3d0eb71a1ed510fb010000000000000000',621865977,X'd3ce16e95b6113fd746aef7947a0b3f8500472c5ec75f95ccd0ecea3405e7d52',1491920603);"
-"INSERT INTO blocks VALUES(463450,X'4be197389a2260c336ed7696151ee48b565df334aa4c32010000000000000000',949477707,X'8f8cb546808d5012f7325c0cb6467d9f86cff3cdabb70c876c605c696ff10b55',1493133111);"
-"INSERT INTO blocks VALUES(465465,X'ae3b030a63ba31552cb890ed37e31a26a947201f3a5204010000000000000000',167984046,X'10c87686861da357b9971068f1f8cde1fbe4848da9b8e01b1619d0d06b32071f',1494259967);"
-"INSERT INTO blocks VALUES(467480,X'881436179c07b05dc1566830f6b790c93c8208eda9403e010000000000000000',389420168,X'6973095824bc0f886e9d16cf118ea2b2b3c071931784f8c18a8552f97f0d0185',1495392132);"
-"INSERT INTO blocks VALUES(469495,X'3fa581ee9b0621cad30bcc9790ae60df3ed7428c2ad1a3000000000000000000',-293493441,X'6686045f07a645527f80c9e64d76c4b1bdb18b5631227efa36218f45584730d5',1496468562);"
-"INSERT INTO blocks VALUES(471510,X'dab60ad00f81807752aad54c2dd97b44414b50c5bef311000000000000000000',-804604198,X'873552abdc145147a71371b4c07f1217f3db0ecbc5b1ad9973719be15fb388e1',1497605348);"
-"INSERT INTO blocks VALUES(473525,X'cb76ac530f01f567b6d884d1161e502b91e7808bf20ff7000000000000000000',1403811531,X'e840d4ec2ac9e613d42dbd0cafda18bcdb0fd08daef8181a18c4bbde103b5365',1498835861);"
-"INSERT INTO blocks VALUES(475540,X'87b20d0a85daf77e52afc497d32b6a19009cfcef810f59000000000000000000',168669831,X'e21db236d0a4973e99134a3b42eeb00b311fc855de4cc4bc1a584424b74c695c',1499896483);"
-"INSERT INTO blocks VALUES(477555,X'8f0771dc8fd01d8aa8fb5442351d75a679321dd533b2b6000000000000000000',-596572273,X'72298b0e714d83d651133fe33a15a84f92dbd4372413744ff22023b01d34600a',1501016376);"
-"INSERT INTO blocks VALUES(479570,X'd5668a6d2c4cdf9cd0d134ecde991446473e4dc25e5008010000000000000000',1837786837,X'3cb4daf2eafeeb558822c8fc56c28228ac694ee207a298224a51003ce55e41d8',1502152776);"
-"INSERT INTO blocks VALUES(481585,X'0de908d73989e40ca19869e48ecb77192884592d2a710c010000000000000000',-687281907,X'139e70dfedf23da33acb5478f32e345a57f6cf49ef7d996b8e7debd129634a93',1503377754);"
-"INSERT INTO blocks VALUES(483600,X'515d74248a15dcb92a33118f1ec09d6571d03a5cb560e9000000000000000000',611605841,X'219701a21e617173874b283fb2752a2501d51d8f43aa68480b9b3a4f6b342556',1504594846);"
-"INSERT INTO blocks VALUES(485615,X'87ecb61e221d4c7a42e2db9456246c6a2fcf7fcc7298e7000000000000000000',515304583,X'd99e21cfd3b3868ca79d86f0c29b75bce099f2eb7c510d8ac832245fcd226b84',1505590450);"
-"INSERT INTO blocks VALUES(487630,X'e5d656c98f0f39d9f3902f7f2410fc931df9c5f78c93d6000000000000000000',-917055771,X'fd927492273f8ad7bb0ae14cc5eae7296175a7bf3286c641d8c34e84555e9573',1506743654);"
-"INSERT INTO blocks VALUES(489645,X'61a71c6b21091419243a290972471f8434fc59f76af11e000000000000000000',1797039969,X'2285f7567719a5bc32c9b3a3ddb63e76b7108bda051929497d3fbf77fa2903aa',1507908902);"
-"INSERT INTO blocks VALUES(491660,X'60d3e201212089b32d22617ed13a160bf81ce64bb56cd8000000000000000000',31642464,X'2cab75bdb09a399ff305baf0cdd7469f2905ba6d765bb22d6c431a5b8ee8df1f',1508936329);"
-"INSERT INTO blocks VALUES(493675,X'e5108126e157f3e2909b2a656e52b96cfac6450f40b92b000000000000000000',645992677,X'847530ffe4532f40ef342c145629b1d60c7d0b7bf286270ddd852a729691c005',1510177563);"
-"INSERT INTO blocks VALUES(495690,X'3af5e32ee387745225b4cd2a945e82c14f4679ffc7d009000000000000000000',786691386,X'753963b860345e4b5fb173b040bd78188ee5126ed03422580be93ec7cb8edefb',1511418780);"
-"INSERT INTO blocks VALUES(497705,X'c7856087f13927e37efe8c4cf02898285588ff55f63587000000000000000000',-2023717433,X'cc820019b73ff7fd110abdbf66e5223da34b35d3cfd1e732e68143971d40817c',1512468604);"
-"INSERT INTO blocks VALUES(499720,X'5bdb56042a159e4350e672bdc5131c4392686d8b13c352000000000000000000',72801115,X'06dbbb5629d233e9950dc97fa8831a0e85894e02ebdb2edfa5c4ff5122acf644',1513485421);"
-"INSERT INTO blocks VALUES(501735,X'f3979d0afbae9607dcc851e6fe0f4a4eb37136dfc7b17f000000000000000000',178100211,X'51009c440c04c0eaf660873df1406cc59388c4d209975e31c75baead7206993c',1514643955);"
-"INSERT INTO blocks VALUES(503750,X'78967d86b84192eee444528eb9480ad43068a7e501f46d000000000000000000',-2038589832,X'b7fca2a48eca42960209bf526f656fd3b97b23ffdd08f185fbbfd17e743653e6',1515702709);"
-"INSERT INTO blocks VALUES(505765,X'767b1ebf43b794126b691cf2592147f2addb9979c10476000000000000000000',-1088521354,X'4838608e33434b0b268b65cf018599980c10a24ef05cff8c38f489ff92e77760',1516744129);"
-"INSERT INTO blocks VALUES(507780,X'876a41ae75b837ff7b4c36a1041fbe1264b7f5c05d8856000000000000000000',-1371444601,X'9bb5457bba3d47b167472fc2ba91ba5431b09d82b879d0e4b9fca9a21a272d7e',1517835942);"
-"INSERT INTO blocks VALUES(509795,X'9c5fe46a65cbc9f45c8c93070307d24853eca1995aa04d000000000000000000',1793351580,X'089a605ce0040f30fc0e5af1f71dcfe8641e11e9c1b6d0d70ebbc0e8f3935171',1518973484);"
-"INSERT INTO blocks VALUES(511810,X'28182ca63bfe6a7bc9ba72289fa8edd90962d26d297505000000000000000000',-1507059672,X'5a27208b0435d106e376636b1e22113ac26310d4dc3f93ac021654444f22ce65',1520085425);"
-"INSERT INTO blocks VALUES(513825,X'9fefba2dffbf443866ea9de13fbda7b3d9c9ccb462bb37000000000000000000',767225759,X'bd288ee711a04ee7f0772d9ee10c6be37eac10fafa6541aed28f20bdc0d12ac2',1521224610);"
-"INSERT INTO blocks VALUES(515840,X'3761de8a1a9b3b872120434e2ce649df6cf6b8ed9c3e45000000000000000000',-1965137609,X'bf567eed89467226eef71ed33ec3bc379618866824dbddc791a8565f80246339',1522411001);"
-"INSERT INTO blocks VALUES(517855,X'd454153c61bd15a494723edd24e1ac9132f33f81c45937000000000000000000',1008030932,X'c5a1b277f68b7c7ead03b36d4711fc3ae61eb2813060cba1fec3e44dcf7aa860',1523536304);"
-"INSERT INTO blocks VALUES(519870,X'09f4ac48a17de03a1ed4f525187531d254e80800499503000000000000000000',1219294217,X'1359b5575b3778f9aa39291e04dd7ec235bf2e2a6d401c3049395512eec2ac26',1524663175);"
-"INSERT INTO blocks VALUES(521885,X'89cf64f17d8b9d1ce811b0d00f29d6855e0282c8922d0b000000000000000000',-245051511,X'9202dd3c29ae92c928d57802a8dd2ba1566916f365351cbb1535fe8b6dbf10b3',1525856113);"
-"INSERT INTO blocks VALUES(523900,X'ddba2782d03e2d3870a48b7d1a9c92cd6207be43a0740e000000000000000000',-2111325475,X'93e6caf2547a79a9502881e76a5b3196e87a736d2120601095037f8285988940',1527019026);"
-"INSERT INTO blocks VALUES(525915,X'b09fc5480c65882693832b54a7cea2a3953d8e0c65b23d000000000000000000',1220911024,X'99868c5ad0400f0e4b457f161b7e7f65cad7e78077929fa835aaec9623387361',1528106395);"
-"INSERT INTO blocks VALUES(527930,X'c6d6378dad83a33f5e8bcd28ad72708f2fada958a99121000000000000000000',-1925720378,X'd5568a832e4a484ef12382bbc12057bf2b48237a812786d4efcbfe048589653e',1529253905);"
-"INSERT INTO blocks VALUES(529945,X'691f0b26066f0ee8d6bcc77040c4ddb57c5f378ca1d411000000000000000000',638263145,X'12b9fc1b1496fcba0778df2ffc321dc30c84aa31d95c96b16da5e3752e4d406a',1530391837);"
-"INSERT INTO blocks VALUES(531960,X'435acb94ca2e0642be04c92d57ecb9daf2e9fcf9283527000000000000000000',-1798612413,X'709e7fa3316f5121f4c2ebbbc6d8e79866f08412f7aa50764aca09736daef0f9',1531620723);"
-"INSERT INTO blocks VALUES(533975,X'1884479778c4da83d8083ea621974118fa0db106a1fa03000000000000000000',-1756920808,X'd44f74b95fcf8515500b1b8a213441c73f268cd6219ea75efc89ea04cc679c33',1532718946);"
-"INSERT INTO blocks VALUES(535990,X'238ec4939171acf97bec34e9583c01a6c970555ee91d2b000000000000000000',-1815835101,X'b431cc38c0aec456694f818c9b0912ba13491ddcd5dd226605e37ae766af55b8',1533851843);"
-"INSERT INTO blocks VALUES(538005,X'1483da349bd1561dfddfabfb4de39b5b55050b31ebc429000000000000000000',886735636,X'e72f036e0a0d0bcc2828c24aefc1242222b2de0be2f404b2f4185bc19240feaa',1534972277);"
-"INSERT INTO blocks VALUES(540020,X'ee4a03331780ee432dd37bb4c430b5816f2040419bf517000000000000000000',855853806,X'907e9afdb073c6af15000bc3fc1ff46d9053c6e189991839a283beb3e97cf10a',1536135994);"
-"INSERT INTO blocks VALUES(542035,X'15498c257ea4c9e27951feb198a016d443275789d9c601000000000000000000',629950741,X'59d68cbb64770df91290fda6d2bfc9b2602be2be8fb4b47f226d76729a688c09',1537330526);"
-"INSERT INTO blocks VALUES(544050,X'2274bd76c4a0233eba1882efd9514fffb40d5a4cc82c23000000000000000000',1992127522,X'f373435e71b71878a129de2807de18ee65ac73c05cc0e2d6648f66bd90e533af',1538473945);"
-"INSERT INTO blocks VALUES(546065,X'c3a846c2a8f4832277680904f2834368eed7c67dd4841d000000000000000000',-1035556669,X'a21ac5e3d8043364de7602f0a34cd8e7f7219603fea8dba359e67da0e572f03f',1539727818);"
-"INSERT INTO blocks VALUES(548080,X'80acc208fb3e9ff1b381cbe1dec4fdc1a283400885b71f000000000000000000',146975872,X'07a7765c67e93388386b117f83097d020460963dd1419932c3306c3bfc3ecc4b',1540960965);"
-"INSERT INTO blocks VALUES(550095,X'a9d5db48850e5402ed7417d18cdc0893fef80590e6f519000000000000000000',1222366633,X'f547bf6caed236ea0342c2ce8a5b0a9b67444f5e35c2f6dc07a3bd1e7a9c677e',1542230712);"
-"INSERT INTO blocks VALUES(552110,X'0030afbd81bc00d85a13fbd7a1a32f19515248b76bf827000000000000000000',-1112592384,X'385fbb2dc1de0b0d9e317f9da1a0db94199dbfe0ca661757c8167ac80018202f',1543639711);"
-"INSERT INTO blocks VALUES(554125,X'c1f341b6bb51a4c83119025941201888a10b5eee4a1b01000000000000000000',-1237191743,X'9b80db13a7fa3dd7d3e230df7c24a68f82500a426c898dab1521a4740a066fc6',1545010402);"
-"INSERT INTO blocks VALUES(555555,X'6f5300499ec283f6357d5f54239aba9a2212341754fd1f000000000000000000',1224758127,X'ddfcdbc2f6a4e196cbd9f5a520e9d44fdd711dcc32cff76b16a1f82356b26082',1545817540);"
-"INSERT INTO blocks VALUES(555556,X'adcaeff6cd048e34812023b5635cdf87c79314425cb325000000000000000000',-152057171,X'91d8da6fd2b9ed0a501f64f51c861fe48a7ad63853db24922a7a5bf4f125572b',1545818177);"
-"INSERT INTO blocks VALUES(555557,X'a8fedbd51790dd6eeaf309446df9191d39c781d96c9605000000000000000000',-707002712,X'e7a8c4bde9852168e8e4eb07bea14dc4b67b67b4b9ba1a24b38bc5091d724d00',1545818334);"
-"INSERT INTO blocks VALUES(555558,X'a27c6c17bfb38a66bea4ad2edd2adf094c3deb3dc80c14000000000000000000',392985762,X'6b1309ac00882f1c8d0018c762cc3da8b0cf65975e84e968ce43ef98a72d8d11',1545818361);"
-"INSERT INTO blocks VALUES(555559,X'cef292ffdf5b933fcd81518311cc7c9948fbfdd744a828000000000000000000',-7146802,X'17afb422ba4c09f0763b4bb5f0aa5e71f1f22bd194328ac60f4e2b5a5bdb40e5',1545819603);"
-"INSERT INTO blocks VALUES(555560,X'44d34621f23182e16c1037129245100597b14c52a42322000000000000000000',558289732,X'867f19d95c57f3097561e3d77398f2360cefe2e447d904c57ec11a87f436db64',1545819624);"
-"INSERT INTO blocks VALUES(555561,X'7de3bca942ea53371705b7886bc9412feda88aef32911e000000000000000000',-1447238787,X'35c8cf78e40f6e444a2f3c51816035b50d3aec6c8201da28b03b83e7f5f19a57',1545820176);"
-"INSERT INTO blocks VALUES(555562,X'2acc55510398ee1c40f31849dd07ae09596f6e586e7936000000000000000000',1364577322,X'10da5449d4c415657135a69e3c33a1c578c64c8fa406727a684cadb57e80e4d7',1545823070);"
-"INSERT INTO blocks VALUES(555563,X'6f9fef8a3d0a4bcd2eae5d051924e3ce62799b6c17080b000000000000000000',-1964007569,X'0c1e45ce57ab8d4c40ede72c8acc0d0785c684c4973d4f14bdc786046b5a300a',1545823844);"
-"INSERT INTO blocks VALUES(555564,X'fc30791b34845a46f33baa26c2bd5568376cc131d33608000000000000000000',460927228,X'a80dc29211a2c6a68a98d8af631faaf27d58c0e3820467bc4e5ed293a8a8654d',1545826374);"
-"INSERT INTO blocks VALUES(555565,X'69634f68bcfa70492df2cc401263381695b21a4b14bb25000000000000000000',1750033257,X'1864936b04fa8c587b5b30a61b3f09344db357db14e0a6c00eaa5fe9f6aed286',1545827019);"
-"INSERT INTO blocks VALUES(555566,X'f30927347293893802b9c845d01ab7ab8a487d2f7efd0e000000000000000000',874973683,X'6bf4c4facc1c12b54f8e5aa14993a778645d025a6ca7142f4260984f3fc61a04',1545828320);"
-"INSERT INTO blocks VALUES(555567,X'78df62570d503d04e017e9ca03c411818615e00f347a29000000000000000000',1466097528,X'c5e9ffe914d5982ba0717cfcff1e09ebbfe922a5968f874146bb4f890389b6ee',1545829614);"
-"INSERT INTO blocks VALUES(555568,X'fa937bd02cf01789e7aefce5b0b03c9b52ecd371fbe426000000000000000000',-797207558,X'98202fdd1a21434a1680f18f551dcccf9dc6459c7c4832d9a0d890e6b864c330',1545829711);"
-"INSERT INTO blocks VALUES(555569,X'dcbce38466c982950845237f538cab8239d3e97a725c01000000000000000000',-2065449764,X'e8c334a4aa09e3e04f022350f518b12899f3850115a1fa8eb0b0b4288531ae72',1545829893);"
-"INSERT INTO blocks VALUES(555570,X'd2836b409027b1e8d5bd0f3fde62d831f8f90cc053280b000000000000000000',1080787922,X'0e258e449cd100880797d718a7aa685891dae12ce02d32ea6f22ddd31f4c4086',1545830729);"
-"INSERT INTO blocks VALUES(555571,X'a616dc94763c06ab800e2c7e33d2356f93ec56a3b87822000000000000000000',-1797515610,X'd5fca343c7f37c07a7140a0904117ff81584da95b2a3696816e2908f12e1719d',1545831679);"
-"INSERT INTO blocks VALUES(555572,X'ac5ae492af36dd189142c0e07af3de2ff568a8eefe8533000000000000000000',-1830528340,X'4b83afe884ed26e390cfae611a3718e779508d3ee7169e76d6f6b439ccd4b7a9',1545831962);"
-"INSERT INTO blocks VALUES(555573,X'53b300afca37dd49bf51bc558889c715de5d9666526911000000000000000000',-1358908589,X'2c04c2a39c931ade10cd2f189758083352317237ece40f8f93ae456a172a47e4',1545832554);"
-"INSERT INTO blocks VALUES(555574,X'e5309e534608a4796a8da02253023d72c1acac95672c23000000000000000000',1402876133,X'b1e9a5357ae13e82adb6f04f41f258bc1ce1d9da37e02744322c1e3190884eb2',1545832756);"
-"INSERT INTO blocks VALUES(555575,X'5463fd990ca96cc01df0af62884d111b1a7eb22bf1c40f000000000000000000',-1711447212,X'990b092af7da2ab3579dd15af1e2b91c3e4ba275a8f695f6ce7c0bc0754115e4',1545833191);"
-"INSERT INTO blocks VALUES(555576,X'a2cc329ec56b27d82c4e14b539d5897c4c4a2a9a666c24000000000000000000',-1640837982,X'b53df8c1fbbb660a77c422f2a98c03a47f15e604de881af64863fb2659b7acb8',1545833661);"
-"INSERT INTO blocks VALUES(555577,X'dd8d04f6aaf7eb87a3a9ceefe293657a424cb64a75f405000000000000000000',-167473699,X'112909d1543078f84bfd0c455dbeadec982d5b1bf30984ee675643951431885e',1545833964);"
-"INSERT INTO blocks VALUES(555578,X'6f50fbc1255be98c26a3e42739c09473959dce1622382c000000000000000000',-1040494481,X'44fb54e455ebcb9fcf89f53841e32ef7d75046008cdc186944263960f40d6614',1545834829);"
-"INSERT INTO blocks VALUES(555579,X'23946650183fc90e44429003daf12ad68ca3455b42f225000000000000000000',1348899875,X'40fd44856b4e3aed4110022392a1e2ae88fdb53e6f204aaf2f798cf19a56ded2',1545834946);"
-"INSERT INTO blocks VALUES(555580,X'83fca3b806bca87dd13aec3013a062a5b3b9a11593ad04000000000000000000',-1197212541,X'2e014bc7236da35ba6c58deb549b634fa2ef180f1e26b09c6ddc502952664f22',1545835346);"
-"INSERT INTO blocks VALUES(555581,X'c7c8437fda5d5d16a2acd4bb95ce89937dbe9e92c29305000000000000000000',2135148743,X'47c8dec2ee9edc51c129f7398e9467769685cb847fef60a2fb900ab1e6ffa823',1545835704);"
-"INSERT INTO blocks VALUES(555582,X'26c739f6a785bf69b2dbd986c2c42a94a20869b6c55715000000000000000000',-163985626,X'42fcb2a2262783f3c089d8bcbc01f0984ed04f6eef458cf6ebea42f996fd7cab',1545835781);"
-"INSERT INTO blocks VALUES(555583,X'f5007aa5ad26a55c5a26b8052fbedba6e64e9ff0a99a08000000000000000000',-1518731019,X'737c77030180022f63ad1e811cb5a3cb54e0965555740ab1db11cba8493b7786',1545835900);"
-"INSERT INTO blocks VALUES(555584,X'8bbea654ad327bdb6eb70a26645a84df3ccfba24d54610000000000000000000',1420213899,X'3d202a4f30ae07b32261592d9c404bd4c4460487ff751d64f53c656e5d9a2939',1545835956);"
-"INSERT INTO blocks VALUES(555585,X'2337b7f0bd1415f2de02302eb5cc500e6f8b5f2f664d0a000000000000000000',-256428253,X'a4a888405e1e89951b1280c7d40ca22a07232144c71e0ea3881094074c9351cd',1545836064);"
-"INSERT INTO blocks VALUES(555586,X'e8c2c5a2326fcc032eda1f9dc482cafa01d8edfe052c19000000000000000000',-1564097816,X'2335f36bbfcc52eab61d6ecf17b079c7820a3d5f91272003fbf4579781a27c49',1545836111);"
-"INSERT INTO blocks VALUES(555587,X'f6197b6d813ebe9434dc9094e6ea7f8516ca9a01ec600e000000000000000000',1836784118,X'18aade3075a76b9f715d2414186e105471fa6a0818f930e08c80d82f6330456a',1545836171);"
-"INSERT INTO blocks VALUES(555588,X'90e35fa69cecb9250549bc04801e67b8d140c2d2873936000000000000000000',-1503665264,X'decc35741ea8524c20932541081e62439e49c7a6cac6f7547aad25f1688ed14c',1545838055);"
-"INSERT INTO blocks VALUES(555589,X'cc3124e1045cd7c92dfa1fca7d4e36471bb71f77ef781a000000000000000000',-517721652,X'efe35140697aa04f4dd6294d8e82fc68b53ee787ed6a65b835b5c1edaf1d34c1',1545838448);"
-"INSERT INTO blocks VALUES(555590,X'47151d0ab1a4b843bae5f7396a03b68f40edad2c12f834000000000000000000',169678151,X'49cce06a506cae181e8bc17978faffa85f357b801d00756b53d0427d3fcdb312',1545838703);"
-"INSERT INTO blocks VALUES(555591,X'd4e74b6ad7b8341f5d4fa22db2fb42010a480b44079e0c000000000000000000',1783359444,X'c7ec350aaf04c3fc0211582c28692bfb6d184187f361471060464bd417ccf2eb',1545838963);"
-"INSERT INTO blocks VALUES(555592,X'5963926fa0abde6a9e40a8da95a79a19169dfdc051a010000000000000000000',1871864665,X'28ff81e85086db6126a96d18a9dcfd8cf7e97f4bca2f970b16abe73a122f1562',1545839530);"
-"INSERT INTO blocks VALUES(555593,X'b3f3eeb0fab50ae193fe23e3df9d76f2ef9a4f46fa5f09000000000000000000',-1326517325,X'0a47a3ffd30b94c1641d2badc7fda5ada6bd60845dec5dc8f179cc06478a2df6',1545841197);"
-"INSERT INTO blocks VALUES(555594,X'ac359fdee912dbe6803594af0e0c406539d1d2e3d7df1e000000000000000000',-559991380,X'8133ce79cb24bbdd9e56225612f619c4ba93e5e01f5747118632f6be11a788bd',1545841947);"
-"INSERT INTO blocks VALUES(555595,X'cde5fbe03f0cf614b2b1cc4bf5e1ec156381bbd6accb27000000000000000000',-520362547,X'68dbe209a643f52c9bc136f9e47f4a07a1095f06e4f20ed1cf67ae5bbc243774',1545842065);"
-"INSERT INTO blocks VALUES(555596,X'9e89cf341c0f0d8174e12fea22d9c38b1d167064d0ee07000000000000000000',886016414,X'71b64566d1e9f27e88d0141157a7337afcf46b2c49446992df680b27dc2475b7',1545842104);"
-"INSERT INTO blocks VALUES(555597,X'a1d6d28236f22336e1f9cfcab243aff6cdbdb338cb9c34000000000000000000',-2100111711,X'902be0987ba3e1ced2b9d892a233f8bfc6f1df071393309c96720171295bbd41',1545842289);"
-"INSERT INTO blocks VALUES(555598,X'7f7380fdb6d3a072ac856d2cacec54c60126ea59e10713000000000000000000',-41913473,X'ae10ffffae096c1164458234682d9a3ce35e379d49f63f7d139771d22a3f327e',1545842486);"
-"INSERT INTO blocks VALUES(555599,X'57d5fe522bf3883393a94c4d0e075784d2aec8916a530e000000000000000000',1392432471,X'fb8ae2240894ce79a304f1117a6e8db23459cef614dd9721a14cc58f59081172',1545843504);"
-"INSERT INTO blocks VALUES(555600,X'd83f5271da31d2d4f09ea1a93e11e6ee6f48ec9123ef0a000000000000000000',1901215704,X'1a09b01f706273ece29c7d3444b732e7b43e95fd1aa99fc986430aa71e21ef48',1545843830);"
-"INSERT INTO blocks VALUES(555601,X'e9d79dbfd5ac266d046a85feaacb9d750e231754600f00000000000000000000',-1080174615,X'ef359bbae9d658399feacd7b0c77b8f245e348a736aa6e683307d0eca3c13243',1545843940);"
-"INSERT INTO blocks VALUES(555602,X'c372e00db09d20abfd2b9db643e05e08a6c3c22da3fd32000000000000000000',232813251,X'daa202440043a7afc5b45d89b6a048aeda1d4d724d56e4d7f73e67bdc8e26921',1545844772);"
-"INSERT INTO blocks VALUES(555603,X'63c3fc3c0e2659fe463741a075b99b14d69c49947ffe1b000000000000000000',1023198051,X'833898f142398aec8fc6ff337394ed0e63fbfe2ef1e5250621ad5952a720a85d',1545844781);"
-"INSERT INTO blocks VALUES(555604,X'e28f9bc9106e7a6dffc779c290d5b8ce2a1ed91afc6c09000000000000000000',-912551966,X'f66c244eaef953175a04be92a4bc363a385b7f8febe2ac2d4af2dce7501ba882',1545845878);"
-"INSERT INTO blocks VALUES(555605,X'a657dec31aed9f7530243a2bff0bd39cd6a136cf463d25000000000000000000',-1008838746,X'ea21d99b50c19a9c9a861c02c24a2ac2088a750e9caf90c65ca19deae939168d',1545846570);"
-"INSERT INTO blocks VALUES(555606,X'853f0ad46eccfcbf15db7542c469fc91dd96f76ebeeb0b000000000000000000',-737525883,X'ae90acbbf7ef744fa8136a743402d56ae1725f2281dbcd1051661b597d41e1d5',1545846645);"
-"INSERT INTO blocks VALUES(555607,X'df7167750c1d567af00cfc3204ec0f2dadcc706b449e21000000000000000000',1969713631,X'ed7886807ec9f4ded29c03c504f8807e86995a830f6982c947e17a9e5f564f0b',1545846689);"
-"INSERT INTO blocks VALUES(555608,X'e5fe58c61e8c9e5b9361f4f78d666924042cfcdad99536000000000000000000',-967246107,X'56c1bac0bc1016c0b06ae2c3a97545f3705b1492f4871251fcb0e7a9ac4f5c8f',1545847492);"
-"INSERT INTO blocks VALUES(555609,X'69df0bbbd779d9a264ddcd0a343db80dbbf844a04b7a25000000000000000000',-1156849815,X'62e1359ce49ae2f2407a2a14189360bfd9d76a7787250bf648c5d7f4ef3bd427',1545847887);"
-"INSERT INTO blocks VALUES(555610,X'c27adb3d4cc39194a2fba2b184f45dde847dca064cbf29000000000000000000',1037793986,X'3709a8640aa8ffacbab2654b2391d66d4ca1846ef81b6113944b5dbe2ba7c58d',1545848210);"
-"INSERT INTO blocks VALUES(555611,X'e8d9912675cbf9c20fdd387fc25ba81d0064ac8dede809000000000000000000',647092712,X'0587f5b8d2adc11f6ae06ead6c6b66c9184cde7324b6651b88f6ec8454288bfd',1545848324);"
-"INSERT INTO blocks VALUES(555612,X'8bbcc8ec55c652bbfd4065a2f15fa6cf9ddfb6edd01a27000000000000000000',-322388853,X'5c9b8356d5e09015474927f35b183054e904ced845e494d7fe6ef8eec0022fdf',1545848670);"
-"INSERT INTO blocks VALUES(555613,X'27bfab599781ab2d7d447761d93659e2d6ef9a154bdc08000000000000000000',1504427815,X'1e0038401bfc57961a7bd693751bf2ddeabc397a9735f2f72bb12adc49a0fb76',1545848863);"
-"INSERT INTO blocks VALUES(555614,X'80103be6478b083a7d18eaefcbbbc03de135eee5574a32000000000000000000',-432336768,X'2526830288ede69077f00b9d424761c9b0ac50ca40479c5587e28d22cac5a740',1545849160);"
-"INSERT INTO blocks VALUES(555615,X'2f5cf291bc0a7e4dabe87f618083ddf1cc1b19990d5221000000000000000000',-1846387665,X'edda63043c572d076fef73677290b7ae536512327ae06dd73a94212b4b9bd653',1545851819);"
-"INSERT INTO blocks VALUES(555616,X'08a83b83f4b2136857a8bcce10653f25c4608783d43201000000000000000000',-2093242360,X'9f7c6aa00904a8bde9263b897ee16ec898621749e8c24580d3b60d7e8409eaf9',1545852272);"
-"INSERT INTO blocks VALUES(555617,X'ad850a1baf8905d99445518fb3b17b855159723a397d18000000000000000000',453674413,X'1fda6f45d5a18760b8d5d41198e239e29b8835020de7d175ef227d5977b6362f',1545852344);"
-"INSERT INTO blocks VALUES(555618,X'07b5fb7f93eb49e8ef75c5998ef57c91a3bc9c92524d22000000000000000000',2147202311,X'a9dcb5e3769f9a76b9b753b130a270166bb11035c786bec9d08c5fecd7a47d14',1545852561);"
-"INSERT INTO blocks VALUES(555619,X'3cc7c10435d324f6e2edd6507291710ea88732732a9912000000000000000000',79808316,X'e4316305dfa4d64f794e0ab4d8ab47001187aa06b471207216ca3d2929f7df62',1545852677);"
-"INSERT INTO blocks VALUES(555620,X'a5ee776b768144d4cf4135b1ab5eeffc63ca2843230422000000000000000000',1803021989,X'30ffc60bc5de98bcc05e19c3f6882b694eb790a6b3440b272ba7f165c718a951',1545852886);"
-"INSERT INTO blocks VALUES(555621,X'b4510162c1227da9afe3c4e550693fb331daa67bbcf00b000000000000000000',1644253620,X'dc50f6f23a5f29d6ec84268ab6dae1466aa8ad3c250ffbdaf5aed65fab4683c5',1545853569);"
-"INSERT INTO blocks VALUES(555622,X'41206fc41d94a8bf20789cee4cad814b8e88144a243f21000000000000000000',-999350207,X'cdbfcae571962810229eeba0b3a9e201a8c544565b8cb48bf38652299904bcac',1545853574);"
-"INSERT INTO blocks VALUES(555623,X'42932f3f172aeb2367a51bb34fa5a1a9ae68c82976a508000000000000000000',1060082498,X'9f53c996c0072f90d27ec25505f18b76ade8dd58f7d23c098256abe2876a7603',1545853967);"
-"INSERT INTO blocks VALUES(555624,X'10c705146a6b068c57785c6c1225e94c3f109699de5f36000000000000000000',335922960,X'83ab6963d02a4de5d1238c0406b4f3af28cde2564a832c0034d5b232df0a4514',1545855480);"
-"INSERT INTO blocks VALUES(555625,X'4f51b333c69bce2f2e6519ae7a030ebda3a3b543f5bd1a000000000000000000',867389775,X'0ff676c795d44a43b69e9378f7f9c215539cd60aba989726c5499aa327caf4df',1545856012);"
-"INSERT INTO blocks VALUES(555626,X'5a3f2481df80d79e380329de396ccf81b35fc2ccfca82e000000000000000000',-2128330918,X'00d7ee744e97e3ae70ae5d4b63c045b774ccb396465a820ac825e12bf2e7d03b',1545856427);"
-"INSERT INTO blocks VALUES(555627,X'8948c274dc12870b7af6db975290aa5921b3a4c378731e000000000000000000',1958889609,X'4f72560180f8ba2544cbff4c8b28ae912bbb5c967dfe21e24d40865baa0dff16',1545856571);"
-"INSERT INTO blocks VALUES(555628,X'df57c19a1018ddbcdb0d21d0c204a3ee8ffd1bcc38a201000000000000000000',-1698605089,X'fa5c3a5bdfb5910fb9794f0d55738f3be2d56e198a1367ede70acc034ef6ceac',1545857037);"
-"INSERT INTO blocks VALUES(555629,X'f2ecfb080b9a479217814faae1bf9abb34449fe0186d2a000000000000000000',150727922,X'239091c0082ba81b93e9a03c38cdc4128c56a457982fbff926b53aaaeac2d01a',1545857702);"
-"INSERT INTO blocks VALUES(555630,X'123cf4b7c87eb9a8d37b3e54bc2025451b28f5edaaaf0d000000000000000000',-1208730606,X'657a82fe772ba56253089e392fad279eac05af088849c2d85ddcd036906cbcc7',1545857795);"
-"INSERT INTO blocks VALUES(555631,X'7b2395f3f2c6b2cd6589a6f648cd70f6dde53152db7833000000000000000000',-208329861,X'b6dfb6cd30ad1bf5a3802f0005f2efb218a858aa7f45882dad7db377a3284f26',1545858620);"
-"INSERT INTO blocks VALUES(610000,X'f7b77276c19463535403c12240a9e0da48db747f606f0a000000000000000000',1987229687,X'21a22bc33282d72bf7837d014d1024e002f94b157dfc4230827fd771bcbe9b2f',1577447627);"
-"INSERT INTO blocks VALUES(610557,X'4f08d48b712cfcbb9c30c4f48dc63c8e89ce92d6c79211000000000000000000',-1949038513,X'afd461c759bcab4586e663aee76667bd83eefb1c9684be83f002834611f7cc23',1577758959);"
-"INSERT INTO blocks VALUES(610558,X'a56e665b741d24f47d27c2082c147f82b511aa5cddde08000000000000000000',1533439653,X'02e5354426317f206bc90a959823f0a85d97e2afa5fb8af4c1af60fe22847c41',1577759376);"
-"INSERT INTO blocks VALUES(610559,X'f8a7a458bc066c9afef42d2575da4d74c85f382f75c509000000000000000000',1487185912,X'30c1b01cc1bc7cb67d64e039036226b3e9f4705fcfc1d053f5113eff3e823d82',1577761802);"
-"INSERT INTO blocks VALUES(610560,X'7cad99d78b64b9efd82132ef0e05876ddadd0c50911702000000000000000000',-677794436,X'622eef2ee2a15fde199eb13b888272d0410e92e717e017c08699610b036a2aee',1577761818);"
-"INSERT INTO blocks VALUES(610561,X'a6e7ddc58c972ecabd6951d6affb9374e70529b04ecc0f000000000000000000',-975312986,X'9cea5e975be64dd24ab29e7fe6c2418a91428602fbae2631da04176eda978b76',1577762551);"
-"INSERT INTO blocks VALUES(610562,X'abac1b6e670fe2932ca750e6338b4c1d1a5f32f21cac01000000000000000000',1847307435,X'492d141cc7458b3e00b9bfa03757c3b9167aac5bce2fca556ff4676323ecc66d',1577764113);"
-"INSERT INTO blocks VALUES(610563,X'977cce5c2a992871312c672e5d07f8eb032ceeb5695011000000000000000000',1557036183,X'79932c9f77a77c69833e34715576352dff7a4111d7a7c7ebd8d673d3f0730c06',1577764448);"
-"INSERT INTO blocks VALUES(610564,X'ae7941bac424862494d9dddf56b358a8bbacc80987040c000000000000000000',-1170114130,X'a701b794ae70279825111a5382991c335ec13bd6aebbbc23b4be7c92a2bb65a0',1577764597);"
-"INSERT INTO blocks VALUES(610565,X'0b2b0a81fff5e8286c4a331ca2d01340b1936365553d08000000000000000000',-2130040053,X'86f1da253a7210d9b081c8fabd21bf32a82701a1735f6d91f13f65111a1db416',1577765048);"
-"INSERT INTO blocks VALUES(610566,X'202938ab29509af9104f8e597626db7cd203403a151f02000000000000000000',-1422382816,X'7bafbff406ed3a054834510b3dc08b00292f68115c898ce8a43df2c1093becaa',1577765311);"
-"INSERT INTO blocks VALUES(610567,X'c1c4bf2685b91b18b5e3f65254fa0ac4d831de62e1a715000000000000000000',650101953,X'0395d6790f8a226ef9e62232c84eb75b6b68e29a1dce03aa623c63d6862e444b',1577765324);"
-""
-""
-"COMMIT;"
-"";
@@ -0,0 +1,1734 @@
+// Generated by test/checkpoint_generator.c, see Checkpoints.h for the layout
+static const unsigned char initialCheckpoints[] = {
+    0x42, 0x53, 0x43, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x07, 0x00, 0x00, 0x63, 0x97, 0xbb, 0x6a,
+    0xbd, 0x4f, 0xc5, 0x21, 0xc0, 0xd3, 0xf6, 0x07, 0x1b, 0x56, 0x50, 0x38, 0x9f, 0x0b, 0x45, 0x51,
+    0xbc, 0x40, 0xb4, 0xe6, 0xb0, 0x67, 0x30, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x3d, 0xf1,
+    0x18, 0x5e, 0x16, 0x2e, 0xe9, 0x2d, 0x03, 0x1f, 0xe2, 0x1d, 0x14, 0x00, 0xff, 0x7d, 0x70, 0x5a,
+    0x3e, 0x9b, 0x9c, 0x86, 0x0e, 0xea, 0x85, 0x53, 0x13, 0xcd, 0x8c, 0xa2, 0x6c, 0x08, 0x7f, 0x49,
+    0x00, 0x00, 0x00, 0x00, 0xbe, 0x0f, 0x00, 0x00, 0x0d, 0x9c, 0x8c, 0x96, 0x71, 0x57, 0x56, 0xb6,
+    0x19, 0x11, 0x6c, 0xc2, 0x16, 0x09, 0x37, 0xfb, 0x26, 0xc6, 0x55, 0xa2, 0xf8, 0xe2, 0x8e, 0x3a,
+    0x0a, 0xff, 0x59, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf6, 0x8d, 0x55, 0x07, 0x10, 0x2f, 0x56,
+    0x60, 0xd8, 0x29, 0xac, 0x4f, 0x1d, 0xa2, 0xe6, 0xe2, 0xd4, 0xb1, 0xa0, 0x61, 0x20, 0xa3, 0x22,
+    0xcc, 0x06, 0xd3, 0xcc, 0xdb, 0x4b, 0x85, 0xbb, 0x0b, 0x71, 0x94, 0x49, 0x00, 0x00, 0x00, 0x00,
+    0x9d, 0x17, 0x00, 0x00, 0xa8, 0xe0, 0xcb, 0x8a, 0xb9, 0x9b, 0x57, 0xcb, 0x33, 0xbe, 0xc7, 0xb4,
+    0x28, 0x28, 0xa3, 0x29, 0xb6, 0xa8, 0x34, 0xe3, 0x40, 0x0e, 0x69, 0xef, 0x6e, 0xfd, 0xa4, 0xd6,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0x8d, 0x46, 0x46, 0x68, 0x0e, 0xa3, 0x51, 0x22, 0x29, 0xbb, 0xdd,
+    0x3f, 0xb8, 0xfc, 0xcc, 0x44, 0x4c, 0x64, 0xf9, 0x75, 0x50, 0x6f, 0xc4, 0x94, 0x4d, 0xeb, 0x59,
+    0xa8, 0xcb, 0x60, 0xb5, 0xca, 0x4d, 0xab, 0x49, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x1f, 0x00, 0x00,
+    0xf6, 0xef, 0x68, 0xf7, 0x11, 0xa4, 0x0a, 0x2c, 0x9a, 0xcc, 0x86, 0x70, 0xc1, 0x84, 0x46, 0x49,
+    0xae, 0x5d, 0x9b, 0xe6, 0x45, 0x54, 0xa2, 0xb3, 0x50, 0xe4, 0x96, 0xbc, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x6b, 0x65, 0x70, 0x79, 0x6f, 0xb7, 0x39, 0xae, 0x11, 0xb7, 0x83, 0x85, 0xb0, 0x69, 0x96,
+    0x80, 0x46, 0xb6, 0xd8, 0x4b, 0x54, 0x15, 0x14, 0xc2, 0xec, 0x3b, 0x5b, 0x74, 0x08, 0x44, 0xe1,
+    0xc0, 0xd7, 0xc2, 0x49, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x27, 0x00, 0x00, 0x96, 0xd4, 0x71, 0x0a,
+    0x3d, 0x7b, 0x04, 0xb0, 0x10, 0xde, 0xf9, 0xbe, 0xaf, 0x79, 0x87, 0x8d, 0x76, 0xe8, 0x81, 0xe6,
+    0x62, 0x60, 0x08, 0x48, 0x3e, 0x68, 0xf5, 0x77, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xac, 0x10, 0x98,
+    0xbc, 0x8f, 0x1f, 0x93, 0xf3, 0x4f, 0x37, 0x89, 0x55, 0xbd, 0x8b, 0xea, 0x38, 0x52, 0x1c, 0xd5,
+    0x7f, 0xb4, 0x4a, 0x07, 0xfb, 0xd5, 0xac, 0x42, 0xd5, 0x15, 0xa7, 0x3d, 0xc9, 0x6d, 0xda, 0x49,
+    0x00, 0x00, 0x00, 0x00, 0x3a, 0x2f, 0x00, 0x00, 0xbe, 0x6e, 0x39, 0x12, 0xec, 0x73, 0x87, 0x3b,
+    0x38, 0xf3, 0x4e, 0x01, 0x90, 0x8f, 0x07, 0x35, 0x94, 0xc9, 0x90, 0x46, 0xab, 0x4d, 0xcd, 0xa1,
+    0xc5, 0x6b, 0x8e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xa4, 0x5f, 0x7f, 0x96, 0x11, 0x37, 0xdf,
+    0x7e, 0xe6, 0xc8, 0xc7, 0xb8, 0x74, 0xb5, 0x51, 0x25, 0xcd, 0xa3, 0x3e, 0xa5, 0x4c, 0x0a, 0x41,
+    0xa6, 0xf9, 0x9a, 0x9f, 0xd4, 0x9d, 0xd9, 0xa1, 0xa9, 0xf8, 0xf1, 0x49, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x37, 0x00, 0x00, 0xff, 0x01, 0x8a, 0xd6, 0x5f, 0x77, 0x68, 0xb9, 0x53, 0x50, 0xab, 0x2e,
+    0xd0, 0x34, 0xbd, 0xc6, 0xb7, 0x0f, 0x14, 0x4c, 0xa9, 0x8a, 0x6b, 0x21, 0xc3, 0x68, 0x77, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0xec, 0x00, 0x0f, 0xb0, 0xc0, 0x1c, 0xe4, 0x53, 0x38, 0xdd, 0x2a, 0x29,
+    0xab, 0x0e, 0x14, 0x50, 0x15, 0x84, 0x3f, 0x89, 0xaa, 0x7e, 0x5e, 0x4b, 0xff, 0xb8, 0xed, 0x90,
+    0x8d, 0xeb, 0x4b, 0x0d, 0x46, 0xda, 0x08, 0x4a, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3e, 0x00, 0x00,
+    0x04, 0x81, 0xd2, 0x4a, 0xa9, 0x31, 0x22, 0x88, 0xdd, 0x96, 0x4e, 0xfc, 0x24, 0xce, 0x16, 0xc0,
+    0x3b, 0x22, 0x78, 0x25, 0x35, 0xed, 0xd4, 0x5a, 0x9f, 0x60, 0xd9, 0x9b, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0xec, 0xc6, 0xd0, 0xdf, 0x24, 0xca, 0xdc, 0xed, 0x78, 0xe1, 0xb0, 0x8d, 0xd6, 0x5b, 0x21,
+    0x86, 0x6c, 0x5e, 0x2d, 0x6d, 0x18, 0x3a, 0x6a, 0x35, 0xb2, 0x9e, 0xb9, 0x10, 0x76, 0x39, 0x99,
+    0x17, 0xcb, 0x21, 0x4a, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x46, 0x00, 0x00, 0xc0, 0xe8, 0xb3, 0x88,
+    0xb0, 0x95, 0x93, 0xad, 0xa5, 0x72, 0x6f, 0xf3, 0xb3, 0xab, 0x91, 0x8a, 0x1f, 0x66, 0xdd, 0xfb,
+    0xf2, 0x03, 0x19, 0x75, 0x3f, 0x37, 0x2b, 0x42, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x30, 0x3d, 0x0c,
+    0xb9, 0xcb, 0x1a, 0x72, 0x23, 0xe2, 0x06, 0x6e, 0x54, 0x73, 0x7a, 0x57, 0x79, 0xb3, 0xec, 0xf2,
+    0x61, 0x13, 0xa4, 0xbc, 0x3e, 0xb3, 0xea, 0xcb, 0xb8, 0x6e, 0xf2, 0x23, 0x03, 0x1b, 0x45, 0x4a,
+    0x00, 0x00, 0x00, 0x00, 0xb6, 0x4e, 0x00, 0x00, 0x25, 0x49, 0x62, 0xb2, 0xeb, 0x68, 0x09, 0x8f,
+    0xc2, 0xd5, 0xb9, 0xad, 0xd0, 0x94, 0x8e, 0x92, 0xbe, 0xf8, 0xe4, 0xbd, 0x66, 0xba, 0xb3, 0x73,
+    0xe7, 0x33, 0xe4, 0x17, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x89, 0x1c, 0x57, 0xfd, 0x09, 0x73, 0x95,
+    0x33, 0x30, 0xcf, 0x55, 0x17, 0x94, 0x59, 0x52, 0x5a, 0xa1, 0xd0, 0x13, 0xb4, 0xcf, 0xf1, 0x01,
+    0xe7, 0x77, 0x54, 0x2b, 0x9d, 0xfd, 0x3c, 0xf8, 0x30, 0x36, 0x6a, 0x4a, 0x00, 0x00, 0x00, 0x00,
+    0x95, 0x56, 0x00, 0x00, 0x79, 0x47, 0x27, 0xc6, 0xf8, 0xda, 0x01, 0x33, 0x68, 0x7a, 0x5b, 0xd0,
+    0xdf, 0x64, 0xf8, 0xc2, 0x19, 0x4d, 0x90, 0x63, 0xf8, 0x98, 0x31, 0x08, 0x16, 0xf3, 0x9c, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x2d, 0x25, 0xe3, 0x4a, 0xd1, 0x17, 0x56, 0x73, 0x71, 0x57, 0x3b, 0x96,
+    0x16, 0x5b, 0x35, 0xda, 0xc1, 0x50, 0x0c, 0x1f, 0xba, 0x9a, 0x31, 0x91, 0x50, 0x3f, 0x84, 0x85,
+    0x79, 0xe5, 0x40, 0xcd, 0xd0, 0xcd, 0xa0, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x74, 0x5e, 0x00, 0x00,
+    0x42, 0x8c, 0x4c, 0x7b, 0xeb, 0x02, 0xd9, 0xea, 0x35, 0x22, 0x63, 0x33, 0x5d, 0x83, 0xbd, 0xef,
+    0x5e, 0x2f, 0xbc, 0xf7, 0x8b, 0x06, 0x0c, 0xed, 0xa9, 0x54, 0xb9, 0xd9, 0x00, 0x00, 0x00, 0x00,
+    0x85, 0x14, 0x52, 0xc1, 0x7c, 0xe1, 0x69, 0xe9, 0x50, 0xb7, 0x7a, 0xf8, 0xcc, 0xd0, 0x57, 0xf4,
+    0xb5, 0x31, 0xc6, 0xc6, 0xa8, 0x87, 0x6a, 0x05, 0xc6, 0x9e, 0x45, 0x61, 0x4c, 0x14, 0xe0, 0xb0,
+    0xde, 0x40, 0xc5, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x53, 0x66, 0x00, 0x00, 0xce, 0x04, 0xcc, 0xd4,
+    0x87, 0xd9, 0x3c, 0x9d, 0x9e, 0x60, 0x9b, 0x28, 0x11, 0x7f, 0x47, 0x5b, 0xa6, 0xa5, 0x4a, 0xbf,
+    0x2d, 0x9e, 0xe6, 0x09, 0xab, 0xbf, 0x90, 0x12, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x35, 0xec, 0x05,
+    0x05, 0x07, 0x02, 0xd1, 0x72, 0x1f, 0xdc, 0x42, 0x97, 0x23, 0x84, 0x54, 0x78, 0x00, 0x33, 0x48,
+    0x27, 0x89, 0x8f, 0x2f, 0x60, 0x0b, 0x07, 0xf4, 0x6c, 0xb4, 0xd3, 0xb7, 0xd2, 0xcc, 0xeb, 0x4a,
+    0x00, 0x00, 0x00, 0x00, 0x32, 0x6e, 0x00, 0x00, 0xed, 0xbc, 0x04, 0x6c, 0x7f, 0xd0, 0xb5, 0x1b,
+    0x8a, 0xa9, 0xda, 0x72, 0xc3, 0x70, 0x11, 0x5a, 0x19, 0xc3, 0x42, 0xb9, 0x54, 0x80, 0x0a, 0xb5,
+    0xe3, 0x15, 0xfa, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xde, 0xf3, 0x41, 0x45, 0xf3, 0x80, 0x4a,
+    0xd2, 0x65, 0x22, 0x9f, 0xfd, 0x0c, 0x23, 0x44, 0x32, 0xf6, 0x89, 0x2c, 0xeb, 0x46, 0x59, 0x03,
+    0x6c, 0x82, 0xaa, 0x8b, 0xd0, 0xc7, 0x1e, 0xd6, 0x93, 0x04, 0x10, 0x4b, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x76, 0x00, 0x00, 0xb2, 0x90, 0x06, 0x57, 0x95, 0xa8, 0xd6, 0x57, 0x25, 0xf8, 0xce, 0x23,
+    0x38, 0xb7, 0x86, 0x1c, 0x89, 0xb0, 0x66, 0x22, 0x16, 0xf9, 0xf6, 0x03, 0x0f, 0xd3, 0x59, 0xa7,
+    0x00, 0x00, 0x00, 0x00, 0x8c, 0x74, 0x50, 0xe4, 0x67, 0x49, 0xd0, 0xde, 0x92, 0x38, 0xe0, 0xb5,
+    0x7d, 0xef, 0xd4, 0x4c, 0xd3, 0x0b, 0xe2, 0xcf, 0x06, 0x6f, 0x0b, 0x38, 0xe9, 0x44, 0xad, 0xa9,
+    0x4b, 0xde, 0x16, 0xbb, 0x70, 0x27, 0x2b, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x7d, 0x00, 0x00,
+    0x93, 0xb7, 0x76, 0xe9, 0x83, 0x0e, 0x4a, 0x14, 0x01, 0x2b, 0x5a, 0xab, 0x66, 0x1b, 0x64, 0x4f,
+    0x0b, 0x2e, 0x36, 0x07, 0xcd, 0xc7, 0xa0, 0x07, 0x22, 0x00, 0xca, 0xa4, 0x00, 0x00, 0x00, 0x00,
+    0xab, 0x51, 0x4d, 0x9e, 0xa8, 0xb2, 0x85, 0xe3, 0x5d, 0x30, 0xa7, 0x7f, 0x20, 0xd7, 0x82, 0x8e,
+    0xd7, 0x9f, 0xbd, 0xfc, 0x1e, 0xfc, 0x3d, 0xf4, 0xa7, 0xb0, 0x10, 0x84, 0x32, 0x97, 0x0f, 0x7d,
+    0x94, 0xc8, 0x3a, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x85, 0x00, 0x00, 0xb1, 0x84, 0xcd, 0xaa,
+    0x6f, 0x01, 0x13, 0x4b, 0x05, 0xa3, 0xfe, 0xdf, 0x8e, 0xf0, 0x3e, 0x7d, 0x68, 0x93, 0x67, 0xb7,
+    0xdf, 0xdb, 0x0d, 0x29, 0x4c, 0x4d, 0x24, 0x32, 0x00, 0x00, 0x00, 0x00, 0x93, 0xb0, 0x6c, 0x4f,
+    0xf7, 0x87, 0x35, 0x8c, 0x3a, 0xd2, 0xf3, 0x59, 0xa9, 0x35, 0xc0, 0xec, 0x2a, 0x36, 0xcb, 0x66,
+    0x0a, 0xc7, 0x1c, 0xbb, 0x34, 0xe3, 0x16, 0x7d, 0x86, 0xa8, 0x03, 0xa8, 0x3e, 0x89, 0x4b, 0x4b,
+    0x00, 0x00, 0x00, 0x00, 0xae, 0x8d, 0x00, 0x00, 0x3a, 0x31, 0xc5, 0xe0, 0x84, 0xed, 0xc9, 0x2d,
+    0x1f, 0x53, 0xc8, 0x6c, 0x5b, 0xbb, 0x65, 0xaa, 0x7a, 0x0b, 0x97, 0xeb, 0x91, 0x5d, 0x76, 0x78,
+    0x17, 0xfd, 0xa6, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb9, 0xbc, 0xeb, 0x78, 0xd1, 0x6d, 0xcb,
+    0x5a, 0xf9, 0xd7, 0xe4, 0xbf, 0xac, 0x06, 0x27, 0x65, 0x72, 0xce, 0x67, 0x77, 0x1a, 0x0e, 0xc0,
+    0xdd, 0x9f, 0x1a, 0xd2, 0xf8, 0x34, 0x20, 0x00, 0x18, 0x80, 0x5d, 0x4b, 0x00, 0x00, 0x00, 0x00,
+    0x8d, 0x95, 0x00, 0x00, 0x37, 0x8b, 0xd2, 0x73, 0x04, 0xc8, 0x40, 0xca, 0x1e, 0x00, 0xd5, 0x2f,
+    0xf2, 0xf1, 0x95, 0x51, 0x14, 0xeb, 0xff, 0x43, 0xab, 0x82, 0x42, 0xd8, 0xce, 0x43, 0xf3, 0x73,
+    0x00, 0x00, 0x00, 0x00, 0xdd, 0xc8, 0x78, 0x06, 0x40, 0x5e, 0x6a, 0x33, 0x2a, 0xad, 0x76, 0x3e,
+    0xf2, 0x8a, 0x72, 0x08, 0x74, 0x6b, 0x79, 0x04, 0x2a, 0x0e, 0x6c, 0xf7, 0x72, 0x12, 0xfd, 0x07,
+    0xc5, 0x0a, 0x03, 0xb5, 0x28, 0x2a, 0x6b, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x9d, 0x00, 0x00,
+    0x42, 0x02, 0xee, 0xd4, 0xce, 0x81, 0x48, 0x2a, 0xf6, 0xf4, 0x5a, 0xfd, 0x06, 0x34, 0xcd, 0xf5,
+    0xa4, 0xa7, 0x99, 0xbf, 0xa1, 0xfe, 0x38, 0x2c, 0x7d, 0x34, 0x20, 0x29, 0x00, 0x00, 0x00, 0x00,
+    0xbe, 0x7e, 0x1c, 0xcd, 0x13, 0x75, 0x21, 0xab, 0x15, 0xaa, 0xfd, 0x73, 0x25, 0x4f, 0xd3, 0xaf,
+    0x89, 0xd5, 0x43, 0xcb, 0x24, 0xdc, 0xf4, 0xa5, 0xcf, 0x6c, 0x34, 0x51, 0x66, 0x9f, 0xc2, 0xb0,
+    0x62, 0x64, 0x78, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xa5, 0x00, 0x00, 0x03, 0x39, 0x2f, 0xd6,
+    0x88, 0xa9, 0x59, 0x5c, 0xd1, 0x5e, 0x57, 0x90, 0xa9, 0x90, 0xb3, 0x03, 0x94, 0x6c, 0x9f, 0x20,
+    0xf1, 0x96, 0x8b, 0xf1, 0x7c, 0x67, 0x24, 0x52, 0x00, 0x00, 0x00, 0x00, 0x76, 0xca, 0xd9, 0x61,
+    0xb3, 0x84, 0xf3, 0xcf, 0x85, 0x9e, 0x58, 0x0a, 0x9c, 0x05, 0x3b, 0x76, 0xa1, 0x00, 0x40, 0x9d,
+    0xad, 0x12, 0x6f, 0x9c, 0x41, 0x28, 0x54, 0xea, 0xe3, 0xef, 0xe7, 0x9a, 0x8c, 0xb3, 0x84, 0x4b,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0xad, 0x00, 0x00, 0x90, 0xe6, 0xd7, 0x41, 0xfb, 0xd3, 0x66, 0x77,
+    0x87, 0x81, 0x3f, 0x0a, 0xda, 0x32, 0x6c, 0x0e, 0x85, 0x19, 0x3f, 0xa5, 0x29, 0x3b, 0x43, 0x10,
+    0x98, 0x86, 0x5a, 0x30, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x57, 0x77, 0x4e, 0xcc, 0x4c, 0xe6, 0x46,
+    0x09, 0x53, 0xf9, 0x80, 0x4e, 0xde, 0x8d, 0xca, 0x2d, 0x3d, 0xec, 0xb6, 0x1b, 0x29, 0xd9, 0xcf,
+    0x52, 0x7a, 0x79, 0x66, 0xa2, 0x70, 0xf6, 0xc7, 0x9d, 0x25, 0x94, 0x4b, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xb5, 0x00, 0x00, 0x4a, 0x59, 0xcd, 0x5a, 0x6f, 0x04, 0x74, 0x15, 0xd9, 0x27, 0xbf, 0x65,
+    0x50, 0x87, 0xf3, 0x2d, 0xdc, 0xb7, 0x2e, 0xa1, 0xc5, 0xd9, 0x48, 0xdf, 0xaf, 0xe0, 0x79, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x34, 0x03, 0x18, 0x17, 0xad, 0x62, 0x07, 0x49, 0xe8, 0x95, 0xf9,
+    0x58, 0xf8, 0x91, 0x88, 0xc5, 0xea, 0xa0, 0x4e, 0xbf, 0xc6, 0x98, 0x3a, 0x03, 0xae, 0x3f, 0x72,
+    0x6a, 0x41, 0xa3, 0x5d, 0x52, 0x84, 0xa6, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xbc, 0x00, 0x00,
+    0x65, 0x80, 0x31, 0xac, 0x57, 0x43, 0x36, 0xbe, 0x1a, 0x64, 0x5b, 0xfd, 0x87, 0x31, 0xd1, 0x90,
+    0x45, 0x5a, 0x32, 0xfa, 0x6f, 0x5e, 0x1c, 0xf3, 0x7e, 0x2c, 0xc9, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0xde, 0x3b, 0x58, 0x1d, 0x8e, 0x7c, 0x75, 0x88, 0xa2, 0x62, 0xb5, 0x8e, 0x1a, 0xbc, 0xbd, 0x32,
+    0x0d, 0xb3, 0x94, 0x38, 0x2e, 0xaf, 0x49, 0xd9, 0x1a, 0xd4, 0x49, 0x6a, 0x47, 0x44, 0x29, 0x40,
+    0x61, 0x5a, 0xb4, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xc4, 0x00, 0x00, 0x8e, 0xac, 0xb1, 0x80,
+    0xdd, 0x60, 0x1a, 0x0a, 0xd3, 0xeb, 0x70, 0xf5, 0x9d, 0x54, 0x13, 0xe3, 0xd8, 0x26, 0xa6, 0xab,
+    0x00, 0xb2, 0xd4, 0x5d, 0xa4, 0x1b, 0x0d, 0x26, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xb6, 0x15, 0x6b,
+    0xff, 0xa2, 0x64, 0xf8, 0x61, 0x2d, 0x59, 0xc9, 0xa7, 0xaa, 0xce, 0x06, 0xb1, 0xc4, 0x93, 0xc0,
+    0x91, 0x7b, 0x11, 0x3e, 0x86, 0xdf, 0xef, 0x09, 0x93, 0xc8, 0xf8, 0x96, 0x02, 0xb9, 0xc2, 0x4b,
+    0x00, 0x00, 0x00, 0x00, 0xa6, 0xcc, 0x00, 0x00, 0xaf, 0x13, 0xd9, 0x1e, 0xbc, 0x17, 0x57, 0x1f,
+    0x06, 0x6b, 0xcd, 0xbb, 0x3e, 0x7a, 0x05, 0xc1, 0x1b, 0x4d, 0xef, 0xb7, 0xae, 0xb6, 0xcd, 0x41,
+    0xbc, 0xfc, 0x19, 0x15, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x3d, 0xe2, 0x9a, 0x07, 0xf5, 0xc6, 0xb8,
+    0xf2, 0xe1, 0x85, 0xc7, 0xae, 0x0e, 0x02, 0x8d, 0xc0, 0x33, 0x6c, 0xaf, 0xa5, 0x4f, 0xa1, 0x0e,
+    0xf7, 0x8e, 0x35, 0xe2, 0x20, 0x99, 0xea, 0x7b, 0xc8, 0x57, 0xcf, 0x4b, 0x00, 0x00, 0x00, 0x00,
+    0x85, 0xd4, 0x00, 0x00, 0x45, 0xef, 0x14, 0x44, 0xe9, 0xac, 0xed, 0x98, 0x0f, 0x1e, 0xf1, 0xf1,
+    0x4f, 0x79, 0xaa, 0x41, 0xec, 0xa5, 0xd9, 0xcc, 0x4b, 0x38, 0x6f, 0x12, 0xc6, 0x6f, 0x86, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x3b, 0xc8, 0x02, 0xaf, 0x57, 0x56, 0xa6, 0x3e, 0x1d, 0x9c, 0x61, 0x4f,
+    0x2a, 0xa6, 0xfa, 0xb0, 0x8f, 0x05, 0x78, 0xdd, 0x65, 0xa8, 0xe4, 0xdc, 0xbd, 0x52, 0x96, 0xa1,
+    0x22, 0xd6, 0xe6, 0xed, 0x0d, 0xbc, 0xdf, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x64, 0xdc, 0x00, 0x00,
+    0x74, 0x65, 0x88, 0x51, 0x91, 0x79, 0xa7, 0xa3, 0x8e, 0xb5, 0xa0, 0x5f, 0x7c, 0xd7, 0x47, 0x1e,
+    0x1e, 0x57, 0xf7, 0xa1, 0x14, 0xd2, 0xcf, 0x66, 0x2c, 0x95, 0xae, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x2c, 0x63, 0xfe, 0xdd, 0x22, 0x0e, 0x25, 0x18, 0x89, 0xf5, 0x69, 0x0d, 0x09, 0x82, 0x8b, 0x96,
+    0x5b, 0x4c, 0xd3, 0xe2, 0x6b, 0x0b, 0xe6, 0xf6, 0xac, 0x62, 0xb5, 0x1e, 0x70, 0x61, 0xfc, 0x26,
+    0xc5, 0xad, 0xf3, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x43, 0xe4, 0x00, 0x00, 0x22, 0x79, 0x6a, 0x1b,
+    0x16, 0xad, 0x19, 0xf5, 0x3c, 0xfe, 0x6a, 0xf2, 0xcb, 0xb0, 0x3a, 0x69, 0x93, 0x35, 0x60, 0xde,
+    0x9c, 0xab, 0xf9, 0xf9, 0x79, 0x32, 0x4b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x70, 0x2d,
+    0xb8, 0x05, 0x60, 0xe2, 0x5b, 0x3f, 0x43, 0x36, 0x34, 0x15, 0xee, 0x94, 0x7d, 0x5a, 0xb2, 0xbe,
+    0x52, 0x3e, 0x27, 0x42, 0xed, 0x8c, 0x71, 0xf6, 0x21, 0xf5, 0x86, 0xaa, 0x50, 0xf4, 0x00, 0x4c,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0xec, 0x00, 0x00, 0x40, 0x24, 0xe6, 0xcb, 0x1d, 0xe1, 0xb6, 0x86,
+    0x68, 0x90, 0x92, 0xe7, 0x48, 0x10, 0x9a, 0xb9, 0xde, 0xff, 0x28, 0x55, 0xe2, 0x1f, 0x15, 0x98,
+    0x0c, 0xe9, 0xb5, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x59, 0x73, 0x7b, 0x05, 0x5e, 0xd9, 0x83, 0x4e,
+    0x85, 0x55, 0x5b, 0xf7, 0xbc, 0xcc, 0xcf, 0xd0, 0x2e, 0x07, 0x08, 0x26, 0x5c, 0x83, 0x36, 0xa9,
+    0x6f, 0xab, 0xa8, 0x58, 0xe1, 0xbd, 0x0e, 0x57, 0x03, 0x8c, 0x12, 0x4c, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xf4, 0x00, 0x00, 0x34, 0x52, 0xad, 0x4d, 0x65, 0x7c, 0xb3, 0xb0, 0x34, 0x5b, 0x2a, 0xcc,
+    0x47, 0x80, 0xd7, 0x36, 0xca, 0x79, 0xdd, 0xc2, 0x45, 0xef, 0xd6, 0x47, 0x6b, 0x77, 0x52, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0xa2, 0xab, 0xc6, 0xdf, 0xea, 0x3e, 0xa9, 0x45, 0xef, 0x91, 0x0f,
+    0xe2, 0x75, 0x69, 0xd3, 0x80, 0xe4, 0xb4, 0x61, 0x1c, 0xdb, 0xad, 0x50, 0x73, 0x67, 0xa5, 0x81,
+    0xa9, 0x3a, 0x93, 0x4b, 0x87, 0x23, 0x23, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfb, 0x00, 0x00,
+    0x04, 0x34, 0x71, 0x30, 0xa6, 0x08, 0x17, 0x6b, 0xc1, 0xab, 0xca, 0xa8, 0xad, 0xcb, 0xd2, 0x3e,
+    0xcf, 0x07, 0x80, 0x50, 0x74, 0x25, 0x75, 0xfa, 0xc3, 0x7a, 0xdc, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x75, 0xf4, 0x5d, 0xa0, 0xc5, 0x80, 0x5c, 0x89, 0x96, 0x52, 0x29, 0x5d, 0x8b, 0x0a, 0xef, 0xea,
+    0x5c, 0x36, 0xc2, 0x88, 0x02, 0xfc, 0x8f, 0x88, 0xd3, 0x43, 0x30, 0xb3, 0x12, 0x9d, 0x95, 0xc2,
+    0x08, 0x44, 0x32, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x03, 0x01, 0x00, 0xeb, 0xba, 0xa8, 0x76,
+    0xd7, 0x40, 0xf8, 0x7f, 0x2b, 0xf0, 0x0b, 0x1e, 0xd7, 0x68, 0x72, 0x3a, 0x80, 0xef, 0x3a, 0x78,
+    0x6f, 0xe1, 0x51, 0x42, 0x07, 0x3e, 0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x90, 0x1e, 0x22,
+    0xdc, 0xf4, 0xef, 0x92, 0x9c, 0xbd, 0xf9, 0x20, 0x25, 0x7c, 0xb0, 0x4a, 0x4b, 0xcb, 0x3b, 0xa0,
+    0x0a, 0xec, 0xa3, 0x54, 0x57, 0xe8, 0x33, 0x50, 0x35, 0xde, 0xda, 0xe0, 0x12, 0x14, 0x3c, 0x4c,
+    0x00, 0x00, 0x00, 0x00, 0x9e, 0x0b, 0x01, 0x00, 0xeb, 0x95, 0x4e, 0x28, 0xf3, 0x59, 0x08, 0x5e,
+    0x3b, 0xe4, 0x05, 0x60, 0xa8, 0x14, 0x3b, 0x4e, 0x6a, 0x0d, 0x78, 0x1a, 0x23, 0x3a, 0xc6, 0x80,
+    0xb3, 0xc2, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x34, 0x15, 0xf2, 0xa2, 0xe8, 0x27, 0xcd,
+    0x74, 0x24, 0xa2, 0xe6, 0x4e, 0x76, 0x6b, 0x43, 0x80, 0x2c, 0x9c, 0xb3, 0x79, 0xc6, 0x18, 0x61,
+    0xa3, 0xae, 0x7e, 0xa2, 0x70, 0x87, 0xf4, 0x7a, 0xf8, 0x79, 0x40, 0x4c, 0x00, 0x00, 0x00, 0x00,
+    0x7d, 0x13, 0x01, 0x00, 0xdd, 0x2e, 0xf2, 0x06, 0xa9, 0x46, 0x61, 0x7d, 0xc8, 0x1e, 0x25, 0xa7,
+    0x28, 0x56, 0x74, 0xa6, 0x8a, 0x4f, 0xa6, 0xaf, 0x62, 0xc7, 0xb9, 0x9e, 0x1a, 0x0a, 0x1e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x68, 0xd8, 0xc8, 0x43, 0xa3, 0xca, 0x04, 0x72, 0x15, 0x3b, 0x63,
+    0xf7, 0x06, 0x09, 0xe8, 0xb5, 0x84, 0x67, 0x46, 0xa5, 0xf9, 0xc2, 0x46, 0x88, 0x67, 0x05, 0x0a,
+    0x95, 0x69, 0x68, 0x89, 0x5a, 0xee, 0x4d, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x1b, 0x01, 0x00,
+    0x78, 0x14, 0xec, 0xec, 0x30, 0x22, 0xdb, 0x18, 0x3d, 0xd1, 0x26, 0xf9, 0x92, 0x93, 0x2d, 0xc6,
+    0xde, 0x98, 0x6d, 0xc0, 0x7a, 0xa5, 0x73, 0xc2, 0x85, 0xdb, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x79, 0x97, 0x12, 0xde, 0x52, 0xa0, 0x6e, 0x45, 0x48, 0xf2, 0xe8, 0x14, 0x46, 0x4b, 0x5a,
+    0xa1, 0xd2, 0x55, 0x2f, 0x9a, 0xba, 0x80, 0xf8, 0x61, 0x0f, 0x15, 0x76, 0xd0, 0xfc, 0x91, 0x3c,
+    0x10, 0xe9, 0x5a, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x23, 0x01, 0x00, 0x24, 0x25, 0x39, 0x05,
+    0xbd, 0xc0, 0x15, 0x08, 0xbf, 0x66, 0x83, 0x8a, 0x97, 0x81, 0xa5, 0xd6, 0x30, 0x56, 0x51, 0xad,
+    0xa6, 0x85, 0x62, 0x50, 0x24, 0x23, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe6, 0xc8, 0xee,
+    0x30, 0xba, 0x8d, 0x0a, 0x76, 0x4b, 0x39, 0xcf, 0xc4, 0xf2, 0x27, 0x3b, 0x97, 0x96, 0xc5, 0x76,
+    0xff, 0xd9, 0xa9, 0x1b, 0x97, 0xc2, 0x95, 0xe2, 0x66, 0xc1, 0x1f, 0x8b, 0x36, 0xa9, 0x67, 0x4c,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x2b, 0x01, 0x00, 0x4d, 0x66, 0x39, 0xd4, 0x2d, 0xac, 0xae, 0x4a,
+    0x71, 0x0f, 0x15, 0xe0, 0x50, 0x4d, 0x5e, 0x07, 0xc8, 0xca, 0x77, 0xb9, 0x59, 0x42, 0x37, 0xf4,
+    0xbd, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x8f, 0xec, 0x06, 0xc6, 0x8e, 0x42, 0xf9,
+    0x07, 0x29, 0xa1, 0x98, 0x68, 0x38, 0x03, 0x0a, 0x09, 0x0d, 0x25, 0x59, 0x28, 0x16, 0x66, 0x29,
+    0xeb, 0xca, 0x40, 0x9e, 0xd8, 0xf0, 0xf8, 0xbc, 0x98, 0xbc, 0x76, 0x4c, 0x00, 0x00, 0x00, 0x00,
+    0xf9, 0x32, 0x01, 0x00, 0x4d, 0x60, 0xf0, 0x0b, 0x1b, 0x60, 0x7e, 0xe7, 0xfc, 0x53, 0xf5, 0x35,
+    0x1a, 0xf2, 0xe2, 0x5e, 0x3e, 0x08, 0x57, 0x46, 0x4e, 0x8a, 0x84, 0xad, 0xe2, 0xab, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe4, 0x19, 0x62, 0xc7, 0x31, 0x2d, 0xd1, 0xc8, 0x86, 0xfd, 0x5d, 0x1d,
+    0xfb, 0xba, 0x96, 0xbc, 0x07, 0xfc, 0x27, 0xc4, 0x81, 0x4b, 0x59, 0x91, 0xcb, 0xb3, 0x9c, 0x27,
+    0xc2, 0x6e, 0x0a, 0x84, 0x96, 0xc0, 0x86, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x3a, 0x01, 0x00,
+    0x02, 0xa1, 0x38, 0x34, 0x6d, 0xe8, 0x10, 0x8d, 0x8b, 0x9b, 0xe7, 0x40, 0x80, 0x50, 0x07, 0x88,
+    0x14, 0x39, 0xbf, 0x9a, 0x0f, 0x12, 0xd5, 0xc5, 0x5b, 0x38, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x51, 0xbb, 0x9c, 0x37, 0x0a, 0x73, 0x3d, 0xc7, 0xde, 0x88, 0xe9, 0x11, 0x12, 0xa2, 0x22, 0x93,
+    0x1d, 0xe7, 0xa0, 0xb1, 0x7b, 0xa8, 0x95, 0x13, 0xfe, 0x53, 0x5f, 0x87, 0x12, 0x4d, 0x0b, 0xc6,
+    0x83, 0x37, 0x95, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x42, 0x01, 0x00, 0xb3, 0xe6, 0xac, 0x79,
+    0x9a, 0xc6, 0xe7, 0xc0, 0x07, 0xa6, 0xe7, 0x12, 0x8c, 0xae, 0x82, 0xec, 0xa3, 0xd2, 0x7e, 0xb2,
+    0xd5, 0xd6, 0xcb, 0x02, 0x2f, 0x2b, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x39, 0x7b, 0x1a,
+    0x18, 0x0b, 0xbc, 0x4f, 0x64, 0xc5, 0x7d, 0x6d, 0x44, 0xee, 0x30, 0x27, 0xb7, 0x5a, 0x42, 0x88,
+    0x1a, 0x73, 0x67, 0x6d, 0xb6, 0x6f, 0xd6, 0xe1, 0x6e, 0x3f, 0x99, 0x72, 0xfb, 0x07, 0xa2, 0x4c,
+    0x00, 0x00, 0x00, 0x00, 0x96, 0x4a, 0x01, 0x00, 0x29, 0xc6, 0xb8, 0xc9, 0x45, 0xc7, 0x53, 0x21,
+    0x65, 0x8e, 0xb8, 0xc0, 0x7d, 0x11, 0xb2, 0xcc, 0x1c, 0xa2, 0xef, 0xa8, 0xd1, 0x0d, 0x79, 0xc4,
+    0xec, 0xc7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xcc, 0x0f, 0x88, 0xd4, 0xe2, 0xd8, 0xb6,
+    0xb7, 0x87, 0x31, 0xc2, 0x90, 0xf4, 0x7d, 0xca, 0x49, 0x52, 0x23, 0x38, 0x02, 0xdb, 0x40, 0x70,
+    0x52, 0xb6, 0x7b, 0xf0, 0x7d, 0x0a, 0x8d, 0xd9, 0x98, 0x9f, 0xb3, 0x4c, 0x00, 0x00, 0x00, 0x00,
+    0x75, 0x52, 0x01, 0x00, 0x6a, 0xdb, 0xf4, 0xfb, 0x8c, 0x2b, 0x15, 0xc7, 0xc7, 0x52, 0x2d, 0xad,
+    0x3f, 0x4d, 0x79, 0x30, 0x4d, 0x74, 0x46, 0x5f, 0xc2, 0xf7, 0x1f, 0xb9, 0x5e, 0x0b, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xdc, 0x70, 0x9c, 0x3c, 0xdb, 0x0c, 0x3b, 0xc9, 0x1e, 0x2c, 0x0a, 0x4d,
+    0x76, 0xf7, 0xdc, 0xf0, 0x2d, 0x1a, 0x50, 0x89, 0x1e, 0x92, 0xa9, 0x91, 0xf6, 0x8a, 0x75, 0x27,
+    0x9b, 0xf5, 0xea, 0xbc, 0x27, 0x88, 0xbf, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x54, 0x5a, 0x01, 0x00,
+    0xcc, 0x7c, 0x12, 0xa8, 0x4b, 0xc5, 0x3f, 0x76, 0x10, 0xb3, 0x65, 0x7f, 0x72, 0x08, 0x34, 0xee,
+    0xff, 0x21, 0x87, 0x8c, 0x2d, 0xa6, 0x36, 0xd0, 0x31, 0x3e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x32, 0x40, 0x12, 0x9c, 0x33, 0xad, 0xda, 0x7b, 0x75, 0x52, 0x6d, 0x15, 0x9f, 0xa9, 0xb2,
+    0xb2, 0x47, 0x98, 0x62, 0x94, 0xab, 0x14, 0xe7, 0x96, 0x50, 0xac, 0xbe, 0x88, 0x0a, 0x82, 0x53,
+    0xfe, 0x59, 0xcc, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x33, 0x62, 0x01, 0x00, 0xd4, 0x4f, 0x43, 0xf7,
+    0x83, 0xc2, 0x77, 0xfe, 0x2d, 0xca, 0xbc, 0xac, 0xce, 0xdf, 0xbe, 0x3f, 0xd0, 0x42, 0x83, 0x39,
+    0x2f, 0xe6, 0xa2, 0x45, 0x44, 0x5e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x64, 0x95, 0xce,
+    0x06, 0x77, 0x27, 0xae, 0x1c, 0x06, 0xc2, 0x93, 0x2f, 0x92, 0x47, 0x7e, 0x1f, 0x63, 0x8b, 0x4d,
+    0x59, 0x4b, 0x3d, 0x12, 0x28, 0x19, 0x63, 0xe8, 0xce, 0x51, 0x72, 0x76, 0xec, 0xfa, 0xd8, 0x4c,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x6a, 0x01, 0x00, 0x30, 0xaf, 0xf6, 0x51, 0xf5, 0x2c, 0xbc, 0x56,
+    0x48, 0xe6, 0xe6, 0x98, 0xcf, 0xd5, 0x52, 0x20, 0x24, 0xfc, 0x05, 0x3e, 0xb7, 0xe4, 0xfa, 0x14,
+    0x87, 0x4f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xbe, 0xa5, 0x22, 0x28, 0x54, 0x33, 0x8a,
+    0x39, 0xbc, 0x69, 0x51, 0x14, 0x16, 0xe2, 0xf6, 0x92, 0x08, 0x18, 0xfd, 0xdb, 0xf3, 0x45, 0x27,
+    0x22, 0x55, 0x6b, 0x27, 0xbe, 0xba, 0x75, 0x25, 0x87, 0x3c, 0xe5, 0x4c, 0x00, 0x00, 0x00, 0x00,
+    0xf1, 0x71, 0x01, 0x00, 0x37, 0xcd, 0x40, 0x7d, 0x57, 0xf3, 0xab, 0x9b, 0x18, 0x04, 0xac, 0xb3,
+    0x15, 0xc7, 0x2b, 0xc2, 0xe7, 0xb7, 0xac, 0xe7, 0x8b, 0xfa, 0x27, 0x55, 0x33, 0x3c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfd, 0x0d, 0x4b, 0x55, 0xcb, 0xe1, 0xeb, 0xfc, 0xf0, 0x19, 0xd8, 0xcd,
+    0x45, 0x3d, 0xc2, 0x2b, 0xe8, 0x93, 0xe3, 0x4d, 0xaa, 0xea, 0x52, 0x82, 0x06, 0x4d, 0x1e, 0x44,
+    0xab, 0xed, 0xae, 0x6f, 0xa5, 0xec, 0xf4, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x79, 0x01, 0x00,
+    0xd5, 0x73, 0x35, 0x24, 0xc1, 0x13, 0x2f, 0xa9, 0xf0, 0xb5, 0xae, 0x46, 0xd1, 0x01, 0x5a, 0x17,
+    0x29, 0x16, 0x30, 0x3c, 0x29, 0x0e, 0xdc, 0xcf, 0x35, 0xba, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x95, 0x44, 0xa7, 0x97, 0xa1, 0x6f, 0x74, 0xd0, 0x9f, 0x59, 0xf0, 0x4e, 0xa7, 0x21, 0x63, 0x13,
+    0xe1, 0xb2, 0x17, 0xbf, 0xf9, 0x57, 0x09, 0x52, 0x0d, 0xa9, 0xf6, 0x19, 0xfd, 0x3b, 0x8c, 0x0d,
+    0x39, 0x06, 0x01, 0x4d, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x81, 0x01, 0x00, 0xb5, 0x56, 0x76, 0x90,
+    0xaf, 0x43, 0x52, 0x1f, 0xfa, 0xf4, 0xa1, 0xe4, 0x33, 0x3c, 0x22, 0xf0, 0xee, 0x28, 0xa6, 0xb0,
+    0x88, 0xcd, 0xea, 0x8a, 0x61, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x92, 0x9e, 0x46,
+    0x75, 0x59, 0x67, 0x4e, 0x55, 0x43, 0x30, 0xea, 0xa9, 0x55, 0x9f, 0xc9, 0x44, 0x1a, 0xe9, 0x38,
+    0xc1, 0x0c, 0x19, 0x99, 0x30, 0xc9, 0x6b, 0x83, 0x06, 0xb6, 0xb6, 0xb9, 0x23, 0xa7, 0x10, 0x4d,
+    0x00, 0x00, 0x00, 0x00, 0x8e, 0x89, 0x01, 0x00, 0x95, 0x17, 0xe8, 0xd8, 0xef, 0xc1, 0xc7, 0x2b,
+    0xec, 0xe7, 0x3d, 0xc3, 0xc2, 0xc0, 0x61, 0xd7, 0x3c, 0x2c, 0x71, 0x2b, 0xa1, 0xf7, 0x07, 0x31,
+    0x49, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xeb, 0x12, 0x4c, 0x08, 0xee, 0x21, 0x58,
+    0x3a, 0x7e, 0xab, 0x07, 0xe1, 0x51, 0x5e, 0x43, 0x98, 0xff, 0x51, 0x3e, 0x66, 0xcf, 0x41, 0xba,
+    0xcc, 0x4a, 0xf7, 0xdf, 0x2a, 0x80, 0x50, 0x87, 0xf8, 0xea, 0x20, 0x4d, 0x00, 0x00, 0x00, 0x00,
+    0x6d, 0x91, 0x01, 0x00, 0x3a, 0xb3, 0x70, 0xe8, 0xf8, 0x63, 0xf9, 0xe4, 0xcd, 0xed, 0xc4, 0x03,
+    0x73, 0xe1, 0x36, 0x62, 0x46, 0xb5, 0xc9, 0xe9, 0x89, 0xfc, 0x73, 0x43, 0x8d, 0x53, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x41, 0x9e, 0xb0, 0x29, 0x44, 0xd1, 0xd6, 0xc3, 0xe3, 0x81, 0xd1, 0x77,
+    0x3a, 0x50, 0x67, 0x28, 0xdc, 0x2e, 0x38, 0x9f, 0xfe, 0x8f, 0x6e, 0x62, 0xcd, 0x84, 0xe5, 0x82,
+    0x33, 0xe1, 0xea, 0x7f, 0xb3, 0x3d, 0x31, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x99, 0x01, 0x00,
+    0xd8, 0xe4, 0xb1, 0xaa, 0xc1, 0x36, 0xd0, 0x84, 0x9b, 0x12, 0x28, 0x99, 0x4f, 0xd2, 0x06, 0x68,
+    0x6e, 0x1a, 0xac, 0x9b, 0x41, 0xe9, 0x04, 0x8b, 0x57, 0xe3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x9d, 0x75, 0xed, 0x10, 0x8e, 0xf5, 0x10, 0x2e, 0x51, 0x57, 0x27, 0x35, 0x97, 0x51, 0x2f,
+    0x96, 0x5c, 0xb4, 0x87, 0xcd, 0x75, 0xd3, 0xd7, 0xdd, 0x97, 0x74, 0xc3, 0x5f, 0x57, 0x03, 0x14,
+    0x8b, 0xcd, 0x40, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xa1, 0x01, 0x00, 0x5c, 0xc2, 0x88, 0xbc,
+    0x7c, 0x5d, 0xbe, 0xdc, 0x8f, 0x94, 0x7a, 0x8a, 0x89, 0x72, 0x68, 0x86, 0x1a, 0x99, 0x61, 0xf0,
+    0x8c, 0x09, 0xa6, 0xc6, 0x4b, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x5c, 0x3b, 0xee,
+    0x8a, 0xb3, 0x4a, 0x2b, 0x78, 0x92, 0x7b, 0x9d, 0xea, 0xd6, 0x7f, 0x46, 0xfe, 0x6c, 0xaa, 0xc3,
+    0x8a, 0x11, 0x6d, 0xe5, 0x6f, 0x4e, 0xc8, 0xc0, 0x7d, 0x3e, 0xb8, 0x66, 0x61, 0x72, 0x50, 0x4d,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0xa9, 0x01, 0x00, 0xa6, 0x5a, 0x0d, 0x64, 0x4c, 0x01, 0x06, 0xc6,
+    0x05, 0x99, 0x6a, 0xa2, 0xbc, 0xe0, 0x7f, 0x40, 0xaa, 0xde, 0xad, 0xfc, 0x96, 0x35, 0x93, 0xd1,
+    0x4c, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x74, 0x53, 0x64, 0x56, 0x14, 0x0f, 0x5b,
+    0x2e, 0x96, 0x30, 0x46, 0xf8, 0xd4, 0xa1, 0x01, 0xb6, 0x52, 0x94, 0x3b, 0xee, 0xbc, 0xc8, 0x23,
+    0xb9, 0xc2, 0x42, 0x78, 0x6e, 0x15, 0xf0, 0x96, 0xe8, 0xb2, 0x5d, 0x4d, 0x00, 0x00, 0x00, 0x00,
+    0xe9, 0xb0, 0x01, 0x00, 0x05, 0xe3, 0x7c, 0x60, 0xdb, 0x10, 0x6e, 0x34, 0x4b, 0x17, 0xfc, 0x78,
+    0xb3, 0x69, 0xe1, 0x23, 0x3d, 0xa9, 0xca, 0xf9, 0xe0, 0xa8, 0xc4, 0x14, 0xfa, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf2, 0x21, 0x7e, 0xef, 0x59, 0xcf, 0x09, 0x61, 0x61, 0xd8, 0x8c, 0xbe,
+    0x94, 0x3e, 0x27, 0x9d, 0xf3, 0x2e, 0x46, 0x1c, 0xf7, 0xd7, 0x42, 0xe8, 0x81, 0xd4, 0xe0, 0x9a,
+    0x26, 0x5d, 0xc0, 0x92, 0x13, 0xe8, 0x69, 0x4d, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xb8, 0x01, 0x00,
+    0x46, 0xef, 0x89, 0x89, 0xaa, 0xc8, 0x6f, 0xc7, 0xd4, 0xfb, 0x79, 0x3c, 0x02, 0x85, 0x35, 0x57,
+    0x30, 0x89, 0xaa, 0x92, 0x23, 0xb3, 0xd3, 0x72, 0xca, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcd, 0x09, 0x88, 0xa5, 0xc2, 0x90, 0x68, 0x84, 0xbe, 0x8b, 0xba, 0x10, 0x14, 0xe1, 0xb4, 0x12,
+    0xf1, 0xec, 0x97, 0xb0, 0x4e, 0x18, 0xe4, 0xdd, 0x7d, 0xd8, 0x48, 0xce, 0xa4, 0xac, 0x1c, 0xaf,
+    0x3a, 0x27, 0x77, 0x4d, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xc0, 0x01, 0x00, 0xba, 0x86, 0x69, 0x88,
+    0x38, 0xbb, 0x81, 0x1d, 0xde, 0x04, 0xb2, 0x98, 0x9a, 0x37, 0xb7, 0xd5, 0xce, 0x85, 0x60, 0x6c,
+    0xd9, 0xef, 0x8c, 0x0f, 0x95, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xd2, 0x78, 0x18,
+    0x9e, 0x1d, 0xb9, 0x90, 0x19, 0xf3, 0x0b, 0xbd, 0x62, 0xd7, 0x10, 0x01, 0xa6, 0x5d, 0xbc, 0x6d,
+    0x17, 0x2d, 0xa7, 0xea, 0xbf, 0xb7, 0xcd, 0x10, 0x38, 0xa6, 0x45, 0x00, 0x56, 0x69, 0x8b, 0x4d,
+    0x00, 0x00, 0x00, 0x00, 0x86, 0xc8, 0x01, 0x00, 0x34, 0x88, 0xa8, 0xeb, 0x60, 0xfa, 0x2d, 0x83,
+    0x92, 0x05, 0xaf, 0xbf, 0xac, 0x67, 0x11, 0x47, 0xe1, 0xfe, 0x4d, 0xcb, 0x7c, 0xdf, 0xb7, 0x36,
+    0x2f, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x0a, 0x64, 0x2e, 0x4e, 0x36, 0xae, 0x2e,
+    0xf7, 0x22, 0x7f, 0xb6, 0xa6, 0xcd, 0xba, 0x02, 0xbe, 0x17, 0xfe, 0x9c, 0xc7, 0x0b, 0x1c, 0x6e,
+    0x76, 0x92, 0xb3, 0xd4, 0x54, 0x05, 0x7b, 0xe4, 0x29, 0x21, 0x9b, 0x4d, 0x00, 0x00, 0x00, 0x00,
+    0x65, 0xd0, 0x01, 0x00, 0x01, 0xce, 0x7f, 0xf7, 0x5e, 0xc1, 0xde, 0x5d, 0x59, 0xb1, 0x08, 0x0f,
+    0x57, 0xa5, 0x55, 0xa9, 0x51, 0x43, 0x76, 0xbf, 0x49, 0x26, 0x54, 0xd6, 0x23, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4e, 0x51, 0x9d, 0xbb, 0xa5, 0x7b, 0x47, 0x2c, 0x0d, 0xcb, 0x53, 0xf6,
+    0xd6, 0x84, 0xb5, 0xbe, 0xcd, 0x73, 0x9f, 0x44, 0xe6, 0x3a, 0xeb, 0x62, 0xf4, 0x04, 0x7c, 0xc1,
+    0xd1, 0x79, 0x5f, 0x44, 0xdb, 0x60, 0xab, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x44, 0xd8, 0x01, 0x00,
+    0xab, 0x1e, 0xbd, 0xa2, 0x3b, 0x90, 0xb4, 0x8a, 0xb6, 0xa2, 0x11, 0x00, 0xbe, 0xbd, 0xa3, 0x19,
+    0x74, 0x56, 0x96, 0x56, 0xfa, 0xf7, 0xa7, 0xe0, 0xfe, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcb, 0x5c, 0xc7, 0x26, 0x7e, 0x25, 0xc1, 0x81, 0xdd, 0x06, 0xce, 0xb5, 0x22, 0x5f, 0x6d, 0x01,
+    0x3a, 0xd6, 0x39, 0x74, 0x56, 0x67, 0x50, 0x08, 0x80, 0x6b, 0xb0, 0x46, 0xc9, 0x6f, 0x39, 0x31,
+    0xdd, 0x08, 0xbb, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x23, 0xe0, 0x01, 0x00, 0x39, 0xd5, 0x0b, 0x1c,
+    0xc6, 0xe4, 0x82, 0x43, 0x41, 0x10, 0xb8, 0x29, 0x79, 0x2c, 0x61, 0x7e, 0x17, 0xe3, 0xb3, 0x09,
+    0xc6, 0x88, 0x1d, 0x5f, 0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x67, 0x9b, 0x40,
+    0x2e, 0x2e, 0x5e, 0x71, 0x9d, 0xac, 0x43, 0x6e, 0x80, 0x4b, 0x2b, 0x5a, 0x02, 0x02, 0x41, 0x1d,
+    0xc0, 0x83, 0xeb, 0x51, 0xf8, 0xff, 0x4e, 0x8a, 0x58, 0xeb, 0xc0, 0x8b, 0xe1, 0x07, 0xc8, 0x4d,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xe8, 0x01, 0x00, 0xd4, 0x34, 0xbd, 0xce, 0xc7, 0xc7, 0xda, 0x7b,
+    0x1d, 0xaf, 0x9f, 0x61, 0x06, 0xca, 0x7e, 0x00, 0xd2, 0x8c, 0xaa, 0x0b, 0x8a, 0x40, 0x19, 0x75,
+    0x46, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xc9, 0x9b, 0x94, 0x87, 0x5c, 0xeb, 0xd5,
+    0x4f, 0x13, 0x5f, 0xaf, 0xc4, 0xf7, 0xca, 0xf9, 0x3c, 0x27, 0x0c, 0xc3, 0xc0, 0xb8, 0xcc, 0x8b,
+    0xa1, 0x77, 0x04, 0x96, 0x4a, 0x1e, 0x9d, 0x1f, 0x4f, 0xfc, 0xd3, 0x4d, 0x00, 0x00, 0x00, 0x00,
+    0xe1, 0xef, 0x01, 0x00, 0x0f, 0x74, 0x2b, 0x06, 0xfc, 0x57, 0x0f, 0xf5, 0xe6, 0x22, 0x7b, 0xe9,
+    0xde, 0xeb, 0x34, 0x7a, 0x03, 0x74, 0xdb, 0xb8, 0x2c, 0xa4, 0x39, 0x76, 0xec, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb4, 0x97, 0x64, 0x5f, 0x0f, 0xcd, 0x08, 0xf0, 0xa0, 0xc9, 0xc9, 0xac,
+    0x35, 0x22, 0x5c, 0x8c, 0xa7, 0x1d, 0x85, 0x6e, 0x90, 0x64, 0x0d, 0xec, 0x77, 0x76, 0x89, 0x42,
+    0x51, 0xd0, 0xe6, 0x93, 0x2b, 0x58, 0xde, 0x4d, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf7, 0x01, 0x00,
+    0x67, 0x15, 0xa4, 0x55, 0x22, 0x91, 0x09, 0x51, 0xf8, 0x22, 0x9a, 0x4e, 0xc1, 0x11, 0xd3, 0x30,
+    0x41, 0xd5, 0x5c, 0xdb, 0x0f, 0x7e, 0x1c, 0x46, 0x5a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xd0, 0x6f, 0xf3, 0x52, 0xcf, 0x76, 0x22, 0x1c, 0x8d, 0xda, 0xc8, 0xe9, 0xdc, 0xe8, 0x7b,
+    0x16, 0x6d, 0xe7, 0x31, 0xfe, 0xe4, 0xed, 0xe8, 0xca, 0x02, 0x0f, 0x8e, 0x77, 0xd6, 0x9d, 0xc4,
+    0xe5, 0x78, 0xec, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0x01, 0x00, 0x4a, 0xa1, 0xbc, 0x80,
+    0x2c, 0x23, 0xe6, 0x68, 0x80, 0x5e, 0x4a, 0x66, 0xb0, 0x62, 0x39, 0x91, 0x29, 0x01, 0x78, 0x29,
+    0x55, 0xad, 0x11, 0x16, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x66, 0x18, 0xd8,
+    0x43, 0x92, 0xac, 0x2c, 0xab, 0xaf, 0xb1, 0x1a, 0x6b, 0x5e, 0x2e, 0x35, 0x1d, 0xab, 0xe2, 0x4b,
+    0xff, 0x5a, 0xe5, 0x66, 0xe1, 0x3e, 0x46, 0xbf, 0x0d, 0xf3, 0xa6, 0xe0, 0x78, 0x73, 0xf8, 0x4d,
+    0x00, 0x00, 0x00, 0x00, 0x7e, 0x07, 0x02, 0x00, 0x0d, 0xe9, 0xd5, 0x0f, 0x2c, 0xf2, 0x1b, 0x7e,
+    0xf1, 0xa7, 0x78, 0x89, 0x95, 0xc8, 0x2f, 0x6c, 0xe9, 0x38, 0x2a, 0x0c, 0xb5, 0xd0, 0x7c, 0x35,
+    0xe2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xad, 0x2b, 0xb7, 0xa1, 0x63, 0xdf, 0xc1,
+    0xab, 0xfa, 0xd7, 0x18, 0xc8, 0xd9, 0x58, 0x76, 0xb6, 0x24, 0x51, 0x53, 0xb7, 0x51, 0xef, 0xde,
+    0xc8, 0x5c, 0x66, 0x5f, 0xa6, 0x3a, 0xf8, 0x12, 0x60, 0x13, 0x04, 0x4e, 0x00, 0x00, 0x00, 0x00,
+    0x5d, 0x0f, 0x02, 0x00, 0x79, 0x74, 0xfa, 0x4c, 0xd8, 0xbf, 0x25, 0xe0, 0x6c, 0x43, 0xce, 0xf7,
+    0x93, 0xb0, 0x3c, 0x84, 0x2f, 0x3e, 0x25, 0xf9, 0xce, 0xdb, 0xe1, 0x45, 0x6b, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1b, 0x35, 0x2e, 0xba, 0x8d, 0x95, 0x90, 0x01, 0x2e, 0x98, 0xe4, 0xdd,
+    0x83, 0xf2, 0x30, 0x30, 0xc7, 0x57, 0xd9, 0x20, 0x29, 0x12, 0x7e, 0xca, 0x9c, 0xb4, 0xed, 0x8d,
+    0xae, 0xa2, 0x6a, 0xfb, 0xe9, 0x31, 0x14, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x17, 0x02, 0x00,
+    0xe9, 0xf8, 0x3d, 0xb5, 0x5e, 0xc1, 0xb7, 0x08, 0xb9, 0x7c, 0x75, 0x07, 0xb0, 0x98, 0xc2, 0x0f,
+    0xa6, 0xac, 0x0f, 0x4e, 0x7f, 0x67, 0x36, 0x33, 0xc9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0xcf, 0x69, 0xbb, 0x9b, 0xd8, 0xb1, 0xb6, 0x7b, 0xd1, 0x61, 0xd5, 0x78, 0xfb, 0x10, 0x2a,
+    0xd3, 0x46, 0x9f, 0xf3, 0x55, 0x97, 0x8c, 0x9f, 0x06, 0x5a, 0x31, 0xa5, 0x31, 0x58, 0x23, 0x2e,
+    0x9e, 0x3b, 0x25, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1f, 0x02, 0x00, 0xec, 0x33, 0x92, 0x68,
+    0x87, 0xa2, 0x59, 0xb0, 0xc5, 0x64, 0xd9, 0xb7, 0x39, 0x9c, 0x07, 0xff, 0xf1, 0x16, 0xc2, 0xbe,
+    0x9b, 0x89, 0xed, 0x81, 0xdc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xa9, 0xdb, 0xfc,
+    0x7a, 0x0e, 0x1b, 0xf7, 0xf2, 0x04, 0x2f, 0xb1, 0xcd, 0x23, 0x6f, 0xa0, 0xe8, 0x8e, 0x09, 0x8d,
+    0xa9, 0xda, 0xfa, 0x58, 0x4a, 0x6a, 0x7e, 0xc5, 0x6a, 0x32, 0x1f, 0x9e, 0x27, 0xec, 0x35, 0x4e,
+    0x00, 0x00, 0x00, 0x00, 0xfa, 0x26, 0x02, 0x00, 0x73, 0xc0, 0xc0, 0x44, 0x8a, 0x6b, 0xd6, 0x1d,
+    0x5c, 0x21, 0x73, 0x36, 0x56, 0x4f, 0x7f, 0x8c, 0xaf, 0x98, 0xa4, 0xab, 0xf7, 0x74, 0x85, 0x45,
+    0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xed, 0x86, 0x9a, 0xd1, 0x4f, 0x79, 0x21,
+    0xe2, 0xfa, 0x7b, 0x00, 0x3b, 0xdd, 0x99, 0x97, 0x98, 0xf5, 0xb0, 0xea, 0xea, 0xc0, 0x9c, 0xdb,
+    0x40, 0xb4, 0x70, 0x78, 0xb5, 0xee, 0xf5, 0xd5, 0x36, 0xe5, 0x48, 0x4e, 0x00, 0x00, 0x00, 0x00,
+    0xd9, 0x2e, 0x02, 0x00, 0x81, 0xe5, 0xb7, 0x7b, 0x35, 0x5f, 0xb9, 0xc5, 0x9f, 0xca, 0x43, 0x3b,
+    0xe4, 0x7f, 0xb2, 0x6b, 0x85, 0x2c, 0x8c, 0x28, 0x20, 0x59, 0xcc, 0x32, 0xf1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbd, 0x34, 0xe9, 0x1d, 0xa9, 0xb4, 0x32, 0x04, 0x81, 0xb1, 0x89, 0x98,
+    0x0a, 0x35, 0x7a, 0x1d, 0xc9, 0x4c, 0x74, 0x5b, 0x1e, 0x95, 0xed, 0x38, 0x21, 0xf4, 0xc6, 0xb1,
+    0x47, 0x55, 0x80, 0x95, 0xea, 0xc5, 0x5b, 0x4e, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x36, 0x02, 0x00,
+    0xbb, 0xe8, 0xdb, 0x55, 0x90, 0xbf, 0x0a, 0xcb, 0x06, 0x8e, 0xb8, 0x39, 0x21, 0xe5, 0xad, 0x2b,
+    0x20, 0x9d, 0x02, 0xd1, 0xe4, 0x82, 0x03, 0xeb, 0x59, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x97, 0x71, 0x32, 0xae, 0x9c, 0x35, 0x47, 0xc2, 0x9a, 0x46, 0x02, 0xe2, 0x84, 0xf4, 0x53, 0xe1,
+    0x17, 0x39, 0x0d, 0x28, 0xd8, 0x55, 0x03, 0x87, 0x33, 0x61, 0xb6, 0xec, 0x87, 0x49, 0x1d, 0x8b,
+    0xe0, 0x87, 0x6e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x97, 0x3e, 0x02, 0x00, 0x58, 0x43, 0x0d, 0xa5,
+    0x11, 0x0e, 0xd5, 0x5e, 0x19, 0xa6, 0xeb, 0x29, 0xed, 0xcd, 0x19, 0xd8, 0x5c, 0xd4, 0xec, 0x53,
+    0xc9, 0xc5, 0x32, 0xf7, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x35,
+    0x63, 0xa1, 0xbf, 0x59, 0x0d, 0xa0, 0xf2, 0xd8, 0x5a, 0x32, 0xcf, 0x54, 0x53, 0x91, 0xa7, 0x1f,
+    0x4e, 0xa6, 0xc6, 0x66, 0xa9, 0x22, 0x6b, 0x1b, 0x7b, 0x49, 0xff, 0x9f, 0x16, 0x9d, 0x81, 0x4e,
+    0x00, 0x00, 0x00, 0x00, 0x76, 0x46, 0x02, 0x00, 0xdf, 0x39, 0x0f, 0x22, 0xf7, 0xde, 0x39, 0x5c,
+    0x66, 0xd4, 0xe4, 0xb6, 0xb4, 0xc4, 0x96, 0x19, 0xfc, 0xed, 0x8e, 0x97, 0xd4, 0x93, 0xd4, 0x73,
+    0x8b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x7b, 0xdb, 0x59, 0xc5, 0x97, 0xac, 0x15,
+    0xe6, 0x2d, 0x78, 0x4d, 0x88, 0x23, 0xef, 0x3c, 0xb5, 0xe3, 0xa6, 0x40, 0xd8, 0xd0, 0x4d, 0xf1,
+    0x0f, 0xdf, 0xbe, 0x2b, 0x8d, 0x90, 0x00, 0x26, 0x4c, 0xc6, 0x96, 0x4e, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x4e, 0x02, 0x00, 0xcc, 0x09, 0xb7, 0x7a, 0xe8, 0x74, 0x31, 0xde, 0xc6, 0x78, 0xb0, 0xdc,
+    0xd3, 0xa1, 0x47, 0x1d, 0x8c, 0x2a, 0xac, 0xf7, 0x15, 0x9c, 0x47, 0xa7, 0xc7, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x26, 0x4a, 0x16, 0x77, 0x63, 0xdc, 0x5a, 0x7e, 0x55, 0x6a, 0x9a, 0xc7,
+    0x34, 0x81, 0xce, 0x87, 0xdc, 0x50, 0x7a, 0xea, 0x38, 0x32, 0x3c, 0xa6, 0xeb, 0x71, 0xec, 0xac,
+    0xf6, 0xce, 0x22, 0x4a, 0x94, 0x43, 0xad, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x34, 0x56, 0x02, 0x00,
+    0x14, 0x99, 0xd0, 0xa6, 0xf5, 0xf7, 0xd8, 0x63, 0xd0, 0x3e, 0x5c, 0xb3, 0x90, 0x36, 0xbc, 0x8d,
+    0x08, 0x76, 0x7a, 0x7c, 0x94, 0xb7, 0xcf, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xb4, 0x2e, 0xa5, 0x60, 0x52, 0x25, 0x78, 0x73, 0xcc, 0xd2, 0x59, 0xd1, 0x7d, 0x36, 0x62,
+    0x5b, 0xd3, 0x28, 0x6d, 0x0a, 0xfa, 0x1c, 0x86, 0xfc, 0x67, 0x51, 0x02, 0xb4, 0xaf, 0x03, 0x3c,
+    0x02, 0x18, 0xc0, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x13, 0x5e, 0x02, 0x00, 0x41, 0x44, 0x10, 0xfb,
+    0x10, 0x3c, 0x54, 0xb1, 0x52, 0x28, 0x36, 0x8f, 0x54, 0xb7, 0x03, 0xa4, 0x25, 0x07, 0xf3, 0x29,
+    0x8c, 0xf6, 0x8d, 0xfe, 0x16, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x4e, 0xa8, 0xd9,
+    0xfb, 0x56, 0x1f, 0x63, 0xba, 0xb2, 0x2a, 0xb2, 0xe0, 0xaf, 0x67, 0xf8, 0x0a, 0x67, 0x4b, 0xc0,
+    0xcd, 0x6b, 0xe2, 0x6a, 0x3d, 0x15, 0xde, 0x86, 0x57, 0x67, 0x78, 0xe6, 0x0f, 0x24, 0xd4, 0x4e,
+    0x00, 0x00, 0x00, 0x00, 0xf2, 0x65, 0x02, 0x00, 0xbf, 0x34, 0x84, 0xe1, 0x59, 0xf5, 0x7c, 0xad,
+    0x7c, 0x46, 0xdb, 0x5a, 0xf3, 0x2d, 0xe7, 0x17, 0x92, 0xbb, 0x7b, 0x4f, 0x92, 0x29, 0x3e, 0x50,
+    0x76, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xde, 0x1b, 0x67, 0x68, 0x9d, 0x21, 0x98,
+    0x20, 0xa4, 0x2e, 0x54, 0x49, 0x32, 0x11, 0xc4, 0x3b, 0x9b, 0xf9, 0xe1, 0x20, 0xb8, 0x65, 0x8a,
+    0x50, 0x77, 0x5e, 0xd7, 0x45, 0xc3, 0x1a, 0x0b, 0x71, 0x8f, 0xe5, 0x4e, 0x00, 0x00, 0x00, 0x00,
+    0xd1, 0x6d, 0x02, 0x00, 0x3f, 0xd9, 0x24, 0x6b, 0xff, 0x12, 0x84, 0xc5, 0x40, 0x60, 0x27, 0x36,
+    0x47, 0xc0, 0x4e, 0xca, 0xcc, 0xea, 0x1f, 0x51, 0xe2, 0x60, 0x11, 0x3e, 0x6b, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x64, 0xa4, 0xec, 0x46, 0xd3, 0x11, 0x58, 0xd9, 0xf0, 0x2d, 0x77, 0x39,
+    0x30, 0xc5, 0x40, 0x70, 0x4e, 0x85, 0x3e, 0x67, 0x12, 0x59, 0xe7, 0xfa, 0x7b, 0x55, 0x9c, 0x56,
+    0x2f, 0x45, 0xb5, 0xe7, 0x55, 0x18, 0xf8, 0x4e, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x75, 0x02, 0x00,
+    0x29, 0x36, 0x23, 0xfe, 0x85, 0xa4, 0xda, 0x11, 0xda, 0xa0, 0x3a, 0x33, 0xb8, 0xdb, 0x49, 0xb1,
+    0xfc, 0x29, 0xa9, 0xde, 0x7c, 0x51, 0xaf, 0x97, 0x58, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc6, 0x47, 0x70, 0xa3, 0x39, 0x2e, 0xaf, 0x17, 0x53, 0xe4, 0xcd, 0x36, 0xe3, 0x57, 0xf6, 0xe6,
+    0xf9, 0x66, 0x05, 0x41, 0x2a, 0xbf, 0x55, 0x54, 0xba, 0xf1, 0x8c, 0x78, 0x0f, 0x50, 0xc6, 0x53,
+    0x93, 0x40, 0x09, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x7d, 0x02, 0x00, 0xbc, 0x55, 0xab, 0x4c,
+    0x95, 0xeb, 0xa3, 0x61, 0x90, 0xac, 0xfc, 0x77, 0x6f, 0x81, 0xb0, 0x23, 0xc3, 0x75, 0x11, 0xd0,
+    0x9f, 0x4e, 0x1c, 0x85, 0x4d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xec, 0x71, 0xa4,
+    0xda, 0x72, 0x33, 0x7f, 0xbd, 0xb6, 0x05, 0x3a, 0x65, 0x9f, 0x30, 0x7e, 0xfd, 0x28, 0x86, 0x9f,
+    0x5b, 0x92, 0x0e, 0xb3, 0xa6, 0xb8, 0x9b, 0xd1, 0xf2, 0xf7, 0x87, 0x7e, 0x13, 0xc7, 0x1a, 0x4f,
+    0x00, 0x00, 0x00, 0x00, 0x6e, 0x85, 0x02, 0x00, 0x31, 0x38, 0x23, 0x51, 0x93, 0xcc, 0x9d, 0xb4,
+    0xc5, 0xcd, 0xa2, 0xab, 0x5f, 0x63, 0x95, 0xf9, 0x8f, 0xc4, 0x60, 0x05, 0xf4, 0x34, 0x7e, 0x43,
+    0xed, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xf5, 0xa4, 0xc8, 0x25, 0x4b, 0x87, 0x06,
+    0x46, 0xd9, 0xcd, 0xe3, 0x73, 0x63, 0xae, 0xc3, 0x71, 0x57, 0xc1, 0x59, 0xa4, 0x36, 0x17, 0xe0,
+    0xfc, 0xb1, 0x21, 0x0a, 0xf8, 0x4d, 0x8e, 0x0d, 0xca, 0x64, 0x2c, 0x4f, 0x00, 0x00, 0x00, 0x00,
+    0x4d, 0x8d, 0x02, 0x00, 0x1b, 0x9a, 0x9c, 0x42, 0xba, 0x91, 0xd2, 0x01, 0x75, 0x2f, 0x3b, 0x12,
+    0x49, 0x89, 0xca, 0xeb, 0xc1, 0x11, 0xef, 0x0c, 0x82, 0xf5, 0xae, 0xde, 0x8f, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7c, 0xaf, 0x2a, 0x5f, 0x74, 0x96, 0x2b, 0x39, 0x19, 0xeb, 0xf2, 0xa6,
+    0xdd, 0x25, 0x60, 0xdd, 0xe4, 0xed, 0xcd, 0x4e, 0x9c, 0xba, 0x8c, 0x70, 0xbb, 0x5b, 0x07, 0x5e,
+    0x3e, 0xb7, 0xdc, 0x52, 0x49, 0xd8, 0x3e, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x95, 0x02, 0x00,
+    0x9d, 0x36, 0x04, 0x1e, 0xd6, 0x38, 0xca, 0xc2, 0x8c, 0x0a, 0xf4, 0x9c, 0x41, 0x8d, 0x97, 0x9f,
+    0x4a, 0xe5, 0x4d, 0x2d, 0x2c, 0xb1, 0xd6, 0x2b, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0xd3, 0x5d, 0xeb, 0xb3, 0x26, 0x17, 0xa5, 0x64, 0x11, 0xeb, 0xd0, 0x32, 0x34, 0xb1, 0x9c,
+    0x5d, 0x0a, 0x64, 0xe6, 0xda, 0xb0, 0x3f, 0x70, 0xa0, 0x25, 0xd3, 0x74, 0xe3, 0x51, 0xb3, 0x9d,
+    0x05, 0xc4, 0x4f, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x9d, 0x02, 0x00, 0xb5, 0x29, 0x26, 0x3f,
+    0x66, 0x7a, 0x0c, 0x67, 0xaf, 0xb0, 0x8c, 0xcf, 0xc1, 0xa4, 0xa8, 0xe0, 0x04, 0x7e, 0xdc, 0x9d,
+    0x61, 0x18, 0xf7, 0x81, 0xa6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x1a, 0x6b, 0x7e,
+    0x6c, 0x05, 0xdf, 0x80, 0x2b, 0x59, 0x8a, 0x4e, 0xca, 0xfb, 0x43, 0xc4, 0x92, 0xf4, 0x13, 0xb3,
+    0x26, 0x55, 0x75, 0x5e, 0x11, 0xb2, 0x00, 0xf8, 0x8e, 0x7b, 0x61, 0x5f, 0x7b, 0x26, 0x62, 0x4f,
+    0x00, 0x00, 0x00, 0x00, 0xea, 0xa4, 0x02, 0x00, 0xf0, 0xe2, 0xbc, 0x9c, 0xbb, 0x84, 0xe0, 0x2b,
+    0xf5, 0x49, 0x8e, 0xc3, 0xda, 0x73, 0xcd, 0x32, 0xfb, 0xaa, 0x20, 0x6c, 0x8e, 0x2e, 0x2e, 0x6b,
+    0x7d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x5e, 0xbc, 0x1a, 0x9d, 0x3a, 0x14, 0x73,
+    0x09, 0x60, 0xab, 0x7e, 0xea, 0x13, 0xcd, 0x93, 0x64, 0x39, 0x12, 0x0e, 0x8f, 0x75, 0x8e, 0x6b,
+    0x31, 0x21, 0x4a, 0x3d, 0xda, 0x4e, 0x41, 0xcc, 0xa4, 0x33, 0x73, 0x4f, 0x00, 0x00, 0x00, 0x00,
+    0xc9, 0xac, 0x02, 0x00, 0xea, 0x4e, 0x89, 0x98, 0x64, 0x1a, 0xa8, 0xe1, 0x71, 0x38, 0x68, 0x29,
+    0x2e, 0xcc, 0xd6, 0xf5, 0x35, 0xb5, 0xd3, 0x01, 0x6c, 0xa9, 0x78, 0xd1, 0x93, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x84, 0xdf, 0xb9, 0x59, 0x5b, 0xa7, 0x62, 0xc6, 0x8f, 0x77, 0xed, 0x1f,
+    0xe7, 0x51, 0x0f, 0xdb, 0x04, 0x0b, 0xf1, 0x73, 0x40, 0x4e, 0x68, 0x14, 0x75, 0x78, 0xbd, 0xba,
+    0x15, 0x83, 0xc2, 0xb2, 0x38, 0x31, 0x86, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xb4, 0x02, 0x00,
+    0x2d, 0xe6, 0x1c, 0xbe, 0xd1, 0x6c, 0xfa, 0x55, 0xb8, 0x54, 0xa0, 0xd4, 0x15, 0x98, 0x9f, 0x73,
+    0x57, 0x6c, 0x69, 0x6f, 0x1c, 0xdf, 0x7c, 0xe4, 0x44, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xbc, 0xf3, 0xee, 0x86, 0xa2, 0xc4, 0x9b, 0x9b, 0x1e, 0x2c, 0x71, 0x8b, 0x25, 0xe0, 0x19, 0x49,
+    0x1e, 0x44, 0x55, 0x6e, 0xdc, 0xca, 0x55, 0x3f, 0xa8, 0xc2, 0x93, 0xed, 0x30, 0x56, 0x9f, 0xdd,
+    0x5e, 0x6d, 0x99, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x87, 0xbc, 0x02, 0x00, 0xdf, 0xb3, 0x9b, 0x15,
+    0x4b, 0x6f, 0x77, 0x6d, 0x3e, 0x0b, 0x2f, 0x94, 0xed, 0x1b, 0x06, 0xa4, 0x29, 0x3b, 0x71, 0xa6,
+    0xdf, 0xce, 0x5b, 0x50, 0xc3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0xce, 0x15,
+    0x89, 0x39, 0x8e, 0x53, 0xba, 0xdf, 0x6c, 0x26, 0x7e, 0xf5, 0x0e, 0x5c, 0x7d, 0x19, 0xef, 0xa0,
+    0xaa, 0xe5, 0xb3, 0xab, 0x22, 0x1a, 0x1a, 0x6d, 0x7c, 0x68, 0x0a, 0x41, 0x5d, 0xbb, 0xa9, 0x4f,
+    0x00, 0x00, 0x00, 0x00, 0x66, 0xc4, 0x02, 0x00, 0xed, 0xe7, 0x9b, 0x0b, 0xc0, 0x1d, 0xce, 0x7f,
+    0xde, 0x4f, 0x90, 0x13, 0xb1, 0x25, 0x6b, 0xd7, 0x35, 0x3d, 0x0c, 0xcd, 0x8c, 0xf3, 0x11, 0xfd,
+    0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x81, 0x82, 0x42, 0xff, 0x01, 0x8f, 0xdf,
+    0xb8, 0xe6, 0x97, 0x4c, 0xd0, 0x54, 0x63, 0xfd, 0xa7, 0x06, 0xa1, 0xf8, 0xb5, 0xb4, 0xaa, 0x7a,
+    0xb1, 0x4b, 0x8e, 0x50, 0x60, 0x74, 0x36, 0x18, 0x2b, 0x8d, 0xbd, 0x4f, 0x00, 0x00, 0x00, 0x00,
+    0x45, 0xcc, 0x02, 0x00, 0x2e, 0x71, 0x75, 0xa3, 0x2e, 0x0b, 0xed, 0x51, 0xc7, 0x3a, 0x55, 0xdc,
+    0x4a, 0x91, 0x70, 0xbe, 0xd8, 0xab, 0x10, 0x64, 0x5a, 0xd2, 0x2e, 0x5c, 0x39, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc2, 0x82, 0x1d, 0xe3, 0x6c, 0x6c, 0x9c, 0x41, 0x1b, 0x96, 0x8f, 0xa1,
+    0xc2, 0x60, 0x1d, 0x9a, 0xe8, 0xb4, 0xd2, 0x37, 0xe3, 0x58, 0xf8, 0x75, 0xc6, 0x11, 0x31, 0x56,
+    0x9b, 0xfe, 0xd5, 0xff, 0x46, 0x22, 0xd0, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd4, 0x02, 0x00,
+    0xcd, 0x86, 0x95, 0x74, 0xfb, 0x24, 0x9a, 0x0b, 0xab, 0xba, 0x99, 0x38, 0xe1, 0xa1, 0xdb, 0xb2,
+    0x2f, 0xe6, 0x7d, 0xba, 0xfb, 0x9f, 0x42, 0x53, 0xf9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x79, 0x4d, 0xb6, 0x06, 0x29, 0x89, 0x0a, 0x96, 0x77, 0xab, 0x44, 0x58, 0x7a, 0xc6, 0x67, 0x88,
+    0xb9, 0xae, 0x55, 0x4f, 0xc2, 0x62, 0x7c, 0x5e, 0x68, 0x1a, 0x51, 0x9a, 0x54, 0x6f, 0x00, 0x0f,
+    0x5b, 0x2f, 0xe1, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x03, 0xdc, 0x02, 0x00, 0x78, 0x47, 0x5f, 0x3b,
+    0xd3, 0x2e, 0x3e, 0x89, 0x3f, 0xd5, 0xf7, 0x3f, 0xb2, 0x34, 0xb5, 0xeb, 0x8d, 0xc2, 0x4d, 0x66,
+    0xfb, 0xb7, 0x63, 0xbe, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa5, 0x0c, 0x30,
+    0x77, 0x3e, 0x2d, 0x03, 0x80, 0xc7, 0x36, 0x81, 0xb0, 0xd1, 0xa4, 0x7a, 0x02, 0x92, 0x94, 0x5c,
+    0x72, 0x79, 0x68, 0xf7, 0x5a, 0xe5, 0x21, 0x4a, 0x2c, 0x99, 0xbb, 0xb2, 0x45, 0x5d, 0xf3, 0x4f,
+    0x00, 0x00, 0x00, 0x00, 0xe2, 0xe3, 0x02, 0x00, 0x3e, 0x4f, 0x4e, 0x67, 0xf4, 0x25, 0x89, 0x3d,
+    0x16, 0x33, 0xb6, 0xf5, 0x7e, 0x8f, 0x95, 0x03, 0x63, 0x55, 0x5b, 0x6b, 0xe8, 0xe8, 0x28, 0xeb,
+    0xc3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x4d, 0x63, 0xe9, 0x98, 0x25, 0x54, 0x10,
+    0xf8, 0x9c, 0x12, 0x3e, 0x81, 0x19, 0x89, 0x69, 0x11, 0xb3, 0xbe, 0x1b, 0x89, 0x54, 0x72, 0xad,
+    0xc3, 0xfe, 0x17, 0x42, 0xbd, 0x9e, 0xf7, 0x9d, 0xec, 0xc0, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xc1, 0xeb, 0x02, 0x00, 0xea, 0xce, 0x5f, 0xb7, 0xa7, 0xcb, 0x7b, 0x1b, 0xc0, 0x5f, 0xc8, 0xde,
+    0xd7, 0xd6, 0x0e, 0x2f, 0x22, 0x15, 0xce, 0xb4, 0x7f, 0x01, 0xfb, 0xca, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x69, 0x63, 0xb7, 0xf2, 0x4a, 0x11, 0x00, 0xb9, 0xa3, 0x2b, 0x34, 0x20,
+    0xe0, 0x48, 0xb6, 0x02, 0x37, 0x74, 0x0a, 0x64, 0x7e, 0x5a, 0xbc, 0x7c, 0x28, 0xd4, 0xcb, 0x11,
+    0x89, 0x1f, 0x9a, 0x17, 0x6b, 0xc4, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xf3, 0x02, 0x00,
+    0x70, 0x7c, 0x77, 0x51, 0x4e, 0xef, 0x0c, 0xc2, 0xe6, 0x5d, 0x77, 0xa8, 0xa6, 0xf4, 0x28, 0x40,
+    0x9a, 0x2b, 0xaf, 0xe5, 0x0a, 0x91, 0xf7, 0xc6, 0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x57, 0x23, 0xeb, 0x43, 0x03, 0x03, 0xba, 0xfe, 0xea, 0x78, 0x2a, 0xd5, 0xc9, 0x43, 0x67, 0xc4,
+    0x3e, 0xc9, 0x1a, 0x38, 0xf5, 0x9e, 0x04, 0x79, 0xa6, 0xff, 0x37, 0x84, 0x28, 0x36, 0xa7, 0xc2,
+    0xc1, 0xcf, 0x26, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfb, 0x02, 0x00, 0xd8, 0x1e, 0x91, 0x4d,
+    0xeb, 0x0b, 0x58, 0xaf, 0xff, 0x2d, 0xdf, 0x9c, 0xb0, 0x4e, 0x31, 0x47, 0x7f, 0x66, 0x5a, 0x28,
+    0xab, 0x26, 0x6e, 0x1c, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xd0, 0xc8, 0x40,
+    0x2c, 0x8a, 0x93, 0x73, 0x56, 0x7b, 0xd4, 0x64, 0x67, 0xe1, 0x96, 0xb3, 0x66, 0xc1, 0x6c, 0x3f,
+    0x18, 0x01, 0x17, 0x51, 0x4c, 0xb6, 0x97, 0x4e, 0xf8, 0x12, 0x1b, 0x00, 0x8d, 0x41, 0x37, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x5e, 0x03, 0x03, 0x00, 0xf5, 0x38, 0xe5, 0x8d, 0x39, 0x8e, 0x81, 0x79,
+    0xab, 0x15, 0x89, 0xc3, 0x58, 0x1d, 0xa2, 0xb2, 0xc5, 0xc8, 0xa4, 0xaf, 0x62, 0x4b, 0xf3, 0xde,
+    0x5e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x21, 0x86, 0x2f, 0x82, 0xf8, 0xd1, 0xdc,
+    0xaf, 0xf0, 0xa6, 0x96, 0x28, 0x53, 0x94, 0x25, 0xdd, 0xb1, 0x2c, 0x06, 0xa8, 0x11, 0x5d, 0x4f,
+    0xc1, 0x5d, 0x3f, 0x37, 0x63, 0xeb, 0x6e, 0x87, 0xfa, 0x33, 0x48, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x3d, 0x0b, 0x03, 0x00, 0x0a, 0x96, 0x0f, 0xe8, 0x23, 0xd4, 0xda, 0xc0, 0x0f, 0x61, 0x27, 0x2c,
+    0x9a, 0x7d, 0xb5, 0x9b, 0x44, 0x22, 0x2b, 0x4e, 0x9c, 0xe8, 0xb6, 0x08, 0x30, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf7, 0x0d, 0xd2, 0x6b, 0x76, 0xf2, 0xd4, 0x6e, 0x80, 0x18, 0xdf, 0x2a,
+    0xfe, 0xee, 0x5a, 0x1d, 0xd9, 0xed, 0xf0, 0xaf, 0xe7, 0x96, 0x91, 0xcb, 0x0e, 0x18, 0x68, 0x3a,
+    0xf1, 0x7b, 0xd6, 0x14, 0x4e, 0x56, 0x59, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x13, 0x03, 0x00,
+    0xc0, 0xe2, 0xb9, 0x49, 0xe9, 0x1e, 0x3b, 0xf6, 0x13, 0xb5, 0xd4, 0x67, 0x57, 0x0e, 0x4c, 0x67,
+    0x9a, 0xc7, 0x04, 0x56, 0x14, 0x53, 0x85, 0x85, 0x72, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7e, 0x50, 0xb5, 0x8a, 0x35, 0xad, 0x3c, 0xec, 0x00, 0x81, 0x93, 0x29, 0x51, 0xac, 0xf4, 0x3e,
+    0x59, 0x1b, 0x4e, 0xb2, 0x8e, 0x02, 0xf9, 0x5c, 0x03, 0x69, 0x90, 0xc4, 0x71, 0x3d, 0xf4, 0x65,
+    0xa3, 0xb7, 0x6a, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x1a, 0x03, 0x00, 0xec, 0xf6, 0x74, 0x91,
+    0x42, 0xde, 0xc2, 0x8d, 0xe1, 0x8b, 0xfa, 0x13, 0x87, 0x4b, 0xbe, 0x04, 0x54, 0xb9, 0x8d, 0xb7,
+    0xa6, 0xdc, 0x79, 0xf1, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x81, 0x6e, 0x43,
+    0x6f, 0x0d, 0xfa, 0x89, 0x26, 0x32, 0xe9, 0x4f, 0x52, 0x97, 0xb0, 0x22, 0xde, 0xbb, 0x6e, 0x47,
+    0xe9, 0x9f, 0x40, 0xd2, 0xec, 0xe3, 0xbb, 0xe8, 0xc5, 0xa8, 0x94, 0x6d, 0xbd, 0x0a, 0x7d, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0xda, 0x22, 0x03, 0x00, 0xec, 0xd0, 0x22, 0x40, 0x58, 0x96, 0xdd, 0xff,
+    0x47, 0x8e, 0xa7, 0x29, 0xd3, 0x17, 0x85, 0xb4, 0x33, 0x0d, 0x0e, 0xb0, 0xc3, 0x80, 0xaf, 0x22,
+    0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x44, 0xf3, 0xf7, 0x77, 0x26, 0xc8, 0x99,
+    0x5b, 0xd1, 0xc5, 0xfe, 0xea, 0x04, 0x9f, 0x8f, 0x07, 0xde, 0x55, 0x73, 0x07, 0xfd, 0x3d, 0xfa,
+    0xa1, 0xd6, 0x62, 0xad, 0xf0, 0x81, 0x75, 0x1d, 0x7b, 0x3f, 0x8e, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xb9, 0x2a, 0x03, 0x00, 0x30, 0xc5, 0x55, 0x1c, 0x7a, 0x89, 0x32, 0x81, 0xb2, 0x6a, 0x6c, 0xc2,
+    0x54, 0xbf, 0x4a, 0x1d, 0x14, 0x3b, 0x82, 0x4e, 0xcc, 0xc5, 0x13, 0x1d, 0x15, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xb4, 0xc3, 0x32, 0xed, 0x1d, 0x1b, 0x96, 0xc9, 0x86, 0x11, 0x79,
+    0x7f, 0x1d, 0xec, 0x87, 0x24, 0x17, 0x8c, 0xf3, 0x34, 0x4e, 0x8c, 0x66, 0x44, 0x3c, 0x44, 0xd1,
+    0xbd, 0xa4, 0x80, 0xa6, 0xf2, 0x28, 0xa0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x98, 0x32, 0x03, 0x00,
+    0xc7, 0xca, 0x99, 0x27, 0xd6, 0xce, 0xdc, 0x17, 0x8a, 0xff, 0x86, 0x14, 0x43, 0x85, 0x32, 0x89,
+    0x26, 0xa4, 0x7b, 0xc2, 0xc8, 0x3c, 0x60, 0x68, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xae, 0xf9, 0xec, 0x5f, 0xb5, 0x26, 0x68, 0x56, 0x37, 0xdf, 0xc8, 0x8b, 0x1d, 0x22, 0x5a, 0xd0,
+    0xf4, 0x41, 0xe5, 0x21, 0x9d, 0xa1, 0x2f, 0xa6, 0x53, 0x2a, 0x70, 0xd7, 0xe4, 0x39, 0x5a, 0xfd,
+    0x25, 0x82, 0xb2, 0x50, 0x00, 0x00, 0x00, 0x00, 0x77, 0x3a, 0x03, 0x00, 0xb4, 0x87, 0x3b, 0x1f,
+    0xad, 0x59, 0x58, 0x77, 0x2f, 0x10, 0x0b, 0x67, 0x2c, 0x16, 0x30, 0x10, 0x7a, 0xea, 0x4b, 0x1b,
+    0x8d, 0x9f, 0x4c, 0x37, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x62, 0x8a,
+    0x85, 0x5e, 0xba, 0xba, 0x63, 0x1d, 0x87, 0xfa, 0xce, 0x5b, 0xf5, 0xdc, 0xab, 0xdf, 0x55, 0x6e,
+    0xd4, 0xe0, 0xa3, 0x7f, 0xeb, 0xda, 0x22, 0x1f, 0x8a, 0xfa, 0x78, 0x24, 0x9f, 0x2b, 0xc5, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x56, 0x42, 0x03, 0x00, 0x7e, 0x40, 0x16, 0x58, 0xf0, 0x13, 0x01, 0x50,
+    0xa7, 0x33, 0xa5, 0x90, 0x8f, 0x83, 0x9e, 0x2d, 0xde, 0x0f, 0x6b, 0xcf, 0xdf, 0x5f, 0xed, 0xfe,
+    0x65, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x84, 0xce, 0x3f, 0x01, 0x82, 0x5d, 0xc4,
+    0xba, 0x8d, 0xea, 0x72, 0x21, 0xa7, 0x54, 0x87, 0x1d, 0x5b, 0x85, 0xe4, 0xb7, 0xa3, 0xbe, 0xfc,
+    0xa2, 0x2f, 0x8f, 0x56, 0xe3, 0x93, 0x3c, 0xc6, 0x55, 0xfe, 0xd9, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x35, 0x4a, 0x03, 0x00, 0xd5, 0x3b, 0x81, 0x38, 0x9a, 0xdb, 0x5a, 0xa0, 0x6f, 0x63, 0x5d, 0xfc,
+    0xeb, 0xfd, 0x1e, 0xeb, 0x10, 0x53, 0x3b, 0x54, 0x5e, 0x16, 0x05, 0xa5, 0x3f, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6e, 0x1c, 0xed, 0xcf, 0xa0, 0x21, 0x89, 0x01, 0xe7, 0x91, 0x1b, 0xf6,
+    0xef, 0x99, 0xbe, 0x37, 0x20, 0xc6, 0xc5, 0x31, 0x27, 0x8e, 0x39, 0x98, 0xa3, 0x0d, 0x3e, 0xf2,
+    0x45, 0xc0, 0x3a, 0x03, 0x97, 0x10, 0xeb, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x52, 0x03, 0x00,
+    0x3b, 0x52, 0x54, 0x68, 0x4d, 0x13, 0xf8, 0x0a, 0xe8, 0x5a, 0xe0, 0x14, 0x8e, 0x10, 0x75, 0x4b,
+    0xa8, 0x5a, 0xdc, 0x6d, 0xec, 0x53, 0x36, 0x2b, 0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x99, 0xc2, 0xbf, 0x4f, 0xc0, 0x3d, 0xc5, 0xc4, 0xde, 0xa5, 0x79, 0x0b, 0xf9, 0x91, 0xc9, 0xc8,
+    0x29, 0x5b, 0x2b, 0x41, 0x6d, 0x91, 0x6f, 0xa6, 0x90, 0x10, 0xc4, 0x46, 0xea, 0x7c, 0xe9, 0x5d,
+    0xc6, 0x15, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x59, 0x03, 0x00, 0x16, 0x64, 0x6f, 0xc9,
+    0x49, 0x34, 0x19, 0x90, 0x4c, 0x07, 0xd6, 0xde, 0x75, 0xb3, 0x8b, 0xeb, 0x05, 0x60, 0xba, 0xcb,
+    0x4a, 0x39, 0xce, 0x40, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2a, 0x89, 0x8a,
+    0x74, 0x0c, 0x34, 0x7d, 0xb2, 0xbc, 0x3e, 0x0a, 0x15, 0x81, 0x33, 0x95, 0xaf, 0x23, 0x30, 0x2a,
+    0xe1, 0x2a, 0x31, 0x61, 0x5f, 0x6a, 0x6f, 0x29, 0xb3, 0x29, 0x97, 0x94, 0x8d, 0x1b, 0x10, 0x51,
+    0x00, 0x00, 0x00, 0x00, 0xd2, 0x61, 0x03, 0x00, 0xcd, 0x13, 0x83, 0x72, 0x6b, 0x44, 0xe3, 0x80,
+    0x56, 0x55, 0x31, 0xb4, 0xc9, 0xe9, 0x1e, 0xf1, 0xec, 0xd0, 0xaf, 0xa6, 0x9d, 0xc8, 0x77, 0xc4,
+    0x8c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xfd, 0xe5, 0x86, 0x20, 0x55, 0x73, 0x2d,
+    0xc9, 0xe9, 0x59, 0xe1, 0xc9, 0x3e, 0xbe, 0xf2, 0xab, 0x1d, 0x30, 0x36, 0x67, 0xa6, 0x9b, 0x4c,
+    0x60, 0x68, 0x64, 0x65, 0xa7, 0xd3, 0x1c, 0x71, 0x4f, 0xa8, 0x20, 0x51, 0x00, 0x00, 0x00, 0x00,
+    0xb1, 0x69, 0x03, 0x00, 0x7c, 0x24, 0x27, 0x88, 0xc9, 0x07, 0x8e, 0x6f, 0xf7, 0x1a, 0x5e, 0x42,
+    0x32, 0xca, 0x25, 0xf2, 0x64, 0x1a, 0x32, 0x68, 0x0e, 0xae, 0x2b, 0xb8, 0x8f, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbc, 0x77, 0xe1, 0x26, 0x59, 0x9b, 0x56, 0xd4, 0xdc, 0xa9, 0xaa, 0xf3,
+    0x3a, 0xd2, 0x8b, 0xb3, 0xed, 0x5d, 0xc9, 0x66, 0x5f, 0x65, 0xf9, 0xc7, 0x6c, 0xdb, 0xea, 0x6a,
+    0x92, 0xfb, 0xaf, 0xa5, 0x68, 0xf2, 0x2f, 0x51, 0x00, 0x00, 0x00, 0x00, 0x90, 0x71, 0x03, 0x00,
+    0x7a, 0x5b, 0x28, 0x5d, 0x6a, 0x7a, 0x12, 0x78, 0xc8, 0xc5, 0x4b, 0x46, 0x07, 0x47, 0x78, 0x65,
+    0x37, 0xb3, 0xdf, 0xb8, 0xd3, 0xac, 0x31, 0x0d, 0xc8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8b, 0xe1, 0x73, 0x3d, 0x9b, 0x38, 0xa9, 0x98, 0xef, 0xdf, 0x2d, 0x36, 0x79, 0x90, 0xe4, 0x96,
+    0x3d, 0xb7, 0x4a, 0x4a, 0x21, 0x5e, 0x37, 0xaa, 0x20, 0x5a, 0x80, 0x17, 0x2f, 0xab, 0x9b, 0xa9,
+    0x5e, 0xc2, 0x40, 0x51, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x79, 0x03, 0x00, 0x0b, 0xc2, 0xce, 0x5a,
+    0x4a, 0x2f, 0x3b, 0x43, 0x2d, 0x68, 0x34, 0x3f, 0xc7, 0xd5, 0x0a, 0x23, 0x95, 0x4f, 0xb6, 0x94,
+    0x0c, 0xa4, 0x03, 0x38, 0x63, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xb2, 0x2c, 0x0b,
+    0x4b, 0x2e, 0xcf, 0x29, 0xe9, 0x92, 0xe9, 0x0d, 0xb9, 0x5d, 0x96, 0x3f, 0x87, 0x35, 0x56, 0x37,
+    0xc6, 0xd2, 0x09, 0x56, 0xf4, 0x59, 0xa2, 0xbe, 0x87, 0x0e, 0x58, 0x39, 0x41, 0x45, 0x4e, 0x51,
+    0x00, 0x00, 0x00, 0x00, 0x4e, 0x81, 0x03, 0x00, 0xe7, 0xdb, 0x74, 0xee, 0xd6, 0x12, 0x3c, 0xcc,
+    0x02, 0x2a, 0x82, 0x75, 0x05, 0x7a, 0x61, 0x1a, 0xaa, 0x33, 0x99, 0xa5, 0xfe, 0x17, 0xa4, 0x9e,
+    0x3b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x6d, 0xf8, 0x67, 0x49, 0xba, 0xed, 0xb2,
+    0x5f, 0xc3, 0x6a, 0x8e, 0x57, 0x5c, 0xe5, 0x25, 0x01, 0x22, 0xc0, 0x29, 0xe8, 0xe3, 0x03, 0xc5,
+    0x97, 0x55, 0x8a, 0xda, 0x82, 0x07, 0xd4, 0x95, 0x98, 0x06, 0x5e, 0x51, 0x00, 0x00, 0x00, 0x00,
+    0x2d, 0x89, 0x03, 0x00, 0x1a, 0xbc, 0x52, 0x53, 0xfa, 0x00, 0x44, 0x8e, 0xd2, 0xc8, 0x2b, 0x31,
+    0xac, 0xd3, 0x0d, 0x1d, 0x66, 0xa9, 0xb2, 0x62, 0xf3, 0x40, 0xe5, 0xd4, 0x72, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0xc7, 0x58, 0xde, 0x15, 0x73, 0xe5, 0x82, 0x06, 0x57, 0x0a,
+    0x9a, 0xaa, 0xaa, 0xe7, 0xcd, 0x76, 0x80, 0x00, 0xc8, 0x88, 0xc9, 0x03, 0xef, 0x24, 0x47, 0xd3,
+    0x7e, 0x0f, 0x78, 0x6d, 0x62, 0xf1, 0x6d, 0x51, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x91, 0x03, 0x00,
+    0x5d, 0x73, 0x5d, 0x0e, 0xb4, 0xe5, 0x6b, 0x19, 0xff, 0x7c, 0x65, 0xce, 0xd0, 0xea, 0x1c, 0x57,
+    0x4d, 0x02, 0x5b, 0x0d, 0x73, 0x0b, 0xe1, 0x6e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1a, 0xb0, 0x47, 0xfd, 0x53, 0x73, 0x5c, 0x76, 0xb8, 0x93, 0x05, 0x22, 0x22, 0xb1, 0x2f, 0x07,
+    0x50, 0x6d, 0xc9, 0x7f, 0xab, 0x26, 0x18, 0x4e, 0xba, 0x1d, 0x66, 0x0d, 0x38, 0xb0, 0x66, 0x1a,
+    0x50, 0x6d, 0x7e, 0x51, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x98, 0x03, 0x00, 0xac, 0x06, 0xc6, 0x3a,
+    0x75, 0x16, 0xc5, 0xd2, 0xf0, 0xb2, 0x77, 0x2d, 0x26, 0xa9, 0x5e, 0x6a, 0xfe, 0xe4, 0x43, 0x4e,
+    0x8e, 0x82, 0x6b, 0xa4, 0x8f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x62, 0xed, 0xde,
+    0xc3, 0x37, 0x75, 0x54, 0x36, 0x41, 0x8c, 0x91, 0x67, 0xfe, 0xff, 0x95, 0x4b, 0x44, 0x87, 0x76,
+    0xe0, 0xcb, 0xfa, 0x19, 0x12, 0x87, 0xd1, 0xbe, 0x2b, 0x1f, 0xc1, 0xa5, 0xeb, 0x07, 0x8f, 0x51,
+    0x00, 0x00, 0x00, 0x00, 0xca, 0xa0, 0x03, 0x00, 0x3a, 0x6d, 0xbd, 0x04, 0xf2, 0x9d, 0x83, 0xe7,
+    0xa5, 0x64, 0xf5, 0x87, 0x67, 0x2b, 0xdd, 0x91, 0x35, 0x88, 0xfc, 0x4b, 0xf9, 0x3d, 0x2c, 0x28,
+    0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xe2, 0xde, 0xd6, 0xad, 0xff, 0x41, 0xf8,
+    0x39, 0xe4, 0xfc, 0xd9, 0x5c, 0x84, 0x8f, 0x0a, 0x13, 0xe2, 0xd1, 0xd5, 0xd2, 0x4d, 0x98, 0x6c,
+    0x73, 0x38, 0x3a, 0xbc, 0x54, 0x9b, 0xea, 0x20, 0xe5, 0x00, 0xa0, 0x51, 0x00, 0x00, 0x00, 0x00,
+    0xa9, 0xa8, 0x03, 0x00, 0x82, 0xd1, 0x04, 0xe3, 0x21, 0xc2, 0x7a, 0xf5, 0xdd, 0x07, 0xa0, 0xef,
+    0xc2, 0xec, 0x6d, 0x20, 0xc9, 0x07, 0xff, 0x55, 0x98, 0xc8, 0x87, 0xb7, 0x6a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x37, 0x55, 0x71, 0xa2, 0x85, 0xb5, 0xac, 0x6b, 0x30, 0x89, 0x5d,
+    0xec, 0xce, 0x2c, 0x5b, 0xb2, 0xbc, 0x02, 0x01, 0x62, 0x69, 0x65, 0xa4, 0xfc, 0x2a, 0xb1, 0xb7,
+    0xe1, 0xa0, 0x6d, 0x79, 0xc5, 0x77, 0xae, 0x51, 0x00, 0x00, 0x00, 0x00, 0x88, 0xb0, 0x03, 0x00,
+    0xb8, 0xaa, 0xe0, 0x7d, 0x9d, 0xac, 0x61, 0x1f, 0x8b, 0xa1, 0xd1, 0x87, 0xf6, 0x9e, 0x41, 0x29,
+    0xc6, 0xd9, 0x1d, 0xc3, 0xac, 0x42, 0xe0, 0xf2, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2b, 0x83, 0x5c, 0xd5, 0x24, 0xef, 0xbc, 0xb1, 0xfd, 0xa1, 0x2c, 0x86, 0x3e, 0x19, 0x7f, 0x57,
+    0x82, 0x83, 0x8d, 0x08, 0xf5, 0x3d, 0xc2, 0xb9, 0x92, 0x20, 0x25, 0x6e, 0x06, 0x07, 0xfe, 0x47,
+    0xe0, 0x53, 0xbd, 0x51, 0x00, 0x00, 0x00, 0x00, 0x67, 0xb8, 0x03, 0x00, 0xb2, 0xfd, 0x34, 0x0f,
+    0x2d, 0x22, 0xbb, 0xf8, 0x45, 0xb6, 0x45, 0x14, 0xdc, 0xfd, 0xf5, 0x84, 0x4b, 0x7e, 0x9a, 0x0f,
+    0x09, 0x98, 0x5e, 0x34, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xa8, 0xdd, 0x7c,
+    0x20, 0xb4, 0x74, 0x98, 0x13, 0x3e, 0x2a, 0xe5, 0xb1, 0x58, 0x4c, 0x96, 0xbf, 0x49, 0xf7, 0xa4,
+    0xf2, 0x30, 0xee, 0x2f, 0x20, 0xd1, 0xfa, 0xd9, 0xbf, 0x85, 0xaa, 0xa2, 0x8c, 0xe3, 0xcd, 0x51,
+    0x00, 0x00, 0x00, 0x00, 0x46, 0xc0, 0x03, 0x00, 0x73, 0xdb, 0x2d, 0x3d, 0xb3, 0x75, 0x01, 0x5e,
+    0x4c, 0xa1, 0xa6, 0x2a, 0x34, 0xbd, 0x3d, 0x01, 0x4f, 0xbe, 0x1a, 0xdb, 0x61, 0x5a, 0xa4, 0x67,
+    0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x90, 0x34, 0x3b, 0xef, 0xf7, 0x7b, 0x80,
+    0x60, 0xd8, 0xc8, 0xb5, 0xec, 0xb8, 0x59, 0x0f, 0x45, 0x2a, 0xc5, 0x9d, 0xb8, 0x2d, 0x86, 0xc0,
+    0xe1, 0x89, 0x0a, 0x5e, 0x88, 0x06, 0x64, 0xb8, 0xc1, 0x2d, 0xdd, 0x51, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0xc8, 0x03, 0x00, 0xcd, 0x2f, 0x0a, 0x03, 0x30, 0x22, 0x90, 0xf4, 0x20, 0x17, 0xa0, 0x59,
+    0x56, 0x3a, 0x81, 0x57, 0x70, 0xc8, 0xa9, 0x5b, 0x77, 0xd8, 0x18, 0xd0, 0x88, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd1, 0xfe, 0x24, 0xf0, 0x6d, 0x1b, 0x47, 0x79, 0x0b, 0xfa, 0x34, 0x92,
+    0xd7, 0x1f, 0xce, 0xa8, 0x00, 0x91, 0xc3, 0x8a, 0x39, 0xba, 0x0b, 0x34, 0xad, 0x13, 0xec, 0x57,
+    0x30, 0x8c, 0x10, 0x5b, 0x22, 0x8c, 0xec, 0x51, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd0, 0x03, 0x00,
+    0x18, 0xa2, 0x69, 0xd5, 0x6e, 0xac, 0xc7, 0x11, 0xa0, 0xb4, 0x7f, 0xd8, 0x55, 0x85, 0xe9, 0x3c,
+    0x3e, 0xa4, 0x88, 0x8c, 0xfa, 0x66, 0x1f, 0x84, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0xb1, 0x73, 0x0f, 0x9b, 0xdf, 0xc7, 0x99, 0xa9, 0x89, 0x83, 0x78, 0x4b, 0x4f, 0x6e, 0x89,
+    0xda, 0xaa, 0x80, 0x63, 0x50, 0x20, 0xf3, 0xe0, 0xb2, 0xfa, 0x17, 0x7b, 0xc1, 0xfa, 0x8e, 0x84,
+    0xdd, 0x05, 0xfc, 0x51, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xd7, 0x03, 0x00, 0x68, 0x51, 0x6a, 0x2a,
+    0xe6, 0x0c, 0xa5, 0x66, 0x7a, 0x54, 0x6d, 0xca, 0xf3, 0x0c, 0x13, 0xfa, 0xc6, 0xb4, 0x11, 0x5f,
+    0x78, 0x08, 0x1d, 0xb2, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xaf, 0xb7, 0x97,
+    0xab, 0xad, 0x6a, 0xc1, 0xb2, 0x37, 0xef, 0x29, 0xe8, 0x7d, 0xb2, 0x52, 0x90, 0xef, 0x16, 0x77,
+    0xa4, 0x68, 0x7b, 0x2c, 0x7b, 0x72, 0x94, 0x2d, 0x8a, 0xbb, 0x4b, 0xf8, 0xe2, 0xa8, 0x09, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0xc2, 0xdf, 0x03, 0x00, 0xe9, 0x07, 0xa2, 0xd8, 0x95, 0x2b, 0xe1, 0x39,
+    0xc5, 0xff, 0x42, 0x8c, 0xd1, 0xb6, 0x8f, 0xb8, 0x60, 0xe9, 0x66, 0xfb, 0x90, 0xa3, 0xc3, 0x5c,
+    0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0xfe, 0xa5, 0xb4, 0x57, 0xc2, 0x47,
+    0xac, 0x72, 0xa7, 0xa0, 0xb1, 0x60, 0xc1, 0x7a, 0xdd, 0x0e, 0x08, 0xe8, 0xdd, 0x9d, 0xdb, 0x4c,
+    0xcc, 0x49, 0x28, 0xdd, 0x59, 0xfb, 0x87, 0x69, 0x67, 0xe5, 0x17, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0xa1, 0xe7, 0x03, 0x00, 0x52, 0xe1, 0x90, 0xc3, 0x0a, 0xf5, 0x25, 0xfe, 0x0b, 0x1f, 0x5f, 0x04,
+    0x08, 0x22, 0xd2, 0xdd, 0x4c, 0x11, 0xb2, 0x2c, 0x36, 0x10, 0xf7, 0xba, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc8, 0xc1, 0xfc, 0xe6, 0x2e, 0x31, 0x71, 0xb8, 0x87, 0x84, 0xf8, 0x1e,
+    0x31, 0x86, 0x59, 0x82, 0xce, 0x5f, 0x5f, 0xd1, 0xb8, 0x8e, 0x9d, 0x06, 0xc4, 0xf8, 0x95, 0x16,
+    0xc4, 0x1b, 0x23, 0x34, 0x8c, 0xef, 0x25, 0x52, 0x00, 0x00, 0x00, 0x00, 0x80, 0xef, 0x03, 0x00,
+    0x48, 0x36, 0x1f, 0xd1, 0xff, 0xf7, 0xb2, 0xdd, 0x84, 0xf2, 0x5c, 0x64, 0x25, 0x46, 0x50, 0xca,
+    0x56, 0x90, 0xb3, 0x14, 0x88, 0xc7, 0x33, 0x16, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x83, 0x65, 0x8a, 0xf1, 0xa2, 0x61, 0xc5, 0x0d, 0xfb, 0xa6, 0x1b, 0xb5, 0xef, 0x9e, 0x80,
+    0x2c, 0xb1, 0x12, 0x23, 0xf7, 0x01, 0xe7, 0xff, 0x96, 0xd2, 0x97, 0x4f, 0xc4, 0xef, 0x36, 0xa1,
+    0x44, 0x35, 0x34, 0x52, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf7, 0x03, 0x00, 0x8b, 0x26, 0x6c, 0xce,
+    0x25, 0xbe, 0x81, 0x9f, 0x6a, 0xd3, 0x8a, 0xfe, 0xd0, 0x60, 0xa1, 0x2d, 0xaf, 0xfd, 0xab, 0xf6,
+    0x5c, 0x3a, 0x21, 0xb6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x93, 0x85, 0x58,
+    0x4e, 0x03, 0x2b, 0x5a, 0x03, 0x9b, 0xb6, 0xc9, 0x97, 0x72, 0x92, 0x0f, 0x6a, 0x4f, 0xba, 0xcc,
+    0x66, 0xf2, 0x55, 0xd0, 0x96, 0x71, 0xd9, 0x46, 0x65, 0x85, 0x65, 0x4c, 0xb7, 0x2a, 0x42, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0x03, 0x00, 0x5e, 0x84, 0xb8, 0x43, 0x98, 0x02, 0x9d, 0xa9,
+    0x2a, 0xa5, 0x0b, 0x22, 0xbd, 0xad, 0xcd, 0xca, 0xaa, 0xed, 0x4f, 0xe8, 0x11, 0xe0, 0x5d, 0x51,
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xab, 0xa0, 0xd8, 0x3d, 0xfc, 0x41, 0x91,
+    0xc2, 0x41, 0xeb, 0x0e, 0x43, 0x5d, 0x36, 0x22, 0x42, 0x2e, 0x13, 0x39, 0x24, 0x7f, 0xdf, 0x43,
+    0xf3, 0x34, 0xaa, 0x4f, 0x60, 0x7e, 0x0d, 0x89, 0xec, 0x91, 0x50, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0x1d, 0x07, 0x04, 0x00, 0xee, 0xf4, 0xe6, 0x73, 0xf9, 0x86, 0xed, 0x58, 0x68, 0x81, 0xbd, 0x36,
+    0xec, 0x27, 0xb2, 0x94, 0xa3, 0x48, 0x60, 0xaf, 0x33, 0xc3, 0x96, 0x53, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x91, 0x2b, 0x2a, 0x7b, 0xb1, 0xa1, 0x77, 0x7c, 0x88, 0x6d,
+    0xcb, 0x27, 0xda, 0xf3, 0x0e, 0x63, 0x22, 0x7a, 0x9a, 0x28, 0x56, 0x3f, 0xc6, 0x7f, 0x0a, 0xae,
+    0xb6, 0xe2, 0xfb, 0xe8, 0xfa, 0xd2, 0x5d, 0x52, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x0e, 0x04, 0x00,
+    0x75, 0x18, 0x42, 0x81, 0x2a, 0xa8, 0x81, 0xc7, 0x8d, 0x57, 0xfb, 0x9b, 0x71, 0x23, 0xae, 0xb6,
+    0xfe, 0x56, 0xf6, 0x1c, 0x51, 0xfb, 0xdb, 0xc7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6c, 0xf1, 0xdc, 0x41, 0x94, 0xdb, 0x16, 0xc9, 0x21, 0x7e, 0xa3, 0x4d, 0xb9, 0xad, 0xc7, 0x4e,
+    0xe9, 0xf6, 0x2f, 0xe4, 0x35, 0x18, 0x7b, 0x45, 0xc3, 0x27, 0x0d, 0x7a, 0x0c, 0x0b, 0xd6, 0x41,
+    0x6d, 0x76, 0x6a, 0x52, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x16, 0x04, 0x00, 0xa6, 0xb3, 0xc3, 0x96,
+    0x7a, 0xe7, 0xc1, 0x3f, 0x72, 0x62, 0x18, 0xce, 0x42, 0x7d, 0x4c, 0x40, 0x9a, 0x16, 0x59, 0xa8,
+    0xcc, 0x9f, 0x9b, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xf4, 0x2a, 0x35,
+    0xf8, 0x17, 0x3c, 0xe3, 0x94, 0x24, 0x5a, 0x26, 0x3e, 0xe1, 0x3e, 0xae, 0x6e, 0x73, 0xcf, 0x1d,
+    0x63, 0x41, 0x57, 0xa1, 0x0f, 0x79, 0xf0, 0xee, 0x26, 0x95, 0x56, 0xd4, 0x00, 0x45, 0x78, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0xba, 0x1e, 0x04, 0x00, 0x7d, 0xfe, 0x6c, 0x7c, 0xd2, 0x1c, 0xeb, 0x33,
+    0xfc, 0x94, 0x5b, 0xb2, 0x48, 0xc1, 0x76, 0xef, 0xb7, 0x95, 0x70, 0x7a, 0xc7, 0x99, 0xcd, 0x69,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x0d, 0x5e, 0xaa, 0x88, 0x1a, 0xaf, 0x97,
+    0x21, 0x77, 0x28, 0xbc, 0x5c, 0xf4, 0x37, 0x2a, 0x52, 0x01, 0xce, 0xd0, 0xad, 0xa0, 0x5b, 0x90,
+    0x9d, 0x5c, 0xe8, 0x19, 0x52, 0x40, 0x16, 0xae, 0x25, 0xf8, 0x87, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0x99, 0x26, 0x04, 0x00, 0x14, 0x69, 0x03, 0x9d, 0xe5, 0xd3, 0xb4, 0x28, 0xb3, 0x3e, 0xa6, 0xd7,
+    0xa1, 0x26, 0xe4, 0x1f, 0xf8, 0xa7, 0xde, 0x4a, 0x69, 0xb0, 0xef, 0x9b, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x0f, 0x40, 0xa7, 0xfe, 0x27, 0x12, 0x5c, 0x82, 0x62, 0x64, 0x0f,
+    0x54, 0xc8, 0x50, 0x3b, 0x49, 0x48, 0xa8, 0xf0, 0x7b, 0x67, 0xef, 0xa7, 0x68, 0x4e, 0x6b, 0xc8,
+    0x8a, 0x35, 0xe8, 0x6f, 0xae, 0xcb, 0x97, 0x52, 0x00, 0x00, 0x00, 0x00, 0x78, 0x2e, 0x04, 0x00,
+    0xcb, 0xc8, 0x1b, 0x64, 0x07, 0xff, 0xdb, 0x26, 0x2b, 0x88, 0x58, 0x1e, 0x83, 0x81, 0xe5, 0x0d,
+    0xae, 0xf7, 0x63, 0x4c, 0xbc, 0x74, 0x11, 0xf6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe7, 0x2b, 0x69, 0x79, 0x36, 0x3b, 0xfa, 0x0e, 0x73, 0x67, 0x4a, 0xc1, 0x96, 0x27, 0x86, 0xc8,
+    0x1d, 0xe6, 0x11, 0x0d, 0x23, 0x62, 0x27, 0x64, 0xc7, 0x84, 0x85, 0x6d, 0x60, 0xf0, 0x2f, 0xe0,
+    0x1b, 0x4f, 0xa6, 0x52, 0x00, 0x00, 0x00, 0x00, 0x57, 0x36, 0x04, 0x00, 0x55, 0xb4, 0xbd, 0xdb,
+    0x3d, 0x0e, 0xe2, 0xf1, 0x1d, 0xdb, 0xdc, 0x3e, 0x95, 0xb3, 0xb8, 0x71, 0xba, 0x70, 0xa2, 0xb4,
+    0xb0, 0x82, 0x32, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xba, 0xc7, 0xe1,
+    0x40, 0x77, 0x8b, 0xf6, 0x30, 0x7f, 0x6c, 0xda, 0xae, 0x80, 0x79, 0xe2, 0x86, 0x22, 0xc8, 0x5d,
+    0xe3, 0x9b, 0x9e, 0x87, 0xbb, 0x15, 0xbf, 0xab, 0x4a, 0xd1, 0x1b, 0xfe, 0x29, 0x39, 0xb4, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x36, 0x3e, 0x04, 0x00, 0x0f, 0x48, 0xd8, 0xbd, 0x96, 0x26, 0x5d, 0x26,
+    0x3b, 0x38, 0xdb, 0x64, 0x0e, 0x50, 0xa2, 0xe9, 0x8d, 0x3c, 0xd5, 0xac, 0xb4, 0x9a, 0x61, 0x61,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xee, 0x39, 0xcf, 0xe3, 0x6c, 0x48, 0x44,
+    0x7a, 0x40, 0x46, 0xe6, 0x74, 0xd5, 0xaf, 0x47, 0x02, 0xe7, 0xa1, 0x29, 0x1a, 0xfc, 0x9f, 0x69,
+    0x62, 0xcc, 0x96, 0x98, 0x0f, 0x7e, 0xb3, 0x5e, 0x4a, 0xd0, 0xc3, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x46, 0x04, 0x00, 0xf4, 0x72, 0x54, 0xba, 0xb0, 0xf4, 0x8f, 0xa4, 0x81, 0x6b, 0x22, 0x67,
+    0x2e, 0x5e, 0xbd, 0xf6, 0x5f, 0xd5, 0x14, 0x05, 0x24, 0x91, 0xf2, 0x01, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x68, 0x63, 0x37, 0x47, 0xae, 0x15, 0xf1, 0x7f, 0xa0, 0xf2, 0x16, 0x52,
+    0x58, 0x31, 0xb4, 0x3b, 0xc0, 0x79, 0xc5, 0xab, 0x23, 0x19, 0xdf, 0xdf, 0x1c, 0xb2, 0x3f, 0xfc,
+    0x88, 0xdb, 0xe9, 0x31, 0xe4, 0x82, 0xd2, 0x52, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x4d, 0x04, 0x00,
+    0xd5, 0x01, 0x50, 0x09, 0x11, 0xbc, 0x19, 0x3d, 0x8e, 0x7b, 0x21, 0x43, 0x1f, 0xb2, 0xd4, 0x68,
+    0xec, 0xca, 0x5e, 0x9f, 0x50, 0x1a, 0x73, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0xf0, 0xa4, 0x22, 0x80, 0x58, 0x42, 0xac, 0xc6, 0x1e, 0xad, 0xfb, 0xe4, 0x39, 0xf7, 0x42,
+    0x78, 0xbf, 0xe4, 0x22, 0xf6, 0x60, 0xdf, 0xd1, 0xf9, 0x09, 0x2d, 0x40, 0x2e, 0x56, 0xf0, 0x1e,
+    0x26, 0x7c, 0xe1, 0x52, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x55, 0x04, 0x00, 0x32, 0x30, 0xf3, 0x13,
+    0xc5, 0x74, 0xcd, 0xa1, 0x6c, 0x63, 0x38, 0x2e, 0x5e, 0xf0, 0xec, 0xc7, 0xbb, 0x51, 0x0c, 0x76,
+    0xc9, 0xd1, 0x94, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x8b, 0xc3, 0xe8,
+    0x85, 0x9f, 0xc5, 0xfb, 0x11, 0x68, 0x74, 0xda, 0x1e, 0x0c, 0x2d, 0x0b, 0x47, 0x1c, 0xc0, 0x72,
+    0x91, 0x6a, 0xa1, 0xec, 0x02, 0xe7, 0xde, 0x20, 0x28, 0x99, 0x60, 0xf4, 0x04, 0xd6, 0xf0, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0xb2, 0x5d, 0x04, 0x00, 0x42, 0x14, 0x94, 0xbb, 0x80, 0x76, 0x2f, 0xf4,
+    0x55, 0x48, 0xe6, 0x5c, 0x56, 0xec, 0xae, 0x1c, 0x51, 0xe2, 0x92, 0x42, 0x4c, 0xa8, 0x4c, 0x37,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x63, 0xb2, 0xd2, 0x07, 0xa0, 0x23, 0xb4,
+    0x2d, 0x41, 0x67, 0xdf, 0x36, 0xa4, 0x4c, 0x93, 0xf0, 0x30, 0x1e, 0xb9, 0xb8, 0x8d, 0x35, 0x87,
+    0x6a, 0x15, 0xcf, 0x2b, 0xd2, 0xf8, 0x23, 0xea, 0xe1, 0x5e, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x65, 0x04, 0x00, 0x1c, 0x9b, 0xd6, 0x69, 0x94, 0x53, 0xb6, 0xa5, 0x3c, 0x5e, 0x7a, 0xd9,
+    0x49, 0x0d, 0xf7, 0xd7, 0x2c, 0xb6, 0x0e, 0x69, 0x89, 0x8c, 0x77, 0x26, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x4e, 0x46, 0xfa, 0x72, 0x1a, 0x86, 0x68, 0xd8, 0x49, 0x92, 0xb6,
+    0x23, 0x9b, 0x14, 0x0f, 0xc1, 0xdc, 0x38, 0xfc, 0x93, 0x91, 0x17, 0x21, 0x5f, 0x49, 0xec, 0x07,
+    0x47, 0x4f, 0x0b, 0xe1, 0xd8, 0x82, 0x0f, 0x53, 0x00, 0x00, 0x00, 0x00, 0x70, 0x6d, 0x04, 0x00,
+    0xfc, 0x5b, 0xe7, 0x98, 0x8e, 0xc0, 0x8c, 0x34, 0x0a, 0x23, 0xda, 0xb8, 0x00, 0x54, 0x57, 0xa2,
+    0xd7, 0x79, 0xe7, 0xee, 0x08, 0x85, 0x05, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0xac, 0xa4, 0xe3, 0x48, 0xff, 0xb7, 0x15, 0x83, 0xdc, 0x58, 0xba, 0xea, 0x7b, 0xe1, 0xee,
+    0x15, 0xe4, 0xee, 0x1e, 0x8a, 0xd8, 0xef, 0xf2, 0xae, 0xf1, 0x76, 0xce, 0x4a, 0xf5, 0x4a, 0xf4,
+    0x6a, 0x0c, 0x20, 0x53, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x75, 0x04, 0x00, 0x4a, 0xbe, 0xe7, 0x7c,
+    0x4a, 0xeb, 0xc7, 0x67, 0x59, 0x9c, 0x0b, 0xcd, 0x15, 0x7d, 0x31, 0x17, 0x19, 0x97, 0x02, 0x1b,
+    0x41, 0x47, 0xa7, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x25, 0x66, 0xb1,
+    0x6b, 0x90, 0x80, 0x06, 0x47, 0xa3, 0xc3, 0x25, 0x21, 0x01, 0x7d, 0xad, 0x3c, 0xcb, 0x38, 0x19,
+    0xf0, 0x44, 0xec, 0x9c, 0x9a, 0x70, 0xf5, 0x7c, 0x03, 0x41, 0xa7, 0x80, 0xc8, 0xcb, 0x2f, 0x53,
+    0x00, 0x00, 0x00, 0x00, 0x2e, 0x7d, 0x04, 0x00, 0xa7, 0x34, 0xda, 0x07, 0x5f, 0xb2, 0xdf, 0xfa,
+    0x9c, 0xad, 0xa1, 0x37, 0x51, 0x6a, 0xa4, 0x65, 0x38, 0x9c, 0xba, 0x4c, 0x76, 0x5e, 0x06, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x24, 0x24, 0x55, 0x8a, 0x04, 0x87, 0x52,
+    0x26, 0xbb, 0xcc, 0x5f, 0x21, 0x5f, 0x35, 0x47, 0x8f, 0xe5, 0xb7, 0x50, 0x65, 0x85, 0xc4, 0xef,
+    0x76, 0x66, 0xef, 0xb7, 0x59, 0xc8, 0x85, 0x5d, 0x5c, 0xd9, 0x3e, 0x53, 0x00, 0x00, 0x00, 0x00,
+    0x0d, 0x85, 0x04, 0x00, 0xeb, 0xe9, 0xe6, 0x40, 0x39, 0xe2, 0x39, 0xa5, 0xc4, 0x04, 0x98, 0xe8,
+    0x86, 0xb0, 0x49, 0x8d, 0x69, 0x03, 0xa8, 0xd3, 0x64, 0xdf, 0x89, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe3, 0x3d, 0x9d, 0x73, 0x0e, 0x8c, 0x5d, 0x2c, 0x67, 0x27, 0x6d, 0x68,
+    0xd9, 0xf3, 0xd0, 0x57, 0x34, 0x06, 0x29, 0x4f, 0xf9, 0x98, 0xc0, 0x9e, 0xbd, 0x06, 0x7d, 0x4e,
+    0x03, 0xad, 0x98, 0xb0, 0xd0, 0xf3, 0x4e, 0x53, 0x00, 0x00, 0x00, 0x00, 0xec, 0x8c, 0x04, 0x00,
+    0x6d, 0xb9, 0x47, 0xdb, 0x1a, 0x03, 0x56, 0x37, 0x58, 0x61, 0xc8, 0xd6, 0xe9, 0xf1, 0x25, 0xb6,
+    0x0c, 0xc0, 0xe1, 0xb5, 0x64, 0x12, 0x8c, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9d, 0xce, 0x35, 0x4b, 0x22, 0x2f, 0x45, 0xf7, 0xd5, 0xa9, 0xb2, 0x6a, 0xeb, 0x76, 0xe2, 0xae,
+    0xa7, 0x32, 0xaf, 0xb0, 0x01, 0x01, 0xbb, 0xf9, 0xc5, 0x84, 0x08, 0x98, 0xb3, 0x21, 0x5c, 0x8e,
+    0x31, 0x10, 0x5f, 0x53, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x94, 0x04, 0x00, 0xee, 0x1a, 0xbe, 0x27,
+    0xab, 0xe9, 0x6a, 0xf1, 0xdb, 0x91, 0x5e, 0xa3, 0xd0, 0xc3, 0x0b, 0x8a, 0x99, 0x3a, 0x07, 0xc2,
+    0x77, 0x14, 0x20, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x09, 0x2b, 0xe3,
+    0x0f, 0x89, 0xba, 0xd0, 0x4c, 0x59, 0xfb, 0xe4, 0x7b, 0xe1, 0xe5, 0x7f, 0xea, 0x53, 0x54, 0x63,
+    0x64, 0xb3, 0x36, 0x1f, 0xed, 0xe4, 0x21, 0x16, 0xcb, 0xf3, 0xed, 0xca, 0x71, 0x88, 0x6f, 0x53,
+    0x00, 0x00, 0x00, 0x00, 0xaa, 0x9c, 0x04, 0x00, 0x56, 0x8a, 0x8e, 0x4a, 0x49, 0xbb, 0xf0, 0x0b,
+    0x25, 0xae, 0xbc, 0x36, 0xad, 0xb6, 0xc0, 0xf1, 0xd0, 0x80, 0x7a, 0x1a, 0x27, 0x48, 0x6a, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x3f, 0x4c, 0x4b, 0x35, 0x53, 0xd7, 0xa3,
+    0x21, 0x82, 0x29, 0x0a, 0x41, 0x1a, 0xae, 0xf2, 0x97, 0x95, 0xb8, 0x75, 0xed, 0xc1, 0x8d, 0x39,
+    0x00, 0x02, 0xba, 0x4a, 0xec, 0x6c, 0x0c, 0x03, 0x4b, 0x60, 0x7f, 0x53, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0xa4, 0x04, 0x00, 0xb0, 0xf8, 0xc7, 0x2e, 0x56, 0xcf, 0x1e, 0x5e, 0x82, 0xf3, 0x5d, 0xf5,
+    0x3b, 0x85, 0x23, 0xd6, 0x3c, 0x53, 0xb8, 0xd0, 0xc0, 0x4c, 0x76, 0x4f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0x3e, 0xbb, 0x0d, 0xa8, 0x91, 0xa3, 0xae, 0x3d, 0xd1, 0x78, 0x33,
+    0xd7, 0x98, 0x74, 0xac, 0x5a, 0x0b, 0xba, 0x7b, 0x9c, 0x2d, 0xd2, 0xa4, 0xcb, 0x7f, 0x9c, 0x7f,
+    0xcb, 0x33, 0x01, 0x38, 0xe1, 0x9d, 0x8f, 0x53, 0x00, 0x00, 0x00, 0x00, 0x68, 0xac, 0x04, 0x00,
+    0x42, 0xab, 0x2c, 0x7e, 0x7c, 0xd8, 0xbf, 0x88, 0x60, 0x34, 0x0f, 0x5a, 0xb9, 0x80, 0xbe, 0xca,
+    0x03, 0xc5, 0x16, 0xe3, 0x18, 0x4a, 0xd6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd1, 0x42, 0xa1, 0x23, 0x35, 0x63, 0x4d, 0x14, 0x47, 0x37, 0x1c, 0xf1, 0x74, 0x1d, 0x68, 0xcf,
+    0x4b, 0x0f, 0x12, 0x8b, 0x20, 0x9d, 0x50, 0x0d, 0xfc, 0xbc, 0xe8, 0x26, 0xb4, 0xc9, 0xe3, 0x23,
+    0x0f, 0xec, 0x9f, 0x53, 0x00, 0x00, 0x00, 0x00, 0x47, 0xb4, 0x04, 0x00, 0xd5, 0xbf, 0xb8, 0xa8,
+    0x04, 0xa9, 0xdb, 0xe5, 0x51, 0x85, 0x67, 0xdc, 0xb5, 0xe2, 0xae, 0x9a, 0x65, 0xb6, 0xa3, 0x2e,
+    0x19, 0xb8, 0x5f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x8f, 0xd5, 0x10,
+    0xdd, 0xed, 0x0e, 0x2a, 0x4d, 0xaa, 0x9e, 0xb5, 0xc4, 0xe5, 0x9c, 0xc1, 0x95, 0xe2, 0xb0, 0x1d,
+    0x2a, 0x18, 0x3f, 0xa8, 0xb3, 0x0f, 0xf3, 0xb9, 0x44, 0x40, 0xbf, 0xea, 0x57, 0xbf, 0xae, 0x53,
+    0x00, 0x00, 0x00, 0x00, 0x26, 0xbc, 0x04, 0x00, 0xaf, 0x05, 0xbc, 0xaa, 0x8e, 0xba, 0x7f, 0xfc,
+    0xbd, 0x59, 0xda, 0x39, 0x3d, 0x72, 0x93, 0xd1, 0x83, 0x05, 0xa7, 0x26, 0x6b, 0x8c, 0x8a, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xee, 0x05, 0xbc, 0xfb, 0xf7, 0x32, 0xd5,
+    0xa9, 0x6c, 0xfb, 0x2d, 0x14, 0x8f, 0x82, 0x69, 0xd2, 0xfd, 0x32, 0x9e, 0xb6, 0xbf, 0xe3, 0x3a,
+    0xf7, 0x3d, 0x30, 0xec, 0x8b, 0xd0, 0x1a, 0xc3, 0x43, 0x79, 0xc0, 0x53, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xc4, 0x04, 0x00, 0x76, 0xb1, 0x4a, 0x38, 0xe2, 0x11, 0x66, 0x04, 0xdc, 0xcb, 0x1b, 0xe4,
+    0x4a, 0x14, 0xee, 0xe6, 0x44, 0x9f, 0x7b, 0x30, 0xa0, 0xcb, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0xdf, 0xf1, 0xba, 0xec, 0x7e, 0x0c, 0x3e, 0xf0, 0x08, 0xc2,
+    0xe8, 0x42, 0xa3, 0x6e, 0x93, 0xc6, 0x1d, 0x11, 0x9a, 0x6f, 0xc4, 0xe7, 0x41, 0xb4, 0x02, 0xec,
+    0xd0, 0xa9, 0x30, 0x4c, 0x42, 0x98, 0xd1, 0x53, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xcb, 0x04, 0x00,
+    0x32, 0x94, 0xa3, 0x11, 0x46, 0x96, 0x3a, 0x5d, 0x54, 0x4c, 0x95, 0xb0, 0xa0, 0xb2, 0x8f, 0xd9,
+    0xb1, 0x82, 0x09, 0x3e, 0x42, 0xcc, 0xe6, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4d, 0xb9, 0x41, 0xe2, 0x7d, 0xdc, 0x96, 0x90, 0xce, 0x7d, 0xc9, 0xed, 0x6b, 0x9a, 0x19, 0x56,
+    0x36, 0xd4, 0x25, 0xb8, 0x6d, 0x45, 0xe7, 0xcb, 0xb0, 0x5f, 0x12, 0xdb, 0x88, 0xb3, 0x18, 0xf0,
+    0xf0, 0x0e, 0xe3, 0x53, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xd3, 0x04, 0x00, 0x15, 0xd6, 0x45, 0x57,
+    0x04, 0x63, 0xca, 0x86, 0x28, 0x59, 0xfe, 0x67, 0x1a, 0x17, 0x2b, 0xe7, 0x42, 0xe3, 0xc5, 0xb5,
+    0xcd, 0x8a, 0x3e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xa2, 0x84, 0xa8,
+    0xc6, 0xfc, 0xb4, 0x62, 0xfb, 0x08, 0xd8, 0xc9, 0xd7, 0x20, 0x28, 0x34, 0x3e, 0xa4, 0xb3, 0xb8,
+    0x61, 0x6e, 0xfc, 0x13, 0xb5, 0xa8, 0x0f, 0xf4, 0x38, 0x47, 0x40, 0x7e, 0x09, 0x97, 0xf2, 0x53,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0xdb, 0x04, 0x00, 0xff, 0x3b, 0xd7, 0x1e, 0xdd, 0x01, 0x4b, 0x29,
+    0x21, 0x1b, 0x05, 0x73, 0x23, 0x24, 0xde, 0x9b, 0xa4, 0xd8, 0xd7, 0xcf, 0x84, 0x3c, 0x61, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x7f, 0x18, 0x29, 0xaa, 0xa2, 0xc0, 0x4c,
+    0xcc, 0x33, 0x8e, 0xb7, 0x75, 0x85, 0x55, 0x36, 0xda, 0x22, 0x0e, 0xd5, 0x33, 0x44, 0x63, 0xd7,
+    0x06, 0x44, 0x6e, 0xa3, 0x64, 0x22, 0xc0, 0xe4, 0xb9, 0x91, 0x02, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x81, 0xe3, 0x04, 0x00, 0xbb, 0xba, 0x43, 0x12, 0x04, 0x46, 0xf4, 0xff, 0x6a, 0xf3, 0x5e, 0xc0,
+    0x43, 0xd0, 0xf1, 0x06, 0xa3, 0x1a, 0xc9, 0x51, 0x4c, 0xe5, 0x06, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x62, 0x51, 0x38, 0xb4, 0xb2, 0x58, 0x3e, 0x5b, 0x70, 0x35, 0x97,
+    0x00, 0xe4, 0xb6, 0xca, 0x6d, 0x3e, 0x7c, 0x5c, 0x58, 0xbb, 0x6c, 0xab, 0x0e, 0xf9, 0x86, 0xda,
+    0xda, 0x8f, 0x5f, 0xd4, 0xba, 0x7d, 0x13, 0x54, 0x00, 0x00, 0x00, 0x00, 0x60, 0xeb, 0x04, 0x00,
+    0xd9, 0x31, 0x7c, 0x54, 0x2a, 0xac, 0xd5, 0x59, 0xdc, 0x7b, 0x7c, 0x07, 0xc5, 0x4a, 0xcd, 0xa5,
+    0x92, 0x00, 0x45, 0x5f, 0x01, 0x40, 0xfc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd4, 0x0b, 0x80, 0x2d, 0x91, 0x5e, 0x9d, 0x3b, 0x4b, 0xfc, 0xfa, 0x39, 0x81, 0x8b, 0xfe, 0xcd,
+    0x99, 0xd7, 0xe4, 0x79, 0x50, 0xd8, 0x7b, 0xf5, 0xfa, 0x33, 0xb5, 0xfe, 0xa1, 0xf0, 0x8c, 0x73,
+    0xfd, 0x50, 0x23, 0x54, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf3, 0x04, 0x00, 0x62, 0x0e, 0x99, 0x12,
+    0x5f, 0x8d, 0x44, 0xb4, 0xa9, 0x1a, 0x60, 0x18, 0x2d, 0x29, 0x58, 0xd5, 0xc2, 0xa9, 0xb2, 0x3a,
+    0x8e, 0x6a, 0x1f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x56, 0xc5, 0xcd,
+    0x2e, 0xd0, 0x35, 0x1d, 0xf7, 0x31, 0x72, 0x1b, 0x40, 0x93, 0x93, 0xc2, 0x3a, 0x29, 0x48, 0x8b,
+    0x4a, 0x48, 0xf0, 0xb9, 0x74, 0x05, 0x60, 0x59, 0xcb, 0x33, 0x31, 0xc5, 0x89, 0x43, 0x35, 0x54,
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0xfb, 0x04, 0x00, 0x64, 0x27, 0x5f, 0x0e, 0x55, 0xf4, 0xb7, 0x0f,
+    0x3c, 0xd6, 0xb5, 0x01, 0xc1, 0x56, 0x49, 0x0d, 0xbb, 0x1f, 0x11, 0x41, 0x13, 0xb2, 0x9a, 0x13,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xeb, 0x13, 0x06, 0x31, 0x5f, 0x72, 0xcd,
+    0xa8, 0x2e, 0x98, 0x34, 0x45, 0x3e, 0xaa, 0x7c, 0x05, 0xeb, 0x3a, 0xc7, 0x94, 0xc6, 0x34, 0xa9,
+    0x90, 0x3b, 0xc5, 0x92, 0xb8, 0x16, 0x7b, 0xad, 0xd5, 0x4b, 0x47, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x02, 0x05, 0x00, 0xe6, 0xe9, 0x01, 0x24, 0x25, 0x05, 0xdd, 0xca, 0xf3, 0x6b, 0x0e, 0xcd,
+    0x1d, 0xc2, 0xd8, 0x58, 0x84, 0xd5, 0x47, 0x59, 0x9e, 0xdb, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd2, 0x2f, 0xf9, 0x31, 0x19, 0x99, 0x2e, 0x6b, 0xd8, 0x80, 0xfa, 0xfe,
+    0x44, 0x35, 0xca, 0x87, 0xd0, 0x79, 0x5a, 0x55, 0x4b, 0x3f, 0x26, 0xe0, 0x52, 0x5e, 0x56, 0x64,
+    0xd4, 0xd7, 0x60, 0x24, 0xa7, 0x42, 0x58, 0x54, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x0a, 0x05, 0x00,
+    0x9d, 0x12, 0x29, 0xca, 0xf7, 0x69, 0x10, 0x00, 0xff, 0xf8, 0x1c, 0xd9, 0xb0, 0x27, 0xc5, 0xbc,
+    0x36, 0x97, 0xb3, 0x45, 0x54, 0x3c, 0xce, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xde, 0x74, 0x5a, 0xfb, 0x3f, 0xe8, 0xfc, 0x2c, 0xc0, 0x38, 0x5f, 0x40, 0xd9, 0xcb, 0xd4, 0x98,
+    0xd7, 0x94, 0xf0, 0x62, 0x24, 0x6b, 0x8b, 0xf1, 0x53, 0x4d, 0x90, 0xd8, 0x4b, 0xb0, 0xa4, 0x0c,
+    0x36, 0x44, 0x6a, 0x54, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x12, 0x05, 0x00, 0x40, 0x98, 0x40, 0x94,
+    0x00, 0xdd, 0x9e, 0x9a, 0xca, 0x7a, 0xd4, 0xe8, 0x83, 0x81, 0x75, 0x59, 0xbc, 0x10, 0x59, 0x70,
+    0xb9, 0x0e, 0x43, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x29, 0x10, 0xe0,
+    0x17, 0xb6, 0x9a, 0xa9, 0x3a, 0x1d, 0x6e, 0x65, 0x87, 0xe4, 0x6d, 0xbc, 0xcf, 0x0e, 0xd9, 0x06,
+    0x03, 0x29, 0x69, 0x8b, 0xad, 0xac, 0x00, 0xfc, 0xae, 0xe8, 0xf4, 0x12, 0xb8, 0xc9, 0x7c, 0x54,
+    0x00, 0x00, 0x00, 0x00, 0x9a, 0x1a, 0x05, 0x00, 0x11, 0x57, 0xc1, 0x52, 0x26, 0x99, 0x28, 0x38,
+    0x43, 0xe1, 0x35, 0xf0, 0x2d, 0x5a, 0xc6, 0xfa, 0xc2, 0x81, 0x83, 0x69, 0x08, 0x46, 0xf1, 0x0d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x63, 0xc0, 0x56, 0x00, 0x11, 0xad, 0xa1,
+    0xc4, 0xfe, 0x6d, 0xaa, 0x5f, 0x2a, 0xdb, 0x9a, 0x96, 0x40, 0xe9, 0xb5, 0xc9, 0xd2, 0x80, 0xc2,
+    0x5f, 0x73, 0x90, 0xfe, 0xb4, 0xcf, 0x4d, 0x98, 0x16, 0x83, 0x8f, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x79, 0x22, 0x05, 0x00, 0x5d, 0xae, 0xb9, 0xd3, 0x63, 0xb3, 0xa1, 0x10, 0xb9, 0x45, 0xe3, 0x0d,
+    0xd9, 0xc4, 0xc9, 0x60, 0x38, 0x9b, 0xc4, 0xb6, 0x30, 0xe3, 0x72, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x28, 0x6c, 0x84, 0xba, 0x69, 0x84, 0x3d, 0x1e, 0xaa, 0x78, 0x00, 0x09,
+    0xa8, 0x80, 0xa9, 0x81, 0x11, 0x26, 0xab, 0xb1, 0x03, 0x48, 0x65, 0x7a, 0x72, 0xe6, 0xf4, 0xdc,
+    0xfe, 0x20, 0xa4, 0x38, 0x19, 0x87, 0xa1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x58, 0x2a, 0x05, 0x00,
+    0xae, 0x75, 0x7c, 0xc6, 0x56, 0x54, 0x40, 0x33, 0xe0, 0x28, 0x3d, 0xc3, 0x8d, 0x1e, 0x20, 0x3e,
+    0x6a, 0x37, 0xdb, 0x3f, 0x8a, 0xfd, 0x4f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x0f, 0xe8, 0xa2, 0x40, 0x83, 0xf0, 0xf7, 0x30, 0x6f, 0x40, 0xd0, 0xc6, 0xfe, 0xe8, 0xd8,
+    0x1c, 0x96, 0x01, 0xd3, 0x76, 0x0c, 0xde, 0xca, 0x2c, 0x85, 0xc1, 0x07, 0xe4, 0xe4, 0xe2, 0x95,
+    0x84, 0xb2, 0xb2, 0x54, 0x00, 0x00, 0x00, 0x00, 0x37, 0x32, 0x05, 0x00, 0x19, 0xb3, 0x4c, 0xda,
+    0x69, 0x25, 0x1b, 0xcf, 0x55, 0xc8, 0x14, 0x7d, 0xd5, 0xe4, 0x72, 0x99, 0x7d, 0xbc, 0xd8, 0xc3,
+    0xb9, 0xa1, 0x4f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x4e, 0x2a, 0x88,
+    0x07, 0xb5, 0xcf, 0x79, 0xca, 0x0b, 0xb6, 0x24, 0x9f, 0x2d, 0xd4, 0x09, 0x7d, 0xc4, 0x8e, 0x89,
+    0xaf, 0xd8, 0x29, 0x0e, 0x82, 0x56, 0x3d, 0x6d, 0xd8, 0xc0, 0x6f, 0x64, 0xcd, 0x17, 0xc6, 0x54,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x3a, 0x05, 0x00, 0xbe, 0x1d, 0x56, 0x42, 0x97, 0x4f, 0x7b, 0x6e,
+    0x7e, 0xe6, 0x74, 0x32, 0x0a, 0xee, 0x0e, 0xa8, 0x37, 0x4f, 0x26, 0x54, 0x68, 0x43, 0xaf, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x52, 0xaf, 0x2f, 0x3e, 0x08, 0x32, 0xca,
+    0x5a, 0x41, 0x61, 0xfc, 0x24, 0x33, 0xbf, 0x3a, 0x22, 0xdb, 0xfa, 0x9e, 0x0e, 0x9a, 0xc3, 0x68,
+    0x0b, 0xc6, 0xe1, 0x7f, 0x20, 0x6c, 0x7f, 0xd5, 0x64, 0x58, 0xd7, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0xf5, 0x41, 0x05, 0x00, 0x7a, 0xfa, 0x2e, 0xbe, 0xb0, 0x4b, 0xe5, 0x68, 0x0f, 0x6e, 0x79, 0xa3,
+    0x8f, 0x9c, 0xe0, 0x03, 0xf5, 0x19, 0xe4, 0x32, 0xe4, 0x81, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6a, 0x9f, 0x8e, 0x17, 0x0d, 0x86, 0xf2, 0x35, 0x0e, 0x81, 0xad, 0x1a,
+    0x66, 0x0e, 0x84, 0x95, 0xa5, 0x46, 0xbd, 0xc3, 0x78, 0xc8, 0xd7, 0xf1, 0xe6, 0x0c, 0x16, 0x7f,
+    0xc5, 0xe7, 0xbf, 0xf4, 0x67, 0xee, 0xe8, 0x54, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x49, 0x05, 0x00,
+    0xae, 0xd3, 0x5c, 0xf8, 0xd9, 0xbe, 0xfd, 0x34, 0xbf, 0xbb, 0xc0, 0xa3, 0x56, 0x33, 0xaa, 0x26,
+    0x15, 0x9e, 0x55, 0xe8, 0xaa, 0x2b, 0x3d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb5, 0x21, 0x86, 0x66, 0x48, 0x03, 0x74, 0xf4, 0x9d, 0xf7, 0x01, 0x98, 0x6a, 0xf8, 0x78, 0xe9,
+    0x23, 0x7c, 0x0b, 0x02, 0xe0, 0xd1, 0x43, 0xcb, 0x4a, 0xf3, 0x9c, 0x4e, 0x9b, 0xdd, 0x04, 0x9e,
+    0x43, 0x27, 0xfb, 0x54, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x51, 0x05, 0x00, 0xb1, 0x98, 0xc7, 0x77,
+    0x18, 0x08, 0x22, 0x72, 0x86, 0xc6, 0x4b, 0x1c, 0x67, 0x98, 0xe3, 0x50, 0x24, 0xb1, 0xeb, 0xc4,
+    0xa5, 0x96, 0xd7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x22, 0xf4, 0x8b,
+    0xc8, 0x97, 0x9f, 0x13, 0xec, 0x7b, 0x13, 0x05, 0x32, 0x9c, 0x20, 0x0e, 0x86, 0x78, 0xcb, 0x8f,
+    0x90, 0x3c, 0xdf, 0xc8, 0x89, 0x00, 0xd6, 0xad, 0x94, 0xc7, 0x69, 0x45, 0x1e, 0xb7, 0x0d, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x92, 0x59, 0x05, 0x00, 0xa3, 0xcb, 0xf7, 0xea, 0x72, 0xc3, 0xd7, 0x7b,
+    0x80, 0x55, 0x83, 0x17, 0xfa, 0x3e, 0x9f, 0xf4, 0x04, 0x08, 0x6d, 0x44, 0x14, 0xe5, 0xa9, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x15, 0xb6, 0xb8, 0x95, 0x2a, 0xdf, 0xb9,
+    0xe1, 0x94, 0x1b, 0xb2, 0xc6, 0x3b, 0xad, 0xdd, 0xb9, 0x5e, 0xad, 0x0b, 0x37, 0x7d, 0x74, 0x0e,
+    0x5b, 0xa4, 0x68, 0x77, 0xcf, 0xa2, 0x5d, 0x90, 0x40, 0x39, 0x1f, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x71, 0x61, 0x05, 0x00, 0xa3, 0xae, 0x42, 0x9d, 0xdb, 0xeb, 0xf8, 0x71, 0x09, 0xb2, 0xba, 0x26,
+    0xf9, 0x30, 0xa4, 0x6e, 0x1d, 0x94, 0xcc, 0xa8, 0x7e, 0x9d, 0x06, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xce, 0x28, 0xb8, 0x51, 0x48, 0x54, 0x75, 0x45, 0xff, 0xa1, 0x30, 0x11,
+    0xbf, 0x64, 0x47, 0x22, 0xf7, 0xd1, 0x2e, 0x0a, 0x0e, 0x27, 0x48, 0x57, 0x76, 0x55, 0xf4, 0xd0,
+    0x51, 0x3e, 0xa7, 0x73, 0x62, 0x4f, 0x32, 0x55, 0x00, 0x00, 0x00, 0x00, 0x50, 0x69, 0x05, 0x00,
+    0xa3, 0x0a, 0x4b, 0x71, 0x13, 0x4a, 0x62, 0x20, 0x73, 0x5c, 0xed, 0x2c, 0x0d, 0xb9, 0xca, 0x17,
+    0xc7, 0xdd, 0x07, 0xd3, 0x12, 0x7a, 0x8d, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xab, 0x77, 0x5f, 0xc8, 0xa5, 0x7a, 0xd8, 0xe7, 0x25, 0xae, 0x56, 0xc7, 0xe0, 0x0a, 0x1e, 0xcb,
+    0xf8, 0x8c, 0x6e, 0x77, 0x26, 0xf5, 0x8c, 0x18, 0xce, 0x98, 0xaf, 0x27, 0x1d, 0x43, 0x77, 0xc7,
+    0xfa, 0xc1, 0x44, 0x55, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x71, 0x05, 0x00, 0xcd, 0x21, 0xf2, 0x51,
+    0xdf, 0x63, 0x8a, 0x02, 0xf9, 0xb1, 0xd2, 0x30, 0x5a, 0x4b, 0xee, 0x75, 0xb6, 0xdb, 0x13, 0x4f,
+    0x9a, 0xe0, 0x85, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x6b, 0xa5, 0xad,
+    0x3e, 0x31, 0x44, 0xe0, 0xf7, 0x95, 0xa0, 0xed, 0x3f, 0x79, 0x81, 0x0a, 0x2a, 0x31, 0xd7, 0xee,
+    0x96, 0xd3, 0x2c, 0xb3, 0x8a, 0xa1, 0xe7, 0x32, 0x16, 0x34, 0xc2, 0xd7, 0xb5, 0xeb, 0x56, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x79, 0x05, 0x00, 0xc8, 0x6e, 0x00, 0x9c, 0x45, 0x00, 0x9d, 0x6a,
+    0xd8, 0x4c, 0x4b, 0x16, 0x00, 0xe4, 0xc9, 0x31, 0xa7, 0x6e, 0x54, 0xd6, 0x37, 0xd1, 0xdf, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x78, 0xe2, 0xc3, 0xe6, 0x12, 0xdf, 0x03,
+    0x1e, 0xe1, 0x80, 0x52, 0xad, 0xcf, 0x0d, 0x50, 0x36, 0x97, 0x69, 0xbc, 0xef, 0xfe, 0x26, 0xb7,
+    0x40, 0x5a, 0x9f, 0xb3, 0xa2, 0xd1, 0xff, 0x0b, 0xf6, 0xc4, 0x69, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0xed, 0x80, 0x05, 0x00, 0x06, 0x31, 0x50, 0x56, 0x6f, 0x32, 0x71, 0x32, 0x44, 0x28, 0x28, 0x30,
+    0x5a, 0xdd, 0xd8, 0x2a, 0x43, 0xc3, 0xe2, 0x4d, 0xa3, 0x5f, 0xf5, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf9, 0x44, 0x18, 0x07, 0xc3, 0x8b, 0x42, 0xd5, 0x87, 0x5c, 0x17, 0x1f,
+    0x0f, 0xcc, 0x96, 0x63, 0xca, 0x17, 0x97, 0x21, 0x55, 0x75, 0x7c, 0x0e, 0xe3, 0xbb, 0x4f, 0x29,
+    0x9e, 0xed, 0xed, 0x93, 0xe3, 0x9d, 0x7b, 0x55, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x88, 0x05, 0x00,
+    0x35, 0xd0, 0xf7, 0x95, 0x55, 0x44, 0x99, 0x06, 0x16, 0xa5, 0x53, 0xe5, 0xca, 0x0b, 0xa1, 0x46,
+    0xc9, 0x26, 0x9e, 0xcb, 0x7a, 0xc6, 0x18, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x58, 0x4f, 0xf2, 0xd8, 0x02, 0x5b, 0xd9, 0x12, 0x64, 0x08, 0x3d, 0xa4, 0xd3, 0x55, 0xde, 0x6e,
+    0x7b, 0xc7, 0xe2, 0xfc, 0x3e, 0x09, 0xf4, 0x2e, 0x27, 0xc9, 0xcb, 0x5c, 0x72, 0xe5, 0x79, 0x8c,
+    0x35, 0xdc, 0x8d, 0x55, 0x00, 0x00, 0x00, 0x00, 0xab, 0x90, 0x05, 0x00, 0x17, 0x12, 0x49, 0xd8,
+    0x33, 0xad, 0xff, 0x42, 0xe2, 0x84, 0x5d, 0xa1, 0x55, 0x80, 0x9b, 0xa2, 0x1e, 0xd8, 0xd2, 0xb3,
+    0x4a, 0x37, 0x04, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x5c, 0xdb, 0x26,
+    0x69, 0x12, 0xee, 0xa3, 0x8f, 0xb6, 0x54, 0xa2, 0x66, 0x07, 0xf2, 0xc2, 0xbb, 0x44, 0xb1, 0x43,
+    0xaf, 0xc4, 0xb5, 0x34, 0x6d, 0xef, 0x27, 0xeb, 0x9e, 0x22, 0x25, 0xa2, 0x1e, 0xe5, 0x9f, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x8a, 0x98, 0x05, 0x00, 0x98, 0x17, 0x79, 0x0e, 0x4f, 0xab, 0x47, 0x01,
+    0xb5, 0x7e, 0x2d, 0xca, 0x27, 0xab, 0x47, 0xd5, 0xf5, 0x77, 0x54, 0xa0, 0x1c, 0x76, 0x80, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x68, 0x31, 0xb2, 0x64, 0xb6, 0x28, 0x35,
+    0x95, 0x0d, 0xe5, 0xbe, 0xff, 0xf5, 0x25, 0xdd, 0x42, 0x8d, 0x76, 0x9d, 0x22, 0x6e, 0xa7, 0xb8,
+    0x45, 0xf2, 0xd8, 0x14, 0x52, 0x57, 0x27, 0x51, 0x36, 0x12, 0xb2, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x69, 0xa0, 0x05, 0x00, 0xc0, 0x30, 0xcd, 0xb9, 0xba, 0xf4, 0xa8, 0x03, 0x83, 0x6b, 0x35, 0xfa,
+    0x41, 0x99, 0x77, 0x0f, 0xb6, 0x8c, 0x55, 0xc2, 0xad, 0xd1, 0xa6, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0xf7, 0x04, 0x52, 0xf0, 0x4d, 0x20, 0xef, 0xe7, 0xfa, 0xe6, 0x07,
+    0x73, 0x32, 0xb1, 0x33, 0x70, 0xb0, 0x7f, 0x9e, 0x94, 0xab, 0x05, 0x0c, 0x68, 0x24, 0x39, 0x0e,
+    0xd4, 0x56, 0x69, 0x0d, 0x12, 0x22, 0xc4, 0x55, 0x00, 0x00, 0x00, 0x00, 0x48, 0xa8, 0x05, 0x00,
+    0x2c, 0x0d, 0x31, 0xb5, 0x41, 0x1a, 0x17, 0x23, 0x7a, 0x51, 0xfc, 0x7d, 0xb5, 0xdd, 0x32, 0x91,
+    0x67, 0x01, 0xca, 0x16, 0x53, 0x95, 0x14, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xbd, 0x13, 0x4d, 0x23, 0x7f, 0xbc, 0x96, 0x14, 0xd6, 0xcc, 0x74, 0xab, 0xf7, 0x22, 0xe0,
+    0x85, 0x89, 0x96, 0xcb, 0xfc, 0xdf, 0x8e, 0x52, 0x54, 0xa0, 0x42, 0x73, 0x51, 0x46, 0x5d, 0x77,
+    0x95, 0x4d, 0xd6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x27, 0xb0, 0x05, 0x00, 0x78, 0x01, 0x74, 0x47,
+    0xcd, 0xa0, 0xf9, 0xb7, 0x17, 0xfb, 0x8b, 0x38, 0x9c, 0xec, 0xfb, 0x32, 0x79, 0xd2, 0xf6, 0xc6,
+    0x45, 0x44, 0x32, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x68, 0x74, 0x98,
+    0x2b, 0x45, 0x31, 0xfa, 0xa9, 0x20, 0x3c, 0xc8, 0x8a, 0x7d, 0xa9, 0x03, 0x07, 0x32, 0x22, 0xdd,
+    0x39, 0x76, 0xb7, 0x59, 0x9d, 0x4d, 0x7d, 0x33, 0xa5, 0x4e, 0x18, 0x29, 0xf2, 0xc7, 0xe7, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xb8, 0x05, 0x00, 0xbc, 0x12, 0x38, 0xfd, 0x61, 0xba, 0x9b, 0x92,
+    0x3b, 0x45, 0x35, 0x0c, 0x26, 0xdb, 0xfd, 0x63, 0xda, 0xc3, 0x4e, 0xaa, 0x02, 0xc7, 0xf1, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xf0, 0x08, 0x57, 0x35, 0xc5, 0xbc, 0x73,
+    0xff, 0xe5, 0xb4, 0x98, 0x8f, 0x3a, 0x5f, 0x0f, 0xc6, 0x9f, 0x79, 0x98, 0xe7, 0x30, 0xed, 0xc0,
+    0x4c, 0xd3, 0xbe, 0xc4, 0xc6, 0x48, 0x6c, 0x5a, 0xac, 0x4e, 0xf9, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0xe5, 0xbf, 0x05, 0x00, 0x39, 0x9b, 0x87, 0xf3, 0xff, 0xc3, 0x07, 0x67, 0xb5, 0x93, 0xc2, 0xe4,
+    0x53, 0x9c, 0x5a, 0xf5, 0x7e, 0x8c, 0x16, 0x3c, 0x5f, 0x2e, 0xdf, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7b, 0x7f, 0xf9, 0x3c, 0x0b, 0x3b, 0x24, 0x02, 0xd7, 0x8d, 0xd0, 0xba,
+    0x76, 0xb1, 0x1d, 0xc2, 0x74, 0x81, 0x6f, 0xdc, 0x57, 0xc1, 0x2f, 0x3f, 0xb4, 0xeb, 0x8a, 0x1b,
+    0xdb, 0xdc, 0x1a, 0x46, 0xc0, 0x7f, 0x0b, 0x56, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc7, 0x05, 0x00,
+    0xcd, 0xc0, 0x77, 0x77, 0x73, 0xa2, 0xd0, 0x98, 0xa5, 0x9e, 0x53, 0x75, 0xb2, 0xef, 0xa1, 0x8d,
+    0xa4, 0x78, 0x5a, 0xda, 0xa0, 0x32, 0xa3, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8e, 0x77, 0x4a, 0x0d, 0xd2, 0x29, 0xf0, 0xbb, 0x4e, 0x03, 0xbd, 0x74, 0xe0, 0xe9, 0xde, 0x2b,
+    0x31, 0x57, 0x5d, 0x0e, 0x53, 0xf6, 0xc2, 0x1a, 0x4b, 0x09, 0x0e, 0xc6, 0xfa, 0xba, 0x19, 0x5a,
+    0x16, 0xf2, 0x1d, 0x56, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xcf, 0x05, 0x00, 0x3a, 0x0c, 0x2d, 0x19,
+    0x1d, 0xc7, 0x5e, 0x3c, 0xef, 0x97, 0xb7, 0xa0, 0x5e, 0x4b, 0x46, 0xe7, 0x02, 0xb0, 0xd5, 0x01,
+    0xe1, 0x3d, 0xd3, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x23, 0x01, 0xac,
+    0xf2, 0x92, 0x24, 0x24, 0x6d, 0xf7, 0x19, 0x44, 0xdd, 0x9c, 0xda, 0x00, 0x05, 0x0d, 0x50, 0x35,
+    0xf2, 0xaf, 0xcd, 0x42, 0x8b, 0xbc, 0x49, 0xec, 0x14, 0xf6, 0xfc, 0x33, 0x01, 0xc5, 0x2f, 0x56,
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xd7, 0x05, 0x00, 0x4b, 0x04, 0x4d, 0x61, 0x41, 0x81, 0x1f, 0x55,
+    0x79, 0x14, 0x58, 0x83, 0x04, 0x89, 0xda, 0xce, 0xed, 0x43, 0xec, 0xe2, 0xa9, 0x96, 0x23, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x5b, 0xfa, 0x96, 0xcb, 0xea, 0x46,
+    0xe6, 0x41, 0x79, 0xc9, 0xc8, 0xed, 0x44, 0x6f, 0x21, 0x31, 0x32, 0x35, 0x41, 0x48, 0x7f, 0x4d,
+    0xef, 0xf1, 0xc0, 0x8a, 0x37, 0xd3, 0xdd, 0x4c, 0x21, 0x81, 0x41, 0x56, 0x00, 0x00, 0x00, 0x00,
+    0x61, 0xdf, 0x05, 0x00, 0xde, 0x52, 0x92, 0x52, 0xef, 0xa0, 0xd9, 0x64, 0xd2, 0xed, 0x8d, 0x58,
+    0x67, 0x3a, 0xe5, 0xb9, 0x8c, 0xbd, 0xf9, 0xbf, 0x38, 0x68, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc4, 0xdd, 0xc7, 0x77, 0x5d, 0xa5, 0x21, 0x12, 0xa4, 0x9b, 0xb0, 0x14,
+    0xc7, 0xf7, 0x64, 0x86, 0x14, 0x5b, 0xf4, 0x44, 0x43, 0xfc, 0x5d, 0x4f, 0xc1, 0xd7, 0x6a, 0xf8,
+    0xb4, 0x4d, 0xf5, 0xd0, 0xda, 0x37, 0x52, 0x56, 0x00, 0x00, 0x00, 0x00, 0x40, 0xe7, 0x05, 0x00,
+    0x65, 0xfb, 0xde, 0x76, 0xf2, 0x98, 0xaa, 0x19, 0xb9, 0x5f, 0x77, 0xd9, 0xb5, 0xbc, 0xcd, 0x34,
+    0x64, 0xaa, 0x3f, 0x33, 0x68, 0xa2, 0xe4, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe2, 0xf5, 0x2d, 0x6e, 0x0a, 0xe1, 0x67, 0x55, 0x1b, 0xd7, 0x32, 0xd0, 0x6c, 0xaa, 0x7d, 0x88,
+    0xb9, 0xdb, 0x2b, 0xe5, 0xf7, 0xb8, 0xd5, 0x94, 0x9d, 0x25, 0xea, 0x4d, 0xfd, 0x4c, 0xea, 0x73,
+    0x23, 0x3f, 0x63, 0x56, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xef, 0x05, 0x00, 0xa6, 0x12, 0x36, 0x52,
+    0x45, 0x82, 0x52, 0x04, 0x15, 0x3c, 0x20, 0x2a, 0xf5, 0xf2, 0x64, 0x4d, 0xcb, 0xe2, 0xf3, 0xa4,
+    0x8e, 0x50, 0x8c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xb9, 0x56, 0x7b,
+    0xd4, 0x3e, 0x1e, 0xb8, 0x45, 0x5d, 0xc2, 0x12, 0x81, 0x1e, 0x6b, 0x30, 0x76, 0x68, 0xa5, 0xef,
+    0x2d, 0x2c, 0x59, 0x3e, 0xa6, 0xbe, 0x2b, 0x58, 0xc1, 0xca, 0xe2, 0x8a, 0x2c, 0xd8, 0x72, 0x56,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0xf6, 0x05, 0x00, 0xa1, 0x15, 0x61, 0x87, 0xa8, 0x9e, 0x25, 0xe1,
+    0x82, 0x0e, 0x5f, 0x93, 0x8a, 0x46, 0x41, 0x6d, 0x5e, 0x05, 0x9f, 0x34, 0x08, 0xc6, 0x34, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x6e, 0x5f, 0x04, 0x30, 0xab, 0x94, 0x03,
+    0xb1, 0x15, 0x5d, 0x53, 0x3b, 0xc9, 0xb8, 0x7c, 0x4e, 0x2b, 0xce, 0x80, 0x08, 0x5b, 0x74, 0x82,
+    0xce, 0x84, 0xfc, 0xeb, 0x8d, 0x03, 0x56, 0x17, 0xbd, 0x5e, 0x83, 0x56, 0x00, 0x00, 0x00, 0x00,
+    0xdd, 0xfe, 0x05, 0x00, 0x65, 0x4d, 0xa5, 0x03, 0x7f, 0x21, 0xb8, 0x0c, 0x3d, 0x9b, 0xc7, 0x44,
+    0x20, 0xb2, 0xdd, 0x00, 0xbc, 0x0c, 0xab, 0x74, 0x32, 0xb0, 0x08, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf6, 0xb9, 0x5f, 0x5f, 0xdb, 0x71, 0xe3, 0x73, 0x29, 0xc0, 0x40, 0x73,
+    0x57, 0x56, 0x47, 0x77, 0xac, 0x2e, 0x16, 0xa8, 0x19, 0xfa, 0xe9, 0x23, 0xa8, 0x22, 0x7d, 0x7b,
+    0x5b, 0x1c, 0xa4, 0x98, 0x5c, 0x79, 0x94, 0x56, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x06, 0x06, 0x00,
+    0xe0, 0xed, 0x36, 0x27, 0x1a, 0x8e, 0x48, 0xaa, 0x0f, 0x67, 0xf8, 0x39, 0x8d, 0xf9, 0x06, 0x12,
+    0x14, 0x21, 0xc8, 0x34, 0xb5, 0xac, 0x49, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3d, 0xc0, 0xff, 0xdc, 0xd9, 0xed, 0xca, 0x49, 0xcd, 0x53, 0xa3, 0x8b, 0x95, 0xf2, 0xf8, 0xef,
+    0xee, 0x5a, 0x7c, 0x98, 0x40, 0x5c, 0x02, 0x27, 0x77, 0x57, 0x08, 0x03, 0x59, 0x46, 0xfb, 0xc5,
+    0x09, 0xc6, 0xa5, 0x56, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x0e, 0x06, 0x00, 0xfa, 0x0b, 0x9f, 0x51,
+    0x81, 0x4b, 0x64, 0xfe, 0x9a, 0x74, 0xfe, 0xba, 0xdc, 0xeb, 0xbc, 0xea, 0xc6, 0x44, 0xa6, 0xcb,
+    0x78, 0xf6, 0xc5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2b, 0x67, 0x85,
+    0x91, 0x64, 0x87, 0x10, 0x7c, 0x53, 0x30, 0x8a, 0xb4, 0xe0, 0x1b, 0x0a, 0x45, 0x32, 0x06, 0xae,
+    0xb6, 0xfd, 0xb7, 0x1d, 0x92, 0xbe, 0x23, 0x82, 0xca, 0x9b, 0x7f, 0x88, 0xa2, 0x77, 0xb5, 0x56,
+    0x00, 0x00, 0x00, 0x00, 0x7a, 0x16, 0x06, 0x00, 0x13, 0x17, 0x57, 0xae, 0x7d, 0xc9, 0xce, 0xeb,
+    0xa6, 0x50, 0x77, 0x92, 0x65, 0x87, 0x81, 0x24, 0xa4, 0x5d, 0x0b, 0xe1, 0xab, 0x0f, 0xa0, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xc9, 0xc4, 0x9a, 0xb0, 0x79, 0x35, 0xa4,
+    0x48, 0xd6, 0x45, 0x2d, 0x3f, 0xbe, 0x5a, 0x73, 0x79, 0x04, 0x40, 0xb4, 0x35, 0xa3, 0xb5, 0xbe,
+    0x6c, 0x0c, 0x4e, 0xf7, 0x3b, 0x94, 0x9d, 0x5a, 0xba, 0x7a, 0xc5, 0x56, 0x00, 0x00, 0x00, 0x00,
+    0x59, 0x1e, 0x06, 0x00, 0xd8, 0x1e, 0xd2, 0xa2, 0xec, 0xc7, 0x5c, 0x4e, 0xbf, 0x26, 0xc4, 0x07,
+    0xc4, 0xa0, 0x0d, 0x22, 0xbe, 0x89, 0x7a, 0x64, 0x39, 0xcc, 0xc9, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc9, 0xbe, 0x7f, 0xa4, 0x24, 0xce, 0x7f, 0xab, 0x57, 0x4a, 0x77, 0x45,
+    0x03, 0x48, 0x18, 0x95, 0xd3, 0x63, 0x7a, 0x38, 0xa0, 0x5a, 0xb4, 0x56, 0xb3, 0x6f, 0xbb, 0xfd,
+    0x3a, 0x68, 0x9d, 0x84, 0xec, 0x62, 0xd8, 0x56, 0x00, 0x00, 0x00, 0x00, 0x38, 0x26, 0x06, 0x00,
+    0xfd, 0x75, 0x49, 0xcc, 0x8d, 0xf1, 0x48, 0x54, 0x05, 0x5e, 0x2f, 0x88, 0xce, 0x2f, 0xa2, 0x81,
+    0x0a, 0xaf, 0xd9, 0xd8, 0x20, 0xb8, 0xb3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2e, 0x9d, 0x46, 0x74, 0xc6, 0x5e, 0x8c, 0x58, 0xd2, 0x47, 0xa3, 0xee, 0x06, 0x4f, 0xcb, 0xd5,
+    0xec, 0xf8, 0xbe, 0x0c, 0x78, 0x0a, 0x84, 0x5f, 0x8d, 0xc5, 0x71, 0x08, 0xe1, 0x62, 0xfb, 0xee,
+    0x31, 0xf8, 0xe9, 0x56, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2e, 0x06, 0x00, 0xde, 0xf2, 0xeb, 0xd0,
+    0xde, 0x5f, 0x50, 0x4c, 0x9e, 0x08, 0xa5, 0x94, 0x92, 0x53, 0x0e, 0x09, 0x3e, 0x0f, 0x26, 0xa4,
+    0x68, 0xef, 0xda, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x18, 0xa6, 0x14,
+    0x9e, 0x7f, 0x74, 0xb9, 0x3e, 0x37, 0x29, 0xdd, 0xca, 0xcc, 0x22, 0xba, 0x75, 0xdb, 0xb5, 0x8e,
+    0xc9, 0xdc, 0xf2, 0xc7, 0x28, 0x58, 0xdc, 0xa0, 0xb7, 0xa1, 0x84, 0xc6, 0x87, 0x07, 0xfc, 0x56,
+    0x00, 0x00, 0x00, 0x00, 0xf6, 0x35, 0x06, 0x00, 0x0c, 0xfe, 0xc4, 0x2f, 0xb7, 0x55, 0x4e, 0x75,
+    0x65, 0x63, 0x36, 0xe9, 0xaa, 0xa3, 0x3d, 0x70, 0xfc, 0x8b, 0x25, 0x85, 0x47, 0xb1, 0x84, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x77, 0xc9, 0xeb, 0x3f, 0x4d, 0xb4, 0x8d,
+    0x98, 0x3c, 0x8d, 0x3c, 0xb5, 0x64, 0x4f, 0x3e, 0x0e, 0xaa, 0x3f, 0x2f, 0x35, 0x98, 0x02, 0x05,
+    0x5f, 0xfd, 0x8f, 0x9c, 0xa7, 0x9b, 0x88, 0xd7, 0x17, 0xaa, 0x0d, 0x57, 0x00, 0x00, 0x00, 0x00,
+    0xd5, 0x3d, 0x06, 0x00, 0xb9, 0xde, 0x51, 0xf3, 0xde, 0x44, 0xcb, 0xc3, 0xea, 0x37, 0x84, 0xc2,
+    0xb7, 0xf7, 0x99, 0x4a, 0x84, 0xab, 0x5e, 0x42, 0xef, 0x67, 0x62, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4f, 0x40, 0xc0, 0x86, 0x1d, 0x28, 0x34, 0x9d, 0xf5, 0x11, 0xb8, 0x2a,
+    0xc6, 0xdb, 0x54, 0xed, 0xcf, 0xc9, 0x32, 0xe0, 0x40, 0x32, 0x9b, 0xfb, 0x87, 0xd0, 0x4c, 0xd0,
+    0x0b, 0xc9, 0x1b, 0x64, 0x31, 0xcc, 0x1f, 0x57, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x45, 0x06, 0x00,
+    0xad, 0x3c, 0xef, 0x71, 0xf8, 0x9e, 0xe9, 0x0b, 0xb0, 0xca, 0x1a, 0xd4, 0x56, 0xb9, 0x0d, 0xc9,
+    0x5f, 0x43, 0x22, 0xc4, 0x83, 0xc7, 0xa0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x74, 0x22, 0x75, 0x8d, 0xf8, 0xc9, 0x60, 0x4d, 0x9a, 0x19, 0xc1, 0xea, 0x5f, 0x27, 0x25, 0x33,
+    0xfb, 0xfc, 0xc3, 0x9a, 0xee, 0xe9, 0x38, 0xbc, 0x1f, 0x36, 0x96, 0xe8, 0x67, 0xbf, 0xe5, 0x63,
+    0x19, 0x00, 0x31, 0x57, 0x00, 0x00, 0x00, 0x00, 0x93, 0x4d, 0x06, 0x00, 0x76, 0x59, 0xb3, 0x16,
+    0x59, 0xc8, 0xcf, 0xd7, 0xb2, 0x81, 0x2f, 0x2a, 0x72, 0x54, 0x1c, 0x59, 0x67, 0x39, 0xb5, 0x6d,
+    0xd4, 0x91, 0xc1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xdc, 0x5f, 0x41,
+    0xe8, 0x38, 0x66, 0x95, 0x0f, 0xaa, 0x04, 0xd2, 0xe7, 0x77, 0xf7, 0x41, 0x26, 0x08, 0x25, 0xc5,
+    0xd9, 0x87, 0xf9, 0x78, 0x49, 0x4a, 0x5f, 0xce, 0x64, 0x97, 0x80, 0xcb, 0x5b, 0xe9, 0x42, 0x57,
+    0x00, 0x00, 0x00, 0x00, 0x72, 0x55, 0x06, 0x00, 0xad, 0xff, 0x97, 0x20, 0x55, 0x9b, 0x2b, 0x6a,
+    0xe5, 0xf0, 0xe6, 0xa8, 0x3e, 0x88, 0xe5, 0x95, 0x5f, 0x2f, 0x30, 0xac, 0x61, 0xfc, 0x1b, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x22, 0xf0, 0xc3, 0xd7, 0xbe, 0xe2, 0xfd,
+    0x21, 0x3f, 0x94, 0x02, 0x71, 0xf2, 0x47, 0x3f, 0x90, 0x4d, 0x50, 0x65, 0x3e, 0x05, 0x76, 0x17,
+    0xd3, 0xe1, 0x46, 0x03, 0xfb, 0x51, 0x62, 0x68, 0x4a, 0xa2, 0x55, 0x57, 0x00, 0x00, 0x00, 0x00,
+    0x51, 0x5d, 0x06, 0x00, 0x9e, 0xad, 0xc6, 0x5b, 0x54, 0xe6, 0xe6, 0x65, 0xd5, 0x65, 0xa8, 0x45,
+    0x6c, 0xd1, 0x78, 0xe4, 0xbc, 0x2e, 0x18, 0x89, 0xdf, 0x94, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0xd9, 0xf4, 0x63, 0xe7, 0x70, 0x72, 0xb4, 0xe6, 0x33, 0x20, 0x5f,
+    0xba, 0x16, 0x7a, 0x50, 0x4b, 0xd2, 0x8c, 0xb1, 0x6a, 0xac, 0xaf, 0x03, 0xd0, 0xa4, 0x65, 0x25,
+    0xad, 0x80, 0xe7, 0x4f, 0x00, 0x1a, 0x67, 0x57, 0x00, 0x00, 0x00, 0x00, 0x30, 0x65, 0x06, 0x00,
+    0x76, 0xec, 0xb7, 0xf6, 0x2d, 0xc4, 0x90, 0xad, 0x45, 0xe4, 0x88, 0xa0, 0xb5, 0x22, 0xcf, 0x49,
+    0x61, 0x93, 0xf0, 0x3c, 0xc8, 0xcb, 0x56, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x92, 0x2b, 0xa6, 0x30, 0x64, 0xc3, 0x1c, 0x18, 0xe7, 0xc0, 0x98, 0x74, 0x76, 0x97, 0xf5, 0xf7,
+    0x44, 0x5c, 0x9f, 0xf5, 0xcc, 0xe8, 0x54, 0x70, 0x47, 0xae, 0xa9, 0x65, 0x9e, 0x6e, 0x10, 0xde,
+    0xa2, 0x22, 0x79, 0x57, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x6d, 0x06, 0x00, 0x33, 0xad, 0xbe, 0x6b,
+    0x1a, 0x05, 0xcf, 0x6a, 0x7e, 0xbb, 0x5a, 0xba, 0x8a, 0x6a, 0xa5, 0x16, 0x94, 0xa6, 0xe7, 0xe4,
+    0x90, 0x56, 0xb6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x76, 0xe0, 0xa1,
+    0xe5, 0x85, 0xb4, 0xd3, 0xdb, 0x77, 0x7a, 0xfd, 0x91, 0xfe, 0x57, 0x83, 0x87, 0x52, 0x16, 0x9e,
+    0xb6, 0x97, 0x27, 0x85, 0x21, 0xa3, 0x7c, 0x70, 0xb9, 0x53, 0xea, 0x91, 0xbe, 0x89, 0x8b, 0x57,
+    0x00, 0x00, 0x00, 0x00, 0xee, 0x74, 0x06, 0x00, 0x18, 0xc9, 0x40, 0xc5, 0x6e, 0x18, 0x16, 0xb2,
+    0x1d, 0xa9, 0xef, 0xed, 0xca, 0x2c, 0x7c, 0x83, 0x47, 0x75, 0x7c, 0x2e, 0xa4, 0xcf, 0xdf, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x91, 0x91, 0xba, 0xba, 0xeb, 0x9b,
+    0xeb, 0x36, 0x81, 0x39, 0x15, 0x86, 0x59, 0x09, 0x37, 0x78, 0x1c, 0x88, 0x97, 0x02, 0xa0, 0xfa,
+    0x32, 0x4d, 0x0d, 0xae, 0x52, 0x5a, 0x30, 0x95, 0xbf, 0x30, 0x9f, 0x57, 0x00, 0x00, 0x00, 0x00,
+    0xcd, 0x7c, 0x06, 0x00, 0xe0, 0x07, 0xfc, 0xc3, 0xdb, 0xaf, 0xa6, 0x77, 0x8e, 0xc2, 0xc5, 0xfb,
+    0x29, 0x55, 0xa1, 0xb2, 0xe5, 0x49, 0xf1, 0xcf, 0x13, 0xd7, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x97, 0x2b, 0x5c, 0xe5, 0xff, 0xe2, 0x62, 0xd3, 0xaf, 0xc7, 0xcb,
+    0x46, 0xac, 0x41, 0xc7, 0x24, 0xb0, 0x94, 0xf4, 0x4f, 0x60, 0x80, 0xa4, 0xd2, 0xeb, 0x4e, 0x6b,
+    0x75, 0x50, 0x16, 0x4b, 0x56, 0x5d, 0xb0, 0x57, 0x00, 0x00, 0x00, 0x00, 0xac, 0x84, 0x06, 0x00,
+    0x84, 0x68, 0xb1, 0x41, 0x57, 0x54, 0xc6, 0x24, 0x6f, 0xa6, 0xe0, 0x2c, 0x96, 0xfc, 0xb4, 0x76,
+    0x7b, 0x8c, 0x23, 0x7f, 0x86, 0xf9, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9d, 0x04, 0x75, 0xb9, 0x48, 0x45, 0xb3, 0xf8, 0x93, 0xa4, 0xca, 0xb0, 0x6d, 0x43, 0xc2, 0x45,
+    0x0a, 0x46, 0x1a, 0x93, 0xe9, 0xc3, 0x3d, 0xb7, 0x83, 0xe4, 0x77, 0x7f, 0xef, 0x4a, 0xc2, 0x52,
+    0x06, 0x98, 0xc2, 0x57, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x8c, 0x06, 0x00, 0x2c, 0x4f, 0x23, 0x39,
+    0x7c, 0xbf, 0x93, 0x14, 0xb9, 0x61, 0x7f, 0xe5, 0xc2, 0xc9, 0x2c, 0x90, 0x67, 0x80, 0x96, 0xbd,
+    0xf8, 0x32, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x14, 0xf1, 0x3c,
+    0x83, 0x6f, 0xef, 0xfa, 0x8f, 0xb5, 0x5d, 0xde, 0x4b, 0xb3, 0xe2, 0xb5, 0x33, 0x73, 0x0f, 0x4d,
+    0xbc, 0xef, 0x09, 0x1b, 0x6f, 0x9d, 0x9a, 0x74, 0x31, 0xd4, 0xb1, 0xca, 0x0e, 0x8b, 0xd4, 0x57,
+    0x00, 0x00, 0x00, 0x00, 0x6a, 0x94, 0x06, 0x00, 0xfb, 0x17, 0xfa, 0x5e, 0xc8, 0x6d, 0xb6, 0x83,
+    0x6b, 0x6e, 0xfe, 0x65, 0x34, 0xae, 0x3e, 0x63, 0x49, 0x87, 0x81, 0x03, 0xc1, 0x76, 0x09, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xeb, 0x53, 0xb6, 0xb3, 0x88, 0xc1, 0x54,
+    0x91, 0xcc, 0x13, 0x3a, 0x70, 0xd0, 0x8d, 0x6a, 0x37, 0x22, 0x7c, 0xfd, 0x47, 0xae, 0x91, 0x0b,
+    0x3b, 0xc7, 0x15, 0xdf, 0xc6, 0x9e, 0x9c, 0xb0, 0xc5, 0x2d, 0xe6, 0x57, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x9c, 0x06, 0x00, 0x9b, 0x52, 0x0d, 0x59, 0xb6, 0x91, 0x4e, 0xf3, 0x72, 0xe1, 0x42, 0x04,
+    0x75, 0x96, 0x38, 0xf0, 0xa2, 0xb5, 0xe5, 0x18, 0x02, 0x2e, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xee, 0xdf, 0xff, 0xf9, 0xdd, 0x2b, 0x35, 0x2e, 0x3b, 0x10, 0xe3, 0xd3,
+    0x9a, 0xb8, 0xc0, 0x4f, 0x63, 0xa7, 0xeb, 0xb0, 0x2d, 0xb4, 0x61, 0xf4, 0x9c, 0xe2, 0xba, 0x00,
+    0x15, 0xcb, 0x0f, 0xd7, 0xac, 0xf4, 0xf6, 0x57, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa4, 0x06, 0x00,
+    0x64, 0xbf, 0x9f, 0x07, 0xc8, 0x47, 0x4c, 0x4a, 0x84, 0xb5, 0x0b, 0xe1, 0x0f, 0xec, 0xf7, 0x21,
+    0x03, 0x76, 0xc4, 0x4b, 0x28, 0x03, 0x85, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xbc, 0x4a, 0xa8, 0xcb, 0xab, 0x49, 0x22, 0x4d, 0x74, 0xca, 0x54, 0x31, 0xd4, 0x09, 0xf4, 0x0d,
+    0x73, 0x3b, 0x72, 0xd4, 0x79, 0x7e, 0x6a, 0x84, 0x4f, 0xe8, 0x05, 0x1e, 0x33, 0xef, 0xdb, 0xec,
+    0x93, 0xfa, 0x09, 0x58, 0x00, 0x00, 0x00, 0x00, 0x07, 0xac, 0x06, 0x00, 0x73, 0xa5, 0x6d, 0x19,
+    0x51, 0x74, 0x8e, 0xdb, 0x00, 0xba, 0x4b, 0x58, 0x72, 0xf7, 0x81, 0x2c, 0x6b, 0x9f, 0xcb, 0xb2,
+    0xac, 0xd2, 0x9b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xf9, 0xc3, 0xc4,
+    0x56, 0xac, 0x35, 0xa4, 0x0f, 0x17, 0x39, 0xdb, 0x37, 0x65, 0x47, 0x3f, 0x8c, 0x31, 0x40, 0xc6,
+    0x90, 0x36, 0xd0, 0xfb, 0xa5, 0x43, 0xca, 0x45, 0xee, 0x9c, 0x82, 0x50, 0x2c, 0xc9, 0x1b, 0x58,
+    0x00, 0x00, 0x00, 0x00, 0xe6, 0xb3, 0x06, 0x00, 0x40, 0x6b, 0x1b, 0x72, 0x3d, 0x33, 0x06, 0x7b,
+    0x90, 0xd6, 0xc8, 0xa6, 0xde, 0xc8, 0xc1, 0xcd, 0x9f, 0x0b, 0xae, 0x94, 0x55, 0x71, 0xc2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe3, 0xca, 0xc8, 0xfe, 0x1a, 0x04, 0x42,
+    0xbf, 0x4a, 0xe5, 0x4c, 0x08, 0x18, 0x88, 0x35, 0x5d, 0x44, 0x8a, 0x31, 0xde, 0x3f, 0x37, 0x3a,
+    0x73, 0x98, 0x1c, 0xca, 0x08, 0x86, 0x00, 0xa5, 0xcd, 0xd8, 0x2c, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0xc5, 0xbb, 0x06, 0x00, 0xc3, 0xbf, 0x3a, 0x8d, 0xea, 0x15, 0xe3, 0x37, 0x50, 0x8e, 0x14, 0x7d,
+    0xe6, 0x69, 0x8e, 0x50, 0x4e, 0x4a, 0x20, 0xeb, 0xb9, 0xb9, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xde, 0x0f, 0x6f, 0x30, 0xfe, 0x22, 0x7b, 0x1c, 0xa8, 0xb8, 0x8c, 0x99,
+    0x16, 0x10, 0x61, 0x18, 0x2f, 0xb6, 0xde, 0x98, 0x3e, 0x62, 0xba, 0xb8, 0x19, 0x23, 0xe7, 0x40,
+    0x98, 0x44, 0xa7, 0xbc, 0x00, 0xee, 0x3e, 0x58, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xc3, 0x06, 0x00,
+    0x57, 0x59, 0x7d, 0x9e, 0x26, 0xc6, 0xb3, 0x8d, 0x34, 0x22, 0x59, 0x9e, 0x89, 0x6d, 0xf0, 0xc6,
+    0xff, 0x4d, 0x04, 0xde, 0xe2, 0xa4, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9d, 0xc3, 0xd0, 0x5e, 0x8f, 0xfe, 0xc5, 0x9c, 0x63, 0x74, 0xfa, 0xe4, 0xd9, 0x18, 0x56, 0xf7,
+    0xa4, 0x65, 0x99, 0xfc, 0xe1, 0x6e, 0xef, 0x3a, 0x35, 0x93, 0xe0, 0xa9, 0xbe, 0x44, 0x2d, 0x97,
+    0x20, 0xf1, 0x4f, 0x58, 0x00, 0x00, 0x00, 0x00, 0x83, 0xcb, 0x06, 0x00, 0xfd, 0x6e, 0xee, 0xc0,
+    0xb5, 0x0a, 0x67, 0x8b, 0xdc, 0x60, 0x10, 0x02, 0xc6, 0xf1, 0xd7, 0x2d, 0xcd, 0x0f, 0xf0, 0xef,
+    0x1e, 0x94, 0x72, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf4, 0x16, 0xfb,
+    0x65, 0x60, 0xb0, 0x34, 0x63, 0xfe, 0xb0, 0x65, 0xbb, 0xb5, 0x49, 0xcd, 0xdc, 0x12, 0x54, 0x2f,
+    0x3c, 0x4b, 0x4b, 0x3c, 0xda, 0x55, 0x21, 0x61, 0x3f, 0xac, 0x04, 0xab, 0xd4, 0x40, 0x62, 0x58,
+    0x00, 0x00, 0x00, 0x00, 0x62, 0xd3, 0x06, 0x00, 0x9c, 0x2d, 0x23, 0x89, 0x40, 0x1d, 0x75, 0x07,
+    0xfc, 0x16, 0xe7, 0xaa, 0x03, 0x57, 0x5d, 0x06, 0x9d, 0xd6, 0xaa, 0x00, 0x43, 0x2c, 0xf2, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x24, 0xa1, 0xa0, 0x16, 0x6b, 0xac, 0x09,
+    0xfc, 0x64, 0x54, 0x1f, 0x10, 0x7d, 0xe5, 0xd6, 0xf2, 0x72, 0xaa, 0x90, 0xbb, 0xe6, 0xd4, 0xcb,
+    0x90, 0xc9, 0x20, 0xb8, 0x00, 0x12, 0x5f, 0x16, 0x27, 0x64, 0x73, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x41, 0xdb, 0x06, 0x00, 0x20, 0xc2, 0xe0, 0xe0, 0x3d, 0x09, 0x0e, 0x28, 0x70, 0x46, 0x03, 0xef,
+    0x38, 0x5c, 0x04, 0x59, 0x1f, 0x54, 0xd3, 0xc6, 0x82, 0xf7, 0xec, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6d, 0x0a, 0x5a, 0x17, 0x8e, 0x9d, 0x09, 0x06, 0xf6, 0x27, 0xab, 0x14,
+    0xd1, 0x27, 0x34, 0xef, 0x99, 0x52, 0xca, 0x3b, 0x5a, 0x8e, 0x18, 0x06, 0xd6, 0x00, 0x02, 0xea,
+    0xb8, 0x1f, 0xe1, 0x1b, 0xcc, 0x8f, 0x83, 0x58, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe3, 0x06, 0x00,
+    0x4d, 0xaa, 0x98, 0xbe, 0xd9, 0x45, 0xae, 0xac, 0x0d, 0xc6, 0x12, 0xa8, 0x34, 0xa7, 0xaf, 0xf5,
+    0xb9, 0x6a, 0x37, 0xa3, 0x11, 0xd2, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2b, 0xaa, 0xd6, 0x47, 0xb1, 0x00, 0xe1, 0x4d, 0x9e, 0xb2, 0xde, 0x37, 0x0e, 0x43, 0x05,
+    0x5a, 0x52, 0xc2, 0xad, 0x50, 0x01, 0x49, 0x86, 0xc6, 0x79, 0x0e, 0x09, 0x38, 0xa4, 0xf3, 0x0f,
+    0xb6, 0x7b, 0x94, 0x58, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x06, 0x00, 0x91, 0x27, 0xe6, 0xec,
+    0xcb, 0xd5, 0x00, 0x8e, 0xea, 0x0a, 0x27, 0x87, 0xed, 0xfd, 0x7e, 0xfe, 0x35, 0x4e, 0x03, 0x4f,
+    0x70, 0xfd, 0x99, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x6f, 0x07, 0xf7,
+    0x02, 0xf1, 0x0e, 0xd6, 0xdf, 0x76, 0xd1, 0x5d, 0xfe, 0xdb, 0x79, 0x56, 0x63, 0xdc, 0xab, 0x5f,
+    0x04, 0xb4, 0x20, 0x72, 0x48, 0xc9, 0x60, 0xf4, 0x50, 0x23, 0xe5, 0x67, 0x19, 0x2e, 0xa6, 0x58,
+    0x00, 0x00, 0x00, 0x00, 0xde, 0xf2, 0x06, 0x00, 0xd2, 0xaa, 0x10, 0xfa, 0xe8, 0xa8, 0xc3, 0x20,
+    0x8d, 0xed, 0xb2, 0x8f, 0x81, 0x6a, 0xe1, 0x05, 0x13, 0xe3, 0xe7, 0x25, 0x38, 0x19, 0xa1, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x3c, 0x25, 0xca, 0x15, 0x63, 0xb6, 0x08,
+    0x6f, 0x02, 0x5c, 0xcd, 0xbc, 0x92, 0x7a, 0x7d, 0x43, 0xfe, 0x3e, 0xad, 0xba, 0xd6, 0xbc, 0xb1,
+    0xde, 0xdc, 0x2b, 0xcb, 0x05, 0xb5, 0x19, 0x18, 0xf7, 0xb5, 0xb7, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0xbd, 0xfa, 0x06, 0x00, 0x82, 0x34, 0xec, 0xcd, 0x4d, 0xa4, 0x15, 0x67, 0x15, 0xc1, 0x10, 0x78,
+    0xbd, 0x6f, 0xce, 0xca, 0x01, 0xc3, 0xa3, 0xb3, 0xa0, 0x4b, 0xfb, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc9, 0x37, 0x5f, 0xc7, 0x5e, 0x00, 0xfc, 0x5e, 0xe4, 0x47, 0xe0, 0xa0,
+    0xa7, 0x8b, 0x40, 0x6f, 0x56, 0x4d, 0xe8, 0x99, 0x6a, 0x0e, 0x69, 0xd5, 0x59, 0x20, 0xb8, 0xd8,
+    0x7c, 0x01, 0xed, 0x82, 0x5a, 0xa3, 0xc9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x02, 0x07, 0x00,
+    0x00, 0x16, 0x89, 0xf8, 0xb6, 0x88, 0x97, 0xe9, 0x60, 0xc1, 0x31, 0x44, 0xc8, 0x10, 0x47, 0x5e,
+    0x83, 0x75, 0x7c, 0xb0, 0xab, 0x9a, 0x4a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf7, 0xc0, 0x71, 0x65, 0x80, 0x0b, 0x5f, 0xda, 0x9a, 0xa8, 0x33, 0x83, 0xcc, 0xa1, 0xcd, 0x14,
+    0xa4, 0x51, 0x5d, 0xca, 0x96, 0x44, 0xf1, 0xdc, 0x24, 0xef, 0x02, 0x8f, 0x51, 0x93, 0x01, 0x4a,
+    0x1e, 0x39, 0xdb, 0x58, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0x07, 0x00, 0xf9, 0xeb, 0x10, 0x25,
+    0xa7, 0x37, 0xc0, 0xab, 0x68, 0xcc, 0x5e, 0xbf, 0x7e, 0x03, 0xce, 0x3d, 0x0e, 0xb7, 0x1a, 0x1e,
+    0xd5, 0x10, 0xfb, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xce, 0x16, 0xe9,
+    0x5b, 0x61, 0x13, 0xfd, 0x74, 0x6a, 0xef, 0x79, 0x47, 0xa0, 0xb3, 0xf8, 0x50, 0x04, 0x72, 0xc5,
+    0xec, 0x75, 0xf9, 0x5c, 0xcd, 0x0e, 0xce, 0xa3, 0x40, 0x5e, 0x7d, 0x52, 0xdb, 0xe6, 0xec, 0x58,
+    0x00, 0x00, 0x00, 0x00, 0x5a, 0x12, 0x07, 0x00, 0x4b, 0xe1, 0x97, 0x38, 0x9a, 0x22, 0x60, 0xc3,
+    0x36, 0xed, 0x76, 0x96, 0x15, 0x1e, 0xe4, 0x8b, 0x56, 0x5d, 0xf3, 0x34, 0xaa, 0x4c, 0x32, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x8c, 0xb5, 0x46, 0x80, 0x8d, 0x50, 0x12,
+    0xf7, 0x32, 0x5c, 0x0c, 0xb6, 0x46, 0x7d, 0x9f, 0x86, 0xcf, 0xf3, 0xcd, 0xab, 0xb7, 0x0c, 0x87,
+    0x6c, 0x60, 0x5c, 0x69, 0x6f, 0xf1, 0x0b, 0x55, 0x37, 0x67, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x39, 0x1a, 0x07, 0x00, 0xae, 0x3b, 0x03, 0x0a, 0x63, 0xba, 0x31, 0x55, 0x2c, 0xb8, 0x90, 0xed,
+    0x37, 0xe3, 0x1a, 0x26, 0xa9, 0x47, 0x20, 0x1f, 0x3a, 0x52, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xc8, 0x76, 0x86, 0x86, 0x1d, 0xa3, 0x57, 0xb9, 0x97, 0x10, 0x68,
+    0xf1, 0xf8, 0xcd, 0xe1, 0xfb, 0xe4, 0x84, 0x8d, 0xa9, 0xb8, 0xe0, 0x1b, 0x16, 0x19, 0xd0, 0xd0,
+    0x6b, 0x32, 0x07, 0x1f, 0xff, 0x98, 0x10, 0x59, 0x00, 0x00, 0x00, 0x00, 0x18, 0x22, 0x07, 0x00,
+    0x88, 0x14, 0x36, 0x17, 0x9c, 0x07, 0xb0, 0x5d, 0xc1, 0x56, 0x68, 0x30, 0xf6, 0xb7, 0x90, 0xc9,
+    0x3c, 0x82, 0x08, 0xed, 0xa9, 0x40, 0x3e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x69, 0x73, 0x09, 0x58, 0x24, 0xbc, 0x0f, 0x88, 0x6e, 0x9d, 0x16, 0xcf, 0x11, 0x8e, 0xa2, 0xb2,
+    0xb3, 0xc0, 0x71, 0x93, 0x17, 0x84, 0xf8, 0xc1, 0x8a, 0x85, 0x52, 0xf9, 0x7f, 0x0d, 0x01, 0x85,
+    0x84, 0xdf, 0x21, 0x59, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x29, 0x07, 0x00, 0x3f, 0xa5, 0x81, 0xee,
+    0x9b, 0x06, 0x21, 0xca, 0xd3, 0x0b, 0xcc, 0x97, 0x90, 0xae, 0x60, 0xdf, 0x3e, 0xd7, 0x42, 0x8c,
+    0x2a, 0xd1, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x86, 0x04, 0x5f,
+    0x07, 0xa6, 0x45, 0x52, 0x7f, 0x80, 0xc9, 0xe6, 0x4d, 0x76, 0xc4, 0xb1, 0xbd, 0xb1, 0x8b, 0x56,
+    0x31, 0x22, 0x7e, 0xfa, 0x36, 0x21, 0x8f, 0x45, 0x58, 0x47, 0x30, 0xd5, 0x52, 0x4c, 0x32, 0x59,
+    0x00, 0x00, 0x00, 0x00, 0xd6, 0x31, 0x07, 0x00, 0xda, 0xb6, 0x0a, 0xd0, 0x0f, 0x81, 0x80, 0x77,
+    0x52, 0xaa, 0xd5, 0x4c, 0x2d, 0xd9, 0x7b, 0x44, 0x41, 0x4b, 0x50, 0xc5, 0xbe, 0xf3, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x35, 0x52, 0xab, 0xdc, 0x14, 0x51, 0x47,
+    0xa7, 0x13, 0x71, 0xb4, 0xc0, 0x7f, 0x12, 0x17, 0xf3, 0xdb, 0x0e, 0xcb, 0xc5, 0xb1, 0xad, 0x99,
+    0x73, 0x71, 0x9b, 0xe1, 0x5f, 0xb3, 0x88, 0xe1, 0xe4, 0xa4, 0x43, 0x59, 0x00, 0x00, 0x00, 0x00,
+    0xb5, 0x39, 0x07, 0x00, 0xcb, 0x76, 0xac, 0x53, 0x0f, 0x01, 0xf5, 0x67, 0xb6, 0xd8, 0x84, 0xd1,
+    0x16, 0x1e, 0x50, 0x2b, 0x91, 0xe7, 0x80, 0x8b, 0xf2, 0x0f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe8, 0x40, 0xd4, 0xec, 0x2a, 0xc9, 0xe6, 0x13, 0xd4, 0x2d, 0xbd, 0x0c,
+    0xaf, 0xda, 0x18, 0xbc, 0xdb, 0x0f, 0xd0, 0x8d, 0xae, 0xf8, 0x18, 0x1a, 0x18, 0xc4, 0xbb, 0xde,
+    0x10, 0x3b, 0x53, 0x65, 0x95, 0x6b, 0x56, 0x59, 0x00, 0x00, 0x00, 0x00, 0x94, 0x41, 0x07, 0x00,
+    0x87, 0xb2, 0x0d, 0x0a, 0x85, 0xda, 0xf7, 0x7e, 0x52, 0xaf, 0xc4, 0x97, 0xd3, 0x2b, 0x6a, 0x19,
+    0x00, 0x9c, 0xfc, 0xef, 0x81, 0x0f, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe2, 0x1d, 0xb2, 0x36, 0xd0, 0xa4, 0x97, 0x3e, 0x99, 0x13, 0x4a, 0x3b, 0x42, 0xee, 0xb0, 0x0b,
+    0x31, 0x1f, 0xc8, 0x55, 0xde, 0x4c, 0xc4, 0xbc, 0x1a, 0x58, 0x44, 0x24, 0xb7, 0x4c, 0x69, 0x5c,
+    0xa3, 0x9a, 0x66, 0x59, 0x00, 0x00, 0x00, 0x00, 0x73, 0x49, 0x07, 0x00, 0x8f, 0x07, 0x71, 0xdc,
+    0x8f, 0xd0, 0x1d, 0x8a, 0xa8, 0xfb, 0x54, 0x42, 0x35, 0x1d, 0x75, 0xa6, 0x79, 0x32, 0x1d, 0xd5,
+    0x33, 0xb2, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x29, 0x8b, 0x0e,
+    0x71, 0x4d, 0x83, 0xd6, 0x51, 0x13, 0x3f, 0xe3, 0x3a, 0x15, 0xa8, 0x4f, 0x92, 0xdb, 0xd4, 0x37,
+    0x24, 0x13, 0x74, 0x4f, 0xf2, 0x20, 0x23, 0xb0, 0x1d, 0x34, 0x60, 0x0a, 0x38, 0xb1, 0x77, 0x59,
+    0x00, 0x00, 0x00, 0x00, 0x52, 0x51, 0x07, 0x00, 0xd5, 0x66, 0x8a, 0x6d, 0x2c, 0x4c, 0xdf, 0x9c,
+    0xd0, 0xd1, 0x34, 0xec, 0xde, 0x99, 0x14, 0x46, 0x47, 0x3e, 0x4d, 0xc2, 0x5e, 0x50, 0x08, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xb4, 0xda, 0xf2, 0xea, 0xfe, 0xeb, 0x55,
+    0x88, 0x22, 0xc8, 0xfc, 0x56, 0xc2, 0x82, 0x28, 0xac, 0x69, 0x4e, 0xe2, 0x07, 0xa2, 0x98, 0x22,
+    0x4a, 0x51, 0x00, 0x3c, 0xe5, 0x5e, 0x41, 0xd8, 0x48, 0x08, 0x89, 0x59, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0x59, 0x07, 0x00, 0x0d, 0xe9, 0x08, 0xd7, 0x39, 0x89, 0xe4, 0x0c, 0xa1, 0x98, 0x69, 0xe4,
+    0x8e, 0xcb, 0x77, 0x19, 0x28, 0x84, 0x59, 0x2d, 0x2a, 0x71, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x9e, 0x70, 0xdf, 0xed, 0xf2, 0x3d, 0xa3, 0x3a, 0xcb, 0x54, 0x78,
+    0xf3, 0x2e, 0x34, 0x5a, 0x57, 0xf6, 0xcf, 0x49, 0xef, 0x7d, 0x99, 0x6b, 0x8e, 0x7d, 0xeb, 0xd1,
+    0x29, 0x63, 0x4a, 0x93, 0x5a, 0xb9, 0x9b, 0x59, 0x00, 0x00, 0x00, 0x00, 0x10, 0x61, 0x07, 0x00,
+    0x51, 0x5d, 0x74, 0x24, 0x8a, 0x15, 0xdc, 0xb9, 0x2a, 0x33, 0x11, 0x8f, 0x1e, 0xc0, 0x9d, 0x65,
+    0x71, 0xd0, 0x3a, 0x5c, 0xb5, 0x60, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x97, 0x01, 0xa2, 0x1e, 0x61, 0x71, 0x73, 0x87, 0x4b, 0x28, 0x3f, 0xb2, 0x75, 0x2a, 0x25,
+    0x01, 0xd5, 0x1d, 0x8f, 0x43, 0xaa, 0x68, 0x48, 0x0b, 0x9b, 0x3a, 0x4f, 0x6b, 0x34, 0x25, 0x56,
+    0x9e, 0x4b, 0xae, 0x59, 0x00, 0x00, 0x00, 0x00, 0xef, 0x68, 0x07, 0x00, 0x87, 0xec, 0xb6, 0x1e,
+    0x22, 0x1d, 0x4c, 0x7a, 0x42, 0xe2, 0xdb, 0x94, 0x56, 0x24, 0x6c, 0x6a, 0x2f, 0xcf, 0x7f, 0xcc,
+    0x72, 0x98, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x9e, 0x21, 0xcf,
+    0xd3, 0xb3, 0x86, 0x8c, 0xa7, 0x9d, 0x86, 0xf0, 0xc2, 0x9b, 0x75, 0xbc, 0xe0, 0x99, 0xf2, 0xeb,
+    0x7c, 0x51, 0x0d, 0x8a, 0xc8, 0x32, 0x24, 0x5f, 0xcd, 0x22, 0x6b, 0x84, 0xb2, 0x7c, 0xbd, 0x59,
+    0x00, 0x00, 0x00, 0x00, 0xce, 0x70, 0x07, 0x00, 0xe5, 0xd6, 0x56, 0xc9, 0x8f, 0x0f, 0x39, 0xd9,
+    0xf3, 0x90, 0x2f, 0x7f, 0x24, 0x10, 0xfc, 0x93, 0x1d, 0xf9, 0xc5, 0xf7, 0x8c, 0x93, 0xd6, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x92, 0x74, 0x92, 0x27, 0x3f, 0x8a, 0xd7,
+    0xbb, 0x0a, 0xe1, 0x4c, 0xc5, 0xea, 0xe7, 0x29, 0x61, 0x75, 0xa7, 0xbf, 0x32, 0x86, 0xc6, 0x41,
+    0xd8, 0xc3, 0x4e, 0x84, 0x55, 0x5e, 0x95, 0x73, 0x66, 0x15, 0xcf, 0x59, 0x00, 0x00, 0x00, 0x00,
+    0xad, 0x78, 0x07, 0x00, 0x61, 0xa7, 0x1c, 0x6b, 0x21, 0x09, 0x14, 0x19, 0x24, 0x3a, 0x29, 0x09,
+    0x72, 0x47, 0x1f, 0x84, 0x34, 0xfc, 0x59, 0xf7, 0x6a, 0xf1, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x85, 0xf7, 0x56, 0x77, 0x19, 0xa5, 0xbc, 0x32, 0xc9, 0xb3, 0xa3,
+    0xdd, 0xb6, 0x3e, 0x76, 0xb7, 0x10, 0x8b, 0xda, 0x05, 0x19, 0x29, 0x49, 0x7d, 0x3f, 0xbf, 0x77,
+    0xfa, 0x29, 0x03, 0xaa, 0x26, 0xdd, 0xe0, 0x59, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x80, 0x07, 0x00,
+    0x60, 0xd3, 0xe2, 0x01, 0x21, 0x20, 0x89, 0xb3, 0x2d, 0x22, 0x61, 0x7e, 0xd1, 0x3a, 0x16, 0x0b,
+    0xf8, 0x1c, 0xe6, 0x4b, 0xb5, 0x6c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2c, 0xab, 0x75, 0xbd, 0xb0, 0x9a, 0x39, 0x9f, 0xf3, 0x05, 0xba, 0xf0, 0xcd, 0xd7, 0x46, 0x9f,
+    0x29, 0x05, 0xba, 0x6d, 0x76, 0x5b, 0xb2, 0x2d, 0x6c, 0x43, 0x1a, 0x5b, 0x8e, 0xe8, 0xdf, 0x1f,
+    0x89, 0x8a, 0xf0, 0x59, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x88, 0x07, 0x00, 0xe5, 0x10, 0x81, 0x26,
+    0xe1, 0x57, 0xf3, 0xe2, 0x90, 0x9b, 0x2a, 0x65, 0x6e, 0x52, 0xb9, 0x6c, 0xfa, 0xc6, 0x45, 0x0f,
+    0x40, 0xb9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x75, 0x30, 0xff,
+    0xe4, 0x53, 0x2f, 0x40, 0xef, 0x34, 0x2c, 0x14, 0x56, 0x29, 0xb1, 0xd6, 0x0c, 0x7d, 0x0b, 0x7b,
+    0xf2, 0x86, 0x27, 0x0d, 0xdd, 0x85, 0x2a, 0x72, 0x96, 0x91, 0xc0, 0x05, 0x1b, 0x7b, 0x03, 0x5a,
+    0x00, 0x00, 0x00, 0x00, 0x4a, 0x90, 0x07, 0x00, 0x3a, 0xf5, 0xe3, 0x2e, 0xe3, 0x87, 0x74, 0x52,
+    0x25, 0xb4, 0xcd, 0x2a, 0x94, 0x5e, 0x82, 0xc1, 0x4f, 0x46, 0x79, 0xff, 0xc7, 0xd0, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x39, 0x63, 0xb8, 0x60, 0x34, 0x5e, 0x4b,
+    0x5f, 0xb1, 0x73, 0xb0, 0x40, 0xbd, 0x78, 0x18, 0x8e, 0xe5, 0x12, 0x6e, 0xd0, 0x34, 0x22, 0x58,
+    0x0b, 0xe9, 0x3e, 0xc7, 0xcb, 0x8e, 0xde, 0xfb, 0x9c, 0x6b, 0x16, 0x5a, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x98, 0x07, 0x00, 0xc7, 0x85, 0x60, 0x87, 0xf1, 0x39, 0x27, 0xe3, 0x7e, 0xfe, 0x8c, 0x4c,
+    0xf0, 0x28, 0x98, 0x28, 0x55, 0x88, 0xff, 0x55, 0xf6, 0x35, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcc, 0x82, 0x00, 0x19, 0xb7, 0x3f, 0xf7, 0xfd, 0x11, 0x0a, 0xbd, 0xbf,
+    0x66, 0xe5, 0x22, 0x3d, 0xa3, 0x4b, 0x35, 0xd3, 0xcf, 0xd1, 0xe7, 0x32, 0xe6, 0x81, 0x43, 0x97,
+    0x1d, 0x40, 0x81, 0x7c, 0x7c, 0x70, 0x26, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa0, 0x07, 0x00,
+    0x5b, 0xdb, 0x56, 0x04, 0x2a, 0x15, 0x9e, 0x43, 0x50, 0xe6, 0x72, 0xbd, 0xc5, 0x13, 0x1c, 0x43,
+    0x92, 0x68, 0x6d, 0x8b, 0x13, 0xc3, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xdb, 0xbb, 0x56, 0x29, 0xd2, 0x33, 0xe9, 0x95, 0x0d, 0xc9, 0x7f, 0xa8, 0x83, 0x1a, 0x0e,
+    0x85, 0x89, 0x4e, 0x02, 0xeb, 0xdb, 0x2e, 0xdf, 0xa5, 0xc4, 0xff, 0x51, 0x22, 0xac, 0xf6, 0x44,
+    0x6d, 0xf4, 0x35, 0x5a, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xa7, 0x07, 0x00, 0xf3, 0x97, 0x9d, 0x0a,
+    0xfb, 0xae, 0x96, 0x07, 0xdc, 0xc8, 0x51, 0xe6, 0xfe, 0x0f, 0x4a, 0x4e, 0xb3, 0x71, 0x36, 0xdf,
+    0xc7, 0xb1, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x9c, 0x44,
+    0x0c, 0x04, 0xc0, 0xea, 0xf6, 0x60, 0x87, 0x3d, 0xf1, 0x40, 0x6c, 0xc5, 0x93, 0x88, 0xc4, 0xd2,
+    0x09, 0x97, 0x5e, 0x31, 0xc7, 0x5b, 0xae, 0xad, 0x72, 0x06, 0x99, 0x3c, 0xf3, 0xa1, 0x47, 0x5a,
+    0x00, 0x00, 0x00, 0x00, 0xc6, 0xaf, 0x07, 0x00, 0x78, 0x96, 0x7d, 0x86, 0xb8, 0x41, 0x92, 0xee,
+    0xe4, 0x44, 0x52, 0x8e, 0xb9, 0x48, 0x0a, 0xd4, 0x30, 0x68, 0xa7, 0xe5, 0x01, 0xf4, 0x6d, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xfc, 0xa2, 0xa4, 0x8e, 0xca, 0x42, 0x96,
+    0x02, 0x09, 0xbf, 0x52, 0x6f, 0x65, 0x6f, 0xd3, 0xb9, 0x7b, 0x23, 0xff, 0xdd, 0x08, 0xf1, 0x85,
+    0xfb, 0xbf, 0xd1, 0x7e, 0x74, 0x36, 0x53, 0xe6, 0xb5, 0xc9, 0x57, 0x5a, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0xb7, 0x07, 0x00, 0x76, 0x7b, 0x1e, 0xbf, 0x43, 0xb7, 0x94, 0x12, 0x6b, 0x69, 0x1c, 0xf2,
+    0x59, 0x21, 0x47, 0xf2, 0xad, 0xdb, 0x99, 0x79, 0xc1, 0x04, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x38, 0x60, 0x8e, 0x33, 0x43, 0x4b, 0x0b, 0x26, 0x8b, 0x65, 0xcf,
+    0x01, 0x85, 0x99, 0x98, 0x0c, 0x10, 0xa2, 0x4e, 0xf0, 0x5c, 0xff, 0x8c, 0x38, 0xf4, 0x89, 0xff,
+    0x92, 0xe7, 0x77, 0x60, 0xc1, 0xad, 0x67, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x84, 0xbf, 0x07, 0x00,
+    0x87, 0x6a, 0x41, 0xae, 0x75, 0xb8, 0x37, 0xff, 0x7b, 0x4c, 0x36, 0xa1, 0x04, 0x1f, 0xbe, 0x12,
+    0x64, 0xb7, 0xf5, 0xc0, 0x5d, 0x88, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9b, 0xb5, 0x45, 0x7b, 0xba, 0x3d, 0x47, 0xb1, 0x67, 0x47, 0x2f, 0xc2, 0xba, 0x91, 0xba, 0x54,
+    0x31, 0xb0, 0x9d, 0x82, 0xb8, 0x79, 0xd0, 0xe4, 0xb9, 0xfc, 0xa9, 0xa2, 0x1a, 0x27, 0x2d, 0x7e,
+    0xa6, 0x56, 0x78, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x63, 0xc7, 0x07, 0x00, 0x9c, 0x5f, 0xe4, 0x6a,
+    0x65, 0xcb, 0xc9, 0xf4, 0x5c, 0x8c, 0x93, 0x07, 0x03, 0x07, 0xd2, 0x48, 0x53, 0xec, 0xa1, 0x99,
+    0x5a, 0xa0, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x9a, 0x60, 0x5c,
+    0xe0, 0x04, 0x0f, 0x30, 0xfc, 0x0e, 0x5a, 0xf1, 0xf7, 0x1d, 0xcf, 0xe8, 0x64, 0x1e, 0x11, 0xe9,
+    0xc1, 0xb6, 0xd0, 0xd7, 0x0e, 0xbb, 0xc0, 0xe8, 0xf3, 0x93, 0x51, 0x71, 0x2c, 0xb2, 0x89, 0x5a,
+    0x00, 0x00, 0x00, 0x00, 0x42, 0xcf, 0x07, 0x00, 0x28, 0x18, 0x2c, 0xa6, 0x3b, 0xfe, 0x6a, 0x7b,
+    0xc9, 0xba, 0x72, 0x28, 0x9f, 0xa8, 0xed, 0xd9, 0x09, 0x62, 0xd2, 0x6d, 0x29, 0x75, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x27, 0x20, 0x8b, 0x04, 0x35, 0xd1, 0x06,
+    0xe3, 0x76, 0x63, 0x6b, 0x1e, 0x22, 0x11, 0x3a, 0xc2, 0x63, 0x10, 0xd4, 0xdc, 0x3f, 0x93, 0xac,
+    0x02, 0x16, 0x54, 0x44, 0x4f, 0x22, 0xce, 0x65, 0xb1, 0xa9, 0x9a, 0x5a, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0xd7, 0x07, 0x00, 0x9f, 0xef, 0xba, 0x2d, 0xff, 0xbf, 0x44, 0x38, 0x66, 0xea, 0x9d, 0xe1,
+    0x3f, 0xbd, 0xa7, 0xb3, 0xd9, 0xc9, 0xcc, 0xb4, 0x62, 0xbb, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xbd, 0x28, 0x8e, 0xe7, 0x11, 0xa0, 0x4e, 0xe7, 0xf0, 0x77, 0x2d, 0x9e,
+    0xe1, 0x0c, 0x6b, 0xe3, 0x7e, 0xac, 0x10, 0xfa, 0xfa, 0x65, 0x41, 0xae, 0xd2, 0x8f, 0x20, 0xbd,
+    0xc0, 0xd1, 0x2a, 0xc2, 0xa2, 0x0b, 0xac, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x07, 0x00,
+    0x37, 0x61, 0xde, 0x8a, 0x1a, 0x9b, 0x3b, 0x87, 0x21, 0x20, 0x43, 0x4e, 0x2c, 0xe6, 0x49, 0xdf,
+    0x6c, 0xf6, 0xb8, 0xed, 0x9c, 0x3e, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xbf, 0x56, 0x7e, 0xed, 0x89, 0x46, 0x72, 0x26, 0xee, 0xf7, 0x1e, 0xd3, 0x3e, 0xc3, 0xbc, 0x37,
+    0x96, 0x18, 0x86, 0x68, 0x24, 0xdb, 0xdd, 0xc7, 0x91, 0xa8, 0x56, 0x5f, 0x80, 0x24, 0x63, 0x39,
+    0xf9, 0x25, 0xbe, 0x5a, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xe6, 0x07, 0x00, 0xd4, 0x54, 0x15, 0x3c,
+    0x61, 0xbd, 0x15, 0xa4, 0x94, 0x72, 0x3e, 0xdd, 0x24, 0xe1, 0xac, 0x91, 0x32, 0xf3, 0x3f, 0x81,
+    0xc4, 0x59, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xa1, 0xb2, 0x77,
+    0xf6, 0x8b, 0x7c, 0x7e, 0xad, 0x03, 0xb3, 0x6d, 0x47, 0x11, 0xfc, 0x3a, 0xe6, 0x1e, 0xb2, 0x81,
+    0x30, 0x60, 0xcb, 0xa1, 0xfe, 0xc3, 0xe4, 0x4d, 0xcf, 0x7a, 0xa8, 0x60, 0xb0, 0x51, 0xcf, 0x5a,
+    0x00, 0x00, 0x00, 0x00, 0xbe, 0xee, 0x07, 0x00, 0x09, 0xf4, 0xac, 0x48, 0xa1, 0x7d, 0xe0, 0x3a,
+    0x1e, 0xd4, 0xf5, 0x25, 0x18, 0x75, 0x31, 0xd2, 0x54, 0xe8, 0x08, 0x00, 0x49, 0x95, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x59, 0xb5, 0x57, 0x5b, 0x37, 0x78, 0xf9,
+    0xaa, 0x39, 0x29, 0x1e, 0x04, 0xdd, 0x7e, 0xc2, 0x35, 0xbf, 0x2e, 0x2a, 0x6d, 0x40, 0x1c, 0x30,
+    0x49, 0x39, 0x55, 0x12, 0xee, 0xc2, 0xac, 0x26, 0x87, 0x83, 0xe0, 0x5a, 0x00, 0x00, 0x00, 0x00,
+    0x9d, 0xf6, 0x07, 0x00, 0x89, 0xcf, 0x64, 0xf1, 0x7d, 0x8b, 0x9d, 0x1c, 0xe8, 0x11, 0xb0, 0xd0,
+    0x0f, 0x29, 0xd6, 0x85, 0x5e, 0x02, 0x82, 0xc8, 0x92, 0x2d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x92, 0x02, 0xdd, 0x3c, 0x29, 0xae, 0x92, 0xc9, 0x28, 0xd5, 0x78, 0x02,
+    0xa8, 0xdd, 0x2b, 0xa1, 0x56, 0x69, 0x16, 0xf3, 0x65, 0x35, 0x1c, 0xbb, 0x15, 0x35, 0xfe, 0x8b,
+    0x6d, 0xbf, 0x10, 0xb3, 0x71, 0xb7, 0xf2, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xfe, 0x07, 0x00,
+    0xdd, 0xba, 0x27, 0x82, 0xd0, 0x3e, 0x2d, 0x38, 0x70, 0xa4, 0x8b, 0x7d, 0x1a, 0x9c, 0x92, 0xcd,
+    0x62, 0x07, 0xbe, 0x43, 0xa0, 0x74, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x93, 0xe6, 0xca, 0xf2, 0x54, 0x7a, 0x79, 0xa9, 0x50, 0x28, 0x81, 0xe7, 0x6a, 0x5b, 0x31, 0x96,
+    0xe8, 0x7a, 0x73, 0x6d, 0x21, 0x20, 0x60, 0x10, 0x95, 0x03, 0x7f, 0x82, 0x85, 0x98, 0x89, 0x40,
+    0x12, 0x76, 0x04, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x06, 0x08, 0x00, 0xb0, 0x9f, 0xc5, 0x48,
+    0x0c, 0x65, 0x88, 0x26, 0x93, 0x83, 0x2b, 0x54, 0xa7, 0xce, 0xa2, 0xa3, 0x95, 0x3d, 0x8e, 0x0c,
+    0x65, 0xb2, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x86, 0x8c, 0x5a,
+    0xd0, 0x40, 0x0f, 0x0e, 0x4b, 0x45, 0x7f, 0x16, 0x1b, 0x7e, 0x7f, 0x65, 0xca, 0xd7, 0xe7, 0x80,
+    0x77, 0x92, 0x9f, 0xa8, 0x35, 0xaa, 0xec, 0x96, 0x23, 0x38, 0x73, 0x61, 0x9b, 0x0d, 0x15, 0x5b,
+    0x00, 0x00, 0x00, 0x00, 0x3a, 0x0e, 0x08, 0x00, 0xc6, 0xd6, 0x37, 0x8d, 0xad, 0x83, 0xa3, 0x3f,
+    0x5e, 0x8b, 0xcd, 0x28, 0xad, 0x72, 0x70, 0x8f, 0x2f, 0xad, 0xa9, 0x58, 0xa9, 0x91, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x56, 0x8a, 0x83, 0x2e, 0x4a, 0x48, 0x4e,
+    0xf1, 0x23, 0x82, 0xbb, 0xc1, 0x20, 0x57, 0xbf, 0x2b, 0x48, 0x23, 0x7a, 0x81, 0x27, 0x86, 0xd4,
+    0xef, 0xcb, 0xfe, 0x04, 0x85, 0x89, 0x65, 0x3e, 0x11, 0x90, 0x26, 0x5b, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x16, 0x08, 0x00, 0x69, 0x1f, 0x0b, 0x26, 0x06, 0x6f, 0x0e, 0xe8, 0xd6, 0xbc, 0xc7, 0x70,
+    0x40, 0xc4, 0xdd, 0xb5, 0x7c, 0x5f, 0x37, 0x8c, 0xa1, 0xd4, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0xb9, 0xfc, 0x1b, 0x14, 0x96, 0xfc, 0xba, 0x07, 0x78, 0xdf, 0x2f,
+    0xfc, 0x32, 0x1d, 0xc3, 0x0c, 0x84, 0xaa, 0x31, 0xd9, 0x5c, 0x96, 0xb1, 0x6d, 0xa5, 0xe3, 0x75,
+    0x2e, 0x4d, 0x40, 0x6a, 0x1d, 0xed, 0x37, 0x5b, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1d, 0x08, 0x00,
+    0x43, 0x5a, 0xcb, 0x94, 0xca, 0x2e, 0x06, 0x42, 0xbe, 0x04, 0xc9, 0x2d, 0x57, 0xec, 0xb9, 0xda,
+    0xf2, 0xe9, 0xfc, 0xf9, 0x28, 0x35, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x9e, 0x7f, 0xa3, 0x31, 0x6f, 0x51, 0x21, 0xf4, 0xc2, 0xeb, 0xbb, 0xc6, 0xd8, 0xe7, 0x98,
+    0x66, 0xf0, 0x84, 0x12, 0xf7, 0xaa, 0x50, 0x76, 0x4a, 0xca, 0x09, 0x73, 0x6d, 0xae, 0xf0, 0xf9,
+    0x73, 0xad, 0x4a, 0x5b, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x25, 0x08, 0x00, 0x18, 0x84, 0x47, 0x97,
+    0x78, 0xc4, 0xda, 0x83, 0xd8, 0x08, 0x3e, 0xa6, 0x21, 0x97, 0x41, 0x18, 0xfa, 0x0d, 0xb1, 0x06,
+    0xa1, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x4f, 0x74, 0xb9,
+    0x5f, 0xcf, 0x85, 0x15, 0x50, 0x0b, 0x1b, 0x8a, 0x21, 0x34, 0x41, 0xc7, 0x3f, 0x26, 0x8c, 0xd6,
+    0x21, 0x9e, 0xa7, 0x5e, 0xfc, 0x89, 0xea, 0x04, 0xcc, 0x67, 0x9c, 0x33, 0x62, 0x6f, 0x5b, 0x5b,
+    0x00, 0x00, 0x00, 0x00, 0xb6, 0x2d, 0x08, 0x00, 0x23, 0x8e, 0xc4, 0x93, 0x91, 0x71, 0xac, 0xf9,
+    0x7b, 0xec, 0x34, 0xe9, 0x58, 0x3c, 0x01, 0xa6, 0xc9, 0x70, 0x55, 0x5e, 0xe9, 0x1d, 0x2b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x31, 0xcc, 0x38, 0xc0, 0xae, 0xc4, 0x56,
+    0x69, 0x4f, 0x81, 0x8c, 0x9b, 0x09, 0x12, 0xba, 0x13, 0x49, 0x1d, 0xdc, 0xd5, 0xdd, 0x22, 0x66,
+    0x05, 0xe3, 0x7a, 0xe7, 0x66, 0xaf, 0x55, 0xb8, 0xc3, 0xb8, 0x6c, 0x5b, 0x00, 0x00, 0x00, 0x00,
+    0x95, 0x35, 0x08, 0x00, 0x14, 0x83, 0xda, 0x34, 0x9b, 0xd1, 0x56, 0x1d, 0xfd, 0xdf, 0xab, 0xfb,
+    0x4d, 0xe3, 0x9b, 0x5b, 0x55, 0x05, 0x0b, 0x31, 0xeb, 0xc4, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe7, 0x2f, 0x03, 0x6e, 0x0a, 0x0d, 0x0b, 0xcc, 0x28, 0x28, 0xc2, 0x4a,
+    0xef, 0xc1, 0x24, 0x22, 0x22, 0xb2, 0xde, 0x0b, 0xe2, 0xf4, 0x04, 0xb2, 0xf4, 0x18, 0x5b, 0xc1,
+    0x92, 0x40, 0xfe, 0xaa, 0x75, 0xd1, 0x7d, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x74, 0x3d, 0x08, 0x00,
+    0xee, 0x4a, 0x03, 0x33, 0x17, 0x80, 0xee, 0x43, 0x2d, 0xd3, 0x7b, 0xb4, 0xc4, 0x30, 0xb5, 0x81,
+    0x6f, 0x20, 0x40, 0x41, 0x9b, 0xf5, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x7e, 0x9a, 0xfd, 0xb0, 0x73, 0xc6, 0xaf, 0x15, 0x00, 0x0b, 0xc3, 0xfc, 0x1f, 0xf4, 0x6d,
+    0x90, 0x53, 0xc6, 0xe1, 0x89, 0x99, 0x18, 0x39, 0xa2, 0x83, 0xbe, 0xb3, 0xe9, 0x7c, 0xf1, 0x0a,
+    0x3a, 0x93, 0x8f, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x53, 0x45, 0x08, 0x00, 0x15, 0x49, 0x8c, 0x25,
+    0x7e, 0xa4, 0xc9, 0xe2, 0x79, 0x51, 0xfe, 0xb1, 0x98, 0xa0, 0x16, 0xd4, 0x43, 0x27, 0x57, 0x89,
+    0xd9, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xd6, 0x8c, 0xbb,
+    0x64, 0x77, 0x0d, 0xf9, 0x12, 0x90, 0xfd, 0xa6, 0xd2, 0xbf, 0xc9, 0xb2, 0x60, 0x2b, 0xe2, 0xbe,
+    0x8f, 0xb4, 0xb4, 0x7f, 0x22, 0x6d, 0x76, 0x72, 0x9a, 0x68, 0x8c, 0x09, 0x5e, 0xcd, 0xa1, 0x5b,
+    0x00, 0x00, 0x00, 0x00, 0x32, 0x4d, 0x08, 0x00, 0x22, 0x74, 0xbd, 0x76, 0xc4, 0xa0, 0x23, 0x3e,
+    0xba, 0x18, 0x82, 0xef, 0xd9, 0x51, 0x4f, 0xff, 0xb4, 0x0d, 0x5a, 0x4c, 0xc8, 0x2c, 0x23, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x73, 0x43, 0x5e, 0x71, 0xb7, 0x18, 0x78,
+    0xa1, 0x29, 0xde, 0x28, 0x07, 0xde, 0x18, 0xee, 0x65, 0xac, 0x73, 0xc0, 0x5c, 0xc0, 0xe2, 0xd6,
+    0x64, 0x8f, 0x66, 0xbd, 0x90, 0xe5, 0x33, 0xaf, 0xd9, 0x3f, 0xb3, 0x5b, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x55, 0x08, 0x00, 0xc3, 0xa8, 0x46, 0xc2, 0xa8, 0xf4, 0x83, 0x22, 0x77, 0x68, 0x09, 0x04,
+    0xf2, 0x83, 0x43, 0x68, 0xee, 0xd7, 0xc6, 0x7d, 0xd4, 0x84, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa2, 0x1a, 0xc5, 0xe3, 0xd8, 0x04, 0x33, 0x64, 0xde, 0x76, 0x02, 0xf0,
+    0xa3, 0x4c, 0xd8, 0xe7, 0xf7, 0x21, 0x96, 0x03, 0xfe, 0xa8, 0xdb, 0xa3, 0x59, 0xe6, 0x7d, 0xa0,
+    0xe5, 0x72, 0xf0, 0x3f, 0xca, 0x61, 0xc6, 0x5b, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x5c, 0x08, 0x00,
+    0x80, 0xac, 0xc2, 0x08, 0xfb, 0x3e, 0x9f, 0xf1, 0xb3, 0x81, 0xcb, 0xe1, 0xde, 0xc4, 0xfd, 0xc1,
+    0xa2, 0x83, 0x40, 0x08, 0x85, 0xb7, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xa7, 0x76, 0x5c, 0x67, 0xe9, 0x33, 0x88, 0x38, 0x6b, 0x11, 0x7f, 0x83, 0x09, 0x7d, 0x02,
+    0x04, 0x60, 0x96, 0x3d, 0xd1, 0x41, 0x99, 0x32, 0xc3, 0x30, 0x6c, 0x3b, 0xfc, 0x3e, 0xcc, 0x4b,
+    0xc5, 0x32, 0xd9, 0x5b, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x64, 0x08, 0x00, 0xa9, 0xd5, 0xdb, 0x48,
+    0x85, 0x0e, 0x54, 0x02, 0xed, 0x74, 0x17, 0xd1, 0x8c, 0xdc, 0x08, 0x93, 0xfe, 0xf8, 0x05, 0x90,
+    0xe6, 0xf5, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x47, 0xbf, 0x6c,
+    0xae, 0xd2, 0x36, 0xea, 0x03, 0x42, 0xc2, 0xce, 0x8a, 0x5b, 0x0a, 0x9b, 0x67, 0x44, 0x4f, 0x5e,
+    0x35, 0xc2, 0xf6, 0xdc, 0x07, 0xa3, 0xbd, 0x1e, 0x7a, 0x9c, 0x67, 0x7e, 0xb8, 0x92, 0xec, 0x5b,
+    0x00, 0x00, 0x00, 0x00, 0xae, 0x6c, 0x08, 0x00, 0x00, 0x30, 0xaf, 0xbd, 0x81, 0xbc, 0x00, 0xd8,
+    0x5a, 0x13, 0xfb, 0xd7, 0xa1, 0xa3, 0x2f, 0x19, 0x51, 0x52, 0x48, 0xb7, 0x6b, 0xf8, 0x27, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x5f, 0xbb, 0x2d, 0xc1, 0xde, 0x0b, 0x0d,
+    0x9e, 0x31, 0x7f, 0x9d, 0xa1, 0xa0, 0xdb, 0x94, 0x19, 0x9d, 0xbf, 0xe0, 0xca, 0x66, 0x17, 0x57,
+    0xc8, 0x16, 0x7a, 0xc8, 0x00, 0x18, 0x20, 0x2f, 0x9f, 0x12, 0x02, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x8d, 0x74, 0x08, 0x00, 0xc1, 0xf3, 0x41, 0xb6, 0xbb, 0x51, 0xa4, 0xc8, 0x31, 0x19, 0x02, 0x59,
+    0x41, 0x20, 0x18, 0x88, 0xa1, 0x0b, 0x5e, 0xee, 0x4a, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9b, 0x80, 0xdb, 0x13, 0xa7, 0xfa, 0x3d, 0xd7, 0xd3, 0xe2, 0x30, 0xdf,
+    0x7c, 0x24, 0xa6, 0x8f, 0x82, 0x50, 0x0a, 0x42, 0x6c, 0x89, 0x8d, 0xab, 0x15, 0x21, 0xa4, 0x74,
+    0x0a, 0x06, 0x6f, 0xc6, 0xe2, 0xfc, 0x16, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x23, 0x7a, 0x08, 0x00,
+    0x6f, 0x53, 0x00, 0x49, 0x9e, 0xc2, 0x83, 0xf6, 0x35, 0x7d, 0x5f, 0x54, 0x23, 0x9a, 0xba, 0x9a,
+    0x22, 0x12, 0x34, 0x17, 0x54, 0xfd, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xdd, 0xfc, 0xdb, 0xc2, 0xf6, 0xa4, 0xe1, 0x96, 0xcb, 0xd9, 0xf5, 0xa5, 0x20, 0xe9, 0xd4, 0x4f,
+    0xdd, 0x71, 0x1d, 0xcc, 0x32, 0xcf, 0xf7, 0x6b, 0x16, 0xa1, 0xf8, 0x23, 0x56, 0xb2, 0x60, 0x82,
+    0xc4, 0x4d, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x7a, 0x08, 0x00, 0xad, 0xca, 0xef, 0xf6,
+    0xcd, 0x04, 0x8e, 0x34, 0x81, 0x20, 0x23, 0xb5, 0x63, 0x5c, 0xdf, 0x87, 0xc7, 0x93, 0x14, 0x42,
+    0x5c, 0xb3, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xd8, 0xda, 0x6f,
+    0xd2, 0xb9, 0xed, 0x0a, 0x50, 0x1f, 0x64, 0xf5, 0x1c, 0x86, 0x1f, 0xe4, 0x8a, 0x7a, 0xd6, 0x38,
+    0x53, 0xdb, 0x24, 0x92, 0x2a, 0x7a, 0x5b, 0xf4, 0xf1, 0x25, 0x57, 0x2b, 0x41, 0x50, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x25, 0x7a, 0x08, 0x00, 0xa8, 0xfe, 0xdb, 0xd5, 0x17, 0x90, 0xdd, 0x6e,
+    0xea, 0xf3, 0x09, 0x44, 0x6d, 0xf9, 0x19, 0x1d, 0x39, 0xc7, 0x81, 0xd9, 0x6c, 0x96, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xa8, 0xc4, 0xbd, 0xe9, 0x85, 0x21, 0x68,
+    0xe8, 0xe4, 0xeb, 0x07, 0xbe, 0xa1, 0x4d, 0xc4, 0xb6, 0x7b, 0x67, 0xb4, 0xb9, 0xba, 0x1a, 0x24,
+    0xb3, 0x8b, 0xc5, 0x09, 0x1d, 0x72, 0x4d, 0x00, 0xde, 0x50, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x7a, 0x08, 0x00, 0xa2, 0x7c, 0x6c, 0x17, 0xbf, 0xb3, 0x8a, 0x66, 0xbe, 0xa4, 0xad, 0x2e,
+    0xdd, 0x2a, 0xdf, 0x09, 0x4c, 0x3d, 0xeb, 0x3d, 0xc8, 0x0c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6b, 0x13, 0x09, 0xac, 0x00, 0x88, 0x2f, 0x1c, 0x8d, 0x00, 0x18, 0xc7,
+    0x62, 0xcc, 0x3d, 0xa8, 0xb0, 0xcf, 0x65, 0x97, 0x5e, 0x84, 0xe9, 0x68, 0xce, 0x43, 0xef, 0x98,
+    0xa7, 0x2d, 0x8d, 0x11, 0xf9, 0x50, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x27, 0x7a, 0x08, 0x00,
+    0xce, 0xf2, 0x92, 0xff, 0xdf, 0x5b, 0x93, 0x3f, 0xcd, 0x81, 0x51, 0x83, 0x11, 0xcc, 0x7c, 0x99,
+    0x48, 0xfb, 0xfd, 0xd7, 0x44, 0xa8, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0xaf, 0xb4, 0x22, 0xba, 0x4c, 0x09, 0xf0, 0x76, 0x3b, 0x4b, 0xb5, 0xf0, 0xaa, 0x5e, 0x71,
+    0xf1, 0xf2, 0x2b, 0xd1, 0x94, 0x32, 0x8a, 0xc6, 0x0f, 0x4e, 0x2b, 0x5a, 0x5b, 0xdb, 0x40, 0xe5,
+    0xd3, 0x55, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x28, 0x7a, 0x08, 0x00, 0x44, 0xd3, 0x46, 0x21,
+    0xf2, 0x31, 0x82, 0xe1, 0x6c, 0x10, 0x37, 0x12, 0x92, 0x45, 0x10, 0x05, 0x97, 0xb1, 0x4c, 0x52,
+    0xa4, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x7f, 0x19, 0xd9,
+    0x5c, 0x57, 0xf3, 0x09, 0x75, 0x61, 0xe3, 0xd7, 0x73, 0x98, 0xf2, 0x36, 0x0c, 0xef, 0xe2, 0xe4,
+    0x47, 0xd9, 0x04, 0xc5, 0x7e, 0xc1, 0x1a, 0x87, 0xf4, 0x36, 0xdb, 0x64, 0xe8, 0x55, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x29, 0x7a, 0x08, 0x00, 0x7d, 0xe3, 0xbc, 0xa9, 0x42, 0xea, 0x53, 0x37,
+    0x17, 0x05, 0xb7, 0x88, 0x6b, 0xc9, 0x41, 0x2f, 0xed, 0xa8, 0x8a, 0xef, 0x32, 0x91, 0x1e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xc8, 0xcf, 0x78, 0xe4, 0x0f, 0x6e, 0x44,
+    0x4a, 0x2f, 0x3c, 0x51, 0x81, 0x60, 0x35, 0xb5, 0x0d, 0x3a, 0xec, 0x6c, 0x82, 0x01, 0xda, 0x28,
+    0xb0, 0x3b, 0x83, 0xe7, 0xf5, 0xf1, 0x9a, 0x57, 0x10, 0x58, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x7a, 0x08, 0x00, 0x2a, 0xcc, 0x55, 0x51, 0x03, 0x98, 0xee, 0x1c, 0x40, 0xf3, 0x18, 0x49,
+    0xdd, 0x07, 0xae, 0x09, 0x59, 0x6f, 0x6e, 0x58, 0x6e, 0x79, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xda, 0x54, 0x49, 0xd4, 0xc4, 0x15, 0x65, 0x71, 0x35, 0xa6, 0x9e,
+    0x3c, 0x33, 0xa1, 0xc5, 0x78, 0xc6, 0x4c, 0x8f, 0xa4, 0x06, 0x72, 0x7a, 0x68, 0x4c, 0xad, 0xb5,
+    0x7e, 0x80, 0xe4, 0xd7, 0x5e, 0x63, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x7a, 0x08, 0x00,
+    0x6f, 0x9f, 0xef, 0x8a, 0x3d, 0x0a, 0x4b, 0xcd, 0x2e, 0xae, 0x5d, 0x05, 0x19, 0x24, 0xe3, 0xce,
+    0x62, 0x79, 0x9b, 0x6c, 0x17, 0x08, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x1e, 0x45, 0xce, 0x57, 0xab, 0x8d, 0x4c, 0x40, 0xed, 0xe7, 0x2c, 0x8a, 0xcc, 0x0d, 0x07,
+    0x85, 0xc6, 0x84, 0xc4, 0x97, 0x3d, 0x4f, 0x14, 0xbd, 0xc7, 0x86, 0x04, 0x6b, 0x5a, 0x30, 0x0a,
+    0x64, 0x66, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x7a, 0x08, 0x00, 0xfc, 0x30, 0x79, 0x1b,
+    0x34, 0x84, 0x5a, 0x46, 0xf3, 0x3b, 0xaa, 0x26, 0xc2, 0xbd, 0x55, 0x68, 0x37, 0x6c, 0xc1, 0x31,
+    0xd3, 0x36, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x0d, 0xc2, 0x92,
+    0x11, 0xa2, 0xc6, 0xa6, 0x8a, 0x98, 0xd8, 0xaf, 0x63, 0x1f, 0xaa, 0xf2, 0x7d, 0x58, 0xc0, 0xe3,
+    0x82, 0x04, 0x67, 0xbc, 0x4e, 0x5e, 0xd2, 0x93, 0xa8, 0xa8, 0x65, 0x4d, 0x46, 0x70, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x2d, 0x7a, 0x08, 0x00, 0x69, 0x63, 0x4f, 0x68, 0xbc, 0xfa, 0x70, 0x49,
+    0x2d, 0xf2, 0xcc, 0x40, 0x12, 0x63, 0x38, 0x16, 0x95, 0xb2, 0x1a, 0x4b, 0x14, 0xbb, 0x25, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x64, 0x93, 0x6b, 0x04, 0xfa, 0x8c, 0x58,
+    0x7b, 0x5b, 0x30, 0xa6, 0x1b, 0x3f, 0x09, 0x34, 0x4d, 0xb3, 0x57, 0xdb, 0x14, 0xe0, 0xa6, 0xc0,
+    0x0e, 0xaa, 0x5f, 0xe9, 0xf6, 0xae, 0xd2, 0x86, 0xcb, 0x72, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x2e, 0x7a, 0x08, 0x00, 0xf3, 0x09, 0x27, 0x34, 0x72, 0x93, 0x89, 0x38, 0x02, 0xb9, 0xc8, 0x45,
+    0xd0, 0x1a, 0xb7, 0xab, 0x8a, 0x48, 0x7d, 0x2f, 0x7e, 0xfd, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6b, 0xf4, 0xc4, 0xfa, 0xcc, 0x1c, 0x12, 0xb5, 0x4f, 0x8e, 0x5a, 0xa1,
+    0x49, 0x93, 0xa7, 0x78, 0x64, 0x5d, 0x02, 0x5a, 0x6c, 0xa7, 0x14, 0x2f, 0x42, 0x60, 0x98, 0x4f,
+    0x3f, 0xc6, 0x1a, 0x04, 0xe0, 0x77, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x7a, 0x08, 0x00,
+    0x78, 0xdf, 0x62, 0x57, 0x0d, 0x50, 0x3d, 0x04, 0xe0, 0x17, 0xe9, 0xca, 0x03, 0xc4, 0x11, 0x81,
+    0x86, 0x15, 0xe0, 0x0f, 0x34, 0x7a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc5, 0xe9, 0xff, 0xe9, 0x14, 0xd5, 0x98, 0x2b, 0xa0, 0x71, 0x7c, 0xfc, 0xff, 0x1e, 0x09, 0xeb,
+    0xbf, 0xe9, 0x22, 0xa5, 0x96, 0x8f, 0x87, 0x41, 0x46, 0xbb, 0x4f, 0x89, 0x03, 0x89, 0xb6, 0xee,
+    0xee, 0x7c, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x7a, 0x08, 0x00, 0xfa, 0x93, 0x7b, 0xd0,
+    0x2c, 0xf0, 0x17, 0x89, 0xe7, 0xae, 0xfc, 0xe5, 0xb0, 0xb0, 0x3c, 0x9b, 0x52, 0xec, 0xd3, 0x71,
+    0xfb, 0xe4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x20, 0x2f, 0xdd,
+    0x1a, 0x21, 0x43, 0x4a, 0x16, 0x80, 0xf1, 0x8f, 0x55, 0x1d, 0xcc, 0xcf, 0x9d, 0xc6, 0x45, 0x9c,
+    0x7c, 0x48, 0x32, 0xd9, 0xa0, 0xd8, 0x90, 0xe6, 0xb8, 0x64, 0xc3, 0x30, 0x4f, 0x7d, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x7a, 0x08, 0x00, 0xdc, 0xbc, 0xe3, 0x84, 0x66, 0xc9, 0x82, 0x95,
+    0x08, 0x45, 0x23, 0x7f, 0x53, 0x8c, 0xab, 0x82, 0x39, 0xd3, 0xe9, 0x7a, 0x72, 0x5c, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xc3, 0x34, 0xa4, 0xaa, 0x09, 0xe3, 0xe0,
+    0x4f, 0x02, 0x23, 0x50, 0xf5, 0x18, 0xb1, 0x28, 0x99, 0xf3, 0x85, 0x01, 0x15, 0xa1, 0xfa, 0x8e,
+    0xb0, 0xb0, 0xb4, 0x28, 0x85, 0x31, 0xae, 0x72, 0x05, 0x7e, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x7a, 0x08, 0x00, 0xd2, 0x83, 0x6b, 0x40, 0x90, 0x27, 0xb1, 0xe8, 0xd5, 0xbd, 0x0f, 0x3f,
+    0xde, 0x62, 0xd8, 0x31, 0xf8, 0xf9, 0x0c, 0xc0, 0x53, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x25, 0x8e, 0x44, 0x9c, 0xd1, 0x00, 0x88, 0x07, 0x97, 0xd7, 0x18,
+    0xa7, 0xaa, 0x68, 0x58, 0x91, 0xda, 0xe1, 0x2c, 0xe0, 0x2d, 0x32, 0xea, 0x6f, 0x22, 0xdd, 0xd3,
+    0x1f, 0x4c, 0x40, 0x86, 0x49, 0x81, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x33, 0x7a, 0x08, 0x00,
+    0xa6, 0x16, 0xdc, 0x94, 0x76, 0x3c, 0x06, 0xab, 0x80, 0x0e, 0x2c, 0x7e, 0x33, 0xd2, 0x35, 0x6f,
+    0x93, 0xec, 0x56, 0xa3, 0xb8, 0x78, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd5, 0xfc, 0xa3, 0x43, 0xc7, 0xf3, 0x7c, 0x07, 0xa7, 0x14, 0x0a, 0x09, 0x04, 0x11, 0x7f, 0xf8,
+    0x15, 0x84, 0xda, 0x95, 0xb2, 0xa3, 0x69, 0x68, 0x16, 0xe2, 0x90, 0x8f, 0x12, 0xe1, 0x71, 0x9d,
+    0xff, 0x84, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x34, 0x7a, 0x08, 0x00, 0xac, 0x5a, 0xe4, 0x92,
+    0xaf, 0x36, 0xdd, 0x18, 0x91, 0x42, 0xc0, 0xe0, 0x7a, 0xf3, 0xde, 0x2f, 0xf5, 0x68, 0xa8, 0xee,
+    0xfe, 0x85, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x83, 0xaf, 0xe8,
+    0x84, 0xed, 0x26, 0xe3, 0x90, 0xcf, 0xae, 0x61, 0x1a, 0x37, 0x18, 0xe7, 0x79, 0x50, 0x8d, 0x3e,
+    0xe7, 0x16, 0x9e, 0x76, 0xd6, 0xf6, 0xb4, 0x39, 0xcc, 0xd4, 0xb7, 0xa9, 0x1a, 0x86, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x35, 0x7a, 0x08, 0x00, 0x53, 0xb3, 0x00, 0xaf, 0xca, 0x37, 0xdd, 0x49,
+    0xbf, 0x51, 0xbc, 0x55, 0x88, 0x89, 0xc7, 0x15, 0xde, 0x5d, 0x96, 0x66, 0x52, 0x69, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x04, 0xc2, 0xa3, 0x9c, 0x93, 0x1a, 0xde,
+    0x10, 0xcd, 0x2f, 0x18, 0x97, 0x58, 0x08, 0x33, 0x52, 0x31, 0x72, 0x37, 0xec, 0xe4, 0x0f, 0x8f,
+    0x93, 0xae, 0x45, 0x6a, 0x17, 0x2a, 0x47, 0xe4, 0x6a, 0x88, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x36, 0x7a, 0x08, 0x00, 0xe5, 0x30, 0x9e, 0x53, 0x46, 0x08, 0xa4, 0x79, 0x6a, 0x8d, 0xa0, 0x22,
+    0x53, 0x02, 0x3d, 0x72, 0xc1, 0xac, 0xac, 0x95, 0x67, 0x2c, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0xe9, 0xa5, 0x35, 0x7a, 0xe1, 0x3e, 0x82, 0xad, 0xb6, 0xf0, 0x4f,
+    0x41, 0xf2, 0x58, 0xbc, 0x1c, 0xe1, 0xd9, 0xda, 0x37, 0xe0, 0x27, 0x44, 0x32, 0x2c, 0x1e, 0x31,
+    0x90, 0x88, 0x4e, 0xb2, 0x34, 0x89, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x37, 0x7a, 0x08, 0x00,
+    0x54, 0x63, 0xfd, 0x99, 0x0c, 0xa9, 0x6c, 0xc0, 0x1d, 0xf0, 0xaf, 0x62, 0x88, 0x4d, 0x11, 0x1b,
+    0x1a, 0x7e, 0xb2, 0x2b, 0xf1, 0xc4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x99, 0x0b, 0x09, 0x2a, 0xf7, 0xda, 0x2a, 0xb3, 0x57, 0x9d, 0xd1, 0x5a, 0xf1, 0xe2, 0xb9, 0x1c,
+    0x3e, 0x4b, 0xa2, 0x75, 0xa8, 0xf6, 0x95, 0xf6, 0xce, 0x7c, 0x0b, 0xc0, 0x75, 0x41, 0x15, 0xe4,
+    0xe7, 0x8a, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7a, 0x08, 0x00, 0xa2, 0xcc, 0x32, 0x9e,
+    0xc5, 0x6b, 0x27, 0xd8, 0x2c, 0x4e, 0x14, 0xb5, 0x39, 0xd5, 0x89, 0x7c, 0x4c, 0x4a, 0x2a, 0x9a,
+    0x66, 0x6c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x3d, 0xf8, 0xc1,
+    0xfb, 0xbb, 0x66, 0x0a, 0x77, 0xc4, 0x22, 0xf2, 0xa9, 0x8c, 0x03, 0xa4, 0x7f, 0x15, 0xe6, 0x04,
+    0xde, 0x88, 0x1a, 0xf6, 0x48, 0x63, 0xfb, 0x26, 0x59, 0xb7, 0xac, 0xb8, 0xbd, 0x8c, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x39, 0x7a, 0x08, 0x00, 0xdd, 0x8d, 0x04, 0xf6, 0xaa, 0xf7, 0xeb, 0x87,
+    0xa3, 0xa9, 0xce, 0xef, 0xe2, 0x93, 0x65, 0x7a, 0x42, 0x4c, 0xb6, 0x4a, 0x75, 0xf4, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x29, 0x09, 0xd1, 0x54, 0x30, 0x78, 0xf8,
+    0x4b, 0xfd, 0x0c, 0x45, 0x5d, 0xbe, 0xad, 0xec, 0x98, 0x2d, 0x5b, 0x1b, 0xf3, 0x09, 0x84, 0xee,
+    0x67, 0x56, 0x43, 0x95, 0x14, 0x31, 0x88, 0x5e, 0xec, 0x8d, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x3a, 0x7a, 0x08, 0x00, 0x6f, 0x50, 0xfb, 0xc1, 0x25, 0x5b, 0xe9, 0x8c, 0x26, 0xa3, 0xe4, 0x27,
+    0x39, 0xc0, 0x94, 0x73, 0x95, 0x9d, 0xce, 0x16, 0x22, 0x38, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0xfb, 0x54, 0xe4, 0x55, 0xeb, 0xcb, 0x9f, 0xcf, 0x89, 0xf5, 0x38,
+    0x41, 0xe3, 0x2e, 0xf7, 0xd7, 0x50, 0x46, 0x00, 0x8c, 0xdc, 0x18, 0x69, 0x44, 0x26, 0x39, 0x60,
+    0xf4, 0x0d, 0x66, 0x14, 0x4d, 0x91, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x7a, 0x08, 0x00,
+    0x23, 0x94, 0x66, 0x50, 0x18, 0x3f, 0xc9, 0x0e, 0x44, 0x42, 0x90, 0x03, 0xda, 0xf1, 0x2a, 0xd6,
+    0x8c, 0xa3, 0x45, 0x5b, 0x42, 0xf2, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xfd, 0x44, 0x85, 0x6b, 0x4e, 0x3a, 0xed, 0x41, 0x10, 0x02, 0x23, 0x92, 0xa1, 0xe2, 0xae,
+    0x88, 0xfd, 0xb5, 0x3e, 0x6f, 0x20, 0x4a, 0xaf, 0x2f, 0x79, 0x8c, 0xf1, 0x9a, 0x56, 0xde, 0xd2,
+    0xc2, 0x91, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x7a, 0x08, 0x00, 0x83, 0xfc, 0xa3, 0xb8,
+    0x06, 0xbc, 0xa8, 0x7d, 0xd1, 0x3a, 0xec, 0x30, 0x13, 0xa0, 0x62, 0xa5, 0xb3, 0xb9, 0xa1, 0x15,
+    0x93, 0xad, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x01, 0x4b, 0xc7,
+    0x23, 0x6d, 0xa3, 0x5b, 0xa6, 0xc5, 0x8d, 0xeb, 0x54, 0x9b, 0x63, 0x4f, 0xa2, 0xef, 0x18, 0x0f,
+    0x1e, 0x26, 0xb0, 0x9c, 0x6d, 0xdc, 0x50, 0x29, 0x52, 0x66, 0x4f, 0x22, 0x52, 0x93, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x3d, 0x7a, 0x08, 0x00, 0xc7, 0xc8, 0x43, 0x7f, 0xda, 0x5d, 0x5d, 0x16,
+    0xa2, 0xac, 0xd4, 0xbb, 0x95, 0xce, 0x89, 0x93, 0x7d, 0xbe, 0x9e, 0x92, 0xc2, 0x93, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xc8, 0xde, 0xc2, 0xee, 0x9e, 0xdc, 0x51,
+    0xc1, 0x29, 0xf7, 0x39, 0x8e, 0x94, 0x67, 0x76, 0x96, 0x85, 0xcb, 0x84, 0x7f, 0xef, 0x60, 0xa2,
+    0xfb, 0x90, 0x0a, 0xb1, 0xe6, 0xff, 0xa8, 0x23, 0xb8, 0x94, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x3e, 0x7a, 0x08, 0x00, 0x26, 0xc7, 0x39, 0xf6, 0xa7, 0x85, 0xbf, 0x69, 0xb2, 0xdb, 0xd9, 0x86,
+    0xc2, 0xc4, 0x2a, 0x94, 0xa2, 0x08, 0x69, 0xb6, 0xc5, 0x57, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x42, 0xfc, 0xb2, 0xa2, 0x26, 0x27, 0x83, 0xf3, 0xc0, 0x89, 0xd8, 0xbc,
+    0xbc, 0x01, 0xf0, 0x98, 0x4e, 0xd0, 0x4f, 0x6e, 0xef, 0x45, 0x8c, 0xf6, 0xeb, 0xea, 0x42, 0xf9,
+    0x96, 0xfd, 0x7c, 0xab, 0x05, 0x95, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x7a, 0x08, 0x00,
+    0xf5, 0x00, 0x7a, 0xa5, 0xad, 0x26, 0xa5, 0x5c, 0x5a, 0x26, 0xb8, 0x05, 0x2f, 0xbe, 0xdb, 0xa6,
+    0xe6, 0x4e, 0x9f, 0xf0, 0xa9, 0x9a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x73, 0x7c, 0x77, 0x03, 0x01, 0x80, 0x02, 0x2f, 0x63, 0xad, 0x1e, 0x81, 0x1c, 0xb5, 0xa3, 0xcb,
+    0x54, 0xe0, 0x96, 0x55, 0x55, 0x74, 0x0a, 0xb1, 0xdb, 0x11, 0xcb, 0xa8, 0x49, 0x3b, 0x77, 0x86,
+    0x7c, 0x95, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x7a, 0x08, 0x00, 0x8b, 0xbe, 0xa6, 0x54,
+    0xad, 0x32, 0x7b, 0xdb, 0x6e, 0xb7, 0x0a, 0x26, 0x64, 0x5a, 0x84, 0xdf, 0x3c, 0xcf, 0xba, 0x24,
+    0xd5, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x20, 0x2a, 0x4f,
+    0x30, 0xae, 0x07, 0xb3, 0x22, 0x61, 0x59, 0x2d, 0x9c, 0x40, 0x4b, 0xd4, 0xc4, 0x46, 0x04, 0x87,
+    0xff, 0x75, 0x1d, 0x64, 0xf5, 0x3c, 0x65, 0x6e, 0x5d, 0x9a, 0x29, 0x39, 0xb4, 0x95, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x41, 0x7a, 0x08, 0x00, 0x23, 0x37, 0xb7, 0xf0, 0xbd, 0x14, 0x15, 0xf2,
+    0xde, 0x02, 0x30, 0x2e, 0xb5, 0xcc, 0x50, 0x0e, 0x6f, 0x8b, 0x5f, 0x2f, 0x66, 0x4d, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa8, 0x88, 0x40, 0x5e, 0x1e, 0x89, 0x95,
+    0x1b, 0x12, 0x80, 0xc7, 0xd4, 0x0c, 0xa2, 0x2a, 0x07, 0x23, 0x21, 0x44, 0xc7, 0x1e, 0x0e, 0xa3,
+    0x88, 0x10, 0x94, 0x07, 0x4c, 0x93, 0x51, 0xcd, 0x20, 0x96, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x42, 0x7a, 0x08, 0x00, 0xe8, 0xc2, 0xc5, 0xa2, 0x32, 0x6f, 0xcc, 0x03, 0x2e, 0xda, 0x1f, 0x9d,
+    0xc4, 0x82, 0xca, 0xfa, 0x01, 0xd8, 0xed, 0xfe, 0x05, 0x2c, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x23, 0x35, 0xf3, 0x6b, 0xbf, 0xcc, 0x52, 0xea, 0xb6, 0x1d, 0x6e, 0xcf,
+    0x17, 0xb0, 0x79, 0xc7, 0x82, 0x0a, 0x3d, 0x5f, 0x91, 0x27, 0x20, 0x03, 0xfb, 0xf4, 0x57, 0x97,
+    0x81, 0xa2, 0x7c, 0x49, 0x4f, 0x96, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x43, 0x7a, 0x08, 0x00,
+    0xf6, 0x19, 0x7b, 0x6d, 0x81, 0x3e, 0xbe, 0x94, 0x34, 0xdc, 0x90, 0x94, 0xe6, 0xea, 0x7f, 0x85,
+    0x16, 0xca, 0x9a, 0x01, 0xec, 0x60, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xaa, 0xde, 0x30, 0x75, 0xa7, 0x6b, 0x9f, 0x71, 0x5d, 0x24, 0x14, 0x18, 0x6e, 0x10, 0x54,
+    0x71, 0xfa, 0x6a, 0x08, 0x18, 0xf9, 0x30, 0xe0, 0x8c, 0x80, 0xd8, 0x2f, 0x63, 0x30, 0x45, 0x6a,
+    0x8b, 0x96, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7a, 0x08, 0x00, 0x90, 0xe3, 0x5f, 0xa6,
+    0x9c, 0xec, 0xb9, 0x25, 0x05, 0x49, 0xbc, 0x04, 0x80, 0x1e, 0x67, 0xb8, 0xd1, 0x40, 0xc2, 0xd2,
+    0x87, 0x39, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xcc, 0x35, 0x74,
+    0x1e, 0xa8, 0x52, 0x4c, 0x20, 0x93, 0x25, 0x41, 0x08, 0x1e, 0x62, 0x43, 0x9e, 0x49, 0xc7, 0xa6,
+    0xca, 0xc6, 0xf7, 0x54, 0x7a, 0xad, 0x25, 0xf1, 0x68, 0x8e, 0xd1, 0x4c, 0xe7, 0x9d, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x45, 0x7a, 0x08, 0x00, 0xcc, 0x31, 0x24, 0xe1, 0x04, 0x5c, 0xd7, 0xc9,
+    0x2d, 0xfa, 0x1f, 0xca, 0x7d, 0x4e, 0x36, 0x47, 0x1b, 0xb7, 0x1f, 0x77, 0xef, 0x78, 0x1a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xe3, 0x51, 0x40, 0x69, 0x7a, 0xa0, 0x4f,
+    0x4d, 0xd6, 0x29, 0x4d, 0x8e, 0x82, 0xfc, 0x68, 0xb5, 0x3e, 0xe7, 0x87, 0xed, 0x6a, 0x65, 0xb8,
+    0x35, 0xb5, 0xc1, 0xed, 0xaf, 0x1d, 0x34, 0xc1, 0x70, 0x9f, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x46, 0x7a, 0x08, 0x00, 0x47, 0x15, 0x1d, 0x0a, 0xb1, 0xa4, 0xb8, 0x43, 0xba, 0xe5, 0xf7, 0x39,
+    0x6a, 0x03, 0xb6, 0x8f, 0x40, 0xed, 0xad, 0x2c, 0x12, 0xf8, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0xcc, 0xe0, 0x6a, 0x50, 0x6c, 0xae, 0x18, 0x1e, 0x8b, 0xc1, 0x79,
+    0x78, 0xfa, 0xff, 0xa8, 0x5f, 0x35, 0x7b, 0x80, 0x1d, 0x00, 0x75, 0x6b, 0x53, 0xd0, 0x42, 0x7d,
+    0x3f, 0xcd, 0xb3, 0x12, 0x6f, 0xa0, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x47, 0x7a, 0x08, 0x00,
+    0xd4, 0xe7, 0x4b, 0x6a, 0xd7, 0xb8, 0x34, 0x1f, 0x5d, 0x4f, 0xa2, 0x2d, 0xb2, 0xfb, 0x42, 0x01,
+    0x0a, 0x48, 0x0b, 0x44, 0x07, 0x9e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc7, 0xec, 0x35, 0x0a, 0xaf, 0x04, 0xc3, 0xfc, 0x02, 0x11, 0x58, 0x2c, 0x28, 0x69, 0x2b, 0xfb,
+    0x6d, 0x18, 0x41, 0x87, 0xf3, 0x61, 0x47, 0x10, 0x60, 0x46, 0x4b, 0xd4, 0x17, 0xcc, 0xf2, 0xeb,
+    0x73, 0xa1, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x48, 0x7a, 0x08, 0x00, 0x59, 0x63, 0x92, 0x6f,
+    0xa0, 0xab, 0xde, 0x6a, 0x9e, 0x40, 0xa8, 0xda, 0x95, 0xa7, 0x9a, 0x19, 0x16, 0x9d, 0xfd, 0xc0,
+    0x51, 0xa0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0x81, 0xe8,
+    0x50, 0x86, 0xdb, 0x61, 0x26, 0xa9, 0x6d, 0x18, 0xa9, 0xdc, 0xfd, 0x8c, 0xf7, 0xe9, 0x7f, 0x4b,
+    0xca, 0x2f, 0x97, 0x0b, 0x16, 0xab, 0xe7, 0x3a, 0x12, 0x2f, 0x15, 0x62, 0xaa, 0xa3, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x7a, 0x08, 0x00, 0xb3, 0xf3, 0xee, 0xb0, 0xfa, 0xb5, 0x0a, 0xe1,
+    0x93, 0xfe, 0x23, 0xe3, 0xdf, 0x9d, 0x76, 0xf2, 0xef, 0x9a, 0x4f, 0x46, 0xfa, 0x5f, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x47, 0xa3, 0xff, 0xd3, 0x0b, 0x94, 0xc1,
+    0x64, 0x1d, 0x2b, 0xad, 0xc7, 0xfd, 0xa5, 0xad, 0xa6, 0xbd, 0x60, 0x84, 0x5d, 0xec, 0x5d, 0xc8,
+    0xf1, 0x79, 0xcc, 0x06, 0x47, 0x8a, 0x2d, 0xf6, 0x2d, 0xaa, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x4a, 0x7a, 0x08, 0x00, 0xac, 0x35, 0x9f, 0xde, 0xe9, 0x12, 0xdb, 0xe6, 0x80, 0x35, 0x94, 0xaf,
+    0x0e, 0x0c, 0x40, 0x65, 0x39, 0xd1, 0xd2, 0xe3, 0xd7, 0xdf, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x81, 0x33, 0xce, 0x79, 0xcb, 0x24, 0xbb, 0xdd, 0x9e, 0x56, 0x22, 0x56,
+    0x12, 0xf6, 0x19, 0xc4, 0xba, 0x93, 0xe5, 0xe0, 0x1f, 0x57, 0x47, 0x11, 0x86, 0x32, 0xf6, 0xbe,
+    0x11, 0xa7, 0x88, 0xbd, 0x1b, 0xad, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x7a, 0x08, 0x00,
+    0xcd, 0xe5, 0xfb, 0xe0, 0x3f, 0x0c, 0xf6, 0x14, 0xb2, 0xb1, 0xcc, 0x4b, 0xf5, 0xe1, 0xec, 0x15,
+    0x63, 0x81, 0xbb, 0xd6, 0xac, 0xcb, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x68, 0xdb, 0xe2, 0x09, 0xa6, 0x43, 0xf5, 0x2c, 0x9b, 0xc1, 0x36, 0xf9, 0xe4, 0x7f, 0x4a, 0x07,
+    0xa1, 0x09, 0x5f, 0x06, 0xe4, 0xf2, 0x0e, 0xd1, 0xcf, 0x67, 0xae, 0x5b, 0xbc, 0x24, 0x37, 0x74,
+    0x91, 0xad, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x7a, 0x08, 0x00, 0x9e, 0x89, 0xcf, 0x34,
+    0x1c, 0x0f, 0x0d, 0x81, 0x74, 0xe1, 0x2f, 0xea, 0x22, 0xd9, 0xc3, 0x8b, 0x1d, 0x16, 0x70, 0x64,
+    0xd0, 0xee, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xb6, 0x45, 0x66,
+    0xd1, 0xe9, 0xf2, 0x7e, 0x88, 0xd0, 0x14, 0x11, 0x57, 0xa7, 0x33, 0x7a, 0xfc, 0xf4, 0x6b, 0x2c,
+    0x49, 0x44, 0x69, 0x92, 0xdf, 0x68, 0x0b, 0x27, 0xdc, 0x24, 0x75, 0xb7, 0xb8, 0xad, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x4d, 0x7a, 0x08, 0x00, 0xa1, 0xd6, 0xd2, 0x82, 0x36, 0xf2, 0x23, 0x36,
+    0xe1, 0xf9, 0xcf, 0xca, 0xb2, 0x43, 0xaf, 0xf6, 0xcd, 0xbd, 0xb3, 0x38, 0xcb, 0x9c, 0x34, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x2b, 0xe0, 0x98, 0x7b, 0xa3, 0xe1, 0xce,
+    0xd2, 0xb9, 0xd8, 0x92, 0xa2, 0x33, 0xf8, 0xbf, 0xc6, 0xf1, 0xdf, 0x07, 0x13, 0x93, 0x30, 0x9c,
+    0x96, 0x72, 0x01, 0x71, 0x29, 0x5b, 0xbd, 0x41, 0x71, 0xae, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x4e, 0x7a, 0x08, 0x00, 0x7f, 0x73, 0x80, 0xfd, 0xb6, 0xd3, 0xa0, 0x72, 0xac, 0x85, 0x6d, 0x2c,
+    0xac, 0xec, 0x54, 0xc6, 0x01, 0x26, 0xea, 0x59, 0xe1, 0x07, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xae, 0x10, 0xff, 0xff, 0xae, 0x09, 0x6c, 0x11, 0x64, 0x45, 0x82, 0x34,
+    0x68, 0x2d, 0x9a, 0x3c, 0xe3, 0x5e, 0x37, 0x9d, 0x49, 0xf6, 0x3f, 0x7d, 0x13, 0x97, 0x71, 0xd2,
+    0x2a, 0x3f, 0x32, 0x7e, 0x36, 0xaf, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x7a, 0x08, 0x00,
+    0x57, 0xd5, 0xfe, 0x52, 0x2b, 0xf3, 0x88, 0x33, 0x93, 0xa9, 0x4c, 0x4d, 0x0e, 0x07, 0x57, 0x84,
+    0xd2, 0xae, 0xc8, 0x91, 0x6a, 0x53, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfb, 0x8a, 0xe2, 0x24, 0x08, 0x94, 0xce, 0x79, 0xa3, 0x04, 0xf1, 0x11, 0x7a, 0x6e, 0x8d, 0xb2,
+    0x34, 0x59, 0xce, 0xf6, 0x14, 0xdd, 0x97, 0x21, 0xa1, 0x4c, 0xc5, 0x8f, 0x59, 0x08, 0x11, 0x72,
+    0x30, 0xb3, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x50, 0x7a, 0x08, 0x00, 0xd8, 0x3f, 0x52, 0x71,
+    0xda, 0x31, 0xd2, 0xd4, 0xf0, 0x9e, 0xa1, 0xa9, 0x3e, 0x11, 0xe6, 0xee, 0x6f, 0x48, 0xec, 0x91,
+    0x23, 0xef, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x09, 0xb0, 0x1f,
+    0x70, 0x62, 0x73, 0xec, 0xe2, 0x9c, 0x7d, 0x34, 0x44, 0xb7, 0x32, 0xe7, 0xb4, 0x3e, 0x95, 0xfd,
+    0x1a, 0xa9, 0x9f, 0xc9, 0x86, 0x43, 0x0a, 0xa7, 0x1e, 0x21, 0xef, 0x48, 0x76, 0xb4, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x51, 0x7a, 0x08, 0x00, 0xe9, 0xd7, 0x9d, 0xbf, 0xd5, 0xac, 0x26, 0x6d,
+    0x04, 0x6a, 0x85, 0xfe, 0xaa, 0xcb, 0x9d, 0x75, 0x0e, 0x23, 0x17, 0x54, 0x60, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x35, 0x9b, 0xba, 0xe9, 0xd6, 0x58, 0x39,
+    0x9f, 0xea, 0xcd, 0x7b, 0x0c, 0x77, 0xb8, 0xf2, 0x45, 0xe3, 0x48, 0xa7, 0x36, 0xaa, 0x6e, 0x68,
+    0x33, 0x07, 0xd0, 0xec, 0xa3, 0xc1, 0x32, 0x43, 0xe4, 0xb4, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x52, 0x7a, 0x08, 0x00, 0xc3, 0x72, 0xe0, 0x0d, 0xb0, 0x9d, 0x20, 0xab, 0xfd, 0x2b, 0x9d, 0xb6,
+    0x43, 0xe0, 0x5e, 0x08, 0xa6, 0xc3, 0xc2, 0x2d, 0xa3, 0xfd, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xda, 0xa2, 0x02, 0x44, 0x00, 0x43, 0xa7, 0xaf, 0xc5, 0xb4, 0x5d, 0x89,
+    0xb6, 0xa0, 0x48, 0xae, 0xda, 0x1d, 0x4d, 0x72, 0x4d, 0x56, 0xe4, 0xd7, 0xf7, 0x3e, 0x67, 0xbd,
+    0xc8, 0xe2, 0x69, 0x21, 0x24, 0xb8, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x53, 0x7a, 0x08, 0x00,
+    0x63, 0xc3, 0xfc, 0x3c, 0x0e, 0x26, 0x59, 0xfe, 0x46, 0x37, 0x41, 0xa0, 0x75, 0xb9, 0x9b, 0x14,
+    0xd6, 0x9c, 0x49, 0x94, 0x7f, 0xfe, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x38, 0x98, 0xf1, 0x42, 0x39, 0x8a, 0xec, 0x8f, 0xc6, 0xff, 0x33, 0x73, 0x94, 0xed, 0x0e,
+    0x63, 0xfb, 0xfe, 0x2e, 0xf1, 0xe5, 0x25, 0x06, 0x21, 0xad, 0x59, 0x52, 0xa7, 0x20, 0xa8, 0x5d,
+    0x2d, 0xb8, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x54, 0x7a, 0x08, 0x00, 0xe2, 0x8f, 0x9b, 0xc9,
+    0x10, 0x6e, 0x7a, 0x6d, 0xff, 0xc7, 0x79, 0xc2, 0x90, 0xd5, 0xb8, 0xce, 0x2a, 0x1e, 0xd9, 0x1a,
+    0xfc, 0x6c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x6c, 0x24, 0x4e,
+    0xae, 0xf9, 0x53, 0x17, 0x5a, 0x04, 0xbe, 0x92, 0xa4, 0xbc, 0x36, 0x3a, 0x38, 0x5b, 0x7f, 0x8f,
+    0xeb, 0xe2, 0xac, 0x2d, 0x4a, 0xf2, 0xdc, 0xe7, 0x50, 0x1b, 0xa8, 0x82, 0x76, 0xbc, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x7a, 0x08, 0x00, 0xa6, 0x57, 0xde, 0xc3, 0x1a, 0xed, 0x9f, 0x75,
+    0x30, 0x24, 0x3a, 0x2b, 0xff, 0x0b, 0xd3, 0x9c, 0xd6, 0xa1, 0x36, 0xcf, 0x46, 0x3d, 0x25, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x21, 0xd9, 0x9b, 0x50, 0xc1, 0x9a, 0x9c,
+    0x9a, 0x86, 0x1c, 0x02, 0xc2, 0x4a, 0x2a, 0xc2, 0x08, 0x8a, 0x75, 0x0e, 0x9c, 0xaf, 0x90, 0xc6,
+    0x5c, 0xa1, 0x9d, 0xea, 0xe9, 0x39, 0x16, 0x8d, 0x2a, 0xbf, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x56, 0x7a, 0x08, 0x00, 0x85, 0x3f, 0x0a, 0xd4, 0x6e, 0xcc, 0xfc, 0xbf, 0x15, 0xdb, 0x75, 0x42,
+    0xc4, 0x69, 0xfc, 0x91, 0xdd, 0x96, 0xf7, 0x6e, 0xbe, 0xeb, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xae, 0x90, 0xac, 0xbb, 0xf7, 0xef, 0x74, 0x4f, 0xa8, 0x13, 0x6a, 0x74,
+    0x34, 0x02, 0xd5, 0x6a, 0xe1, 0x72, 0x5f, 0x22, 0x81, 0xdb, 0xcd, 0x10, 0x51, 0x66, 0x1b, 0x59,
+    0x7d, 0x41, 0xe1, 0xd5, 0x75, 0xbf, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x57, 0x7a, 0x08, 0x00,
+    0xdf, 0x71, 0x67, 0x75, 0x0c, 0x1d, 0x56, 0x7a, 0xf0, 0x0c, 0xfc, 0x32, 0x04, 0xec, 0x0f, 0x2d,
+    0xad, 0xcc, 0x70, 0x6b, 0x44, 0x9e, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xed, 0x78, 0x86, 0x80, 0x7e, 0xc9, 0xf4, 0xde, 0xd2, 0x9c, 0x03, 0xc5, 0x04, 0xf8, 0x80, 0x7e,
+    0x86, 0x99, 0x5a, 0x83, 0x0f, 0x69, 0x82, 0xc9, 0x47, 0xe1, 0x7a, 0x9e, 0x5f, 0x56, 0x4f, 0x0b,
+    0xa1, 0xbf, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x58, 0x7a, 0x08, 0x00, 0xe5, 0xfe, 0x58, 0xc6,
+    0x1e, 0x8c, 0x9e, 0x5b, 0x93, 0x61, 0xf4, 0xf7, 0x8d, 0x66, 0x69, 0x24, 0x04, 0x2c, 0xfc, 0xda,
+    0xd9, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xc1, 0xba, 0xc0,
+    0xbc, 0x10, 0x16, 0xc0, 0xb0, 0x6a, 0xe2, 0xc3, 0xa9, 0x75, 0x45, 0xf3, 0x70, 0x5b, 0x14, 0x92,
+    0xf4, 0x87, 0x12, 0x51, 0xfc, 0xb0, 0xe7, 0xa9, 0xac, 0x4f, 0x5c, 0x8f, 0xc4, 0xc2, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x59, 0x7a, 0x08, 0x00, 0x69, 0xdf, 0x0b, 0xbb, 0xd7, 0x79, 0xd9, 0xa2,
+    0x64, 0xdd, 0xcd, 0x0a, 0x34, 0x3d, 0xb8, 0x0d, 0xbb, 0xf8, 0x44, 0xa0, 0x4b, 0x7a, 0x25, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xe1, 0x35, 0x9c, 0xe4, 0x9a, 0xe2, 0xf2,
+    0x40, 0x7a, 0x2a, 0x14, 0x18, 0x93, 0x60, 0xbf, 0xd9, 0xd7, 0x6a, 0x77, 0x87, 0x25, 0x0b, 0xf6,
+    0x48, 0xc5, 0xd7, 0xf4, 0xef, 0x3b, 0xd4, 0x27, 0x4f, 0xc4, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x5a, 0x7a, 0x08, 0x00, 0xc2, 0x7a, 0xdb, 0x3d, 0x4c, 0xc3, 0x91, 0x94, 0xa2, 0xfb, 0xa2, 0xb1,
+    0x84, 0xf4, 0x5d, 0xde, 0x84, 0x7d, 0xca, 0x06, 0x4c, 0xbf, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x37, 0x09, 0xa8, 0x64, 0x0a, 0xa8, 0xff, 0xac, 0xba, 0xb2, 0x65, 0x4b,
+    0x23, 0x91, 0xd6, 0x6d, 0x4c, 0xa1, 0x84, 0x6e, 0xf8, 0x1b, 0x61, 0x13, 0x94, 0x4b, 0x5d, 0xbe,
+    0x2b, 0xa7, 0xc5, 0x8d, 0x92, 0xc5, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x7a, 0x08, 0x00,
+    0xe8, 0xd9, 0x91, 0x26, 0x75, 0xcb, 0xf9, 0xc2, 0x0f, 0xdd, 0x38, 0x7f, 0xc2, 0x5b, 0xa8, 0x1d,
+    0x00, 0x64, 0xac, 0x8d, 0xed, 0xe8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x87, 0xf5, 0xb8, 0xd2, 0xad, 0xc1, 0x1f, 0x6a, 0xe0, 0x6e, 0xad, 0x6c, 0x6b, 0x66, 0xc9,
+    0x18, 0x4c, 0xde, 0x73, 0x24, 0xb6, 0x65, 0x1b, 0x88, 0xf6, 0xec, 0x84, 0x54, 0x28, 0x8b, 0xfd,
+    0x04, 0xc6, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x7a, 0x08, 0x00, 0x8b, 0xbc, 0xc8, 0xec,
+    0x55, 0xc6, 0x52, 0xbb, 0xfd, 0x40, 0x65, 0xa2, 0xf1, 0x5f, 0xa6, 0xcf, 0x9d, 0xdf, 0xb6, 0xed,
+    0xd0, 0x1a, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x9b, 0x83, 0x56,
+    0xd5, 0xe0, 0x90, 0x15, 0x47, 0x49, 0x27, 0xf3, 0x5b, 0x18, 0x30, 0x54, 0xe9, 0x04, 0xce, 0xd8,
+    0x45, 0xe4, 0x94, 0xd7, 0xfe, 0x6e, 0xf8, 0xee, 0xc0, 0x02, 0x2f, 0xdf, 0x5e, 0xc7, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x7a, 0x08, 0x00, 0x27, 0xbf, 0xab, 0x59, 0x97, 0x81, 0xab, 0x2d,
+    0x7d, 0x44, 0x77, 0x61, 0xd9, 0x36, 0x59, 0xe2, 0xd6, 0xef, 0x9a, 0x15, 0x4b, 0xdc, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x38, 0x40, 0x1b, 0xfc, 0x57, 0x96,
+    0x1a, 0x7b, 0xd6, 0x93, 0x75, 0x1b, 0xf2, 0xdd, 0xea, 0xbc, 0x39, 0x7a, 0x97, 0x35, 0xf2, 0xf7,
+    0x2b, 0xb1, 0x2a, 0xdc, 0x49, 0xa0, 0xfb, 0x76, 0x1f, 0xc8, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x5e, 0x7a, 0x08, 0x00, 0x80, 0x10, 0x3b, 0xe6, 0x47, 0x8b, 0x08, 0x3a, 0x7d, 0x18, 0xea, 0xef,
+    0xcb, 0xbb, 0xc0, 0x3d, 0xe1, 0x35, 0xee, 0xe5, 0x57, 0x4a, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x25, 0x26, 0x83, 0x02, 0x88, 0xed, 0xe6, 0x90, 0x77, 0xf0, 0x0b, 0x9d,
+    0x42, 0x47, 0x61, 0xc9, 0xb0, 0xac, 0x50, 0xca, 0x40, 0x47, 0x9c, 0x55, 0x87, 0xe2, 0x8d, 0x22,
+    0xca, 0xc5, 0xa7, 0x40, 0x48, 0xc9, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x7a, 0x08, 0x00,
+    0x2f, 0x5c, 0xf2, 0x91, 0xbc, 0x0a, 0x7e, 0x4d, 0xab, 0xe8, 0x7f, 0x61, 0x80, 0x83, 0xdd, 0xf1,
+    0xcc, 0x1b, 0x19, 0x99, 0x0d, 0x52, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xed, 0xda, 0x63, 0x04, 0x3c, 0x57, 0x2d, 0x07, 0x6f, 0xef, 0x73, 0x67, 0x72, 0x90, 0xb7, 0xae,
+    0x53, 0x65, 0x12, 0x32, 0x7a, 0xe0, 0x6d, 0xd7, 0x3a, 0x94, 0x21, 0x2b, 0x4b, 0x9b, 0xd6, 0x53,
+    0xab, 0xd3, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x60, 0x7a, 0x08, 0x00, 0x08, 0xa8, 0x3b, 0x83,
+    0xf4, 0xb2, 0x13, 0x68, 0x57, 0xa8, 0xbc, 0xce, 0x10, 0x65, 0x3f, 0x25, 0xc4, 0x60, 0x87, 0x83,
+    0xd4, 0x32, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x7c, 0x6a, 0xa0,
+    0x09, 0x04, 0xa8, 0xbd, 0xe9, 0x26, 0x3b, 0x89, 0x7e, 0xe1, 0x6e, 0xc8, 0x98, 0x62, 0x17, 0x49,
+    0xe8, 0xc2, 0x45, 0x80, 0xd3, 0xb6, 0x0d, 0x7e, 0x84, 0x09, 0xea, 0xf9, 0x70, 0xd5, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x61, 0x7a, 0x08, 0x00, 0xad, 0x85, 0x0a, 0x1b, 0xaf, 0x89, 0x05, 0xd9,
+    0x94, 0x45, 0x51, 0x8f, 0xb3, 0xb1, 0x7b, 0x85, 0x51, 0x59, 0x72, 0x3a, 0x39, 0x7d, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xda, 0x6f, 0x45, 0xd5, 0xa1, 0x87, 0x60,
+    0xb8, 0xd5, 0xd4, 0x11, 0x98, 0xe2, 0x39, 0xe2, 0x9b, 0x88, 0x35, 0x02, 0x0d, 0xe7, 0xd1, 0x75,
+    0xef, 0x22, 0x7d, 0x59, 0x77, 0xb6, 0x36, 0x2f, 0xb8, 0xd5, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x62, 0x7a, 0x08, 0x00, 0x07, 0xb5, 0xfb, 0x7f, 0x93, 0xeb, 0x49, 0xe8, 0xef, 0x75, 0xc5, 0x99,
+    0x8e, 0xf5, 0x7c, 0x91, 0xa3, 0xbc, 0x9c, 0x92, 0x52, 0x4d, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa9, 0xdc, 0xb5, 0xe3, 0x76, 0x9f, 0x9a, 0x76, 0xb9, 0xb7, 0x53, 0xb1,
+    0x30, 0xa2, 0x70, 0x16, 0x6b, 0xb1, 0x10, 0x35, 0xc7, 0x86, 0xbe, 0xc9, 0xd0, 0x8c, 0x5f, 0xec,
+    0xd7, 0xa4, 0x7d, 0x14, 0x91, 0xd6, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x63, 0x7a, 0x08, 0x00,
+    0x3c, 0xc7, 0xc1, 0x04, 0x35, 0xd3, 0x24, 0xf6, 0xe2, 0xed, 0xd6, 0x50, 0x72, 0x91, 0x71, 0x0e,
+    0xa8, 0x87, 0x32, 0x73, 0x2a, 0x99, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe4, 0x31, 0x63, 0x05, 0xdf, 0xa4, 0xd6, 0x4f, 0x79, 0x4e, 0x0a, 0xb4, 0xd8, 0xab, 0x47, 0x00,
+    0x11, 0x87, 0xaa, 0x06, 0xb4, 0x71, 0x20, 0x72, 0x16, 0xca, 0x3d, 0x29, 0x29, 0xf7, 0xdf, 0x62,
+    0x05, 0xd7, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x64, 0x7a, 0x08, 0x00, 0xa5, 0xee, 0x77, 0x6b,
+    0x76, 0x81, 0x44, 0xd4, 0xcf, 0x41, 0x35, 0xb1, 0xab, 0x5e, 0xef, 0xfc, 0x63, 0xca, 0x28, 0x43,
+    0x23, 0x04, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xc6, 0x0b,
+    0xc5, 0xde, 0x98, 0xbc, 0xc0, 0x5e, 0x19, 0xc3, 0xf6, 0x88, 0x2b, 0x69, 0x4e, 0xb7, 0x90, 0xa6,
+    0xb3, 0x44, 0x0b, 0x27, 0x2b, 0xa7, 0xf1, 0x65, 0xc7, 0x18, 0xa9, 0x51, 0xd6, 0xd7, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x7a, 0x08, 0x00, 0xb4, 0x51, 0x01, 0x62, 0xc1, 0x22, 0x7d, 0xa9,
+    0xaf, 0xe3, 0xc4, 0xe5, 0x50, 0x69, 0x3f, 0xb3, 0x31, 0xda, 0xa6, 0x7b, 0xbc, 0xf0, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x50, 0xf6, 0xf2, 0x3a, 0x5f, 0x29, 0xd6,
+    0xec, 0x84, 0x26, 0x8a, 0xb6, 0xda, 0xe1, 0x46, 0x6a, 0xa8, 0xad, 0x3c, 0x25, 0x0f, 0xfb, 0xda,
+    0xf5, 0xae, 0xd6, 0x5f, 0xab, 0x46, 0x83, 0xc5, 0x81, 0xda, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x7a, 0x08, 0x00, 0x41, 0x20, 0x6f, 0xc4, 0x1d, 0x94, 0xa8, 0xbf, 0x20, 0x78, 0x9c, 0xee,
+    0x4c, 0xad, 0x81, 0x4b, 0x8e, 0x88, 0x14, 0x4a, 0x24, 0x3f, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xcd, 0xbf, 0xca, 0xe5, 0x71, 0x96, 0x28, 0x10, 0x22, 0x9e, 0xeb, 0xa0,
+    0xb3, 0xa9, 0xe2, 0x01, 0xa8, 0xc5, 0x44, 0x56, 0x5b, 0x8c, 0xb4, 0x8b, 0xf3, 0x86, 0x52, 0x29,
+    0x99, 0x04, 0xbc, 0xac, 0x86, 0xda, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x67, 0x7a, 0x08, 0x00,
+    0x42, 0x93, 0x2f, 0x3f, 0x17, 0x2a, 0xeb, 0x23, 0x67, 0xa5, 0x1b, 0xb3, 0x4f, 0xa5, 0xa1, 0xa9,
+    0xae, 0x68, 0xc8, 0x29, 0x76, 0xa5, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9f, 0x53, 0xc9, 0x96, 0xc0, 0x07, 0x2f, 0x90, 0xd2, 0x7e, 0xc2, 0x55, 0x05, 0xf1, 0x8b, 0x76,
+    0xad, 0xe8, 0xdd, 0x58, 0xf7, 0xd2, 0x3c, 0x09, 0x82, 0x56, 0xab, 0xe2, 0x87, 0x6a, 0x76, 0x03,
+    0x0f, 0xdc, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x68, 0x7a, 0x08, 0x00, 0x10, 0xc7, 0x05, 0x14,
+    0x6a, 0x6b, 0x06, 0x8c, 0x57, 0x78, 0x5c, 0x6c, 0x12, 0x25, 0xe9, 0x4c, 0x3f, 0x10, 0x96, 0x99,
+    0xde, 0x5f, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xab, 0x69, 0x63,
+    0xd0, 0x2a, 0x4d, 0xe5, 0xd1, 0x23, 0x8c, 0x04, 0x06, 0xb4, 0xf3, 0xaf, 0x28, 0xcd, 0xe2, 0x56,
+    0x4a, 0x83, 0x2c, 0x00, 0x34, 0xd5, 0xb2, 0x32, 0xdf, 0x0a, 0x45, 0x14, 0xf8, 0xe1, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x69, 0x7a, 0x08, 0x00, 0x4f, 0x51, 0xb3, 0x33, 0xc6, 0x9b, 0xce, 0x2f,
+    0x2e, 0x65, 0x19, 0xae, 0x7a, 0x03, 0x0e, 0xbd, 0xa3, 0xa3, 0xb5, 0x43, 0xf5, 0xbd, 0x1a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf6, 0x76, 0xc7, 0x95, 0xd4, 0x4a, 0x43,
+    0xb6, 0x9e, 0x93, 0x78, 0xf7, 0xf9, 0xc2, 0x15, 0x53, 0x9c, 0xd6, 0x0a, 0xba, 0x98, 0x97, 0x26,
+    0xc5, 0x49, 0x9a, 0xa3, 0x27, 0xca, 0xf4, 0xdf, 0x0c, 0xe4, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x6a, 0x7a, 0x08, 0x00, 0x5a, 0x3f, 0x24, 0x81, 0xdf, 0x80, 0xd7, 0x9e, 0x38, 0x03, 0x29, 0xde,
+    0x39, 0x6c, 0xcf, 0x81, 0xb3, 0x5f, 0xc2, 0xcc, 0xfc, 0xa8, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xee, 0x74, 0x4e, 0x97, 0xe3, 0xae, 0x70, 0xae, 0x5d, 0x4b,
+    0x63, 0xc0, 0x45, 0xb7, 0x74, 0xcc, 0xb3, 0x96, 0x46, 0x5a, 0x82, 0x0a, 0xc8, 0x25, 0xe1, 0x2b,
+    0xf2, 0xe7, 0xd0, 0x3b, 0xab, 0xe5, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x7a, 0x08, 0x00,
+    0x89, 0x48, 0xc2, 0x74, 0xdc, 0x12, 0x87, 0x0b, 0x7a, 0xf6, 0xdb, 0x97, 0x52, 0x90, 0xaa, 0x59,
+    0x21, 0xb3, 0xa4, 0xc3, 0x78, 0x73, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4f, 0x72, 0x56, 0x01, 0x80, 0xf8, 0xba, 0x25, 0x44, 0xcb, 0xff, 0x4c, 0x8b, 0x28, 0xae, 0x91,
+    0x2b, 0xbb, 0x5c, 0x96, 0x7d, 0xfe, 0x21, 0xe2, 0x4d, 0x40, 0x86, 0x5b, 0xaa, 0x0d, 0xff, 0x16,
+    0x3b, 0xe6, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x7a, 0x08, 0x00, 0xdf, 0x57, 0xc1, 0x9a,
+    0x10, 0x18, 0xdd, 0xbc, 0xdb, 0x0d, 0x21, 0xd0, 0xc2, 0x04, 0xa3, 0xee, 0x8f, 0xfd, 0x1b, 0xcc,
+    0x38, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x5c, 0x3a, 0x5b,
+    0xdf, 0xb5, 0x91, 0x0f, 0xb9, 0x79, 0x4f, 0x0d, 0x55, 0x73, 0x8f, 0x3b, 0xe2, 0xd5, 0x6e, 0x19,
+    0x8a, 0x13, 0x67, 0xed, 0xe7, 0x0a, 0xcc, 0x03, 0x4e, 0xf6, 0xce, 0xac, 0x0d, 0xe8, 0x23, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x6d, 0x7a, 0x08, 0x00, 0xf2, 0xec, 0xfb, 0x08, 0x0b, 0x9a, 0x47, 0x92,
+    0x17, 0x81, 0x4f, 0xaa, 0xe1, 0xbf, 0x9a, 0xbb, 0x34, 0x44, 0x9f, 0xe0, 0x18, 0x6d, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x90, 0x91, 0xc0, 0x08, 0x2b, 0xa8, 0x1b,
+    0x93, 0xe9, 0xa0, 0x3c, 0x38, 0xcd, 0xc4, 0x12, 0x8c, 0x56, 0xa4, 0x57, 0x98, 0x2f, 0xbf, 0xf9,
+    0x26, 0xb5, 0x3a, 0xaa, 0xea, 0xc2, 0xd0, 0x1a, 0xa6, 0xea, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00,
+    0x6e, 0x7a, 0x08, 0x00, 0x12, 0x3c, 0xf4, 0xb7, 0xc8, 0x7e, 0xb9, 0xa8, 0xd3, 0x7b, 0x3e, 0x54,
+    0xbc, 0x20, 0x25, 0x45, 0x1b, 0x28, 0xf5, 0xed, 0xaa, 0xaf, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x65, 0x7a, 0x82, 0xfe, 0x77, 0x2b, 0xa5, 0x62, 0x53, 0x08, 0x9e, 0x39,
+    0x2f, 0xad, 0x27, 0x9e, 0xac, 0x05, 0xaf, 0x08, 0x88, 0x49, 0xc2, 0xd8, 0x5d, 0xdc, 0xd0, 0x36,
+    0x90, 0x6c, 0xbc, 0xc7, 0x03, 0xeb, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x7a, 0x08, 0x00,
+    0x7b, 0x23, 0x95, 0xf3, 0xf2, 0xc6, 0xb2, 0xcd, 0x65, 0x89, 0xa6, 0xf6, 0x48, 0xcd, 0x70, 0xf6,
+    0xdd, 0xe5, 0x31, 0x52, 0xdb, 0x78, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb6, 0xdf, 0xb6, 0xcd, 0x30, 0xad, 0x1b, 0xf5, 0xa3, 0x80, 0x2f, 0x00, 0x05, 0xf2, 0xef, 0xb2,
+    0x18, 0xa8, 0x58, 0xaa, 0x7f, 0x45, 0x88, 0x2d, 0xad, 0x7d, 0xb3, 0x77, 0xa3, 0x28, 0x4f, 0x26,
+    0x3c, 0xee, 0x23, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x4e, 0x09, 0x00, 0xf7, 0xb7, 0x72, 0x76,
+    0xc1, 0x94, 0x63, 0x53, 0x54, 0x03, 0xc1, 0x22, 0x40, 0xa9, 0xe0, 0xda, 0x48, 0xdb, 0x74, 0x7f,
+    0x60, 0x6f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xa2, 0x2b, 0xc3,
+    0x32, 0x82, 0xd7, 0x2b, 0xf7, 0x83, 0x7d, 0x01, 0x4d, 0x10, 0x24, 0xe0, 0x02, 0xf9, 0x4b, 0x15,
+    0x7d, 0xfc, 0x42, 0x30, 0x82, 0x7f, 0xd7, 0x71, 0xbc, 0xbe, 0x9b, 0x2f, 0xcb, 0xf0, 0x05, 0x5e,
+    0x00, 0x00, 0x00, 0x00, 0xfd, 0x50, 0x09, 0x00, 0x4f, 0x08, 0xd4, 0x8b, 0x71, 0x2c, 0xfc, 0xbb,
+    0x9c, 0x30, 0xc4, 0xf4, 0x8d, 0xc6, 0x3c, 0x8e, 0x89, 0xce, 0x92, 0xd6, 0xc7, 0x92, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xd4, 0x61, 0xc7, 0x59, 0xbc, 0xab, 0x45,
+    0x86, 0xe6, 0x63, 0xae, 0xe7, 0x66, 0x67, 0xbd, 0x83, 0xee, 0xfb, 0x1c, 0x96, 0x84, 0xbe, 0x83,
+    0xf0, 0x02, 0x83, 0x46, 0x11, 0xf7, 0xcc, 0x23, 0xef, 0xb0, 0x0a, 0x5e, 0x00, 0x00, 0x00, 0x00,
+    0xfe, 0x50, 0x09, 0x00, 0xa5, 0x6e, 0x66, 0x5b, 0x74, 0x1d, 0x24, 0xf4, 0x7d, 0x27, 0xc2, 0x08,
+    0x2c, 0x14, 0x7f, 0x82, 0xb5, 0x11, 0xaa, 0x5c, 0xdd, 0xde, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xe5, 0x35, 0x44, 0x26, 0x31, 0x7f, 0x20, 0x6b, 0xc9, 0x0a, 0x95,
+    0x98, 0x23, 0xf0, 0xa8, 0x5d, 0x97, 0xe2, 0xaf, 0xa5, 0xfb, 0x8a, 0xf4, 0xc1, 0xaf, 0x60, 0xfe,
+    0x22, 0x84, 0x7c, 0x41, 0x90, 0xb2, 0x0a, 0x5e, 0x00, 0x00, 0x00, 0x00, 0xff, 0x50, 0x09, 0x00,
+    0xf8, 0xa7, 0xa4, 0x58, 0xbc, 0x06, 0x6c, 0x9a, 0xfe, 0xf4, 0x2d, 0x25, 0x75, 0xda, 0x4d, 0x74,
+    0xc8, 0x5f, 0x38, 0x2f, 0x75, 0xc5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xc1, 0xb0, 0x1c, 0xc1, 0xbc, 0x7c, 0xb6, 0x7d, 0x64, 0xe0, 0x39, 0x03, 0x62, 0x26, 0xb3,
+    0xe9, 0xf4, 0x70, 0x5f, 0xcf, 0xc1, 0xd0, 0x53, 0xf5, 0x11, 0x3e, 0xff, 0x3e, 0x82, 0x3d, 0x82,
+    0x0a, 0xbc, 0x0a, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x09, 0x00, 0x7c, 0xad, 0x99, 0xd7,
+    0x8b, 0x64, 0xb9, 0xef, 0xd8, 0x21, 0x32, 0xef, 0x0e, 0x05, 0x87, 0x6d, 0xda, 0xdd, 0x0c, 0x50,
+    0x91, 0x17, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x2e, 0xef, 0x2e,
+    0xe2, 0xa1, 0x5f, 0xde, 0x19, 0x9e, 0xb1, 0x3b, 0x88, 0x82, 0x72, 0xd0, 0x41, 0x0e, 0x92, 0xe7,
+    0x17, 0xe0, 0x17, 0xc0, 0x86, 0x99, 0x61, 0x0b, 0x03, 0x6a, 0x2a, 0xee, 0x1a, 0xbc, 0x0a, 0x5e,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x51, 0x09, 0x00, 0xa6, 0xe7, 0xdd, 0xc5, 0x8c, 0x97, 0x2e, 0xca,
+    0xbd, 0x69, 0x51, 0xd6, 0xaf, 0xfb, 0x93, 0x74, 0xe7, 0x05, 0x29, 0xb0, 0x4e, 0xcc, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xea, 0x5e, 0x97, 0x5b, 0xe6, 0x4d, 0xd2,
+    0x4a, 0xb2, 0x9e, 0x7f, 0xe6, 0xc2, 0x41, 0x8a, 0x91, 0x42, 0x86, 0x02, 0xfb, 0xae, 0x26, 0x31,
+    0xda, 0x04, 0x17, 0x6e, 0xda, 0x97, 0x8b, 0x76, 0xf7, 0xbe, 0x0a, 0x5e, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x51, 0x09, 0x00, 0xab, 0xac, 0x1b, 0x6e, 0x67, 0x0f, 0xe2, 0x93, 0x2c, 0xa7, 0x50, 0xe6,
+    0x33, 0x8b, 0x4c, 0x1d, 0x1a, 0x5f, 0x32, 0xf2, 0x1c, 0xac, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x2d, 0x14, 0x1c, 0xc7, 0x45, 0x8b, 0x3e, 0x00, 0xb9, 0xbf, 0xa0,
+    0x37, 0x57, 0xc3, 0xb9, 0x16, 0x7a, 0xac, 0x5b, 0xce, 0x2f, 0xca, 0x55, 0x6f, 0xf4, 0x67, 0x63,
+    0x23, 0xec, 0xc6, 0x6d, 0x11, 0xc5, 0x0a, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x51, 0x09, 0x00,
+    0x97, 0x7c, 0xce, 0x5c, 0x2a, 0x99, 0x28, 0x71, 0x31, 0x2c, 0x67, 0x2e, 0x5d, 0x07, 0xf8, 0xeb,
+    0x03, 0x2c, 0xee, 0xb5, 0x69, 0x50, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x79, 0x93, 0x2c, 0x9f, 0x77, 0xa7, 0x7c, 0x69, 0x83, 0x3e, 0x34, 0x71, 0x55, 0x76, 0x35, 0x2d,
+    0xff, 0x7a, 0x41, 0x11, 0xd7, 0xa7, 0xc7, 0xeb, 0xd8, 0xd6, 0x73, 0xd3, 0xf0, 0x73, 0x0c, 0x06,
+    0x60, 0xc6, 0x0a, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x51, 0x09, 0x00, 0xae, 0x79, 0x41, 0xba,
+    0xc4, 0x24, 0x86, 0x24, 0x94, 0xd9, 0xdd, 0xdf, 0x56, 0xb3, 0x58, 0xa8, 0xbb, 0xac, 0xc8, 0x09,
+    0x87, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x01, 0xb7, 0x94,
+    0xae, 0x70, 0x27, 0x98, 0x25, 0x11, 0x1a, 0x53, 0x82, 0x99, 0x1c, 0x33, 0x5e, 0xc1, 0x3b, 0xd6,
+    0xae, 0xbb, 0xbc, 0x23, 0xb4, 0xbe, 0x7c, 0x92, 0xa2, 0xbb, 0x65, 0xa0, 0xf5, 0xc6, 0x0a, 0x5e,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0x09, 0x00, 0x0b, 0x2b, 0x0a, 0x81, 0xff, 0xf5, 0xe8, 0x28,
+    0x6c, 0x4a, 0x33, 0x1c, 0xa2, 0xd0, 0x13, 0x40, 0xb1, 0x93, 0x63, 0x65, 0x55, 0x3d, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xf1, 0xda, 0x25, 0x3a, 0x72, 0x10, 0xd9,
+    0xb0, 0x81, 0xc8, 0xfa, 0xbd, 0x21, 0xbf, 0x32, 0xa8, 0x27, 0x01, 0xa1, 0x73, 0x5f, 0x6d, 0x91,
+    0xf1, 0x3f, 0x65, 0x11, 0x1a, 0x1d, 0xb4, 0x16, 0xb8, 0xc8, 0x0a, 0x5e, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x51, 0x09, 0x00, 0x20, 0x29, 0x38, 0xab, 0x29, 0x50, 0x9a, 0xf9, 0x10, 0x4f, 0x8e, 0x59,
+    0x76, 0x26, 0xdb, 0x7c, 0xd2, 0x03, 0x40, 0x3a, 0x15, 0x1f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7b, 0xaf, 0xbf, 0xf4, 0x06, 0xed, 0x3a, 0x05, 0x48, 0x34, 0x51, 0x0b,
+    0x3d, 0xc0, 0x8b, 0x00, 0x29, 0x2f, 0x68, 0x11, 0x5c, 0x89, 0x8c, 0xe8, 0xa4, 0x3d, 0xf2, 0xc1,
+    0x09, 0x3b, 0xec, 0xaa, 0xbf, 0xc9, 0x0a, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x51, 0x09, 0x00,
+    0xc1, 0xc4, 0xbf, 0x26, 0x85, 0xb9, 0x1b, 0x18, 0xb5, 0xe3, 0xf6, 0x52, 0x54, 0xfa, 0x0a, 0xc4,
+    0xd8, 0x31, 0xde, 0x62, 0xe1, 0xa7, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x95, 0xd6, 0x79, 0x0f, 0x8a, 0x22, 0x6e, 0xf9, 0xe6, 0x22, 0x32, 0xc8, 0x4e, 0xb7, 0x5b,
+    0x6b, 0x68, 0xe2, 0x9a, 0x1d, 0xce, 0x03, 0xaa, 0x62, 0x3c, 0x63, 0xd6, 0x86, 0x2e, 0x44, 0x4b,
+    0xcc, 0xc9, 0x0a, 0x5e, 0x00, 0x00, 0x00, 0x00,
+};
@@ -1,728 +0,0 @@
-static const char *initialTestnetBlocksSql =
-"BEGIN TRANSACTION;"
-""
-"INSERT INTO blocks VALUES(2015,X'299b05fa50212725c6082936bb1cede9164aaa36103325504c744b8600000000',-100295895,X'8071c4e60214c16c1f2d5d56e7713782d6fa9f16d9692f49f8fa8428be51c909',1337966313);"
-"INSERT INTO blocks VALUES(4030,X'b06831147c84e7835e0aaae59a9e56476896cf09f2493be64928074b00000000',338782384,X'6670dc27b3d686df3afbadfd8888ce93276ad94e62881f660bf0255df8682ee2',1337966649);"
-"INSERT INTO blocks VALUES(6045,X'4450bc65b02df543edd0fa2be729139c29b1981b06e116df446ec12800000000',1706840132,X'a53b0aac31c1e98825535a592e8effec77d6ee073f94c8939d14a173c584fb63',1338180601);"
-"INSERT INTO blocks VALUES(8060,X'e94b238cf0e45a820b3715c8b6982fce268c2ecdf84c7d36483d680800000000',-1943843863,X'c6d7550ccb3c302fa64fa92173b9a3e668390a1d7a6ca46e499b798a74d186b9',1338180937);"
-"INSERT INTO blocks VALUES(10075,X'98c1c2a01fbb7dea713cd255f9443deeaea568307f42be6b41b5541300000000',-1597849192,X'8ab9aa5da4a6475fbb9abecd22954b9eee3e58066c304e489b7dd32e6bef385c',1338181273);"
-"INSERT INTO blocks VALUES(12090,X'de0814c9030e1dfde415f8063906a3c28adf0c899ab5639e4fc18ea100000000',-921433890,X'30ad78d9b7b2b777edb763d03b03189f7d6ad23be23eb92b2b94e5830649bcbb',1338181610);"
-"INSERT INTO blocks VALUES(14105,X'83af6874ed937970fc412ed809748c730168c085c1f0c84fcd291d1500000000',1953017731,X'f43db301db13e1e1d6a0c3d868f7c6c206e6671dc419534b44c2de239a5e0893',1338181945);"
-"INSERT INTO blocks VALUES(16120,X'6c8ee41d86d8849432d9120717c1f200daee0ea522bf5146057aea7d00000000',501517932,X'a1107c3426222bd8776182df205fd3fc839c15dcb315174f92c8eb401004cc05',1339924812);"
-"INSERT INTO blocks VALUES(18135,X'40fb69bada2d86590703dbee69a99d53b340c5b76b0a94226d55627700000000',-1167459520,X'1dae5de4cadde8bc874f6fdf6441b958877a3f4ef34fe7910db1cea3bc6e36be',1343706320);"
-"INSERT INTO blocks VALUES(20150,X'9bb6109612028e2ee300bec1d69f318db17a8d668b703419cacaa74600000000',-1777289573,X'6098a651a9952a5238dfc3ae83d0e6324fb89e23a58035dae539d89930065040',1344990125);"
-"INSERT INTO blocks VALUES(22165,X'f118bf52c453216f3264fd344df6144c41f6c3b9fac23becd6d9da0000000000',1388255473,X'3f8d900c59de5428d51324974bb2b906f65601732ab661bf7b9955c506974d55',1346666235);"
-"INSERT INTO blocks VALUES(24180,X'70423b160713eeeca519adff2cab2b50a9def839225ef16073e93e4400000000',372982384,X'9ab5eff473eea4260210a65e577c951e59ab48bc9b3bb9b6f418d37a70f11266',1347155723);"
-"INSERT INTO blocks VALUES(26195,X'e9417c626676ecde761a14ba551374aed9e8af4d83e4d58ff9cfad0e00000000',1652310505,X'fa7d30703a7a1369f3c78cee975b23f6954116d4f499c2d5a68c081b2c951571',1347771617);"
-"INSERT INTO blocks VALUES(28210,X'5e6e35e336419f2458f92ffde8533ec52c8223c69bc2c1c35f2a571500000000',-483037602,X'2291502e8345e694ba79662a7c5eb9befad39479105b48643e1e4c4ea36242b6',1348812336);"
-"INSERT INTO blocks VALUES(30225,X'ff00b34c66df1b95d35f59d2d036b161368a96339e30beaa69c21b0100000000',1286799615,X'8141db60e2f42b4f7cdbc92cadad2a8ac7af4933e7a9e3affa6b9411cbad250a',1348888391);"
-"INSERT INTO blocks VALUES(32240,X'77f84966ed3ad4194db05a15d070e013dcb8b36538f3f36bb19ac60000000000',1716123767,X'18a591f2d91fc6015c36f3e994a1d0c820dc836d5dac93be0e8077b14eaa2a8f',1349211238);"
-"INSERT INTO blocks VALUES(34255,X'0e17d0b6261512fe0f593b990657fc4dfd1d78f70348cb1cc005030000000000',-1227876594,X'db0d068fcfbcc8a405acd470818313cbf3bacfb9c3f9f6f0a53d08a135b36be0',1351874786);"
-"INSERT INTO blocks VALUES(36270,X'e15fcd3a3cab7ee62d18921443558898a030e68511e50788ef8eb70100000000',986537953,X'2a9f032b91b823745ad6063399385caea47781df46817e21eeb47cb282c32d04',1352496237);"
-"INSERT INTO blocks VALUES(38285,X'a362d0f3ddf7c0909648888dde697f01947e2bdec88257c7d54a6d0000000000',-204447069,X'1dedc4a1e9683ab73f29d89cbf7553887d72707d7af1191990771f17324a1346',1353760093);"
-"INSERT INTO blocks VALUES(40300,X'caf08ecd068b4ac9002acd5b2744640455fcfb380e19148e590be7fb00000000',-846270262,X'8fb9b79e518436bf8144e8048d315a6254e22b781c997a83c2ed026129bba9b7',1355960159);"
-"INSERT INTO blocks VALUES(42315,X'39bdbd71ac3e54cb137d07b4b8bcbdef9293a53ae8a8112d015cfb2400000000',1908260153,X'e8fb656e8499a58e2fccd0eb845cef16d5f9a78472d5e4375d949d5acbdae87c',1356198485);"
-"INSERT INTO blocks VALUES(44330,X'f80ccf713d96d8c46f3ac5bcbc8b9b3ae61eb371972ebd440fe6dd3000000000',1909394680,X'51a6570aea45b14c2af78cd7336995608fd06751a79e0e5a81e5f3d1a0461244',1356489933);"
-"INSERT INTO blocks VALUES(46345,X'8d57c6e9b9e9e9c1aeef7f86ebf7a927a0c848cbe8af05f1fc28250900000000',-372877427,X'de06ed0a59f017f96c08ecf74e7fe911bd98dbee006f80f5b0c25d222c99fdd7',1357104172);"
-"INSERT INTO blocks VALUES(48360,X'93f3580849f1aa4efa0b691f860642f172373d4868835db99febf40300000000',140047251,X'5428140c386134801b4947d0fb4f802b2dcf76ca6673c447af829a2df12d3cd2',1359236928);"
-"INSERT INTO blocks VALUES(50375,X'da8c51816f0c366211f84eaf3d94ab1a0a86c22d8c0080908dfcba0a00000000',-2125361958,X'69ad5a9d18680239aaa14264dae67fbb237b8864b5ee580937505048d74126c4',1360560424);"
-"INSERT INTO blocks VALUES(52390,X'f4b7119661e5e8dccbb5a5d386d956f8b10827d4d888173587ee590c00000000',-1777223692,X'9aa451869f7a8d33b1aa4e341a7058751554a7d2cb25cb95a21003a2c820726b',1360870625);"
-"INSERT INTO blocks VALUES(54405,X'b7af0f5d24a765ca07794c7341d054a1bb8f844d4e3ecb639959ed0100000000',1561309111,X'142517e6884256bbc03f234292d514a359afb89b313d6ddbef4bf069d2abb950',1361500201);"
-"INSERT INTO blocks VALUES(56420,X'a8a8940d408d38efc276105d52a141b5db253f76b2ac043a2aa325c000000000',227846312,X'bc5f38f353f0af7f96e7c23962fd1265062723189aa49c1330708b94382d0fe7',1363098567);"
-"INSERT INTO blocks VALUES(58435,X'c53e0d59ee355a7d02b6ff04fcf30b7444e4484feeb6e0b75d0afc0200000000',1494040261,X'b3664e1c822e5f923941c1b77eb224bf1f81ca99c4004cfcfe2089d88e738d5d',1363163242);"
-"INSERT INTO blocks VALUES(60450,X'1bdd8d7653607d90e14cb734efe99d0af14b1d108d534cb0228f291200000000',1989008667,X'690fe91903a83a11894f0db79392c36b2321b66f405aab177e8bc04d7bbbd523',1363731611);"
-"INSERT INTO blocks VALUES(62465,X'2bdaaacc0ec1748d34d21683faf46079dca4b8694486e698c87a5e0f00000000',-861218261,X'8ecef408c98045c6eaea066ca6c695831fa145eab209160ad6e5f494c99bfe45',1364571429);"
-"INSERT INTO blocks VALUES(64480,X'b76447cee1c6d8193022d3dcc7dd40895f0a5e73b4011f9ff72e4e0f00000000',-834181961,X'eeba8ec95628db21d18e29ace59db40ffcb29e998067c8ddd2d440d452f272ab',1365213142);"
-"INSERT INTO blocks VALUES(66495,X'0c3efc62769522e097d7a7b177092f6dc3abd7b0ca97268f2811f10300000000',1660698124,X'10cb5177a5c76abc73152a4ddbb6cc03db83707b14cd34b545ed97fd5cd23353',1365871423);"
-"INSERT INTO blocks VALUES(68510,X'77ccf0ba49f2c06235f6ddd71905de888ff745d2af7656c90c9f3b0300000000',-1158624137,X'7bdbb6dcbfc8dc5e87981d6a486f48b9d300b6d5f9b87c4a7f0aa022f3e5158a',1367110381);"
-"INSERT INTO blocks VALUES(70525,X'c67d5b3f22e21f09ef9e1e038854a4f323842176ee8f05df5f06140400000000',1062960582,X'097a763353b3fe48ee538a99ea04b5f5aa1a4235d4ec1a6e41cf213527a6a9de',1367389537);"
-"INSERT INTO blocks VALUES(72540,X'1906be7fe024816984d8015092783d6684c3775502985508c5a90f0100000000',2143159833,X'ca70449e6f32a28bb7e32330429b6babcf0588dcdaa30f9dd134a825a5bbb87e',1368452168);"
-"INSERT INTO blocks VALUES(74555,X'63c135f28c7331de6a3c50a88f82db953ba3bf493af321a179a9f91e00000000',-231358109,X'b6aabad1eb79278e57605513f543e63338d9dedaa52a4d7c4f250378ff26a021',1368485393);"
-"INSERT INTO blocks VALUES(76570,X'16003eb0b2c215e19774ea532aaef48197f3f0a00a3fdca5cce66e0100000000',-1338114026,X'9999f838243e50d0c1047a8f6cd0c0e75fd942cf96552f666abab3ccd91f77d0',1368529450);"
-"INSERT INTO blocks VALUES(78585,X'7ecec417c5121ac7d49bba9384e6615e39bb0498fb09493d9350dd0300000000',398773886,X'86177c8a8c0832b804d4dc31b2b8e04ea38f1240e8e9ec26c44c0033bb28fd1e',1368660165);"
-"INSERT INTO blocks VALUES(80600,X'927a9dbff6819ada20f78512d18b0a2741e1aafc6efae3ddd79a730000000000',-1080198510,X'eed5db915d8aef06472f731d59943db17491942a3fd4f0cdc81e9e99b7819f38',1369028913);"
-"INSERT INTO blocks VALUES(82615,X'e48917084c5fd2422811709ecc1f2a2c3ac4ece70851dadc45bc6d0000000000',135760356,X'39fbc54a1707702e49b3407fa53432e8c3d7b8212c753d6de40312c983e7358b',1369712367);"
-"INSERT INTO blocks VALUES(84630,X'6abb4a9704ec298be30db98f20bbda0a979cd8e6ec16cba71db606ba00000000',-1756710038,X'a91e9e3d49b0dcb5b7e29dc99de5d086fb4926e92a70532ffedf659f8bf7468e',1371346162);"
-"INSERT INTO blocks VALUES(86645,X'561b47e645c1e364e481865cdfc2cca2ed23529fd27ea6cf3abf0cf200000000',-431547562,X'8a2af40a66284f2f27039f48372b1bcd211f76f6f5a8150b9f8dfd97fe5a70b4',1371409265);"
-"INSERT INTO blocks VALUES(88660,X'7ba4fe07d365175b81215d917a873e40b5456c0b077d0b94601bde0c00000000',134128763,X'e5e5926d2eccf01b9ac8f3be2e535cd333a5d05f312c3123b771bf63a06c4d4a',1371446853);"
-"INSERT INTO blocks VALUES(90675,X'7abf7757021671cd0d9b145fbb838ec41ec22efa7a62f0276cc40d0b00000000',1467465594,X'71446a6cd289e7f3c55589045af395194e1f0c9922f400659dccda257ac34c5b',1371524708);"
-"INSERT INTO blocks VALUES(92690,X'd233a4ef5ba48981b39cf403296348226025c7f16cda03d2cb50d10000000000',-274451502,X'd11fced8ed481f66354014df8c9ddda87f638eb8e7c1809353f7d2a7c34cbc3e',1371843006);"
-"INSERT INTO blocks VALUES(94705,X'91521ae1e3e1f72ce7cd3826776e996d844fa4c86a7e502a631be83500000000',-518368623,X'439deabc8107e9e579745349e86f32308d1cdd4278993ce3f8bff16938a9338e',1373104312);"
-"INSERT INTO blocks VALUES(96720,X'f6570fc86b41fc3e16ccc2791c335d8b5e4577a055522737a480d9b100000000',-938518538,X'3241c37902450f15d1acc7dbc4b8fe1b09cd25db731b31e1227799ba74ffa202',1374619059);"
-"INSERT INTO blocks VALUES(98735,X'c9489767a7a8bbafc4e413e528e8625b5eb71060b3e80f62f00e106500000000',1737967817,X'7940bb6f02301a5c9a6411246f63e25510369d767c59586ed7698f049d37ecab',1375442002);"
-"INSERT INTO blocks VALUES(100750,X'6601cede966ac8eda73d1301236f75d90463e9387d61c5de85a6d70000000000',-556924570,X'5e0d8580b6fdbb656c14c1b2342a27e3036b686f4ff84ff553f3297ccdb2db37',1376519439);"
-"INSERT INTO blocks VALUES(102765,X'a6efe6992fffa3349963052455d75c39fca098dbb3ec041cfc00000000000000',-1712918618,X'fe7621259555798beeb95688aac16533ea27cec5c249d48b4ef33715deaaa23a',1377428649);"
-"INSERT INTO blocks VALUES(104780,X'252bcc1329dd74fb322ec12793f571286d2b0d8126da70a58b453e0000000000',332147493,X'69547ac4a6837ecf2bfc73af43e7a10fde9acff788803ac917581f0da865ef85',1379031449);"
-"INSERT INTO blocks VALUES(106795,X'e92ebd491b1561cf42d769cea93ac3720545d1ad3915dabdefb95d0000000000',1237135081,X'5e3e90aaae2dafd3bc5824f080fac814184f7121c5c98ce02c4fa49d401ecd33',1379794393);"
-"INSERT INTO blocks VALUES(108810,X'e3e9458ce3a24fc318d84b4a342d89c0900fe12be7bde7aa3ee2820000000000',-1941575197,X'b168dbbf64f48f16031bf77b72167a2d78e08122ce9c50100eb2cf80c94f53ec',1380315822);"
-"INSERT INTO blocks VALUES(110825,X'3f6d20cc79497d759bdb7815d03b1b46986335c78809e87fea7e2a0000000000',-870290113,X'43f26631bb952b91cdb823b6748cf67bed1cfc2ada2dc4856c2c3ef0d2f64bb9',1380341366);"
-"INSERT INTO blocks VALUES(112840,X'8848c0b72e75e64c8b60fc5d4af03221484c13929a2dbb8ab3fdae4800000000',-1212135288,X'fc8e91c79ca3596849748342a749bbb178d01d06a913ab9dc9c44bf23ce8ece3',1381190368);"
-"INSERT INTO blocks VALUES(114855,X'e6ec7bf3d65d424a583d342976408b656b988068042d6b07ddec577800000000',-209982234,X'93d17a46ebd37d2e46c18a567d4dfe54701f3d847f1a994467edcf6304e7bf83',1381265675);"
-"INSERT INTO blocks VALUES(116870,X'0df7e02bbc54da8d20a1be158f0715c6b096dd6e9e81571950cb591d00000000',736163597,X'1b6be30ef34c8856049b10ca1b089c44001137561399518c6493a67cbe8b7663',1381499212);"
-"INSERT INTO blocks VALUES(118885,X'12b6d8e2559e17791efae3f7f2e3b4ea076f872a717e15feb766d60100000000',-489114094,X'c850a803451b8ecb74c0938b6a2595043512f871771778fbee011c39baffb96d',1381675377);"
-"INSERT INTO blocks VALUES(120900,X'df6743c2317616836a382273611121fcd0cd011721a31738cff2eb0200000000',-1035769889,X'130d6345957abb65afe1b9a66b77e046ce5d07ccf86dcb546e597b40be28a248',1382025243);"
-"INSERT INTO blocks VALUES(122915,X'8f5cf08fa27672165b0a9fe4a592537786c6570c2cc322711c4f870000000000',-1880073073,X'38a2a18e764def0dfb7eca0ef32b3ca406d69fa54d158c3031bd7b782e168101',1382044150);"
-"INSERT INTO blocks VALUES(124930,X'cd502dfcc9a98dddaff61d87dec1762915c6a4a1dc693d8c298d320000000000',-64139059,X'2a13abf5f3632c5c007436f198ef897d189257a6e69ab4e69e6ef6fb6d689588',1382073091);"
-"INSERT INTO blocks VALUES(126945,X'a6e7a5d37fd5f3027c89aa15db18ba6b214e5f0ac5b8783c093a090000000000',-744101978,X'77d0046e2a37e718c8306ab91c3c225dde0a57cc83f28a365286041d9e190b7e',1382144107);"
-"INSERT INTO blocks VALUES(128960,X'd46d638f3a9228a9e1f3aca25f855ece8ba8fcaf668f23d6d17f180e00000000',-1889309228,X'727e98270caa60531865bb1999f9bf3b1efb7ff953c995c37521d28a9799e223',1384032455);"
-"INSERT INTO blocks VALUES(130975,X'fed9cd9fe3f579f2998ddc031adbb61bbb3da334c81c70b133efc26100000000',-1613899266,X'547384c9446fe202258a91cd184f588ac1a71975b53ed59d7ef2fedd795e96f9',1384107564);"
-"INSERT INTO blocks VALUES(132990,X'd6a7a026d332333277eba1f92bfec45278c2bfcd526d5bf2897dbb2000000000',648062934,X'37a6d05b1f7c42f8957e9ef78f0246d96cc9894f0e8c1c1ecaa554ad37eea511',1384117090);"
-"INSERT INTO blocks VALUES(135005,X'dc26c7386a8bfa1239e814efd34eccf07a981863958717aee8e45a0e00000000',952575708,X'f8dd0f37f9807986c2feb24dd164ffbf91e48ddd5386c5669d474fd14581e639',1384144671);"
-"INSERT INTO blocks VALUES(137020,X'c2a27dc054fad1b2404d32714d8ac9df5f3189c029bc4508522fde0300000000',-1065508158,X'7404d17504397640c85cc0ff5b84ef88d8d8a866a464794f211d7a42fa5f0246',1384206180);"
-"INSERT INTO blocks VALUES(139035,X'3fcfa5de9d5a9d13495cad651e8ac00d68b939dcf379a74771368d0000000000',-559558849,X'eaca1492c7af6a4b3ef80759bb6d886c6ea648108203131928fb64351e304ae6',1384439568);"
-"INSERT INTO blocks VALUES(141050,X'd482a4d54a6254b3f029c33b011722eef262c15f7849d077ff7d6f2400000000',-710638892,X'5b2b471ff3a3b950e85ce8e8a937a62ef454312fd1b2ce51c468f2b7624fda43',1384492603);"
-"INSERT INTO blocks VALUES(143065,X'50d66eca10da3f85ec18f92b270ecc5a910d782631da5e0703c6650200000000',-898705840,X'44c9a9b7b793d13de286d6c75777d9babdd84b8202790a783e199c9a53637a8e',1384568882);"
-"INSERT INTO blocks VALUES(145080,X'5605e543dc7e2dfafcc23954a3f28ad1ecda714423eed0124cdf4a0200000000',1139082582,X'eb443b52a1b2e7ddcbe4a98f8a5486622256a7351a8234bd09e1ad27e4463552',1384817791);"
-"INSERT INTO blocks VALUES(147095,X'86cf54acb32e3d404975cff31b32bd40cd886f0ab396ff5ce673690000000000',-1403727994,X'c19755c6420bc87e442e858b6404e8f6b3a4616abbf5820697b7e37a49192556',1384958268);"
-"INSERT INTO blocks VALUES(149110,X'f197999fc531f0af36fe999657447f6535d6ad8d7001d8aae5500c0000000000',-1617324047,X'4c85991b2008201835f9c67ec207e5580094327f44b61b89c1e58f9e4abaa27b',1385594156);"
-"INSERT INTO blocks VALUES(151125,X'1f7514dc4a8f2a13d9f0f5a31f7cb2b11889e1fee90f57f48bc5040000000000',-602639073,X'f18776d3356cc2eab69fd0a7b3a0976e7825d5221cb28229deeedc20d83066b1',1386348737);"
-"INSERT INTO blocks VALUES(153140,X'd15f2591a62e0d9ca8c24f1ab7a158f8d37aa76e5def8d7f9be8120000000000',-1859821615,X'511881767a3d04ceb08d1b6bc40c1fd7901a62b0c19625afded8421726c9c816',1386640484);"
-"INSERT INTO blocks VALUES(155155,X'c149326ea821845c35d979e16e26ae86298c2b30fbadf1577a67010000000000',1848789441,X'10f8bed6c3d52fa3b89812c061739b7e95df5597c3aa763f9f8e21a192fe010b',1388786578);"
-"INSERT INTO blocks VALUES(157170,X'4227e9d21ed5e21016e9fa9bfe95ae458f3e51f10ebcb268bec9402100000000',-756471998,X'63d7521420277c81adef44186edda9edd96a59b5ff3372d94f7e45c8a463e916',1388876321);"
-"INSERT INTO blocks VALUES(159185,X'f667d3a09ca0333b0a69023dc52dc2943bd048224ef2d834cf3b812300000000',-1596758026,X'b442510c72ea16522f51c22e1a39e59b8b1e18b272489b5e32ad454ff59c053f',1388897939);"
-"INSERT INTO blocks VALUES(161200,X'2c4f16be33b1296fa3406bb08614b67dba122192d9d29c48a3d3170b00000000',-1105834196,X'815b43461586df0312fa547d71e1305abb8804f395a50e309b6e670f565876ec',1388977214);"
-"INSERT INTO blocks VALUES(163215,X'f4993d71a702aa633985e183fc741534b7683ded94bbc6e56f2b9a0100000000',1899862516,X'c0cf7bfb54eab027653516993e0e9bcce2bae8f06f568977281f8e57d5c03605',1389124892);"
-"INSERT INTO blocks VALUES(165230,X'745eee5bfe61fb2fb745e8b8056d51df196c5e783bbd7341a9ca3e0000000000',1542348404,X'973b0116296285b1d5d236d7ccf45c361d764dd671b9806c1d5c5a11e55a4de1',1389395256);"
-"INSERT INTO blocks VALUES(167245,X'277bd98bc617449a497bb648988e7262d8b42b7ec5ffae7812f5110000000000',-1948681433,X'90e3c2f1579793d07bbafcf3e3f29383f2935eb918e3ac6661db25d3db9c3d79',1389424293);"
-"INSERT INTO blocks VALUES(169260,X'c17b4aca2d640558e8579d7f677b429a72ee9b9d59a9fdaad18e1f0300000000',-901088319,X'f5ad0a66c6a021cc432f2db636f46e8f26aba34a8b888e7c8c17171f230bcfcc',1390667368);"
-"INSERT INTO blocks VALUES(171275,X'b91f2d40c6d10ba17e235b764d087f31126c87234d11929bf47e000000000000',1076699065,X'7065dfcf52db140e9783db0e6e11d3b16acf08afcf457c556da9cc749509965d',1390855607);"
-"INSERT INTO blocks VALUES(173290,X'a50b1ea5ec20792e53be296b54b5e3eb94643df3169680dc4700c32500000000',-1524757595,X'ffad0617c9469d2f368da1aef3f1b41b42e970653237351bc2a3039052b80464',1390948213);"
-"INSERT INTO blocks VALUES(175305,X'ffec134ab80efec06731f19fa3cc9191f8f5ebcf2cd727315770bf0600000000',1242819839,X'e86432455e212bf9e89daedf8b41201a0f36a540558f50ab419e822ba112041e',1390995796);"
-"INSERT INTO blocks VALUES(177320,X'b2517fde0e63626d8742f31a7e78d5432ba530a00effbd28f9f6230200000000',-562081358,X'4a0361f8e3205612c98e34e7a0575f005eed61ad86cf41d385c0c25f493742e2',1391115097);"
-"INSERT INTO blocks VALUES(179335,X'74a66d573b43a6fe98dd91be0b9c27a1a705ecd2d7550410ef76120000000000',1466803828,X'05ce1a77633c6f59ab549d91f7ce8f403c626a9467fcbd8af6ed31a011205635',1391467719);"
-"INSERT INTO blocks VALUES(181350,X'a45f63a4e10211c2851823d88cdf2382f95fed9130465916f1b0388a00000000',-1536991324,X'c2323ad454d6459f58352a3fc4fc5ad0d864f2c4302bcdaa4389e00ad3ea7139',1392289182);"
-"INSERT INTO blocks VALUES(183365,X'0e6cc2f287090c5b7dfd5445324d633d0ef7b9cc0220c4771355210000000000',-222139378,X'62876a3322ec317f1ed9c2ed5cefc5e644a7889385b976fcec81a3157cb96813',1392799767);"
-"INSERT INTO blocks VALUES(185380,X'c66f157bce4593b957d4a11b3dde2c333aa65a1bb3a9bac718de4b5300000000',2065002438,X'1bfdc8541b643397805ade7fd03a3890df87cb2f72c285f0bf6cbf402a43dffb',1392833150);"
-"INSERT INTO blocks VALUES(187395,X'963f9cfdd61ee93a13c36714f7ce141524c3780ee29ab06cac61301000000000',-40091754,X'80272d6a9b6ed5b98d1c4a1e8efb31058f947655c10b1481d5e25e1a9428eb52',1392847744);"
-"INSERT INTO blocks VALUES(189410,X'5d7919ce070e4322d76536a349f7d7e92606aa17aaf54c5278a0280600000000',-837191331,X'aa09d9c49ec3688f12227fd80a9aa3c8d1a00669701ccdd997b30bd754d482ef',1392886585);"
-"INSERT INTO blocks VALUES(191425,X'41e842e47bad26955999d845f6d714f31778af82e5a39b3d2c9272e300000000',-465377215,X'681949465ec4e4bf65b3e324f837121c2c2e3e526e428598ff64ba9a7a1e7859',1393095524);"
-"INSERT INTO blocks VALUES(193440,X'bb195eeb6b12f5813dcc7bb26964e4d2be50c878ab4089cbdf7a080000000000',-346154565,X'76d775e2456dc6b55ffe95d2fdc30ee3c98765c44c6b35ca134f9ad910d4de2e',1393542102);"
-"INSERT INTO blocks VALUES(195455,X'00b299229525fe1cc0eae2fc48a3cd26dc71315938315098c54efd5d00000000',580497920,X'823362f629e01cf703bc20fe95e08448cce9087364f56989b5658f7c760d10b3',1393570104);"
-"INSERT INTO blocks VALUES(197470,X'b1bce40517cc51bd6df3f78edb3e020d450365185bd2b0e15129af0b00000000',98876593,X'd2b0c5807e282dafa6f73d8c0d1a68b5e4ebd38bfaa5be5fd247178c20995b77',1393604088);"
-"INSERT INTO blocks VALUES(199485,X'0dbc777fe52b37e358fd9f180ce8ba9f51b43ca47f6f648ccc08400000000000',2138553357,X'8a7b22773abb410abe70547363fdda2eada5546760baa249ae5d2410b84896bc',1393642889);"
-"INSERT INTO blocks VALUES(201500,X'0f5c9c6944a5892780379012abcbb097fa934ff5e3f8284278b66d0100000000',1771854863,X'6b88ff9b024a155c0e3689152ab1648cb01b5d80f614e7647e6ae29e718d82fb',1393801635);"
-"INSERT INTO blocks VALUES(203515,X'4d6e7a294f4ab5d1b340538f0018c4ee1fc292861fe7c0d9bea2160000000000',695889485,X'fda6ff571ad2ad251301467c942592df9bd75db03548fdc3a97652f79992afb4',1394104618);"
-"INSERT INTO blocks VALUES(205530,X'b7d8c792b0ec137393fda1beffb7fe65e0525991308a4d1ec5e20da600000000',-1832396617,X'8cb105ca256c0fb2aa2db1fc28e36dfa2fa481d0e5e08d2f37f061f40fb0eb57',1395267517);"
-"INSERT INTO blocks VALUES(207545,X'19af1ad15fa2a76faa92dfdc04da3607148d44c9ab0547d0726a0e0000000000',-786780391,X'4a5d46d69b3c38506f5bb8cf8e1573fbbdc1c74823ebd5f8ecb6cc3bf438bcdb',1395568312);"
-"INSERT INTO blocks VALUES(209560,X'00335eaede8312b15fae1d616de10e32b3b30a4179ac535518321f4100000000',-1369558272,X'b6c6a94394b38cc56dfc7401f1918d05e71ad5bce1f91e3dacb7ca5a329f6463',1396954714);"
-"INSERT INTO blocks VALUES(211575,X'bb3233ec367575e0bb7ca369e7dbfb85c1f6c6ee552a91bdb3d32be200000000',-332188997,X'723f413896094a8fa406de5691ab32f2d17c58fcd55b33089cf169ff767dd6ad',1397003427);"
-"INSERT INTO blocks VALUES(213590,X'612ac980c2b702ae65c0eb5e4fc5a06f7d4bba0268a68c118320fd3200000000',-2134300063,X'f71e0311ec02eac9ed1b140ed1ef9341ccdaae43bebdd74a30eb6f62429dd736',1397030942);"
-"INSERT INTO blocks VALUES(215605,X'a6db7da7e6228468fc719b92c2f8f862051862c452f56bbc3aa1480100000000',-1484923994,X'ea3c2f53fd4b059c2665b2e09f7b7083dbf4b9dbe5ec42c08a7771a56723d66c',1397118171);"
-"INSERT INTO blocks VALUES(217620,X'011217c071754c8fc4ca260ae8d0623716c26d8dd1324c4af634e40200000000',-1072229887,X'4ecff9de2224fcc1f50025170799d3b8f8a492d672a1860b32b3de3202c03442',1397120598);"
-"INSERT INTO blocks VALUES(219635,X'54be8c97459a1b4164edf749e123c88aa0d64b4d1f4ba94e6260850000000000',-1752383916,X'eb1e2d2b29f69e89f9b2fe441fedd02ba3c2ee7d04044f53ed1b9744b61c057d',1397134591);"
-"INSERT INTO blocks VALUES(221650,X'a40ea37b28077dcd6d677f4bfd6fd469450e8ec35d9052d1b01f150000000000',2074283684,X'13f8a847aeed8acfd20087ba20ccbd41669fbc1dbe5ac78c7a24394e3249e0f3',1397404345);"
-"INSERT INTO blocks VALUES(223665,X'37a54c0b173de574762d299440ee4e24d8e85075ad32b9d0535e070000000000',189572407,X'1de8f0b497f9553c0ab2aacdeacb278aa4ac0d559a1b1737140eba273b18c42c',1397473881);"
-"INSERT INTO blocks VALUES(225680,X'a47b483be7e6e501ed4fea352da701c9632bf3dd5d21f9d02329531f00000000',994605988,X'678028b245cf04ffc8a0cff7cf8346c4c1a7231080eec329b175ce51131a0ad5',1397893836);"
-"INSERT INTO blocks VALUES(227695,X'3cec51d4b06a87553a9fc96c49fc74f52b36990f68f7d3b2d2670f7d00000000',-732828612,X'd8139e1d92172cc49dbadcc3dfb8ef76b82f7b1cf74cec4800ae4a596c91cdaa',1399114525);"
-"INSERT INTO blocks VALUES(229710,X'e175edadf7312cdf8c9da1143d84f4c8e38a8f3406eacf875f2c197800000000',-1376946719,X'6ad373a0f92626e3fb82b43f88913523c801a01f0b0594e2f6ff548307f27d43',1399197423);"
-"INSERT INTO blocks VALUES(231725,X'92a625da466d4c22fd5c2609e4fb7cb99c30e2e799c26b6bd7fd143a00000000',-635066734,X'4e33f83c36b9671a26102e16076c40ce5157e8866b6f8f0485dbfe78a7256c34',1399200003);"
-"INSERT INTO blocks VALUES(233740,X'a1336cbe907968d19b587521773b8bc47a282be256a2c1f9f035690000000000',-1100205151,X'f9afb09d02483fe5047dab275ad5b8c68ee5d729a119750bd8ec0b96274dae8f',1399204932);"
-"INSERT INTO blocks VALUES(235755,X'7622a8a891a41e5cfc9208c2bedc974d5ba3a8568398903981f5850200000000',-1465376138,X'f9eaf5bf73e1fdf6898d19c4577b98f8663893ef6174fdfdba1b027fd54a57d2',1399220409);"
-"INSERT INTO blocks VALUES(237770,X'f47fe6b179790d065caeafaf01921b88eda01acbf076873db164100000000000',-1310294028,X'6731699f85dbf0a05779b4b66dd670c14dd96a9655257f947828df64b809851c',1399259951);"
-"INSERT INTO blocks VALUES(239785,X'd1d63be7abf7a1bd13ce91f557f73a6bd2f935fe5fe27f0890c9180000000000',-415508783,X'95eb5a703ae38d0ea840ceae7bd3184448bf83aa621b1d4e3dae155d2a81ca02',1399352355);"
-"INSERT INTO blocks VALUES(241800,X'd43f55e442c3314204ad5d01e426ec9b47dd332152b23b4d32cb000000000000',-464175148,X'bc0a90bb501e9e6f0d704f34e51c25db3f1990ee1cf4a86e9d629ccdde743a8a',1399744228);"
-"INSERT INTO blocks VALUES(243815,X'de0ecbd425c63d39c8aff8c3d2bf91d5b3f3c94752286384b0d2030000000000',-724889890,X'090358d310c2617a9c9279aa22b0068fd78ec68230d9e5849a231c63f57fcd8c',1400234683);"
-"INSERT INTO blocks VALUES(245830,X'd7de2c918d28546c6db617f912191fd7267349c6eccae212fbef5a2c00000000',-1859330345,X'0cf22d853bc2153794a358d7fd99b51fdf55e3f09295ed104f44fc60cf4d2b89',1401362372);"
-"INSERT INTO blocks VALUES(247845,X'a271843a9122702479fa2c2a08c42f3157946dc09c669fe9885679d300000000',981758370,X'69693ea4cffa864ff4fbfd91b536658aeb4cd5f2459f4358d1566f55404ce98a',1401419337);"
-"INSERT INTO blocks VALUES(249860,X'7930981e12967ec0d2aa24858d9ee4100fab949cb45b95cf0ac2460600000000',513290361,X'43c179c76fc662a95978dca826b0fb2989ea34f45f3fe862837319db8a36e37b',1401421220);"
-"INSERT INTO blocks VALUES(251875,X'c753fc5850509929fd7f79eef1f4e72fc860908bf3370ef83096490d00000000',1492931527,X'c0ec60ccbcec7f1315f44c0ef8ca1f3434caa8e9964da27262b9091a661267ef',1401425544);"
-"INSERT INTO blocks VALUES(253890,X'a58d452b90bc2a11fddeb9464d7390a6e3e4838c4064e1501430b60000000000',725978533,X'64f1c22691fc17bfd4f62a3d576350b0789706d54ec5925f0c0fd251e2d06e5d',1401436975);"
-"INSERT INTO blocks VALUES(255905,X'305a75d0ee81a3812a7ae53c3158c08d6beb87b614af155379b8ce0000000000',-797615568,X'109eb79d7cf7cb818702337e830a791f7569daa5247c3b6710e81dc29599649b',1401458627);"
-"INSERT INTO blocks VALUES(257920,X'ac8a654cb40214de0422886a49be35495f810547879aed42a54f390000000000',1281723052,X'd9be623c627b5bc33dff74df55714349d4918ab7e7db23c6d8ec65987d8117ff',1401519372);"
-"INSERT INTO blocks VALUES(259935,X'd2eab3f12ef43a0ba97dd4159c5948efcd198e30d8dfcf2d019e010000000000',-239867182,X'661989a1bf8d1b4f42ed0dd788c68cbe04d0c83321b6fdd3a4035ac966af6b5c',1401790207);"
-"INSERT INTO blocks VALUES(261950,X'9206c89a7cdb0389da269347ce9b8d64ba3406ca41233431aab2030000000000',-1698167150,X'a35fdbea1f09424837f3786b9fe6857e6b57e103a8d146ff43d0c4a2198901b8',1402472136);"
-"INSERT INTO blocks VALUES(263965,X'f84699c675600b26d3ef15307134599f8715002a4239caad26a90a2d00000000',-963033352,X'741b91db9a0826ae083b0e75b0e667c54bbc739d7304b966bfadfec4833796f8',1403371633);"
-"INSERT INTO blocks VALUES(265980,X'462e0cb37a0f9ded6da4928b042271196d00033a77edbdb9aa71e39200000000',-1291047354,X'8befa3ead9a7c2dd48d6aa5f68a1ab11de5a631154e44de91829fd5643ff4b90',1404227350);"
-"INSERT INTO blocks VALUES(267995,X'd2d1fe91058871db9e5018852376aae01bbd1301208add86121e010000000000',-1845571118,X'98b737c96a5bda3e1eb32af6426be09d2d1ddbfaf4fdb434bb1fd024dc352e73',1404952471);"
-"INSERT INTO blocks VALUES(270010,X'ae2e9116c0bb40a0c5b57cebb60afb644f480949bf653edbd93a375200000000',378613422,X'da585f3c03ea1943d8be8cdd2fb356471eda703acc4843263d479e415264d8db',1405814787);"
-"INSERT INTO blocks VALUES(272025,X'0a813ce6a45f086dbffa1896b018aceb0f548472aa0910f1d1b4858400000000',-432242422,X'31142e0e9ddca21469ea6ee47a1cf444c6410f6bc0b7c71ba51e04694e467222',1407249429);"
-"INSERT INTO blocks VALUES(274040,X'bf8676fc636300f279bbc68f4c15a5302960c72106c5d11edab40f4600000000',-59341121,X'c9c91b9ab75da5bab054de63002dd28554c115a5ea785ea88ec435d0bc90c505',1407858198);"
-"INSERT INTO blocks VALUES(276055,X'b420bea1d45da8d40ffacbc10aa43f37d2ad7ca78defc94a4909288a00000000',-1581375308,X'9e964cb815c4514dfe0bf54041271ce8937159e95e961e313241ed0e155be895',1408461187);"
-"INSERT INTO blocks VALUES(278070,X'5502230ee6afd569880f6f1b93f7a110053a45e49eac877b2c1e000000000000',237175381,X'd210787151424752ae2c78ec9ca7a2b92b01e92198b6415463f9891ecdd45cb1',1409456388);"
-"INSERT INTO blocks VALUES(280085,X'5b5f26d4d04dd56a5b81d789e69f20280bc3c7802d7341205bac807600000000',-735682725,X'04d58ddb7ee50a6d6e9f0bda09668db2ba8e8266098324634883d872f1b35d2e',1410671459);"
-"INSERT INTO blocks VALUES(282100,X'fc8bf340e5e8923b160f65d3da706a684985103fe6d04d56fcaf57e600000000',1089702908,X'6a74c116dfd7f999df1ca568ea7d81a6617837fb8b9579e4d202b34fe255470b',1412113073);"
-"INSERT INTO blocks VALUES(284115,X'bf4546d681e39432051b4b28737d990e3f053cd6b0ba7d6a41b09fb100000000',-700037697,X'8917d5f8fedb3cd8e2c70b6d45d1dd0b345dfc785864d0b20f943ac7e6bcd873',1412250220);"
-"INSERT INTO blocks VALUES(286130,X'2cc22ff8d123e43aabeffc233de45a4c80b1fbc2e6315cb95d9aa8a700000000',-131087828,X'c34e02bdbc5adeab7eb4e83e258950da5d0f79dbef1e7052c077e0d80bf11f36',1412265902);"
-"INSERT INTO blocks VALUES(288145,X'84b025e257453c5c3ab06375cdf0f45b353d42402d22819f671c340000000000',-500846460,X'f1fd88cf335bd44561bf489b15e5ce04420d7e2cf51c4d439e3b836ca53984ca',1412279143);"
-"INSERT INTO blocks VALUES(290160,X'4a169124cf6371ccd510736f5b0b3da4dd428cc05908063be20bd80100000000',613488202,X'5486446b1225649f48e9dae8604f90b3ddddbe3f8fe23c9be429195111df57d9',1412299298);"
-"INSERT INTO blocks VALUES(292175,X'7b93667b49e32a9140083ab5521a6a6f1923d1246bdd1baa7361d50000000000',2070319995,X'3876583983a4f96f86a05fced03b1d0cef7f0ade72fa8eac41e4c518b3f85f96',1412326123);"
-"INSERT INTO blocks VALUES(294190,X'2a3b4fb432167eccae00ff653dd15c68801579931ab02b5459453d0000000000',-1269875926,X'dfcee3aaf32c8c29d65ab3bf3fa169eb30e476ef3f2f0856c87423f17a8a8780',1412363721);"
-"INSERT INTO blocks VALUES(296205,X'61a229ba68940759be46043966bb6cf136f69c2d4aec272fd9fd0a0000000000',-1171676575,X'1242e7a0624c5ecb9256bb63723499272d551aa67033229c0af2ea37c0b85891',1412399513);"
-"INSERT INTO blocks VALUES(298220,X'5ac64311c5184f1bda7b175472516ad9ad4cf68123fe5201447f020000000000',289654362,X'dc81605e43c8572af0b25da81d6e290be117d29e7e552f4b2fea3880063c5d2b',1412573751);"
-"INSERT INTO blocks VALUES(300235,X'b608b842a14cadcfc1f8a72b779fe84e60deb1bdb6bfe4f06287000000000000',1119357110,X'0d1c5c1d7c097411910f748a6cfda2fdbc23458f852ae9d1a9b2a82f0f84d6e9',1412927353);"
-"INSERT INTO blocks VALUES(302250,X'0698dec3a7e9c686c4f389bd3f7f2622f675948929132b4a5e1b000000000000',-1008822266,X'782e914d41e899deb7c8de866ad5fc63ccceab0eb0da85a7f0de684673c5e62e',1413722111);"
-"INSERT INTO blocks VALUES(304265,X'20202acb51ab30d71d1faaf8bb20b4c9d9c64e0148569c043704000000000000',-886431712,X'ccd9707d4df0b0ccc071f015759b96e386e815ee75e2547bf727bff587d9842d',1414229270);"
-"INSERT INTO blocks VALUES(306280,X'7cff39ddd2b23b1323c1b5128d3f4528c6bc5288afd566cbef4d5b5600000000',-583401604,X'd0494ddcd05ad89c1bb2bb3b1e6420451ed1bd30dc652591ccc621f98bce09ab',1415040102);"
-"INSERT INTO blocks VALUES(308295,X'1551ff8ddfb05c17402975ffb9188c23191ddb192ab6cb1c6207000000000000',-1912647403,X'1f12a2329366d6e2bb6aca8eb9d5e73d07f900a85d20cf8e9cb0c82e9fc6f8d9',1415954044);"
-"INSERT INTO blocks VALUES(310310,X'aea34529bea083dc374e202f22a05739f19599bd539bf3e5ff64c64300000000',692429742,X'aa1bf3c0db4678a635429bec5e1e14c438d99e92fe8a9bf00fd66a59257bea76',1416813967);"
-"INSERT INTO blocks VALUES(312325,X'a749b7b660cb5411d7f10be325214fa52a9988b71136144f5afe428f00000000',-1229502041,X'b5f10fcd347dff6af35ce1776f8e1fc4008bc3267ebf929e32d97c06495914e8',1417665941);"
-"INSERT INTO blocks VALUES(314340,X'649e57ca84dea03753be4785c3b61af0010d0222ad2899432416e61700000000',-900227484,X'dc003b09966780d1fab53fe7db083efca7dae211f21039ecc0997f84b621e430',1418650918);"
-"INSERT INTO blocks VALUES(316355,X'0edf04bc713e0f6a15c25351563748cde3f19d2f36bd45e66bf3e5ce00000000',-1140531442,X'2a7a8070da371030c83d7e4a7ed0f3330b39c1a9c8ac2133a271ffa5d031d294',1420196313);"
-"INSERT INTO blocks VALUES(318370,X'a6c139ae8f4e48d16aa9fb1314102911412ae6a0c4d4a1c4c1685a7f00000000',-1371946586,X'9f8c7d923e59816e69863c23fafc6cf2b135ff8819defdec6637d9952d96f0da',1421285985);"
-"INSERT INTO blocks VALUES(320385,X'a46ceef3c4449ecdb9bd1d274482804756f586e7cac79bf10b01000000000000',-202478428,X'993c4e4439df6e0c7644cd77a35c1293120ab4b0719a0c57fbcce8af2ee43ee5',1422622246);"
-"INSERT INTO blocks VALUES(322400,X'fa3f006c87f9f0ca30e8fc3b96f62ec85d444dd3787acf7202aaca8800000000',1811955706,X'01ab7332ed2ce40aeafd334406438b51f656ad21b91f6a24649a118112306562',1423377550);"
-"INSERT INTO blocks VALUES(324415,X'b6fb87ff866a000e49b5b5744ac2512d9d1aa72654a05695646a2fcd00000000',-7865418,X'd3ace45a120968272b836ed3fd749d85f8ffe64f2c82a2d6b2f5d2e5d9dc87db',1425155139);"
-"INSERT INTO blocks VALUES(326430,X'a81ba2de24258e2ef87941bdd36a1a2e892a509827e3f0b59805000000000000',-559801432,X'3b785fb1aeef17bd8f248608804af319f0fd6e7c044a1c8afae31e66e0387556',1425943856);"
-"INSERT INTO blocks VALUES(328445,X'cab5926a53ce945d32e20e077765d03e9cccf69292a7debd6e56009500000000',1787999690,X'11bbc27cf1edfb62247ede2ddb8176f2079dfb1c8be1649ff0c5f6503dc1cccf',1426973095);"
-"INSERT INTO blocks VALUES(330460,X'd9065381aab0678d4cd7ff4aa88a1422727327d7951c2120189db3dd00000000',-2125265191,X'28e5227bd77e7bb40180ff82365c1751be52245d43b22841b81f5149fa183128',1428738450);"
-"INSERT INTO blocks VALUES(332475,X'73b9b07abe272e40752b1f3d7f079e231ac6d1499a3ac2b3d1dd1e0100000000',2058402163,X'75906b4dbd9af6006050c8b256ca4b254e23f0297639ebb1e9a64e7de56ee739',1428935847);"
-"INSERT INTO blocks VALUES(334490,X'e84db2b9fe848c99b995bc94c39b58106ec9c944e5eed4f1ce3ca50300000000',-1179496984,X'4885ee20fb805051073650ff18a8e51b53e13719a222279377208e184dc3f3c2',1428944714);"
-"INSERT INTO blocks VALUES(336505,X'e60ded9cf12ff01e6356998328126a4c08f18a4eff9c11e00989250300000000',-1662186010,X'80381dbaeb82f233832478f7057ba32e4d9b5362a803f1308875a5f786551650',1428952953);"
-"INSERT INTO blocks VALUES(338520,X'e6545eb7e8569e1caff7b7c1690c00a14e1ba3acb69ca1776f33500000000000',-1218554650,X'd78986af09cbb76449bc96780bfa06a08baf54b2b350f51d6bf910022ffd1e7e',1428965375);"
-"INSERT INTO blocks VALUES(340535,X'c164657e8936667fe88168516a3662951fc2ccb8d2dd0f257993a50000000000',2120574145,X'4f8e27831c7b9d0f942c82c4b7def94332083fb5b7e0cde8dc93e3dce742be29',1428972159);"
-"INSERT INTO blocks VALUES(342550,X'e7455e8f5973fa128823e88351f534dd69c5514b18f6f6aa0c8e080000000000',-1889647129,X'32a4ff4b7f1d9297fb9fecc1858ad71a1f75a5763e376413b0a72968d545776e',1428979372);"
-"INSERT INTO blocks VALUES(344565,X'3be09a0ce9754ed042725a6157aab566378feb5f3da8d19897ab090000000000',211476539,X'2d277c258a1cec69ae839d0c1e0d96446472230ae22d142bd59643cf383c3dc6',1428987532);"
-"INSERT INTO blocks VALUES(346580,X'14eb622ee7850df1774bf612d4fcc2910d4a6003daee0b4d8d1a030000000000',778234644,X'6b76fb0d57895698ac754a573465d920a0bdd5fa1439aaba0fcb21e4eeaf29cd',1429003109);"
-"INSERT INTO blocks VALUES(348595,X'f5dd7c8a925414a1b1311dd053726f0bd52f8aa8a4bea432391b5d3200000000',-1971528203,X'2f982cf3b2d75beff52ea2d3e54b9738ed557ab8f3c4e5db9abba0010aaad339',1429079778);"
-"INSERT INTO blocks VALUES(350610,X'f7e0f39bd61c55e555476ad018f99f023c98a36d2016f580a92fa31700000000',-1678515977,X'4bfdd0d68067046494e8f3eeefb352132ec63f6f605c76dae09c2344f37ff644',1429858600);"
-"INSERT INTO blocks VALUES(352625,X'b1b122f5ae21f019392e0d030b16fd83dfc5dd41bdc579c4daff9e7700000000',-182275663,X'ff057dd313a9b6bb7bd44311097bafa88468d1b55f29047d17a980a1ed5b7fc9',1429983294);"
-"INSERT INTO blocks VALUES(354640,X'831cb2644a2464a7aec59476e751826e6710ab459455d47a2635232b00000000',1689394307,X'183a7b37a7df48026974a99c99a179595f964fb9c3841996706fe1328cbd6e3e',1429985050);"
-"INSERT INTO blocks VALUES(356655,X'e80ac511e85ddba15b8dd66ee38d7b259b42479c4534bd9d573b4d0600000000',298126056,X'2a777fb6227781a0fe3a44312fe4577fc7e48542d5dc8f223e40796c38959a23',1429988853);"
-"INSERT INTO blocks VALUES(358670,X'7ba047e7a1ce7344771fe920e5d57cf1608d5d9a2eee4ba93020dd0000000000',-414736261,X'64e296bace28182e9f8df40c414eccb58c9926743ea1ef4daed22a02b0f393bf',1429996042);"
-"INSERT INTO blocks VALUES(360685,X'681bdbff8d6dc91c5b719318797bb6bb77ae66dc89be31a0faa7870000000000',-2417816,X'5ee37abe76b6e202060284c6c53c90ed8972fda3d45a8f2495dd2143b8c003b0',1430015206);"
-"INSERT INTO blocks VALUES(362700,X'bb79fe9f10ed2c90a390ccc2f3cb757f365bb0d2f8781f98fa9a673e00000000',-1610712645,X'bd5ac12335498c007202d403fd142298006376868cf3f01121a903c8a1731de2',1430019532);"
-"INSERT INTO blocks VALUES(364715,X'29eba2650c7b2f3536b2c4f8a69c4fc3973d8482563329c72538bd0f00000000',1705175849,X'dd60998a479444d997c84d86e5c20fba3a124990963532e87446c388871ea6a5',1430023861);"
-"INSERT INTO blocks VALUES(366730,X'6f84cb374b5f0aa9f10e2913f21b88ffac43165067b20308afae760200000000',936084591,X'2f6a5599a1e91e63fd433b2b758ef29256d678656378853545df0e5a27d0eb61',1430030053);"
-"INSERT INTO blocks VALUES(368745,X'c11759f8ef37fb9ae66b840527779396652997155f4595577a5ba20000000000',-128378943,X'139421bd507a3505cd1183c0c029705a28e6dd599ddc9bab9ed80e995d245e5f',1430049631);"
-"INSERT INTO blocks VALUES(370760,X'372e3d5940d677c91fc284eab2939d7367090ec910ff914f9e01ea2200000000',1497181751,X'b8082629119c387f341a0ee221465073ea39443ea74d46338e9b62408ebce253',1430088502);"
-"INSERT INTO blocks VALUES(372775,X'e1c8338f8dd97c246c2b17eb7bb9a257ac3d2626accfb006ee1b0c0000000000',-1892431647,X'1e7fdea917dc2d1bb210d35aaf8f168f85b26c9f2829bcc1fe4251a7f2dbf11f',1430097936);"
-"INSERT INTO blocks VALUES(374790,X'f0bab347503bbcdd4a7cf839e6affbf6ae97f14929dd3d8b25349ae200000000',1202961136,X'90e9cd4144aed512f07e35789ee5aad27d7817d0e8c638bc94dc21f72f092590',1430278152);"
-"INSERT INTO blocks VALUES(376805,X'c4e888cc0a0448b58418592ab272aa35f02120ec4a89f34912ccdd2f00000000',-863442748,X'731374edc34974d7740bf01fed7da25843f77a4d74026599ebe766e805a56cb9',1430468908);"
-"INSERT INTO blocks VALUES(378820,X'956bd4c410f93f1ff5532fbc6a38f5e9803c8fcacee7b3d0240d2d2e00000000',-992711787,X'a35a200f6ab733a9c5f43f593bb2342a9cdf51d6b635dd1c5ab13f0b76d1e2e2',1430482894);"
-"INSERT INTO blocks VALUES(380835,X'31139be7d076fb1f037b427d4be19023330d706e41c82bc936bde10b00000000',-409267407,X'51c14c2012c5a75545acf6f48e1bf76b87bed7e7e01e95450ca0fb6a2a0c285c',1430483336);"
-"INSERT INTO blocks VALUES(382850,X'37551627d21beddeecb9d0c683bee61785d8b395f6c755cfe95eca0200000000',655775031,X'3fe4adaab626615face2b8d082232598a394f9190006fb89a48abafaa1376994',1430487772);"
-"INSERT INTO blocks VALUES(384865,X'4545e61226b9a64088415bf20589273256422139d7541366c06d7a0000000000',317080901,X'ab842a5433d27cfab587cb866038762014d04a70530465408ee46e4595dc6203',1430491940);"
-"INSERT INTO blocks VALUES(386880,X'5e701985625784192e3cf5f0935777b18a17625b6bff0daa8cba0f0000000000',-2061930402,X'6f635a3712304d15ff1ba534fac605e2ccd734b70856d6ca66bed1d77f9e2d28',1430497887);"
-"INSERT INTO blocks VALUES(388895,X'1dac43d5d4b72f7bb4e85a4bedb4c6b85e67439c5f0fdfaf59070d0000000000',-716985315,X'3967440bd6aac9180904036aa46f35e5007db11f95ac4a1d69461f04ad51d8f9',1430517538);"
-"INSERT INTO blocks VALUES(390910,X'd0abe308fda348765a20c5665e6bb878f87a6039befbfc40a43a000000000000',149138384,X'433cdcef17e586cba630cba6122e1aeb96fc2b1e0533b3cd2cf15c75031047ae',1430586493);"
-"INSERT INTO blocks VALUES(392925,X'2075b4e752d797e9b1d7dc1fa09b89f42e56ffac17ad8a1ece6fadf900000000',-407603936,X'a951e658e82fd8ed0d2a3e5c1b6af6b8ab00d32726e7a9d5c58749f8a9f034ce',1430766555);"
-"INSERT INTO blocks VALUES(394940,X'0f24c2ef565d0bbfc9d5b9b4d3d02b98ca3dc3519f44eb2627843f9800000000',-272489457,X'238ebb91a54bb5b3f4432787e82496e272ce3ffc1cb84904294a48182bb4446f',1431101489);"
-"INSERT INTO blocks VALUES(396955,X'4dd38bc8abb5d1b0f6376c26773ca781d1e32bb9d3d05ab53302000000000000',-930360499,X'd0dd215f362a81bde344b8fcf3df5d6e32e341856cc5d14b5b4314a6756e353e',1431705654);"
-"INSERT INTO blocks VALUES(398970,X'166f88ffee202a4a6047cac49f7893f68e2bd01a6a4aca4328f1922f00000000',-7835882,X'cf1e2b9cd2cb169d813a39a010547ac0e26ed953fcb32595927fa6fd31ded602',1431796730);"
-"INSERT INTO blocks VALUES(400985,X'8fac8508193e2ffe73c2df52b25c13bccd3e65510a2c3b5ff43ca60600000000',142978191,X'cdcb60e295079b77bca1a35a601514b6930843da1ed4f8749c85a0dfab5f8d2a',1431812218);"
-"INSERT INTO blocks VALUES(403000,X'a07ea02487c4f9d82214f58fb3e1e03e70725b22327f46607dff170100000000',614497952,X'f2136f6067c13eb749bb5a34a290bcb6a5280ab0ba68da5776cef2e26068a541',1431818586);"
-"INSERT INTO blocks VALUES(405015,X'337082240a9a31d23ac52a1dcd89474a027ef23c9ea997f190b9110000000000',612528179,X'4783ae5b5d5c00f91ea1cd424c9133f71033638366141a017a8633973a1fa6ec',1431861361);"
-"INSERT INTO blocks VALUES(407030,X'c96d02a49d6982c8e19e320ee279c8ef3d848abcb13f9b9e94fd880000000000',-1543344695,X'111b0de893cb94ac8901c818b4f304733a81449060bb6d25fe4978c47814dfd9',1431900599);"
-"INSERT INTO blocks VALUES(409045,X'd2881f13649486240edcf3bfd483d76a0400221d3e3c3a7a9335380e00000000',320833746,X'08d7eacc2ba6e579a6b321968040f3d2c3bd7f9da3be55f96dbe05b918f335f5',1432016263);"
-"INSERT INTO blocks VALUES(411060,X'909e842f479d2bbb4f1373efa0226c2a9212560ad357bee005cc86ec00000000',797220496,X'c43e0e32024df657318c4cf1bbbc21fb5b8c96c3c8e800d602e33926b5ff5021',1432203331);"
-"INSERT INTO blocks VALUES(413075,X'f46b81ccacffe0955a4300828a6f04fa7eddd3abd7cc46043186b21100000000',-863933452,X'2348fb31f7104efa8e27fabe9cdbbdb3c9d9b8a86b49a09bf7f37f500967c5fc',1432212466);"
-"INSERT INTO blocks VALUES(415090,X'e7877d19b8fe7ab8cb23a80aca38da642872575819066b119cf2130700000000',427657191,X'd811063c512bad427d52507aeda74c3e134602a5dfc33d341c6032121f94f30c',1432215436);"
-"INSERT INTO blocks VALUES(417105,X'92ac6bfd43185c07d5f358191e94335ff9240972d2bcc7d818072f0100000000',-43275118,X'78b528550fca530ac0b47cb61a59fb00b9bd0c5b7d37c44de7dd2ada1a17d48b',1432224232);"
-"INSERT INTO blocks VALUES(419120,X'2a93181116f51ff17928cd6a32d81cf3cddfe4651943cc53b142550000000000',286823210,X'e05ea2b2876d608ff7e30ab4229eb77b0d6980795cba6c6c33c1164b2980787d',1432251229);"
-"INSERT INTO blocks VALUES(421135,X'43e94e098deb9b78938e88afed2358ca2e0a8f67a7fb05590619b63e00000000',156166467,X'f4452d095b4aac367c63c07d01826a46716c0e32d09bcc1394be6d853c4c72c7',1432254708);"
-"INSERT INTO blocks VALUES(423150,X'6afe4b11c0d2c0600533f658fd8fd731ce1716f0b9f2c4d9ec5d3e0600000000',290193002,X'b9cf476953e70b902e51274ec09c39b521b9600388d8f8716d1c86dc87e43bad',1432257431);"
-"INSERT INTO blocks VALUES(425165,X'b296dfe10af15fe1cb59971ef12e5c466db9a42ef9efd448a25def0200000000',-505440590,X'5e3687b6bb2886f8badaf27ab8ec947d8a3f99b036680e3d777f58a429724318',1432266442);"
-"INSERT INTO blocks VALUES(427180,X'c13ee336d31fb4cc063d864ce43e79b9428d3ec2fe11b860c866070000000000',920862401,X'587b010d7d239c8dfc28f670eddb6ab7628641213cc73a65dc8f453f32cae457',1432290170);"
-"INSERT INTO blocks VALUES(429195,X'2f1fd3fc1af067461dfcbe294509085ce005340638ab7d9ea7d3170000000000',-53272785,X'd18c545b4c360fe10138e0565058e63678c225e29fc29ab95365e7c4f9b061e0',1432297126);"
-"INSERT INTO blocks VALUES(431210,X'7632f7cb3e700d25fd4b792779235e32391d1192a1560c407edc4c0500000000',-872992138,X'ec263c0061a7732047bbdc36e122c226d0992c895f3a518e084f80c80fe36c06',1432299855);"
-"INSERT INTO blocks VALUES(433225,X'73831b45b66678a316f35e5f31d574614ed42ec2aad47173b275250300000000',1159431027,X'8e49722fd13a512990676a0ba0e4f1c8bc9f185a9ef9e42cae26e1fa9b936f73',1432303251);"
-"INSERT INTO blocks VALUES(435240,X'274bf30de4f47eab76b5c7f5e1be321ee743d509a6d0daaabf8be00100000000',234048295,X'b16e779479705c94dd085858a90da3a4170f16eb8a86843eb2a53bcf4a894c80',1432306311);"
-"INSERT INTO blocks VALUES(437255,X'5983cc3a9cedce80f3f57455c328d5670613e09c45f9d4c69906ee0000000000',986481497,X'494da4becb96c5cb7b9a4df9f0e2608317144994b6a79496d2e54dcf9ea1910b',1432310823);"
-"INSERT INTO blocks VALUES(439270,X'c4f89094bacd0c733571741f03ec74184c7f9b346ec1ef4931d3280000000000',-1802438460,X'cea83987bbdba17cb6d2ba43974c77a9155382d503bf10a656bf1885d231c38d',1432317635);"
-"INSERT INTO blocks VALUES(441285,X'f97642dc37d12b56386a5b27f04860017b1ec7b98b06847a17dd080000000000',-599623943,X'63a23c9eb6866adbedc4072f049f51b4000eeee60e10f44d06cf6f792a1b6b2e',1432341318);"
-"INSERT INTO blocks VALUES(443300,X'e61d23d766eafac1b9fd1929fd3bec6a0dc681e83598137db402030000000000',-685564442,X'016fca8ed6f28cac097ec45d96eb1d2c0645370f0d706bf4582288c97934da0e',1432523197);"
-"INSERT INTO blocks VALUES(445315,X'7781ad3ce5a2a6cccbe58c3e6d462a1e1f1e8e911827e3f91ee1000000000000',1018003831,X'c66451c83c49c7f4b057b266eb2483f7669408f19c43a0040e191363229b2658',1432669688);"
-"INSERT INTO blocks VALUES(447330,X'126a4a8154cf67bf8ead554f9aa6d49a7b339b401ccc39833730000000000000',-2125829614,X'd933716a6d573101a54e47916653e842b69d1f96c05d0013ce532ac7ed3e0bfd',1433756529);"
-"INSERT INTO blocks VALUES(449345,X'43a535cfc4d5c608ff3ca5919f3be7816c02279a5d737e79fe34ebb700000000',-818567869,X'b798020b964f88237b8f12c3c6c63d969c13d940749a34d1b240cd442d41ffc9',1433810603);"
-"INSERT INTO blocks VALUES(451360,X'774a6c15f6d8850179da6e8bcbc38da0bf0446ebddb3be855702313500000000',359418487,X'1b672cff8ece426a4170c726c196a7579d2c4cc844d3c256995c09bcf41dfe0c',1433813792);"
-"INSERT INTO blocks VALUES(453375,X'7619db04c0f3102c5fc9159620b38fc5190ada8f972426e474d4420e00000000',81467766,X'9502a7accf2274afd8c1f46be11af9566c79bd281cb0fd3d06fe3e79851ace04',1433816577);"
-"INSERT INTO blocks VALUES(455390,X'aaf5afbf9c2f0899ed0cdc63e7c4a19893ea36a708ea4e9861fe340000000000',-1078987350,X'468aec68bd4ce6d20367e1c97b944921bd71418aa4ea316aaee9f8ca37159fbb',1433820108);"
-"INSERT INTO blocks VALUES(457405,X'b698957ca18326a236ed711caf18d31e8fde0bed47ea058ca668430000000000',2090178742,X'226c032769486e2af752719bb0f201ab5226eb9c20f5d97ad45206aa6e6e718d',1433825049);"
-"INSERT INTO blocks VALUES(459420,X'a8fd252816c4f3e987a2080a181b0d841cddfd8c92e2b96ea86c1d0000000000',673578408,X'ecc919c8b55b9a7cd41706f2ea16f33bf40d35189382dae9af97b6e474c25308',1433834117);"
-"INSERT INTO blocks VALUES(461435,X'eaf2c9eb1a1104143702b8dcf62fa6207c5c828851a1e66df9fd0b0000000000',-339086614,X'a13fecbf6f605b42dd38c48c5a4d3035d90dc174cd157b938ae88e8d7995dad6',1433856499);"
-"INSERT INTO blocks VALUES(463450,X'43223bcfa953b7c702e267393deeb4bf5a2ffe8f79820458550ae80100000000',-818208189,X'c18f59e4a6ecf2e43445fc61db5810950da37f0c6e3706398a23979e8bd57bc3',1433981968);"
-"INSERT INTO blocks VALUES(465465,X'dbf3c73123ac3c6552589e781e03253e7956bdd75cb97aace37c000000000000',835187675,X'65a8a2da5f4d8ccb93639bedeb06ebcfc69f26470c59f4ecae344e5f0c422aa6',1434127055);"
-"INSERT INTO blocks VALUES(467480,X'60d8e992501faa9ece2781b7945419e6a5612a4eaf9628c2ba11000000000000',-1830168480,X'd151b60c523f5f59b627e3ff9b915f0f8ffea28065bd27f0f3a4305f75b9d4cb',1434442208);"
-"INSERT INTO blocks VALUES(469495,X'8383f22275bf5237493b9a5097944da0acfc0e1bfd8356422083861000000000',586318723,X'aaa98218d878ed632765ff7f37075d3a1b8193658bbcb9296594ec06ff942b3a',1434477946);"
-"INSERT INTO blocks VALUES(471510,X'26f4be314d39e2b9bad0ded978a81db9cdf479f46d3ba6adfcdebb0000000000',834597926,X'11d838e0bd48229f9be09308f181c779c37502212625c1a586f7a2920438a7c2',1434480328);"
-"INSERT INTO blocks VALUES(473525,X'4a3c7c465cfd3d1fe47fca24f40f49937e6f08ef0ec44cc67dc6410200000000',1182547018,X'f14f538a5c8fe41bc96d40ad8f7f85fd1e164ddb1d1281f0ca0d3e9e3828bbe4',1434483087);"
-"INSERT INTO blocks VALUES(475540,X'a71dc004dfabb866481f2e0f71038b582caf2da2d45b86e39e545b0000000000',79699367,X'988ece3b3cff938643ef7c4e0dab7d707c52e54c9ab478d4adad0a8520b8ec1b',1434487052);"
-"INSERT INTO blocks VALUES(477555,X'0347577d1af93851a84b9412bd5f1efbc7dd3848add3e56eea9e310000000000',2102871811,X'ad79bda36ecf560a0878500437f6bdaf271e58c430e7101b79bafc5180dceb60',1434492972);"
-"INSERT INTO blocks VALUES(479570,X'5be1faf9b18ceff342860fedd8691e42edf2b67a4e9e033d5319100000000000',-100998821,X'819be85b153b0e4a907ac66dba89847de55432e461b6ca6924e8a72b361492c5',1434507927);"
-"INSERT INTO blocks VALUES(481585,X'7a20e0773e4be162206a96ceb44745931e3708a98c3c737e9630000000000000',2011177082,X'457b9adec8039739a6b1a21da7e4f1f1cc23ea899eb5a4ae1f5b35a0234ddaca',1434545620);"
-"INSERT INTO blocks VALUES(483600,X'cae3cf5f968bf34b099f5dce02cca5e009afc205b69ce1f0e81d000000000000',1607459786,X'382a8ada6af4693045a715026ab3833c740877111865502977327c5be8cec630',1434732925);"
-"INSERT INTO blocks VALUES(485615,X'99962f8a546c37464e228bfc3ad1b620c41d2ae7fceb9fc670708a0000000000',-1976592743,X'b5ff8e089d198e503f62b623cff3f878a3a1da1b0607b8b09e7293c6906a6823',1435355923);"
-"INSERT INTO blocks VALUES(487630,X'5ad379b2817e49585b8a14e3cf7e562e798ed00340cf0051f005000000000000',-1300638886,X'b9b0ab566c19924669097f10aeb2f1a738aca8c4c7f9a06619c2f68891f1657f',1435962334);"
-"INSERT INTO blocks VALUES(489645,X'ebed3c1f133996ae788b860a3b41fc8767514ee753e8051a621fb76500000000',524086763,X'2e6585294433d63e47ccedea2c3f472a96a178d7111f849107453aafd2bf55d5',1436209361);"
-"INSERT INTO blocks VALUES(491660,X'e2587718ba0cd8c27602a83695d459ce1762849286b1201aff5b2d1700000000',410474722,X'8fd3a2e210d25520171790630be2d2c506c304942d0f3d50b3f4b47aef8f9bed',1436212432);"
-"INSERT INTO blocks VALUES(493675,X'b2528da79773c24a1cef6114203aba52b01988c34c7748fb01f6f30700000000',-1483910478,X'8454f25c2c24e7c01716283ff239b153d6dfff3289eab4cf4890a022c83fcace',1436216040);"
-"INSERT INTO blocks VALUES(495690,X'5329b06d8302dd326175287e05e23c95df0a038044f2a5375b73ad0200000000',1840261459,X'5cd0c2df5e3fcce1ce23a103e541a8580bfac17a074efd10fa63c5d2f0329583',1436222488);"
-"INSERT INTO blocks VALUES(497705,X'f89023cff82576bae12a4bab0495ccaac1a1c37656d1e8f2fde5710000000000',-819752712,X'1e70431b33df4180c937a59b5df0263c5ca4a7b3d208032ddf0f2435c8de00a6',1436268337);"
-"INSERT INTO blocks VALUES(499720,X'7250091f4157a001d14303065d01c004ba4c161d559a19adc4e8190000000000',520704114,X'1afb8afa30fc7df4b97814206421a78006b63981f0bd08a8303bdc35a802a3fb',1436456095);"
-"INSERT INTO blocks VALUES(501735,X'9d4a8eb6bec0fcf3e28b8cec72d06f1b2d1aaa569c117a161882030000000000',-1232188771,X'8b2471efa76fb60a7aa614dbf0def4dd7ed404ba09c3eb832342b8318e22472b',1436678849);"
-"INSERT INTO blocks VALUES(503750,X'28d45f545900e98460956501356f92ccc281f27dad96685a9644020000000000',1415566376,X'ea183b3963fb12c5f352471984651ae9c9cd9aff45318d9ac3aa90cfac0280c9',1436940473);"
-"INSERT INTO blocks VALUES(505765,X'76f5e6d1a257b534ce0208fb5a705a5f511a1716aa51f4f05f3d000000000000',-773393034,X'd16f585be9e5d3041b3db1f3c1b2df5da7c37a4f3993f759ee864535b7d014c9',1437126835);"
-"INSERT INTO blocks VALUES(507780,X'132982ddcd5a209e80f1f060741bbf3f972be8be6a1b46f91d23000000000000',-578672365,X'774cb5d78911e35405ca9308119a23f95dd3b1f08b4088b7af79951a09897101',1437453449);"
-"INSERT INTO blocks VALUES(509795,X'3953260c3c0bbba317dab810340f2ff645bcb6c4c68c65b19ed5130200000000',203838265,X'e2ba6bd3ddaf86fae8ff030c6fb697afd9fccddcd4114d6bcbf03a02cec814a4',1438317166);"
-"INSERT INTO blocks VALUES(511810,X'254c267e7efffc5bfd4f92723a452c45335805541b65ea20edbb652c00000000',2116439077,X'030d4817316c77788a329776393aa99a049430457eb4265bd962cc1980822124',1438464300);"
-"INSERT INTO blocks VALUES(513825,X'c720a7fbd3b422a54dfa99353710367e667d5eeb3908d3c6416e4c0c00000000',-72933177,X'9e820ba1ad062f206e5d87916e7dc1c36a7e53c1c98441ddcf8420feae5632d9',1438464669);"
-"INSERT INTO blocks VALUES(515840,X'1bebb51a5f6738c31ce9a716a8c47e7a590abb2af7ea30f643b7260000000000',448129819,X'9da692ef7b90888034419a5ee10b700b2b6ef74b0f066454d27322e4ad11bf3e',1438465005);"
-"INSERT INTO blocks VALUES(517855,X'fc238dbac06d16ff660bb6accb23b38904a4a5a5e145e272d036aa0100000000',-1165155332,X'cd22af0832a85200c58a03c8fb4164c797a4ec31de60ff93cd6b09ee0019a4bc',1438481125);"
-"INSERT INTO blocks VALUES(519870,X'41702107ec0327465ed52e92955d0ab3b570c1836adc112b2d05a00000000000',119631937,X'7fa0663dfe7d9f9567e1e498d42d720e7e2fc60ce4a1160a1a76d5e86b7b5daa',1438502371);"
-"INSERT INTO blocks VALUES(521885,X'802e68208835a0c4b5715a54c45d8c1ea29ba6e74b280ca29acc290000000000',543698560,X'309f4c3678d7379714fa76d4189a876e966ab1c95725d376e8fc56268f8ee138',1438530176);"
-"INSERT INTO blocks VALUES(523900,X'2cd781b651d705a8ea8c2fc1db75862a164a7af994cf4666f035020000000000',-1233004756,X'5d0a910cd929ff85c5d6d55dbc22dc6052b96fd69068b4dd6513ed63b755f0bf',1438581687);"
-"INSERT INTO blocks VALUES(525915,X'd0bb0311ffe4d7cda91edfe7887e1acdbffba0c41f06393f3c1a020000000000',285457360,X'7907767af8144686aa49e2817e19acd979b5a2c1db12ecdcb1e117d9ac54f845',1438689443);"
-"INSERT INTO blocks VALUES(527930,X'9380ce2dec73bea58c79942a89752adc6a090df7f5653ba2fb08000000000000',768508051,X'232c62750adf01b82a7b52e3b1a219179b585dba45f00455d8dd30b50ded5317',1438943983);"
-"INSERT INTO blocks VALUES(529945,X'e39e52c6738f9d5ee1f41deabc7c7a82edab2942d800e12e5d0e9d0300000000',-967663901,X'3e6d9954c51019e535240a9a8d6fb54438283c4a77d009a955e865f7c609e312',1439372229);"
-"INSERT INTO blocks VALUES(531960,X'e4144266f3a953d44e153d3de669309a48dd1775fb622cb76902000000000000',1715606756,X'bb4e9094cb938e87e55c8897cbb4c0781cd090bed9fa78c6a272a5ae94d688f4',1440184485);"
-"INSERT INTO blocks VALUES(533975,X'7d624966cad7691cc38d03e6e0598acb9607650cde7c05a866e8010000000000',1716085373,X'618954045b34094c7f796b68cfd559fcfa38f89d26f13da41c2454df8700839e',1440990999);"
-"INSERT INTO blocks VALUES(535990,X'aa84ac9c40d223920039a19c9618d145d02fc9c75c0e2914f39bc95700000000',-1666415446,X'ba62ea3183c5b0cd641416178a42c05f3b1d5279bc33558e688bffdc41c613c4',1441156223);"
-"INSERT INTO blocks VALUES(538005,X'bf45e7849d48004d480308c942a81f14aaece944c70e18b9200b6e0600000000',-2065218113,X'29884016187800ae3dbd1bff3bc91ce368c24570c1e426c5ebe5e5fcca31b67e',1441169191);"
-"INSERT INTO blocks VALUES(540020,X'5ebc10898a03e4ca7deec96226c0a63fe2bc97b37f5f75b9ddfdd40700000000',-1995391906,X'782af263a63a7640765dca655f5f57ed1c2147394ee56663392559a4d1ae8900',1441171733);"
-"INSERT INTO blocks VALUES(542035,X'7bec31ab592ad384a198d4df58c6cb7bf2f9636000f02b621849540000000000',-1422791557,X'6fc1d2348bcbb8755b2cd16407cf003e576e3c171132650e32f2e49875176437',1441174704);"
-"INSERT INTO blocks VALUES(544050,X'ccc10bab92d8b2c9083f3ceac161bb19814c03ce82c90a7cf59f030000000000',-1425292852,X'2b25acf9315e5c8a08a54015ced36e74a21e0700cae8e750c2a28599ed1fa5ae',1441178644);"
-"INSERT INTO blocks VALUES(546065,X'd5ce16ad12f85547b35b75134e5a9f702cb6b880026d020d0781190000000000',-1391014187,X'7853ad27f63ee90993adb0ac3cdf9effa647792fe8de3d04ffe61e0c35760af6',1441182659);"
-"INSERT INTO blocks VALUES(548080,X'1cfe8cc4cb175ca8f6e2ad700c2f62ac33dadded91b745be7fb3060000000000',-997392868,X'0d8cb957a583ac04810f2dd654f5070184be4eaed829eaff15e92cf753559939',1441203964);"
-"INSERT INTO blocks VALUES(550095,X'7c2f32782fd69d00f70fd6d479bc2d5381e26f75efba362a716c000000000000',2016554876,X'29aba57916e9c67b9d605ca41a4116256b92170e3d94325f600c0f3d686b7c39',1441255511);"
-"INSERT INTO blocks VALUES(552110,X'0fa60a6f87a4ce580e9d923c46611d98ad163ee038dbd2363f90000000000000',1862968847,X'5b9ff39e7862f99a11ec5aa52a4719c06d0bc13d0ddd62bfa24a296220946f00',1441404865);"
-"INSERT INTO blocks VALUES(554125,X'53060fdc472e0d53e2c24ae64ac1847100835ba4c60a2869c62e000000000000',-602995117,X'c5b78967bec06cb9ba06b7e8274df0dfe0ffbb2a1a4d4ae6ae5c44b037b4b809',1441724693);"
-"INSERT INTO blocks VALUES(556140,X'0c3999dfdadabd30ff437403b3955af3c4ecdb0fffc63f157a572d0100000000',-543606516,X'b5eccd7e228baab5d0142209e0d846566cc7adc021fdb0f84fa628571c3ea778',1442434631);"
-"INSERT INTO blocks VALUES(558155,X'1637ab57808f5ead91d21d482c18450f45a4b476ad526b357eb6790400000000',1470838550,X'dfecbe44d8ebd6bea28ffa1325cbd07971092c2c44cfcfd6298165d5fc4dfc6c',1442547663);"
-"INSERT INTO blocks VALUES(560170,X'708a4a70cbcb46eae06b78bedb302f5bff7558b31e3851d64813d10400000000',1883933296,X'856acf419ae48f1e27cd00790580107feb503193ecda1cb035fe9a2ef4cf8a5e',1442550168);"
-"INSERT INTO blocks VALUES(562185,X'0784b32f10c6f05741b3a6447f000ab7f56457dc67209968ff9f3d0700000000',800293895,X'eb83b8f024d25b2bd05a46f0e02b404309305ce35013c04fc01e2ad5da8c1f84',1442552771);"
-"INSERT INTO blocks VALUES(564200,X'b1efef6477bea8b47532619a5d02eecd3f6e0877b647e40869bce70100000000',1693446065,X'a832c243214c86fb41fd044a31f8c4732f7ceab688e10b0a6d31f546852441f2',1442556469);"
-"INSERT INTO blocks VALUES(566215,X'17f8314c238b4b7f47f1e1cd46cecceb22f90490c58346990bd4370000000000',1278343191,X'0d42a3bd57cbdfedb4f9aee3f3db71820178754b1186360dbe5266ffda4e958f',1442562413);"
-"INSERT INTO blocks VALUES(568230,X'ad914f48950567a5833118e21eaec9381ae5583d3a875dfd0d1b950400000000',1213174189,X'db3a196cab04987293e66e1e2c4e24cd12a55c41847cf086c5fcd74d38078581',1442574181);"
-"INSERT INTO blocks VALUES(570245,X'5a5f8f598e8ab8411ef63164fd9b243bfea72e0dbc49746dc5b9040000000000',1502568282,X'7a3004e00c3a70083d6821cf88e9d0c8cf104331cb71e5bb733f68b2a38db6c8',1442609239);"
-"INSERT INTO blocks VALUES(572260,X'2d02b87270b8df2783ac22df5bdeb843defa6e20a7548c2a4ade000000000000',1924661805,X'c5b7fbe0a34035c8aa8ebad0c7423d72416e9087a885e3ae2a2ad3f930110d4a',1442715896);"
-"INSERT INTO blocks VALUES(574275,X'38e1061957e5b0c3e84737a005569f102e558c785cd67deca750000000000000',419881272,X'307ccc5905f2deffacf950dd9dee4e52e8c910f5017ef0cbebfe6a4d5cc9f0f5',1443221303);"
-"INSERT INTO blocks VALUES(576290,X'943e93656d7dea2b3c493e136723383f62bdfb35557b872cac09000000000000',1704148628,X'53acba51ee550317e2f4f6d928ded0f1b81b9ceff131c31d2e5a8712d50e4840',1444044846);"
-"INSERT INTO blocks VALUES(578305,X'9247ea5104862e67cbb96e167b4e746ddc617daf07fc0a964d20000000000000',1374308242,X'bfbd6740cb07626e06eab01f68931822b15731fbb2e9b26beb43cec672f98982',1445020269);"
-"INSERT INTO blocks VALUES(580320,X'b6360ac013890c7d047adc1141af3fe5ba4ac13a83855bbae31d000000000000',-1073072458,X'6b97f5bd44acd26c822b87e140033f4c422a0b73ad0f3c08281d479e1732b47a',1445971053);"
-"INSERT INTO blocks VALUES(582335,X'ce4bb1d65de71f962095df7d553c5e52a14dcfbce63e06311317000000000000',-693023794,X'6e58a495f4d8f30a5bd420e2da108b7ad9ae2a356a35befe75873a4848b99f8e',1446402471);"
-"INSERT INTO blocks VALUES(584350,X'6708c7446585d0c9af0a398e0562c6d24185a030ba8c3449ae07000000000000',1153894503,X'b82df85fce5dde2445155882497a491cc7576bf98f35b9750cb08b8c7ad5601a',1447065841);"
-"INSERT INTO blocks VALUES(586365,X'e5db8d12d277ad6db5b19a02523027dee251113cb87da727f8a0590000000000',311286757,X'54913bce0923c0d5f1c188add64803b34a24ee44e0c180e8baf79f3970cd876c',1447139829);"
-"INSERT INTO blocks VALUES(588380,X'59c3e4cf5fe7e1b32a67726a12ac30823161e251fdc28ac0b297350000000000',-807091367,X'743ec9c6d491918389f181ff03d1bf420870866fa83b82d15ae5f25c73bb0048',1447142635);"
-"INSERT INTO blocks VALUES(590395,X'677d4df4845f25f9fa3aa2b347b7a44832cbd7d52b485bde8d1f1a0000000000',-196248217,X'0dcbcd0aa9ab5682ab577b35b4763a545ce456bb66666bef5f197bbaaf6c61d4',1447145501);"
-"INSERT INTO blocks VALUES(592410,X'a5a0b7e8070ad182baf56323ccb3f14395529f02400d3312b158460000000000',-390618971,X'484db4ee0737c10c5b3e4669d2d92d4e34da8b2a714daa937de04de30703bfa8',1447148263);"
-"INSERT INTO blocks VALUES(594425,X'369df6b5b6a5db8db94d18d5836bcb4162b2a002ef1f9de64193500000000000',-1242129098,X'8851ef0efd9f328b326c31f558cf4f460c4ca1b7cf82dcc064a3778821c22817',1447151158);"
-"INSERT INTO blocks VALUES(596440,X'2a9ab300191480d65eb29c4619c3d636535b7b174e9513ca8f9f240000000000',11770410,X'608423c58ed8154b8fcf513f60a68ec8eb6486c4047724cc322032202ca63478',1447155759);"
-"INSERT INTO blocks VALUES(598455,X'e5bf49fd6b369ce7cf3c8804743703450e95e210ce46a54468d6020000000000',-45498395,X'9952d890ef75f23d3a9dc45840c3643717ece20430c95615992f1473ec4440be',1447163836);"
-"INSERT INTO blocks VALUES(600470,X'0f9ad02aaaa03a00d3977fc51c59d9d7c3c728eb4e269f5cb508010000000000',718313999,X'9ceb2958471d35c07a398b7638752db8b4b6a9cd849e70c1de11a34ccf2cbffe',1447191129);"
-"INSERT INTO blocks VALUES(602485,X'f724b176b1a5a2552ababed7e8277b7a6490d6679ec5ecab716f4a0000000000',1991320823,X'7dc4fd4be31ca372b3ffcece4d6de64dfca49db4649994238cc0b1a43ed778c3',1447274313);"
-"INSERT INTO blocks VALUES(604500,X'369837aef0b6242ce015a4efe343fdae331fb251079c595add23000000000000',-1372088266,X'2091fbdbea0f6406c9ddb78b8b56d5c3741751de5f3e4a441a62a55033732568',1447451078);"
-"INSERT INTO blocks VALUES(606515,X'1fb755721a80983fe5323d7d21becfcf87ca0631624ef9f9e4a4730000000000',1918220063,X'321c89baabea3a1f5dd8a5d6db5cffac0ff95047feb5bdf4d460cd336086b932',1448043686);"
-"INSERT INTO blocks VALUES(608530,X'a5671f2f08e651efd3fc9ca3e3b93a5d65eb5374a44185e27b23350000000000',790587301,X'30bede190345d43b4c423da99b993da6fcbd1d12f0ce33868e267959dc75c044',1449213539);"
-"INSERT INTO blocks VALUES(610545,X'09e320a928ef4ce3dc4b7577c2250619c753750dd8e7be8d9880511300000000',-1457462519,X'1d44cd117cbb12454d43c4e6c7c3fca37d9238f5b60cd4669d4dc6473a9edea1',1449481575);"
-"INSERT INTO blocks VALUES(612560,X'4c7fb8b40cb7f726044dc72574546b045f7f7a3f09628606b00cad2800000000',-1262977204,X'f2e118db4e5feab4d5876d189287f50cce07d7f30126f2710b19473c608b86f1',1449484051);"
-"INSERT INTO blocks VALUES(614575,X'c089eef4eb2fa5a3eb3b4e821a14d9e8627f6b63f3169ba43fb86a0c00000000',-185693760,X'1e9cbfcdb8b96fb43c5f7b2bb5558aa48082d9212685bd6ef02ebb33aeb3bacb',1449492124);"
-"INSERT INTO blocks VALUES(616590,X'e2947474a9298600a1782e5200191d4c917982fb3a8e946f340bbb0100000000',1953797346,X'83bbbda2973d371c2468c9fd204427a610ed66ffb9870683cbf45c9a44d01950',1449524143);"
-"INSERT INTO blocks VALUES(618605,X'10e333e221e3737f7e8307c00e8d5d44333a54e5a5383c325c62f30000000000',-499916016,X'5a7f95ef56a7f79a99bd12914fb0e7f69d500e778dc56310c3a0ffc49d1676ff',1449646228);"
-"INSERT INTO blocks VALUES(620620,X'c92a516a609ad1e0f9b6a0dcf1162fe7ead6baa869e37f9d4747210000000000',1783704265,X'58a5e82f6a6d482bbfee668cd0a50756478cda586e8a8dfe6d7efe060c7c16ef',1449649160);"
-"INSERT INTO blocks VALUES(622635,X'13f008b602a93a22b18ab7b1a98427fb92125b961cc7e248e3a6080000000000',-1240928237,X'09e374ac4fd383ec4b5db7e744baa0f6ff6fa2910e7a5a4ab206f268ca10d68f',1449655665);"
-"INSERT INTO blocks VALUES(624650,X'8554907b2a14ad8971cd4ed8744f7ec8f0f2cef551fa5a3b185e030000000000',2073056389,X'bb63f2232380a47c44e3e7f9ec6dfb59db20578574344e6b4a4fcf7fa515c770',1449682283);"
-"INSERT INTO blocks VALUES(626665,X'f2aedc47d0f8a7b39ca4978273dcdb9a4b3933ba19b1d9de363a31fb00000000',1205645042,X'cf47be17c09f42c1ee7f194a17918c7908eb5c073ed9cf0b986a73032d9a1acc',1450319584);"
-"INSERT INTO blocks VALUES(628680,X'bf280d612075ac0a7262ab523f24993fc914d930ca564a788a5b000000000000',1628252351,X'652d6afd692af6bdba7ffe94f725780b08ae7861006bc4dba74bd751528a4041',1451388102);"
-"INSERT INTO blocks VALUES(630695,X'f19c99315d809fd802460db141f89c7387b0f9d484ac9d16945a000000000000',832150769,X'e020318e5a2b4f847a80bc9ce2b954c4639b504116b340484e0f5334e460574f',1451924247);"
-"INSERT INTO blocks VALUES(632710,X'f5193a8300aa2fd6e901d710d673133b68e98e5697e5bb8e9033000000000000',-2093344267,X'f103d6a8beb7ac3ca619f4f148f8c60955e7348c48c7fe77ee7d566e420b7a9a',1452605741);"
-"INSERT INTO blocks VALUES(634725,X'a91be0eecd14a9cb9e1ce7421b9d8ee0b65289be581fcfce53dd5f0000000000',-287302743,X'a9d76414d331f199f5d2b1231cd2d99d934fc827ed745bc2161efbcfd036af06',1453079372);"
-"INSERT INTO blocks VALUES(636740,X'fc27f5f17a6f53da382c574c66034982c3d006e140b34a84a50afa3d00000000',-235591684,X'029ad027c3a1086e6a61effa06cd9d10883a6aceb99e33afd611a2000a53fca5',1453158615);"
-"INSERT INTO blocks VALUES(638755,X'c4ab8b11e3fc602b119305d434456d6248efada280be851e4a9abd0800000000',294366148,X'37a09c7cc11d7a3c0091aca067bf7050fc7b882dd78b60e80fd05090f06839e5',1453176483);"
-"INSERT INTO blocks VALUES(640770,X'f441511197bf753074bdcbba5db4dcb1e8b2ee5a496b5584a977ec0300000000',290537972,X'0cd12e9ef3176c2611dc8ceee50d690955d5a1b82cd047f098387078764d8135',1453200093);"
-"INSERT INTO blocks VALUES(642785,X'a4994e14040639c61b2a2bfecc76784bbc09ed86aac6ee36303f640100000000',340695460,X'feb8035ddc136abf1baeadd144c81666c7e6f692707c1944d4b7051148d15ece',1453225219);"
-"INSERT INTO blocks VALUES(644800,X'5e488e88ae3be24ebdb89c97be0ceb0d8c90072ab0a773ad6b95160000000000',-2003941282,X'14ae2450e771ac727d5849760a328471583d3febdd06fd92e20aaf82f3707e9a',1453261882);"
-"INSERT INTO blocks VALUES(646815,X'ec2650dbeda7a177b399e020c47620734ae8784e14a9c693905b040000000000',-615504148,X'acd68f7c8f5085252cea18b1b60d3fa4441986c404e99523b11ce1c97ce28e66',1453329979);"
-"INSERT INTO blocks VALUES(648830,X'b58564d4460aa93bbca0f966576683df2d598df2d632b7ae277d020000000000',-731609675,X'c0491c57c2fdaa84689a8c564106805240c7ec075599b97ff5403546fb4f5cf5',1453377757);"
-"INSERT INTO blocks VALUES(650845,X'afd4296f23419c5238a027802c7fb53138a22b2c802aae8181e4000000000000',1865012399,X'170f09a0feacbd968c7649407c28f35a51f4330bd7ea8a508b5f793006aad314',1453449911);"
-"INSERT INTO blocks VALUES(652860,X'4afbd32703133bee1d627816abf141c6ab387725d6f5ef89154f1a0000000000',668203850,X'f1da5600113f1018fbeb143f4b33b581e7bdd6d13ac4c8dcd0c3e74d6b716f64',1453723567);"
-"INSERT INTO blocks VALUES(654875,X'fac5c45d8d6b418a2c77001967f7cb560d4a0eff5f3c1aaa0d72024100000000',1573176826,X'18cb573f51378b3dbd5f4d244b111c4581dd2813034cb8c0f4baa7798de50ab5',1453787866);"
-"INSERT INTO blocks VALUES(656890,X'a2b0dc3002ad71281b3787770b670b1c703cc1397198771d4277280000000000',819769506,X'056dadc4e4b049f3f4d2ed124ec3432a62edbbda982576525d38d92a8a713472',1453793337);"
-"INSERT INTO blocks VALUES(658905,X'57a37d85cf78946f380522d66513cf6f3db558a75e61ca46bef7030000000000',-2055363753,X'5d83fdf352076d767b07f16c0f8b1477c8c10d776d816ffe5305abf2a9c86b65',1453799063);"
-"INSERT INTO blocks VALUES(660920,X'd1e78832d3911da95bb7965ae8ca263e3e07cdd8c70b8b0b8bf9430000000000',847833041,X'5d330ce745d18add00c23f29344bbe0001a71035f97ed6c1edc5b87e83db716d',1453804727);"
-"INSERT INTO blocks VALUES(662935,X'b888aa0cec04fbf96882ac95d03ef7c8ed4a90654105b81211031d0000000000',212502712,X'ff9f897a16c70761cae4e3ef3eac2eeb2ccce5f5725b879863b0d803eed928b0',1453812064);"
-"INSERT INTO blocks VALUES(664950,X'9b45ce384bbea6cbe090aa5a57648b0234577a32ebffd258bf1d060000000000',953042331,X'232851359bc4fbce7f65a3f10b8291b646f4e4727a92c7e744963ff67d1be831',1453831877);"
-"INSERT INTO blocks VALUES(666965,X'2a2c97480537976f8916c3b1d875791117e8427887fd74d643227b0000000000',1217866794,X'308d62d0e739021477711daaaa94c4770f53967a03817fc1301df3d631913ea5',1453841207);"
-"INSERT INTO blocks VALUES(668980,X'13bce79747ca592737a6fbe1a54732819a43eaf4c14c28655fc95d0000000000',-1746420717,X'b7475fed0d42f2b8b913b68c7a9659d853ff58461a9381fa82f3e4648fc5adef',1453847301);"
-"INSERT INTO blocks VALUES(670995,X'edf0e491d5107f17ccf6dcaa871a89b4b94c2e8bd21a278ffa7a080000000000',-1847267091,X'7b14b46b5ce2d381f0735d3d6d32c96fa3a1e678bec5037f1a347f8c6f990e3f',1453853246);"
-"INSERT INTO blocks VALUES(673010,X'a03b2cf9fa5f0a9b988d56af962201376230f9879a8f741e3ce3230000000000',-114541664,X'314dc4ba3dcef1a0920104971db52f656c32feb0e0f1d9427b20cc4e4d0c8af0',1453859155);"
-"INSERT INTO blocks VALUES(675025,X'd69ddc06d4868bc7a5ef968df71d9003f62bed0f84c79c754348180000000000',115121622,X'2d69059f652d236af0d8047c7c404d3b9ac5eaa07d8c9d562123ade6dbb29e67',1453866473);"
-"INSERT INTO blocks VALUES(677040,X'0bbccad9c524a04a3fe045e95eb7663eb80edd629a6d12e3b4b0090000000000',-641025013,X'b078bfe4ef5e5e09fd6603747265e13e84741ddedaf1de0884b441dd232dfcc7',1453886733);"
-"INSERT INTO blocks VALUES(679055,X'784ffbfeabe1c57b67503f69205c5dfca600b457ca2207ffd9dc000000000000',-17084552,X'c4e3a798e001041d6d66899ce14af9a0b55ca9d55fee7f7c69d47093efb25c7c',1454054547);"
-"INSERT INTO blocks VALUES(681070,X'6e30a36318a93e98a816931902c7fc6dc068be624894485fc965340000000000',1671639150,X'57654bbf35f74b38c834bb297ba79ceb809c131279a4c3b0e999450feaccae23',1454135127);"
-"INSERT INTO blocks VALUES(683085,X'b41289fdf2a3f0de42d9bfc008d9809e9e7bef004a7e890636ad2e0000000000',-41348428,X'61e4621ba259cc8aa2a48d0f3052ca0498679c98eecd51c093c1fc0ddaa70953',1454486716);"
-"INSERT INTO blocks VALUES(685100,X'cc43dc826b2f9fbf153e2ab86164e5eae622099eb475d46d92aa3e0000000000',-2099493940,X'9a85c37eaffe70c2ba1bd85f63064b4ec1bc524267636c0f4894a08472b2310c',1455188403);"
-"INSERT INTO blocks VALUES(687115,X'26d19ceb43a52e010efa95d9f51f247d4f6786654d74321f37a4c39400000000',-342044378,X'1a6ebe383c2a4b2bbd9a9fab165fb44a534757a80c83ce87c73330a22c4dd9f1',1455314702);"
-"INSERT INTO blocks VALUES(689130,X'4eb9cc8b307b7b66598bb9ec9b5840c66cfdb687fda0a6ac12366c0000000000',-1949517490,X'bf7837ddb04dae864eb43ddd9339d6769e874c18b9eaa0fda6a964bfbf7bbe12',1455319671);"
-"INSERT INTO blocks VALUES(691145,X'9232c54903c050722c5cbdfec21a7e9bcaf142087618d6f00633a70000000000',1237660306,X'19ca6778006c143f2cca1b367d18be610ce0ef84f33d7b6e632dba531042d721',1455325060);"
-"INSERT INTO blocks VALUES(693160,X'd4c3ec22c78fa802526ea37fac95e891b658146940383aca0744c60000000000',585941972,X'c66d23e8a264724aaa35d106544d462f8320219eb84b72f316264c324a51f3ff',1455330101);"
-"INSERT INTO blocks VALUES(695175,X'29c4159ad818ffd7fef43abcf5ab474cdd2c24797c02775cf59b720000000000',-1709849559,X'a8c5753ddc3fa30fb9874faa9b434f3979dede05289e356c2a105f38c7f8aee1',1455336719);"
-"INSERT INTO blocks VALUES(697190,X'cef984722c6202e02026e63298a7a1920f68e21cba46dad30c990c0000000000',1921317326,X'40a5b9f89d169c2673f51225d40cf5d83e042249f055a9c0cc16f4785e2c5575',1455348074);"
-"INSERT INTO blocks VALUES(699205,X'142799be532c0a3253dc973bba597de19564c26fc884c166b611010000000000',-1097259244,X'c722a5e812725fd2c09a43968d6397635c03041bf765738543921e6026fa5a08',1455389562);"
-"INSERT INTO blocks VALUES(701220,X'f63ea08705ec5e9e26f48ca51200892ddd37028503294d1b8bcbff0000000000',-2019541258,X'e905677b108e94138aaf6cc000bb8da62b5152da7c1af181a4ae1ec6fccf18c1',1455448352);"
-"INSERT INTO blocks VALUES(703235,X'22de8a021ac889b6b93abf1f5c45c46b78b27a786c2541c41f29000000000000',42655266,X'e9a4a1ae650f913e3ea97350ed0d75eb6662c6f889abc604d95a51c942ad92af',1455674325);"
-"INSERT INTO blocks VALUES(705250,X'9743b96a8a2e92f6e5b7cf4b249fedf28a67157898b002facb9f1f0000000000',1790526359,X'90ebe1e3c4c9ab66984ef3d5dab4e9cfe3b43f94e086c189b7ee9bb9a963ff7f',1455727943);"
-"INSERT INTO blocks VALUES(707265,X'8fa3f9a30e315e6a3b6f7d88aa2b4ccf20863f26144a51bc250a270000000000',-1543920753,X'40d0909bb4505530243282466ea0d093a98d2bea88ff6d54f4a9b055053cc6dc',1455733470);"
-"INSERT INTO blocks VALUES(709280,X'e000dc552690dafffbb58ef526a9a7109a5ceaa7d1d56072b0a1120000000000',1440481504,X'771e0c71006c8456cc7d9d9182ab8be187eee295fee35da29f592b1842a2fe2e',1455739620);"
-"INSERT INTO blocks VALUES(711295,X'a24729de1916d6acdea5dc4743b7b5a887d66a07a8364e3772ddef0000000000',-567720030,X'15035869f1216f9adee527f4b133e7f003b633b069e8805e373dea5c0e947d1c',1455745877);"
-"INSERT INTO blocks VALUES(713310,X'd9f3d44ba407f08125ecd478a4565e404360fdbe6a1c230463bd2c0000000000',1272247257,X'22f70fd8d1c5beaeddd2204fa7e19df5f52053cef9337834d5398b1fe29234c4',1455756912);"
-"INSERT INTO blocks VALUES(715325,X'47522d1beb98127f5d8d1f6b7ba48f2457f38727f417ca945d69080000000000',455955015,X'a69115c93afa332ca7f2b4a0dff40f7b3ac6b40506942624b294a3975abba9b9',1455804909);"
-"INSERT INTO blocks VALUES(717340,X'b060a68b4951c9aed0cd48296d0e94d73ae6a7ceaeda516bac8f020000000000',-1952030544,X'b715ec3562f802327bfe8c4f92f092402c4bbdd8b2769c2a661bb5664db2f3bd',1455970409);"
-"INSERT INTO blocks VALUES(719355,X'006ed027df4288f80fb8e35b3d01ff58a9c288fdb7d2e60a3b97000000000000',667971072,X'53ed1a09c34384068161bd253bafe392fa0cfe8553c06d00eafbd325f73af8e1',1456073173);"
-"INSERT INTO blocks VALUES(721370,X'9f2e4dfba606a66659441c4ae8f7b82828525e568cba8e159331000000000000',-78827873,X'89655db0f658ce8ea725cf95125b32c9a850bff664d41bdbfe75b29f8a809518',1456463364);"
-"INSERT INTO blocks VALUES(723385,X'7a31bf573746d6e16cb6d8d30b92da63a9a9e69f8a09ede2ec41f9b400000000',1472147834,X'75d66dc42a1ad0712bc9f7c191770d3e4882364a27019425e1cad1090280c6c7',1457209037);"
-"INSERT INTO blocks VALUES(725400,X'3a2466ca1004d54d086d3829f68be773d41c6a4a62ba15ab950b000000000000',-899275718,X'a40cc2bac692e768d3c92a381c0214783c8c83c76836a6ffab8c1580adad5d6b',1458088037);"
-"INSERT INTO blocks VALUES(727415,X'42333f63f791affac59399098373952074ac820c3d726aa33af14a0000000000',1665086274,X'e0922fcb720a9e3025e8cf81f63d1083b79d4e54a7de1248f507751870d73549',1458730948);"
-"INSERT INTO blocks VALUES(729430,X'c5913074c71fed417370bca09581ed1059c323405e75d5cee2401c0000000000',1949340101,X'75bbf50dc48214c26cddd0ba0d1c245c0b0c7c033d4735b6371334fcbe45a227',1458846660);"
-"INSERT INTO blocks VALUES(731445,X'66389da92ef20dd91daa8c91667b9640a471f08e03028ab0984eb10000000000',-1449314202,X'0c7bf15cf3f21715ffbf9af49ed3576d54540ce1960e899455043b1d57068f0e',1458850065);"
-"INSERT INTO blocks VALUES(733460,X'ebae2dc757a1b4f8f78d82d2cbf51827a42d3eab3aaffc8549f4ff0000000000',-953307413,X'786dd088bb3e860428c8f865e81dd72dac3b57fec950d26309fce950b0c8f5a1',1458853887);"
-"INSERT INTO blocks VALUES(735475,X'8c2725a03f54ea7cfc9cd08da5f486c29d859f3ab6bba8ab8d17ea0000000000',-1608177780,X'2e7f7bd1e9a1512a800b8548387a3ba7a0192ff41cb9909905cfaedad2e68a49',1458857916);"
-"INSERT INTO blocks VALUES(737490,X'92678f474c86e23003d78118224ea7f2d9ee822196d5d1419d714b0000000000',1200580498,X'2ef2f6e8af44f5506010589f152713931564833c3804210a3724c33c72be27bd',1458863074);"
-"INSERT INTO blocks VALUES(739505,X'ccc84d607fd278b6b5478727231ad0fc083b119f62ee8b58664c000000000000',1615710412,X'c702ba3b838c77bb1d21575c531de36f1b934e291b93d57a8cc05365a6dcb59d',1458877884);"
-"INSERT INTO blocks VALUES(741520,X'b219574b5529b3b70860b4af7f5dda5e335ec31069d36a7e7d9f010000000000',1263999410,X'3b0b9020b991e176b8fc119a62e687b06bdb914b9545564907576103c6ffe6dd',1458913361);"
-"INSERT INTO blocks VALUES(743535,X'c276d6ce94e05dd87a73fcbde38782c96f6d815dda6b4e768ed9010000000000',-824805694,X'c2418a1ee01a4b9e23c0fc5e95fe5aacf1ece5db47c348cf3b82b15324e20070',1459035017);"
-"INSERT INTO blocks VALUES(745550,X'70b02c1f12b012839858d06d687b0d99b32dc3f8e8a2ea82824bc80000000000',523022448,X'640b87f7873dec19389a75ce1aa53d8b57230f711aa6d9f47fed696ea5cc4a54',1459071973);"
-"INSERT INTO blocks VALUES(747565,X'720278937b8d325ad0abdebe73ebaafd1d544a81c15b60c373385f0000000000',-1820851598,X'b456c99fdcb1bb92cd8746c08b5196506c86029368fa3fa0de346d1f05b2681a',1459076834);"
-"INSERT INTO blocks VALUES(749580,X'4de0850f41c77a8b1f1ff42ac5a05c64b4ef6d253007ff9090026d0000000000',260431949,X'3f4f0c2d32574bbeb086b2ff31d31b12962c7079aaaafe18b24b31d4833fb322',1459082214);"
-"INSERT INTO blocks VALUES(751595,X'ea6376cb1eaf42ba994c07363f0151398d9a6bc3726d29cb8365c70000000000',-881433622,X'9c8552b02c43c8a9bf9864cfbbfc5d5036664e8b8d9e017a232236bb0813c6d6',1459087764);"
-"INSERT INTO blocks VALUES(753610,X'817a41512970c394647e289fc55b95cfd1b0af5d57e8e4613f4c040000000000',1363245697,X'2cb6c7feeb0fda84a3eabb07e3e290a2fb29e69e67cc01ee87889ad164571902',1459337835);"
-"INSERT INTO blocks VALUES(755625,X'e34f22237e8ba290c0a34b4ce6294942d7bc32db27578d3dad7a020000000000',589451235,X'38947425668a45dc399144cf38fd618712f0ff4399ea279bf34fa3b80fcf7f61',1459367998);"
-"INSERT INTO blocks VALUES(757640,X'7c433a140e2414effeff93108df4a3ddcdd070526c431e4fcb10020000000000',339362684,X'cc8e4f49f0b9000b7ac1dbf42373032e4621ae124be8332d62c7df9d56bcc687',1459442840);"
-"INSERT INTO blocks VALUES(759655,X'a2e084a08bb7eaaa044a4c474c95ca9172a95701b735e1fde060c90000000000',-1601904478,X'4767c28020da5c36f1b0dbc893aa951ce85e353d5205610159d7b43d1b621e7b',1459545476);"
-"INSERT INTO blocks VALUES(761670,X'9b1664b82c17ff375ca3989c89d9f452d10bb181921fb5b7c79a5b0000000000',-1201400165,X'5ef84e6c2f0a582703964be0d3f28c181c0927e26fb898282b5f2e68c296f5c0',1459770115);"
-"INSERT INTO blocks VALUES(763685,X'cbe54b888c4da4285c5e937c681aac72f41a2379cdcd9f1428fe2d0000000000',-2008291893,X'e30c6c71026cec2eaf0451445eb6fe951d452a3c3d3bc133db00dda2d1f96bef',1460179147);"
-"INSERT INTO blocks VALUES(765700,X'e9a578bae7130d974e2eefe0fae8afed1bc57efd5e49c57fd4251a0000000000',-1166498327,X'2fb41df4b707d04428743c62c1c1f174bdad563b080eb416771d6ea2cc9d0dc8',1460691123);"
-"INSERT INTO blocks VALUES(767715,X'b4213081d95c1512a2381240ff09815a56df6de01310d016c1c11e0000000000',-2127552076,X'a48ccd6a7637924fc9d99b09ced0e8b7db97055f5263111efe6d510d04732f2d',1460780068);"
-"INSERT INTO blocks VALUES(769730,X'1a4572c4a59aae098bc4a604b8a1d9eabbc579f97826db921272de0900000000',-999144166,X'4df0aa6d77070783b816eecb83eaaae116c3e64ebbe83d140ae4f011461183f9',1460783575);"
-"INSERT INTO blocks VALUES(771745,X'4dd681098a4c8e018b6113b6754e1030af863b3781da0cd64765780100000000',159503949,X'6ce4b85f867438a9548476cf7b402dc5656b0e7e4d50a06b94bbe196839fa1e1',1460784349);"
-"INSERT INTO blocks VALUES(773760,X'6d6474ef77cec34955d95f2f3a49dc4b16dc671d64926d44846d710000000000',-277584787,X'2c29cc162c371a34abae6510dcab7c2baee3b63d05e899a7bdc6caa548dd41e6',1460784892);"
-"INSERT INTO blocks VALUES(775775,X'b2b29bb9c0e89b82cb3e5a8de069eedfeb3ec842db5d173c737a5b0000000000',-1180978510,X'a9a6c9cffd145145ab1ab9481dd93f3d3bca35626686d6d2a83e35efec5125e8',1460787965);"
-"INSERT INTO blocks VALUES(777790,X'9c83fe1fd339cef634811e988277f6b79cc9b7c76b422ede63730e0000000000',536773532,X'785685136223d785cd1e70ce87bacc3461ca25b5f099becfa47f32b68d9fd3b3',1460795369);"
-"INSERT INTO blocks VALUES(779805,X'f7b0e7a5276f1bb51b1d56db7debf1d49f1dc1d6484ee1f11c83050000000000',-1511542537,X'6322c1496578cef330f646d34ed87b3c9c116f92a9c5f589ee35d28ffb53c111',1460820768);"
-"INSERT INTO blocks VALUES(781820,X'c25c27c255805b4714fa3bb6502704ee560c9ba42d2f28bedd92010000000000',-1037607742,X'17c8e4c605fb7dc98d367113f5a4e0504d2bfe9f63ec7ca9dc0534422b4b7c34',1460823084);"
-"INSERT INTO blocks VALUES(783835,X'a913c88e334e8f995d00570ea915f3db2ee6a980c7ea236d4c67000000000000',-1899490391,X'dc3bca6af854cf48169ad019bf8f637a7ffdcba2ccfd380ad64c0b24dacbe35d',1460828583);"
-"INSERT INTO blocks VALUES(785850,X'9417d924b0d9c73130b25864024377e63845a5c9d9db8913c906000000000000',618207124,X'63dc4bc083a517a1921edcead545ddf304125cbd580ac58830394b96a295b6d7',1460836950);"
-"INSERT INTO blocks VALUES(787865,X'e04dfa1184012d376dbbcbcda42f97691e547009ed7b2374ed32980000000000',301616608,X'2d311ab0f212564c53f2f7abfd5c09c25fe1608b8ecec98ab288b3bfbdf6850e',1461712623);"
-"INSERT INTO blocks VALUES(789880,X'af9b4362f52c273b80c7f359a41882effb714f1b11818792570de60000000000',1648597935,X'a5b195eb61918f833c60ad0ad27dcc05b06c13a51529a686bd560c295ae16579',1461841017);"
-"INSERT INTO blocks VALUES(791895,X'bb9d067eef8b5c561c4067929401193f8e9a036633add8709f0a320000000000',2114362811,X'eeaa45d364f00bf1c17508f583a04f21024ef3c33c5702f748d535ad57323af6',1461843976);"
-"INSERT INTO blocks VALUES(793910,X'60b5d7bf9778e334300ca858ae7e7ed4c72de84fc4986f50d9c3880000000000',-1076382368,X'79bb0a12bc324f58503ae1a7db66a48078abedb2ad6bfc75ef7a45d47895e58c',1461847024);"
-"INSERT INTO blocks VALUES(795925,X'365cf35eeba27d8db7fba700cdab26533b9ff19a8bd80e97c627280000000000',1593007158,X'69adb47baad6001c2d084d081c4b23b226118abda44af95963a864eabceca317',1461850035);"
-"INSERT INTO blocks VALUES(797940,X'be5e41d47af5cf8e239e283cd571dff0a03d320ad69d5ee2f4b3a30000000000',-733913410,X'b84543bb0330b32f0fa9a9a83a10e70f5f82c41a213228c29e08154b9aac4a1d',1461853328);"
-"INSERT INTO blocks VALUES(799955,X'2a0f2e1d02d6f9a9f1d39f03a1693240ac0a916453bef4b405401f0000000000',489557802,X'a9571ab726267d04a6bdc5f8c117473bf40751de866f4dc92043f3988b8116c7',1461859209);"
-"INSERT INTO blocks VALUES(801970,X'67f9d4ef97faa079ce46f015661c5f3826dc447fa7e500500696070000000000',-271255193,X'7d5777b611f329a924f779bc03ebcd41a13020e69c0ff0fc1827fdd0812fae75',1461873030);"
-"INSERT INTO blocks VALUES(803985,X'9c8e8b511b1ca82441df5270b9fb8a0d5e1053151f76a6734e8e000000000000',1368100508,X'0e3900fa00bbf04c4b3ef2098a9bb3e148bfdd7b06b2707e94275b8b1cc5fd79',1461911913);"
-"INSERT INTO blocks VALUES(806000,X'd692b0fbcc8c6916c39214c02c40086841835b71c81d711742d2000000000000',-72314154,X'8021f7129ed141d4f009e068bc22b3f0409bacb5a471159986cd9d5249942df2',1461982105);"
-"INSERT INTO blocks VALUES(808015,X'9d024bbe3c34a34e47361f562e0f3db357a0f14af974d147e7a17a0000000000',-1102380387,X'c9bbbfded7cf2d2fa790e1627d3986150662eaac9783404c789fb362fcf71675',1462191106);"
-"INSERT INTO blocks VALUES(810030,X'dcfc0c9572af83b9aa9a0bbf2de90e0f8416f0a16bc934c70daa1e0000000000',-1794310948,X'583ea3a95cde8ef849832e36f541a6e1ffa170dea3511beeaf799ebf2ee35344',1462519365);"
-"INSERT INTO blocks VALUES(812045,X'54843c306ee061968ab4c869afb9661a41d0fabea43870431917b80000000000',809272404,X'0cc2c3a81322f26039dc972a9a582e5d1590cbaf0b017d7bcfdbdea27d390d2c',1462603397);"
-"INSERT INTO blocks VALUES(814060,X'450df8f9627ee2eb62adb7b0b8f6fe6b3c3556e3b94aa4da62a5500000000000',-101184187,X'a77911852eb9c588c3fd4e503b85396145f0d7c5db038741b5f15c7f3ecd7a3f',1462606128);"
-"INSERT INTO blocks VALUES(816075,X'ad371a6eac8a5d9802659642c1768524fd901c643eb2433914354f0300000000',1847211949,X'925e8c13b3bcae52c7eea7b798f4d7f5145f767528fc6535a7a911128f9c8dd7',1462608652);"
-"INSERT INTO blocks VALUES(818090,X'7cdb438ce7e00c1b66014653a79d5277374caf83842fa9b0a634d20000000000',-1941709956,X'6b8185adcd6886278f78b9a28891af698816f4c6528447377e6b87a2edbcd81e',1462608988);"
-"INSERT INTO blocks VALUES(820105,X'de8a0e18ee1c85768bb373a24fb364e2d87c43ab738d9ea2832e330000000000',403606238,X'532fb8b89f8d80b3023a1d12bb17f225dd970aed9a82e18fb86078b85df65b0c',1462613772);"
-"INSERT INTO blocks VALUES(822120,X'd0b43be7d7f686613f5d67df9a8203aca498554193392283bee1070000000000',-415517488,X'1f126720ccd17f2745bd179c406629d1e9e9662b460aa9386aab147fea2253e7',1462623793);"
-"INSERT INTO blocks VALUES(824135,X'6bcb1bb7b239eecbe046c93725a59560d9602ef7a2af3c235878040000000000',-1222915221,X'ebe3696b8525dfc071689ef11a255f92a51641e2559e1bb53ae7223ae81bdb0d',1462643197);"
-"INSERT INTO blocks VALUES(826150,X'a4c7fd76c71eed04d7ec2d780e05475700b1c5230a3641e19094000000000000',1996343204,X'f2b6611ea1ccd7c1bfed505aac3bc39a02189a1760de9ddf73be099d85d46445',1462698695);"
-"INSERT INTO blocks VALUES(828165,X'e26213333fe7997de828b2b450be96516a18e8abe58a47c33620000000000000',856908514,X'3c3c78003ae6fbdf116ece64975685ab5d803ae28e3a5a646d7d2a233a353f32',1462860283);"
-"INSERT INTO blocks VALUES(830180,X'6b02c59ea1b57218bf43f1e1c307bc455872927a19a73bb64c2d3d0000000000',-1631255957,X'972b8b5f9275d138079cfb60a3e088c6516be48f17f36e6f2662dbf5209dbfc8',1463083581);"
-"INSERT INTO blocks VALUES(832195,X'ee54991cf621e4c55702b45cbc5822bd381cfb14993b5dad3d99340000000000',479810798,X'5395a02719db69f715db05d701ccd08e63ba869115e4d230a58f517afc706a5c',1463091153);"
-"INSERT INTO blocks VALUES(834210,X'5c64620abb51f94aad3036573b51339ad33915a3c005fbf7dfc4200000000000',174220380,X'43ebae661da650ae0f74a41acc02c445ffc898eccb02470dc0470f2d891e44d0',1463094601);"
-"INSERT INTO blocks VALUES(836225,X'09e4dd51a819f343c24df85883d1bf36fd502ebe0addbf3be5649a0000000000',1373496329,X'54797550fff9149fd396600592e40fe20d6123a41ea5cb1cca64d4f176d50a88',1463098411);"
-"INSERT INTO blocks VALUES(838240,X'aeef156ef5c9979c160aec435bf7f40ccc4a0d218337a7e9499b170000000000',1846931374,X'420511708ea2cfe5b15c1a71e1ad72a52d54b7ecaf7a8eb43854243b91672dd5',1463103856);"
-"INSERT INTO blocks VALUES(840255,X'16782972cb3e398f0b9afd7be6e22e655bd561eb8415d31443b9040000000000',1915320342,X'a6a20671544f5e874443a859ad70cd49dc9c74bc05af53a69eaa0883fb10459f',1463107800);"
-"INSERT INTO blocks VALUES(842270,X'c86dfaa51f0c80fb1d216f1c095574d6c206a48decc60e736929040000000000',-1510314552,X'ed67c4d5ee80f10ffb307c666b6d55e8aefb337f085a4af5df784da76fbaffd4',1463112052);"
-"INSERT INTO blocks VALUES(844285,X'2097e2f14b959181bca0a38290365ac43382a59e632fec3de0e9000000000000',-236808416,X'cb38adacca2fea3670f2d01584dbb1de9bcfec93090d8ef4766980542e76bfe8',1463114528);"
-"INSERT INTO blocks VALUES(846300,X'fc00cb6365cf2ea19e6245ca9939ab76a650ac71f1539779ee3f000000000000',1674248444,X'19dbb8d1ad9150b87a3ab41722698fbba0ffeda5c709fc58e317fb0af1f1b647',1463127791);"
-"INSERT INTO blocks VALUES(848315,X'e9fd0881e17ec8814c46de4d6eda9aeb8373f9e103788a3f16ce740000000000',-2130117143,X'40a834dea7d75f888a1a2bc0c0d5697cfa3f92b8dc2af393150651a5901ce469',1463585974);"
-"INSERT INTO blocks VALUES(850330,X'f5b3fbafdcf8e480634cb44a87b005075d04cfc262752571bd68de0b00000000',-1342458891,X'c0d5a760d875272e7d6b580e03c74f9ea79e3a39ebf0cf988e31915d34c642ec',1463661813);"
-"INSERT INTO blocks VALUES(852345,X'1103c76cc1609926e691d37d0933b98295650891a64c003b465e5f0600000000',1824981777,X'6829c2c857fbd1384d51eab9a1dc8cf17b38e0a3c2d25d0db0e6f71575a7bed2',1463664421);"
-"INSERT INTO blocks VALUES(854360,X'a253781213df793cf75e4c5af4abfe9a57ff5596cf73ec86deea530000000000',309875618,X'700738fbdbf4b312bb5529b3dae1394a1b0a70c9554ca6114d7f105a9af23414',1463667282);"
-"INSERT INTO blocks VALUES(856375,X'684c2f5ee3c8a2017db874928fc0b5a22510799ac66b17b6821b510000000000',1580158056,X'4a00e1a6444fe67ac2682ceb29f887cd1c4b8e93bc5a7d5e7288c133d2afcff7',1463670744);"
-"INSERT INTO blocks VALUES(858390,X'e55c8f5ff67112cc9d0a3b3624e7383c020ddbb7cc8cdc0b7fe31e0000000000',1603230949,X'e39f0852d1ba6c39c0b2c0fdaf933e4acd024d0f17c344b499e6a8cba2b0ec81',1463675100);"
-"INSERT INTO blocks VALUES(860405,X'5e3ad3fc07bda944a23b0a78da8e4c8ea7e0c737ae63e91f46df080000000000',-53265826,X'16c836fceec31f36df04d20cbedc7b2a315f3c94d8197e3a0622eec77bbd9983',1463681138);"
-"INSERT INTO blocks VALUES(862420,X'd23d773e5624356a10d48e63936b8ea87a564b1efcf06002979d030000000000',1048002002,X'722e9b987983ae5acae0f905805f33bef9283e9e60e6dac6ac3df98f4c130ef4',1463701809);"
-"INSERT INTO blocks VALUES(864435,X'ef24e062054bdbbd5303a4c097bd83085488a4065b5097762960010000000000',1658856687,X'7e7db1a26190558c71ec47aa48574a14d2fe613b3d37417625839eac9b117b0a',1463760427);"
-"INSERT INTO blocks VALUES(866450,X'f9595cf733df4cf127fdfe554ab9850a495c44cfc84ada9fb823000000000000',-144942599,X'83d6ae1bd81eadf665f71a93b68ee888f50b3eee57386220f8e07dea5713c9bf',1464001989);"
-"INSERT INTO blocks VALUES(868465,X'a8d74e4b7950ec32fcf9d8ffb99e07d83fc4d61edd10902ccc09000000000000',1263458216,X'5a2e9ce2c86ed3df0ed61c7579548afedc8c619ea4505a724fb1f51379969139',1465190752);"
-"INSERT INTO blocks VALUES(870480,X'69815bb23e6586b873c37b9d2c068c80e534164158c079f5324a690000000000',-1302625943,X'd4391ab99619e79993a86e48295aa53147425814f3a25bb00a96008bbee4cb45',1465939808);"
-"INSERT INTO blocks VALUES(872495,X'a198b09465e8b3d6f180a8a18f9b6ef862d29936df6633accba6490000000000',-1800365919,X'e671e782a2d2659401c965d14fa57d25340434c918f8bd7919fe872b68394beb',1466659423);"
-"INSERT INTO blocks VALUES(874510,X'5d21f3fa1ac83c2814a0d92b22d0f92e44d19d85944a903feb00000000000000',-84729507,X'8c343de258470cd822524330c16ebd5cce3fe043afb986bf55bf87d3cb71e310',1467239560);"
-"INSERT INTO blocks VALUES(876525,X'0a0ff80d43323fe33750c7197e530626d2552bca2a086cc885f0f70000000000',234360586,X'af82139b48b7da4027facff8e852174860dd54d8a0fe8652949d1182870625a5',1467346995);"
-"INSERT INTO blocks VALUES(878540,X'e76dfd29f76435eca52bbfdb89ee00bc465f169109d2d8c32c1b7a0500000000',704474599,X'5e9b92107f55d89d15fd944707573548cf490adfbd27b3b184ab360776fd67e2',1467348668);"
-"INSERT INTO blocks VALUES(880555,X'a8ec1e75086e779309521cf6d53ab279d34e70da2e511291a623de0000000000',1964960936,X'd4bfd78dc3117527f4609a05d7bcfd374d76ece0e0049b4a966740deb5a305bd',1467349255);"
-"INSERT INTO blocks VALUES(882570,X'bd60aa271911b24464db04f3647f3dcdf2dee54ad9006b83c0c7520100000000',665477309,X'99c2cd07cec1428e60606f4eba6dde8004d75db2ac76435f75926d8cfb6e7118',1467350240);"
-"INSERT INTO blocks VALUES(884585,X'ad8e31a0428fb882d98ead0d0451554fec79d1fff3aa313b19b2120000000000',-1607364947,X'846463a97a8d1b2d71f6c01db0486a49b3616fe4462293773c4e6749f00958fa',1467352468);"
-"INSERT INTO blocks VALUES(886600,X'6f3389cae37f7440b8ea3c9f742b04e165313e8cb26a30b22b6e050000000000',-896978065,X'8043e89ed74a98c7bf2261ef3b32655930a9403fdeae9fabdc232914ec2f5c9d',1467355438);"
-"INSERT INTO blocks VALUES(888615,X'a03395489635f198a0dd0e0a0596c26146ce941dd0e49930edc2050000000000',1217737632,X'ea23b2c6590b39537202615338d72aba42962ca3d8112e00faf5ae41c79e7d17',1467363607);"
-"INSERT INTO blocks VALUES(890630,X'aaaa8c0807a0f0bacaf456705c1882de10f35c09c71ea5101298000000000000',143436458,X'62ce6d8afdc7bd2e90d90d6dc4716247c4b4113e922989a0f9f626240d1419df',1467368770);"
-"INSERT INTO blocks VALUES(892645,X'0d1af133afc3e7fb33e5b490816fc80cd6fad0a433df8b07aa5f000000000000',871438861,X'a82a6ed6504484be425c7b0d024b35704c03135054fcc8a5308e120d17c4c5fe',1467432463);"
-"INSERT INTO blocks VALUES(894660,X'e0c86a263adbfd6ecda48cdae944193c8273c85d2eb222bfb906000000000000',644532448,X'0446946e564f0a27ccf086a4ce7b458e613ddcaffb54d57a532d56710abdec54',1467620584);"
-"INSERT INTO blocks VALUES(896675,X'6fba1622fa35a3414fa53d60f0c9623c7b55fb8fc8ddc7bae800000000000000',571914863,X'87128f37a7eca3db16fec4b159f19ffa2fe9a88863fc2b90a9d7640d9c81aaa2',1467845049);"
-"INSERT INTO blocks VALUES(898690,X'60bc67c59bfb1e5272bf8ef94dfaa0e49f2dd9d426b23db4294a017600000000',-983057312,X'37ac2757ad4a38ccb1d2db143a0281b5fefc07a7daec431548ab9c374ff334fe',1469221191);"
-"INSERT INTO blocks VALUES(900705,X'486883781ae71555272e54ea58d3d85a2253f7d9dc2afe8dd1181e0000000000',2021877832,X'8383cefb3adee54cba1605b1e43ae2eb757f3de771146c7c72cb9af6fb1019db',1469692676);"
-"INSERT INTO blocks VALUES(902720,X'9602c39b369f165fd87ec9197a0939e3bb4d23820b9d6c577e084b0000000000',-1681718634,X'dde2ab6b31ebef7c0bf413e678fa6da9244bdc27934f945d1d545d00f5d9af2b',1469693012);"
-"INSERT INTO blocks VALUES(904735,X'b9d209702920521cde53239e5be8850b96fe0e4df19c3065326a1d0000000000',1879691961,X'4160c64ff35f4f39a8397a94917ffe2869dcbbc38c83934c61f5555c98914e16',1469694632);"
-"INSERT INTO blocks VALUES(906750,X'0e93a77d99fec6675a95b4ee6b32fbe7a0b1099d754c2cb7c5f60a0000000000',2108134158,X'966f97e22da6e24dc2035184ca5b1c8cdecc9c626c911827458328aeb63694a6',1469704279);"
-"INSERT INTO blocks VALUES(908765,X'c0fa80550ec61b642d68a60f916c85f1b4f298460c4a30ab3643640000000000',1434516160,X'21ce46088bbebb71e17d6736aa20224056ef8dfded9989cb373aeebdca78a9dd',1469705823);"
-"INSERT INTO blocks VALUES(910780,X'233268fc3b1f797a4eb888f2f2ae6531f7f7975546655ebb5510050000000000',-60280285,X'bc5f17591e45842287f18b24d2c27509fbb432495e85bd6757512a4dcde00cd4',1469709976);"
-"INSERT INTO blocks VALUES(912795,X'336260ae2f31945e83fea57eb71485b84c04259db3a9a76923a60b0000000000',-1369415117,X'e13e0478f9780d2af5c8cd71c09af3b7c648e09caee040b1cfc60308b99608df',1469721670);"
-"INSERT INTO blocks VALUES(914810,X'cd3d4d87267033173752819e6cd3a7f39b9c0bfa8e4328f7d699020000000000',-2024981043,X'5c512ade51018241d108462a1429afe20fec047720e380450e18455c159c9ace',1469760887);"
-"INSERT INTO blocks VALUES(916825,X'88e3037b8d2ec345f744e4f5a21bc7e620f8dac769f84681c2bc000000000000',2063852424,X'3a3a053bf1ae8aa19bf78eb142d40396eb1b3c73d9dd5e590fd117abd6870501',1469897570);"
-"INSERT INTO blocks VALUES(918840,X'95446dced4460a36f9680067a90d272fe563480db8e2ac9e5121000000000000',-831699819,X'be903bd19061e7372f26d23ab1e9d669f136e0a7f0a0c5a3088f453f244d9725',1470049665);"
-"INSERT INTO blocks VALUES(920855,X'67d4bcb27f1269f426ec12ef641fbfe7d758c08135224a8f830e000000000000',-1296247705,X'3f2883aaecb6c9bafdd527569220f18bf9c3ef362534db7e433714619167807d',1470514538);"
-"INSERT INTO blocks VALUES(922870,X'945d434edf36a5c63cc3f6bf22e648adf21682a733a1e2938103000000000000',1313037716,X'9ed4271e17d1288778df1d9ed6dc236dd390d542e0d2950f20eb760c1f3b442c',1471555794);"
-"INSERT INTO blocks VALUES(924885,X'a3e90e82f744404766a82983acca8143bce1205941c33c47c704000000000000',-2112951901,X'abd8de12f1fb6faea714484b2bf373f110ddc306d782797a095a287d626e2a86',1472045011);"
-"INSERT INTO blocks VALUES(926900,X'12a41820562ac87d2ff5eab195cffbe0e0cb238a0fa17cd3d101000000000000',538485778,X'c8a98119bace9269fb6b4c57a18d096de0d60f858d7123db183a658736fccbcf',1473084640);"
-"INSERT INTO blocks VALUES(928915,X'82b314a9ffbe046f4c80cfba25f6416259abe0319382cc4a6e7e526700000000',-1458261118,X'2467ff5ef47607a75c17332cb4e36d317d2a0437ad4e3d95833c4d5b67219993',1474367854);"
-"INSERT INTO blocks VALUES(930930,X'ead5d494713f6f1b089b923db67bce6ce935b4cca161402fdfe93edb00000000',-1797990934,X'21c1f46bd285a444ff1df38fa6ba10b4bf8ac80c71a1658d6d100658a5146170',1474784642);"
-"INSERT INTO blocks VALUES(932945,X'44933f63130e1b04bde079a17173c794b254a57fe1b5762ab7bdf33e00000000',1665110852,X'01132455261fc97e257facb623d8ce1987a2e70522115b6583e4e9e4d243d696',1474786970);"
-"INSERT INTO blocks VALUES(934960,X'f346d46c4bf989e73cd2e4afe006e8ac5eb74140d7201e11a4a8ee0e00000000',1825851123,X'91bed529bf80912ab9503fec7f8192e43a5776be3b3161ead72a15b503a9401d',1474791295);"
-"INSERT INTO blocks VALUES(936975,X'd3fd69793717ec07a9e11948c6448b0f9e02a2e5e04cc4155e81050000000000',2036989395,X'1bbae84a48f9ff214532de48fc517063970c245a589867f56a641ffa5d8c0e2b',1474797739);"
-"INSERT INTO blocks VALUES(938990,X'dfb72f12a73796af5bef526524c9aaebe2868ccc967f984e9578060000000000',305117151,X'1e5a87b4c9fd115e3fd8b4f10d2c9f62b7dcce6e665f787fd68f2d36d2791440',1474805695);"
-"INSERT INTO blocks VALUES(941005,X'a68bfb2847f796b6c7b26e444f31f177d491a6bb11d0f49ba007020000000000',687573926,X'f363dd9f717d37e1da6aeefbd7a0f13decd321aa52c6eee064587492bd69e840',1474813513);"
-"INSERT INTO blocks VALUES(943020,X'a8936a78e715fe4a2507cd90fcaa91605defb049051e989c202d050000000000',2020250536,X'3aa0e559ed765fd3d565c83cb585f3674d3b960841907ee7d853df155eba5d18',1474821530);"
-"INSERT INTO blocks VALUES(945035,X'1e540e5ed53aed1ae941bf78e7c244a6943cc29f7190a833d1fb010000000000',1577997342,X'd525c7e1703627d13242cf941fd8937a6fa6662f259c340e619718519eea688d',1474833748);"
-"INSERT INTO blocks VALUES(947050,X'5969a0aedf25a969928ab6af30812e7ab06df78917ea1ec4c2a8000000000000',-1365218983,X'c1773d24997874a2d37a27940da5354bd5bc29f448ff075a406b3de07341b0d9',1474873592);"
-"INSERT INTO blocks VALUES(949065,X'a31a6194b45947c08ccfa94e8613fbe66dfcf91084a8fa23600b000000000000',-1805575517,X'ecb39c8be09166f985bf9891283c21e4c1d0f18fb4679146f708586dc75d5607',1475061327);"
-"INSERT INTO blocks VALUES(951080,X'dbe58be2e22ad1bc668e98251b816f0ee9acdab8cae8ebe5a07b7b0400000000',-494148133,X'3bc1faa8583990894b4a13ef730fa30aef0b5722db01f48c7fcd5fd0ee72020d',1475179165);"
-"INSERT INTO blocks VALUES(953095,X'e197f45259eb2f8298c7925a6fc4732ed578546ccbe30f0dfeb18d0000000000',1391761377,X'1a4a2e057d94a12643304ad6244e3b4355cad9796e9565ebeb6c7a98fd4451f9',1475183160);"
-"INSERT INTO blocks VALUES(955110,X'517916793ee5f748e4fffa60efaf2e24b36d3dea2d083becc509040000000000',2031515985,X'1f38c654268c82a0a97ee2378845414a6d0bb7afd050bf6838d20f75eefd0f73',1475186664);"
-"INSERT INTO blocks VALUES(957125,X'548dd7545fe9fabe13210d018d12931db10943851528376ae8a5c00000000000',1423412564,X'55a3c93dfddbca6061bcf24b823089c25e6745573da8fbfb871ba8189e1f310d',1475190177);"
-"INSERT INTO blocks VALUES(959140,X'f7588bb472a9518556cd5c32e82fcc723bcb1223f36eb4dd6143000000000000',-1265936137,X'529beacb6a9499b5c199e037774b9cd7f663ffeeba1ec0f89345ecf555e6e973',1475194526);"
-"INSERT INTO blocks VALUES(961155,X'd8b965a8f753a5bbec9594bfb003bf6aa8436b5a00082c3d3de7040000000000',-1469728296,X'1437ea93a5efdfc6cea170ad5227d99f5ae869b91740312d05f6b353449db00f',1475200794);"
-"INSERT INTO blocks VALUES(963170,X'feb684f02ef8d5bdf96cbddcb5ab2aed25cd2aaea4c84ff3e765000000000000',-259737858,X'14efa392c6cbab3e8803a739fbbeb459cb797f995c063bd5632171d7bb3e43f1',1475210185);"
-"INSERT INTO blocks VALUES(965185,X'044f88db61d4dbcc7f2a975933c1263b81dfc268bce5c6488c17000000000000',-611823868,X'7c15714c120484a2e61e3d4b3bcf79947968958216aa224f0284a19680ef4137',1475243376);"
-"INSERT INTO blocks VALUES(967200,X'fa5660afc193a3a9aea4f85ed07fdade76460bb4f2a246028b1a000000000000',-1352640774,X'6f3026ea588a8079c6f37f841ebfdd81b726e76379fddd2f93fec2c905c0dd33',1475337060);"
-"INSERT INTO blocks VALUES(969215,X'a80cc74f599a199ac06f3d38ff00b001969ad16d462ac55c5702000000000000',1338444968,X'8e86ffd8d5ab57c986d9007d5d58d3875223f30061b8bc692226dc9fff75ee3a',1475583297);"
-"INSERT INTO blocks VALUES(971230,X'e660a9955276c2da7b2769a341e268e013f600273e0b8489c7e6700000000000',-1784061722,X'0f8c90879e9b9a16f36d1dd74e909de3b14234c8c2b74573fbbf21531e409616',1476109202);"
-"INSERT INTO blocks VALUES(973245,X'0c9e005657edca6bd00f447357bb6a0e375c92fd025de4da604e986500000000',1442881036,X'e9ab6cf78ad859f718acac9c142eeced2f4bd3daa97a1a21e76b9ce9aa8b9d0f',1476255352);"
-"INSERT INTO blocks VALUES(975260,X'a37f5792f57e96ed250bf99e429cb0b2a40edf4b442ae03adaa35a1b00000000',-1839759453,X'b9ea5869076e7928b5c0104e75e938a1b6ba67e403d2f49a58dae9d025bb05f9',1476257417);"
-"INSERT INTO blocks VALUES(977275,X'bc7d258e155ef0dd4e1bdb25296891686342667895a19512d18cc40400000000',-1910145604,X'43db2348a2414d4b3a1b91ff189c87ee4a73ed84a1aa05a37676bc888cf17e83',1476258791);"
-"INSERT INTO blocks VALUES(979290,X'b2688db91429272486435f01b3cfbbd91d1e6d6da45d303b986ed50100000000',-1181914958,X'5b655447903c03915a5e812a36e82dd63b79012969e7de393e8abeb9edd31448',1476260716);"
-"INSERT INTO blocks VALUES(981305,X'3940cacc9e415932116ac688b320e75f34e44da01abf8e71c9006c0000000000',-859160519,X'3de7253c87f0812637148f63a9784ca70c0c214a2aa36b03d7abf839670b7035',1476261061);"
-"INSERT INTO blocks VALUES(983320,X'1519e83e97fe479c6c49c2c657666d7bc74e2e53f3c1eae2fd73960000000000',1055398165,X'42e9497e8b76f7488fabac2902a8298ad3b5038f512802a8d43ee2f64479b586',1476262735);"
-"INSERT INTO blocks VALUES(985335,X'8ed71e312c73b1c9d5835632ed32ab716464cbcd1edade69d43a8a0000000000',824104846,X'83deb2f636d9fa6b110fdebc8726517269c875706262b647b96a822b37643285',1476268259);"
-"INSERT INTO blocks VALUES(987350,X'b0e3efa3dbb286cbc671c7a90bc658b89ff6897e149296983dc9000000000000',-1544559696,X'b8f8f631864cf6987e5039847bb784ebcdf4a43782d378ca860fcd3665dfb5be',1476284451);"
-"INSERT INTO blocks VALUES(989365,X'6ca7a63c1c7cfd71a2f405993f20f16a6f3542cf768a7b4ab9a4450000000000',1017554796,X'9409a2358618a0012d26ea9b76af0ba36fa5940fcfe83fe25c0d8a849d778663',1476420075);"
-"INSERT INTO blocks VALUES(991380,X'85812e4a1ddea54a2fbdab99326ad061d38d82ff1355ee65fd16000000000000',1244561797,X'3b4cfc82a5b54c063c81ee418a4c4d8ef1e80d0d37b068d2e4a654a37e339fc4',1476752895);"
-"INSERT INTO blocks VALUES(993395,X'852a091ccf4b33e2d4ed1d8981df585bd49a2f50567abac3c6fc0d0100000000',470362757,X'345b890dacd8cae999cf02c6027a252db598cbc049ee8dd3c8f4ec8613610cb5',1476844969);"
-"INSERT INTO blocks VALUES(995410,X'd801bf2d3ef837faa59d661de3d95dfb1dfded20a47b553950906c0000000000',767492568,X'0e0a9c082e9318b51a7e3d3969475c1ff8f24c971b596b4748fcdf6830f6e7cd',1476850365);"
-"INSERT INTO blocks VALUES(997425,X'a7b40ae9ba697a3cee7e2b7bb04f3c17f029ffefc309655b422b590000000000',-385174361,X'df22530734289a1c0d235e9b283fbf701b2affe595ab1b86a652436e533abbd7',1476860061);"
-"INSERT INTO blocks VALUES(999440,X'a2ce98519b68f22a33661759fc007542add6a68603e7d6f50fc41b0100000000',1368968866,X'77397afbb2fabab00c4ccea1f20db99709f07e76a3f6617fc070c1adde8fd5b7',1476870816);"
-"INSERT INTO blocks VALUES(1001455,X'6e37605615686b2fed0101d7698abdafeaf3ff121a628b01e34e430000000000',1449146222,X'ebabd75ac1f5ec414235af45070a1c7ad63962686a6f9c07c883ae0b6d2725fd',1476880235);"
-"INSERT INTO blocks VALUES(1003470,X'7a36d4c2cbbfa042bcc887003f75eac17d2a1fc98f4f79dd66c5100000000000',-1026279814,X'f2ffa07da1711de7ccb1338e3a40f5dd1995dd59e79042dd31fc6797f1e28408',1476888321);"
-"INSERT INTO blocks VALUES(1005485,X'092f9c0a73de111be974c1b11daf8fdb20c04db6a2bcfa69cf80010000000000',178007817,X'a5c046a0c84085ecdc4d6156d60e5737f5874cacf326fd65efe90fb1d18c384c',1476895420);"
-"INSERT INTO blocks VALUES(1007500,X'2fcd6ecb444e6896aaf486544d0177e769800c6746e86891ae2e000000000000',-881930961,X'905b56480a5739b0527e3c70fd5f869bf2cf3b4afb8f5dc8306fc887b16e39aa',1476919594);"
-"INSERT INTO blocks VALUES(1009515,X'2a47b93370cc7046ecf1d64715c67a5522ea3ccad1a1e6391f4e000000000000',867780394,X'0b9f9866c6432ee3b13efa05ead752da814da2374ff237388f1cf8b986347fc2',1477000902);"
-"INSERT INTO blocks VALUES(1011530,X'1de28d887baba77ac099012da0252bb2cc50764eb43cc741b206000000000000',-2003967459,X'f84c00925fe2f135da24248229a92ade70ba31eb76088bd68cd2184a3d70c60f',1477147847);"
-"INSERT INTO blocks VALUES(1013545,X'2d73e40437671e662493eda3d9e5314bdff8725e5fa478c5bd60080000000000',82080557,X'0b89a11bf7f53cd2f7734e41ea2765849a34667eac5fd17a5bfe3ab93ef116ad',1477776549);"
-"INSERT INTO blocks VALUES(1015560,X'bc1968336cca731a7cbca29792bad6819ef7bb10b67e6c42e16c0b6800000000',862460348,X'ea15ff8ccdae31d0112f1dbca9ed1a563928d1650a090e7fc0f74fe9bcfd6c18',1478285436);"
-"INSERT INTO blocks VALUES(1017575,X'301a1700c1d1e1fbda630cca8186c9f88e4dbb1a2d8e636cafb0f60700000000',1514032,X'c0d05cf15c617af787d04b23d6208a447c8a1adad5d1eed66c242f30076c8301',1478290005);"
-"INSERT INTO blocks VALUES(1019590,X'c86dcab48311e204ddf99b9a721b62abc4996212d9f020207618cb0d00000000',-1261802040,X'ca199c4ffb40dce387ca22d96c0ca056b0fc6b9c18ee655eca584937b756cfc2',1478295455);"
-"INSERT INTO blocks VALUES(1021605,X'89fa47517fa67633a71f28ffb209e53f47f399e8635ed693cf18880100000000',1363671689,X'ed1e144774edb5076d9cb09c3da4bb3a438f042f36de8d45b0ad3605b5de584c',1478299448);"
-"INSERT INTO blocks VALUES(1023620,X'627e81198cb381acd004fd3cf29b3fcb75e2ddea6a646076711aba0000000000',427916898,X'f663d501b63ee60b1a357d2d94eb926f62a7d5c4d7815707ae6b8c062098b251',1478304364);"
-"INSERT INTO blocks VALUES(1025635,X'157ebf26dfdbbccf6ffa26a8d2833a82b2fdaf02c85bff50477f0e0000000000',650083861,X'03f0c7a8d3551df2a31a6fb387e737eeb98ae25a52c162537395421674b56aca',1478311646);"
-"INSERT INTO blocks VALUES(1027650,X'd6700de23573cb3900b41c218190c3a94c190358f7728727466f0d0000000000',-502435626,X'1c29973144090a7ddc1f45a0d829210e0ddaf1f101da5fec11619a8e834a66f7',1478320948);"
-"INSERT INTO blocks VALUES(1029665,X'e6d09940135c1faf3990c911d00f2b222e840ec61a3e060f0e32030000000000',1083822310,X'a2f3a33381b0c16b6133081d2ef6e03e571bb7e01f83657b29bcfe44b7b89362',1478372598);"
-"INSERT INTO blocks VALUES(1031680,X'267a0c1030fa364f697e6c9b8f2bae5f0b101f37d36cb4f5c2aa000000000000',269253158,X'56469a1a8a44dd51880726d35e3c8d56736a64e8f17416596a2949bc92c7861a',1478521526);"
-"INSERT INTO blocks VALUES(1033695,X'519f1a53342b2eac8a1258cf639b832708b2fcc793a414f99236000000000000',1394253649,X'12aa42d18175b0bf6194f8928e59321fa53a86b2798df560cee90446b213ffe3',1479108878);"
-"INSERT INTO blocks VALUES(1035710,X'5c6531a869293aee9dfc2b30971d641354fe15d06f1106398b1b000000000000',-1473157796,X'64faa625838a3e6983c84d047b480807b61047c0d8bdc43b4dda5376bf754c0d',1480051463);"
-"INSERT INTO blocks VALUES(1037725,X'c53e323b2fea0db02c9d0f89b68c96f2b773a28ffbd0c9599f15000000000000',993148613,X'59de4e79d247af5f89a7debd745e19f9816583d281268ec57b110b997c456695',1480451032);"
-"INSERT INTO blocks VALUES(1039740,X'75ade5f365e91ed393b763f01ae0bcddf2656b8ffa90e5327222ee8d00000000',-203051659,X'fba91226c0bfbc6e64a0cfcd3944a1cc45b0fd61cd1345a597130953c0be3b7a',1480850913);"
-"INSERT INTO blocks VALUES(1041755,X'301a103e84ca803ce7b522ee7bd2a56a13c40f844ada98bd1499842100000000',1041242672,X'6e6e1d4ce9ce06558c47d3dfd9f53684a161db4e32035bffb83221fd4271a175',1480855756);"
-"INSERT INTO blocks VALUES(1043770,X'4799bbe79268a0d42ff5ea03689afce474affd520733f1392a4b8f0500000000',-407135929,X'e19c5ce8d78b9f26a47f486bf979ad1807c77153964988edfaf004ceb63e34bc',1480861214);"
-"INSERT INTO blocks VALUES(1045785,X'1388f178eb443714e7380f676ca608ebd3d0756edd69d7a777df620100000000',2029094931,X'a3d682762eee98b7f2167d475837578f635dcf785dce7e666b17a3523f5c929b',1480864375);"
-"INSERT INTO blocks VALUES(1047800,X'fed382e0c023119d49f6fd5ef516a979a3b4aceb993b2c0bb5632f0000000000',-528296962,X'93ef191a879c7066528f34e5efdb62198cae68b948bd3c3d80d14c46cba880a1',1480869580);"
-"INSERT INTO blocks VALUES(1049815,X'260ceb5759b91317886157a0c9ccf56a6f981948801b8690670e170000000000',1475021862,X'9a9a8c2cf314fffef0fd0c43588052a890e46dcd774abea22f8cf8672462e61b',1480878421);"
-"INSERT INTO blocks VALUES(1051830,X'cb43c49b20547f2c6dd879b657acbe3a43aa45a6f834022ee692010000000000',-1681636405,X'fd1cf45b41b1302f5b686ca9b04531335ad0deef9bbf4435dfe6a3c551fb9f41',1480900795);"
-"INSERT INTO blocks VALUES(1053845,X'2478372d65b298e0d3537b1945aabffbed8c51ca0e86b27b7a25010000000000',758609956,X'884d019e4a6d733e8a0095932660156e114ede7622e197a718f8193081e9815c',1480941711);"
-"INSERT INTO blocks VALUES(1055860,X'7479c1b5d747f82fa92caefa4db6b4912b9e6d10ef421dc6580e000000000000',-1245611660,X'd842fc7a0fd54ef19439c1208e246c7ca21f4c6a823cadf1c486872e0467801d',1481144541);"
-"INSERT INTO blocks VALUES(1057875,X'78fb7d0f94f8bf53a8f5c011198d48bb6fd3d151c46922fd5d0a000000000000',259914616,X'dd4977899335fdb8386908cf0a8e80a1b91bfe674cef492e7997ec6614458055',1481408872);"
-"INSERT INTO blocks VALUES(1059890,X'ab1caec36ec7ea75e9b5e55e2ae461af50631b576398448c9507000000000000',-1011999573,X'521091544e4e48e926a104c076c87490516a014a655a864f82c90e3a59efdcc4',1482077903);"
-"INSERT INTO blocks VALUES(1061905,X'b6b9718dccd2aeaa8637d78da469ec84c2f23449340d07650101000000000000',-1921926730,X'80fefc8f59b39d4576b2d966106402416f1e1d3dc17db5e15c7c4f2106fb6a6f',1482808262);"
-"INSERT INTO blocks VALUES(1063920,X'5b2d18a7dc4076e0429e2e28e4bad4684f3970dc21d9f25c2003000000000000',-1491587749,X'8bc9cc93c8c9330ab0e55bf493e412d74249c73ff82c01d5c58b35c20e6503e2',1483816274);"
-"INSERT INTO blocks VALUES(1065935,X'1562c9f4d078b8e48d397659b4eaeee3967e329ea4fd441b1819d65a00000000',-188128747,X'470ab4e28f5d4efa724129b75ff1b03a8d7dd1c1dc78d97809ad5ee6ddb430e4',1484301039);"
-"INSERT INTO blocks VALUES(1067950,X'479d0479e8951194159c4e71cbb7a67fbede7583664d7fb3b3f2b70800000000',2030345543,X'b958781ca396a38a1b7437057247764a957eb7cd8b3a50dd4a53fbd40c597c47',1484303190);"
-"INSERT INTO blocks VALUES(1069965,X'adc7682b1bef5239a788547decd8aef081e9719845493f965a0bce0900000000',728287149,X'88a5653fa83381561043de7f7388a31728eb659f8e8d4a442bc90ca27e329ad6',1484307992);"
-"INSERT INTO blocks VALUES(1071980,X'c144b319d04a4e87f9b4ecbbeb89d11314baf9a819db2a6f58423a0000000000',431178945,X'0d3f369f87c732f1dead35fe6368f42758b41c6498464c9a13d0703f1eb36312',1484315580);"
-"INSERT INTO blocks VALUES(1073995,X'16994024c5da309c37c7a7e0f76b77431b6aeef94321646fccebe00000000000',608213270,X'2f5541c5e95e3b67bde5299cb4cffa1cd9336325bd71f0461bb331ae9df4d439',1484318606);"
-"INSERT INTO blocks VALUES(1076010,X'9c28706459c74a661594b222aae0d113cdb8894536e97b37ecf1180000000000',1685072028,X'cba2d599134e2dd0a4379b2aa52e80b887f371aed4b81be033a511d65f8e3b27',1484320149);"
-"INSERT INTO blocks VALUES(1078025,X'f5d2f859a459fe8e0519a9e120d06a84bc639e3c451389b3a64d0b0000000000',1509479157,X'd5f18338cb14fa6cf5a455fa49081725372e4c38684adcc36e5f29c81d77a3db',1484321153);"
-"INSERT INTO blocks VALUES(1080040,X'5e938ddf140b2485374e9994b68b7a4c6efb47c17738f61f1276020000000000',-544369826,X'33ceb58301e437d8fb2c63bc194a73365ed2ff6772fe28232265250d5aad7d5b',1484346707);"
-"INSERT INTO blocks VALUES(1082055,X'1ce3b4dc78919b12b119a4c11da557079af7b0ebfc568d630f6b000000000000',-592125156,X'fee0193941110fde4877d8663ada8c4753341ca843961b5362973b2f4cca0221',1484397701);"
-"INSERT INTO blocks VALUES(1084070,X'39ffe25a5ae5bfc457df94999475e8b28f326ca5c8a1fedbff1f000000000000',1524825913,X'45bf3a7e0a008c0ef10780221fa444efab26a409a447c2eb90296c94470142d6',1484612900);"
-"INSERT INTO blocks VALUES(1086085,X'17c293e028e994c6790e6325b001e42908954bb6275d479db508000000000000',-527187433,X'0a35353c667393f242eb52259194b332bdeed467495ba2781aa6fdf9398bcf0c',1485265823);"
-"INSERT INTO blocks VALUES(1088100,X'8403288afb1f0387806d45606d29dd69add371ac40f14a69992b03ae00000000',-1977089148,X'e155ddba559e077e073d7a440e448fc3d10813d61584a559052388f7f2750b3a',1486627432);"
-"INSERT INTO blocks VALUES(1090115,X'd47e495fdb2939ba3b6735b762f944e7ebd1c0a1fddaff938109000000000000',1598652116,X'ddb73f80c0befcf57f5a65b9e779b3c24497ce7a55851547909602bc4d2c9eff',1487987954);"
-"INSERT INTO blocks VALUES(1092130,X'8b4e6d1376fb657500dc0ede45c338c3de31247ae01afa5c7001000000000000',325930635,X'bdeaed4a1643fd68d325394b8a5f68fd64631a2a7773cf7aac7d78a57a305137',1488750619);"
-"INSERT INTO blocks VALUES(1094145,X'9ee775ae557c92c4a344f03b83970eea256ca3f1f8fbd9eaa500000000000000',-1368004706,X'00a12b31aca7dc29c69f5ac19ce56c7d353e7db73422aa6c34b537b6dd69e714',1489739028);"
-"INSERT INTO blocks VALUES(1096160,X'e1e278b865c0d1047a90f2d0545d9d06ea53e7cefd8a8abe8c00000000000000',-1200037151,X'7ae146dbbfa50375b6b62d5cba4f0dbe28a2f3960204612668fbb8ee8705000c',1490254770);"
-"INSERT INTO blocks VALUES(1098175,X'f433a16bbd9d5d121e364838970d8adf3f912c62f035e54508920e0000000000',1805726708,X'57b5d60014ea997ef3ea57e82ec0c868ec8d736dde8ccaf91c62b7a0c6a20815',1490726787);"
-"INSERT INTO blocks VALUES(1100190,X'6b3f0b9a238030090fa42014fe08dadd71692a5af01caa182a5b5c0000000000',-1710538901,X'aa42cbfdd10818117b2a6fd0f1eeed3f847f4e18398c3591736b68184eaff97d',1490730745);"
-"INSERT INTO blocks VALUES(1102205,X'4bd0e12875e123853ea850d897bf0a07ce3bd181ff1552d75b51ba0100000000',685887563,X'b5594743a45279715263178204888aecb34c56bab8da9a53578375b9dbb13b80',1490734952);"
-"INSERT INTO blocks VALUES(1104220,X'1976b7a0cf68da68ec0e289464121b8a0b85f07be206b0853723070000000000',-1598589415,X'4f185b6ebfb362b199447770387197865f032fefe8ef88de36cd82bd435f3302',1490739270);"
-"INSERT INTO blocks VALUES(1106235,X'202c7a5820073ef10c0ce0a3c8782fa7614924f25c133c83d5c9780000000000',1484401696,X'a2e8620138b0e9da041e11567df5878a1638e56396e4e01eaed0fb0a2bab88c0',1490743631);"
-"INSERT INTO blocks VALUES(1108250,X'67f80179515d4e1a83350e936f7c18295b0976536da7dd9a80c4040000000000',2030172263,X'2e47054a3368d6d7f5da447b4a97d213629914bc633363fef1b3546dc50b10fd',1490749485);"
-"INSERT INTO blocks VALUES(1110265,X'ac3a6cfd24933bb5569d20acfbb14cde28b602d921e0cae65838040000000000',-43238740,X'9a8da131aa091a504806754bdd42ef26dede4a177bac847f0b518c908600cff2',1490757446);"
-"INSERT INTO blocks VALUES(1112280,X'906a2cac429a854cf52c7b72228b6c86f48dc594e6a57cd52112020000000000',-1406375280,X'f53189b686a9393bf0b5934d957437313393a10b21ae713d7df9e8bb56270aeb',1490781507);"
-"INSERT INTO blocks VALUES(1114295,X'b797bce143c3a712e453efb46fbf83573058560a5f9df2ffee0f000000000000',-507734089,X'6db2ed6567d3798298462a2fc5a4baa6f9ac334e803df67b8075915745b7817c',1491002308);"
-"INSERT INTO blocks VALUES(1116310,X'3fb9297729a9259d7e1e9ab0e749e87a394a4e2e846852d7181d000000000000',1999223103,X'c7778df8c6b1ee0ad0e5c5d211982bbec1282207b45d4a65fa64718b259bb940',1491508068);"
-"INSERT INTO blocks VALUES(1118325,X'5c387eadd3eed1414cea9f4d1a5cdc95778843f59a39f4b2e70a000000000000',-1384236964,X'a979491861d6c1f679ad81341ff0bad8356a653f5389ce01f05f5ab18f7d4fb1',1492146204);"
-"INSERT INTO blocks VALUES(1120340,X'85468ffe7bc0d95ceb6610d88aa4c52edf999f48e819fe268b94abc700000000',-24164731,X'a1668ef0edda21ef13fa60ff38138db22cf9b91eb476f51b9c3fab278e8d1191',1493373282);"
-"INSERT INTO blocks VALUES(1122355,X'5cd15b6d2482618dc92d910e00fe84fb9a058457f719ce8fb10b000000000000',1834733916,X'f276319f1365a80da1a1b97396819e0b947400652c566b45334df3273b63da59',1494604409);"
-"INSERT INTO blocks VALUES(1124370,X'0db62480a0c2161527888023e20a73ade2daa1ac9dd524837209000000000000',-2145077747,X'8aa19c69afa7e1711bcd87ba3d921400992a653e85d053a91431f3eee4c1731d',1495088901);"
-"INSERT INTO blocks VALUES(1126385,X'dcbfd64ad0fce4460b0c3dd0392b982d66b58297b138f5223100000000000000',1255587804,X'b9e354f37f5735ee960ab4349c913e959279824f0f174a1f82461f7e10edf4f4',1496398215);"
-"INSERT INTO blocks VALUES(1128400,X'bc5bc39fb9e0955af8c8c8bcee8d77f4c105825431b2a8dc5f05000000000000',-1614586948,X'7f783cbd3ab11d38ee55bb3a404625949675a4e3174f4d465439ed0ffbea6637',1497322302);"
-"INSERT INTO blocks VALUES(1130415,X'f3d3c225d71a6e29768a774a7cb2f2536f7bda89a760f4c45fbd2a5000000000',633525235,X'67ea78e64cdf9aab989a9bb2c67f2f438023fc328ab0e7bf3aa5e807b7bafa45',1497768816);"
-"INSERT INTO blocks VALUES(1132430,X'c2ed825774319a263eb1c3f499ffa4f05bab400af9848eadbe71020000000000',1468198338,X'ab554c1473576ba168fc0bb2f46eada70d9bdd169404634c2e24751d8616a5ca',1497785408);"
-"INSERT INTO blocks VALUES(1134445,X'4d79a8859804aeed6ea2eb6d15f34172ca5b25e23c5fb6c2fcaecd0c00000000',-2052556467,X'2ff96d05fb2d1dded652cffcab85126abddf545768dd4df9b20a7dc70d7bc9fd',1497795682);"
-"INSERT INTO blocks VALUES(1136460,X'3687ce30cc3f234fd5e2bd4e97cabb3472c3f40a3c2a4deca197050000000000',818841398,X'ac3057a8650a0752cdbb0295ae4b1e78cfa21200863eea2589f37f85d6e5bbc5',1497798019);"
-"INSERT INTO blocks VALUES(1138475,X'3e0a656a9d07425c0444f249c11ea983b03362bdcf3b20b2094bc70000000000',1785006654,X'8f8fb181895668abe60a1c54be8d0aa59bb887e53834d02aac3acf705acba2e9',1497799475);"
-"INSERT INTO blocks VALUES(1140490,X'339051db6002389d03075435bfdcc1008f86b59157a3775a41d8070000000000',-615411661,X'f98112a982c60d6b5e7d5249a815c46b0355618d9a655899889707b54be7f9c9',1497801406);"
-"INSERT INTO blocks VALUES(1142505,X'aa3a08bc4c75909d0d29f276950ee342494bf1e452288d5df3f3020000000000',-1140311382,X'83e9b441e94428870c5089a4357f4b6325843e263cb3031abb7b283ec207a9e9',1497813451);"
-"INSERT INTO blocks VALUES(1144520,X'a1f9ad568861e3c4bde33e983e1fdd15a03a25d35c92dd8773cf000000000000',1454242209,X'e6efef1ca3516ab24c76e5557686e2ff542a6f59c7b6efd197ce02ad2da5d23b',1497830748);"
-"INSERT INTO blocks VALUES(1146535,X'10d4114b5eeafd1290574579194848863c6cc1d02a23d51f671d000000000000',1259459600,X'4543758928f926e709b9a4fdeab70de6ce24b39ad11aca4842fe3c4056483a08',1497922931);"
-"INSERT INTO blocks VALUES(1148550,X'575b752b5e62a720866a29a1ec55b100dba3cf1a922840bb2e04000000000000',729111383,X'1d22e16f95db111072b5e128830e7bc33e8c1c3a4e3da78014d2b50388e11236',1498620662);"
-"INSERT INTO blocks VALUES(1150565,X'3525e4dea13dfca2e30fa34a2246e4c3372b5711713840d55c09000000000000',-555473611,X'26107615b426c05c193cd7b6e39d022968927799958249aa7bce6dae7efba83c',1498884232);"
-"INSERT INTO blocks VALUES(1152580,X'12291a488a83dcf1331a456b88775ccaf04230769a522485bc03000000000000',1209674002,X'2a475854328d72465b68231d52cd2a44350322c66de5fe9f60f7dcfd52ddf3c8',1499746321);"
-"INSERT INTO blocks VALUES(1154595,X'084212244164300bb9bfa2afeb5d0f75eff1ee5fb3cca243e67c030000000000',605176328,X'891f7c2308c711183c16b45d328245056eb79864982458997c8643304639e81c',1500765181);"
-"INSERT INTO blocks VALUES(1156610,X'76abfc58202039eba260b2e065d5ec59bcef6c9cfec3d55d4a05000000000000',1492953974,X'9bd2b6b36e0cc7995c5fdf97cb1fed71b1181186f06730912a232e688bba07aa',1502097080);"
-"INSERT INTO blocks VALUES(1158625,X'007a64b5faed7854a92cd67205c09e4e3427cf06069fed070f73030000000000',-1251706368,X'0f827126083e9563ecca82b41dabf1be6f7042c4c1ef45dda6ebf6cddfa6d305',1502446464);"
-"INSERT INTO blocks VALUES(1160640,X'dd789db17d4af95cf0fa959bef62878753564ba28f9b191370e7010000000000',-1315079971,X'6b40682b97bd4ec4fb26f902694234d8be8e3f6cc17ea5ca4e6eaadffe070067',1502454328);"
-"INSERT INTO blocks VALUES(1162655,X'fd190b3477c7b12fb03c51ba8dc750235b89dee7ed196378eae3020000000000',873142781,X'22dbc28238a40b78a022b29453d37cee67336f0a5185b8e74c9346fdf0cf24fd',1502461984);"
-"INSERT INTO blocks VALUES(1164670,X'c43ae5dde859e1452eb20aecc87affeab26493d1dc8e8ca8af2e010000000000',-572179772,X'616735b52375cb1835e50b82febce938fc7bede262d03e98aba1a697edca911d',1502469678);"
-"INSERT INTO blocks VALUES(1166685,X'34a231239aa1407bcc4fef345e4fe9ff9088c651d7723626029bf80000000000',590455348,X'5dd54c60f178f0e0f9dcb2eae0fea8f98c24ae62ab958c481242da7f098ad520',1502479264);"
-"INSERT INTO blocks VALUES(1168700,X'd0b840055d5066c1252093ea5c3212dfc3d894fca756e73cc3392d0000000000',88127696,X'8ab8fa6044db481cad475dcaf8e6f4adb1e3d06bf66aa368ca20339a475e9784',1502480042);"
-"INSERT INTO blocks VALUES(1170715,X'1a7d348f93846e5e8e378aff849f2eff5b29deaf30a4d0c800a9080000000000',-1892385510,X'cc004c2339d39abf1281fb2cfc2a7509eb624ebe08d87853d029fb001dd01461',1502482487);"
-"INSERT INTO blocks VALUES(1172730,X'62f5cbfd4ad4fcf5c2c5c17ce01d6dd0104bc66af61914e1759d010000000000',-36965022,X'a0b55d155e5e6d2b35b63f0ea6046927cebd6d2b997b742fae6fd6ac28af3f38',1502490670);"
-"INSERT INTO blocks VALUES(1174745,X'7ac8f49f5ef024c6bc1982f41ae9b27a1df3622178335a00ea3c000000000000',-1611347846,X'6adbf26009d9e9f274e506e6e5853d25dd8fb73ccfb769e5f119817dd8c1419f',1502513976);"
-"INSERT INTO blocks VALUES(1176760,X'7df8012f8adf4b1fc390eb6b386ebd550bf1780d3af0fe3af02a000000000000',788658301,X'81512488be90ce85830374d173e96a7184f79ae7551040c3cfc92cd376b5e0d5',1502581034);"
-"INSERT INTO blocks VALUES(1178775,X'9698e3c25f9485d6d5a06fa14be71f6b22ac43fd7bf55a459502000000000000',-1025271658,X'37479af6d7176a246b535173c09e45501c15e7ba9310c4a63e61d5431b4e4163',1502917027);"
-"INSERT INTO blocks VALUES(1180790,X'41b20aa29ee064319754e2b55508e68725da16a1a7f537a4aab5f3b300000000',-1576357311,X'99d42ebd2805d91f0107cdc3383225312ffdd7f4497b0f28290dc65cc5ffe96e',1504276791);"
-"INSERT INTO blocks VALUES(1182805,X'f477245f20e95507cc550c0ff8f15d0aec81c0f46790dc54c2dd5d6800000000',1596225524,X'6a7009b8bb82636f8db313876dab66a0b64c32171e66f380535b82243611a3dd',1504918778);"
-"INSERT INTO blocks VALUES(1184820,X'ebc84d0e23ebfc1584fdd0fe09a8fefdcaf37ab3e29d910fb222100a00000000',239978731,X'5aad95664895366d90faa796cdec98fcfd43bbc6cfcb006664ade8bfb9ffc475',1504921802);"
-"INSERT INTO blocks VALUES(1186835,X'7ffba0e6efc698c35275929cc29000e50e6d0c5a04974fcee3251f0100000000',-425657473,X'be664882903f279f424102f9f764fdaeaa439ee75549e4b5b9bce8b3dc0ecebd',1504927141);"
-"INSERT INTO blocks VALUES(1188850,X'8932bdd0cf43470f4290783d26f7573f7af848be76f2d63590daa20200000000',-792907127,X'bffd6a1f94936fed9aea41bf3996c1ec7d32575e0ab706642d8e51ddf6b6e158',1504937091);"
-"INSERT INTO blocks VALUES(1190865,X'669041d7fc643c9c1a5126f8dff0c9c0ed88a47b14a505dce56fff0000000000',-683569050,X'de0a87ef9f69d2822640d3d2f098daf4a10c64b676fe92fe89888667fa9c41ee',1504964469);"
-"INSERT INTO blocks VALUES(1192880,X'909b998c5175cc70df083a6d465533e4f719ae1594946c9f9f283f0000000000',-1936090224,X'7d82acca6b6b72222af9994e82593cdb80b71892be4788946705ff1559702428',1505085379);"
-"INSERT INTO blocks VALUES(1194895,X'967a590f025e69877f2f7931bb26576cd4aec28de820cef26c5c030000000000',257522326,X'91f928c5b0f3287e9388e4b0ee08b860523baf9b14181fe9c19af6e91648f4e6',1505293407);"
-"INSERT INTO blocks VALUES(1196910,X'be0cc266ed82ffe037be84c40134116b95e979c63abbc062582b000000000000',1723993278,X'acbb3f7ccb22754bec4bf8042eebc06263ca5cd57372e41e697a1ef5660a9cce',1505959752);"
-"INSERT INTO blocks VALUES(1198925,X'310377cbf68266e4ed31b8a8c749d61056a1b7215928f0cfadfa010000000000',-881392847,X'80a73ecf17eecbd5961f9f7a76dd9185605893a7b6d4063ba0df9bf1232f4c99',1505989844);"
-"INSERT INTO blocks VALUES(1200940,X'7f5e45b87a0aefbf3910e70ebe472a45dd5c3fcf4e4459984c47000000000000',-1203413377,X'f39fcecbdec8208d636ea759c0ca3ca733a77422615011b568cc7a0286c00730',1506143340);"
-"INSERT INTO blocks VALUES(1202955,X'57790775e0407c073a3fd95880bf3cec27291fee6369e7179cccbb5700000000',1963424087,X'0eeac47be9c953feb542e10933f1b0921386d78ec325429cc50f5737dd250474',1507066320);"
-"INSERT INTO blocks VALUES(1204970,X'59310f07dc6df7763ddcd9234ede1f7c5a3fdbacea629080e102000000000000',118436185,X'832ae28c1cc5bc223243a67a067255ed3d4d9f275dfa6174f8c41f01e571b77b',1507161360);"
-"INSERT INTO blocks VALUES(1206985,X'1ca5f193a36a81b80c0abf45ae87d8efb6a181a6e594a82b1c05000000000000',-1812880100,X'b05831acaac1a2ce49da1f7049dc34f0dc4100ff833a49940357462512ddbe58',1507186403);"
-"INSERT INTO blocks VALUES(1209000,X'355463bcaf7abb1b950ccba1563fcf8e5d6c9b5c423682d1ce00000000000000',-1134341067,X'ba199f17070d153d57253a6ad1a1fe8515adf3ffa514275024d2a95132f21881',1507305617);"
-"INSERT INTO blocks VALUES(1211015,X'e05547da887d3c9e8724536bd46165bf770fc30e9b97b5e1100e8edb00000000',-632859168,X'3781509cf782b012ec4f4ece32cd1660226f4fdce8fa1a5204d9a38a26a7a571',1508930794);"
-"INSERT INTO blocks VALUES(1213030,X'e57e04f0e50bfa290f99c0a443af9bc34258f8c8e419354fa19018dc00000000',-268140827,X'38c00af9a74de94dccb16d1420ee3f145b163b64153a8987ec513e7bc467509f',1509645714);"
-"INSERT INTO blocks VALUES(1215045,X'47b391d46c9fdc36b0ae54c557ffee466c553fc1425598b12e42592400000000',-728648889,X'ec5b16332f0cea3ecfb174c8bcfce5212907c6d56e0b090fcbccab8e9ecec643',1509646953);"
-"INSERT INTO blocks VALUES(1217060,X'd791e07e553ca073c8f142bd77323a2aab151a7b5c156057fddcfa0000000000',2128646615,X'739660f003eb81d1b01cf4b403327ba7b45979c29199cd094995e91da128c621',1509649359);"
-"INSERT INTO blocks VALUES(1219075,X'41755f512773b6327f3fc1e19fc3b621fd937b770605c5cbae04a20000000000',1365210433,X'46851d972908929d92faeb2f1557f78a76a68b0387f825c9eea2dba846a88d36',1509654686);"
-"INSERT INTO blocks VALUES(1221090,X'f522cd7fd902332482378700cbdea477456900de13cc63047d81d80000000000',2144150261,X'bd20d5dc842d028533726f70ec86bb3b79f4d5d7bf90bc9ee13e46f80b96e0e4',1509667573);"
-"INSERT INTO blocks VALUES(1223105,X'92044de83bf45215410f26773abe670aca6f93cf5f4b4215fbda200000000000',-397605742,X'667c6cc89db14c8d892053698e2402b4119b4f28a8d194293f34a31ff6c57c90',1509699612);"
-"INSERT INTO blocks VALUES(1225120,X'31b0ad5488cd21b4be4134c0cdfa61ea8c0cf22f27b9397e6c080e0000000000',1420668977,X'c43c7efe751c8d2cd7dae5e46f408e7ab07a6ed83368dd2beb4475ebc9840d12',1509925444);"
-"INSERT INTO blocks VALUES(1227135,X'e78d51cd528bc1521559233a91cedbb944ec12f8bae0fd0c3ca9020000000000',-850293273,X'014209a8c091d400e293712de6f4c20f06b00bfa5683c8c671749f7e2f8fc5a1',1510197160);"
-"INSERT INTO blocks VALUES(1229150,X'57dc46ee71c7ab5aa3f5150da1dfae3e3a65434bac4686ceb867000000000000',-297345961,X'ec2a9fb8d2745c1c9af860232b6711e3b014f63866ae9e0a1756937f0ae94c45',1510311131);"
-"INSERT INTO blocks VALUES(1231165,X'16a25c0f6decbd1abd03d2c47106717b4c3a43a8b011a4284a38f70400000000',257729046,X'9088b3340c8534da784e482d421cb8c59a4f82d018c5b7b54a0d458e5a2b6212',1511225149);"
-"INSERT INTO blocks VALUES(1233180,X'd7cf1de5d0dbd1dfcf23839672b4870050194c8b6c0ee755793f349900000000',-451031081,X'2be08775cd1fb1c5bbae3f81916c8f4cb32ab106d090c61715f12ce8e18fb46b',1511616314);"
-"INSERT INTO blocks VALUES(1235195,X'3c7b569fadaa21e4f7363958fe72c221290f23e575ed9153bae1192300000000',-1621722308,X'f0218df22b6b55d0a57569df22be4b2faed0806de9848f2e4d4b8696d49d209a',1511620586);"
-"INSERT INTO blocks VALUES(1237210,X'e881b999daca4424d6c0ebc6c3ce7c82f75668c4f5a1abde85fd0c0000000000',-1715895832,X'92ece16b58a1ef6095797724c5c706739011e06341f4fd8cccec68e378078d82',1511626006);"
-"INSERT INTO blocks VALUES(1239225,X'b14d90dedbf6e754c6afdaec093db5fa05da0afbed872cf0c071040000000000',-560968271,X'dc509198aa0435a437e76fbea38b6458a92d50c1a74b13d169fe022ca601254d',1511635013);"
-"INSERT INTO blocks VALUES(1241240,X'fc979f2348e1599243037d337101d8ae7c341f55584a57e5968d900000000000',597661692,X'0438892915bdf5f2becb30e2d3935b7f806bdbd5569e8608e5266bf298a0e410',1511654747);"
-"INSERT INTO blocks VALUES(1243255,X'2d994ea124a9eb9ad7f208a7728a7efd2682aa3b806b2ba22c0b140000000000',-1588684499,X'fcf6bdae6758c38e40956b0c405fcbb3050a7d85c456c41b2f461342571161db',1511700248);"
-"INSERT INTO blocks VALUES(1245270,X'b06d46be8ed2284178802ae24c8d2f0e862be30d9e7a563ac23b0d0000000000',-1102680656,X'a13fc89e8d1fe13f54ec72a5eeae17999985cdfb76e8b77f03d2e51a91b83322',1511709199);"
-"INSERT INTO blocks VALUES(1247285,X'8811bbf096d014f3444b54de0d103b497a3e3e6c6a3706435cd9000000000000',-256175736,X'938bbabcdddebe50e37a877e0ccac9aca1e00f6a32d475c71857f088bcd7c01e',1511776577);"
-"INSERT INTO blocks VALUES(1249300,X'4bedb782db7e000e1031394463d7a223cf93843f5e1ada4c4a00000000000000',-2101875381,X'3c1d2a1763e5cdbb8253026da0ecbf2d3683e795a595fb850a34f697e22ed79c',1511902635);"
-"INSERT INTO blocks VALUES(1251315,X'c65a24ec2da87c8da4d76836aad4c5801cedd400a887df4be835000000000000',-333161786,X'593f54c29dcc3d4810e7a238cf39b2ed3263aea93d1e0da33aa3a7555944685d',1512065386);"
-"INSERT INTO blocks VALUES(1253330,X'beb3218083c137f650af90bc8dd8c4804fbd61934cbf01577f08000000000000',-2145274946,X'ece771ff748e2ce57bc707034b8415c9a76d4aaea001c9d090340f6e5147074f',1512403340);"
-"INSERT INTO blocks VALUES(1255345,X'd244ecc99dbcc387a5030286aab9ada624af8926e479b9525c04000000000000',-907262766,X'156c8a0dc8a9ba5b3c26ddae502552c8d75d4f1715181852ec1e8de77cd2ec95',1513666356);"
-"INSERT INTO blocks VALUES(1257360,X'a9ca1b194f570280f69dff3bc0cbb8b489f39866c224d00f7a03000000000000',421251753,X'699c8401e4ee5f80a5c804fc510aa91785731efae087fb65b2b5fcd1bc18f113',1515034939);"
-"INSERT INTO blocks VALUES(1259375,X'b0c900cb3b2e70219392afdcb4c36a3997aa52681aa32bc8e801000000000000',-889140816,X'cff92e7cbdaf89780b3d65bd7511ea11208e56074d311a9b820590205e1f76f9',1516157016);"
-"INSERT INTO blocks VALUES(1261390,X'9b89ba71fea04aff6ba8ee40bd9397493c5d01e408120066da04000000000000',1908050331,X'8fe7e3fe1a628387fff0e3f06392cead776f86ddb43c8b952a55425bb0c41915',1517332914);"
-"INSERT INTO blocks VALUES(1263405,X'5062ff619080851ec86e82a5e611455644ce6d1650c7601a25dc8fc100000000',1644126800,X'7f97aa3890c6ece6d41b60e7e408998f4c70ba62de85102dc9da9146e6107a3a',1517700381);"
-"INSERT INTO blocks VALUES(1265420,X'ad9b27c77381b61ddee984a356230770967a75974f4a01015828120000000000',-953705555,X'5755b766ca84810e4be333f13eba988a784d53028a1fdcdcf8d715121b04bf2c',1517706333);"
-"INSERT INTO blocks VALUES(1267435,X'fa86cf209e51466de3815b838c08c74b378ba6c68c4f698a877a0c0000000000',550471418,X'52393cfad764d4f263651b9db55a4ca1632b4bf5112da5381ad11658cd9748fd',1517713998);"
-"INSERT INTO blocks VALUES(1269450,X'17242d87df85c372692ddfc6684d148bab83f4e2410f9e1c6d27130000000000',-2027084777,X'2f186c2cd394ff3eb22fe4bbe35f0efa13dab46fe9c632e27d3d836e8a4d40aa',1517722528);"
-"INSERT INTO blocks VALUES(1271465,X'2358c2b4f8e3964fc74b883f218d214a2f50805483868a7f6cfe5f0000000000',-1262331869,X'c65a3c52abdc134d962d23a75e06b6021793f7b18f6a869d7bdf02478fec8f16',1517728408);"
-"INSERT INTO blocks VALUES(1273480,X'3a34c4fcfd3818476b7317c9b4342eb8010cced97d2da92e0af80d0000000000',-54250438,X'6f3892e2522ab4a01f2a408591f3af2e1da98d9dd77621b91973a1e3c3b12d37',1517735408);"
-"INSERT INTO blocks VALUES(1275495,X'0fc0cf1f5be0bdfff8e0fc065dde8f9ec464352de2bf02ee5351080000000000',533708815,X'a37ec9189266c91479c1b1644ea874a3e59063402214a2d37a1e192c8517708b',1517741059);"
-"INSERT INTO blocks VALUES(1277510,X'43b1dd3e1c3d2a4a1c47e66268a534e3d7147692b1743655a015000000000000',1054716227,X'3e9fb51945ce16f6e7717910cd5dfce7a221ed7756a9a8ae02ff3063320e94f4',1517871389);"
-"INSERT INTO blocks VALUES(1279525,X'e36ba4e97b7585c299f7849ac466ad6bf23ff95e3237ab6b3283000000000000',-375100445,X'5ee32ad7a9d3ef7f9f9d2805b0a6b19598e32d8092b834dbddd13a62f2815894',1518053709);"
-"INSERT INTO blocks VALUES(1281540,X'd8d92d33967eb371f03188c5574e672990970968c98b1480eb33000000000000',858642904,X'77849cf8a6df6b99efa72877ac0a3172daf6eefbfcc90fd979a7e2d3d8555c9a',1518406767);"
-"INSERT INTO blocks VALUES(1283555,X'59256187a8902c2da75d6ef1ad18e72d3e3e6f8eafc7c720620e000000000000',-2023676583,X'78bbbfffa7f1451723fab91e5f973749d8adc596a2190b60dd8bae65d17fba1a',1518990702);"
-"INSERT INTO blocks VALUES(1285570,X'828faa6e02648055bb03fc61158ac930db6e75a5ea8f15012d07000000000000',1856671618,X'ce8c7815ddaa8fcf511a6df3214540c746969d69f4953b54545c85b3c1c732a5',1519497035);"
-"INSERT INTO blocks VALUES(1287585,X'8bb9866524ce96bec9d7c69ab2d66f080209252aec4f2ff6bf00000000000000',1703328139,X'a39fbb5bf931ab8ee4bb9da09650e5d392e7a18b3b4a9a4ebbb6bf800e624416',1520447998);"
-"INSERT INTO blocks VALUES(1289600,X'f4cc57c5c0cd205e116c6d61bd43af64b83d40717a8c2ddb9502000000000000',-984101644,X'5701e2422ac5bb7e19b096305a19d08ddebb48a55c91734e4d69e75512a7445b',1522350241);"
-"INSERT INTO blocks VALUES(1291615,X'19195a8c3d5054acc09c9de6f0a6676bb2dbff5f541a5c186504000000000000',-1940252391,X'd67962b8a9796bab46436f0ddd0b436f0a88c1921f05ded7f7b7ae3754af7160',1522975241);"
-"INSERT INTO blocks VALUES(1293630,X'8d51327f2b544a21bff374913beba62afd75fd73f94ce5574ef5d03600000000',2134004109,X'f718c2ce2a9f9c81e54eb2d5f31a5f3e918a759c1d62ca8479ccf6a7900529a5',1524224966);"
-"INSERT INTO blocks VALUES(1295645,X'40f9b7c1167cf6b5eea99f88e319a4e4d3370f13c74969d60d00000000000000',-1044907712,X'587803c5fc7957a387886d4e390d1234bbeebf48cf103a63e1befe51124b1e4b',1525175736);"
-"INSERT INTO blocks VALUES(1297660,X'9d5c08954c3b12c8643d9c0dc3c64a5d999eac8b872630b60c00000000000000',-1794614115,X'1494ae54d7dd0e0877879c87730a661aed9bf5588d8f681ea9316aa5937f2c11',1526343976);"
-"INSERT INTO blocks VALUES(1299675,X'93a9d930c82e580112c3fea57193b70b07721493e8c18eadd07f391c00000000',819571091,X'616f12fb864d638b34cbb3ebeab86ee929d8ff8245e08dd553f2eef51f5e3f4b',1526965872);"
-"INSERT INTO blocks VALUES(1301690,X'019fadb3bb6d6702a1cce2ca74142339816f5be45926229b9578991600000000',-1280467199,X'76a2c2aa92ef8fae1719283e36931a443425ae87695a178559067134364f05e6',1526974468);"
-"INSERT INTO blocks VALUES(1303705,X'bbccbf67d54c41c37b73d3e37ae706bdb3e7c6cd302d167843f1020000000000',1740623035,X'25f3b9f057536ea4b03780c2324b4a8bf21f640f457aa79c624d783ce0a8be33',1526986124);"
-"INSERT INTO blocks VALUES(1305720,X'02e280be77cd5f5a0b24eca4c9dff476b8b2af4abc8682872d5c020000000000',-1098849790,X'44890ed2b344ff659a8580df75559df05d5cd6c37912ae463e30e753377cb812',1527002676);"
-"INSERT INTO blocks VALUES(1307735,X'78197ed5b21a5c84316985438c6a34f0bd8eb75e50749b0d15570f0000000000',-713156232,X'd42d349d4b3cfb53f0da80bcbad83587eef9aa5e1078c709adf501ae95ee818c',1527022717);"
-"INSERT INTO blocks VALUES(1309750,X'af4dc2fb1220fca8598ab50ddbdc205a0e754b17fc571581fd07030000000000',-71152209,X'df9a5a36f6c1264aa3890c4c25d0dfce485c3b4cb9df832c2f008b5142b50195',1527054495);"
-"INSERT INTO blocks VALUES(1311765,X'b9025b99e42dbd7cd46401df585970ae5feb3bf8b3b58ceedf8e010000000000',-1722088775,X'299e596ffd22b88f3afbc5994c80ccab5664f6afcb36b19d3ab7a1b2baf6a4da',1527081929);"
-"INSERT INTO blocks VALUES(1313780,X'a7dcbce9a7c1940d1f4e3acdac876483df3cd60f67226ecf9bb1000000000000',-373498713,X'af4b013e9506ac89759d9e38cefacd5ad16a65ce6c5b78b5998ab4c4958791ac',1527137141);"
-"INSERT INTO blocks VALUES(1315795,X'e9b889597e533b1423d1df052dd4f554f03e17a795135f76ab08000000000000',1502197993,X'd545815aa85255e027d34c605124af55d5b5b7ab957a2718bfc8d6c31608ecb5',1527453901);"
-"INSERT INTO blocks VALUES(1317810,X'1a4d78f99e4221e311a6401608a355326abe2d1c3e5c50491710000000000000',-109556454,X'0f799cf9de62ad1f27c420a9a50da40a1e88096db77e6a15317a88f2445b040e',1527656804);"
-"INSERT INTO blocks VALUES(1319825,X'0399aaf3dcc4705e2639d1eecbaf0c6a03e1cccf0f6b173c2b07000000000000',-206923517,X'29e933ca23a43f69c101f33f526f1b64da5b6f235cdf2d93b41742da6e02aded',1527758057);"
-"INSERT INTO blocks VALUES(1321840,X'b9dbf3b34cf37b3a24d417f50011a89ea55f6d4fd5e120414300000000000000',-1275864135,X'10f6cbc6d09f438441d888335780141fad6186c5ce48fb3244c845ecb2f58fa4',1528079111);"
-"INSERT INTO blocks VALUES(1323855,X'9113e9284cbe873edeb14d30659f6a0f6a37ac816604df7b2e00000000000000',686363537,X'8c00b79b13d5f82f50cefba608d9c61212681c9af534064168525b648e2f3643',1528286007);"
-"INSERT INTO blocks VALUES(1325870,X'28b24c553a64a0d45583c4d04c3762d7e84d1a7372af8d4a4854ad0100000000',1431089704,X'3e970fa91222eb5f5f1e2796b5eac95e2601add89e1ab2be98ebe65e4c9e82dc',1529436650);"
-"INSERT INTO blocks VALUES(1327885,X'6b266dd21d08587f8fc6ce09d6b23026175ec1adb0e888977b80ee2900000000',-764598677,X'ee9cf3290eb1c4e8a88de3170ff8edd4572aca99bc66fad99f9c8405e28768bb',1530148900);"
-"INSERT INTO blocks VALUES(1329900,X'0b77e9ca659b386001c93feaa3a04e250047ab5c6015b39523bc372800000000',-890669301,X'5a9d4e377a23c98c0baee2c725f27d28d54ba030a8079dda8c295bfd4b29139e',1530150854);"
-"INSERT INTO blocks VALUES(1331915,X'e97bd2aff6aa95a883ffd9e265d06ba9ed6af0b96091407bb693000000000000',-1345160215,X'bd84c676bfce97a619131d1f60b1e6f79903423b4ddf0890a328bfb95bd916cd',1530154488);"
-"INSERT INTO blocks VALUES(1333930,X'd9e89188a45b0fa5a932e229b920880ab22c8ae5ac30fdb42b13000000000000',-2003703591,X'befa79fcaf45dd106f5937cb5c19e556987ba794b0da5804a97989b5e4dff6b5',1530159833);"
-"INSERT INTO blocks VALUES(1335945,X'3ae09897850270d3fa1f4b2b2cd41a3bba57da9cd3a13c719222000000000000',-1751588806,X'afe68d7f2e9592bfba091962edf1c7c9ecf330ef8ae2fc71b59dd191321ed684',1530166568);"
-"INSERT INTO blocks VALUES(1337960,X'fa35a2c68ab82c7613ca32382dfef590208b2e0f69838cf67883000000000000',-962447878,X'360faf28f883441ffacf76cac0e9266f88b1566f038d30819bd0c5b026637061',1530173299);"
-"INSERT INTO blocks VALUES(1339975,X'7d5ad7e7d8ace9e83d0094c8c7debee3d38bf56aeb8a1b3f40e4010000000000',-405316995,X'fae695e23c8d4cd32a3faee480a4645f268fa905b7cf0cdc46de8755f2de6758',1530180148);"
-"INSERT INTO blocks VALUES(1341990,X'e9eef1d0e47cc282e4bf06024827ebb5640ac2d9def7c1076a3f010000000000',-789451031,X'4dd983827712744982490c278635bef5c0fd36db7d6910476508380fb114ee28',1530187134);"
-"INSERT INTO blocks VALUES(1344005,X'a97c3a0a445ca33d16ee07468ed0ecd89e90b2cefabd6e896461000000000000',171605161,X'615612366a2b04225bc3f597a20e86a14d3fd41dff80e39241f781a26cb15b9e',1530198019);"
-"INSERT INTO blocks VALUES(1346020,X'49d2b929e59837d179803db2d2b9c5766fa28e05c5f62c049110000000000000',700043849,X'63509e5a8cb7ffe560ecd91f4ae0399596a56b61fac6499b5ec281c91811a0ad',1530236213);"
-"INSERT INTO blocks VALUES(1348035,X'740a5b85143455b05083de0f85eb55722faf341f9970852be80f000000000000',-2057631116,X'fbe39de64654e48d7c6dfc317bfc72dd3b61fbf8f91b88f8e9dab8eccf7b6726',1530392351);"
-"INSERT INTO blocks VALUES(1350050,X'dff678522ba098e241edd32e43989efe67b69f91c80c7ad58302000000000000',1383659231,X'fb195c087764cf024da4e2b015b80f6d6861b00eb1cf43225c799167e43988bc',1530721929);"
-"INSERT INTO blocks VALUES(1352065,X'74f4e1f370258cabe15cc73fdbae906f26eb968ef6b60954ba00000000000000',-203295628,X'70e4eba82119d6143c5e20c2081013fedd2ea825b0e8254d6e82315f32ebd1e1',1531063366);"
-"INSERT INTO blocks VALUES(1354080,X'd4959ff824db3e1cb4df9ace736377c990d323fd3626747c0200000000000000',-123759148,X'ce5566c0a366a7d080a4b55309b94b2695941ae1395e4a0dabe437a26c7ec71e',1531821445);"
-"INSERT INTO blocks VALUES(1356095,X'42f52924e0b34be028560bb8c3a1b21b23db3093b69ee7f22c00000000000000',606729538,X'16b2c05559f5361e4a31dcc073ee7325537a7faeba4eee58f4b8811c9812811e',1532908152);"
-"INSERT INTO blocks VALUES(1358110,X'1b0697c6070aba6265f3a9b1e56f070fca1a986328b11c94ac32c84d00000000',-963181029,X'82e820d056afc122b4cfef06a117da7586c7b8caf4bafa4fb9121c916a75b694',1533308692);"
-"INSERT INTO blocks VALUES(1360125,X'd0c47f610f71cf0040e71b857bfbe6a57effc7618056e8be9bc2010000000000',1635763408,X'277a731c32bf6ffad91879c4ef954a21516e267ac76de87b4502c96e30d7aa89',1533310388);"
-"INSERT INTO blocks VALUES(1362140,X'26acf5842b41c2e6cf3c6ed84c387ade87988f83c79a4514067b000000000000',-2064274394,X'69858bd20556b43f6ef8089c4c2a84635bdd5373e5269c03fcc860a4b4cdb662',1533312154);"
-"INSERT INTO blocks VALUES(1364155,X'45c87832e8636fbbcf5012d99fad505d7538f3a6a19574c4debc000000000000',846776389,X'53628ac85ed31b15fddaa019f9bfc995631a5444f23b60837daad4a3e5257dfd',1533313926);"
-"INSERT INTO blocks VALUES(1366170,X'36ccca9d8873b5cc748b2b4a9f95f9d27c18fa2ef595ab7888c2010000000000',-1647653834,X'44663d78212ecce08057031649eb29ac1d226948e708289b7d7a7f75b31daaed',1533315664);"
-"INSERT INTO blocks VALUES(1368185,X'1bc82844eb6f2695b548967c5f1f93860135852f2a15069e3dc3010000000000',1143523355,X'af483c89c078b81ae34c10eb82931c156f267e6946e0b320983dd454f05b43bf',1533317398);"
-"INSERT INTO blocks VALUES(1370200,X'c895d557564434bc8668040542b65cb38baa66a2a6330459c647000000000000',1473615304,X'2449ba0197df1bf08fcf702e280ee0d48f22b1f557877028821b2de86b074d3e',1533319185);"
-"INSERT INTO blocks VALUES(1372215,X'285320dcfe9b1fb79916ae6302aea0dac5130c6809d6322aa8d5000000000000',-601861336,X'ff31432fd88542ff9be16c6f2ac967e056c82f2616cbd7d72beff88a3c9085dc',1533321025);"
-"INSERT INTO blocks VALUES(1374230,X'80abaeefda672df8371e990ac53f7dbb8f781ce264b5367b41d3000000000000',-273765504,X'b0e194f28b62bc70a7bc48e4262fce523623feb12180b6fc61273b272ce65191',1533323368);"
-"INSERT INTO blocks VALUES(1376245,X'591836ab558efa42d2121e3147e6af5d9ab955b3b67e5686853b000000000000',-1422518183,X'8c552c59fb56478d60efa4208f1f32e024fdbee7b65e03e892ef26c8f74afdd6',1533330189);"
-"INSERT INTO blocks VALUES(1378260,X'7e53eb0d584480542f5af6d9ff8534d68c232f6e15c73cced109000000000000',233526142,X'a9af34608f5d73dbf0f22adebc7d97c71c9b1c1a527e30f8981a262b8dd3b144',1533355539);"
-"INSERT INTO blocks VALUES(1380275,X'0583157709d5da7ce0a221b3ad452f4a4fbfdafa0414c6c40a00000000000000',1997898501,X'cf852a6ad9baeec074a3597106eccd1a839eeabfc569b165ce4c15e46848e495',1533453216);"
-"INSERT INTO blocks VALUES(1382290,X'7cdd08c8a0c915793efc4f280fb1e18db53385abd62644c24400000000000000',-938943108,X'28babe085a0367a6312aad27d66f8634c1a9d17777d9e68a3945afeba8e9c992',1533797676);"
-"INSERT INTO blocks VALUES(1384305,X'803b9edd7655c22f7667bac8ca6dc0500c9d190addf5b1980e00000000000000',-576832640,X'b126a7a129ae2613521397cac894ae883af2e2b1a4382b822ffb07ec6b6b2acf',1534598397);"
-"INSERT INTO blocks VALUES(1386320,X'57c9dbecf58678d4c310084d11cfdcae73f3b2d13d86800cc543830000000000',-321140393,X'54e28b713712ba7a935b081aeaa83f51eb82780455552d1e7d631d024c8ba9d9',1534957324);"
-"INSERT INTO blocks VALUES(1388335,X'ad8cdd52ab747d3b7aaa8b3915019d91eab5c57ac8c4ec45c5a3bc0300000000',1390251181,X'9ec86c290fdcf3c5d08f826e627afa7d4f09e98bfa4f370b99a4c85d4b15b6ef',1534958354);"
-"INSERT INTO blocks VALUES(1390350,X'9e6af805bd6edeac6e76277e21448ac844ce4fe1f9b2abc652ba000000000000',100166302,X'bf30da46cb0cd11e83fc02ca9e77b2f9707c2edbd3f2e6075eb295d2dade2207',1534959500);"
-"INSERT INTO blocks VALUES(1392365,X'0890795f60552dad99e743ece8db5c4355d635cff22e69a6f73b000000000000',1601802248,X'81ce9f70e7424feb8a3bda01c0cd4e1d000068e51334e705f5e37e18df8dd312',1534961465);"
-"INSERT INTO blocks VALUES(1394380,X'7de9ab94572514feacab97a1285d319dea0176dac689362ae4c7000000000000',-1800672899,X'cab499eded31a84e4517fef185c6b21501871375fcab5fae551eeb434800be16',1534963525);"
-"INSERT INTO blocks VALUES(1396395,X'22847f2facadc10eb78b2dc88181e43d0364482c1a849cfb0ec0000000000000',796886050,X'7099199850eaa3a5ab9db7cca6326ef2d0ba3b7d3120f53286456bb064d8ab8d',1534965606);"
-"INSERT INTO blocks VALUES(1398410,X'f1aecaa8c580e43699cbe0c1ae3d16a6a44a08dd55171c47b379000000000000',-1463111951,X'ac6560fe1044c8358ef08ac749c0d3ca4dc79a5144d51429926c6ef06e040a25',1534967679);"
-"INSERT INTO blocks VALUES(1400425,X'3f51becc4367e168b331025d4c35b4e8b113edad0c086aac5234000000000000',-859942593,X'8b0d5b1152499a15627d9bd56502806542f1477ff66739c9b5a40b2f9a58514f',1534969774);"
-"INSERT INTO blocks VALUES(1402440,X'c5ebc823174639a4362d3fb2d15f0c1b69a985171cda4a276a3f000000000000',600370117,X'0c602a985aa665e979d23d5834f8f00603ffeaade94b8fd5c9eb915b6a32a46a',1534972289);"
-"INSERT INTO blocks VALUES(1404455,X'44a9d272c5f98b7b0026b332512eaa568ef518b99c7c4d850e18000000000000',1926408516,X'7637dee579ccc143e6accab05dfe64802372c2b2ccd0745dc776b4c34f8b9f63',1534978985);"
-"INSERT INTO blocks VALUES(1406470,X'35bd1043287454b580cbe989137b84f3188f6d9e62e09091b407000000000000',1125170485,X'99eebd7e1d214cc866c1b554e6c84fc28a3f46247bf4e3f4f35c3e3859b38e40',1535002190);"
-"INSERT INTO blocks VALUES(1408485,X'66d5a33b426ec12415f833b687bea23504cf1ff110642df21702000000000000',1000592742,X'45adc8be704cdfa0f7ffd08dda5a2a2244a0b1560b971ee301857a2adf1a833c',1535096528);"
-"INSERT INTO blocks VALUES(1410500,X'22c8cfbf43246041c5bccdce45031f1bfe49f9d450248d436400000000000000',-1076901854,X'128096c3c15765cceac08ff19cfb9024090822f2be45648a1b11f7df7423877b',1535456502);"
-"INSERT INTO blocks VALUES(1412515,X'9286076b79f6909c49c634382b83898b750a578bedca9ca15f31ffbb00000000',1795655314,X'5956ae329ecc0ee6f8091effe356cb9d452860f3d5db9644702dc0a55b07dedf',1536243905);"
-"INSERT INTO blocks VALUES(1414530,X'77f56eded6443207e79f328759bd584430c87e716e1abf323b92000000000000',-563153545,X'7d7ac7121bba66145ed06316ef8bf88ab75741e26014dfe22edbb26e35815117',1538113791);"
-"INSERT INTO blocks VALUES(1416545,X'ff658090623009fc964b830c7a3fbfcf814b7149ac6fe97342b9020000000000',-1870633473,X'9e4623550a5522bdd46b0f79ab30f5cfcb56c42e14c185dd2c2adb4296b7e7fd',1538932852);"
-"INSERT INTO blocks VALUES(1418560,X'97e507518a78bf19767646bab8d273b46c40b25feab6b5892301451100000000',1359472023,X'8e88dd2a2bb233082078dd17898a7910911ac2cc0835d3d5a984dee734d85155',1538934393);"
-"INSERT INTO blocks VALUES(1420575,X'62152dc9d2e74fad613923bca8a47ff716d8eb3c3a84f4a9a4203e0000000000',-919792286,X'53634fed867aa0a92b5365bbf319deff865ab314be740b0e70ff240b30fa027e',1538936066);"
-"INSERT INTO blocks VALUES(1422590,X'2a09921d755a83d9ab6649d19228ae170e7cb90f406070bd11fb230300000000',496109866,X'6f881a8910c0d8159cc7060239a4ce1bd029546b0c4c3d571d83967ef6e9da4e',1538937687);"
-"INSERT INTO blocks VALUES(1424605,X'deaa97ed0646f7661ac3d4a9e71276dfa23a7b44e87f5d9f43546e0000000000',-308827426,X'8c9a7799feb7050c6ad84057117e3a3a628b02956d879c1a42c85d353918b318',1538940627);"
-"INSERT INTO blocks VALUES(1426620,X'd04085a941df266fbdad5f34bca6414c55abedd9aa272ec037f2080000000000',-1450884912,X'0e81064e511930854577bd79c9c8261de13c470ce51d35a0eb2a09d814205efb',1538949373);"
-"INSERT INTO blocks VALUES(1428635,X'93713f5e5acf51a47b3c825acedd6a3dc0f824e83c84fefbc9a2000000000000',1581216147,X'b711859e9bafb93b7c49cb7c2976d0d7ac279be5d7ebc29c432e923e0e572865',1538956488);"
-"INSERT INTO blocks VALUES(1430650,X'e6dd9057396847db8c4e3c5409b1f1464a6225ea39f378b79e32020000000000',1469111782,X'e738a03e99f88e2f25e18fdddc72ca1f682affcc958327a1a40f1c00ed3236c5',1538965500);"
-"INSERT INTO blocks VALUES(1432665,X'c606e48524e5c90ed1d29219588a98dae562e3fc10945773e15b000000000000',-2048653626,X'0320132f8b780b06a17779d19e0ea30d094af5c15bbd746d0358524c18846bf5',1538985830);"
-"INSERT INTO blocks VALUES(1434680,X'6df80a55ced5f6c2a04a0d408657804503250d38fd284bafb905000000000000',1426782317,X'96239ee8e485225fa9672655114c9fa6bad2b21503596680bc6dd546495df60c',1539097342);"
-"INSERT INTO blocks VALUES(1436695,X'6e43352a94bf8297298040072f49d0cd2dcc2c5fa7672e1e9d01000000000000',708133742,X'4fa27ac05a2c3582699699b23266b12f8758b8fa89176c01e07269412d48bf61',1539383113);"
-"INSERT INTO blocks VALUES(1438710,X'515bf4ffc1f43aa42fb55760c7000b0498891cf021b7ba8a7d01000000000000',-763055,X'7532db964e9a0903bf956f43fab00dad58c6a0dd867cba446d7a51e3bd6d99c2',1539707946);"
-"INSERT INTO blocks VALUES(1440725,X'93c55fb226146afd676d78cdbfbc2fc760980d479a383ec21f00000000000000',-1302346349,X'e224387a9c59479475cef00519407c3e821b72fc67d9757387407fb2848f7401',1540576633);"
-"INSERT INTO blocks VALUES(1442740,X'c742e8b865f11e8c7043b32ec79a3b2ee16a5b404f68db8ffa00000000000000',-1192738105,X'c92eeacb10f3664c17ba4c993abf80788299981e7ca523b7f66bad0c7b0d83b7',1541809711);"
-"INSERT INTO blocks VALUES(1444755,X'0b38766bfe9f0fb466c888a65be46b3a1a592384ff1f38fc5801000000000000',1802909707,X'e74570a613b9d41d0305ce4f21489e3624fbf042b0df365c94b82bd7e0aa9594',1542936737);"
-"INSERT INTO blocks VALUES(1446770,X'3ade13f0930e7d5495845a40006b320b3e5e4363b664c25f3e00000000000000',-267133382,X'457110b1b3e38982ba259d892d931664e39208f2f2664feeffad34b2e058a4b4',1544113508);"
-"INSERT INTO blocks VALUES(1448785,X'6a7a83bce0fed436307708760447ad6f00dcc1d193f3e5987a00000000000000',-1132234134,X'9f8b7a61ed71ecc4598269633464bf80d1d3b54280b2a103b4047f67630d9b0c',1545404780);"
-"INSERT INTO blocks VALUES(1449690,X'e7bbab72b6b4931ba0e69b521dbfa1ddd8d324c773841f1ad0b0000000000000',1923857383,X'4469945b508ffe759365d9184c713e81a244fcbd9efa7095a906ff91754a4efb',1545880875);"
-"INSERT INTO blocks VALUES(1449691,X'bc0a6ee009b7453f38e3852404c3c155182001a747324af0fb00000000000000',-529659204,X'2195bbb465a037d1465813a910d63c566d94ef68ec37728ec58d22229353e901',1545881490);"
-"INSERT INTO blocks VALUES(1449692,X'97d514bbc76938d9499aae8d6a2a330629f53f2e1eb5890aad00000000000000',-1156262505,X'cef138c44823b411dda60a64e77bdc467cef67d29bb6e39dd35bd02cd6e341b9',1545881588);"
-"INSERT INTO blocks VALUES(1449693,X'8333a1367a2df15cd3795704db06ed86e43df52ad2d8658befff000000000000',916534147,X'e0b017d2e2c5a5be190c0b6e9bee342bdcae730b0860683dc2d648ab97056563',1545882793);"
-""
-"COMMIT;";
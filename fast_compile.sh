@@ -31,3 +31,6 @@ $GCC $GCCFLAGS -g -Icode test/example.c code/objects/all.a libraries/objects/all
 
 echo "Compiling webserver_example"
 $GCC $GCCFLAGS -g -Icode test/webserver_example.c code/objects/all.a libraries/objects/all.a -lsqlite3 -lgmp -lstdc++ -o test/webserver_example
+
+echo "Compiling checkpoint_generator"
+$GCC $GCCFLAGS -g -Icode test/checkpoint_generator.c code/objects/all.a libraries/objects/all.a -lsqlite3 -lgmp -lstdc++ -o test/checkpoint_generator
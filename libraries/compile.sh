@@ -21,7 +21,7 @@ echo "==== Let's make libsecp256k1 now ===="
 cd secp256k1
 
 ./autogen.sh
-./configure --enable-experimental --enable-module-ecdh
+./configure --enable-experimental --enable-module-ecdh --enable-module-batch
 make
 
 cd ..
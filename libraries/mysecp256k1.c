@@ -9,6 +9,7 @@
 #define DETERMINISTIC 1
 #define USE_BASIC_CONFIG 1
 #define ENABLE_MODULE_RECOVERY 1
+#define ENABLE_MODULE_BATCH 1
 
 #undef USE_ASM_X86_64
 #undef USE_ENDOMORPHISM
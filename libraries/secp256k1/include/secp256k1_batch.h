@@ -0,0 +1,37 @@
+#ifndef SECP256K1_BATCH_H
+#define SECP256K1_BATCH_H
+
+#include "secp256k1.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Tweak a public key by adding tweak*G to it, for many tweaks at once.
+ *
+ *  Every sum is kept in Jacobian coordinates and all of them are converted back to affine with a
+ *  single shared field inversion, instead of one inversion per secp256k1_ec_pubkey_tweak_add.
+ *
+ *  Returns: 0 if the arguments are invalid or 'pubkey' can't be parsed, 1 otherwise.
+ *  Args:    ctx:      pointer to a context object initialized for signing (cannot be NULL)
+ *  Out:     pubkeys:  'count' tweaked public keys (cannot be NULL)
+ *           valid:    'count' flags, 0 where the tweak was out of range or the result was the point
+ *                     at infinity. Those entries of 'pubkeys' are cleared. (cannot be NULL)
+ *  In:      pubkey:   the public key to tweak (cannot be NULL)
+ *           tweaks32: 'count' consecutive 32-byte tweaks (cannot be NULL)
+ *           count:    number of tweaks
+ */
+SECP256K1_API int secp256k1_ec_pubkey_tweak_add_batch(
+    const secp256k1_context* ctx,
+    secp256k1_pubkey *pubkeys,
+    unsigned char *valid,
+    const secp256k1_pubkey *pubkey,
+    const unsigned char *tweaks32,
+    size_t count
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SECP256K1_BATCH_H */
@@ -0,0 +1,59 @@
+#ifndef SECP256K1_MODULE_BATCH_MAIN_H
+#define SECP256K1_MODULE_BATCH_MAIN_H
+
+#include "../../../include/secp256k1_batch.h"
+
+int secp256k1_ec_pubkey_tweak_add_batch(const secp256k1_context* ctx, secp256k1_pubkey *pubkeys, unsigned char *valid, const secp256k1_pubkey *pubkey, const unsigned char *tweaks32, size_t count) {
+    secp256k1_ge base;
+    secp256k1_gej *points;
+    secp256k1_ge *results;
+    size_t i;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(pubkeys != NULL);
+    ARG_CHECK(valid != NULL);
+    ARG_CHECK(pubkey != NULL);
+    ARG_CHECK(tweaks32 != NULL);
+
+    if (!secp256k1_pubkey_load(ctx, &base, pubkey)) {
+        return 0;
+    }
+    if (count == 0) {
+        return 1;
+    }
+
+    points = (secp256k1_gej*)checked_malloc(&ctx->error_callback, count * sizeof(secp256k1_gej));
+    results = (secp256k1_ge*)checked_malloc(&ctx->error_callback, count * sizeof(secp256k1_ge));
+
+    for (i = 0; i < count; i++) {
+        secp256k1_scalar term;
+        int overflow = 0;
+
+        secp256k1_scalar_set_b32(&term, tweaks32 + 32 * i, &overflow);
+        if (overflow) {
+            secp256k1_gej_set_infinity(&points[i]);
+        } else {
+            secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &points[i], &term);
+            secp256k1_gej_add_ge_var(&points[i], &points[i], &base, NULL);
+        }
+        valid[i] = !overflow && !secp256k1_gej_is_infinity(&points[i]);
+        secp256k1_scalar_clear(&term);
+    }
+
+    /* Montgomery's trick, one inversion for the whole batch */
+    secp256k1_ge_set_all_gej_var(results, points, count);
+
+    for (i = 0; i < count; i++) {
+        if (valid[i]) {
+            secp256k1_pubkey_save(&pubkeys[i], &results[i]);
+        } else {
+            memset(&pubkeys[i], 0, sizeof(secp256k1_pubkey));
+        }
+    }
+
+    free(points);
+    free(results);
+    return 1;
+}
+
+#endif /* SECP256K1_MODULE_BATCH_MAIN_H */
@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BTCUtil.h"
+#include "BasicStorage.h"
+#include "Checkpoints.h"
+#include "Database.h"
+
+// Writes a checkpoint snapshot from a synced database.
+//
+// checkpoint_generator [-testnet] [-flat] [-interval n] [-trusted n] <database directory> <output>
+//
+// Every present height that is a multiple of 'interval' (default 2016) becomes a checkpoint, as does the tip.
+// The last 'trusted' heights (default 0) are included as full headers, which needs a -flat header store
+// since the sqlite storage doesn't keep whole headers. An output ending in ".h" is written as the C array
+// code/Checkpoints.c compiles in, otherwise as the binary snapshot.
+//
+// Every checkpoint must carry its bits, so the database needs the headers themselves and not only the
+// bundled checkpoints it started from.
+
+static int usage()
+{
+    printf("usage: checkpoint_generator [-testnet] [-flat] [-interval n] [-trusted n] <database directory> <output>\n");
+
+    return 1;
+}
+
+static int writeHeader(const char *path, Data snapshot, int testnet)
+{
+    FILE *file = fopen(path, "w");
+
+    if(!file)
+        return 0;
+
+    fprintf(file, "// Generated by test/checkpoint_generator.c, see Checkpoints.h for the layout\n");
+    fprintf(file, "static const unsigned char %s[] = {\n", testnet ? "initialTestnetCheckpoints" : "initialCheckpoints");
+
+    for(uint32_t i = 0; i < snapshot.length; i++)
+        fprintf(file, "%s0x%02x,%s", i % 16 ? " " : "    ", (uint8_t)snapshot.bytes[i], i % 16 == 15 || i + 1 == snapshot.length ? "\n" : "");
+
+    fprintf(file, "};\n");
+
+    return fclose(file) == 0;
+}
+
+static int writeBinary(const char *path, Data snapshot)
+{
+    FILE *file = fopen(path, "wb");
+
+    if(!file)
+        return 0;
+
+    size_t written = fwrite(snapshot.bytes, 1, snapshot.length, file);
+
+    return fclose(file) == 0 && written == snapshot.length;
+}
+
+int main(int argc, char **argv)
+{
+    int testnet = 0;
+    int flatFile = 0;
+    int32_t interval = 2016;
+    int32_t trustedCount = 0;
+
+    int i = 1;
+
+    for(; i < argc && argv[i][0] == '-'; i++) {
+
+        if(!strcmp(argv[i], "-testnet"))
+            testnet = 1;
+        else if(!strcmp(argv[i], "-flat"))
+            flatFile = 1;
+        else if(!strcmp(argv[i], "-interval") && i + 1 < argc)
+            interval = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "-trusted") && i + 1 < argc)
+            trustedCount = atoi(argv[++i]);
+        else
+            return usage();
+    }
+
+    if(argc - i != 2 || interval < 1 || trustedCount < 0 || (trustedCount && !flatFile))
+        return usage();
+
+    const char *output = argv[i + 1];
+
+    DataTrackPush();
+
+    BTCUtilStartup();
+    basicStorageSetup(StringF("%s/checkpoint_generator.basicStorage", argv[i]));
+    bsSave("testnet", DataInt(testnet));
+
+    databaseRootPath = argv[i];
+
+    Database db = DatabaseNewWithHeaderStorage(flatFile ? DatabaseHeaderStorageFlatFile : DatabaseHeaderStorageSqlite);
+
+    int32_t tip = HeaderIndexHighestHeight(&db.headerIndex);
+    int32_t trustedFirstHeight = tip - trustedCount + 1;
+
+    CheckpointSnapshot snapshot = { testnet, DataNew(0), trustedFirstHeight, DataNew(0) };
+
+    for(int32_t height = 0; height <= tip; height++) {
+
+        uint32_t time = HeaderIndexTimeOf(&db.headerIndex, height);
+
+        if(!time)
+            continue;
+
+        if(height >= trustedFirstHeight) {
+
+            Data header = HeaderStoreHeader(&db.headerStore, height);
+
+            if(header.length != 80 || !DataEqual(hash256(header), HeaderIndexHashOf(&db.headerIndex, height))) {
+
+                printf("No full header at height %d for the trusted range\n", height);
+                return 1;
+            }
+
+            snapshot.trustedHeaders = DataAppend(snapshot.trustedHeaders, header);
+            continue;
+        }
+
+        if(height % interval && height != tip && height != trustedFirstHeight - 1)
+            continue;
+
+        Checkpoint checkpoint = { height };
+
+        memcpy(checkpoint.hash, HeaderIndexHashOf(&db.headerIndex, height).bytes, 32);
+        checkpoint.time = time;
+        checkpoint.bits = HeaderIndexBitsOf(&db.headerIndex, height);
+
+        // Headers after a checkpoint are refused until its bits are known
+        if(!checkpoint.bits) {
+
+            printf("No bits at height %d, sync its header before generating\n", height);
+            return 1;
+        }
+
+        memcpy(checkpoint.merkleRoot, DatabaseMerkleRootOf(&db, height).bytes, 32);
+
+        snapshot.checkpoints = DataAppend(snapshot.checkpoints, DataRaw(checkpoint));
+    }
+
+    if(snapshot.trustedHeaders.length / 80 != trustedCount) {
+
+        printf("Only %d of the %d trusted heights are present\n", (int)(snapshot.trustedHeaders.length / 80), trustedCount);
+        return 1;
+    }
+
+    if(!snapshot.trustedHeaders.length)
+        snapshot.trustedFirstHeight = 0;
+
+    Data data = CheckpointSnapshotEncode(&snapshot);
+
+    size_t length = strlen(output);
+    int result = length > 2 && !strcmp(output + length - 2, ".h") ? writeHeader(output, data, testnet) : writeBinary(output, data);
+
+    if(!result) {
+
+        printf("Unable to write %s\n", output);
+        return 1;
+    }
+
+    printf("Wrote %d checkpoints and %d trusted headers up to height %d to %s\n", (int)(snapshot.checkpoints.length / sizeof(Checkpoint)), trustedCount, tip, output);
+
+    DatabaseFree(&db);
+
+    DataTrackPop();
+
+    BTCUtilShutdown();
+
+    return 0;
+}
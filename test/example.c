@@ -51,12 +51,10 @@ int main()
 
         DataTrackPush();
 
-        NodeManagerProcessNodes(&nodeManager);
+        NodeManagerRunLoop(&nodeManager, 1000);
         NotificationsProcess();
 
         DataTrackPop();
-
-        usleep(1000 * 1000);
     }
 
     BTCUtilShutdown();
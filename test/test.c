@@ -4,9 +4,19 @@
 #include "../code/Node.h"
 #include "../code/NodeManager.h"
 #include "../code/Database.h"
+#include "../code/HeaderIndex.h"
+#include "../code/HeaderStore.h"
+#include "../code/BlockDownload.h"
+#include "../code/BlockFilter.h"
+#include "../code/Checkpoints.h"
 #include "../code/WorkQueue.h"
 #include "../code/BasicStorage.h"
 #include "../code/KeyManager.h"
+#include "../code/TransactionTracker.h"
+#include "../code/NodeConstants.h"
+#include "../code/Notifications.h"
+#include <sys/socket.h>
+#include <netinet/in.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -14,52 +24,1380 @@
 #include <unistd.h>
 #include <pthread.h>
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
 //#define TEST_MANUAL_NODE_CONNECTION
 //#define DEBUG_DATA_TRACKING
 
-#define AssertEqualData(d1, d2) \
-do { if(!DataEqual((d1), (d2))) { \
-    printf("[%s %s:%d] %s != %s\n", __FUNCTION__, __FILE__, __LINE__, (char*)toHex(d1).bytes, (char*)toHex(d2).bytes); \
-    abort(); } \
-} while(0)
+#define AssertEqualData(d1, d2) \
+do { if(!DataEqual((d1), (d2))) { \
+    printf("[%s %s:%d] %s != %s\n", __FUNCTION__, __FILE__, __LINE__, (char*)toHex(d1).bytes, (char*)toHex(d2).bytes); \
+    abort(); } \
+} while(0)
+
+#define AssertNotEqualData(d1, d2) \
+do { if(DataEqual((d1), (d2))) { \
+    printf("[%s %s:%d] %s != %s\n", __FUNCTION__, __FILE__, __LINE__, (char*)toHex(d1).bytes, (char*)toHex(d2).bytes); \
+    abort(); } \
+} while(0)
+
+#define AssertEqualDatas(d1, d2) \
+do { if(!DatasEqual((d1), (d2))) { \
+    printf("[%s %s:%d]\n", __FUNCTION__, __FILE__, __LINE__); \
+    abort(); } \
+} while(0)
+
+#define AssertNotEqualDatas(d1, d2) \
+do { if(DatasEqual((d1), (d2))) { \
+    printf("[%s %s:%d]\n", __FUNCTION__, __FILE__, __LINE__); \
+    abort(); } \
+} while(0)
+
+#define AssertTrue(condition) \
+do { if(!(condition)) { \
+    printf("[%s %s:%d] condition not true (%s)\n", __FUNCTION__, __FILE__, __LINE__, #condition); \
+    abort(); } \
+} while(0)
+
+#define AssertZero(condition) \
+do { if((condition) != 0) { \
+    printf("[%s %s:%d] condition not zero (%s is %d)\n", __FUNCTION__, __FILE__, __LINE__, #condition, (condition)); \
+    abort(); } \
+} while(0)
+
+#define AssertEqual(condition, value) \
+do { if((condition) != (value)) { \
+    printf("[%s %s:%d] condition not equal (%s is %d but should be %d)\n", __FUNCTION__, __FILE__, __LINE__, #condition, (int)(condition), (int)(value)); \
+    abort(); } \
+} while(0)
+
+void testBasicStorage(); void testWorkQueueSimple(); void testWorkQueue(); void testWorkQueueThreading(); void testWorkQueueWake(); void testStringComponents(); void testDictionary(); void testData(); void testDatas(); void testHex(); void testRipemd160(); void testHexEncoding(); void testTransactionParsing(); void testSignatures(); void testSegwitSigningExample(); void testSegwitAddresses(); void testSegwitAddressCreation(); void testp2pkhTransaction(); void testp2shTransaction(); void testp2wpkTransaction(); void testp2wshTransaction(); void testInputTypeTest(); void testPubKeySearch(); void testMultisigSearch(); void testEasySign(); void testRemoteSign(); void testSecpDiffie(); void testSecpAdd(); void testDataPadding(); void testEncryptedMessage(); void testTweak(); void testMnemonic(); void testSha(); void testHmacShaBasic(); void testHmacSha(); void testBip39tests(); void testManualHdWallet(); void testCkdBatch(); void testHdWallet(); void testTrackerDerivationCache(); void testHdWalletVector1(); void testHdWalletVector3(); void testBloomFilters(); void testTrackerUnspent(); void testTrackerIndexes(); void testTrackerThreads(); void testTxSort(); void testBip174(); void testAddressParsing(); void testDecryptBip38(); void testManaulNodeConnection(); void testNodeInputBuffer(); void testNodeConnect(); void testDatabaseAddBlocks(); void testCheckpoints(); void testBlockDownload(); void testNodeManagerRunLoop(); void testNodeManagerHeaders(); void testNodeManagerFilters(); void testBlockFilter(); static int testNodeHeaderMessages = 0;
+static int testNodeHeaderCount = 0;
+
+static void testNodeBlockHeaders(struct Node *node, Datas headers)
+{
+    testNodeHeaderMessages++;
+    testNodeHeaderCount += headers.count;
+
+    FORDATAIN(header, headers)
+        AssertEqual(header->length, 81);
+}
+
+static Data testNodePacket(const char *command, Data payload)
+{
+    uint8_t magic[] = MAIN_MAGIC;
+
+    PacketHeader header = { 0 };
+
+    memcpy(header.magic, magic, sizeof(magic));
+    strncpy(header.command, command, sizeof(header.command));
+    header.length = payload.length;
+    memcpy(header.checksum, hash256(payload).bytes, 4);
+
+    return DataAppend(DataCopyData(DataRaw(header)), payload);
+}
+
+void testNodeInputBuffer()
+{
+    int sockets[2];
+
+    AssertEqual(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+
+    Node node = NodeNew(StringNew("socketpair"));
+
+    node.connection = sockets[0];
+    node.inputBuffer = DataUntrack(DataNew(0));
+    node.outputBuffer = DataUntrack(DataNew(0));
+    node.versionPacket = DataUntrack(DataNew(0));
+    node.errors = DatasUntrack(DatasNew());
+    node.rejectCodes = DatasUntrack(DatasNew());
+    node.delegate.blockHeaders = testNodeBlockHeaders;
+
+    Data headers = DataAdd(varIntD(3), DataZero(81 * 3));
+    Data packet = testNodePacket("headers", headers);
+    Data badPacket = testNodePacket("headers", headers);
+
+    badPacket.bytes[20] ^= 1;
+
+    // Junk ahead of the magic, one whole packet and the start of another
+    Data stream = DataAdd(DataCopy("junk", 4), DataCopyData(packet));
+
+    stream = DataAppend(stream, DataRef(packet.bytes, 10));
+
+    AssertEqual(write(sockets[1], stream.bytes, stream.length), stream.length);
+
+    NodeProcessPackets(&node);
+
+    AssertEqual(testNodeHeaderMessages, 1);
+    AssertEqual(testNodeHeaderCount, 3);
+
+    stream = DataAdd(DataCopy(packet.bytes + 10, packet.length - 10), DataCopyData(badPacket));
+
+    stream = DataAppend(stream, packet);
+
+    AssertEqual(write(sockets[1], stream.bytes, stream.length), stream.length);
+
+    NodeProcessPackets(&node);
+
+    AssertEqual(testNodeHeaderMessages, 3);
+    AssertEqual(testNodeHeaderCount, 9);
+    AssertEqual(node.inputOffset, node.inputLength);
+
+    close(sockets[0]);
+    close(sockets[1]);
+
+    NodeFree(&node);
+}
+
+static int testNodeConnectWait(Node *node)
+{
+    for(int i = 0; i < 500 && NodeIsConnecting(node); i++) {
+
+        NodeProcessPackets(node);
+
+        if(NodeIsConnecting(node))
+            usleep(10 * 1000);
+    }
+
+    return node->connected;
+}
+
+void testNodeConnect()
+{
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+
+    struct sockaddr_in address = { 0 };
+    socklen_t addressLength = sizeof(address);
+
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    AssertEqual(bind(listener, (struct sockaddr*)&address, sizeof(address)), 0);
+    AssertEqual(listen(listener, 4), 0);
+    AssertEqual(getsockname(listener, (struct sockaddr*)&address, &addressLength), 0);
+
+    const char *hosts[] = { "127.0.0.1", "localhost" };
+
+    for(int i = 0; i < 2; i++) {
+
+        Node node = NodeNew(StringNew(hosts[i]));
+
+        node.port = ntohs(address.sin_port);
+
+        NodeConnect(&node);
+        NodeSendVersion(&node, 0);
+
+        AssertTrue(testNodeConnectWait(&node));
+        AssertTrue(node.connection > 0);
+
+        int accepted = accept(listener, NULL, NULL);
+
+        AssertTrue(accepted > 0);
+
+        NodeProcessPackets(&node);
+
+        PacketHeader header;
+
+        // Version is only sent once the connect completes
+        AssertEqual(recv(accepted, &header, sizeof(header), MSG_WAITALL), sizeof(header));
+        AssertEqual(strcmp(header.command, "version"), 0);
+
+        close(accepted);
+
+        NodeClose(&node);
+        NodeFree(&node);
+    }
+
+    close(listener);
+
+    // Nothing listens on the port anymore
+    Node node = NodeNew(StringNew("127.0.0.1"));
+
+    node.port = ntohs(address.sin_port);
+
+    NodeConnect(&node);
+
+    AssertZero(testNodeConnectWait(&node));
+    AssertTrue(node.connection < 1);
+
+    NodeClose(&node);
+    NodeFree(&node);
+
+    NodeResolversShutdown();
+    NotificationsProcess();
+}
+
+static Data testHeaderIndexHash(int32_t height, int salt)
+{
+    return sha256(DataAdd(DataInt(height), DataInt(salt)));
+}
+
+void testHeaderIndex()
+{
+    HeaderIndex index = HeaderIndexNew();
+
+    AssertEqual(HeaderIndexHighestHeight(&index), -1);
+    AssertEqual(HeaderIndexHeightBeforeTime(&index, 1000), -1);
+
+    // Every third height is missing and times run slightly backwards every tenth block.
+    // Enough entries to grow the hash table several times.
+    for(int32_t height = 0; height < 6000; height++)
+        if(height % 3)
+            HeaderIndexSet(&index, height, testHeaderIndexHash(height, 0), 1000 + height * 10 - (height % 10 == 0) * 25, 0);
+
+    AssertEqual(HeaderIndexCount(&index), 4000);
+    AssertEqual(HeaderIndexHighestHeight(&index), 5999);
+
+    for(int32_t height = 0; height < 6000; height++) {
+
+        AssertEqual(HeaderIndexHeightOf(&index, testHeaderIndexHash(height, 0)), height % 3 ? height : -1);
+        AssertEqual(HeaderIndexHashOf(&index, height).length, height % 3 ? 32 : 0);
+    }
+
+    // Replacing a height drops the old hash
+    for(int32_t height = 1; height < 6000; height += 3)
+        HeaderIndexSet(&index, height, testHeaderIndexHash(height, 1), 1000 + height * 10, 0);
+
+    AssertEqual(HeaderIndexCount(&index), 4000);
+
+    for(int32_t height = 1; height < 6000; height += 3) {
+
+        AssertEqual(HeaderIndexHeightOf(&index, testHeaderIndexHash(height, 0)), -1);
+        AssertEqual(HeaderIndexHeightOf(&index, testHeaderIndexHash(height, 1)), height);
+        AssertEqual(HeaderIndexHeightOf(&index, testHeaderIndexHash(height + 1, 0)), height + 1);
+    }
+
+    AssertEqual(HeaderIndexHeightBelow(&index, 3), 2);
+    AssertEqual(HeaderIndexHeightBelow(&index, 1), -1);
+    AssertEqual(HeaderIndexHeightAtOrAbove(&index, 3), 4);
+    AssertEqual(HeaderIndexHeightAtOrAbove(&index, 6000), -1);
+
+    // Matches a linear scan for the highest height with an earlier time
+    for(uint32_t timestamp = 990; timestamp < 61100; timestamp += 7) {
+
+        int32_t expected = -1;
+
+        for(int32_t height = 0; height < 6000; height++)
+            if(HeaderIndexTimeOf(&index, height) && HeaderIndexTimeOf(&index, height) < timestamp)
+                expected = height;
+
+        AssertEqual(HeaderIndexHeightBeforeTime(&index, timestamp), expected);
+    }
+
+    Datas hashes = HeaderIndexHashesAbove(&index, 2, 3);
+
+    AssertEqual(hashes.count, 3);
+    AssertEqualData(hashes.ptr[0], testHeaderIndexHash(4, 1));
+    AssertEqualData(hashes.ptr[2], testHeaderIndexHash(7, 1));
+
+    HeaderIndexRemoveAll(&index);
+
+    AssertEqual(HeaderIndexCount(&index), 0);
+    AssertEqual(HeaderIndexHeightOf(&index, testHeaderIndexHash(4, 1)), -1);
+
+    HeaderIndexFree(&index);
+}
+
+void testBlockDownload()
+{
+    int peers[3];
+
+    BlockDownload download = BlockDownloadNew(100);
+
+    BlockDownloadReset(&download, 1000);
+    BlockDownloadSetTarget(&download, 1250);
+
+    BlockDownloadWindow *window = BlockDownloadAssign(&download, &peers[0], 0);
+
+    AssertEqual(window->firstHeight, 1001);
+    AssertEqual(window->lastHeight, 1100);
+    AssertTrue(BlockDownloadAssign(&download, &peers[0], 0) == NULL);
+
+    window = BlockDownloadAssign(&download, &peers[1], 0);
+
+    AssertEqual(window->firstHeight, 1101);
+
+    // The last window stops at the target
+    window = BlockDownloadAssign(&download, &peers[2], 0);
+
+    AssertEqual(window->firstHeight, 1201);
+    AssertEqual(window->lastHeight, 1250);
+
+    // Finishing out of order holds until the gap below is filled
+    AssertZero(BlockDownloadProgress(&download, &peers[1], 1200, 5));
+    AssertEqual(download.completedHeight, 1000);
+    AssertTrue(BlockDownloadWindowOf(&download, &peers[1]) == NULL);
+    AssertTrue(BlockDownloadAssign(&download, &peers[1], 5) == NULL);
+
+    AssertEqual(BlockDownloadProgress(&download, &peers[0], 1050, 10), 1);
+    AssertEqual(download.completedHeight, 1050);
+
+    // Heights outside the window are ignored
+    AssertZero(BlockDownloadProgress(&download, &peers[0], 1210, 10));
+    AssertZero(BlockDownloadProgress(&download, &peers[0], 1040, 10));
+
+    AssertTrue(BlockDownloadStalledOwner(&download, 20) == NULL);
+    AssertTrue(BlockDownloadStalledOwner(&download, BLOCK_DOWNLOAD_STALL_SECONDS) == &peers[2]);
+
+    // A released window is handed out again from where it got to, ahead of new heights
+    BlockDownloadRelease(&download, &peers[0]);
+    BlockDownloadSetTarget(&download, 1400);
+
+    window = BlockDownloadAssign(&download, &peers[1], 30);
+
+    AssertEqual(window->firstHeight, 1001);
+    AssertEqual(window->progressHeight, 1050);
+
+    AssertEqual(BlockDownloadProgress(&download, &peers[1], 1100, 35), 1);
+    AssertEqual(download.completedHeight, 1200);
+
+    window = BlockDownloadAssign(&download, &peers[1], 35);
+
+    AssertEqual(window->firstHeight, 1251);
+    AssertEqual(window->lastHeight, 1350);
+
+    AssertEqual(BlockDownloadProgress(&download, &peers[2], 1250, 40), 1);
+    AssertEqual(download.completedHeight, 1250);
+
+    BlockDownloadReset(&download, 900);
+
+    AssertTrue(BlockDownloadWindowOf(&download, &peers[1]) == NULL);
+    AssertEqual(BlockDownloadAssign(&download, &peers[1], 50)->firstHeight, 901);
+
+    BlockDownloadFree(&download);
+}
+
+static const char *testDatabaseOldRootPath;
+
+// An empty database keeping its headers in 'storage', made in a fresh 'directory' from a mkdtemp template.
+// Reopening it in between is fine, 'databaseRootPath' stays on 'directory' until 'testDatabaseFree'.
+static Database testDatabaseNew(char *directory, DatabaseHeaderStorage storage)
+{
+    AssertTrue(mkdtemp(directory) != NULL);
+
+    testDatabaseOldRootPath = databaseRootPath;
+    databaseRootPath = directory;
+
+    return DatabaseNewWithHeaderStorage(storage);
+}
+
+static void testDatabaseFree(Database *db, const char *directory)
+{
+    DatabaseFree(db);
+
+    databaseRootPath = testDatabaseOldRootPath;
+
+    unlink(StringF("%s/headers.dat", directory).bytes);
+    unlink(StringF("%s/headers.dat.idx", directory).bytes);
+    unlink(StringF("%s/blocks.db", directory).bytes);
+    unlink(StringF("%s/blocks.db-wal", directory).bytes);
+    unlink(StringF("%s/blocks.db-shm", directory).bytes);
+    AssertZero(rmdir(directory));
+
+    NotificationsProcess();
+}
+
+void testNodeManagerReorg()
+{
+    char directory[] = "/tmp/testDatabaseXXXXXX";
+
+    database = testDatabaseNew(directory, DatabaseHeaderStorageSqlite);
+
+    int peer;
+
+    NodeManager manager = { .blockDownload = BlockDownloadNew(100) };
+
+    AssertZero(pthread_mutex_init(&manager.nodesMutex, NULL));
+
+    BlockDownloadReset(&manager.blockDownload, 1000);
+    BlockDownloadSetTarget(&manager.blockDownload, 1250);
+    TTSetBloomFilterDlHeight(&tracker, 1000);
+
+    AssertTrue(BlockDownloadAssign(&manager.blockDownload, &peer, 0) != NULL);
+
+    // Downloaded blocks from the fork up are fetched again, the window in flight is dropped
+    NodeManagerBlocksDisconnected(&manager, 951, 1200);
+
+    AssertEqual(manager.blockDownload.completedHeight, 950);
+    AssertEqual(TTBloomFilterDlHeight(&tracker), 950);
+    AssertTrue(BlockDownloadWindowOf(&manager.blockDownload, &peer) == NULL);
+    AssertZero(BlockDownloadProgress(&manager.blockDownload, &peer, 1100, 10));
+    AssertEqual(manager.blockDownload.completedHeight, 950);
+
+    // A fork above the download leaves its progress alone
+    NodeManagerBlocksDisconnected(&manager, 1101, 1200);
+
+    AssertEqual(manager.blockDownload.completedHeight, 950);
+    AssertEqual(TTBloomFilterDlHeight(&tracker), 950);
+    AssertEqual(BlockDownloadAssign(&manager.blockDownload, &peer, 20)->firstHeight, 951);
+
+    TTSetBloomFilterDlHeight(&tracker, 0);
+
+    pthread_mutex_destroy(&manager.nodesMutex);
+    BlockDownloadFree(&manager.blockDownload);
+
+    testDatabaseFree(&database, directory);
+}
+
+static void testNodeManagerWatched(int fd, void *ptr)
+{
+    char byte;
+
+    AssertEqual(read(fd, &byte, 1), 1);
+
+    (*(int*)ptr)++;
+}
+
+void testNodeManagerRunLoop()
+{
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+
+    struct sockaddr_in address = { 0 };
+    socklen_t addressLength = sizeof(address);
+
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    AssertEqual(bind(listener, (struct sockaddr*)&address, sizeof(address)), 0);
+    AssertEqual(listen(listener, 4), 0);
+    AssertEqual(getsockname(listener, (struct sockaddr*)&address, &addressLength), 0);
+
+    NodeManager manager = { .eventFd = -1, .wakePipe = { -1, -1 }, .maxConnectsInFlight = 1 };
+
+    AssertZero(pthread_mutex_init(&manager.nodesMutex, NULL));
+
+    manager.workQueue = WorkQueueNew();
+    manager.watchedFds = DatasUntrack(DatasNew());
+
+    Node node = NodeNew(StringNew("127.0.0.1"));
+
+    node.port = ntohs(address.sin_port);
+
+    manager.nodes = DatasUntrack(DatasAddCopy(DatasNew(), DataRaw(node)));
+
+    Node *managed = (Node*)manager.nodes.ptr[0].bytes;
+
+    int pipeFds[2];
+    int watchedCount = 0;
+
+    AssertZero(pipe(pipeFds));
+
+    NodeManagerWatchFd(&manager, pipeFds[0], testNodeManagerWatched, &watchedCount);
+
+    // The first pass starts the connect and registers the socket, the version goes out once it completes
+    for(int i = 0; i < 100 && (!managed->connected || NodeWantsWrite(managed)); i++)
+        NodeManagerRunLoop(&manager, 50);
+
+    AssertTrue(managed->connected);
+    AssertZero(NodeWantsWrite(managed));
+
+    int accepted = accept(listener, NULL, NULL);
+
+    AssertTrue(accepted > 0);
+
+    PacketHeader header;
+
+    AssertEqual(recv(accepted, &header, sizeof(header), MSG_WAITALL), sizeof(header));
+    AssertEqual(strcmp(header.command, "version"), 0);
+
+    AssertEqual(write(pipeFds[1], "x", 1), 1);
+
+    NodeManagerRunLoop(&manager, 1000);
+
+    AssertEqual(watchedCount, 1);
+
+#ifdef __linux__
+    // Everything stays registered between passes, write interest is dropped once the output is sent
+    struct epoll_event event = { EPOLLIN };
+
+    AssertEqual(managed->eventFd, manager.eventFd);
+    AssertEqual(managed->eventMask, EPOLLIN);
+
+    AssertEqual(epoll_ctl(manager.eventFd, EPOLL_CTL_ADD, managed->connection, &event), -1);
+    AssertEqual(epoll_ctl(manager.eventFd, EPOLL_CTL_ADD, pipeFds[0], &event), -1);
+    AssertEqual(epoll_ctl(manager.eventFd, EPOLL_CTL_ADD, manager.wakePipe[0], &event), -1);
+
+    NodeManagerUnwatchFd(&manager, pipeFds[0]);
+
+    AssertEqual(epoll_ctl(manager.eventFd, EPOLL_CTL_DEL, pipeFds[0], NULL), -1);
+
+    // Closing takes the socket out before its number can be reused
+    int copy = dup(managed->connection);
+
+    NodeClose(managed);
+
+    AssertZero(managed->eventMask);
+    AssertEqual(epoll_ctl(manager.eventFd, EPOLL_CTL_DEL, copy, NULL), -1);
+
+    close(copy);
+#else
+    NodeManagerUnwatchFd(&manager, pipeFds[0]);
+    NodeClose(managed);
+#endif
+
+    NodeFree(managed);
+    DatasFree(manager.nodes);
+    DatasFree(manager.watchedFds);
+
+    WorkQueueSetWakeFd(&manager.workQueue, -1);
+    NotificationsSetWakeFd(-1);
+
+    if(manager.eventFd >= 0)
+        close(manager.eventFd);
+
+    close(manager.wakePipe[0]);
+    close(manager.wakePipe[1]);
+
+    WorkQueueFree(manager.workQueue);
+    pthread_mutex_destroy(&manager.nodesMutex);
+
+    close(accepted);
+    close(listener);
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+
+    NotificationsProcess();
+}
+
+void testBlockFilter()
+{
+    // BIP158 test vector: testnet genesis, the coinbase output script is the only element
+    Data genesisHash = DataFlipEndianCopy(fromHex("000000000933ea01ad0ee984209779baaec3ced90fa3f408719526f8d77f4943"));
+    Data coinbaseScript = fromHex("4104678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac");
+
+    Data filter = BlockFilterBuild(genesisHash, DatasOneCopy(coinbaseScript));
+
+    AssertEqualData(filter, fromHex("019dfca8"));
+    AssertEqualData(DataFlipEndianCopy(BlockFilterHeader(filter, DataZero(32))), fromHex("21584579b7eb08997773e5aeff3a7f932700042d0ed2a6129012b7d7ae81b750"));
+
+    AssertTrue(BlockFilterMatchAny(filter, genesisHash, DatasOneCopy(coinbaseScript)));
+    AssertZero(BlockFilterMatchAny(filter, genesisHash, DatasOneCopy(fromHex("0014000102030405060708090a0b0c0d0e0f10111213"))));
+    AssertEqual(BlockFilterElementCount(filter), 1);
+
+    Data blockHash = hash256(StringNew("block"));
+    Datas elements = DatasNew();
+    Datas others = DatasNew();
+
+    for(int i = 0; i < 500; i++) {
+
+        elements = DatasAddRef(elements, hash160(DataInt(i)));
+        others = DatasAddRef(others, hash160(DataInt(i + 500)));
+    }
+
+    filter = BlockFilterBuild(blockHash, elements);
+
+    AssertEqual(BlockFilterElementCount(filter), 500);
+
+    FORDATAIN(element, elements)
+        AssertTrue(BlockFilterMatchAny(filter, blockHash, DatasOneCopy(*element)));
+
+    AssertTrue(BlockFilterMatchAny(filter, blockHash, DatasAddCopy(DatasCopy(others), DatasLast(elements))));
+    AssertZero(BlockFilterMatchAny(filter, blockHash, others));
+    AssertZero(BlockFilterMatchAny(BlockFilterBuild(blockHash, DatasNew()), blockHash, elements));
+
+    // A filter cut short can't rule anything out
+    Data truncated = DataCopyDataPart(filter, 0, filter.length / 2);
+
+    AssertEqual(BlockFilterElementCount(truncated), -1);
+    AssertTrue(BlockFilterMatchAny(truncated, blockHash, others));
+
+    // So can one without a readable element count
+    AssertEqual(BlockFilterElementCount(DataNew(0)), -1);
+    AssertTrue(BlockFilterMatchAny(DataNew(0), blockHash, others));
+    AssertEqual(BlockFilterElementCount(fromHex("fd01")), -1);
+    AssertTrue(BlockFilterMatchAny(fromHex("fd01"), blockHash, others));
+
+    // Transactions back to back, as in a block
+    Data txData = fromHex("01000000000101db6b1b20aa0fd7b23880be2ecbd4a98130974cf4748fb66092ac4d3ceb1a5477010000001716001479091972186c449eb1ded22b78e40d009bdf0089feffffff02b8b4eb0b000000001976a914a457b684d7f0d539a46a45bbc043f35b59d0d96388ac0008af2f000000001976a914fd270b1ee6abcaea97fea7ad0402e8bd8ad6d77c88ac02473044022047ac8e878352d3ebbde1c94ce3a10d057c24175747116f8288e5d794d12d482f0220217f36a485cae903c713331d877c1f64677e3622ad4010726870540656fe9dcb012103ad1d8e89212f0b92c74d23bb710c00662ad1470198ac48c43f7d6f93a2a2687392040000");
+    Data txs = DataAddCopy(txData, txData);
+
+    const uint8_t *ptr = (uint8_t*)txs.bytes;
+    const uint8_t *end = ptr + txs.length;
+
+    AssertEqualData(TransactionData(TransactionNewP(&ptr, end)), txData);
+    AssertTrue(ptr == (uint8_t*)txs.bytes + txData.length);
+    AssertEqualData(TransactionData(TransactionNewP(&ptr, end)), txData);
+    AssertTrue(ptr == end);
+}
+
+#define TEST_POW_LIMIT_BITS 0x207fffff
+
+// Mined against TEST_POW_LIMIT_BITS, which callers must set as 'blockPowLimitBits'
+static Data testDatabaseHeader(Data prevHash, uint32_t time)
+{
+    Data header = DataZero(81);
+
+    *(int32_t*)header.bytes = 4;
+    memcpy(header.bytes + 4, prevHash.bytes, 32);
+    *(uint32_t*)(header.bytes + 68) = time;
+    *(uint32_t*)(header.bytes + 72) = TEST_POW_LIMIT_BITS;
+
+    for(uint32_t nonce = 0;; nonce++) {
+
+        *(uint32_t*)(header.bytes + 76) = nonce;
+
+        MerkleBlock block = MerkleBlockNew(header);
+
+        if(MerkleBlockCheckProofOfWork(&block))
+            return header;
+    }
+}
+
+// Headers 'spacing' seconds apart. Spacing above the target interval keeps retargets at the pow limit.
+static Datas testDatabaseChainSpaced(Data prevHash, int count, uint32_t time, uint32_t spacing)
+{
+    Datas headers = DatasNew();
+
+    for(int i = 0; i < count; i++) {
+
+        Data header = testDatabaseHeader(prevHash, time + i * spacing);
+
+        headers = DatasAddRef(headers, header);
+        prevHash = hash256(DataCopyDataPart(header, 0, 80));
+    }
+
+    return headers;
+}
+
+static Datas testDatabaseChain(Data prevHash, int count, uint32_t time)
+{
+    return testDatabaseChainSpaced(prevHash, count, time, 1);
+}
+
+static Datas testDatasRange(Datas datas, int start, int count)
+{
+    Datas result = DatasNew();
+
+    for(int i = start; i < start + count; i++)
+        result = DatasAddRef(result, datas.ptr[i]);
+
+    return result;
+}
+
+// One checkpoint at 'height' with the 'trusted' headers linking to it from 'height' + 1
+static Data testSnapshot(int testnet, int32_t height, Data hash, uint32_t bits, Datas trusted)
+{
+    Checkpoint checkpoint = { height };
+
+    memcpy(checkpoint.hash, hash.bytes, 32);
+    checkpoint.time = 1590000000;
+    checkpoint.bits = bits;
+
+    CheckpointSnapshot snapshot = { testnet, DataCopyData(DataRaw(checkpoint)), height + 1, DataNew(0) };
+
+    FORDATAIN(header, trusted)
+        snapshot.trustedHeaders = DataAppend(snapshot.trustedHeaders, DataCopyDataPart(*header, 0, 80));
+
+    return CheckpointSnapshotEncode(&snapshot);
+}
+
+// The bundled checkpoints carry no bits and headers after them are refused until their own header arrives.
+// Chains built on the tip start from a checkpoint above it that has TEST_POW_LIMIT_BITS. Returns its height.
+static int32_t testDatabaseBitsCheckpoint(Database *db)
+{
+    int32_t height = DatabaseHighestHeight(db) + 1;
+
+    AssertEqual(DatabaseLoadSnapshot(db, testSnapshot(0, height, sha256(DataCopy("bits", 4)), TEST_POW_LIMIT_BITS, DatasNew())), 1);
+
+    return height;
+}
+
+static int testReorgNotified()
+{
+    Datas names = NotificationsProcessReturningEventNames();
+
+    FORDATAIN(name, names)
+        if(!strcmp(name->bytes, DatabaseReorgNotification))
+            return 1;
+
+    return 0;
+}
+
+void testDatabaseReorg()
+{
+    for(int flatFile = 0; flatFile < 2; flatFile++) {
+
+        char directory[] = "/tmp/testDatabaseXXXXXX";
+
+        blockPowLimitBits = TEST_POW_LIMIT_BITS;
+
+        Database db = testDatabaseNew(directory, flatFile ? DatabaseHeaderStorageFlatFile : DatabaseHeaderStorageSqlite);
+
+        int32_t height = testDatabaseBitsCheckpoint(&db);
+        Data forkHash = DatabaseHashOf(&db, height);
+
+        Datas mainChain = testDatabaseChain(forkHash, 3, 1600000000);
+        Datas sideChain = testDatabaseChain(forkHash, 4, 1600001000);
+
+        AssertEqual(DatabaseAddBlocks(&db, mainChain), 3);
+
+        // Less work than the main chain, kept on the side
+        AssertEqual(DatabaseAddBlocks(&db, testDatasRange(sideChain, 0, 2)), 2);
+        AssertEqual(DatabaseHighestHeight(&db), height + 3);
+        AssertEqualData(DatabaseHashOf(&db, height + 1), hash256(DataCopyDataPart(mainChain.ptr[0], 0, 80)));
+        AssertEqual(HeaderIndexHeightOf(&db.headerIndex, hash256(DataCopyDataPart(sideChain.ptr[1], 0, 80))), -1);
+
+        // Equal work keeps the main chain
+        AssertEqual(DatabaseAddBlocks(&db, testDatasRange(sideChain, 2, 1)), 1);
+        AssertEqual(DatabaseHighestHeight(&db), height + 3);
+
+        AssertTrue(!testReorgNotified());
+
+        // More work switches branches above the fork
+        AssertEqual(DatabaseAddBlocks(&db, testDatasRange(sideChain, 3, 1)), 1);
+        AssertEqual(DatabaseHighestHeight(&db), height + 4);
+
+        for(int i = 0; i < 4; i++)
+            AssertEqualData(DatabaseHashOf(&db, height + 1 + i), hash256(DataCopyDataPart(sideChain.ptr[i], 0, 80)));
+
+        AssertEqual(HeaderIndexHeightOf(&db.headerIndex, hash256(DataCopyDataPart(mainChain.ptr[2], 0, 80))), -1);
+        AssertEqualData(DatabaseHashOf(&db, height), forkHash);
+        AssertEqual(DatabaseTimeOfHeight(&db, height + 4), 1600001003);
+
+        AssertTrue(testReorgNotified());
+
+        // Transactions in the disconnected blocks become unconfirmed, others stay put
+        Data transaction = fromHex("0100000001000000000000000000000000000000000000000000000000000000000000000000000000ffffffff0100f2052a010000000000000000");
+        MerkleBlock block = MerkleBlockNew(sideChain.ptr[1]);
+
+        AssertTrue(DatabaseAddTransaction(&db, transaction, &block));
+        AssertEqual(DatabaseTransactionHeight(&db, hash256(transaction)), height + 2);
+        AssertEqual(DatabaseUnconfirmTransactions(&db, height + 3, height + 4), 0);
+        AssertEqual(DatabaseUnconfirmTransactions(&db, height + 1, height + 4), 1);
+        AssertEqual(DatabaseTransactionHeight(&db, hash256(transaction)), -1);
+
+        // ...and back again once the old branch pulls ahead, leaving a shorter chain
+        Datas extension = testDatabaseChain(hash256(DataCopyDataPart(mainChain.ptr[2], 0, 80)), 2, 1600000003);
+
+        AssertEqual(DatabaseAddBlocks(&db, extension), 2);
+        AssertEqual(DatabaseHighestHeight(&db), height + 5);
+        AssertEqualData(DatabaseHashOf(&db, height + 3), hash256(DataCopyDataPart(mainChain.ptr[2], 0, 80)));
+        AssertEqualData(DatabaseHashOf(&db, height + 5), hash256(DataCopyDataPart(extension.ptr[1], 0, 80)));
+
+        AssertTrue(testReorgNotified());
+
+        DatabaseFree(&db);
+
+        // The switch is what's stored
+        db = DatabaseNewWithHeaderStorage(flatFile ? DatabaseHeaderStorageFlatFile : DatabaseHeaderStorageSqlite);
+
+        AssertEqual(DatabaseHighestHeight(&db), height + 5);
+        AssertEqualData(DatabaseHashOf(&db, height + 1), hash256(DataCopyDataPart(mainChain.ptr[0], 0, 80)));
+
+        if(flatFile)
+            AssertEqualData(HeaderStoreHeader(&db.headerStore, height + 2), DataCopyDataPart(mainChain.ptr[1], 0, 80));
+
+        testDatabaseFree(&db, directory);
+
+        blockPowLimitBits = BLOCK_POW_LIMIT_BITS;
+    }
+}
+
+void testCheckpoints()
+{
+    CheckpointSnapshot snapshot;
+
+    AssertTrue(CheckpointSnapshotParse(CheckpointSnapshotBundled(0), &snapshot));
+    AssertEqual(snapshot.testnet, 0);
+    AssertEqual(snapshot.checkpoints.length / sizeof(Checkpoint), 364);
+    AssertEqual(((Checkpoint*)snapshot.checkpoints.bytes)[363].height, 610567);
+
+    AssertTrue(CheckpointSnapshotParse(CheckpointSnapshotBundled(1), &snapshot));
+    AssertEqual(snapshot.testnet, 1);
+
+    blockPowLimitBits = TEST_POW_LIMIT_BITS;
+
+    Datas trusted = testDatabaseChain(sha256(DataCopy("fork", 4)), 3, 1600000000);
+    Data data = testSnapshot(0, 700000, sha256(DataCopy("fork", 4)), 0, trusted);
+
+    AssertTrue(CheckpointSnapshotParse(data, &snapshot));
+    AssertEqual(snapshot.trustedFirstHeight, 700001);
+    AssertEqual(snapshot.trustedHeaders.length, 240);
+    AssertEqualData(CheckpointSnapshotEncode(&snapshot), data);
+
+    AssertTrue(!CheckpointSnapshotParse(DataCopyDataPart(data, 0, data.length - 1), &snapshot));
+
+    data.bytes[0] = 'X';
+
+    AssertTrue(!CheckpointSnapshotParse(data, &snapshot));
+
+    for(int flatFile = 0; flatFile < 2; flatFile++) {
+
+        char directory[] = "/tmp/testDatabaseXXXXXX";
+
+        DatabaseHeaderStorage storage = flatFile ? DatabaseHeaderStorageFlatFile : DatabaseHeaderStorageSqlite;
+
+        Database db = testDatabaseNew(directory, storage);
+
+        // Fresh databases start from the bundled snapshot
+        int32_t height = DatabaseHighestHeight(&db);
+
+        AssertEqual(height, 610567);
+        AssertEqual(DatabaseTimeOfHeight(&db, 2015), 1233061996);
+        AssertEqual(DatabaseMerkleRootOf(&db, 2015).length, 32);
+
+        // A trusted range past a gap, so header sync starts at its end
+        Data checkpointHash = sha256(DataCopy("checkpoint", 10));
+
+        trusted = testDatabaseChain(checkpointHash, 3, 1600000000);
+
+        AssertEqual(DatabaseLoadSnapshot(&db, testSnapshot(1, height + 9, checkpointHash, 0, trusted)), -1);
+        AssertEqual(DatabaseLoadSnapshot(&db, testSnapshot(0, height + 9, sha256(DataCopy("other", 5)), 0, trusted)), -1);
+        AssertEqual(DatabaseHighestHeight(&db), height);
+
+        AssertEqual(DatabaseLoadSnapshot(&db, testSnapshot(0, height + 9, checkpointHash, 0, trusted)), 4);
+        AssertEqual(DatabaseLoadSnapshot(&db, testSnapshot(0, height + 9, checkpointHash, 0, trusted)), 0);
+        AssertEqual(DatabaseHighestHeight(&db), height + 12);
+        AssertEqual(DatabaseHighestHeightOrLowestMissingAfter(&db, 1595000000), height + 12);
+        AssertEqualData(DatabaseHashOf(&db, height + 12), hash256(DataCopyDataPart(trusted.ptr[2], 0, 80)));
+
+        Datas headers = testDatabaseChain(hash256(DataCopyDataPart(trusted.ptr[2], 0, 80)), 2, 1600000003);
+
+        AssertEqual(DatabaseAddBlocks(&db, headers), 2);
+        AssertEqual(DatabaseHighestHeight(&db), height + 14);
+
+        DatabaseFree(&db);
+
+        db = DatabaseNewWithHeaderStorage(storage);
+
+        AssertEqual(DatabaseHighestHeight(&db), height + 14);
+        AssertEqualData(DatabaseHashOf(&db, height + 10), hash256(DataCopyDataPart(trusted.ptr[0], 0, 80)));
+
+        if(flatFile)
+            AssertEqualData(HeaderStoreHeader(&db.headerStore, height + 11), DataCopyDataPart(trusted.ptr[1], 0, 80));
+
+        testDatabaseFree(&db, directory);
+    }
+
+    blockPowLimitBits = BLOCK_POW_LIMIT_BITS;
+}
+
+// The first locator hash of each getheaders queued on 'node', which are then dropped
+static Datas testNodeSentLocators(Node *node)
+{
+    Datas result = DatasNew();
+
+    const uint8_t *ptr = (uint8_t*)node->outputBuffer.bytes;
+    const uint8_t *end = ptr + node->outputBuffer.length;
+
+    while(end - ptr >= sizeof(PacketHeader)) {
+
+        PacketHeader *header = (PacketHeader*)ptr;
+        const uint8_t *payload = ptr + sizeof(PacketHeader) + 4;
+
+        if(!strcmp(header->command, "getheaders") && readVarInt(&payload, end))
+            result = DatasAddCopy(result, DataCopy(payload, 32));
+
+        ptr += sizeof(PacketHeader) + header->length;
+    }
+
+    DataFree(node->outputBuffer);
+
+    node->outputBuffer = DataUntrack(DataNew(0));
+
+    return result;
+}
+
+static Node *testNodeManagerPeer(NodeManager *manager, int sockets[2])
+{
+    AssertEqual(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+
+    Node *node = NodeManagerAddNode(manager, StringNew("socketpair"), 0);
+
+    node->connection = sockets[0];
+    node->connected = 1;
+    node->connectAttemptCount = 1;
+    node->inputBuffer = DataUntrack(DataNew(0));
+    node->outputBuffer = DataUntrack(DataNew(0));
+    node->versionPacket = DataUntrack(DataNew(0));
+    node->errors = DatasUntrack(DatasNew());
+    node->rejectCodes = DatasUntrack(DatasNew());
+
+    return node;
+}
+
+// Runs the header batches through the database thread and back to 'manager', twice for the requests they make
+static void testNodeManagerSettle(NodeManager *manager)
+{
+    for(int i = 0; i < 2; i++) {
+
+        WorkQueueWaitUntilEmpty(WorkQueueThreadNamedStackSize("Database Thread", 262144));
+        WorkQueueExecuteAll(&manager->workQueue);
+    }
+}
+
+void testNodeManagerHeaders()
+{
+    char directory[] = "/tmp/testDatabaseXXXXXX";
+
+    blockPowLimitBits = TEST_POW_LIMIT_BITS;
+
+    database = testDatabaseNew(directory, DatabaseHeaderStorageSqlite);
+
+    int32_t height = testDatabaseBitsCheckpoint(&database);
+
+    // Crosses a retarget, so the headers are spaced twice the target interval apart
+    Datas chain = testDatabaseChainSpaced(DatabaseHashOf(&database, height), HEADERS_BATCH_COUNT * HEADERS_PIPELINE_DEPTH, 1600000000,
+                                          2 * BLOCK_TARGET_TIMESPAN / BLOCK_RETARGET_INTERVAL);
+    Datas batches[HEADERS_PIPELINE_DEPTH];
+
+    for(int i = 0; i < HEADERS_PIPELINE_DEPTH; i++)
+        batches[i] = testDatasRange(chain, HEADERS_BATCH_COUNT * i, HEADERS_BATCH_COUNT);
+
+    pthread_mutexattr_t recursiveAttr;
+
+    pthread_mutexattr_init(&recursiveAttr);
+    pthread_mutexattr_settype(&recursiveAttr, PTHREAD_MUTEX_RECURSIVE);
+
+    NodeManager manager = { .nodes = DatasUntrack(DatasNew()), .blockDownload = BlockDownloadNew(100), .walletCreationDate = 1600000000 };
+
+    AssertZero(pthread_mutex_init(&manager.nodesMutex, &recursiveAttr));
+
+    pthread_mutexattr_destroy(&recursiveAttr);
+
+    manager.workQueue = WorkQueueNew();
+
+    int sockets[2][2];
+
+    Node *active = testNodeManagerPeer(&manager, sockets[0]);
+    Node *other = testNodeManagerPeer(&manager, sockets[1]);
+
+    manager.activeNode = active;
+
+    // Each full batch asks for the next one straight away, located by its own last header
+    for(int i = 0; i < HEADERS_PIPELINE_DEPTH - 1; i++) {
+
+        active->delegate.blockHeaders(active, batches[i]);
+
+        Data lastHash = hash256(DataCopyDataPart(DatasLast(batches[i]), 0, 80));
+
+        AssertEqualDatas(testNodeSentLocators(active), DatasOneCopy(lastHash));
+        AssertEqual(manager.headerBatchesQueued, i + 1);
+    }
+
+    // The pipeline is full, the next request waits for the database
+    active->delegate.blockHeaders(active, batches[HEADERS_PIPELINE_DEPTH - 1]);
+
+    AssertEqual(testNodeSentLocators(active).count, 0);
+    AssertEqual(manager.headerBatchesQueued, HEADERS_PIPELINE_DEPTH);
+
+    testNodeManagerSettle(&manager);
+
+    AssertEqual(manager.headerBatchesQueued, 0);
+    AssertEqual(DatabaseHighestHeight(&database), height + HEADERS_BATCH_COUNT * HEADERS_PIPELINE_DEPTH);
+    AssertEqualDatas(testNodeSentLocators(active), DatasOneCopy(DatabaseHashOf(&database, DatabaseHighestHeight(&database))));
+
+    // A batch adding nothing replaces the active node, which is asked anew
+    active->delegate.blockHeaders(active, batches[0]);
+
+    testNodeManagerSettle(&manager);
+
+    AssertTrue(manager.activeNode == other);
+    AssertEqual(manager.nodes.count, 1);
+    AssertEqual(manager.headerBatchesQueued, 0);
+    AssertEqualDatas(testNodeSentLocators(other), DatasOneCopy(DatabaseHashOf(&database, DatabaseHighestHeight(&database))));
+
+    WorkQueueThreadWaitAndDestroy("Database Thread");
+
+    NodeClose(other);
+    NodeFree(other);
+    DatasFree(manager.nodes);
+
+    close(sockets[0][1]);
+    close(sockets[1][1]);
+
+    WorkQueueFree(manager.workQueue);
+    BlockDownloadFree(&manager.blockDownload);
+    pthread_mutex_destroy(&manager.nodesMutex);
+
+    testDatabaseFree(&database, directory);
+
+    blockPowLimitBits = BLOCK_POW_LIMIT_BITS;
+}
+
+static int testNodeSentCount(Node *node, const char *command)
+{
+    int count = 0;
+
+    const uint8_t *ptr = (uint8_t*)node->outputBuffer.bytes;
+    const uint8_t *end = ptr + node->outputBuffer.length;
+
+    for(; end - ptr >= sizeof(PacketHeader); ptr += sizeof(PacketHeader) + ((PacketHeader*)ptr)->length)
+        if(!strcmp(((PacketHeader*)ptr)->command, command))
+            count++;
+
+    return count;
+}
+
+void testNodeManagerFilters()
+{
+    char directory[] = "/tmp/testDatabaseXXXXXX";
+
+    blockPowLimitBits = TEST_POW_LIMIT_BITS;
+
+    database = testDatabaseNew(directory, DatabaseHeaderStorageSqlite);
+
+    int32_t height = testDatabaseBitsCheckpoint(&database);
+
+    Datas chain = testDatabaseChain(DatabaseHashOf(&database, height), 3, 1600000000);
+
+    AssertEqual(DatabaseAddBlocks(&database, chain), 3);
+
+    Datas hashes = DatasNew();
+    Datas filters = DatasNew();
+
+    for(int i = 0; i < chain.count; i++) {
+
+        hashes = DatasAddCopy(hashes, hash256(DataCopyDataPart(chain.ptr[i], 0, 80)));
+        filters = DatasAddCopy(filters, BlockFilterBuild(DatasLast(hashes), DatasOneCopy(hash160(DataInt(i)))));
+    }
+
+    pthread_mutexattr_t recursiveAttr;
+
+    pthread_mutexattr_init(&recursiveAttr);
+    pthread_mutexattr_settype(&recursiveAttr, PTHREAD_MUTEX_RECURSIVE);
+
+    NodeManager manager = { .nodes = DatasUntrack(DatasNew()), .blockDownload = BlockDownloadNew(100), .compactFilters = 1 };
+
+    AssertZero(pthread_mutex_init(&manager.nodesMutex, &recursiveAttr));
+
+    pthread_mutexattr_destroy(&recursiveAttr);
+
+    manager.workQueue = WorkQueueNew();
+    manager.filterScripts = DatasUntrack(DatasNew());
 
-#define AssertNotEqualData(d1, d2) \
-do { if(DataEqual((d1), (d2))) { \
-    printf("[%s %s:%d] %s != %s\n", __FUNCTION__, __FILE__, __LINE__, (char*)toHex(d1).bytes, (char*)toHex(d2).bytes); \
-    abort(); } \
-} while(0)
+    int sockets[2][2];
 
-#define AssertEqualDatas(d1, d2) \
-do { if(!DatasEqual((d1), (d2))) { \
-    printf("[%s %s:%d]\n", __FUNCTION__, __FILE__, __LINE__); \
-    abort(); } \
-} while(0)
+    Node *downloader = testNodeManagerPeer(&manager, sockets[0]);
+    Node *voucher = testNodeManagerPeer(&manager, sockets[1]);
 
-#define AssertNotEqualDatas(d1, d2) \
-do { if(DatasEqual((d1), (d2))) { \
-    printf("[%s %s:%d]\n", __FUNCTION__, __FILE__, __LINE__); \
-    abort(); } \
-} while(0)
+    manager.activeNode = voucher;
 
-#define AssertTrue(condition) \
-do { if(!(condition)) { \
-    printf("[%s %s:%d] condition not true (%s)\n", __FUNCTION__, __FILE__, __LINE__, #condition); \
-    abort(); } \
-} while(0)
+    BlockDownloadReset(&manager.blockDownload, height);
+    BlockDownloadSetTarget(&manager.blockDownload, height + chain.count);
 
-#define AssertZero(condition) \
-do { if((condition) != 0) { \
-    printf("[%s %s:%d] condition not zero (%s is %d)\n", __FUNCTION__, __FILE__, __LINE__, #condition, (condition)); \
-    abort(); } \
-} while(0)
+    AssertTrue(BlockDownloadAssign(&manager.blockDownload, downloader, time(0)) != NULL);
 
-#define AssertEqual(condition, value) \
-do { if((condition) != (value)) { \
-    printf("[%s %s:%d] condition not equal (%s is %d but should be %d)\n", __FUNCTION__, __FILE__, __LINE__, #condition, (int)(condition), (int)(value)); \
-    abort(); } \
-} while(0)
+    // As 'requestWindowWorkerMain' leaves a window waiting on another peer's filter headers
+    downloader->lastDlHeight = height + chain.count;
+    downloader->lastDlSize = chain.count;
+    downloader->lastFilterHeight = height;
+    downloader->filterHeaders = DatasUntrack(DatasNew());
+    downloader->filterHeadersHeight = height;
+    downloader->filterHeadersStop = DataUntrackCopy(DatasLast(hashes));
+    downloader->filterHeadersNode = voucher;
+
+    Datas filterHashes = DatasNew();
+
+    FORDATAIN(filter, filters)
+        filterHashes = DatasAddCopy(filterHashes, hash256(*filter));
+
+    voucher->delegate.compactFilterHeaders(voucher, BLOCK_FILTER_BASIC, DatasLast(hashes), DataZero(32), filterHashes);
+
+    AssertEqual(testNodeSentCount(downloader, "getcfilters"), 1);
+    AssertEqual(downloader->filterHeaders.count, chain.count + 1);
+    AssertTrue(downloader->filterHeadersNode == NULL);
+
+    // Filters the headers commit to are taken
+    downloader->delegate.compactFilter(downloader, BLOCK_FILTER_BASIC, hashes.ptr[0], filters.ptr[0]);
+
+    AssertEqual(downloader->lastFilterHeight, height + 1);
+
+    // Another filter for the block drops the peer and frees its window for the others
+    Data forged = BlockFilterBuild(hashes.ptr[1], DatasNew());
+
+    downloader->delegate.compactFilter(downloader, BLOCK_FILTER_BASIC, hashes.ptr[1], forged);
+
+    AssertEqual(downloader->lastFilterHeight, downloader->lastDlHeight);
+
+    WorkQueueExecuteAll(&manager.workQueue);
+
+    AssertTrue(BlockDownloadWindowOf(&manager.blockDownload, downloader) == NULL);
+    AssertZero(downloader->connected);
+    AssertTrue(BlockDownloadAssign(&manager.blockDownload, voucher, time(0)) != NULL);
+
+    FORIN(Node, node, manager.nodes) {
+
+        if(node->connected)
+            NodeClose(node);
+
+        NodeFree(node);
+    }
+
+    DatasFree(manager.nodes);
+    DatasFree(manager.filterScripts);
+
+    close(sockets[0][1]);
+    close(sockets[1][1]);
+
+    WorkQueueFree(manager.workQueue);
+    BlockDownloadFree(&manager.blockDownload);
+    pthread_mutex_destroy(&manager.nodesMutex);
+
+    testDatabaseFree(&database, directory);
+
+    blockPowLimitBits = BLOCK_POW_LIMIT_BITS;
+}
+
+static Data testGenesisHeader()
+{
+    Data header = DataZero(80);
+
+    *(int32_t*)header.bytes = 1;
+    memcpy(header.bytes + 36, fromHex("3ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a").bytes, 32);
+    *(uint32_t*)(header.bytes + 68) = 1231006505;
+    *(uint32_t*)(header.bytes + 72) = 0x1d00ffff;
+    *(uint32_t*)(header.bytes + 76) = 2083236893;
+
+    return header;
+}
+
+void testProofOfWork()
+{
+    Data genesis = testGenesisHeader();
+    MerkleBlock block = MerkleBlockNew(genesis);
+
+    AssertEqualData(blockHash(&block), fromHex("6fe28c0ab6f1b372c1a6a246ae63f74f931e8365e15a089c68d6190000000000"));
+    AssertTrue(MerkleBlockCheckProofOfWork(&block));
+
+    *(uint32_t*)(genesis.bytes + 76) += 1;
+
+    block = MerkleBlockNew(genesis);
+
+    AssertTrue(!MerkleBlockCheckProofOfWork(&block));
+
+    AssertTrue(blockWork(0x1d00ffff).high == 0);
+    AssertTrue(blockWork(0x1d00ffff).low == 4295032833);
+    AssertZero(ChainWorkCompare(ChainWorkAdd(blockWork(0x1d00ffff), blockWork(0x1d00ffff)), (ChainWork) { 0, 8590065666 }));
+
+    AssertTrue(!blockBitsValid(0x1e00ffff));
+    AssertTrue(!blockBitsValid(0x1d80ffff));
+    AssertTrue(blockBitsValid(0x1b0404cb));
+
+    // Bitcoin Core's retarget vectors
+    AssertEqual(blockRetargetBits(0x1d00ffff, 1261130161, 1262152739), 0x1d00d86a);
+    AssertEqual(blockRetargetBits(0x1d00ffff, 1231006505, 1233061996), 0x1d00ffff);
+    AssertEqual(blockRetargetBits(0x1c05a3f4, 1279008237, 1279297671), 0x1c0168fd);
+    AssertEqual(blockRetargetBits(0x1c387f6f, 1263163443, 1269211443), 0x1d00e1fd);
+
+    // One bad header rejects the whole batch
+    char directory[] = "/tmp/testDatabaseXXXXXX";
+
+    blockPowLimitBits = TEST_POW_LIMIT_BITS;
+
+    Database db = testDatabaseNew(directory, DatabaseHeaderStorageSqlite);
+
+    int32_t height = testDatabaseBitsCheckpoint(&db);
+
+    Datas headers = DatasNew();
+    Data prevHash = DatabaseHashOf(&db, height);
+
+    for(int i = 0; i < 4; i++) {
+
+        Data header = testDatabaseHeader(prevHash, 1600000000 + i);
+
+        // Unmines the third header
+        if(i == 2)
+            while(1) {
+
+                *(uint32_t*)(header.bytes + 76) += 1;
+
+                MerkleBlock bad = MerkleBlockNew(header);
+
+                if(!MerkleBlockCheckProofOfWork(&bad))
+                    break;
+            }
+
+        headers = DatasAddRef(headers, header);
+        prevHash = hash256(DataCopyDataPart(header, 0, 80));
+    }
+
+    AssertEqual(DatabaseAddBlocks(&db, headers), -1);
+    AssertEqual(DatabaseHighestHeight(&db), height);
+
+    // Bits must carry over between retargets
+    headers = DatasNew();
+    prevHash = DatabaseHashOf(&db, height);
+
+    Data header = testDatabaseHeader(prevHash, 1600000000);
+
+    headers = DatasAddRef(headers, header);
+
+    header = testDatabaseHeader(hash256(DataCopyDataPart(header, 0, 80)), 1600000001);
+
+    *(uint32_t*)(header.bytes + 72) = 0x2000ffff;
+
+    do {
+        *(uint32_t*)(header.bytes + 76) += 1;
+        block = MerkleBlockNew(header);
+    } while(!MerkleBlockCheckProofOfWork(&block));
+
+    headers = DatasAddRef(headers, header);
+
+    AssertEqual(DatabaseAddBlocks(&db, headers), -1);
+
+    headers.count = 1;
+
+    AssertEqual(DatabaseAddBlocks(&db, headers), 1);
+    AssertEqual(DatabaseHighestHeight(&db), height + 1);
+    AssertEqual(ChainWorkCompare(HeaderIndexChainWork(&db.headerIndex, height + 1), HeaderIndexChainWork(&db.headerIndex, height)), 1);
+
+    // Nothing follows a checkpoint with unknown bits, so no easy chain can be built above it
+    Data checkpointHeader = testDatabaseHeader(sha256(DataCopy("below", 5)), 1600000100);
+    Data checkpointHash = hash256(DataCopyDataPart(checkpointHeader, 0, 80));
+    int32_t checkpointHeight = height + 10;
+
+    AssertEqual(DatabaseLoadSnapshot(&db, testSnapshot(0, checkpointHeight, checkpointHash, 0, DatasNew())), 1);
+
+    headers = testDatabaseChain(checkpointHash, 1, 1600000101);
+
+    AssertEqual(DatabaseAddBlocks(&db, headers), 0);
+    AssertEqual(DatabaseHighestHeight(&db), checkpointHeight);
+    AssertEqual(DatabaseBitsOf(&db, checkpointHeight), 0);
+
+    // The checkpoint's own header vouches for its bits
+    AssertEqual(DatabaseAddBlocks(&db, DatasOneCopy(checkpointHeader)), 0);
+    AssertEqual(DatabaseBitsOf(&db, checkpointHeight), TEST_POW_LIMIT_BITS);
+    AssertEqual(DatabaseAddBlocks(&db, headers), 1);
+    AssertEqual(DatabaseHighestHeight(&db), checkpointHeight + 1);
+
+    // The header after a checkpoint must match its bits
+    Data hardHash = sha256(DataCopy("hard", 4));
+
+    AssertEqual(DatabaseLoadSnapshot(&db, testSnapshot(0, checkpointHeight + 10, hardHash, 0x2000ffff, DatasNew())), 1);
+    AssertEqual(DatabaseAddBlocks(&db, testDatabaseChain(hardHash, 1, 1600000200)), -1);
+
+    DatabaseFree(&db);
+
+    db = DatabaseNew();
+
+    AssertEqual(DatabaseBitsOf(&db, checkpointHeight), TEST_POW_LIMIT_BITS);
+
+    testDatabaseFree(&db, directory);
+
+    blockPowLimitBits = BLOCK_POW_LIMIT_BITS;
+}
+
+void testDatabaseAddBlocks()
+{
+    char directory[] = "/tmp/testDatabaseXXXXXX";
+
+    blockPowLimitBits = TEST_POW_LIMIT_BITS;
+
+    Database db = testDatabaseNew(directory, DatabaseHeaderStorageSqlite);
+
+    // Write-ahead logging is on
+    AssertZero(access(StringF("%s/blocks.db-wal", directory).bytes, F_OK));
+
+    int32_t height = testDatabaseBitsCheckpoint(&db);
+    Data tipHash = DatabaseHashOf(&db, height);
+
+    AssertTrue(height > 0);
+    AssertEqual(tipHash.length, 32);
+
+    Datas headers = DatasNew();
+    Data prevHash = tipHash;
+
+    for(int i = 0; i < 5; i++) {
+
+        Data header = testDatabaseHeader(prevHash, 1600000000 + i);
+
+        headers = DatasAddRef(headers, header);
+        prevHash = hash256(DataCopyDataPart(header, 0, 80));
+    }
+
+    // A truncated header gets rejected without spoiling the batch
+    headers = DatasAddRef(headers, DataZero(40));
+
+    AssertEqual(DatabaseAddBlocks(&db, headers), 5);
+    AssertEqual(DatabaseHighestHeight(&db), height + 5);
+    AssertEqual(DatabaseHeightOf(&db, prevHash), height + 5);
+    AssertEqualData(DatabaseHashOf(&db, height + 5), prevHash);
+
+    // Re-adding the same headers changes nothing
+    AssertEqual(DatabaseAddBlocks(&db, headers), 0);
+
+    // Cached statements are reset between uses
+    for(int i = 0; i < 3; i++) {
+
+        AssertEqual(DatabaseBlockHashesAbove(&db, height, 10).count, 5);
+        AssertEqual(DatabaseNearestHeight(&db, height + 2), height + 2);
+        AssertEqual(DatabaseHashOf(&db, height + 3).length, 32);
+    }
+
+    AssertEqual(DatabaseTimeOfHeight(&db, height + 2), 1600000001);
+    AssertEqual(DatabaseHighestBlockBeforeTime(&db, 1600000002), height + 2);
+    AssertEqual(DatabaseNearestHeightToTime(&db, 1600000003), height + 4);
+    AssertTrue(DatabaseHasBlock(&db, prevHash));
+
+    testDatabaseFree(&db, directory);
 
-void testBasicStorage(); void testWorkQueueSimple(); void testWorkQueue(); void testWorkQueueThreading(); void testStringComponents(); void testDictionary(); void testData(); void testDatas(); void testHex(); void testRipemd160(); void testHexEncoding(); void testTransactionParsing(); void testSignatures(); void testSegwitSigningExample(); void testSegwitAddresses(); void testSegwitAddressCreation(); void testp2pkhTransaction(); void testp2shTransaction(); void testp2wpkTransaction(); void testp2wshTransaction(); void testInputTypeTest(); void testPubKeySearch(); void testMultisigSearch(); void testEasySign(); void testRemoteSign(); void testSecpDiffie(); void testSecpAdd(); void testDataPadding(); void testEncryptedMessage(); void testTweak(); void testMnemonic(); void testSha(); void testHmacShaBasic(); void testHmacSha(); void testBip39tests(); void testManualHdWallet(); void testHdWallet(); void testHdWalletVector1(); void testHdWalletVector3(); void testBloomFilters(); void testTxSort(); void testBip174(); void testAddressParsing(); void testDecryptBip38(); void testManaulNodeConnection(); void testJimmyScript();
+    blockPowLimitBits = BLOCK_POW_LIMIT_BITS;
+}
+
+void testDatabaseHeaderStore()
+{
+    char directory[] = "/tmp/testDatabaseXXXXXX";
+
+    blockPowLimitBits = TEST_POW_LIMIT_BITS;
+
+    Database db = testDatabaseNew(directory, DatabaseHeaderStorageFlatFile);
+
+    AssertEqual(db.headerStorage, DatabaseHeaderStorageFlatFile);
+
+    // Starting checkpoints are copied over from the blocks table
+    int32_t bundledHeight = DatabaseHighestHeight(&db);
+
+    AssertTrue(bundledHeight > 0);
+    AssertEqual(HeaderStoreHeightCount(&db.headerStore), bundledHeight + 1);
+
+    int32_t height = testDatabaseBitsCheckpoint(&db);
+    Data tipHash = DatabaseHashOf(&db, height);
+
+    AssertEqual(tipHash.length, 32);
+
+    Datas headers = DatasNew();
+    Data prevHash = tipHash;
+
+    for(int i = 0; i < 5; i++) {
+
+        Data header = testDatabaseHeader(prevHash, 1600000000 + i);
+
+        headers = DatasAddRef(headers, header);
+        prevHash = hash256(DataCopyDataPart(header, 0, 80));
+    }
+
+    AssertEqual(DatabaseAddBlocks(&db, headers), 5);
+    AssertEqual(DatabaseAddBlocks(&db, headers), 0);
+    AssertEqual(DatabaseHighestHeight(&db), height + 5);
+    AssertEqualData(HeaderStoreHeader(&db.headerStore, height + 5), DataCopyDataPart(headers.ptr[4], 0, 80));
+    AssertEqualData(HeaderStoreHash(&db.headerStore, height + 5), prevHash);
+    AssertEqual(HeaderStoreHeader(&db.headerStore, height + 6).length, 0);
+
+    DatabaseFree(&db);
+
+    // Headers are read back from the store on the next open
+    db = DatabaseNewWithHeaderStorage(DatabaseHeaderStorageFlatFile);
+
+    AssertEqual(DatabaseHighestHeight(&db), height + 5);
+    AssertEqual(DatabaseHeightOf(&db, prevHash), height + 5);
+    AssertEqual(DatabaseTimeOfHeight(&db, height + 3), 1600000002);
+
+    DatabaseFree(&db);
+
+    // ...and never went into sqlite
+    db = DatabaseNew();
+
+    AssertEqual(DatabaseHighestHeight(&db), bundledHeight);
+
+    testDatabaseFree(&db, directory);
+
+    blockPowLimitBits = BLOCK_POW_LIMIT_BITS;
+}
+
+void testJimmyScript();
 
 struct {
     void (*testFunction)();
@@ -72,6 +1410,7 @@ struct {
     { testWorkQueueSimple, "testWorkQueueSimple" },
     { testWorkQueue, "testWorkQueue" },
     { testWorkQueueThreading, "testWorkQueueThreading" },
+    { testWorkQueueWake, "testWorkQueueWake" },
     { testStringComponents, "testStringComponents"},
     { testData, "testData" },
     { testDatas, "testDatas" },
@@ -103,7 +1442,9 @@ struct {
      { testHmacSha, "testHmacSha" },
      { testBip39tests, "testBip39tests" },
      { testManualHdWallet, "testManualHdWallet" },
+     { testCkdBatch, "testCkdBatch" },
      { testHdWallet, "testHdWallet" },
+     { testTrackerDerivationCache, "testTrackerDerivationCache" },
      { testHdWalletVector1, "testHdWalletVector1" },
      { testHdWalletVector3, "testHdWalletVector3" },
      { testTxSort, "testTxSort" },
@@ -111,9 +1452,26 @@ struct {
      { testAddressParsing, "testAddressParsing" },
      { testDecryptBip38, "testDecryptBip38" },
      { testBloomFilters, "testBloomFilters" },
+     { testTrackerUnspent, "testTrackerUnspent" },
+     { testTrackerIndexes, "testTrackerIndexes" },
+     { testTrackerThreads, "testTrackerThreads" },
 #ifdef TEST_MANUAL_NODE_CONNECTION
      { testManaulNodeConnection, "testManaulNodeConnection" },
 #endif
+     { testNodeInputBuffer, "testNodeInputBuffer" },
+     { testNodeConnect, "testNodeConnect" },
+     { testHeaderIndex, "testHeaderIndex" },
+     { testBlockDownload, "testBlockDownload" },
+     { testNodeManagerReorg, "testNodeManagerReorg" },
+     { testNodeManagerRunLoop, "testNodeManagerRunLoop" },
+     { testNodeManagerHeaders, "testNodeManagerHeaders" },
+     { testNodeManagerFilters, "testNodeManagerFilters" },
+     { testBlockFilter, "testBlockFilter" },
+    { testDatabaseAddBlocks, "testDatabaseAddBlocks" },
+    { testDatabaseHeaderStore, "testDatabaseHeaderStore" },
+    { testProofOfWork, "testProofOfWork" },
+    { testDatabaseReorg, "testDatabaseReorg" },
+    { testCheckpoints, "testCheckpoints" },
      { testJimmyScript, "testJimmyScript" },
      { NULL, NULL, }
 };
@@ -263,6 +1621,42 @@ void testWorkQueueThreading()
     AssertEqual(value, 33);
 }
 
+void testWorkQueueWake()
+{
+    WorkQueue workQueue = WorkQueueNew();
+
+    int fds[2];
+
+    if(pipe(fds) != 0)
+        abort();
+
+    WorkQueueSetWakeFd(&workQueue, fds[1]);
+
+    AssertEqual(WorkQueueMillisecondsUntilReady(&workQueue), -1);
+
+    WorkQueueAddDelayed(&workQueue, testWorkQueueSimpleWorker, (Dict){0, 0}, 60 * 1000);
+
+    int64_t milliseconds = WorkQueueMillisecondsUntilReady(&workQueue);
+
+    AssertTrue(milliseconds > 0 && milliseconds <= 60 * 1000);
+
+    char byte = 1;
+
+    AssertEqual(read(fds[0], &byte, 1), 1);
+
+    WorkQueueAdd(&workQueue, testWorkQueueSimpleWorker, (Dict){0, 0});
+
+    AssertEqual(WorkQueueMillisecondsUntilReady(&workQueue), 0);
+    AssertEqual(read(fds[0], &byte, 1), 1);
+
+    WorkQueueSetWakeFd(&workQueue, -1);
+
+    close(fds[0]);
+    close(fds[1]);
+
+    WorkQueueFree(workQueue);
+}
+
 void testStringComponents()
 {
     Datas result = StringComponents(StringNew(",a,bbbbbbbbbb,c,"), ',');
@@ -324,54 +1718,199 @@ void testDictionary()
     AssertEqualData(DictGetS(testDictRef, "ten"), DataInt(10));
 
     DatasFree(arrayOfDicts);
+
+    Dict hashed = DictNewHashed();
+
+    for(int i = 0; i < 1000; i++)
+        DictAdd(&hashed, DataInt(i), DataInt(i * 2));
+
+    DictAdd(&hashed, DataInt(7), DataInt(77));
+
+    AssertEqual(DictCount(hashed), 1000);
+    AssertEqualData(DictGet(hashed, DataInt(7)), DataInt(77));
+    AssertEqualData(DictGet(hashed, DataInt(999)), DataInt(999 * 2));
+    AssertTrue(!DictHasKey(hashed, DataInt(1000)));
+
+    for(int i = 0; i < 1000; i += 2)
+        DictRemove(&hashed, DataInt(i));
+
+    AssertEqual(DictCount(hashed), 500);
+
+    int keySum = 0;
+
+    FORINDICT(item, hashed)
+        keySum += DataGetInt(item->key);
+
+    AssertEqual(keySum, 500 * 500);
+
+    Dict hashedCopy = DictUntrackCopy(hashed);
+
+    for(int i = 0; i < 1000; i++)
+        AssertEqual(DictHasKey(hashedCopy, DataInt(i)), i % 2);
+
+    DictFree(hashedCopy);
 }
 
 void testData()
 {
     int startingCount = DataAllocatedCount();
 
-    DataTrackPush();
+    DataTrackPush();
+
+    Data data = DataNew(10345);
+
+    DataUntrack(data);
+
+    Datas datas = DatasNew();
+
+    datas = DatasAddRef(datas, data);
+
+    DataTrackPop();
+
+    AssertEqual(DataAllocatedCount() - startingCount, 1);
+
+    DataFree(data);
+
+    DataTrackPush();
+    DataTrackPush();
+
+    Datas dataGrabber = DatasAddRef(DatasNew(), StringNew("Hello Heaven"));
+
+    DatasTranscend(dataGrabber);
+
+    DataTrackPop();
+
+    strcpy(dataGrabber.ptr[0].bytes, "Goodbye Karl");
+
+    Data str = StringNew("a");
+
+    str = DataInsert(str, 0, DataRef("!", 1));
+
+    AssertEqualData(str, StringNew("!a"));
+
+    str = DataDelete(str, 1, 1);
+
+    AssertEqualData(str, StringNew("!"));
+    
+    DataTrackPop();
+
+    AssertEqual(DataAllocatedCount() - startingCount, 0);
+
+    DataTrackPush();
+
+    Datas untracked = DatasNew();
+
+    for(int i = 0; i < 5000; i++) {
+
+        Data item = DataInt(i);
+
+        if(i % 2)
+            untracked = DatasAddRef(untracked, DataUntrack(item));
+    }
+
+    AssertEqual(DataTrackCount(), 2500 + 1);
+
+    FORDATAIN(item, untracked) {
+
+        AssertTrue(!DataIsTracked(*item));
+        AssertTrue(DataIsTracked(DataTrack(*item)));
+    }
+
+    AssertEqual(DataTrackCount(), 5000 + 1);
+
+    while(untracked.count)
+        untracked = DatasRemoveLast(untracked);
+
+    AssertEqual(DataTrackCount(), 2500);
+
+    Data shrunk = DataResize(DataNew(16), 0);
+
+    AssertTrue(!shrunk.bytes);
+    AssertEqual(DataTrackCount(), 2500);
+
+    DataTrackPop();
+
+    DataTrackPush();
+
+    DataTrackPushArena(1024);
+
+    Data arenaData = DataNew(0);
+    Datas arenaDatas = DatasNew();
+
+    for(int i = 0; i < 1000; i++) {
+
+        arenaData = DataAppend(arenaData, DataInt(i));
+        arenaDatas = DatasAddCopy(arenaDatas, DataInt(i));
+    }
+
+    DataFree(DataNew(100));
+
+    arenaDatas = DatasTranscend(arenaDatas);
 
-    Data data = DataNew(10345);
+    Data kept = DTPop(arenaData);
 
-    DataUntrack(data);
+    AssertEqual(DataTrackCount(), 1000 + 1 + 1);
+    AssertEqual(kept.length, 1000 * sizeof(int32_t));
+    AssertEqual(arenaDatas.count, 1000);
 
-    Datas datas = DatasNew();
+    for(int i = 0; i < 1000; i++) {
 
-    datas = DatasAddRef(datas, data);
+        AssertEqual(((int32_t*)kept.bytes)[i], i);
+        AssertEqual(DataGetInt(arenaDatas.ptr[i]), i);
+    }
 
     DataTrackPop();
 
-    AssertEqual(DataAllocatedCount() - startingCount, 1);
-
-    DataFree(data);
+    AssertEqual(DataAllocatedCount() - startingCount, 0);
 
-    DataTrackPush();
     DataTrackPush();
 
-    Datas dataGrabber = DatasAddRef(DatasNew(), StringNew("Hello Heaven"));
+    Data small = DataCopy("0123456789", 10);
 
-    DatasTranscend(dataGrabber);
+    small = DataAppend(small, DataCopy("abcdefghijklmnopqrstuvwxyz", 26));
+    small = DataAppend(small, DataZero(64));
+    small = DataShrink(small, 64 + 20);
 
-    DataTrackPop();
+    AssertEqualData(small, DataCopy("0123456789abcdef", 16));
 
-    strcpy(dataGrabber.ptr[0].bytes, "Goodbye Karl");
+    for(int i = 0; i < 2000; i++)
+        DataFree(uint64D(i));
 
-    Data str = StringNew("a");
+    AssertEqual(DataGetLong(DataLong(-5)), -5);
 
-    str = DataInsert(str, 0, DataRef("!", 1));
+    Data grown = DataReserve(DataCopy("abc", 3), 1000);
 
-    AssertEqualData(str, StringNew("!a"));
+    AssertTrue(grown.capacity >= 1000);
+    AssertEqualData(grown, DataCopy("abc", 3));
 
-    str = DataDelete(str, 1, 1);
+    for(int i = 0; i < 100000; i++)
+        grown = DataAppend(grown, DataRef("d", 1));
+
+    AssertEqual(grown.length, 100003);
+    AssertEqual(grown.bytes[100002], 'd');
+
+    Datas reserved = DatasReserve(DatasNew(), 2000);
+    Data *reservedPtr = reserved.ptr;
+
+    for(int i = 0; i < 2000; i++)
+        reserved = DatasAddRef(reserved, DataInt(i));
+
+    AssertTrue(reserved.ptr == reservedPtr);
+    AssertEqual(DataGetInt(DatasLast(reserved)), 1999);
 
-    AssertEqualData(str, StringNew("!"));
-    
     DataTrackPop();
 
     AssertEqual(DataAllocatedCount() - startingCount, 0);
 }
 
+static Dict testDatasNestedDict;
+
+// Orders by a dictionary lookup so every compare performs its own nested search.
+static int testDatasNestedCompare(Data dataA, Data dataB)
+{
+    return DataGetInt(DictGet(testDatasNestedDict, dataA)) - DataGetInt(DictGet(testDatasNestedDict, dataB));
+}
+
 void testDatas()
 {
     Datas datas = DatasNew();
@@ -429,6 +1968,49 @@ void testDatas()
     }
 
     AssertEqual(i, 6);
+
+    Datas ints = DatasNew();
+
+    for(int i = 0; i < 500; i++)
+        ints = DatasAddRef(ints, DataInt((i * 7919) % 1000 - 500));
+
+    ints = DatasSortInts(ints);
+
+    for(int i = 1; i < ints.count; i++)
+        AssertTrue(DataGetInt(ints.ptr[i - 1]) <= DataGetInt(ints.ptr[i]));
+
+    AssertTrue(DatasSearchIntIndex(ints, (7919 * 3) % 1000 - 500) >= 0);
+    AssertEqual(DatasSearchIntIndex(ints, 501), -1);
+
+    Datas hashes = DatasNew();
+
+    for(int i = 0; i < 300; i++)
+        hashes = DatasAddRef(hashes, sha256(DataInt(i)));
+
+    Datas sortedHashes = DatasSortHashes(DatasCopy(hashes));
+
+    FORDATAIN(hash, hashes)
+        AssertEqualData(sortedHashes.ptr[DatasSearchHashIndex(sortedHashes, *hash)], *hash);
+
+    AssertEqual(DatasSearchHashIndex(sortedHashes, sha256(DataInt(300))), -1);
+
+    testDatasNestedDict = DictNew();
+
+    for(int i = 0; i < 100; i++)
+        DictAdd(&testDatasNestedDict, DataInt(i), DataInt(99 - i));
+
+    Datas nested = DatasNew();
+
+    for(int i = 0; i < 100; i++)
+        nested = DatasAddRef(nested, DataInt(i));
+
+    nested = DatasSort(nested, testDatasNestedCompare);
+
+    for(int i = 0; i < 100; i++)
+        AssertEqual(DataGetInt(nested.ptr[i]), 99 - i);
+
+    AssertTrue(DatasSearchCheck(nested, DataInt(42), testDatasNestedCompare));
+    AssertEqual(DatasSearchInsertIndex(nested, DataInt(0), testDatasNestedCompare), 99);
 }
 
 void testHex()
@@ -1884,6 +3466,41 @@ void testManualHdWallet()
     AssertEqualData(kPriv, StringNew("xprv9zFnWC6h2cLgpmSA46vutJzBcfJ8yaJGg8cX1e5StJh45BBciYTRXSd25UEPVuesF9yog62tGAQtHjXajPPdbRCHuWS6T8XA2ECKADdw4Ef"));
 }
 
+void testCkdBatch()
+{
+    Data seedPhrase = DataCopy("Bitcoin seed", strlen("Bitcoin seed"));
+
+    Data I = hmacSha512(seedPhrase, fromHex("fffcf9f6f3f0edeae7e4e1dedbd8d5d2cfccc9c6c3c0bdbab7b4b1aeaba8a5a29f9c999693908d8a8784817e7b7875726f6c696663605d5a5754514e4b484542"));
+
+    Data mPrivRaw = hdWalletPriv(DataCopyDataPart(I, 0, 32), DataCopyDataPart(I, 32, 32));
+    Data mPubRaw = publicHdWallet(mPrivRaw);
+
+    Datas pubChildren = ckdBatch(mPubRaw, 0, 40);
+    Datas privChildren = ckdBatch(mPrivRaw, 0, 40);
+
+    AssertEqual(pubChildren.count, 40);
+    AssertEqual(privChildren.count, 40);
+
+    AssertEqualData(base58Encode(pubChildren.ptr[0]), StringNew("xpub69H7F5d8KSRgmmdJg2KhpAK8SR3DjMwAdkxj3ZuxV27CprR9LgpeyGmXUbC6wb7ERfvrnKZjXoUmmDznezpbZb7ap6r1D3tgFxHmwMkQTPH"));
+    AssertEqualData(base58Encode(privChildren.ptr[0]), StringNew("xprv9vHkqa6EV4sPZHYqZznhT2NPtPCjKuDKGY38FBWLvgaDx45zo9WQRUT3dKYnjwih2yJD9mkrocEZXo1ex8G81dwSM1fwqWpWkeS3v86pgKt"));
+
+    for(int i = 0; i < 40; i++) {
+
+        AssertEqualData(pubChildren.ptr[i], childKeyDerivation(mPubRaw, i));
+        AssertEqualData(privChildren.ptr[i], childKeyDerivation(mPrivRaw, i));
+        AssertEqualData(publicHdWallet(privChildren.ptr[i]), pubChildren.ptr[i]);
+    }
+
+    Datas hardened = ckdBatch(mPrivRaw, 0x80000000 - 1, 3);
+
+    AssertEqual(hardened.count, 3);
+
+    for(int i = 0; i < 3; i++)
+        AssertEqualData(hardened.ptr[i], childKeyDerivation(mPrivRaw, 0x80000000 - 1 + i));
+
+    AssertEqual(ckdBatch(mPubRaw, 5, 0).count, 0);
+}
+
 void testHdWallet()
 {
     Data seedPhrase = DataCopy("Bitcoin seed", strlen("Bitcoin seed"));
@@ -2038,9 +3655,17 @@ void testBloomFilters()
 
     Data bloom = bloomFilter((int)elements.count, desiredFalsePercent / 100, 0);
 
+    AssertTrue(bloomFilterFalsePositiveRate(bloom) == 0);
+    AssertTrue(bloomFilterFalsePositiveRate(DataNull()) == 1);
+
     for(int i = 0; i < elements.count; i++)
         AssertTrue(bloomFilterAddElement(bloom, elements.ptr[i]));
 
+    // Filled to its estimate the filter sits at the rate it was sized for
+    float estimatedRate = bloomFilterFalsePositiveRate(bloom);
+
+    AssertTrue(estimatedRate > desiredFalsePercent / 200 && estimatedRate < desiredFalsePercent / 50);
+
     for(int i = 0; i < elements.count; i++)
         AssertTrue(bloomFilterCheckElement(bloom, elements.ptr[i]));
 
@@ -2058,6 +3683,463 @@ void testBloomFilters()
     float errorRate = fabsf(desiredFalsePercent - falsePercent);
 
     AssertTrue(errorRate < 1);
+
+    // Going over the estimate raises the rate
+    for(int i = 0; i < elements.count; i++)
+        bloomFilterAddElement(bloom, uint32D(arc4random()));
+
+    AssertTrue(bloomFilterFalsePositiveRate(bloom) > 4 * estimatedRate);
+}
+
+static const char *testTrackerOldRootPath;
+static const char *testTrackerOldKeyDirectory;
+
+// A tracker over an empty database in 'directory' following 'root' as a manual wallet, with 'bloomahead'
+// keys past the last used one on each of its chains. Undone by 'testTrackerFree'.
+static TransactionTracker testTrackerNew(char *directory, Data root, int bloomahead)
+{
+    AssertTrue(mkdtemp(directory) != NULL);
+
+    testTrackerOldRootPath = databaseRootPath;
+    testTrackerOldKeyDirectory = keyManagerKeyDirectory;
+
+    databaseRootPath = directory;
+    keyManagerKeyDirectory = directory;
+
+    database = DatabaseNew();
+
+    KMSetHDWalletForUUID(&km, root, StringNew("testTracker"), KeyManagerHdWalletTypeManual);
+
+    TransactionTrackerBloomaheadCount = bloomahead;
+
+    TransactionTracker tt = TTNew(0);
+
+    TTUpdateBloomFilter(&tt);
+
+    return tt;
+}
+
+static void testTrackerFree(TransactionTracker *tt, const char *directory)
+{
+    TTTrack(tt);
+    DatabaseFree(&database);
+
+    TransactionTrackerBloomaheadCount = 100;
+    databaseRootPath = testTrackerOldRootPath;
+    keyManagerKeyDirectory = testTrackerOldKeyDirectory;
+
+    unlink(StringF("%s/blocks.db", directory).bytes);
+    unlink(StringF("%s/blocks.db-wal", directory).bytes);
+    unlink(StringF("%s/blocks.db-shm", directory).bytes);
+    AssertZero(rmdir(directory));
+
+    NotificationsProcess();
+}
+
+static Data testTrackerPubKey(Data root, const char *path)
+{
+    return pubKeyFromHdWallet(hdWallet(root, path));
+}
+
+// Spends 'txid':'index' with a p2wpkh witness for 'pubKey'. 'signature' only has to look like one.
+static void testTrackerSpend(Transaction *transaction, Data txid, uint32_t index, Data pubKey, const char *signature)
+{
+    TransactionInput *input = TransactionAddInput(transaction, txid, index, DataNull(), 0);
+
+    input->witnessStack = DatasTwoCopy(DataAddCopy(sha256(StringNew(signature)), sha256(StringNew(signature))), pubKey);
+}
+
+// The live UTXO set for 'root' must hold what TransactionAnalyzer works out from the whole history
+static void testTrackerUnspentMatches(TransactionTracker *tt, Data root)
+{
+    TransactionAnalyzer analyzer = TTAnalyzerFor(tt, root);
+    Datas events = TAEvents(&analyzer, TAEventTypeUnspent);
+
+    // Malleated copies of a transaction show up once for each copy
+    Dict expected = DictNew();
+    uint64_t expectedTotal = 0;
+
+    FORIN(TAEvent, event, events) {
+
+        Data key = DataAddCopy(TransactionTxid(*event->transaction), uint32D(event->outputIndex));
+
+        if(!DictHasKey(expected, key))
+            expectedTotal += event->amount;
+
+        DictAdd(&expected, key, DataLong((int64_t)event->amount));
+    }
+
+    Datas unspent = TTUnspentOutputs(tt, root);
+
+    AssertEqual(unspent.count, DictCount(expected));
+    AssertEqual(TTUnspentTotal(unspent), expectedTotal);
+
+    FORIN(TTUnspentOutput, output, unspent)
+        AssertEqual((uint64_t)DataGetLong(DictGet(expected, DataAddCopy(output->txid, uint32D(output->outputIndex)))), output->value);
+
+    TATrack(&analyzer);
+}
+
+// A deposit, a spend of it with change, a malleated copy of that spend, a double spend and a spend of the change
+static Datas testTrackerHistory(Data root)
+{
+    Data other = p2wpkhPubScriptFromPubKey(pubKey(sha256(StringNew("someone else"))));
+
+    Data receive0 = testTrackerPubKey(root, "0/0");
+    Data receive1 = testTrackerPubKey(root, "0/1");
+    Data change0 = testTrackerPubKey(root, "1/0");
+
+    Transaction deposit = TransactionEmpty();
+
+    testTrackerSpend(&deposit, sha256(StringNew("outside")), 0, pubKey(sha256(StringNew("someone else"))), "deposit");
+
+    deposit = TransactionAddOutput(deposit, p2wpkhPubScriptFromPubKey(receive0), 50000);
+    deposit = TransactionAddOutput(deposit, other, 1000);
+
+    Transaction spend = TransactionEmpty();
+
+    testTrackerSpend(&spend, TransactionTxid(deposit), 0, receive0, "spend");
+
+    spend = TransactionAddOutput(spend, other, 20000);
+    spend = TransactionAddOutput(spend, p2wpkhPubScriptFromPubKey(change0), 29000);
+
+    Transaction malleated = TransactionCopy(spend);
+
+    ((TransactionInput*)malleated.inputs.ptr[0].bytes)->witnessStack.ptr[0] = sha512(StringNew("malleated"));
+
+    Transaction doubleSpend = TransactionEmpty();
+
+    testTrackerSpend(&doubleSpend, TransactionTxid(deposit), 0, receive0, "double spend");
+
+    doubleSpend = TransactionAddOutput(doubleSpend, p2wpkhPubScriptFromPubKey(receive1), 40000);
+    doubleSpend = TransactionAddOutput(doubleSpend, other, 9000);
+
+    Transaction changeSpend = TransactionEmpty();
+
+    testTrackerSpend(&changeSpend, TransactionTxid(spend), 1, change0, "change spend");
+
+    changeSpend = TransactionAddOutput(changeSpend, other, 10000);
+    changeSpend = TransactionAddOutput(changeSpend, p2wpkhPubScriptFromPubKey(receive0), 18000);
+
+    Datas transactions = DatasNew();
+
+    transactions = DatasAddRef(transactions, TransactionData(deposit));
+    transactions = DatasAddRef(transactions, TransactionData(spend));
+    transactions = DatasAddRef(transactions, TransactionData(malleated));
+    transactions = DatasAddRef(transactions, TransactionData(doubleSpend));
+    transactions = DatasAddRef(transactions, TransactionData(changeSpend));
+
+    return transactions;
+}
+
+void testTrackerUnspent()
+{
+    Data root = publicHdWallet(hdWalletPriv(sha256(StringNew("tracker")), sha256(StringNew("tracker chain"))));
+    Data receive1 = testTrackerPubKey(root, "0/1");
+
+    Datas transactions = testTrackerHistory(root);
+
+    AssertEqualData(TransactionTxid(TransactionNew(transactions.ptr[1])), TransactionTxid(TransactionNew(transactions.ptr[2])));
+    AssertTrue(!DataEqual(hash256(transactions.ptr[1]), hash256(transactions.ptr[2])));
+
+    // Spenders before their funding, copies apart, double spends in either order
+    int addOrders[][5] = {
+        { 0, 1, 2, 3, 4 },
+        { 4, 3, 2, 1, 0 },
+        { 1, 4, 0, 3, 2 },
+        { 3, 2, 0, 4, 1 },
+    };
+
+    int removeOrders[][5] = {
+        { 0, 1, 2, 3, 4 },
+        { 4, 1, 3, 0, 2 },
+        { 4, 2, 0, 3, 1 },
+        { 3, 0, 2, 1, 4 },
+    };
+
+    for(int i = 0; i < sizeof(addOrders) / sizeof(addOrders[0]); i++) {
+
+        char directory[] = "/tmp/testTrackerXXXXXX";
+
+        TransactionTracker tt = testTrackerNew(directory, root, 5);
+
+        for(int j = 0; j < 5; j++) {
+
+            AssertEqual(TTAddTransaction(&tt, transactions.ptr[addOrders[i][j]]), 1);
+
+            testTrackerUnspentMatches(&tt, root);
+        }
+
+        // Only the double spend and the change spend pay the wallet unspent outputs
+        AssertEqual(TTUnspentTotal(TTUnspentOutputs(&tt, root)), 40000 + 18000);
+
+        // Rebuilding from scratch gives the same set
+        TTUpdateBloomFilter(&tt);
+
+        testTrackerUnspentMatches(&tt, root);
+
+        for(int j = 0; j < 5; j++) {
+
+            AssertEqual(TTRemoveTransactionByHash(&tt, hash256(transactions.ptr[removeOrders[i][j]])), 1);
+
+            testTrackerUnspentMatches(&tt, root);
+        }
+
+        AssertEqual(TTUnspentOutputs(&tt, root).count, 0);
+
+        testTrackerFree(&tt, directory);
+    }
+
+    // An output to a key past the lookahead is left out until the keys are rebuilt
+    char directory[] = "/tmp/testTrackerXXXXXX";
+
+    TransactionTracker tt = testTrackerNew(directory, root, 2);
+
+    Transaction beyond = TransactionEmpty();
+
+    testTrackerSpend(&beyond, sha256(StringNew("outside")), 1, pubKey(sha256(StringNew("someone else"))), "beyond");
+
+    beyond = TransactionAddOutput(beyond, p2wpkhPubScriptFromPubKey(testTrackerPubKey(root, "0/2")), 7000);
+    beyond = TransactionAddOutput(beyond, p2wpkhPubScriptFromPubKey(receive1), 3000);
+
+    AssertEqual(TTAddTransaction(&tt, TransactionData(beyond)), 1);
+    AssertEqual(TTUnspentTotal(TTUnspentOutputs(&tt, root)), 3000);
+
+    TTUpdateBloomFilter(&tt);
+
+    AssertEqual(TTUnspentTotal(TTUnspentOutputs(&tt, root)), 7000 + 3000);
+
+    testTrackerUnspentMatches(&tt, root);
+
+    testTrackerFree(&tt, directory);
+
+    // Installs from before key tags were stored have keys and a filter but no tags
+    char upgradeDirectory[] = "/tmp/testTrackerXXXXXX";
+
+    tt = testTrackerNew(upgradeDirectory, root, 100);
+
+    AssertZero(TTBloomFilterNeedsUpdate(&tt));
+
+    basicStorageSave(StringNew("keyTagsKey"), DictSerialize(DictNew()));
+    AssertEqual(DatabaseAddTransaction(&database, TransactionData(beyond), NULL), 1);
+
+    TTTrack(&tt);
+
+    tt = TTNew(0);
+
+    AssertTrue(TTBloomFilterNeedsUpdate(&tt));
+    AssertEqual(TTUnspentTotal(TTUnspentOutputs(&tt, root)), 7000 + 3000);
+    AssertZero(TTBloomFilterNeedsUpdate(&tt));
+
+    testTrackerUnspentMatches(&tt, root);
+
+    testTrackerFree(&tt, upgradeDirectory);
+}
+
+void testTrackerIndexes()
+{
+    Data root = publicHdWallet(hdWalletPriv(sha256(StringNew("tracker")), sha256(StringNew("tracker chain"))));
+    Data receive0 = testTrackerPubKey(root, "0/0");
+
+    Datas transactions = testTrackerHistory(root);
+
+    Data depositTxid = TransactionTxid(TransactionNew(transactions.ptr[0]));
+    Data spendTxid = TransactionTxid(TransactionNew(transactions.ptr[1]));
+
+    char directory[] = "/tmp/testTrackerXXXXXX";
+
+    TransactionTracker tt = testTrackerNew(directory, root, 5);
+
+    // A spender added before its funding transaction picks up the funding output once it arrives
+    AssertEqual(TTAddTransaction(&tt, transactions.ptr[1]), 1);
+
+    Transaction *spend = TTTransactionForHash(&tt, hash256(transactions.ptr[1]));
+
+    AssertTrue(spend != NULL);
+    AssertTrue(TTTransactionForTxid(&tt, spendTxid) == spend);
+    AssertTrue(TTTransactionForTxid(&tt, depositTxid) == NULL);
+    AssertTrue(TTTransactionSpending(&tt, depositTxid, 0) == spend);
+    AssertTrue(TTTransactionSpending(&tt, depositTxid, 1) == NULL);
+    AssertEqual(((TransactionInput*)spend->inputs.ptr[0].bytes)->fundingOutput.value, 0);
+
+    AssertEqual(TTAddTransaction(&tt, transactions.ptr[0]), 1);
+
+    Transaction *deposit = TTTransactionForHash(&tt, hash256(transactions.ptr[0]));
+
+    AssertTrue(deposit != NULL);
+    AssertTrue(TTTransactionForTxid(&tt, depositTxid) == deposit);
+    AssertTrue(TTTransactionSpending(&tt, depositTxid, 0) == spend);
+    AssertEqual(((TransactionInput*)spend->inputs.ptr[0].bytes)->fundingOutput.value, 50000);
+    AssertEqualData(((TransactionInput*)spend->inputs.ptr[0].bytes)->fundingOutput.script, p2wpkhPubScriptFromPubKey(receive0));
+
+    // A malleated duplicate has its own hash, removing it hands the txid and the outpoint back to the original
+    AssertEqual(TTAddTransaction(&tt, transactions.ptr[2]), 1);
+
+    Transaction *malleated = TTTransactionForHash(&tt, hash256(transactions.ptr[2]));
+
+    AssertTrue(malleated != NULL && malleated != spend);
+    AssertTrue(TTTransactionForHash(&tt, hash256(transactions.ptr[1])) == spend);
+
+    AssertEqual(TTRemoveTransactionByHash(&tt, hash256(transactions.ptr[2])), 1);
+
+    AssertTrue(TTTransactionForHash(&tt, hash256(transactions.ptr[2])) == NULL);
+    AssertTrue(TTTransactionForTxid(&tt, spendTxid) == spend);
+    AssertTrue(TTTransactionSpending(&tt, depositTxid, 0) == spend);
+
+    // Removing a double spend leaves the outpoint with the remaining spender
+    AssertEqual(TTAddTransaction(&tt, transactions.ptr[3]), 1);
+    AssertEqual(TTRemoveTransactionByHash(&tt, hash256(transactions.ptr[3])), 1);
+
+    AssertTrue(TTTransactionForHash(&tt, hash256(transactions.ptr[3])) == NULL);
+    AssertTrue(TTTransactionSpending(&tt, depositTxid, 0) == spend);
+
+    // and removing the other spender instead leaves it with the double spend
+    AssertEqual(TTAddTransaction(&tt, transactions.ptr[3]), 1);
+    AssertEqual(TTRemoveTransactionByHash(&tt, hash256(transactions.ptr[1])), 1);
+
+    Transaction *doubleSpend = TTTransactionForHash(&tt, hash256(transactions.ptr[3]));
+
+    AssertTrue(doubleSpend != NULL);
+    AssertTrue(TTTransactionForTxid(&tt, spendTxid) == NULL);
+    AssertTrue(TTTransactionSpending(&tt, depositTxid, 0) == doubleSpend);
+
+    AssertEqual(TTRemoveTransactionByHash(&tt, hash256(transactions.ptr[3])), 1);
+
+    AssertTrue(TTTransactionSpending(&tt, depositTxid, 0) == NULL);
+
+    AssertEqual(TTRemoveTransactionByHash(&tt, hash256(transactions.ptr[0])), 1);
+
+    AssertTrue(TTTransactionForTxid(&tt, depositTxid) == NULL);
+
+    testTrackerFree(&tt, directory);
+}
+
+static void testTrackerDictsEqual(Dict a, Dict b)
+{
+    AssertEqual(DictCount(a), DictCount(b));
+
+    FORINDICT(item, a)
+        AssertEqualData(DictGet(b, item->key), item->value);
+}
+
+void testTrackerThreads()
+{
+    Data root = publicHdWallet(hdWalletPriv(sha256(StringNew("tracker")), sha256(StringNew("tracker chain"))));
+    Data vaultMaster = publicHdWallet(hdWalletPriv(sha256(StringNew("tracker vault")), sha256(StringNew("tracker vault chain"))));
+
+    Datas vaultHdWallets = DatasTwoCopy(
+        publicHdWallet(hdWalletPriv(sha256(StringNew("tracker vault 1")), sha256(StringNew("tracker vault 1 chain")))),
+        publicHdWallet(hdWalletPriv(sha256(StringNew("tracker vault 2")), sha256(StringNew("tracker vault 2 chain")))));
+
+    char directory[] = "/tmp/testTrackerXXXXXX";
+
+    TransactionTracker tt = testTrackerNew(directory, root, 60);
+
+    uint32_t vaultIndex = KMVaultNames(&km).count;
+
+    KMAddVaultObserver(&km, vaultMaster, vaultHdWallets, StringNew("testTracker vault"));
+
+    // Keys from different derivation jobs, so different threads tag them
+    Transaction payment = TransactionEmpty();
+
+    testTrackerSpend(&payment, sha256(StringNew("outside")), 2, pubKey(sha256(StringNew("someone else"))), "payment");
+
+    payment = TransactionAddOutput(payment, p2wpkhPubScriptFromPubKey(testTrackerPubKey(root, "0/15")), 1000);
+    payment = TransactionAddOutput(payment, p2wpkhPubScriptFromPubKey(testTrackerPubKey(root, "0/30")), 2000);
+    payment = TransactionAddOutput(payment, p2wpkhPubScriptFromPubKey(testTrackerPubKey(root, "1/50")), 3000);
+
+    Data vault = KMVaultScriptDerivation(&km, vaultIndex, StringNew("1/40"));
+
+    AssertEqual(TTAddTransaction(&tt, TransactionData(payment)), 1);
+
+    TransactionTrackerDerivationThreads = 1;
+
+    TTUpdateBloomFilter(&tt);
+
+    Dict inlineKeys = DictionaryCopy(TTKeysAndKeyHashes(&tt));
+    Dict inlineTags = DictionaryCopy(tt.keyTags);
+
+    AssertEqual(TTUnspentTotal(TTUnspentOutputs(&tt, root)), 1000 + 2000 + 3000);
+    AssertEqualData(DictGet(inlineKeys, sha256(vault)), vault);
+    AssertTrue(DictGet(inlineTags, sha256(vault)).length > 0);
+
+    // TTUpdateBloomFilter empties the caches, so the threads derive everything again
+    TransactionTrackerDerivationThreads = 4;
+
+    TTUpdateBloomFilter(&tt);
+
+    testTrackerDictsEqual(TTKeysAndKeyHashes(&tt), inlineKeys);
+    testTrackerDictsEqual(tt.keyTags, inlineTags);
+
+    AssertEqual(TTUnspentTotal(TTUnspentOutputs(&tt, root)), 1000 + 2000 + 3000);
+
+    TransactionTrackerDerivationThreads = 0;
+
+    for(int i = 0; i < 4; i++)
+        WorkQueueThreadWaitAndDestroy(StringF("TT Derivation %d", i).bytes);
+
+    KMRemoveVault(&km, vaultIndex);
+
+    testTrackerFree(&tt, directory);
+}
+
+// Follows 'path' from 'hdWalletData' through the tracker's derivation cache, DataNull if a node isn't cached
+static Data testTrackerCachedDerivation(TransactionTracker *tt, Data hdWalletData, const char *path)
+{
+    Datas indices = ckdIndicesFromPath(path);
+
+    for(int i = 0; i < indices.count && hdWalletData.bytes; i++)
+        hdWalletData = DictGet(tt->derivationCache, DataAddCopy(hdWalletData, uint32D(*(uint32_t*)indices.ptr[i].bytes)));
+
+    return hdWalletData;
+}
+
+void testTrackerDerivationCache()
+{
+    Data root = publicHdWallet(hdWalletPriv(sha256(StringNew("tracker")), sha256(StringNew("tracker chain"))));
+    Data vaultMaster = publicHdWallet(hdWalletPriv(sha256(StringNew("tracker vault")), sha256(StringNew("tracker vault chain"))));
+    Data vaultHdWallet = publicHdWallet(hdWalletPriv(sha256(StringNew("tracker vault 1")), sha256(StringNew("tracker vault 1 chain"))));
+
+    char directory[] = "/tmp/testTrackerXXXXXX";
+
+    TransactionTracker tt = testTrackerNew(directory, root, 30);
+
+    uint32_t vaultIndex = KMVaultNames(&km).count;
+
+    KMAddVaultObserver(&km, vaultMaster, DatasOneCopy(vaultHdWallet), StringNew("testTracker vault"));
+
+    TTUpdateBloomFilter(&tt);
+
+    // Every node the cache holds is the one hdWallet() derives, through one and two levels
+    const char *walletPaths[] = { "0", "12", "29" };
+    const char *vaultPaths[] = { "0/0", "0/17", "1/29" };
+
+    for(int i = 0; i < sizeof(walletPaths) / sizeof(walletPaths[0]); i++) {
+
+        AssertEqualData(testTrackerCachedDerivation(&tt, hdWallet(root, "0"), walletPaths[i]), hdWallet(hdWallet(root, "0"), walletPaths[i]));
+        AssertEqualData(testTrackerCachedDerivation(&tt, hdWallet(root, "1"), walletPaths[i]), hdWallet(hdWallet(root, "1"), walletPaths[i]));
+    }
+
+    for(int i = 0; i < sizeof(vaultPaths) / sizeof(vaultPaths[0]); i++)
+        AssertEqualData(testTrackerCachedDerivation(&tt, vaultMaster, vaultPaths[i]), hdWallet(vaultMaster, vaultPaths[i]));
+
+    AssertTrue(DictGet(tt.walletKeysCache, hdWallet(root, "0/29")).length > 0);
+
+    // Rebuilding keeps only what the current wallets and lookaheads use
+    KMRemoveVault(&km, vaultIndex);
+
+    TransactionTrackerBloomaheadCount = 10;
+
+    TTUpdateBloomFilter(&tt);
+
+    AssertTrue(testTrackerCachedDerivation(&tt, vaultMaster, "0").bytes == NULL);
+    AssertTrue(testTrackerCachedDerivation(&tt, hdWallet(root, "0"), "29").bytes == NULL);
+    AssertTrue(DictGet(tt.walletKeysCache, hdWallet(root, "0/29")).bytes == NULL);
+
+    AssertEqualData(testTrackerCachedDerivation(&tt, hdWallet(root, "0"), "9"), hdWallet(root, "0/9"));
+    AssertTrue(DictGet(tt.walletKeysCache, hdWallet(root, "0/9")).length > 0);
+
+    testTrackerFree(&tt, directory);
 }
 
 void testTxSort()
@@ -2293,7 +4375,7 @@ static void blockHeaders(struct Node *node, Datas headers)
 
     if(headers.count) {
 
-        MerkleBlock block = MerkleBlockNew(headers.ptr[headers.count - 1]);
+        MerkleBlock block = MerkleBlockNew(DataCopyData(headers.ptr[headers.count - 1]));
 
         Datas hashes = DatasOneCopy(blockHash(&block));
 